@@ -22,12 +22,38 @@ void BackgroundTone::begin(uint16_t pin, BackgroundToneEventHandler callback)
   this->_callback = callback;
 }
 
+void BackgroundTone::setTickInterval(Microseconds_t tickInterval)
+{
+  this->_tickInterval = tickInterval;
+}
+
 void BackgroundTone::play(Sequence_t sequence)
 {
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    this->silence();
+    this->_ticksRemaining = 0;
+    this->_nextReady = false;
+  }
+
+  // ***
+  // *** OC2B only drives the pin when it is an output. The pin
+  // *** is left low whenever Timer2 is disconnected from it.
+  // ***
+  pinMode(this->_pin, OUTPUT);
+  digitalWrite(this->_pin, LOW);
+
   this->_currentSequence = sequence;
   this->_currentNoteIndex = sequence;
+  this->_lastNote = false;
   this->_isPlaying = true;
   this->_callback(SEQUENCE_STARTED);
+
+  // ***
+  // *** Start the first note now rather than on the next call
+  // *** to process().
+  // ***
+  this->process();
 }
 
 const bool BackgroundTone::isPlaying()
@@ -37,7 +63,15 @@ const bool BackgroundTone::isPlaying()
 
 void BackgroundTone::stop()
 {
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    this->silence();
+    this->_ticksRemaining = 0;
+    this->_nextReady = false;
+  }
+
   this->_currentSequence = NO_SEQUENCE;
+  this->_currentNoteIndex = END_OF_SEQUENCE;
   this->_isPlaying = false;
   this->_callback(SEQUENCE_COMPLETED);
 }
@@ -56,41 +90,148 @@ void BackgroundTone::process()
   if (this->_currentSequence != NO_SEQUENCE)
   {
     // ***
-    // *** OCR2A is the count down register for the timer used to generate the tone. When
-    // *** this value is zero, the current tone has completed.
+    // *** Read the next note while the current one is playing so
+    // *** tick() can start it without waiting for the loop.
     // ***
-    if (OCR2A == 0)
+    if (!this->_nextReady && !this->_lastNote)
     {
-      // ***
-      // *** Get the current note being played.
-      // ***
       uint16_t pitch, duration;
       this->getNextNote(pitch, duration);
 
       if (duration != END_OF_SEQUENCE)
       {
-        if (pitch != NOTE_REST)
+        this->prepareNote(pitch, duration, &this->_next);
+        this->_nextReady = true;
+      }
+      else
+      {
+        this->_lastNote = true;
+      }
+    }
+
+    bool idle = false;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+      // ***
+      // *** Nothing is playing at the start of a sequence or if
+      // *** the loop fell behind tick(); start the next note here.
+      // ***
+      if (this->_ticksRemaining == 0)
+      {
+        if (this->_nextReady)
         {
-          // ***
-          // *** Play the current note.
-          // ***
-          tone(this->_pin, pitch, duration);
+          this->startNextNote();
         }
         else
         {
-          // ***
-          // *** Start a tone on a non-existent port to fire
-          // *** the timer.
-          // ***
-          // *** TO DO: Replace this with a countdown on Timer2
-          // ***
-          tone(15, 100, duration);
+          idle = true;
         }
       }
     }
+
+    // ***
+    // *** The last note has finished.
+    // ***
+    if (idle && this->_lastNote)
+    {
+      this->_currentSequence = NO_SEQUENCE;
+      this->_currentNoteIndex = END_OF_SEQUENCE;
+      this->_isPlaying = false;
+      this->_callback(SEQUENCE_COMPLETED);
+    }
   }
 }
 
+void BackgroundTone::tick()
+{
+  if (this->_ticksRemaining != 0)
+  {
+    this->_ticksRemaining--;
+
+    if (this->_ticksRemaining == 0)
+    {
+      if (this->_nextReady)
+      {
+        this->startNextNote();
+      }
+      else
+      {
+        this->silence();
+      }
+    }
+  }
+}
+
+void BackgroundTone::prepareNote(uint16_t pitch, uint16_t duration, ToneNote_t* note)
+{
+  note->compare = 0;
+  note->clockSelect = 0;
+
+  if (pitch != NOTE_REST)
+  {
+    // ***
+    // *** OC2B toggles once per timer period so the period is half
+    // *** the period of the tone. Use the smallest divider that
+    // *** fits the period into eight bits.
+    // ***
+    uint32_t halfPeriod = (F_CPU / 2) / pitch;
+
+    for (uint8_t clockSelect = 1; clockSelect < sizeof(_timer2Shift); clockSelect++)
+    {
+      uint32_t count = halfPeriod >> pgm_read_byte(&_timer2Shift[clockSelect]);
+
+      if (count <= 256)
+      {
+        note->compare = count - 1;
+        note->clockSelect = clockSelect;
+        break;
+      }
+    }
+  }
+
+  // ***
+  // *** Convert the duration from milliseconds to ticks. A note
+  // *** longer than the tick count can hold is cut short.
+  // ***
+  uint32_t ticks = ((uint32_t)duration * 1000UL) / this->_tickInterval;
+  note->ticks = constrain(ticks, 1UL, (uint32_t)UINT16_MAX);
+}
+
+void BackgroundTone::startNextNote()
+{
+  if (this->_next.clockSelect != 0)
+  {
+    // ***
+    // *** CTC mode with OCR2A as TOP, toggling OC2B on
+    // *** each match.
+    // ***
+    TCCR2B = 0;
+    TCNT2 = 0;
+    OCR2A = this->_next.compare;
+    OCR2B = 0;
+    TCCR2A = _BV(COM2B0) | _BV(WGM21);
+    TCCR2B = this->_next.clockSelect;
+  }
+  else
+  {
+    this->silence();
+  }
+
+  this->_ticksRemaining = this->_next.ticks;
+  this->_nextReady = false;
+}
+
+void BackgroundTone::silence()
+{
+  // ***
+  // *** Stopping the clock and clearing the compare output mode
+  // *** hands the pin back to PORTD.
+  // ***
+  TCCR2B = 0;
+  TCCR2A = 0;
+}
+
 void BackgroundTone::getNextNote(uint16_t& pitch, uint16_t& duration)
 {
   // ***
@@ -113,15 +254,9 @@ void BackgroundTone::getNextNote(uint16_t& pitch, uint16_t& duration)
 
     pitch = pgm_read_word_near(_sequences + this->_currentNoteIndex);
     duration = pgm_read_word_near(_sequences + this->_currentNoteIndex + 1);
+    this->_currentNoteIndex += 2;
   }
-  else if (duration == END_OF_SEQUENCE)
-  {
-    this->_currentSequence = NO_SEQUENCE;
-    this->_currentNoteIndex = END_OF_SEQUENCE;
-    this->_isPlaying = false;
-    this->_callback(SEQUENCE_COMPLETED);
-  }
-  else
+  else if (duration != END_OF_SEQUENCE)
   {
     // ***
     // *** Increment the note index.
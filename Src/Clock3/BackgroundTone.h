@@ -18,12 +18,29 @@
 #define BACKGROUND_TONE_H
 
 #include <Arduino.h>
+#include <util/atomic.h>
 #include "MusicNotes.h"
+#include "Other\Timing.h"
 
 #define NO_SEQUENCE 0xffff
 #define END_OF_SEQUENCE 0xffff
 #define REPEAT_SEQUENCE 0
 
+// ***
+// *** The tone is made by Timer2 toggling OC2B (digital pin 3) in
+// *** hardware so the pitch does not depend on when interrupts run.
+// *** The length of each note is counted by tick() which is called
+// *** from the display refresh interrupt. The tick interval is the
+// *** time between calls in microseconds.
+// ***
+#define DEFAULT_TICK_INTERVAL 1000
+
+// ***
+// *** The Timer2 clock select bits (CS22:CS20) and the matching
+// *** divider expressed as a shift.
+// ***
+const static uint8_t _timer2Shift[] PROGMEM = { 0, 0, 3, 5, 6, 7, 8, 10 };
+
 // ***
 // *** This represents a sequence of pitch/duration pairs to play
 // *** melodies or sounds.
@@ -69,6 +86,17 @@ typedef enum SEQUENCE_EVENT_ID : uint8_t
   SEQUENCE_COMPLETED = 1
 } SequenceEventId_t;
 
+// ***
+// *** A note ready to be loaded into Timer2. A clock select of
+// *** 0 is a rest.
+// ***
+typedef struct TONE_NOTE
+{
+  uint8_t compare;      // OCR2A, half the period of the tone.
+  uint8_t clockSelect;  // CS22:CS20 for TCCR2B.
+  uint16_t ticks;       // The length of the note in ticks.
+} ToneNote_t;
+
 class BackgroundTone
 {
   public:
@@ -83,15 +111,29 @@ class BackgroundTone
     BackgroundTone() {};
 
     // ***
-    // *** Initializes the player.
+    // *** Initializes the player. The pin has to be the
+    // *** Timer2 OC2B pin.
     // ***
     void begin(uint16_t, BackgroundToneEventHandler);
 
     // ***
-    // *** Called in the loop to keep things moving.
+    // *** Sets the time between calls to tick() in microseconds.
+    // ***
+    void setTickInterval(Microseconds_t);
+
+    // ***
+    // *** Called in the loop to keep things moving. This reads the
+    // *** next note from the sequence while the current note plays.
     // ***
     void process();
 
+    // ***
+    // *** Called from a timer interrupt every tick interval. Counts
+    // *** down the current note and starts the next one the moment
+    // *** it ends.
+    // ***
+    void tick();
+
     // ***
     // *** Starts playing the specified sequence.
     // ***
@@ -145,5 +187,39 @@ class BackgroundTone
     // *** The event callback handler.
     // ***
     BackgroundToneEventHandler _callback;
+
+    // ***
+    // *** The time between calls to tick().
+    // ***
+    Microseconds_t _tickInterval = DEFAULT_TICK_INTERVAL;
+
+    // ***
+    // *** The ticks left in the note being played and the next
+    // *** note. These are shared with tick().
+    // ***
+    volatile uint16_t _ticksRemaining = 0;
+    volatile bool _nextReady = false;
+    ToneNote_t _next;
+
+    // ***
+    // *** Set when the end of the sequence has been read.
+    // ***
+    bool _lastNote = false;
+
+    // ***
+    // *** Converts a pitch and duration to Timer2 settings.
+    // ***
+    void prepareNote(uint16_t, uint16_t, ToneNote_t*);
+
+    // ***
+    // *** Loads the next note into Timer2. Interrupts must be
+    // *** disabled when this is called.
+    // ***
+    void startNextNote();
+
+    // ***
+    // *** Stops Timer2 and disconnects it from the pin.
+    // ***
+    void silence();
 };
 #endif
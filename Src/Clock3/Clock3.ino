@@ -41,7 +41,7 @@
 #include <AceButton.h>
 #include <EEPROM-Storage.h>
 #include "LedMatrix.h"
-#include "Other\ClockFont.h"
+#include "Other\ClockFontColumns.h"
 #include "GpsManager.h"
 #include "BackgroundTone.h"
 #include "TimeManager.h"
@@ -62,6 +62,14 @@ using namespace ace_button;
 // ***
 #define GPS_BATTERY_PIN A0
 
+// ***
+// *** Uncomment to count seconds from the DS1337 1 Hz SQW/INTB
+// *** output instead of polling the RTC. Pins 2 and 3 are used
+// *** by the buttons so the output is wired to A1 and uses the
+// *** pin change interrupt (PCINT1).
+// ***
+//#define RTC_SQW_PIN A1
+
 // ***
 // *** If debugging is enabled, The software serial port is created
 // *** and the TRACE statements are mapped to Debug.print() and TRACELN
@@ -81,13 +89,29 @@ SoftwareSerial Debug(-1, 7); // RX, TX
 #define TRACELN(x) Debug.println(x)
 #define TRACE_DATE(l, d) TraceDateTime(l, d)
 #define TRACE_DETAILS() traceTimeDetails()
+#define TRACE_TIMER_START() uint32_t traceTimerStart = micros()
+#define TRACE_TIMER_STOP(l) TRACE(l); TRACE(micros() - traceTimerStart); TRACELN(F(" us"))
+#define TRACE_BUDGET(b) traceRefreshBudget(b)
 #else
 #define TRACE(x)
 #define TRACELN(x)
 #define TRACE_DATE(l, d)
 #define TRACE_DETAILS()
+#define TRACE_TIMER_START()
+#define TRACE_TIMER_STOP(l)
+#define TRACE_BUDGET(b)
 #endif
 
+// ***
+// *** Brightness setting that follows the night schedule. The display
+// *** runs at full brightness during the day and NIGHT_BRIGHTNESS from
+// *** NIGHT_START_HOUR until NIGHT_END_HOUR (local time, 24-hour).
+// ***
+#define BRIGHTNESS_AUTO 0
+#define NIGHT_BRIGHTNESS MIN_BRIGHTNESS
+#define NIGHT_START_HOUR 22
+#define NIGHT_END_HOUR 6
+
 // ***
 // *** Create variables to be stored in EEPROM. The first parameter is the
 // *** address or location in EEPROM. The second parameter is the default
@@ -99,6 +123,7 @@ EEPROMStorage<uint8_t> _timeZoneId(0, 0);                       // This variable
 EEPROMStorage<DstMode_t> _dstMode(2, DstMode_t::AUTO);          // This variable is stored in EEPROM at positions 2 and 3 (2 bytes).
 EEPROMStorage<bool> _chime(4, true);                            // This variable is stored in EEPROM at positions 4 and 5 (2 bytes).
 EEPROMStorage<bool> _twelveHour(6, true);                       // This variable is stored in EEPROM at positions 6 and 7 (2 bytes).
+EEPROMStorage<uint8_t> _brightness(8, BRIGHTNESS_AUTO);         // This variable is stored in EEPROM at positions 8 and 9 (2 bytes).
 
 // ***
 // *** Create an instance of the GpsManager.
@@ -115,9 +140,30 @@ TimeManager _timeManager = TimeManager();
 // *** of the Spikenzielabs clock kit found at
 // *** https://www.spikenzielabs.com/Catalog/watches-clocks/solder-time-desk-clock.
 // ***
-// *** The instance is created using a refresh of 50hz.
+// *** The instance is created using the default refresh rate. The
+// *** rate is tuned for the board once the refresh interrupts have
+// *** been measured at startup.
+// ***
+LedMatrix _display = LedMatrix(DEFAULT_REFRESH_RATE);
+
+// ***
+// *** The share of the CPU (in percent) the display refresh may use
+// *** and a flag that is set once the refresh rate has been tuned.
 // ***
-LedMatrix _display = LedMatrix(50);
+#define REFRESH_LOAD_CEILING DEFAULT_LOAD_CEILING
+bool _refreshTuned = false;
+
+// ***
+// *** Uncomment to measure the row current during the power on self
+// *** test. This needs a current sense resistor in the LED supply
+// *** connected to the specified ADC channel.
+// ***
+//#define SELF_TEST_SENSE_CHANNEL 1
+
+// ***
+// *** Set once the result of the self test has been reported.
+// ***
+bool _selfTestReported = false;
 
 // ***
 // *** Create an instance of Mode to track the clock mode
@@ -153,6 +199,19 @@ BatteryMonitor _batteryMonitor(10, 5.0);
 // ***
 #define DISPLAY_TEXT_DELAY 650
 
+// ***
+// *** The transition used when the time changes.
+// ***
+#define TIME_TRANSITION TRANSITION_ROLL
+
+// ***
+// *** The LEDs used for the AM/PM and GPS fix indicators.
+// ***
+#define INDICATOR_PM_COLUMN 18
+#define INDICATOR_PM_ROW 5
+#define INDICATOR_GPS_COLUMN 18
+#define INDICATOR_GPS_ROW 1
+
 // ***
 // *** setup() is called once when the microcontroller
 // *** is first powered up.
@@ -160,6 +219,12 @@ BatteryMonitor _batteryMonitor(10, 5.0);
 void setup()
 {
 #ifdef DEBUG
+  // ***
+  // *** Paint the free memory so the lowest free memory
+  // *** can be reported.
+  // ***
+  paintStack();
+
   // ***
   // *** Initialize the default serial port.
   // ***
@@ -172,12 +237,15 @@ void setup()
   // ***
   TRACE(F("Time Zone ID from EEPROM: ")); TRACELN(_timeZoneId);
   _timeManager.begin(_timeZoneId, _dstMode, _twelveHour, onTimeEvent);
+#ifdef RTC_SQW_PIN
+  _timeManager.beginSquareWave(RTC_SQW_PIN);
+#endif
   TRACE_DETAILS();
 
   // ***
   // *** Initialize the LED matrix.
   // ***
-  _display.begin(&ClockFont);
+  _display.begin(&ClockFontColumns);
   TRACELN(F("The display has been initialized."));
 
   // ***
@@ -213,26 +281,39 @@ void setup()
   // ***
   Timer1.initialize(_display.getRefreshDelay());
   Timer1.attachInterrupt(onRefreshDisplay);
+  _display.enableCompareInterrupt();
   TRACELN(F("Timer1 has been initialized."));
 
   // ***
-  // *** Power on display test. This will ensure all LEDs are
-  // *** working and that the initialization of the display
-  // *** driver is working.
+  // *** Apply the brightness setting from EEPROM.
   // ***
-  _display.powerOnDisplayTest();
+  updateBrightness();
 
   // ***
   // *** Initialize the battery monitor and display
-  // *** the current voltage.
+  // *** the current voltage. This is done before the
+  // *** self test since the test may use the ADC.
   // ***
   _batteryMonitor.begin(GPS_BATTERY_PIN);
   TRACE(F("GPS Battery = ")); TRACE(_batteryMonitor.voltage()); TRACELN(F("v"));
 
+  // ***
+  // *** Power on display test. This will ensure all LEDs are
+  // *** working and that the initialization of the display
+  // *** driver is working. The test is run by the refresh
+  // *** interrupt so the rest of setup carries on.
+  // ***
+#ifdef SELF_TEST_SENSE_CHANNEL
+  _display.startSelfTest(SELF_TEST_SENSE_CHANNEL);
+#else
+  _display.startSelfTest();
+#endif
+
   // ***
   // *** Set up the background tone generator.
   // ***
   _tone.begin(SETUP_BUTTON, onBackgroundToneEvent);
+  _tone.setTickInterval(_display.getRefreshDelay());
   TRACELN(F("Sound has been initialized."));
 
   // ***
@@ -244,7 +325,7 @@ void setup()
   // ***
   // *** Show version number.
   // ***
-  _display.drawMomentaryTextCentered(STRING_DISPLAY_VERSION, DISPLAY_TEXT_DELAY * 3, true);
+  _display.drawMomentaryTextCentered(loadString(STRING_DISPLAY_VERSION), DISPLAY_TEXT_DELAY * 3, true);
 
   // ***
   // *** Display a message indicating that setup has completed.
@@ -281,6 +362,11 @@ void yield()
   // ***
   _tone.process();
 
+  // ***
+  // *** Expire momentary messages on the display.
+  // ***
+  _display.process();
+
   // ***
   // *** Keep the time manager ticking...
   // ***
@@ -297,16 +383,9 @@ void yield()
   }
 
   // ***
-  // *** If there is a tone playing, the serial port will interfere
-  // *** with the sound.
+  // *** Process the GPS.
   // ***
-  if (!_tone.isPlaying())
-  {
-    // ***
-    // *** Process the GPS.
-    // ***
-    _gpsManager.process();
-  }
+  _gpsManager.process();
 }
 
 // ***
@@ -315,6 +394,29 @@ void yield()
 // ***
 void loop()
 {
+  // ***
+  // *** Once the self test has completed report any faulty LEDs
+  // *** and then apply the refresh rate picked by the calibration.
+  // ***
+  if (!_refreshTuned && !_display.isSelfTesting())
+  {
+    if (!_selfTestReported)
+    {
+      reportSelfTest();
+      _selfTestReported = true;
+    }
+
+    _refreshTuned = tuneRefreshRate();
+  }
+
+  // ***
+  // *** Scrolling text belongs to the mode that started it.
+  // ***
+  if (_clockMode.modeChanged())
+  {
+    _display.stopScroll();
+  }
+
   // ***
   // *** Check the current mode.
   // ***
@@ -331,32 +433,12 @@ void loop()
           // *** Update the displayed time. Format the date and
           // *** time as time only.
           // ***
-          char buffer[5];
-          sprintf(buffer, FORMAT_TIME, _timeManager.localHour(), _timeManager.localMinute());
+          char buffer[6];
+          sprintf_P(buffer, FORMAT_TIME, _timeManager.localHour(), _timeManager.localMinute());
+          TRACE_TIMER_START();
           _display.drawTextCentered(buffer);
+          TRACE_TIMER_STOP(F("Render Time: "));
           TRACE(F("Display Time: ")); TRACELN(buffer);
-
-          // ***
-          // *** Do not show the AM/PM or GPS Fix indicators
-          // *** in 24-hour format.
-          // ***
-          if (_timeManager.displayTwelveHourFormat)
-          {
-            // ***
-            // *** Update the AM/PM mark on the display.
-            // *** Highlight the LED at x = 18 and y = 5
-            // *** when the time is PM.
-            // ***
-            _display.drawPixel(18, 5, _timeManager.isPm() ? 1 : 0);
-            TRACE(F("AM/PM => ")); TRACELN(_timeManager.isPm() ? F("PM") : F("AM"));
-
-            // ***
-            // *** Update the GPS fix mark on the display.
-            // *** Highlight the LED at x = 18 and y = 5
-            // *** when the time is PM.
-            // ***
-            _display.drawPixel(18, 1, _gpsManager.hasFix() ? 1 : 0);
-          }
         }
       }
       break;
@@ -367,21 +449,12 @@ void loop()
         // ***
         if (_clockMode.modeChanged())
         {
-          _display.drawMomentaryTextCentered(STRING_DISPLAY_TZ, DISPLAY_TEXT_DELAY, true);
+          _display.drawMomentaryTextCentered(loadString(STRING_DISPLAY_TZ), DISPLAY_TEXT_DELAY, true);
         }
 
         if (_clockMode.anyChanged())
         {
-          TimeZone_t* tz = TimeManager::getTimeZone(_timeManager.timeZoneId());
-
-          if (_timeManager.isDst())
-          {
-            _display.drawTextCentered(tz->dName);
-          }
-          else
-          {
-            _display.drawTextCentered(tz->sName);
-          }
+          displayText(_display, _timeManager.timeZoneName());
         }
       }
       break;
@@ -392,12 +465,12 @@ void loop()
         // ***
         if (_clockMode.modeChanged())
         {
-          _display.drawMomentaryTextCentered(STRING_DISPLAY_DST, DISPLAY_TEXT_DELAY, true);
+          _display.drawMomentaryTextCentered(loadString(STRING_DISPLAY_DST), DISPLAY_TEXT_DELAY, true);
         }
 
         if (_clockMode.anyChanged())
         {
-          _display.drawTextCentered(_timeManager.dstLabel());
+          displayText(_display, _timeManager.dstLabel());
         }
       }
       break;
@@ -405,7 +478,7 @@ void loop()
       {
         if (_clockMode.modeChanged())
         {
-          _display.drawMomentaryTextCentered(STRING_DISPLAY_CHIME, DISPLAY_TEXT_DELAY, true);
+          _display.drawMomentaryTextCentered(loadString(STRING_DISPLAY_CHIME), DISPLAY_TEXT_DELAY, true);
         }
 
         if (_clockMode.anyChanged())
@@ -418,7 +491,7 @@ void loop()
       {
         if (_clockMode.modeChanged())
         {
-          _display.drawMomentaryTextCentered(STRING_DISPLAY_FMT, DISPLAY_TEXT_DELAY, true);
+          _display.drawMomentaryTextCentered(loadString(STRING_DISPLAY_FMT), DISPLAY_TEXT_DELAY, true);
         }
 
         if (_clockMode.anyChanged())
@@ -427,6 +500,41 @@ void loop()
         }
       }
       break;
+    case Mode_t::MODE_BRIGHTNESS:
+      {
+        if (_clockMode.modeChanged())
+        {
+          _display.drawMomentaryTextCentered(loadString(STRING_DISPLAY_BRIGHTNESS), DISPLAY_TEXT_DELAY, true);
+        }
+
+        if (_clockMode.anyChanged())
+        {
+          displayBrightness(_display, _brightness);
+        }
+      }
+      break;
+  }
+
+  // ***
+  // *** Show the frame that was drawn above.
+  // ***
+  if (_clockMode.anyChanged())
+  {
+    updateIndicators();
+
+    // ***
+    // *** Animate changes to the time. Anything else,
+    // *** including entering the time mode, is shown
+    // *** at once.
+    // ***
+    if (_clockMode.mode() == Mode_t::MODE_DISPLAY_TIME && !_clockMode.modeChanged())
+    {
+      _display.present(TIME_TRANSITION);
+    }
+    else
+    {
+      _display.present();
+    }
   }
 
   // ***
@@ -450,11 +558,6 @@ void onBackgroundToneEvent(SequenceEventId_t eventId)
   {
     case SequenceEventId_t::SEQUENCE_STARTED:
       {
-        // ***
-        // *** Reset the display.
-        // ***
-        _display.reset();
-
         TRACELN(F("Track started. Buttons are temporarily disabled."));
       }
       break;
@@ -465,11 +568,6 @@ void onBackgroundToneEvent(SequenceEventId_t eventId)
         // ***
         pinMode(SETUP_BUTTON, INPUT_PULLUP);
         TRACELN(F("Track completed. Restored buttons."));
-
-        // ***
-        // *** Force the display to dedraw.
-        // ***
-        _clockMode.setupChanged(true);
       }
       break;
   }
@@ -498,7 +596,12 @@ void onGpsEvent(GpsEventId_t eventId)
         // ***
         if (_clockMode.mode() == Mode_t::MODE_DISPLAY_TIME)
         {
-          _clockMode.modeChanged(true);
+          // ***
+          // *** Only the indicator layer changes so there
+          // *** is no need to redraw the time.
+          // ***
+          updateIndicators();
+          _display.present();
           TRACE_DETAILS();
         }
       }
@@ -538,9 +641,12 @@ void onTimeEvent(TimeEventId_t eventId)
         TRACELN(F("Minute changed."));
 
         // ***
-        // *** Check the current minute.
+        // *** Check the current minute. Local time is used since
+        // *** some time zones are offset by a half hour from UTC.
         // ***
-        if (_timeManager.utcDateTime().minute() == 0)
+        uint8_t minute = _timeManager.localMinute();
+
+        if (minute == 0)
         {
           if (_chime)
           {
@@ -562,10 +668,10 @@ void onTimeEvent(TimeEventId_t eventId)
             TRACELN(F("Chime is disabled."));
           }
         }
-        else if (_timeManager.utcDateTime().minute() == 30)
+        else if (minute == 30)
         {
           // ***
-          // *** Every hour at 15 minutes past the hour,
+          // *** Every hour at half past the hour,
           // *** update the RTC from the GPS.
           // ***
           if (_gpsManager.hasFix())
@@ -576,6 +682,11 @@ void onTimeEvent(TimeEventId_t eventId)
           }
         }
 
+        // ***
+        // *** Follow the night schedule.
+        // ***
+        updateBrightness();
+
         // ***
         // *** Trigger a time update for the display.
         // ***
@@ -683,7 +794,7 @@ void modeButtonLongPressed()
   // *** A long press of the mode button will cause the time
   // *** to update from the GPS.
   // ***
-  _display.drawMomentaryTextCentered(STRING_DISPLAY_GPS, DISPLAY_TEXT_DELAY * 2, true);
+  _display.drawMomentaryTextCentered(loadString(STRING_DISPLAY_GPS), DISPLAY_TEXT_DELAY * 2, true);
 
   // ***
   // *** Update only when there is a GPS fix.
@@ -697,7 +808,7 @@ void modeButtonLongPressed()
   else
   {
     TRACELN(F("RTC could not be updated from the GPS; no fix."));
-    _display.drawMomentaryTextCentered(STRING_DISPLAY_NO_FIX, DISPLAY_TEXT_DELAY * 2, true);
+    _display.drawMomentaryTextCentered(loadString(STRING_DISPLAY_NO_FIX), DISPLAY_TEXT_DELAY * 2, true);
   }
 
   // ***
@@ -708,6 +819,12 @@ void modeButtonLongPressed()
 
 void modeButtonClicked()
 {
+  // ***
+  // *** Drop any messages still waiting from the previous
+  // *** mode so the name of the new mode is shown right away.
+  // ***
+  _display.cancelMomentaryText();
+
   // ***
   // *** Increment the mode and set the mode
   // *** changed flag.
@@ -723,12 +840,11 @@ void setupButtonClicked()
     case Mode_t::MODE_TZ:
       {
         // ***
-        // *** Increment the TZ offset
-        // *** by 60 minutes.
+        // *** Move on to the next time zone.
         // ***
         _timeZoneId++;
 
-        if (_timeZoneId > TimeManager::timeZoneCount())
+        if (_timeZoneId >= TimeManager::timeZoneCount())
         {
           _timeZoneId = 0;
         }
@@ -809,6 +925,35 @@ void setupButtonClicked()
         TRACE(F("Changed twelve hour to ")); TRACELN(_twelveHour ? "Yes" : "No");
       }
       break;
+    case Mode_t::MODE_BRIGHTNESS:
+      {
+        // ***
+        // *** Step through the levels and then
+        // *** back to auto.
+        // ***
+        _brightness++;
+
+        if (_brightness > MAX_BRIGHTNESS)
+        {
+          _brightness = BRIGHTNESS_AUTO;
+        }
+
+        // ***
+        // *** Apply the new brightness.
+        // ***
+        updateBrightness();
+
+        // ***
+        // *** Trigger setup change.
+        // ***
+        _clockMode.setupChanged(true);
+
+        // ***
+        // *** Write the new value to the serial port.
+        // ***
+        TRACE(F("Changed brightness to ")); TRACELN(_brightness);
+      }
+      break;
   }
 }
 
@@ -819,7 +964,7 @@ void setupButtonDoubleClicked()
   // ***
   if (_clockMode.mode() == Mode_t::MODE_DISPLAY_TIME)
   {
-    _display.drawMomentaryTextCentered(STRING_DISPLAY_BATTERY, DISPLAY_TEXT_DELAY, true);
+    _display.drawMomentaryTextCentered(loadString(STRING_DISPLAY_BATTERY), DISPLAY_TEXT_DELAY, true);
 
     // ***
     // *** Get the GPS backup battery voltage.
@@ -836,7 +981,7 @@ void setupButtonDoubleClicked()
     // *** Format the string for display.
     // ***
     char str[5];
-    sprintf(str, FORMAT_VOLTAGE, buffer);
+    sprintf_P(str, FORMAT_VOLTAGE, buffer);
 
     // ***
     // *** Display the string.
@@ -862,24 +1007,44 @@ void modeButtonDoubleClicked()
 }
 
 // ***
-// *** Called by the Timer1 to refresh the display.
+// *** Called by the Timer1 at the start of every refresh slot. This
+// *** is the clock's scheduler tick: it draws the next column and
+// *** counts down the note being played. Timer2 makes the tone in
+// *** hardware so neither disturbs the other.
 // ***
 void onRefreshDisplay()
 {
   // ***
-  // *** If the screen is refreshed while the tone is
-  // *** playing, the tone will not play smoothly. Hopefully,
-  // *** I will find a better way to handle this...
+  // *** Refresh the LED matrix.
   // ***
-  if (!_tone.isPlaying())
-  {
-    // ***
-    // *** Refresh the LED matrix.
-    // ***
-    _display.refresh();
-  }
+  _display.refresh();
+
+  // ***
+  // *** Time the current note.
+  // ***
+  _tone.tick();
 }
 
+// ***
+// *** Called by the Timer1 compare B match to switch the
+// *** current column on and off.
+// ***
+ISR(TIMER1_COMPB_vect)
+{
+  _display.compareMatch();
+}
+
+#ifdef RTC_SQW_PIN
+// ***
+// *** Called on each edge of the RTC square wave so the
+// *** time manager can count the seconds.
+// ***
+ISR(PCINT1_vect)
+{
+  _timeManager.tick();
+}
+#endif
+
 // ***
 // *** Displays the time zone offset centered on
 // *** the display.
@@ -890,7 +1055,7 @@ void displayTzOffset(const LedMatrix& display, int16_t value)
   // *** Format the string for display.
   // ***
   char buffer[3];
-  sprintf(buffer, FORMAT_NUMBER, value);
+  sprintf_P(buffer, FORMAT_NUMBER, value);
 
   // ***
   // *** Display the string.
@@ -898,19 +1063,154 @@ void displayTzOffset(const LedMatrix& display, int16_t value)
   display.drawTextCentered(buffer);
 }
 
+// ***
+// *** Updates the AM/PM and GPS fix indicators. These are drawn on
+// *** their own layer so they are kept when the text is redrawn. They
+// *** are only shown with the time in 12-hour format and are drawn
+// *** dimmer than the time.
+// ***
+void updateIndicators()
+{
+  bool show = _clockMode.mode() == Mode_t::MODE_DISPLAY_TIME && _timeManager.displayTwelveHourFormat;
+
+  _display.setLayer(LAYER_INDICATOR);
+  _display.drawPixel(INDICATOR_PM_COLUMN, INDICATOR_PM_ROW, show && _timeManager.isPm() ? LED_DIM : LED_OFF);
+  _display.drawPixel(INDICATOR_GPS_COLUMN, INDICATOR_GPS_ROW, show && _gpsManager.hasFix() ? LED_DIM : LED_OFF);
+  _display.setLayer(LAYER_TEXT);
+
+  if (show)
+  {
+    TRACE(F("AM/PM => ")); TRACELN(_timeManager.isPm() ? F("PM") : F("AM"));
+  }
+}
+
+// ***
+// *** Displays text centered on the display. Text that is
+// *** too wide for the display is scrolled instead.
+// ***
+void displayText(const LedMatrix& display, const char* text)
+{
+  if (display.getTextWidth(text) - 1 > display.width())
+  {
+    display.startScroll(text);
+  }
+  else
+  {
+    display.stopScroll();
+    display.drawTextCentered(text);
+  }
+}
+
 // ***
 // *** Displays a boolean value using the strings 'Yes' and
 // *** 'No'. The text is centered on the display.
 // ***
 void displayBoolean(const LedMatrix& display, bool value)
 {
-  char buffer[3];
-  sprintf(buffer, FORMAT_STRING, value ? STRING_DISPLAY_YES : STRING_DISPLAY_NO);
+  display.drawTextCentered(loadString(value ? STRING_DISPLAY_YES : STRING_DISPLAY_NO));
+}
 
-  // ***
-  // *** Update the time on the display.
-  // ***
-  display.drawTextCentered(buffer);
+// ***
+// *** Displays the brightness setting centered on the
+// *** display.
+// ***
+void displayBrightness(const LedMatrix& display, uint8_t value)
+{
+  if (value == BRIGHTNESS_AUTO)
+  {
+    display.drawTextCentered(loadString(STRING_DISPLAY_AUTO));
+  }
+  else
+  {
+    char buffer[4];
+    sprintf_P(buffer, FORMAT_NUMBER, value);
+    display.drawTextCentered(buffer);
+  }
+}
+
+// ***
+// *** Applies the brightness setting to the display. When the
+// *** setting is auto the brightness follows the night schedule.
+// ***
+void updateBrightness()
+{
+  uint8_t brightness = _brightness;
+
+  if (brightness == BRIGHTNESS_AUTO)
+  {
+    // ***
+    // *** localHour() may be in 12-hour format so use
+    // *** the 24-hour value from the local date and time.
+    // ***
+    uint8_t hour = _timeManager.localDateTime().hour();
+    bool night = hour >= NIGHT_START_HOUR || hour < NIGHT_END_HOUR;
+    brightness = night ? NIGHT_BRIGHTNESS : MAX_BRIGHTNESS;
+  }
+
+  _display.setBrightness(brightness);
+}
+
+// ***
+// *** Shows the number of LEDs that did not draw current during the
+// *** self test, if there are any.
+// ***
+void reportSelfTest()
+{
+  uint8_t faults = _display.getLedFaultCount();
+
+  if (faults > 0)
+  {
+    char buffer[8];
+    sprintf_P(buffer, FORMAT_LED_FAULTS, faults);
+    _display.drawMomentaryTextCentered(buffer, DISPLAY_TEXT_DELAY * 3, true);
+
+    for (uint8_t column = 0; column < COLUMNS; column++)
+    {
+      if (_display.getLedFaults(column))
+      {
+        TRACE(F("LED fault in column ")); TRACE(column); TRACE(F(", row mask ")); TRACELN(_display.getLedFaults(column));
+      }
+    }
+  }
+
+  TRACE(F("Self test completed with ")); TRACE(faults); TRACELN(F(" LED fault(s)."));
+}
+
+// ***
+// *** Starts the calibration the first time this is called and
+// *** changes the refresh rate to the one it picks once it has
+// *** completed. Returns true when the calibration has completed.
+// ***
+bool tuneRefreshRate()
+{
+  bool returnValue = false;
+  RefreshBudget_t budget;
+
+  if (_display.getRefreshBudget(&budget))
+  {
+    TRACE_BUDGET(budget);
+
+    if (budget.tunedRate != _display.getRefreshRate())
+    {
+      // ***
+      // *** Timer1 gets the new period and the compare values
+      // *** are rebuilt for the new TOP.
+      // ***
+      _display.setRefreshRate(budget.tunedRate);
+      Timer1.setPeriod(_display.getRefreshDelay());
+      _display.enableCompareInterrupt();
+      _tone.setTickInterval(_display.getRefreshDelay());
+      TRACE(F("Refresh rate changed to ")); TRACE(_display.getRefreshRate()); TRACELN(F(" Hz"));
+    }
+
+    returnValue = true;
+  }
+  else if (!_display.isCalibrating())
+  {
+    _display.startCalibration(REFRESH_LOAD_CEILING);
+  }
+
+  return returnValue;
 }
 
 #ifdef DEBUG
@@ -932,9 +1232,28 @@ void traceTimeDetails()
   TRACE(F("DST: ")); TRACELN(_timeManager.isDst() ? F("Yes") : F("No") );
   TRACE_DATE(F("UTC Dt/Tm [RTC]: "), _timeManager.utcDateTime());
   TRACE_DATE(F("Local Dt/Tm [RTC]: "), _timeManager.localDateTime());
+  TRACE(F("RTC Transactions: ")); TRACELN(_timeManager.rtcTransactions());
+  TRACE(F("RTC Square Wave: ")); TRACELN(_timeManager.isSquareWaveActive() ? F("Yes") : F("No"));
   TRACE(F("GPS Fix: ")); TRACELN(_gpsManager.hasFix() ? F("Yes") : F("No"));
   TRACE_DATE("UTC Dt/Tm [GPS]: ", _gpsManager.dateTime());
+  TRACE(F("Static memory = ")); TRACELN(staticMemory());
   TRACE(F("Free memory = ")); TRACELN(freeMemory());
+  TRACE(F("Lowest free memory = ")); TRACELN(lowestFreeMemory());
+  TRACELN();
+}
+
+// ***
+// *** Displays the measured refresh interrupt times and load.
+// ***
+void traceRefreshBudget(const RefreshBudget_t& budget)
+{
+  TRACELN();
+  TRACE(F("Refresh Rate: ")); TRACE(budget.refreshRate); TRACELN(F(" Hz"));
+  TRACE(F("Slot: ")); TRACE(budget.slotCycles); TRACELN(F(" cycles"));
+  TRACE(F("Refresh ISR (min/avg/max): ")); TRACE(budget.refreshMinimum); TRACE(F("/")); TRACE(budget.refreshAverage); TRACE(F("/")); TRACE(budget.refreshMaximum); TRACELN(F(" cycles"));
+  TRACE(F("Compare ISR (avg/max): ")); TRACE(budget.compareAverage); TRACE(F("/")); TRACE(budget.compareMaximum); TRACELN(F(" cycles"));
+  TRACE(F("Refresh Load: ")); TRACE(budget.load / 10); TRACE(F(".")); TRACE(budget.load % 10); TRACELN(F("%"));
+  TRACE(F("Tuned Refresh Rate: ")); TRACE(budget.tunedRate); TRACELN(F(" Hz"));
   TRACELN();
 }
 #endif
@@ -23,7 +23,7 @@ LedMatrix::LedMatrix() : Adafruit_GFX(COLUMNS, ROWS)
   this->setTextWrap(false);
 }
 
-LedMatrix::LedMatrix(uint32_t refreshRate) : Adafruit_GFX(COLUMNS, ROWS)
+LedMatrix::LedMatrix(uint8_t refreshRate) : Adafruit_GFX(COLUMNS, ROWS)
 {
   this->setRefreshRate(refreshRate);
   this->setTextSize(1);
@@ -35,17 +35,17 @@ void LedMatrix::begin()
   // ***
   // *** Set the column select pins up for output.
   // ***
-  DECODER_REGISTER = (DECODER_REGISTER & B11111111) | (_BV(DECODER_C) | _BV(DECODER_B) | _BV(DECODER_A));
+  DECODER_REGISTER |= DECODER_MASK;
 
   // ***
   // *** Set the row select pins up for output.
   // ***
-  ROW_REGISTER = (ROW_REGISTER & B11111111) | (_BV(ROW_7) | _BV(ROW_6) | _BV(ROW_5) | _BV(ROW_4) | _BV(ROW_3) | _BV(ROW_2) | _BV(ROW_1));
+  ROW_REGISTER |= ROW_MASK;
 
   // ***
   // *** Set the chip select pins up for output.
   // ***
-  CHIP_SELECT_REGISTER = (CHIP_SELECT_REGISTER & B11111111) | (_BV(CS_S2) | _BV(CS_S1));
+  CHIP_SELECT_REGISTER |= CS_MASK;
 
   // ***
   // *** Reset the display matrix.
@@ -55,10 +55,24 @@ void LedMatrix::begin()
 
 void LedMatrix::begin(const GFXfont* f)
 {
+  this->_textWidthCount = 0;
   this->setFont(f);
   this->begin();
 }
 
+void LedMatrix::begin(const ColumnFont_t* columnFont)
+{
+  this->_columnFont = columnFont;
+  this->_textWidthCount = 0;
+  this->begin();
+}
+
+void LedMatrix::begin(const GFXfont* f, const ColumnFont_t* columnFont)
+{
+  this->_columnFont = columnFont;
+  this->begin(f);
+}
+
 const uint8_t LedMatrix::getRefreshRate()
 {
   return this->_refreshRate;
@@ -66,320 +80,1414 @@ const uint8_t LedMatrix::getRefreshRate()
 
 void LedMatrix::setRefreshRate(uint8_t refreshRate)
 {
-  this->_refreshRate = refreshRate;
+  this->_refreshRate = constrain(refreshRate, MIN_REFRESH_RATE, MAX_REFRESH_RATE);
 
   // ***
   // *** Returns number of microseconds.
   // ***
   // *** 1. Refresh rate = x screen updates per second
   // *** 2. Multiple refresh rate by number of columns to get columns per second.
-  // *** 3. Divide 1 by columns per second to get seconds per column
-  // *** 4. Multiple by 1000 to get milliseconds per column.
-  // *** 5. Multiple by 1000 to microseconds per column.
+  // *** 3. Multiple by the number of planes since each column is shown
+  // ***    once per plane to get slots per second.
+  // *** 4. Divide 1,000,000 by slots per second to get microseconds per slot.
   // ***
-  this->_refreshDelay = (uint64_t)(1.0 / ((float)this->_refreshRate * (float)this->width()) * 1000.0 * 1000.0);
+  this->_refreshDelay = (Microseconds_t)(1000000UL / ((uint32_t)this->_refreshRate * COLUMNS * GRAYSCALE_BITS));
 }
 
-const uint32_t LedMatrix::getRefreshDelay()
+const Microseconds_t LedMatrix::getRefreshDelay()
 {
   return this->_refreshDelay;
 }
 
-void LedMatrix::drawPixel(int16_t column, int16_t row, uint16_t color)
+void LedMatrix::startCalibration(uint8_t loadCeiling, uint8_t flickerFreeRate)
 {
-  if (color == 0)
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
   {
-    // ***
-    // *** Clear the bit for the given row.
-    // ***
-    CLEAR_BIT(this->_matrixBuffer[column], row);
-  }
-  else
-  {
-    // ***
-    // *** Set the bit for the given row.
-    // ***
-    SET_BIT(this->_matrixBuffer[column], row);
+    this->_loadCeiling = loadCeiling;
+    this->_flickerFreeRate = flickerFreeRate;
+    this->_refreshTicksMinimum = 0xffff;
+    this->_refreshTicksMaximum = 0;
+    this->_refreshTicksTotal = 0;
+    this->_compareTicksMaximum = 0;
+    this->_compareTicksTotal = 0;
+    this->_compareMatches = 0;
+    this->_calibrationSlots = CALIBRATION_SLOTS;
   }
+}
+
+const bool LedMatrix::isCalibrating()
+{
+  bool returnValue;
 
   // ***
-  // *** Calculate the column compensation delay.
+  // *** The slot count is two bytes wide and is counted down by
+  // *** the refresh interrupt so it is read with the interrupts
+  // *** held off.
   // ***
-  if (this->_matrixBuffer[column] != 0)
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    returnValue = this->_calibrationSlots != 0;
+  }
+
+  return returnValue;
+}
+
+const bool LedMatrix::getRefreshBudget(RefreshBudget_t* budget)
+{
+  bool returnValue = false;
+
+  if (!this->isCalibrating() && this->_refreshTicksTotal != 0)
   {
+    uint16_t prescaler = this->getTimerPrescaler();
+
     // ***
-    // *** Get the count of bits that are set to 1 for the
-    // *** column y.
+    // *** Timer1 counts up and back down once per slot.
     // ***
-    uint8_t bitCount = this->getBitCount(this->_matrixBuffer[column]);
+    uint32_t slotTicks = 2UL * this->_timerTop;
 
     // ***
-    // *** Compensate COMP_DELAY_PER_BIT microseconds
-    // *** per row NOT displayed.
+    // *** There are two compare matches per slot when the
+    // *** compare interrupt is enabled.
     // ***
-    uint64_t compensationDelay = (8 * COMP_DELAY_PER_BIT) - (COMP_DELAY_PER_BIT * bitCount);
+    uint32_t compareTicks = 0;
+    uint16_t compareAverage = 0;
+
+    if (this->_compareMatches != 0)
+    {
+      compareTicks = (this->_compareTicksTotal * 2 * CALIBRATION_SLOTS) / this->_compareMatches;
+      compareAverage = this->_compareTicksTotal / this->_compareMatches;
+    }
+
+    budget->refreshMinimum = this->_refreshTicksMinimum * prescaler;
+    budget->refreshMaximum = this->_refreshTicksMaximum * prescaler;
+    budget->refreshAverage = (this->_refreshTicksTotal / CALIBRATION_SLOTS) * prescaler;
+    budget->compareMaximum = this->_compareTicksMaximum * prescaler;
+    budget->compareAverage = compareAverage * prescaler;
+    budget->slotCycles = slotTicks * prescaler;
+    budget->load = (this->_refreshTicksTotal + compareTicks) / ((CALIBRATION_SLOTS * slotTicks) / 1000);
+    budget->refreshRate = this->_refreshRate;
 
     // ***
-    // *** Store the value so the refresh routine does not have to
-    // *** do this work during the refresh cycle.
+    // *** The slots get shorter as the refresh rate goes up while the
+    // *** interrupts take the same time so the load is in proportion
+    // *** to the refresh rate.
     // ***
-    this->_compensationDelay[column] = compensationDelay;
+    uint16_t ceiling = (uint16_t)this->_loadCeiling * 10;
+    uint32_t flickerFreeLoad = ((uint32_t)budget->load * this->_flickerFreeRate) / this->_refreshRate;
+
+    if (flickerFreeLoad <= ceiling)
+    {
+      budget->tunedRate = this->_flickerFreeRate;
+    }
+    else
+    {
+      uint32_t rate = ((uint32_t)this->_refreshRate * ceiling) / budget->load;
+      budget->tunedRate = constrain(rate, MIN_REFRESH_RATE, MAX_REFRESH_RATE);
+    }
+
+    returnValue = true;
   }
+
+  return returnValue;
 }
 
-void LedMatrix::refresh()
+void LedMatrix::recordRefresh(uint16_t ticks)
 {
-  // ***
-  // *** Draw the current column.
-  // ***
-  this->drawColumn(this->_currentColumn, this->_matrixBuffer[this->_currentColumn]);
+  if (ticks < this->_refreshTicksMinimum)
+  {
+    this->_refreshTicksMinimum = ticks;
+  }
 
-  // ***
-  // *** Increment the current column.
-  // ***
-  this->_currentColumn++;
+  if (ticks > this->_refreshTicksMaximum)
+  {
+    this->_refreshTicksMaximum = ticks;
+  }
 
+  this->_refreshTicksTotal += ticks;
+  this->_calibrationSlots--;
+}
+
+void LedMatrix::recordCompareMatch(uint16_t ticks)
+{
   // ***
-  // *** Check if the last column has been updated.
+  // *** The match happens while Timer1 is counting up for
+  // *** the first match and down for the second.
   // ***
-  if (this->_currentColumn == this->width())
+  ticks = ticks > this->_activeCompare ? ticks - this->_activeCompare : this->_activeCompare - ticks;
+
+  if (ticks > this->_compareTicksMaximum)
   {
-    this->_currentColumn = 0;
+    this->_compareTicksMaximum = ticks;
   }
+
+  this->_compareTicksTotal += ticks;
+  this->_compareMatches++;
 }
 
-void LedMatrix::drawColumn(uint8_t column, uint8_t rows)
+uint16_t LedMatrix::getTimerPrescaler()
 {
-  // ***
-  // *** Disable all decoders. This turn all LEDs off.
-  // ***
-  CHIP_SELECT_PORT = DECODERS_OFF;
+  uint16_t returnValue = 1;
 
-  // ***
-  // *** Since this method is called in rapid succession, we can use a delay here to simulate
-  // *** PWM on the display. A longer delay here makes the display look dimmer. Depending on
-  // *** the number of rows that are turned on, a delay is calculated to compensate for when
-  // *** a column has less LEDs lit up and therefore looks brighter. The less rows displayed,
-  // *** the longer the delay (more time spent off).
-  // ***
-  delayMicroseconds(this->_compensationDelay[column]);
+  switch (TCCR1B & (_BV(CS12) | _BV(CS11) | _BV(CS10)))
+  {
+    case _BV(CS11):
+      returnValue = 8;
+      break;
+    case _BV(CS11) | _BV(CS10):
+      returnValue = 64;
+      break;
+    case _BV(CS12):
+      returnValue = 256;
+      break;
+    case _BV(CS12) | _BV(CS10):
+      returnValue = 1024;
+      break;
+  }
 
-  // ***
-  // *** Set the rows. The correct bits are already set
-  // *** in the rows parameter when the drawPixel method
-  // *** was called.
-  // ***
-  ROW_PORT = (ROW_PORT & B10000000) | rows;
+  return returnValue;
+}
 
+const uint8_t LedMatrix::getBrightness()
+{
+  return this->_brightness;
+}
+
+void LedMatrix::setBrightness(uint8_t brightness)
+{
   // ***
-  // *** Select the correct column. After taking the modulo of
-  // *** the column number with 8, the last 3 bits give the value of
-  // *** of the A, B and C channels. These 3 bits need to be
-  // *** shifted into the correction positions for the decorder
-  // *** port.
+  // *** Keep the value in range.
   // ***
-  DECODER_PORT = (DECODER_PORT & B10001111) | ((column % 8) << 4);
+  brightness = constrain(brightness, MIN_BRIGHTNESS, MAX_BRIGHTNESS);
+
+  if (brightness != this->_brightness)
+  {
+    this->_brightness = brightness;
+
+    // ***
+    // *** The brightness is applied to the compare values
+    // *** which are then copied into the descriptors.
+    // ***
+    this->updateCompareTable();
+    this->present();
+  }
+}
 
+void LedMatrix::drawPixel(int16_t column, int16_t row, uint16_t color)
+{
   // ***
-  // *** Select the correct column bank.
+  // *** Ignore anything drawn off the display.
   // ***
-  if (column <= 7)
+  if (column < 0 || column >= COLUMNS || row < 0 || row >= ROWS)
   {
-    CHIP_SELECT_PORT = DECODER_1;
+    return;
   }
-  else if (column <= 15)
+
+  // ***
+  // *** Anything brighter than the display can show is
+  // *** shown at full intensity.
+  // ***
+  if (color > INTENSITY_MAX)
   {
-    CHIP_SELECT_PORT = DECODER_2;
+    color = INTENSITY_MAX;
   }
-  else if (column <= 19)
+
+  // ***
+  // *** Each bit of the intensity is stored in its own plane.
+  // ***
+  for (uint8_t plane = 0; plane < GRAYSCALE_BITS; plane++)
   {
-    CHIP_SELECT_PORT = DECODER_3;
-  }
-}
+    uint8_t rows = this->_matrixBuffer[this->_layer][plane][column];
 
-uint8_t LedMatrix::getBitCount(uint8_t rows)
-{
-  uint8_t returnValue = 0;
+    if (color & _BV(plane))
+    {
+      // ***
+      // *** Set the bit for the given row.
+      // ***
+      SET_BIT(rows, row);
+    }
+    else
+    {
+      // ***
+      // *** Clear the bit for the given row.
+      // ***
+      CLEAR_BIT(rows, row);
+    }
 
-  for (int b = 0; b < 8; b++)
-  {
-    returnValue += (B00000001 & rows);
-    rows = rows >> 1;
+    this->writeColumn(plane, column, rows);
   }
-
-  return returnValue;
 }
 
-void LedMatrix::reset()
+void LedMatrix::refresh()
 {
   // ***
-  // *** Disable all decoders.
+  // *** Draw the current column. Timer1 latched the compare
+  // *** value of this descriptor at BOTTOM.
   // ***
-  CHIP_SELECT_PORT = DECODERS_OFF;
+  this->drawColumn(&this->_nextDescriptor);
+  this->_activeCompare = this->_nextDescriptor.compare;
 
   // ***
-  // *** All rows off.
+  // *** Increment the current slot.
   // ***
-  ROW_PORT = ROW_PORT & 0b1000000;
+  this->_currentSlot++;
 
   // ***
-  // *** Reset all row bits.
+  // *** Check if the last slot has been updated.
   // ***
-  this->clear();
+  if (this->_currentSlot == REFRESH_SLOTS)
+  {
+    this->_currentSlot = 0;
+
+    if (this->_selfTest != SELF_TEST_NONE)
+    {
+      this->advanceSelfTest();
+    }
+    else if (this->_scrolling && !this->_overlayActive)
+    {
+      this->advanceScroll();
+    }
+    else if (this->_transitionActive)
+    {
+      this->advanceTransition();
+    }
+  }
 
   // ***
-  // *** Reset the row and column counter for the refresh.
+  // *** OCR1B is double buffered by the hardware and is only latched
+  // *** when Timer1 reaches BOTTOM, which is when this method is
+  // *** called. The value written now applies to the next refresh
+  // *** slot so load the compare value for the next slot.
   // ***
-  this->_currentRow = 0;
-  this->_currentColumn = 0;
+  const ColumnDescriptor_t* descriptor;
+
+  if (this->_selfTest != SELF_TEST_NONE)
+  {
+    descriptor = this->getSelfTestDescriptor(this->_currentSlot);
+  }
+  else if (this->_scrolling && !this->_overlayActive)
+  {
+    descriptor = this->getScrollDescriptor(this->_currentSlot);
+  }
+  else if (this->_transitionActive)
+  {
+    descriptor = this->getTransitionDescriptor(this->_currentSlot);
+  }
+  else
+  {
+    descriptor = &this->_front[this->_currentSlot];
+  }
 
   // ***
-  // *** Reset the cursor.
+  // *** Copy the descriptor. The table it came from can become the
+  // *** back table and be rebuilt by present() before the next
+  // *** slot, so holding a pointer could mix the rows of one frame
+  // *** with the compare value of another.
   // ***
-  this->setCursor(0, 0);
-}
+  this->_nextDescriptor = *descriptor;
+  OCR1B = this->_nextDescriptor.compare;
 
-void LedMatrix::clear()
-{
   // ***
-  // *** Reset all row bits.
+  // *** Timer1 has been counting up since BOTTOM so its count
+  // *** is the time this interrupt has taken so far.
   // ***
-  for (uint8_t column = 0; column < COLUMNS; column++)
+  if (this->_calibrationSlots)
   {
-    this->_matrixBuffer[column] = 0;
-    this->_compensationDelay[column] = 0;
+    this->recordRefresh(TCNT1);
   }
 }
 
-const uint16_t LedMatrix::getTextWidth(const char* text)
+void LedMatrix::enableCompareInterrupt()
 {
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    // ***
+    // *** Capture TOP so the compensation delays can be
+    // *** converted to timer ticks.
+    // ***
+    this->_timerTop = ICR1;
+  }
+
   // ***
-  // *** Since this display is one line only and is using a
-  // *** specially designed font. This is a simplified calculation
-  // *** that only uses the xAdvance value in each character
-  // *** to determine width.
+  // *** Rebuild the descriptors now that the compare
+  // *** values can be calculated.
   // ***
-  uint16_t returnValue = 0;
+  this->updateCompareTable();
+  this->present();
 
-  uint8_t first = pgm_read_byte(&gfxFont->first);
-  uint8_t last = pgm_read_byte(&gfxFont->last);
-  char c;
+  // ***
+  // *** Clear any pending match and enable the interrupt. Note that
+  // *** TimerOne overwrites TIMSK1 when the overflow interrupt is
+  // *** attached.
+  // ***
+  TIFR1 = _BV(OCF1B);
+  TIMSK1 |= _BV(OCIE1B);
+}
 
-  while ((c = *text++))
+void LedMatrix::compareMatch()
+{
+  // ***
+  // *** The row and decoder ports were already set by drawColumn()
+  // *** so only the chip select bits need to change. The match
+  // *** while counting down switches the column off.
+  // ***
+  if (READ_CHIP_SELECT() != CS_OFF)
   {
-    if ((c >= first) && (c <= last))
+    WRITE_CHIP_SELECT(CS_OFF);
+  }
+  else if (TCNT1 > this->_activeCompare)
+  {
+    // ***
+    // *** The count is still above the compare value so the match
+    // *** while counting down has not happened yet; switch the
+    // *** column on.
+    // ***
+    WRITE_CHIP_SELECT(this->_columnSelect);
+
+    // ***
+    // *** Measure the row current while the column is on.
+    // ***
+    if (this->_senseSample)
     {
-      GFXglyph* glyph = pgm_read_glyph_ptr(gfxFont, c - first);
-      uint8_t xa = pgm_read_byte(&glyph->xAdvance);
-      returnValue += xa;
+      START_CONVERSION();
+      this->_senseSample = false;
     }
   }
 
-  return returnValue;
+  // ***
+  // *** Otherwise the interrupt was held off until after the match
+  // *** while counting down. OCF1B is a single flag so both matches
+  // *** are handled by this one interrupt and the column stays off
+  // *** for the rest of the slot rather than staying on until the
+  // *** next BOTTOM.
+  // ***
+
+  if (this->_calibrationSlots && this->_activeCompare)
+  {
+    this->recordCompareMatch(TCNT1);
+  }
 }
 
-void LedMatrix::drawTextCentered(const char* text)
+void LedMatrix::present()
 {
   // ***
-  // *** Clear the display.
+  // *** A transition reads the back table so it has
+  // *** to end before the table is rebuilt.
   // ***
-  this->clear();
+  this->_transitionActive = false;
 
-  // ***
-  // *** Calculate the width of the text. Remove the
-  // *** 1 pixel space at the end of the last character.
-  // ***
-  float textWidth = this->getTextWidth(text) - 1;
+  ColumnMask_t changed = this->_dirtyColumns;
 
   // ***
-  // *** Calculate the left position by dividing the difference
-  // *** between the screen width and the text width by 2.
+  // *** Showing or hiding a momentary message changes
+  // *** every column.
   // ***
-  float left = (this->width() - textWidth) / 2.0;
+  if (this->_overlayActive != this->_overlayPresented)
+  {
+    changed = ALL_COLUMNS;
+    this->_overlayPresented = this->_overlayActive;
+  }
 
   // ***
-  // *** Set the cursor at the calculated left position and the
-  // *** bottom of the display.
+  // *** Build the back table. The refresh interrupt never reads
+  // *** this table so it can take as long as it needs. The back
+  // *** table still holds the frame before the one being shown
+  // *** so it is missing the changes from the last present() too.
   // ***
-  this->setCursor(left, this->height() - 1);
+  ColumnMask_t rebuild = changed | this->_staleColumns;
+  ColumnDescriptor_t* descriptor = this->_back;
+  ColumnMask_t bit = 1;
+
+  for (uint8_t column = 0; column < COLUMNS; column++, bit <<= 1)
+  {
+    for (uint8_t plane = 0; plane < GRAYSCALE_BITS; plane++, descriptor++)
+    {
+      if (rebuild & bit)
+      {
+        this->buildDescriptor(descriptor, column, plane);
+      }
+    }
+  }
+
+  this->_staleColumns = changed;
+  this->_dirtyColumns = 0;
 
   // ***
-  // *** Display the text.
+  // *** Swap the tables. The pointer is two bytes wide so the
+  // *** interrupts are held off while it is written.
   // ***
-  this->print(text);
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    ColumnDescriptor_t* front = this->_front;
+    this->_front = this->_back;
+    this->_back = front;
+  }
 }
 
-void LedMatrix::testDisplay(uint16_t delayTime)
+void LedMatrix::present(Transition_t transition, uint8_t framesPerStep)
 {
+  this->present();
+
   // ***
-  // *** Loop through hours 1 to 24;
+  // *** After present() the front table holds the new frame and
+  // *** the back table the frame that was being shown. Messages
+  // *** are shown without a transition.
   // ***
-  for (uint8_t hour = 1; hour <= 24; hour++)
+  if (transition != TRANSITION_NONE && !this->_overlayActive)
   {
-    bool pm = hour >= 12;
-    uint8_t h = hour > 12 ? hour - 12 : hour;
+    switch (transition)
+    {
+      case TRANSITION_ROLL:
+        this->_transitionSteps = ROWS;
+        break;
+      case TRANSITION_WIPE:
+        this->_transitionSteps = COLUMNS;
+        break;
+      default:
+        this->_transitionSteps = DISSOLVE_LEVELS;
+        break;
+    }
+
+    this->_transition = transition;
+    this->_transitionFrames = framesPerStep > 0 ? framesPerStep : 1;
+    this->_transitionTick = 0;
+    this->_transitionStep = 0;
+    this->_transitionActive = true;
+  }
+}
+
+const bool LedMatrix::isTransitioning()
+{
+  return this->_transitionActive;
+}
+
+void LedMatrix::advanceTransition()
+{
+  if (++this->_transitionTick >= this->_transitionFrames)
+  {
+    this->_transitionTick = 0;
 
     // ***
-    // *** Lop through minutes 0 to 59.
-    // **
-    for (uint8_t minute = 0; minute < 60; minute++)
+    // *** The front table is the new frame so the last
+    // *** step just stops the transition.
+    // ***
+    if (++this->_transitionStep >= this->_transitionSteps)
     {
-      char buffer[5];
-      sprintf(buffer, "%01d:%02d", h, minute);
-      //String time = String(buffer);
+      this->_transitionActive = false;
+    }
+  }
+}
 
-      this->reset();
-      this->drawTextCentered(buffer);
-      this->drawPixel(18, 5, pm ? 1 : 0);
+const ColumnDescriptor_t* LedMatrix::getTransitionDescriptor(uint8_t slot)
+{
+  uint8_t column = slot / GRAYSCALE_BITS;
+  uint8_t plane = slot % GRAYSCALE_BITS;
+  uint8_t from = this->_back[slot].rows;
+  uint8_t to = this->_front[slot].rows;
+  uint8_t step = this->_transitionStep;
+  uint8_t rows = to;
 
-      delay(delayTime);
-    }
+  // ***
+  // *** Each style does a fixed amount of work for every slot
+  // *** so the time spent in the interrupt does not depend on
+  // *** the step or on what is being shown.
+  // ***
+  switch (this->_transition)
+  {
+    case TRANSITION_ROLL:
+      // ***
+      // *** The old rows move up and out while the new rows come
+      // *** in from the bottom. Columns that have not changed stay
+      // *** still.
+      // ***
+      if (from != to)
+      {
+        rows = ((from >> step) | (to << (ROWS - step))) & ROW_MASK;
+      }
+      break;
+    case TRANSITION_WIPE:
+      rows = column < step ? to : from;
+      break;
+    case TRANSITION_DISSOLVE:
+      {
+        uint8_t mask = pgm_read_byte(&_dissolveMasks[step][column % 8]);
+        rows = (from & ~mask) | (to & mask);
+      }
+      break;
+    default:
+      break;
+  }
+
+  this->_computedDescriptor.rows = rows;
+  this->_computedDescriptor.address = this->_front[slot].address;
+  this->_computedDescriptor.compare = this->_compareTable[plane][this->getBitCount(rows)];
+
+  return &this->_computedDescriptor;
+}
+
+const ColumnMask_t LedMatrix::getDirtyColumns()
+{
+  return this->_dirtyColumns;
+}
+
+bool LedMatrix::writeColumn(uint8_t plane, uint8_t column, uint8_t rows)
+{
+  bool returnValue = false;
+
+  if (this->_matrixBuffer[this->_layer][plane][column] != rows)
+  {
+    this->_matrixBuffer[this->_layer][plane][column] = rows;
+    this->_dirtyColumns |= COLUMN_BIT(column);
+    returnValue = true;
   }
+
+  return returnValue;
 }
 
-void LedMatrix::powerOnDisplayTest()
+void LedMatrix::buildDescriptor(ColumnDescriptor_t* descriptor, uint8_t column, uint8_t plane)
 {
   // ***
-  // *** Light each LED.
+  // *** The rows are the layers of the framebuffer ORed together
+  // *** unless a momentary message is covering them. Messages are
+  // *** shown at full intensity so they are the same in every plane.
   // ***
-  for (uint8_t x = 0; x < this->width(); x++)
+  if (this->_overlayActive)
+  {
+    descriptor->rows = this->_overlayBuffer[column];
+  }
+  else
   {
-    for (uint8_t y = 0; y < this->height(); y++)
+    descriptor->rows = 0;
+
+    for (uint8_t layer = 0; layer < LAYER_COUNT; layer++)
     {
-      this->drawPixel(x, y, 1);
-      delay(10);
+      descriptor->rows |= this->_matrixBuffer[layer][plane][column];
     }
   }
 
   // ***
-  // *** Pause for 2 seconds to show each
-  // *** LED is working.
+  // *** The decoder inputs and the chip select bits for the
+  // *** column were worked out by the compiler.
   // ***
-  delay(2000);
+  descriptor->address = pgm_read_byte(&_columnAddress[column]);
 
   // ***
-  // *** Clear the display.
+  // *** The compare value only depends on the plane and the
+  // *** number of LEDs lit so it comes from the lookup table.
   // ***
-  this->clear();
+  descriptor->compare = this->_compareTable[plane][this->getBitCount(descriptor->rows)];
+}
+
+void LedMatrix::updateCompareTable()
+{
+  // ***
+  // *** Every descriptor holds a compare value from
+  // *** this table.
+  // ***
+  this->_dirtyColumns = ALL_COLUMNS;
+
+  for (uint8_t plane = 0; plane < GRAYSCALE_BITS; plane++)
+  {
+    for (uint8_t bitCount = 0; bitCount <= ROWS; bitCount++)
+    {
+      this->_compareTable[plane][bitCount] = this->calculateCompareValue(plane, bitCount);
+    }
+  }
 }
 
-void LedMatrix::drawMomentaryTextCentered(const char* text, uint64_t displayTime, bool resetAfter)
+uint16_t LedMatrix::calculateCompareValue(uint8_t plane, uint8_t bitCount)
 {
   // ***
-  // *** Draw the text centered.
+  // *** Compensate COMP_DELAY_PER_BIT microseconds per row NOT
+  // *** displayed. A column with fewer LEDs lit looks brighter
+  // *** so it is given more time off.
+  // ***
+  uint32_t compensationDelay = (8 * COMP_DELAY_PER_BIT) - (COMP_DELAY_PER_BIT * bitCount);
+
+  // ***
+  // *** Timer1 runs in phase and frequency correct mode so it counts
+  // *** from BOTTOM up to TOP and back down once per refresh slot. The
+  // *** column is switched on at the up count match and off at the
+  // *** down count match, centering the on time in the slot. The
+  // *** compensation is taken from the whole time the column is shown
+  // *** (one slot per plane) so it looks the same for any number of
+  // *** planes.
+  // ***
+  uint32_t columnTime = (uint32_t)this->_refreshDelay * GRAYSCALE_BITS;
+  uint32_t onTime = compensationDelay < columnTime ? columnTime - compensationDelay : 0;
+  uint32_t window = ((uint32_t)this->_timerTop * onTime) / columnTime;
+
+  // ***
+  // *** Binary code modulation: each plane is on for half as long as
+  // *** the plane above it. The slots are all the same length so the
+  // *** interrupt rate stays fixed; only the on window is weighted.
   // ***
-  this->drawTextCentered(text);
+  window >>= (GRAYSCALE_BITS - 1 - plane);
 
   // ***
-  // *** Use delay to pause the text.
+  // *** Apply the global brightness by halving the window
+  // *** for each level below the maximum.
   // ***
-  delay(displayTime);
+  window >>= (MAX_BRIGHTNESS - this->_brightness);
 
   // ***
-  // *** Clear the display if specified.
+  // *** Keep the value inside the counting range so both matches
+  // *** always occur. Two matches this close together may be
+  // *** handled by one interrupt; compareMatch() leaves the column
+  // *** off when that happens.
   // ***
-  if (resetAfter)
+  uint32_t compareValue = this->_timerTop - window;
+
+  if (compareValue >= this->_timerTop)
   {
-    this->clear();
+    compareValue = this->_timerTop - 1;
   }
+
+  if (compareValue == 0)
+  {
+    compareValue = 1;
+  }
+
+  return compareValue;
+}
+
+void LedMatrix::drawColumn(const ColumnDescriptor_t* descriptor)
+{
+  // ***
+  // *** Disable all decoders. This turn all LEDs off.
+  // ***
+  WRITE_CHIP_SELECT(CS_OFF);
+
+  // ***
+  // *** Set the rows and the column address. Both values were
+  // *** shifted into position when the descriptor was built.
+  // ***
+  WRITE_ROWS(descriptor->rows);
+  WRITE_DECODER(descriptor->address);
+
+  // ***
+  // *** The bank is not enabled here; the compare interrupt switches
+  // *** it on and off so the column is lit for only part of the
+  // *** refresh slot.
+  // ***
+  this->_columnSelect = descriptor->address & CS_MASK;
+}
+
+uint8_t LedMatrix::getBitCount(uint8_t rows)
+{
+  // ***
+  // *** Look up each half of the byte.
+  // ***
+  return pgm_read_byte(&_nibbleBitCount[rows & 0x0f]) + pgm_read_byte(&_nibbleBitCount[rows >> 4]);
+}
+
+void LedMatrix::reset()
+{
+  // ***
+  // *** Disable all decoders.
+  // ***
+  WRITE_CHIP_SELECT(CS_OFF);
+  this->_columnSelect = CS_OFF;
+
+  // ***
+  // *** All rows off.
+  // ***
+  WRITE_ROWS(0);
+
+  // ***
+  // *** Reset all row bits in every layer and show
+  // *** the empty frame.
+  // ***
+  for (uint8_t layer = 0; layer < LAYER_COUNT; layer++)
+  {
+    this->clearLayer((Layer_t)layer);
+  }
+
+  this->_layer = LAYER_TEXT;
+  this->present();
+
+  // ***
+  // *** Reset the row and column counter for the refresh.
+  // ***
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    this->_currentRow = 0;
+    this->_currentSlot = 0;
+    this->_nextDescriptor = this->_front[0];
+  }
+
+  // ***
+  // *** Reset the cursor.
+  // ***
+  this->setCursor(0, 0);
+}
+
+void LedMatrix::clear()
+{
+  // ***
+  // *** Reset all row bits.
+  // ***
+  for (uint8_t plane = 0; plane < GRAYSCALE_BITS; plane++)
+  {
+    for (uint8_t column = 0; column < COLUMNS; column++)
+    {
+      this->writeColumn(plane, column, 0);
+    }
+  }
+}
+
+void LedMatrix::clearLayer(Layer_t layer)
+{
+  Layer_t current = this->_layer;
+
+  this->_layer = layer;
+  this->clear();
+  this->_layer = current;
+}
+
+const Layer_t LedMatrix::getLayer()
+{
+  return this->_layer;
+}
+
+void LedMatrix::setLayer(Layer_t layer)
+{
+  if (layer < LAYER_COUNT)
+  {
+    this->_layer = layer;
+  }
+}
+
+const uint16_t LedMatrix::getTextWidth(const char* text)
+{
+  uint16_t returnValue = 0;
+
+  // ***
+  // *** Look for the text in the cache. This only reads RAM
+  // *** which is quicker than reading the glyphs from flash.
+  // ***
+  bool cached = false;
+
+  for (uint8_t i = 0; i < this->_textWidthCount && !cached; i++)
+  {
+    if (strcmp(this->_textWidths[i].text, text) == 0)
+    {
+      returnValue = this->_textWidths[i].width;
+      cached = true;
+    }
+  }
+
+  // ***
+  // *** Measure the text and add it to the cache replacing
+  // *** the entries in turn. Text that is too long or too
+  // *** wide for an entry is not cached.
+  // ***
+  if (!cached)
+  {
+    returnValue = this->measureText(text);
+
+    if (returnValue <= 0xff && strlen(text) < TEXT_WIDTH_TEXT_SIZE)
+    {
+      TextWidth_t* entry = &this->_textWidths[this->_textWidthNext];
+      strcpy(entry->text, text);
+      entry->width = returnValue;
+
+      this->_textWidthNext = (this->_textWidthNext + 1) % TEXT_WIDTH_CACHE_SIZE;
+
+      if (this->_textWidthCount < TEXT_WIDTH_CACHE_SIZE)
+      {
+        this->_textWidthCount++;
+      }
+    }
+  }
+
+  return returnValue;
+}
+
+const int16_t LedMatrix::getCenteredColumn(const char* text)
+{
+  // ***
+  // *** Calculate the width of the text. Remove the
+  // *** 1 pixel space at the end of the last character.
+  // ***
+  int16_t textWidth = this->getTextWidth(text) - 1;
+
+  // ***
+  // *** Calculate the left position by dividing the difference
+  // *** between the screen width and the text width by 2. Any
+  // *** odd column is left on the right side, the same as
+  // *** truncating the result of a floating point division.
+  // ***
+  return (this->width() - textWidth) / 2;
+}
+
+uint16_t LedMatrix::measureText(const char* text)
+{
+  // ***
+  // *** Since this display is one line only and is using a
+  // *** specially designed font. This is a simplified calculation
+  // *** that only uses the xAdvance value in each character
+  // *** to determine width.
+  // ***
+  uint16_t returnValue = 0;
+
+  if (this->_columnFont)
+  {
+    // ***
+    // *** The column font has its own xAdvance table.
+    // ***
+    uint8_t first = pgm_read_byte(&this->_columnFont->first);
+    uint8_t last = pgm_read_byte(&this->_columnFont->last);
+    const ColumnGlyph_t* glyphs = (const ColumnGlyph_t*)pgm_read_pointer(&this->_columnFont->glyph);
+    char c;
+
+    while ((c = *text++))
+    {
+      if ((c >= first) && (c <= last))
+      {
+        returnValue += pgm_read_byte(&glyphs[c - first].xAdvance);
+      }
+    }
+
+    return returnValue;
+  }
+
+  uint8_t first = pgm_read_byte(&gfxFont->first);
+  uint8_t last = pgm_read_byte(&gfxFont->last);
+  char c;
+
+  while ((c = *text++))
+  {
+    if ((c >= first) && (c <= last))
+    {
+      GFXglyph* glyph = pgm_read_glyph_ptr(gfxFont, c - first);
+      uint8_t xa = pgm_read_byte(&glyph->xAdvance);
+      returnValue += xa;
+    }
+  }
+
+  return returnValue;
+}
+
+void LedMatrix::drawTextCentered(const char* text)
+{
+  // ***
+  // *** Find where the text starts.
+  // ***
+  int16_t left = this->getCenteredColumn(text);
+
+  if (this->_columnFont)
+  {
+    // ***
+    // *** Lay the text out on its own and then write only the
+    // *** columns that differ from the framebuffer. The column
+    // *** font is already aligned to the bottom of the display.
+    // ***
+    uint8_t columns[COLUMNS];
+    memset(columns, 0, sizeof(columns));
+    this->renderText(columns, COLUMNS, left, text);
+
+    for (uint8_t plane = 0; plane < GRAYSCALE_BITS; plane++)
+    {
+      for (uint8_t column = 0; column < COLUMNS; column++)
+      {
+        this->writeColumn(plane, column, columns[column]);
+      }
+    }
+  }
+  else
+  {
+    // ***
+    // *** Clear the display.
+    // ***
+    this->clear();
+
+    // ***
+    // *** Set the cursor at the calculated left position and the
+    // *** bottom of the display.
+    // ***
+    this->setCursor(left, this->height() - 1);
+
+    // ***
+    // *** Display the text.
+    // ***
+    this->print(text);
+  }
+}
+
+void LedMatrix::drawText(int16_t column, const char* text)
+{
+  uint8_t columns[COLUMNS];
+  memset(columns, 0, sizeof(columns));
+  this->renderText(columns, COLUMNS, column, text);
+
+  // ***
+  // *** Text is drawn at full intensity so the same
+  // *** columns go into every plane.
+  // ***
+  for (uint8_t plane = 0; plane < GRAYSCALE_BITS; plane++)
+  {
+    for (uint8_t x = 0; x < COLUMNS; x++)
+    {
+      this->writeColumn(plane, x, this->_matrixBuffer[this->_layer][plane][x] | columns[x]);
+    }
+  }
+}
+
+void LedMatrix::renderText(uint8_t* buffer, uint8_t size, int16_t column, const char* text)
+{
+  // ***
+  // *** Nothing can be rendered without a column font.
+  // ***
+  if (!this->_columnFont)
+  {
+    return;
+  }
+
+  uint8_t first = pgm_read_byte(&this->_columnFont->first);
+  uint8_t last = pgm_read_byte(&this->_columnFont->last);
+  const uint8_t* bitmap = (const uint8_t*)pgm_read_pointer(&this->_columnFont->bitmap);
+  const ColumnGlyph_t* glyphs = (const ColumnGlyph_t*)pgm_read_pointer(&this->_columnFont->glyph);
+  char c;
+
+  while ((c = *text++) && column < size)
+  {
+    if ((c >= first) && (c <= last))
+    {
+      const ColumnGlyph_t* glyph = &glyphs[c - first];
+      uint16_t offset = pgm_read_word(&glyph->bitmapOffset);
+      uint8_t width = pgm_read_byte(&glyph->width);
+
+      // ***
+      // *** Each glyph column holds all of its rows so it
+      // *** takes one OR to draw it.
+      // ***
+      for (uint8_t i = 0; i < width; i++)
+      {
+        int16_t x = column + i;
+
+        if (x >= 0 && x < size)
+        {
+          buffer[x] |= pgm_read_byte(&bitmap[offset + i]);
+        }
+      }
+
+      column += pgm_read_byte(&glyph->xAdvance);
+    }
+  }
+}
+
+bool LedMatrix::startScroll(const char* text, uint8_t framesPerStep)
+{
+  bool returnValue = false;
+
+  if (this->_columnFont)
+  {
+    // ***
+    // *** Stop the refresh interrupt reading the scroll
+    // *** buffer while it is rebuilt.
+    // ***
+    this->_scrolling = false;
+
+    // ***
+    // *** Render the text once. Remove the 1 pixel space
+    // *** at the end of the last character.
+    // ***
+    memset(this->_scrollBuffer, 0, sizeof(this->_scrollBuffer));
+    this->renderText(this->_scrollBuffer, SCROLL_BUFFER_COLUMNS, 0, text);
+
+    uint16_t textWidth = this->getTextWidth(text);
+
+    if (textWidth > SCROLL_BUFFER_COLUMNS)
+    {
+      textWidth = SCROLL_BUFFER_COLUMNS;
+    }
+
+    // ***
+    // *** The window starts on a blank display so the
+    // *** text enters from the right.
+    // ***
+    this->_scrollLength = COLUMNS + textWidth;
+    this->_scrollFrames = framesPerStep > 0 ? framesPerStep : 1;
+    this->_scrollTick = 0;
+    this->_scrollOffset = 0;
+    this->_scrollCount = 0;
+    this->_scrolling = true;
+
+    returnValue = true;
+  }
+
+  return returnValue;
+}
+
+void LedMatrix::stopScroll()
+{
+  this->_scrolling = false;
+}
+
+const bool LedMatrix::isScrolling()
+{
+  return this->_scrolling;
+}
+
+const uint8_t LedMatrix::getScrollCount()
+{
+  return this->_scrollCount;
+}
+
+void LedMatrix::advanceScroll()
+{
+  if (++this->_scrollTick >= this->_scrollFrames)
+  {
+    this->_scrollTick = 0;
+
+    // ***
+    // *** Moving the window is the only work done
+    // *** per scroll step.
+    // ***
+    if (++this->_scrollOffset >= this->_scrollLength)
+    {
+      this->_scrollOffset = 0;
+      this->_scrollCount++;
+    }
+  }
+}
+
+const ColumnDescriptor_t* LedMatrix::getScrollDescriptor(uint8_t slot)
+{
+  uint8_t column = slot / GRAYSCALE_BITS;
+  uint8_t plane = slot % GRAYSCALE_BITS;
+
+  // ***
+  // *** Find the column of the scroll window shown in this
+  // *** display column. The window wraps around.
+  // ***
+  uint8_t index = this->_scrollOffset + column;
+
+  if (index >= this->_scrollLength)
+  {
+    index -= this->_scrollLength;
+  }
+
+  // ***
+  // *** The first COLUMNS of the window are blank. The display
+  // *** address comes from the front table since it only
+  // *** depends on the slot.
+  // ***
+  uint8_t rows = index < COLUMNS ? 0 : this->_scrollBuffer[index - COLUMNS];
+
+  this->_computedDescriptor.rows = rows;
+  this->_computedDescriptor.address = this->_front[slot].address;
+  this->_computedDescriptor.compare = this->_compareTable[plane][this->getBitCount(rows)];
+
+  return &this->_computedDescriptor;
+}
+
+void LedMatrix::testDisplay(uint16_t delayTime)
+{
+  // ***
+  // *** Loop through hours 1 to 24;
+  // ***
+  for (uint8_t hour = 1; hour <= 24; hour++)
+  {
+    bool pm = hour >= 12;
+    uint8_t h = hour > 12 ? hour - 12 : hour;
+
+    // ***
+    // *** Lop through minutes 0 to 59.
+    // **
+    for (uint8_t minute = 0; minute < 60; minute++)
+    {
+      char buffer[6];
+      sprintf(buffer, "%01d:%02d", h, minute);
+      //String time = String(buffer);
+
+      this->reset();
+      this->drawTextCentered(buffer);
+      this->drawPixel(18, 5, pm ? LED_ON : LED_OFF);
+      this->present();
+
+      delay(delayTime);
+    }
+  }
+}
+
+void LedMatrix::startSelfTest(uint8_t senseChannel, uint16_t senseThreshold)
+{
+  memset(this->_ledFaults, 0, sizeof(this->_ledFaults));
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    this->_senseChannel = senseChannel;
+    this->_senseThreshold = senseThreshold;
+    this->_senseBaseline = 0;
+    this->_senseNextColumn = NO_SENSE_COLUMN;
+    this->_senseColumn = NO_SENSE_COLUMN;
+    this->_senseSample = false;
+
+    if (senseChannel != NO_SENSE_CHANNEL)
+    {
+      SELECT_CONVERSION(senseChannel);
+      this->beginSelfTest(SELF_TEST_SENSE);
+    }
+    else
+    {
+      this->beginSelfTest(SELF_TEST_SWEEP);
+    }
+  }
+}
+
+const bool LedMatrix::isSelfTesting()
+{
+  return this->_selfTest != SELF_TEST_NONE;
+}
+
+const uint8_t LedMatrix::getLedFaults(uint8_t column)
+{
+  return column < COLUMNS ? this->_ledFaults[column] : 0;
+}
+
+const uint8_t LedMatrix::getLedFaultCount()
+{
+  uint8_t returnValue = 0;
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    returnValue += this->getBitCount(this->_ledFaults[column]);
+  }
+
+  return returnValue;
+}
+
+void LedMatrix::beginSelfTest(SelfTest_t selfTest)
+{
+  this->_selfTestStep = 0;
+  this->_selfTestTick = 0;
+
+  switch (selfTest)
+  {
+    case SELF_TEST_SENSE:
+      this->_selfTestSteps = ROWS + 1;
+      this->_selfTestFrames = 1;
+      break;
+    case SELF_TEST_SWEEP:
+      this->_selfTestSteps = COLUMNS;
+      this->_selfTestFrames = SELF_TEST_SWEEP_FRAMES;
+      break;
+    case SELF_TEST_HOLD:
+      this->_selfTestSteps = 1;
+      this->_selfTestFrames = SELF_TEST_HOLD_FRAMES;
+      break;
+    default:
+      break;
+  }
+
+  this->_selfTest = selfTest;
+}
+
+void LedMatrix::advanceSelfTest()
+{
+  if (++this->_selfTestTick >= this->_selfTestFrames)
+  {
+    this->_selfTestTick = 0;
+
+    if (++this->_selfTestStep >= this->_selfTestSteps)
+    {
+      // ***
+      // *** Each part leads to the next and the hold ends the
+      // *** test, putting the framebuffer back on the display.
+      // ***
+      switch (this->_selfTest)
+      {
+        case SELF_TEST_SENSE:
+          this->beginSelfTest(SELF_TEST_SWEEP);
+          break;
+        case SELF_TEST_SWEEP:
+          this->beginSelfTest(SELF_TEST_HOLD);
+          break;
+        default:
+          this->_selfTest = SELF_TEST_NONE;
+          break;
+      }
+    }
+  }
+}
+
+const ColumnDescriptor_t* LedMatrix::getSelfTestDescriptor(uint8_t slot)
+{
+  uint8_t column = slot / GRAYSCALE_BITS;
+  uint8_t plane = slot % GRAYSCALE_BITS;
+  uint8_t step = this->_selfTestStep;
+  uint8_t rows = ROW_MASK;
+
+  // ***
+  // *** The conversion started in the slot that has just ended
+  // *** is complete. Step 0 of the sense part lights nothing so
+  // *** its readings give the level with no current.
+  // ***
+  if (this->_senseColumn != NO_SENSE_COLUMN)
+  {
+    uint16_t reading = READ_CONVERSION();
+
+    if (this->_senseRows == 0)
+    {
+      this->_senseBaseline = max(this->_senseBaseline, reading);
+    }
+    else if (reading < this->_senseBaseline + this->_senseThreshold)
+    {
+      this->_ledFaults[this->_senseColumn] |= this->_senseRows;
+    }
+
+    this->_senseColumn = NO_SENSE_COLUMN;
+  }
+
+  // ***
+  // *** The slot starting now is the one chosen when the last
+  // *** descriptor was built.
+  // ***
+  if (this->_senseNextColumn != NO_SENSE_COLUMN)
+  {
+    this->_senseColumn = this->_senseNextColumn;
+    this->_senseRows = this->_senseNextRows;
+    this->_senseNextColumn = NO_SENSE_COLUMN;
+    this->_senseSample = true;
+  }
+
+  switch (this->_selfTest)
+  {
+    case SELF_TEST_SENSE:
+      // ***
+      // *** One row in every column. The most significant plane
+      // *** has the longest on time so that slot is measured.
+      // ***
+      rows = step == 0 ? 0 : _BV(step - 1);
+
+      if (plane == GRAYSCALE_BITS - 1)
+      {
+        this->_senseNextColumn = column;
+        this->_senseNextRows = rows;
+      }
+      break;
+    case SELF_TEST_SWEEP:
+      rows = column <= step ? ROW_MASK : 0;
+      break;
+    default:
+      break;
+  }
+
+  this->_computedDescriptor.rows = rows;
+  this->_computedDescriptor.address = this->_front[slot].address;
+  this->_computedDescriptor.compare = this->_compareTable[plane][this->getBitCount(rows)];
+
+  return &this->_computedDescriptor;
+}
+
+bool LedMatrix::drawMomentaryTextCentered(const char* text, Milliseconds_t displayTime, bool resetAfter)
+{
+  bool returnValue = false;
+
+  if (this->_overlayCount < OVERLAY_QUEUE_SIZE)
+  {
+    // ***
+    // *** Add the message to the end of the queue.
+    // ***
+    Overlay_t* overlay = &this->_overlays[(this->_overlayHead + this->_overlayCount) % OVERLAY_QUEUE_SIZE];
+    strncpy(overlay->text, text, OVERLAY_TEXT_SIZE - 1);
+    overlay->text[OVERLAY_TEXT_SIZE - 1] = 0;
+    overlay->displayTime = displayTime;
+    overlay->resetAfter = resetAfter;
+    this->_overlayCount++;
+
+    // ***
+    // *** Show it now if it is the only message.
+    // ***
+    if (this->_overlayCount == 1)
+    {
+      this->showOverlay();
+    }
+
+    returnValue = true;
+  }
+
+  return returnValue;
+}
+
+void LedMatrix::cancelMomentaryText()
+{
+  if (this->_overlayCount > 0)
+  {
+    this->_overlayCount = 0;
+    this->_overlayActive = false;
+    this->present();
+  }
+}
+
+const bool LedMatrix::isShowingMomentaryText()
+{
+  return this->_overlayActive;
+}
+
+void LedMatrix::process()
+{
+  // ***
+  // *** Momentary messages are hidden by the self test so
+  // *** their time does not start until it has completed.
+  // ***
+  if (this->_selfTest != SELF_TEST_NONE)
+  {
+    this->_overlayStart = millis();
+  }
+  else if (this->_overlayCount > 0)
+  {
+    Overlay_t* overlay = &this->_overlays[this->_overlayHead];
+
+    if (hasElapsed(this->_overlayStart, overlay->displayTime))
+    {
+      bool resetAfter = overlay->resetAfter;
+
+      // ***
+      // *** Remove the expired message.
+      // ***
+      this->_overlayHead = (this->_overlayHead + 1) % OVERLAY_QUEUE_SIZE;
+      this->_overlayCount--;
+
+      if (this->_overlayCount > 0)
+      {
+        this->showOverlay();
+      }
+      else
+      {
+        this->_overlayActive = false;
+
+        // ***
+        // *** Show the framebuffer again. Anything drawn
+        // *** while the message was shown appears now.
+        // ***
+        if (resetAfter)
+        {
+          this->present();
+        }
+      }
+    }
+  }
+}
+
+void LedMatrix::showOverlay()
+{
+  const char* text = this->_overlays[this->_overlayHead].text;
+
+  // ***
+  // *** Render the text centered.
+  // ***
+  memset(this->_overlayBuffer, 0, sizeof(this->_overlayBuffer));
+  this->renderText(this->_overlayBuffer, COLUMNS, this->getCenteredColumn(text), text);
+
+  this->_overlayStart = millis();
+  this->_overlayActive = true;
+
+  // ***
+  // *** The message before this one may still be shown
+  // *** so every column has to be rebuilt.
+  // ***
+  this->_dirtyColumns = ALL_COLUMNS;
+  this->present();
 }
@@ -18,51 +18,32 @@
 #define LED_MATRIX_H
 
 #include <Arduino.h>
+#include <util/atomic.h>
 #include <Adafruit_GFX.h>
 #include "Other\Bitwise.h"
+#include "Other\Timing.h"
+#include "Other\ColumnFont.h"
+#include "Other\MatrixGeometry.h"
 #include "gfxfont.h"
 
 // ***
-// *** Defines the register and port for the three 74LS138N 3 to 8 decoders. The three
-// *** input pins are on PD4 (A), PD5 (B) and PD6 (C). A, B and C are all tied
-// *** together on on three decoder chips.
+// *** The three port writes used to scan the display and the ADC
+// *** access used by the self test. Everything the refresh interrupt
+// *** does to the hardware goes through these so the driver can be
+// *** built on a PC against the simulator in Src/Simulator, which
+// *** supplies its own versions.
 // ***
-#define DECODER_REGISTER DDRD
-#define DECODER_PORT PORTD
-#define DECODER_A PORTD4
-#define DECODER_B PORTD5
-#define DECODER_C PORTD6
-
-// ***
-// *** The rows are connected to PORT B in order (row 1 on PB0, row 2
-// *** PB1 and so on).
-// ***
-#define ROW_REGISTER DDRB
-#define ROW_PORT PORTB
-#define ROW_1 PORTB0
-#define ROW_2 PORTB1
-#define ROW_3 PORTB2
-#define ROW_4 PORTB3
-#define ROW_5 PORTB4
-#define ROW_6 PORTB5
-#define ROW_7 PORTB6
-
-// ***
-// *** The enable pins of the 74LS138N decoder chips are tied to
-// *** pins 2 and 3 of Port C.
-// ***
-// *** CS_S1 = 1, CS_S2 = 0 (enables columns 0 to 7)
-// *** CS_S1 = 0, CS_S2 = 1 (enables columns 8 to 15)
-// *** CS_S1 = 0, CS_S2 = 0 (enables columns 16 to 19)
-// ***
-#define CHIP_SELECT_REGISTER DDRC
-#define CHIP_SELECT_PORT PORTC
-#define CS_S1 PORTC2
-#define CS_S2 PORTC3
-#define DECODERS_OFF (CHIP_SELECT_PORT & B11110011) | B00001100;
-#define DECODER_1 (CHIP_SELECT_PORT & B11110011) | B00000100;
-#define DECODER_2 (CHIP_SELECT_PORT & B11110011) | B00001000;
-#define DECODER_3 (CHIP_SELECT_PORT & B11110011) | B00000000; 
+#ifdef SIMULATOR
+#include "SimulatorHal.h"
+#else
+#define WRITE_ROWS(rows) ROW_PORT = (ROW_PORT & ~ROW_MASK) | (rows)
+#define WRITE_DECODER(address) DECODER_PORT = (DECODER_PORT & ~DECODER_MASK) | ((address) & DECODER_MASK)
+#define WRITE_CHIP_SELECT(select) CHIP_SELECT_PORT = (CHIP_SELECT_PORT & ~CS_MASK) | (select)
+#define READ_CHIP_SELECT() (CHIP_SELECT_PORT & CS_MASK)
+#define SELECT_CONVERSION(channel) ADMUX = _BV(REFS0) | ((channel) & 0x07)
+#define START_CONVERSION() ADCSRA |= _BV(ADSC)
+#define READ_CONVERSION() ADC
+#endif
 
 // **************************************************************************** //
 // ******************** Borrowed from Adafruit GFX library ******************** //
@@ -96,21 +77,251 @@ inline GFXglyph *pgm_read_glyph_ptr(const GFXfont *gfxFont, uint8_t c)
 // ***
 #define DEFAULT_REFRESH_RATE 50
 
+// ***
+// *** The range of refresh rates. Above MAX_REFRESH_RATE a column is
+// *** shown for less time than the brightness compensation takes from
+// *** a column with one LED lit so those columns would go dark.
+// ***
+#define MIN_REFRESH_RATE 25
+#define MAX_REFRESH_RATE 70
+
+// ***
+// *** The lowest refresh rate that does not flicker and the share of
+// *** the CPU (in percent) the refresh interrupts may use. These are
+// *** the defaults used by the refresh rate calibration.
+// ***
+#define FLICKER_FREE_REFRESH_RATE 50
+#define DEFAULT_LOAD_CEILING 25
+
+// ***
+// *** The number of refresh cycles measured by the calibration.
+// ***
+#define CALIBRATION_CYCLES 16
+#define CALIBRATION_SLOTS (CALIBRATION_CYCLES * REFRESH_SLOTS)
+
 // ***
 // *** Define the compensation delay per bit in microseconds.
 // ***
 #define COMP_DELAY_PER_BIT 100
 
 // ***
-// *** The maximum delay to apply when brightness is 0.
+// *** Brightness levels run from 1 to MAX_BRIGHTNESS. Each level
+// *** below the maximum halves the on time of every column.
+// ***
+#define MIN_BRIGHTNESS 1
+#define MAX_BRIGHTNESS 4
+
+// ***
+// *** The number of bits of intensity stored for each pixel (1 to 4).
+// *** Each bit has its own plane in the framebuffer and its own refresh
+// *** slot. Setting this to 1 gives a strictly on/off display and uses
+// *** the least memory.
+// ***
+#define GRAYSCALE_BITS 2
+#define INTENSITY_MAX ((1 << GRAYSCALE_BITS) - 1)
+
+// ***
+// *** Every column is shown once per plane in each refresh cycle.
+// ***
+#define REFRESH_SLOTS (COLUMNS * GRAYSCALE_BITS)
+
+// ***
+// *** The framebuffer is split into layers that are ORed together
+// *** when the frame is presented. Text is drawn on the text layer and
+// *** status dots on the indicator layer so either can be redrawn or
+// *** cleared without touching the other. Momentary messages are a
+// *** third layer that covers both while it is shown.
+// ***
+typedef enum LAYER : uint8_t
+{
+  LAYER_TEXT = 0,
+  LAYER_INDICATOR = 1,
+  LAYER_COUNT = 2
+} Layer_t;
+
+// ***
+// *** The number of text widths remembered by getTextWidth(). The
+// *** clock shows a small set of labels over and over so a few
+// *** entries catch nearly every call.
+// ***
+#define TEXT_WIDTH_CACHE_SIZE 4
+
+// ***
+// *** The longest text (including the terminator) that is kept in
+// *** the width cache. This fits every label and time the clock
+// *** shows; longer text is measured every time.
+// ***
+#define TEXT_WIDTH_TEXT_SIZE 6
+
+// ***
+// *** A set of columns with one bit per column, column 0 in the
+// *** least significant bit.
+// ***
+typedef uint32_t ColumnMask_t;
+#define COLUMN_BIT(column) ((ColumnMask_t)1 << (column))
+#define ALL_COLUMNS (COLUMN_BIT(COLUMNS) - 1)
+
+// ***
+// *** The number of text columns that can be held for scrolling. The
+// *** blank lead in that lets the text enter from the right is not
+// *** stored. The clock only scrolls time zone names, which are at
+// *** most four characters; four of the widest glyphs take 24
+// *** columns. Define it before this file is included to scroll
+// *** longer text.
+// ***
+#ifndef SCROLL_BUFFER_COLUMNS
+#define SCROLL_BUFFER_COLUMNS 24
+#endif
+
+// ***
+// *** The default number of refresh cycles between each scroll step.
+// *** At the default refresh rate this is 12.5 columns per second.
+// ***
+#define DEFAULT_SCROLL_FRAMES 4
+
+// ***
+// *** The ways the display can change from one frame to the next.
+// ***
+typedef enum TRANSITION : uint8_t
+{
+  TRANSITION_NONE = 0,      // Show the new frame at once.
+  TRANSITION_ROLL = 1,      // Changed columns roll up to the new rows.
+  TRANSITION_WIPE = 2,      // The new frame is uncovered from left to right.
+  TRANSITION_DISSOLVE = 3   // The new frame fades in pixel by pixel.
+} Transition_t;
+
+// ***
+// *** The default number of refresh cycles between each step of a
+// *** transition. A roll takes ROWS steps, a wipe COLUMNS steps and a
+// *** dissolve DISSOLVE_LEVELS steps.
+// ***
+#define DEFAULT_TRANSITION_FRAMES 2
+#define DISSOLVE_LEVELS 8
+
+// ***
+// *** The rows taken from the new frame at each step of a dissolve
+// *** for every eighth column. The pattern is an 8 by 8 ordered
+// *** dither so the pixels appear evenly over the display.
+// ***
+const static uint8_t _dissolveMasks[DISSOLVE_LEVELS][8] PROGMEM =
+{
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x11, 0x00, 0x44, 0x00, 0x11, 0x00, 0x44, 0x00 },
+  { 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00 },
+  { 0x55, 0x22, 0x55, 0x08, 0x55, 0x22, 0x55, 0x08 },
+  { 0x55, 0x2a, 0x55, 0x2a, 0x55, 0x2a, 0x55, 0x2a },
+  { 0x77, 0x2a, 0x5d, 0x2a, 0x77, 0x2a, 0x5d, 0x2a },
+  { 0x7f, 0x2a, 0x7f, 0x2a, 0x7f, 0x2a, 0x7f, 0x2a },
+  { 0x7f, 0x3b, 0x7f, 0x6e, 0x7f, 0x3b, 0x7f, 0x6e }
+};
+
+// ***
+// *** The parts of the power on self test. The refresh interrupt
+// *** draws each one in place of the framebuffer.
+// ***
+typedef enum SELF_TEST : uint8_t
+{
+  SELF_TEST_NONE = 0,   // The self test is not running.
+  SELF_TEST_SENSE = 1,  // One row at a time while the current is measured.
+  SELF_TEST_SWEEP = 2,  // Columns light up from left to right.
+  SELF_TEST_HOLD = 3    // Every LED is on.
+} SelfTest_t;
+
+// ***
+// *** The number of refresh cycles for each column of the sweep and
+// *** for the hold at the end. The test takes COLUMNS *
+// *** SELF_TEST_SWEEP_FRAMES + SELF_TEST_HOLD_FRAMES refresh cycles
+// *** (1.3 seconds at the default refresh rate) plus ROWS + 1 cycles
+// *** when the current is measured.
+// ***
+#define SELF_TEST_SWEEP_FRAMES 2
+#define SELF_TEST_HOLD_FRAMES 25
+
+// ***
+// *** The row current is measured on an ADC channel (0 to 7) during
+// *** the self test when one is given. An LED is reported as faulty
+// *** when lighting it raises the reading by less than the threshold
+// *** (in ADC counts) over the reading with no LEDs lit.
+// ***
+#define NO_SENSE_CHANNEL 0xff
+#define NO_SENSE_COLUMN 0xff
+#define DEFAULT_SENSE_THRESHOLD 8
+
+// ***
+// *** The number of momentary messages that can be waiting to be
+// *** shown and the longest message (including the terminator). The
+// *** clock queues at most two messages at a time ("GPS" and "No Fx",
+// *** "Bat V" and the voltage) plus one for a button press; the
+// *** longest is the self test result ("LED 140").
 // ***
-#define MAX_PWM_DELAY 500
+#define OVERLAY_QUEUE_SIZE 3
+#define OVERLAY_TEXT_SIZE 8
 
 // ***
-// *** This device is fixed at 7 rows and 20 columns.
+// *** Colors that can be passed to drawPixel(). Any value above
+// *** INTENSITY_MAX is shown at full intensity.
 // ***
-#define ROWS       7
-#define COLUMNS   20
+#define LED_OFF 0
+#define LED_DIM 1
+#define LED_ON 0xFFFF
+
+// ***
+// *** The number of bits set in each value from 0 to 15. This is
+// *** used to count the LEDs lit in a column one nibble at a time.
+// ***
+const static uint8_t _nibbleBitCount[] PROGMEM = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+// ***
+// *** Everything the refresh interrupt needs to draw one plane of one
+// *** column. The DECODER_PORT and CHIP_SELECT_PORT bits do not
+// *** overlap (MatrixGeometry.h checks this) so both are stored,
+// *** already shifted into position, in a single address byte.
+// ***
+typedef struct COLUMN_DESCRIPTOR
+{
+  uint8_t rows;         // Bits for ROW_PORT (ROW_MASK, row 1 in bit 0).
+  uint8_t address;      // Bits for DECODER_PORT and CHIP_SELECT_PORT.
+  uint16_t compare;     // The Timer1 compare value (OCR1B) for this slot.
+} ColumnDescriptor_t;
+
+// ***
+// *** The time used by the refresh interrupts as measured by the
+// *** calibration. Times are in CPU cycles and include the time from
+// *** the timer event to the end of the handler so the interrupt
+// *** entry and any delay caused by other interrupts are counted.
+// ***
+typedef struct REFRESH_BUDGET
+{
+  uint16_t refreshMinimum;  // Shortest overflow (refresh) interrupt.
+  uint16_t refreshMaximum;  // Longest overflow (refresh) interrupt.
+  uint16_t refreshAverage;  // Average overflow (refresh) interrupt.
+  uint16_t compareMaximum;  // Longest compare B interrupt.
+  uint16_t compareAverage;  // Average compare B interrupt.
+  uint32_t slotCycles;      // The length of one refresh slot.
+  uint16_t load;            // The share of the CPU in tenths of a percent.
+  uint8_t refreshRate;      // The refresh rate that was measured.
+  uint8_t tunedRate;        // The refresh rate picked by the calibration.
+} RefreshBudget_t;
+
+// ***
+// *** A message waiting to be shown by drawMomentaryTextCentered().
+// *** The text is copied so the caller can pass a local buffer.
+// ***
+typedef struct OVERLAY
+{
+  char text[OVERLAY_TEXT_SIZE];
+  Milliseconds_t displayTime;
+  bool resetAfter;
+} Overlay_t;
+
+// ***
+// *** A remembered text width and the text it belongs to.
+// ***
+typedef struct TEXT_WIDTH
+{
+  char text[TEXT_WIDTH_TEXT_SIZE];
+  uint8_t width;
+} TextWidth_t;
 
 class LedMatrix : public Adafruit_GFX
 {
@@ -123,7 +334,7 @@ class LedMatrix : public Adafruit_GFX
     // ***
     // *** Create an instance with the specified refresh rate.
     // ***
-    LedMatrix(uint32_t);
+    LedMatrix(uint8_t);
 
     // ***
     // *** Initialize the display.
@@ -136,14 +347,53 @@ class LedMatrix : public Adafruit_GFX
     void begin(const GFXfont*);
 
     // ***
-    // *** Get/set the refresh of the display.
+    // *** Initialize the display with a column font only. Text is drawn
+    // *** and measured from the column font so the GFX font tables are
+    // *** not needed in flash.
+    // ***
+    void begin(const ColumnFont_t*);
+
+    // ***
+    // *** Initialize the display with a font and the same font stored
+    // *** by column. When the column font is given text is written
+    // *** straight into the framebuffer instead of pixel by pixel.
+    // ***
+    void begin(const GFXfont*, const ColumnFont_t*);
+
+    // ***
+    // *** Get/set the refresh of the display (MIN_REFRESH_RATE to
+    // *** MAX_REFRESH_RATE). Timer1 has to be given the new refresh
+    // *** delay and enableCompareInterrupt() called again after the
+    // *** rate is changed.
     // ***
     const uint8_t getRefreshRate();
     void setRefreshRate(uint8_t);
 
+    // ***
+    // *** Measures the time used by the refresh interrupts over the
+    // *** next CALIBRATION_CYCLES refresh cycles. The parameters are
+    // *** the CPU load ceiling in percent and the lowest refresh rate
+    // *** that does not flicker on this board.
+    // ***
+    void startCalibration(uint8_t = DEFAULT_LOAD_CEILING, uint8_t = FLICKER_FREE_REFRESH_RATE);
+
+    // ***
+    // *** Returns true while the calibration is measuring.
+    // ***
+    const bool isCalibrating();
+
+    // ***
+    // *** Gets the results of the last calibration. The tuned rate is
+    // *** the flicker free rate when its load is under the ceiling and
+    // *** otherwise the fastest rate that is. Returns false when no
+    // *** calibration has completed.
+    // ***
+    const bool getRefreshBudget(RefreshBudget_t*);
+
     // ***
     // *** Implements drawPixel for this display enabling all of the GFX
-    // *** capabilities.
+    // *** capabilities. The color is the intensity of the pixel from 0
+    // *** to INTENSITY_MAX.
     // ***
     void drawPixel(int16_t, int16_t, uint16_t);
 
@@ -156,10 +406,36 @@ class LedMatrix : public Adafruit_GFX
     // ***
     void refresh();
 
+    // ***
+    // *** Enables the Timer1 compare B interrupt that is used to switch
+    // *** each column on and off within its refresh slot. This must be
+    // *** called after Timer1 has been initialized and the overflow
+    // *** interrupt has been attached.
+    // ***
+    void enableCompareInterrupt();
+
+    // ***
+    // *** Called from the Timer1 compare B interrupt. Timer1 counts up
+    // *** and back down once per refresh slot so there are two matches
+    // *** per slot; the first switches the column on and the second
+    // *** switches it off. If both are handled by one late interrupt
+    // *** the column stays off.
+    // ***
+    void compareMatch();
+
     // ***
     // *** Gets the recommended time between refreshes based on the selected mode.
     // ***
-    const uint32_t getRefreshDelay();
+    const Microseconds_t getRefreshDelay();
+
+    // ***
+    // *** Get/set the global brightness (MIN_BRIGHTNESS to MAX_BRIGHTNESS).
+    // *** Changing the brightness rebuilds the refresh tables from the
+    // *** back buffer so it should be called when the back buffer holds
+    // *** a complete frame.
+    // ***
+    const uint8_t getBrightness();
+    void setBrightness(uint8_t);
 
     // ***
     // *** Resets and clears the entire display.
@@ -167,34 +443,162 @@ class LedMatrix : public Adafruit_GFX
     void reset();
 
     // ***
-    // *** Clears the rows and columns by settign all colors to 0.
+    // *** Clears the rows and columns of the current layer by settign
+    // *** all colors to 0.
     // ***
     void clear();
 
     // ***
-    // *** Get the width of text for this display.
+    // *** Clears the rows and columns of the specified layer.
+    // ***
+    void clearLayer(Layer_t);
+
+    // ***
+    // *** Get/set the layer that drawing goes to. Every drawing
+    // *** method, including the GFX methods, uses this layer.
+    // ***
+    const Layer_t getLayer();
+    void setLayer(Layer_t);
+
+    // ***
+    // *** Drawing is done in a back buffer. This builds the column
+    // *** descriptors for the back buffer and swaps it with the
+    // *** buffer being refreshed so the new frame is shown in one
+    // *** step. Only the descriptors for columns that have changed
+    // *** are rebuilt.
+    // ***
+    void present();
+
+    // ***
+    // *** Presents the frame and changes to it from the frame being
+    // *** shown using the specified transition. The refresh interrupt
+    // *** moves the transition on one step every framesPerStep refresh
+    // *** cycles so this returns at once. Presenting again during a
+    // *** transition ends it.
+    // ***
+    void present(Transition_t transition, uint8_t framesPerStep = DEFAULT_TRANSITION_FRAMES);
+
+    // ***
+    // *** Returns true while a transition is running.
+    // ***
+    const bool isTransitioning();
+
+    // ***
+    // *** Gets the columns that have changed since the last
+    // *** call to present().
+    // ***
+    const ColumnMask_t getDirtyColumns();
+
+    // ***
+    // *** Get the width of text for this display. Recent results
+    // *** are cached so repeated labels are not measured again.
     // ***
     const uint16_t getTextWidth(const char* text);
 
     // ***
-    // *** Draws a string centered on the display.
+    // *** Gets the column where text must start to be centered on
+    // *** the display. This is done in integer math.
+    // ***
+    const int16_t getCenteredColumn(const char* text);
+
+    // ***
+    // *** Draws a string centered on the display in place of the
+    // *** current contents. The new layout is compared with the
+    // *** framebuffer and only the columns that differ are written.
     // ***
     void drawTextCentered(const char* text);
 
+    // ***
+    // *** Draws text at the specified column using the column font. The
+    // *** glyph columns are ORed into every plane so the text is shown
+    // *** at full intensity. Columns off the display are skipped.
+    // ***
+    void drawText(int16_t column, const char* text);
+
+    // ***
+    // *** Renders the text once into the scroll buffer and starts
+    // *** scrolling it from right to left. The refresh interrupt moves
+    // *** the text one column every framesPerStep refresh cycles so
+    // *** nothing needs to be redrawn while it scrolls. The text repeats
+    // *** until stopScroll() is called. Text wider than the scroll
+    // *** buffer is cut off. Returns false if there is no column font.
+    // ***
+    bool startScroll(const char* text, uint8_t framesPerStep = DEFAULT_SCROLL_FRAMES);
+
+    // ***
+    // *** Stops scrolling and shows the framebuffer again.
+    // ***
+    void stopScroll();
+
+    // ***
+    // *** Returns true while text is scrolling.
+    // ***
+    const bool isScrolling();
+
+    // ***
+    // *** Gets the number of times the text has scrolled all
+    // *** the way across since startScroll() was called.
+    // ***
+    const uint8_t getScrollCount();
+
     // ***
     // *** This routine will lop through the time of day.
     // ***
     void testDisplay(uint16_t);
 
     // ***
-    // *** Highlights all of the pixels as a test.
+    // *** Starts the power on self test and returns at once. The refresh
+    // *** interrupt sweeps every LED while the caller carries on; the
+    // *** framebuffer is shown again when it completes and momentary
+    // *** messages wait for it. When an ADC channel is given the row
+    // *** current is measured for each LED first. The ADC must not be
+    // *** used by anything else while the self test is running.
+    // ***
+    void startSelfTest(uint8_t = NO_SENSE_CHANNEL, uint16_t = DEFAULT_SENSE_THRESHOLD);
+
+    // ***
+    // *** Returns true while the self test is running.
+    // ***
+    const bool isSelfTesting();
+
+    // ***
+    // *** Gets the rows in the specified column that did not draw
+    // *** current during the last self test (bit 0 is row 1).
     // ***
-    void powerOnDisplayTest();
+    const uint8_t getLedFaults(uint8_t);
 
     // ***
+    // *** Gets the number of LEDs that did not draw current during
+    // *** the last self test.
     // ***
+    const uint8_t getLedFaultCount();
+
+    // ***
+    // *** Queues text to be shown centered on top of the framebuffer
+    // *** for the specified number of milliseconds. The call returns
+    // *** immediately; the framebuffer can still be drawn and presented
+    // *** but is not shown until the queue is empty. When resetAfter is
+    // *** true the framebuffer is shown as soon as the message expires,
+    // *** otherwise the message stays until the next present(). Returns
+    // *** false if the queue is full.
+    // ***
+    bool drawMomentaryTextCentered(const char* text, Milliseconds_t displayTime, bool resetAfter);
+
+    // ***
+    // *** Removes all momentary messages and shows the framebuffer.
     // ***
-    void drawMomentaryTextCentered(const char* text, uint64_t displayTime, bool resetAfter);
+    void cancelMomentaryText();
+
+    // ***
+    // *** Returns true while a momentary message is shown.
+    // ***
+    const bool isShowingMomentaryText();
+
+    // ***
+    // *** Expires momentary messages. This should be called
+    // *** frequently, such as from yield().
+    // ***
+    void process();
 
   protected:
     // ***
@@ -207,21 +611,69 @@ class LedMatrix : public Adafruit_GFX
     // *** Number of microseconds of delay between each column draw to simulate
     // *** the specified refresh rate. This is used by the external timer.
     // ***
-    uint64_t _refreshDelay;
+    Microseconds_t _refreshDelay;
 
     // ***
     // *** Each byte is used to represent the rows for the given column (the
     // *** index of the array). each bit represents the row. The LSB is row 1,
     // *** the second bit is row 2 and so on. The MSB is not used since there
-    // *** 8 bits and only 7 rows.
+    // *** 8 bits and only 7 rows. There is one plane for each bit of
+    // *** intensity, least significant plane first, in each layer. This is
+    // *** the back buffer; it is never read by the refresh interrupt.
+    // ***
+    uint8_t _matrixBuffer[LAYER_COUNT][GRAYSCALE_BITS][COLUMNS];
+
+    // ***
+    // *** The layer that drawing goes to.
+    // ***
+    Layer_t _layer = LAYER_TEXT;
+
+    // ***
+    // *** The text width cache and the entry to replace next.
     // ***
-    uint8_t _matrixBuffer[COLUMNS];
+    TextWidth_t _textWidths[TEXT_WIDTH_CACHE_SIZE];
+    uint8_t _textWidthCount = 0;
+    uint8_t _textWidthNext = 0;
 
     // ***
-    // *** Represents the current colum being displayed during the refresh cycle. This
-    // *** value is used in both FULL_COLUMN and INDIVIDUAL_LED refresh modes.
+    // *** Adds up the xAdvance of every character in the text
+    // *** using the current font.
     // ***
-    uint8_t _currentColumn;
+    uint16_t measureText(const char*);
+
+    // ***
+    // *** The columns changed since the last present() and the
+    // *** columns changed by the present() before that. The back
+    // *** table is one frame behind the front table so both sets
+    // *** must be rebuilt to bring it up to date.
+    // ***
+    ColumnMask_t _dirtyColumns = ALL_COLUMNS;
+    ColumnMask_t _staleColumns = ALL_COLUMNS;
+
+    // ***
+    // *** True when the front table was built from the momentary
+    // *** message rather than the framebuffer.
+    // ***
+    bool _overlayPresented = false;
+
+    // ***
+    // *** Writes one plane of one column of the current layer and
+    // *** marks the column dirty if it changed. Returns true if
+    // *** the column changed.
+    // ***
+    bool writeColumn(uint8_t, uint8_t, uint8_t);
+
+    // ***
+    // *** The font used by drawText(). This is NULL when only
+    // *** a GFX font has been given.
+    // ***
+    const ColumnFont_t* _columnFont = NULL;
+
+    // ***
+    // *** Represents the current slot being displayed during the refresh
+    // *** cycle. Slots are ordered by column and then by plane.
+    // ***
+    uint8_t _currentSlot;
 
     // ***
     // *** Represents the current row being displayed during the refresh cycle. This
@@ -230,19 +682,244 @@ class LedMatrix : public Adafruit_GFX
     uint8_t _currentRow;
 
     // ***
-    // *** The amount of compensation needed for a particular column based on
-    // *** the number of LEDs in the column that are turned on.
+    // *** Two descriptor tables with one descriptor per refresh slot. The
+    // *** front table is read by the refresh interrupt. The back table
+    // *** is built from the framebuffer by present() and then the two
+    // *** are swapped.
+    // ***
+    ColumnDescriptor_t _descriptors[2][REFRESH_SLOTS];
+    ColumnDescriptor_t* volatile _front = _descriptors[0];
+    ColumnDescriptor_t* _back = _descriptors[1];
+
+    // ***
+    // *** The descriptor for the column that will be drawn on the next
+    // *** refresh. This is copied at the same time its compare value is
+    // *** loaded so both always come from the same frame, even if the
+    // *** table it came from is rebuilt before it is drawn.
+    // ***
+    ColumnDescriptor_t _nextDescriptor = { 0, CS_OFF, 0 };
+
+    // ***
+    // *** The columns of the scrolling text. The scroll window is
+    // *** _scrollLength columns long; the first COLUMNS of these are
+    // *** blank and are not stored.
+    // ***
+    uint8_t _scrollBuffer[SCROLL_BUFFER_COLUMNS];
+    uint8_t _scrollLength = 0;
+
+    // ***
+    // *** The scroll state shared with the refresh interrupt. The
+    // *** offset is the column of the scroll window shown in the
+    // *** first column of the display.
+    // ***
+    volatile bool _scrolling = false;
+    volatile uint8_t _scrollOffset = 0;
+    volatile uint8_t _scrollCount = 0;
+    uint8_t _scrollFrames = DEFAULT_SCROLL_FRAMES;
+    uint8_t _scrollTick = 0;
+
+    // ***
+    // *** The descriptor built by the refresh interrupt for the
+    // *** next slot while text is scrolling or during a transition.
+    // ***
+    ColumnDescriptor_t _computedDescriptor;
+
+    // ***
+    // *** The transition state shared with the refresh interrupt.
+    // *** During a transition the back table still holds the old
+    // *** frame and the front table the new one; the rows shown are
+    // *** worked out from both.
+    // ***
+    volatile bool _transitionActive = false;
+    volatile Transition_t _transition = TRANSITION_NONE;
+    volatile uint8_t _transitionStep = 0;
+    uint8_t _transitionSteps = 0;
+    uint8_t _transitionFrames = DEFAULT_TRANSITION_FRAMES;
+    uint8_t _transitionTick = 0;
+
+    // ***
+    // *** Moves the transition on one step once every
+    // *** _transitionFrames refresh cycles. Called from the
+    // *** refresh interrupt at the start of each cycle.
+    // ***
+    void advanceTransition();
+
+    // ***
+    // *** Builds the descriptor for the specified slot part way
+    // *** between the old and the new frame.
+    // ***
+    const ColumnDescriptor_t* getTransitionDescriptor(uint8_t);
+
+    // ***
+    // *** The self test state shared with the refresh interrupt. The
+    // *** step counts columns during the sweep and rows during the
+    // *** sense part, where step 0 lights nothing to get the reading
+    // *** with no current.
+    // ***
+    volatile SelfTest_t _selfTest = SELF_TEST_NONE;
+    volatile uint8_t _selfTestStep = 0;
+    uint8_t _selfTestSteps = 0;
+    uint8_t _selfTestFrames = 0;
+    uint8_t _selfTestTick = 0;
+
+    // ***
+    // *** The row current measurement. A slot is chosen when its
+    // *** descriptor is built, the conversion is started by the
+    // *** compare interrupt when the column switches on in that slot
+    // *** and the result is read at the start of the slot after.
+    // ***
+    uint8_t _senseChannel = NO_SENSE_CHANNEL;
+    uint16_t _senseThreshold = DEFAULT_SENSE_THRESHOLD;
+    uint16_t _senseBaseline = 0;
+    uint8_t _senseNextColumn = NO_SENSE_COLUMN;
+    uint8_t _senseNextRows = 0;
+    uint8_t _senseColumn = NO_SENSE_COLUMN;
+    uint8_t _senseRows = 0;
+    volatile bool _senseSample = false;
+    uint8_t _ledFaults[COLUMNS];
+
+    // ***
+    // *** Starts the specified part of the self test.
+    // ***
+    void beginSelfTest(SelfTest_t);
+
+    // ***
+    // *** Moves the self test on one step once every _selfTestFrames
+    // *** refresh cycles. Called from the refresh interrupt at the
+    // *** start of each cycle.
+    // ***
+    void advanceSelfTest();
+
+    // ***
+    // *** Builds the descriptor for the specified slot for the
+    // *** current part of the self test.
+    // ***
+    const ColumnDescriptor_t* getSelfTestDescriptor(uint8_t);
+
+    // ***
+    // *** Moves the scroll window one column once every
+    // *** _scrollFrames refresh cycles. Called from the refresh
+    // *** interrupt at the start of each cycle.
+    // ***
+    void advanceScroll();
+
+    // ***
+    // *** Builds the descriptor for the specified slot from
+    // *** the scroll buffer.
+    // ***
+    const ColumnDescriptor_t* getScrollDescriptor(uint8_t);
+
+    // ***
+    // *** ORs the text into a single column buffer of the
+    // *** specified size starting at the specified column.
+    // ***
+    void renderText(uint8_t*, uint8_t, int16_t, const char*);
+
+    // ***
+    // *** The queue of momentary messages. The first message in the
+    // *** queue is the one being shown.
+    // ***
+    Overlay_t _overlays[OVERLAY_QUEUE_SIZE];
+    uint8_t _overlayHead = 0;
+    uint8_t _overlayCount = 0;
+    Milliseconds_t _overlayStart = 0;
+
+    // ***
+    // *** The columns of the message being shown and a flag the
+    // *** refresh interrupt uses to hold off scrolling while it
+    // *** is shown.
+    // ***
+    uint8_t _overlayBuffer[COLUMNS];
+    volatile bool _overlayActive = false;
+
+    // ***
+    // *** Renders and shows the message at the head of the queue.
+    // ***
+    void showOverlay();
+
+    // ***
+    // *** The TOP value of Timer1 (ICR1) captured when the compare
+    // *** interrupt is enabled.
+    // ***
+    uint16_t _timerTop = 0;
+
+    // ***
+    // *** The compare value Timer1 latched for the current slot;
+    // *** 0 means it is not known yet.
+    // ***
+    uint16_t _activeCompare = 0;
+
+    // ***
+    // *** The calibration. The interrupts only write the totals while
+    // *** slots remain to be measured.
+    // ***
+    volatile uint16_t _calibrationSlots = 0;
+    uint16_t _refreshTicksMinimum = 0;
+    uint16_t _refreshTicksMaximum = 0;
+    uint32_t _refreshTicksTotal = 0;
+    uint16_t _compareTicksMaximum = 0;
+    uint32_t _compareTicksTotal = 0;
+    uint16_t _compareMatches = 0;
+    uint8_t _loadCeiling = DEFAULT_LOAD_CEILING;
+    uint8_t _flickerFreeRate = FLICKER_FREE_REFRESH_RATE;
+
+    // ***
+    // *** Adds the length of the interrupt that read the
+    // *** specified count from Timer1 to the calibration.
+    // ***
+    void recordRefresh(uint16_t);
+    void recordCompareMatch(uint16_t);
+
+    // ***
+    // *** The Timer1 clock divider.
+    // ***
+    uint16_t getTimerPrescaler();
+
+    // ***
+    // *** The current global brightness.
+    // ***
+    uint8_t _brightness = MAX_BRIGHTNESS;
+
+    // ***
+    // *** The compare value for each plane and each possible
+    // *** number of LEDs lit in a column. This is rebuilt only
+    // *** when the timer or the brightness changes so building
+    // *** a descriptor needs no arithmetic.
+    // ***
+    uint16_t _compareTable[GRAYSCALE_BITS][ROWS + 1];
+
+    // ***
+    // *** Rebuilds the compare value lookup table.
+    // ***
+    void updateCompareTable();
+
+    // ***
+    // *** Calculates the compare value for a plane with the
+    // *** specified number of LEDs lit.
+    // ***
+    uint16_t calculateCompareValue(uint8_t, uint8_t);
+
+    // ***
+    // *** The chip select bits for the column that is currently
+    // *** loaded on the row and decoder ports.
+    // ***
+    volatile uint8_t _columnSelect = CS_OFF;
+
+    // ***
+    // *** Builds the descriptor for the specified column and
+    // *** plane from the framebuffer.
     // ***
-    uint64_t _compensationDelay[COLUMNS];
+    void buildDescriptor(ColumnDescriptor_t*, uint8_t, uint8_t);
 
     // ***
-    // *** Draws the specified column where the bits in the second
-    // *** paramter determine which LEDs in the row are on.
+    // *** Loads the rows and column address from the descriptor
+    // *** with the column switched off.
     // ***
-    void drawColumn(uint8_t, uint8_t);
+    void drawColumn(const ColumnDescriptor_t*);
 
     // ***
-    // *** Counts the number of bits that are '1'.
+    // *** Counts the number of bits that are '1' using
+    // *** a lookup table.
     // ***
     uint8_t getBitCount(uint8_t);
 };
@@ -1,6 +1,8 @@
 #ifndef MODE_H
 #define MODE_H
 
+#include "Other\Timing.h"
+
 // ***
 // *** Defines the various modes.
 // ***
@@ -11,7 +13,8 @@ typedef enum MODE : uint8_t
   MODE_DST = 2,
   MODE_CHIME = 3,
   MODE_FORMAT = 4,
-  MODE_MAX = 5
+  MODE_BRIGHTNESS = 5,
+  MODE_MAX = 6
 } Mode_t;
 
 class Mode
@@ -29,7 +32,7 @@ class Mode
       // ***
       // *** Convert timeout to milliseconds.
       // ***
-      this->_timeout = timeout * 1000;
+      this->_timeout = timeout * 1000U;
     };
 
     // ***
@@ -129,7 +132,7 @@ class Mode
         // ***
         // *** Check if the timeout period has elapsed.
         // ***
-        if ((millis() - this->_timer) > this->_timeout)
+        if (hasElapsed(this->_timer, this->_timeout))
         {
           // ***
           // *** Switch back to the default mode.
@@ -165,15 +168,17 @@ class Mode
     bool _setupChanged = false;
 
     // ***
-    // *** The amount of time, in seconds, that the mode
+    // *** The amount of time, in milliseconds, that the mode
     // *** will switch back to the default mode if no changes
-    // *** are detected.
+    // *** are detected. This is limited to about 65
+    // *** seconds.
     // ***
     uint16_t _timeout;
 
     // ***
-    // *** Tracks the last mode or setup change.
+    // *** Tracks the last mode or setup change. This is a
+    // *** millis() time stamp.
     // ***
-    uint64_t _timer;
+    Milliseconds_t _timer;
 };
 #endif
@@ -0,0 +1,246 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// ***
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// ***
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// ***
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+
+/*
+
+This file was generated by ColumnFontGenerator.py. Do not edit it; change
+the font in GFX Font Editor and run the generator again.
+
+Font Name:      ClockFont
+Date Created:   Tuesday, March 17, 2020 10:45 PM
+Last Modified:  Sunday, March 22, 2020 09:15 AM
+Version:        1.19
+License:        LGPL-3.0
+
+Each byte holds the rows of one glyph column with the top row in bit 0,
+already positioned for text drawn on the bottom row of a 7 row display.
+Blank columns on the right of each glyph are not stored; xAdvance gives
+the full character spacing.
+
+*/
+
+#ifndef CLOCK_FONT_COLUMNS_H
+#define CLOCK_FONT_COLUMNS_H
+
+#include "Other\ColumnFont.h"
+
+const uint8_t ClockFontColumnBitmaps[] PROGMEM =
+{
+	0x2e,                          /* 0x21 ! */
+	0x06, 0x00, 0x06,              /* 0x22 " */
+	0x14, 0x3e, 0x14, 0x3e, 0x14,  /* 0x23 # */
+	0x14, 0x3e, 0x14,              /* 0x24 $ */
+	0x12, 0x08, 0x24,              /* 0x25 % */
+	0x14, 0x2a, 0x14, 0x20,        /* 0x26 & */
+	0x06,                          /* 0x27 ' */
+	0x1c, 0x22,                    /* 0x28 ( */
+	0x22, 0x1c,                    /* 0x29 ) */
+	0x14, 0x08, 0x14,              /* 0x2a * */
+	0x08, 0x1c, 0x08,              /* 0x2b + */
+	0x20, 0x10,                    /* 0x2c , */
+	0x08, 0x08,                    /* 0x2d - */
+	0x20,                          /* 0x2e . */
+	0x20, 0x10, 0x08, 0x04, 0x02,  /* 0x2f / */
+	0x3e, 0x22, 0x3e,              /* 0x30 0 */
+	0x3e,                          /* 0x31 1 */
+	0x3a, 0x2a, 0x2e,              /* 0x32 2 */
+	0x2a, 0x2a, 0x3e,              /* 0x33 3 */
+	0x0e, 0x08, 0x3e,              /* 0x34 4 */
+	0x2e, 0x2a, 0x3a,              /* 0x35 5 */
+	0x3e, 0x2a, 0x3a,              /* 0x36 6 */
+	0x02, 0x02, 0x3e,              /* 0x37 7 */
+	0x3e, 0x2a, 0x3e,              /* 0x38 8 */
+	0x2e, 0x2a, 0x3e,              /* 0x39 9 */
+	0x14,                          /* 0x3a : */
+	0x20, 0x14,                    /* 0x3b ; */
+	0x08, 0x14, 0x22,              /* 0x3c < */
+	0x14, 0x14,                    /* 0x3d = */
+	0x22, 0x14, 0x08,              /* 0x3e > */
+	0x02, 0x2a, 0x0e,              /* 0x3f ? */
+	0x1e, 0x2a, 0x2c,              /* 0x40 @ */
+	0x3e, 0x0a, 0x3e,              /* 0x41 A */
+	0x3e, 0x2a, 0x36,              /* 0x42 B */
+	0x3e, 0x22, 0x22,              /* 0x43 C */
+	0x3e, 0x22, 0x1c,              /* 0x44 D */
+	0x3e, 0x2a, 0x22,              /* 0x45 E */
+	0x3e, 0x0a, 0x02,              /* 0x46 F */
+	0x1c, 0x2a, 0x3a,              /* 0x47 G */
+	0x3e, 0x08, 0x3e,              /* 0x48 H */
+	0x22, 0x3e, 0x22,              /* 0x49 I */
+	0x30, 0x22, 0x1e,              /* 0x4a J */
+	0x3e, 0x08, 0x36,              /* 0x4b K */
+	0x3e, 0x20, 0x20,              /* 0x4c L */
+	0x3e, 0x08, 0x30, 0x08, 0x3e,  /* 0x4d M */
+	0x3e, 0x04, 0x08, 0x3e,        /* 0x4e N */
+	0x3e, 0x22, 0x3e,              /* 0x4f O */
+	0x3e, 0x0a, 0x0e,              /* 0x50 P */
+	0x3e, 0x22, 0x1e, 0x20,        /* 0x51 Q */
+	0x3e, 0x0a, 0x36,              /* 0x52 R */
+	0x2e, 0x2a, 0x3a,              /* 0x53 S */
+	0x02, 0x3e, 0x02,              /* 0x54 T */
+	0x3e, 0x20, 0x3e,              /* 0x55 U */
+	0x1e, 0x20, 0x1e,              /* 0x56 V */
+	0x0e, 0x10, 0x38, 0x10, 0x0e,  /* 0x57 W */
+	0x22, 0x14, 0x08, 0x14, 0x22,  /* 0x58 X */
+	0x06, 0x38, 0x06,              /* 0x59 Y */
+	0x32, 0x2a, 0x26,              /* 0x5a Z */
+	0x3e, 0x22,                    /* 0x5b [ */
+	0x02, 0x04, 0x08, 0x10, 0x20,  /* 0x5c \ */
+	0x22, 0x3e,                    /* 0x5d ] */
+	0x04, 0x02, 0x04,              /* 0x5e ^ */
+	0x20, 0x20, 0x20,              /* 0x5f _ */
+	0x02, 0x04,                    /* 0x60 ` */
+	0x34, 0x2a, 0x3c,              /* 0x61 a */
+	0x3e, 0x28, 0x38,              /* 0x62 b */
+	0x10, 0x28, 0x28,              /* 0x63 c */
+	0x38, 0x28, 0x3e,              /* 0x64 d */
+	0x3c, 0x2a, 0x24,              /* 0x65 e */
+	0x3c, 0x0a, 0x04,              /* 0x66 f */
+	0x48, 0x54, 0x68,              /* 0x67 g */
+	0x3e, 0x08, 0x38,              /* 0x68 h */
+	0x00, 0x3a,                    /* 0x69 i */
+	0x40, 0x74,                    /* 0x6a j */
+	0x3e, 0x10, 0x28,              /* 0x6b k */
+	0x22, 0x3e, 0x20,              /* 0x6c l */
+	0x3c, 0x08, 0x10, 0x08, 0x3c,  /* 0x6d m */
+	0x38, 0x04, 0x38,              /* 0x6e n */
+	0x10, 0x28, 0x10,              /* 0x6f o */
+	0x3c, 0x0a, 0x0c,              /* 0x70 p */
+	0x06, 0x0a, 0x3c,              /* 0x71 q */
+	0x38, 0x04, 0x08,              /* 0x72 r */
+	0x2c, 0x34,                    /* 0x73 s */
+	0x04, 0x3e, 0x24,              /* 0x74 t */
+	0x38, 0x20, 0x18,              /* 0x75 u */
+	0x18, 0x20, 0x18,              /* 0x76 v */
+	0x08, 0x10, 0x38, 0x10, 0x08,  /* 0x77 w */
+	0x28, 0x10, 0x28,              /* 0x78 x */
+	0x58, 0x50, 0x78,              /* 0x79 y */
+	0x24, 0x2c, 0x34,              /* 0x7a z */
+	0x08, 0x36, 0x22,              /* 0x7b { */
+	0x3e,                          /* 0x7c | */
+	0x22, 0x36, 0x08,              /* 0x7d } */
+	0x04, 0x08, 0x04, 0x08,        /* 0x7e ~ */
+};
+
+const ColumnGlyph_t ClockFontColumnGlyphs[] PROGMEM =
+{
+	{ 0, 0, 2 },        /* 0x20 Space */
+	{ 0, 1, 2 },        /* 0x21 ! */
+	{ 1, 3, 4 },        /* 0x22 " */
+	{ 4, 5, 6 },        /* 0x23 # */
+	{ 9, 3, 4 },        /* 0x24 $ */
+	{ 12, 3, 4 },       /* 0x25 % */
+	{ 15, 4, 5 },       /* 0x26 & */
+	{ 19, 1, 2 },       /* 0x27 ' */
+	{ 20, 2, 3 },       /* 0x28 ( */
+	{ 22, 2, 3 },       /* 0x29 ) */
+	{ 24, 3, 4 },       /* 0x2a * */
+	{ 27, 3, 4 },       /* 0x2b + */
+	{ 30, 2, 3 },       /* 0x2c , */
+	{ 32, 2, 3 },       /* 0x2d - */
+	{ 34, 1, 2 },       /* 0x2e . */
+	{ 35, 5, 6 },       /* 0x2f / */
+	{ 40, 3, 4 },       /* 0x30 0 */
+	{ 43, 1, 2 },       /* 0x31 1 */
+	{ 44, 3, 4 },       /* 0x32 2 */
+	{ 47, 3, 4 },       /* 0x33 3 */
+	{ 50, 3, 4 },       /* 0x34 4 */
+	{ 53, 3, 4 },       /* 0x35 5 */
+	{ 56, 3, 4 },       /* 0x36 6 */
+	{ 59, 3, 4 },       /* 0x37 7 */
+	{ 62, 3, 4 },       /* 0x38 8 */
+	{ 65, 3, 4 },       /* 0x39 9 */
+	{ 68, 1, 2 },       /* 0x3a : */
+	{ 69, 2, 3 },       /* 0x3b ; */
+	{ 71, 3, 4 },       /* 0x3c < */
+	{ 74, 2, 3 },       /* 0x3d = */
+	{ 76, 3, 4 },       /* 0x3e > */
+	{ 79, 3, 4 },       /* 0x3f ? */
+	{ 82, 3, 4 },       /* 0x40 @ */
+	{ 85, 3, 4 },       /* 0x41 A */
+	{ 88, 3, 4 },       /* 0x42 B */
+	{ 91, 3, 4 },       /* 0x43 C */
+	{ 94, 3, 4 },       /* 0x44 D */
+	{ 97, 3, 4 },       /* 0x45 E */
+	{ 100, 3, 4 },      /* 0x46 F */
+	{ 103, 3, 4 },      /* 0x47 G */
+	{ 106, 3, 4 },      /* 0x48 H */
+	{ 109, 3, 4 },      /* 0x49 I */
+	{ 112, 3, 4 },      /* 0x4a J */
+	{ 115, 3, 4 },      /* 0x4b K */
+	{ 118, 3, 4 },      /* 0x4c L */
+	{ 121, 5, 6 },      /* 0x4d M */
+	{ 126, 4, 5 },      /* 0x4e N */
+	{ 130, 3, 4 },      /* 0x4f O */
+	{ 133, 3, 4 },      /* 0x50 P */
+	{ 136, 4, 5 },      /* 0x51 Q */
+	{ 140, 3, 4 },      /* 0x52 R */
+	{ 143, 3, 4 },      /* 0x53 S */
+	{ 146, 3, 4 },      /* 0x54 T */
+	{ 149, 3, 4 },      /* 0x55 U */
+	{ 152, 3, 4 },      /* 0x56 V */
+	{ 155, 5, 5 },      /* 0x57 W */
+	{ 160, 5, 6 },      /* 0x58 X */
+	{ 165, 3, 4 },      /* 0x59 Y */
+	{ 168, 3, 4 },      /* 0x5a Z */
+	{ 171, 2, 3 },      /* 0x5b [ */
+	{ 173, 5, 6 },      /* 0x5c \ */
+	{ 178, 2, 3 },      /* 0x5d ] */
+	{ 180, 3, 4 },      /* 0x5e ^ */
+	{ 183, 3, 3 },      /* 0x5f _ */
+	{ 186, 2, 3 },      /* 0x60 ` */
+	{ 188, 3, 4 },      /* 0x61 a */
+	{ 191, 3, 4 },      /* 0x62 b */
+	{ 194, 3, 4 },      /* 0x63 c */
+	{ 197, 3, 4 },      /* 0x64 d */
+	{ 200, 3, 4 },      /* 0x65 e */
+	{ 203, 3, 4 },      /* 0x66 f */
+	{ 206, 3, 4 },      /* 0x67 g */
+	{ 209, 3, 4 },      /* 0x68 h */
+	{ 212, 2, 3 },      /* 0x69 i */
+	{ 214, 2, 3 },      /* 0x6a j */
+	{ 216, 3, 4 },      /* 0x6b k */
+	{ 219, 3, 4 },      /* 0x6c l */
+	{ 222, 5, 6 },      /* 0x6d m */
+	{ 227, 3, 4 },      /* 0x6e n */
+	{ 230, 3, 4 },      /* 0x6f o */
+	{ 233, 3, 4 },      /* 0x70 p */
+	{ 236, 3, 4 },      /* 0x71 q */
+	{ 239, 3, 4 },      /* 0x72 r */
+	{ 242, 2, 3 },      /* 0x73 s */
+	{ 244, 3, 4 },      /* 0x74 t */
+	{ 247, 3, 4 },      /* 0x75 u */
+	{ 250, 3, 4 },      /* 0x76 v */
+	{ 253, 5, 6 },      /* 0x77 w */
+	{ 258, 3, 4 },      /* 0x78 x */
+	{ 261, 3, 4 },      /* 0x79 y */
+	{ 264, 3, 4 },      /* 0x7a z */
+	{ 267, 3, 4 },      /* 0x7b { */
+	{ 270, 1, 2 },      /* 0x7c | */
+	{ 271, 3, 4 },      /* 0x7d } */
+	{ 274, 4, 5 }       /* 0x7e ~ */
+};
+
+const ColumnFont_t ClockFontColumns PROGMEM =
+{
+	(uint8_t*)ClockFontColumnBitmaps,
+	(ColumnGlyph_t*)ClockFontColumnGlyphs,
+	0x20, /* First ASCII Character */
+	0x7e  /* Last ASCII Character */
+};
+
+#endif
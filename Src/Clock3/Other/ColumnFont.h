@@ -0,0 +1,43 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#ifndef COLUMN_FONT_H
+#define COLUMN_FONT_H
+
+#include <Arduino.h>
+
+// ***
+// *** A font stored one byte per column instead of one byte per row.
+// *** Bit 0 is the top row of the display so a glyph column can be
+// *** ORed straight into the framebuffer. The glyphs are aligned to
+// *** the bottom row of the display when the font is built.
+// ***
+typedef struct COLUMN_GLYPH
+{
+  uint16_t bitmapOffset;  // Index of the first column in the bitmap.
+  uint8_t width;          // Number of columns stored for the glyph.
+  uint8_t xAdvance;       // Distance to advance the cursor.
+} ColumnGlyph_t;
+
+typedef struct COLUMN_FONT
+{
+  const uint8_t* bitmap;        // The glyph columns.
+  const ColumnGlyph_t* glyph;   // The glyph table.
+  uint8_t first;                // The first ASCII character.
+  uint8_t last;                 // The last ASCII character.
+} ColumnFont_t;
+
+#endif
@@ -0,0 +1,126 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#ifndef MATRIX_GEOMETRY_H
+#define MATRIX_GEOMETRY_H
+
+#include <Arduino.h>
+
+// ***
+// *** The size of the matrix and how it is wired. The values here are
+// *** for the Solder:Time Desk Clock. Each one can be defined before
+// *** this file is included to build the driver for a different board;
+// *** everything the driver needs is worked out from them when the
+// *** code is compiled.
+// ***
+#ifndef ROWS
+#define ROWS       7
+#endif
+
+#ifndef COLUMNS
+#define COLUMNS   20
+#endif
+
+// ***
+// *** The rows are connected to PORT B in order (row 1 on PB0, row 2
+// *** PB1 and so on).
+// ***
+#ifndef ROW_REGISTER
+#define ROW_REGISTER DDRB
+#define ROW_PORT PORTB
+#endif
+
+// ***
+// *** Defines the register and port for the 74LS138N 3 to 8 decoders. The three
+// *** input pins are on PD4 (A), PD5 (B) and PD6 (C). A, B and C are all tied
+// *** together on all of the decoder chips.
+// ***
+#ifndef DECODER_REGISTER
+#define DECODER_REGISTER DDRD
+#define DECODER_PORT PORTD
+#define DECODER_SHIFT 4
+#endif
+
+// ***
+// *** The enable pins of the 74LS138N decoder chips are tied to
+// *** pins 2 and 3 of Port C.
+// ***
+// *** CS_S1 = 1, CS_S2 = 0 (enables columns 0 to 7)
+// *** CS_S1 = 0, CS_S2 = 1 (enables columns 8 to 15)
+// *** CS_S1 = 0, CS_S2 = 0 (enables columns 16 to 19)
+// ***
+// *** CS_BANK() gives the chip select bits that enable the decoder
+// *** for each bank of eight columns, CS_OFF the bits that enable
+// *** none of them and CS_BANK_COUNT the number of decoders.
+// ***
+#ifndef CHIP_SELECT_REGISTER
+#define CHIP_SELECT_REGISTER DDRC
+#define CHIP_SELECT_PORT PORTC
+#define CS_MASK B00001100
+#define CS_OFF B00001100
+#define CS_BANK(bank) ((bank) == 0 ? B00000100 : (bank) == 1 ? B00001000 : B00000000)
+#define CS_BANK_COUNT 3
+#endif
+
+// ***
+// *** Each decoder drives eight columns.
+// ***
+#define DECODER_OUTPUTS 8
+#define DECODER_BANKS ((COLUMNS + DECODER_OUTPUTS - 1) / DECODER_OUTPUTS)
+
+// ***
+// *** The port bits used by the rows and by the decoder inputs.
+// ***
+#define ROW_MASK ((uint8_t)((1 << ROWS) - 1))
+#define DECODER_MASK ((uint8_t)((DECODER_OUTPUTS - 1) << DECODER_SHIFT))
+
+// ***
+// *** The decoder input and chip select bits for a column. The two
+// *** sets of bits are stored together in one byte so they must not
+// *** overlap.
+// ***
+#define COLUMN_ADDRESS(column) ((uint8_t)((((column) % DECODER_OUTPUTS) << DECODER_SHIFT) | CS_BANK((column) / DECODER_OUTPUTS)))
+
+static_assert(ROWS >= 1 && ROWS <= 8, "The rows must fit on one port.");
+static_assert(COLUMNS >= 1 && COLUMNS <= CS_BANK_COUNT * DECODER_OUTPUTS, "There are not enough decoders for the columns.");
+static_assert(CS_BANK_COUNT * DECODER_OUTPUTS <= 32, "The columns must fit in a ColumnMask_t.");
+static_assert((DECODER_MASK & CS_MASK) == 0, "The decoder and chip select bits overlap.");
+
+// ***
+// *** The address of every column, worked out by the compiler. The
+// *** table is filled a bank at a time so it may have a few entries
+// *** past the last column; they are never read. The fourth bank is
+// *** only used by a board that defines four decoders.
+// ***
+#define BANK_ADDRESSES(bank) \
+  COLUMN_ADDRESS((bank) * DECODER_OUTPUTS + 0), COLUMN_ADDRESS((bank) * DECODER_OUTPUTS + 1), COLUMN_ADDRESS((bank) * DECODER_OUTPUTS + 2), COLUMN_ADDRESS((bank) * DECODER_OUTPUTS + 3), \
+  COLUMN_ADDRESS((bank) * DECODER_OUTPUTS + 4), COLUMN_ADDRESS((bank) * DECODER_OUTPUTS + 5), COLUMN_ADDRESS((bank) * DECODER_OUTPUTS + 6), COLUMN_ADDRESS((bank) * DECODER_OUTPUTS + 7)
+
+const static uint8_t _columnAddress[] PROGMEM =
+{
+  BANK_ADDRESSES(0),
+#if COLUMNS > 8
+  BANK_ADDRESSES(1),
+#endif
+#if COLUMNS > 16
+  BANK_ADDRESSES(2),
+#endif
+#if COLUMNS > 24
+  BANK_ADDRESSES(3),
+#endif
+};
+
+#endif
@@ -0,0 +1,43 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <Arduino.h>
+
+// ***
+// *** Microsecond values are only used for the time a column is
+// *** on the display which is well under 65 ms.
+// ***
+typedef uint16_t Microseconds_t;
+
+// ***
+// *** Millisecond values match the type returned by millis().
+// ***
+typedef uint32_t Milliseconds_t;
+
+// ***
+// *** Returns true when the specified interval has passed since the
+// *** given millis() time stamp. The subtraction is done in unsigned
+// *** 32-bit math so the result is correct when millis() wraps.
+// ***
+inline bool hasElapsed(Milliseconds_t since, Milliseconds_t interval)
+{
+  return (Milliseconds_t)(millis() - since) >= interval;
+}
+
+#endif
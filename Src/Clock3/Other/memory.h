@@ -15,3 +15,37 @@ int freeMemory() {
   return __brkval ? &top - __brkval : &top - __malloc_heap_start;
 #endif  // __arm__
 }
+
+// ***
+// *** The number of bytes used by static data (.data and .bss).
+// ***
+extern char __data_start;
+extern char __bss_end;
+
+int staticMemory() {
+  return &__bss_end - &__data_start;
+}
+
+// ***
+// *** Fills the free memory between the heap and the stack with a
+// *** known pattern. lowestFreeMemory() counts the bytes that still
+// *** hold the pattern, which is the least free memory seen since
+// *** paintStack() was called (the stack's high-water mark).
+// ***
+#define STACK_PAINT 0xc5
+
+char* freeMemoryStart() {
+  return __brkval ? __brkval : &__bss_end;
+}
+
+void paintStack() {
+  char top;
+  for (char* p = freeMemoryStart(); p < &top - 16; p++) *p = STACK_PAINT;
+}
+
+int lowestFreeMemory() {
+  char top;
+  char* p = freeMemoryStart();
+  while (p < &top && *p == (char)STACK_PAINT) p++;
+  return p - freeMemoryStart();
+}
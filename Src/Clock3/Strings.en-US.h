@@ -17,26 +17,57 @@
 #ifndef STRINGS_H
 #define STRINGS_H
 
+#include <Arduino.h>
+
+// ***
+// *** The strings are kept in flash. Use loadString() to copy
+// *** one into RAM before passing it to the display and use
+// *** sprintf_P() with the format strings.
+// ***
+
 // ***
 // *** Strings used on the display
 // ***
-#define STRING_DISPLAY_TZ "TZ"
-#define STRING_DISPLAY_VERSION "clk 3"
-#define STRING_DISPLAY_DST "DST"
-#define STRING_DISPLAY_BATTERY "Bat V"
-#define STRING_DISPLAY_CHIME "Chime"
-#define STRING_DISPLAY_GPS "GPS"
-#define STRING_DISPLAY_NO_FIX "No Fx"
-#define STRING_DISPLAY_YES "Yes"
-#define STRING_DISPLAY_NO "No"
-#define STRING_DISPLAY_FMT "12 Hr"
+const char STRING_DISPLAY_TZ[] PROGMEM = "TZ";
+const char STRING_DISPLAY_VERSION[] PROGMEM = "clk 3";
+const char STRING_DISPLAY_DST[] PROGMEM = "DST";
+const char STRING_DISPLAY_BATTERY[] PROGMEM = "Bat V";
+const char STRING_DISPLAY_CHIME[] PROGMEM = "Chime";
+const char STRING_DISPLAY_GPS[] PROGMEM = "GPS";
+const char STRING_DISPLAY_NO_FIX[] PROGMEM = "No Fx";
+const char STRING_DISPLAY_YES[] PROGMEM = "Yes";
+const char STRING_DISPLAY_NO[] PROGMEM = "No";
+const char STRING_DISPLAY_FMT[] PROGMEM = "12 Hr";
+const char STRING_DISPLAY_BRIGHTNESS[] PROGMEM = "Brt";
+const char STRING_DISPLAY_AUTO[] PROGMEM = "Auto";
 
 // ***
 // *** Strings used for formatting.
 // ***
-#define FORMAT_TIME "%01d:%02d"
-#define FORMAT_VOLTAGE "%sv"
-#define FORMAT_STRING "%s"
-#define FORMAT_NUMBER "%d"
+const char FORMAT_TIME[] PROGMEM = "%01d:%02d";
+const char FORMAT_VOLTAGE[] PROGMEM = "%sv";
+const char FORMAT_NUMBER[] PROGMEM = "%d";
+const char FORMAT_LED_FAULTS[] PROGMEM = "LED %d";
+
+// ***
+// *** The size of the buffer used by loadString(). This is
+// *** the longest display string plus the terminator.
+// ***
+#define STRING_BUFFER_SIZE 6
+
+// ***
+// *** Copies a display string from flash into a buffer that
+// *** is reused by the next call. The display copies the text
+// *** it is given so the result can be passed straight to it.
+// ***
+inline const char* loadString(const char* text)
+{
+  static char buffer[STRING_BUFFER_SIZE];
+
+  strncpy_P(buffer, text, STRING_BUFFER_SIZE - 1);
+  buffer[STRING_BUFFER_SIZE - 1] = 0;
+
+  return buffer;
+}
 
 #endif
@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_11_H
+#define TEST_TIMEZONEID_11_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_11_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 15, 17, 54, 0, false);         // UTC: 5:54 PM Local: 5:54 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 30, 14, 28, 0, false);         // UTC: 2:28 PM Local: 2:28 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 17, 18, 12, 0, false);         // UTC: 6:12 PM Local: 6:12 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 6, 16, 30, 0, false);          // UTC: 4:30 PM Local: 4:30 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 21, 19, 50, 0, false);         // UTC: 7:50 PM Local: 7:50 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 6, 3, 28, 0, false);           // UTC: 3:28 AM Local: 3:28 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 10, 4, 5, 0, false);           // UTC: 4:05 AM Local: 4:05 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 18, 22, 40, 0, false);         // UTC: 10:40 PM Local: 10:40 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 2, 19, 25, 0, false);          // UTC: 7:25 PM Local: 7:25 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 31, 14, 41, 0, false);         // UTC: 2:41 PM Local: 2:41 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 24, 19, 41, 0, false);         // UTC: 7:41 PM Local: 7:41 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 6, 19, 0, 0, false);           // UTC: 7:00 PM Local: 7:00 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 27, 16, 4, 0, false);          // UTC: 4:04 PM Local: 4:04 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 2, 1, 12, 0, false);           // UTC: 1:12 AM Local: 1:12 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 29, 7, 38, 0, false);          // UTC: 7:38 AM Local: 7:38 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 1, 14, 20, 0, false);          // UTC: 2:20 PM Local: 2:20 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 15, 18, 53, 0, false);         // UTC: 6:53 PM Local: 6:53 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 7, 16, 14, 0, false);          // UTC: 4:14 PM Local: 4:14 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 21, 9, 31, 0, false);          // UTC: 9:31 AM Local: 9:31 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 1, 21, 5, 0, false);           // UTC: 9:05 PM Local: 9:05 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 15, 20, 17, 0, false);         // UTC: 8:17 PM Local: 8:17 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 14, 17, 59, 0, false);         // UTC: 5:59 PM Local: 5:59 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 27, 2, 45, 0, false);          // UTC: 2:45 AM Local: 2:45 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 9, 10, 48, 0, false);          // UTC: 10:48 AM Local: 10:48 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 1, 8, 16, 18, 0, false);          // UTC: 4:18 PM Local: 4:18 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 1, 2, 36, 0, false);           // UTC: 2:36 AM Local: 2:36 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 25, 3, 25, 0, false);          // UTC: 3:25 AM Local: 3:25 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 4, 9, 24, 0, false);           // UTC: 9:24 AM Local: 9:24 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 3, 0, 54, 0, false);           // UTC: 12:54 AM Local: 12:54 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 22, 0, 13, 0, false);          // UTC: 12:13 AM Local: 12:13 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 7, 1, 30, 0, false);           // UTC: 1:30 AM Local: 1:30 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 13, 22, 25, 0, false);         // UTC: 10:25 PM Local: 10:25 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 14, 2, 36, 0, false);          // UTC: 2:36 AM Local: 2:36 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 21, 6, 49, 0, false);          // UTC: 6:49 AM Local: 6:49 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 22, 8, 21, 0, false);          // UTC: 8:21 AM Local: 8:21 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 3, 9, 21, 0, false);           // UTC: 9:21 AM Local: 9:21 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 1, 13, 48, 0, false);          // UTC: 1:48 PM Local: 1:48 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 4, 4, 15, 0, false);           // UTC: 4:15 AM Local: 4:15 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 23, 3, 0, 0, false);           // UTC: 3:00 AM Local: 3:00 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 2, 14, 51, 0, false);          // UTC: 2:51 PM Local: 2:51 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 16, 5, 43, 0, false);          // UTC: 5:43 AM Local: 5:43 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 18, 6, 28, 0, false);          // UTC: 6:28 AM Local: 6:28 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 17, 6, 46, 0, false);          // UTC: 6:46 AM Local: 6:46 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 25, 4, 26, 0, false);          // UTC: 4:26 AM Local: 4:26 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 21, 12, 7, 0, false);          // UTC: 12:07 PM Local: 12:07 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 13, 13, 13, 0, false);         // UTC: 1:13 PM Local: 1:13 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 1, 8, 55, 0, false);           // UTC: 8:55 AM Local: 8:55 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 26, 18, 19, 0, false);         // UTC: 6:19 PM Local: 6:19 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 1, 6, 11, 0, false);           // UTC: 6:11 AM Local: 6:11 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 2, 13, 19, 41, 0, false);         // UTC: 7:41 PM Local: 7:41 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 19, 3, 2, 0, false);           // UTC: 3:02 AM Local: 3:02 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 5, 6, 28, 0, false);           // UTC: 6:28 AM Local: 6:28 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 9, 0, 49, 0, false);           // UTC: 12:49 AM Local: 12:49 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 20, 10, 53, 0, false);         // UTC: 10:53 AM Local: 10:53 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 10, 12, 4, 0, false);          // UTC: 12:04 PM Local: 12:04 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 3, 2, 13, 0, false);           // UTC: 2:13 AM Local: 2:13 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 19, 20, 15, 0, false);         // UTC: 8:15 PM Local: 8:15 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 1, 19, 23, 0, false);          // UTC: 7:23 PM Local: 7:23 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 12, 19, 29, 0, false);         // UTC: 7:29 PM Local: 7:29 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 5, 18, 30, 0, false);          // UTC: 6:30 PM Local: 6:30 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 27, 18, 8, 0, true);           // UTC: 6:08 PM Local: 7:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 28, 12, 11, 0, true);          // UTC: 12:11 PM Local: 1:11 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 21, 4, 19, 0, false);          // UTC: 4:19 AM Local: 4:19 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 30, 7, 52, 0, true);           // UTC: 7:52 AM Local: 8:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 20, 7, 46, 0, false);          // UTC: 7:46 AM Local: 7:46 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 7, 5, 47, 0, false);           // UTC: 5:47 AM Local: 5:47 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 21, 17, 12, 0, false);         // UTC: 5:12 PM Local: 5:12 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 22, 12, 56, 0, false);         // UTC: 12:56 PM Local: 12:56 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 16, 19, 5, 0, false);          // UTC: 7:05 PM Local: 7:05 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 14, 1, 6, 0, false);           // UTC: 1:06 AM Local: 1:06 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 4, 1, 32, 0, false);           // UTC: 1:32 AM Local: 1:32 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 31, 8, 15, 0, true);           // UTC: 8:15 AM Local: 9:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 24, 22, 25, 0, false);         // UTC: 10:25 PM Local: 10:25 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 9, 13, 52, 0, false);          // UTC: 1:52 PM Local: 1:52 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 3, 29, 19, 31, 0, true);          // UTC: 7:31 PM Local: 8:31 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 10, 16, 11, 0, true);          // UTC: 4:11 PM Local: 5:11 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 30, 23, 4, 0, true);           // UTC: 11:04 PM Local: 12:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 5, 7, 30, 0, true);            // UTC: 7:30 AM Local: 8:30 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 18, 20, 54, 0, true);          // UTC: 8:54 PM Local: 9:54 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 20, 19, 4, 0, true);           // UTC: 7:04 PM Local: 8:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 9, 6, 58, 0, true);            // UTC: 6:58 AM Local: 7:58 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 30, 6, 47, 0, true);           // UTC: 6:47 AM Local: 7:47 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 1, 2, 17, 0, true);            // UTC: 2:17 AM Local: 3:17 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 14, 14, 15, 0, true);          // UTC: 2:15 PM Local: 3:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 2, 1, 11, 0, true);            // UTC: 1:11 AM Local: 2:11 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 10, 11, 33, 0, true);          // UTC: 11:33 AM Local: 12:33 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 19, 4, 5, 0, true);            // UTC: 4:05 AM Local: 5:05 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 12, 4, 57, 0, true);           // UTC: 4:57 AM Local: 5:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 15, 10, 42, 0, true);          // UTC: 10:42 AM Local: 11:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 24, 22, 33, 0, true);          // UTC: 10:33 PM Local: 11:33 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 19, 4, 37, 0, true);           // UTC: 4:37 AM Local: 5:37 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 2, 0, 30, 0, true);            // UTC: 12:30 AM Local: 1:30 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 30, 11, 44, 0, true);          // UTC: 11:44 AM Local: 12:44 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 10, 1, 1, 0, true);            // UTC: 1:01 AM Local: 2:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 20, 20, 4, 0, true);           // UTC: 8:04 PM Local: 9:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 16, 2, 46, 0, true);           // UTC: 2:46 AM Local: 3:46 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 10, 10, 8, 0, true);           // UTC: 10:08 AM Local: 11:08 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 3, 2, 28, 0, true);            // UTC: 2:28 AM Local: 3:28 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 18, 11, 47, 0, true);          // UTC: 11:47 AM Local: 12:47 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 4, 2, 23, 47, 0, true);           // UTC: 11:47 PM Local: 12:47 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 23, 4, 50, 0, true);           // UTC: 4:50 AM Local: 5:50 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 31, 10, 22, 0, true);          // UTC: 10:22 AM Local: 11:22 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 3, 21, 30, 0, true);           // UTC: 9:30 PM Local: 10:30 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 29, 2, 55, 0, true);           // UTC: 2:55 AM Local: 3:55 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 28, 13, 50, 0, true);          // UTC: 1:50 PM Local: 2:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 1, 15, 36, 0, true);           // UTC: 3:36 PM Local: 4:36 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 1, 19, 42, 0, true);           // UTC: 7:42 PM Local: 8:42 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 13, 12, 37, 0, true);          // UTC: 12:37 PM Local: 1:37 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 1, 19, 4, 0, true);            // UTC: 7:04 PM Local: 8:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 3, 2, 40, 0, true);            // UTC: 2:40 AM Local: 3:40 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 4, 8, 56, 0, true);            // UTC: 8:56 AM Local: 9:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 14, 23, 21, 0, true);          // UTC: 11:21 PM Local: 12:21 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 13, 23, 44, 0, true);          // UTC: 11:44 PM Local: 12:44 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 19, 14, 28, 0, true);          // UTC: 2:28 PM Local: 3:28 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 15, 17, 5, 0, true);           // UTC: 5:05 PM Local: 6:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 17, 16, 1, 0, true);           // UTC: 4:01 PM Local: 5:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 10, 19, 5, 0, true);           // UTC: 7:05 PM Local: 8:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 16, 0, 14, 0, true);           // UTC: 12:14 AM Local: 1:14 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 31, 22, 7, 0, true);           // UTC: 10:07 PM Local: 11:07 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 16, 19, 42, 0, true);          // UTC: 7:42 PM Local: 8:42 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 30, 15, 16, 0, true);          // UTC: 3:16 PM Local: 4:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 29, 0, 23, 0, true);           // UTC: 12:23 AM Local: 1:23 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 10, 4, 43, 0, true);           // UTC: 4:43 AM Local: 5:43 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 20, 6, 33, 0, true);           // UTC: 6:33 AM Local: 7:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 5, 6, 10, 42, 0, true);           // UTC: 10:42 AM Local: 11:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 30, 14, 31, 0, true);          // UTC: 2:31 PM Local: 3:31 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 29, 7, 20, 0, true);           // UTC: 7:20 AM Local: 8:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 13, 21, 16, 0, true);          // UTC: 9:16 PM Local: 10:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 7, 20, 27, 0, true);           // UTC: 8:27 PM Local: 9:27 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 26, 6, 56, 0, true);           // UTC: 6:56 AM Local: 7:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 7, 12, 14, 0, true);           // UTC: 12:14 PM Local: 1:14 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 19, 10, 13, 0, true);          // UTC: 10:13 AM Local: 11:13 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 5, 4, 31, 0, true);            // UTC: 4:31 AM Local: 5:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 12, 1, 45, 0, true);           // UTC: 1:45 AM Local: 2:45 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 3, 8, 52, 0, true);            // UTC: 8:52 AM Local: 9:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 6, 3, 28, 0, true);            // UTC: 3:28 AM Local: 4:28 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 16, 8, 59, 0, true);           // UTC: 8:59 AM Local: 9:59 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 7, 13, 24, 0, true);           // UTC: 1:24 PM Local: 2:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 21, 16, 31, 0, true);          // UTC: 4:31 PM Local: 5:31 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 22, 10, 45, 0, true);          // UTC: 10:45 AM Local: 11:45 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 27, 19, 28, 0, true);          // UTC: 7:28 PM Local: 8:28 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 11, 2, 53, 0, true);           // UTC: 2:53 AM Local: 3:53 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 2, 8, 55, 0, true);            // UTC: 8:55 AM Local: 9:55 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 20, 1, 43, 0, true);           // UTC: 1:43 AM Local: 2:43 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 23, 8, 36, 0, true);           // UTC: 8:36 AM Local: 9:36 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 12, 9, 41, 0, true);           // UTC: 9:41 AM Local: 10:41 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 26, 18, 1, 0, true);           // UTC: 6:01 PM Local: 7:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 21, 4, 25, 0, true);           // UTC: 4:25 AM Local: 5:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 15, 6, 1, 0, true);            // UTC: 6:01 AM Local: 7:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 6, 25, 8, 15, 0, true);           // UTC: 8:15 AM Local: 9:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 25, 4, 50, 0, true);           // UTC: 4:50 AM Local: 5:50 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 2, 20, 7, 0, true);            // UTC: 8:07 PM Local: 9:07 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 15, 3, 40, 0, true);           // UTC: 3:40 AM Local: 4:40 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 18, 20, 40, 0, true);          // UTC: 8:40 PM Local: 9:40 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 26, 11, 4, 0, true);           // UTC: 11:04 AM Local: 12:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 22, 6, 12, 0, true);           // UTC: 6:12 AM Local: 7:12 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 27, 15, 16, 0, true);          // UTC: 3:16 PM Local: 4:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 6, 22, 0, 0, true);            // UTC: 10:00 PM Local: 11:00 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 25, 15, 34, 0, true);          // UTC: 3:34 PM Local: 4:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 23, 1, 11, 0, true);           // UTC: 1:11 AM Local: 2:11 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 8, 8, 49, 0, true);            // UTC: 8:49 AM Local: 9:49 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 12, 17, 44, 0, true);          // UTC: 5:44 PM Local: 6:44 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 31, 16, 32, 0, true);          // UTC: 4:32 PM Local: 5:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 20, 5, 25, 0, true);           // UTC: 5:25 AM Local: 6:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 28, 22, 57, 0, true);          // UTC: 10:57 PM Local: 11:57 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 8, 2, 26, 0, true);            // UTC: 2:26 AM Local: 3:26 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 30, 23, 24, 0, true);          // UTC: 11:24 PM Local: 12:24 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 5, 14, 29, 0, true);           // UTC: 2:29 PM Local: 3:29 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 7, 20, 56, 0, true);           // UTC: 8:56 PM Local: 9:56 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 30, 0, 24, 0, true);           // UTC: 12:24 AM Local: 1:24 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 18, 18, 41, 0, true);          // UTC: 6:41 PM Local: 7:41 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 29, 16, 50, 0, true);          // UTC: 4:50 PM Local: 5:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 27, 10, 29, 0, true);          // UTC: 10:29 AM Local: 11:29 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 11, 20, 13, 0, true);          // UTC: 8:13 PM Local: 9:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 7, 4, 23, 55, 0, true);           // UTC: 11:55 PM Local: 12:55 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 27, 20, 59, 0, true);          // UTC: 8:59 PM Local: 9:59 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 23, 3, 13, 0, true);           // UTC: 3:13 AM Local: 4:13 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 8, 12, 5, 0, true);            // UTC: 12:05 PM Local: 1:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 10, 17, 50, 0, true);          // UTC: 5:50 PM Local: 6:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 30, 10, 16, 0, true);          // UTC: 10:16 AM Local: 11:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 30, 22, 54, 0, true);          // UTC: 10:54 PM Local: 11:54 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 1, 11, 32, 0, true);           // UTC: 11:32 AM Local: 12:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 3, 1, 28, 0, true);            // UTC: 1:28 AM Local: 2:28 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 11, 17, 26, 0, true);          // UTC: 5:26 PM Local: 6:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 25, 8, 31, 0, true);           // UTC: 8:31 AM Local: 9:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 30, 0, 13, 0, true);           // UTC: 12:13 AM Local: 1:13 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 26, 2, 27, 0, true);           // UTC: 2:27 AM Local: 3:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 26, 1, 11, 0, true);           // UTC: 1:11 AM Local: 2:11 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 18, 10, 43, 0, true);          // UTC: 10:43 AM Local: 11:43 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 26, 4, 30, 0, true);           // UTC: 4:30 AM Local: 5:30 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 5, 16, 57, 0, true);           // UTC: 4:57 PM Local: 5:57 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 24, 16, 53, 0, true);          // UTC: 4:53 PM Local: 5:53 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 22, 22, 28, 0, true);          // UTC: 10:28 PM Local: 11:28 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 31, 15, 37, 0, true);          // UTC: 3:37 PM Local: 4:37 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 31, 22, 5, 0, true);           // UTC: 10:05 PM Local: 11:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 25, 7, 28, 0, true);           // UTC: 7:28 AM Local: 8:28 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 17, 17, 18, 0, true);          // UTC: 5:18 PM Local: 6:18 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 27, 23, 35, 0, true);          // UTC: 11:35 PM Local: 12:35 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 21, 5, 33, 0, true);           // UTC: 5:33 AM Local: 6:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 8, 17, 17, 16, 0, true);          // UTC: 5:16 PM Local: 6:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 10, 21, 24, 0, true);          // UTC: 9:24 PM Local: 10:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 28, 19, 13, 0, true);          // UTC: 7:13 PM Local: 8:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 10, 4, 34, 0, true);           // UTC: 4:34 AM Local: 5:34 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 17, 8, 36, 0, true);           // UTC: 8:36 AM Local: 9:36 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 16, 6, 26, 0, true);           // UTC: 6:26 AM Local: 7:26 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 18, 3, 32, 0, true);           // UTC: 3:32 AM Local: 4:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 1, 19, 24, 0, true);           // UTC: 7:24 PM Local: 8:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 1, 17, 2, 0, true);            // UTC: 5:02 PM Local: 6:02 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 17, 12, 34, 0, true);          // UTC: 12:34 PM Local: 1:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 26, 18, 7, 0, true);           // UTC: 6:07 PM Local: 7:07 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 16, 2, 44, 0, true);           // UTC: 2:44 AM Local: 3:44 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 6, 2, 59, 0, true);            // UTC: 2:59 AM Local: 3:59 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 18, 14, 26, 0, true);          // UTC: 2:26 PM Local: 3:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 30, 12, 17, 0, true);          // UTC: 12:17 PM Local: 1:17 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 8, 15, 31, 0, true);           // UTC: 3:31 PM Local: 4:31 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 5, 10, 27, 0, true);           // UTC: 10:27 AM Local: 11:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 29, 15, 33, 0, true);          // UTC: 3:33 PM Local: 4:33 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 11, 3, 12, 0, true);           // UTC: 3:12 AM Local: 4:12 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 14, 19, 1, 0, true);           // UTC: 7:01 PM Local: 8:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 30, 8, 8, 0, true);            // UTC: 8:08 AM Local: 9:08 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 23, 0, 2, 0, true);            // UTC: 12:02 AM Local: 1:02 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 7, 4, 14, 0, true);            // UTC: 4:14 AM Local: 5:14 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 1, 21, 18, 0, true);           // UTC: 9:18 PM Local: 10:18 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 11, 23, 22, 0, true);          // UTC: 11:22 PM Local: 12:22 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 9, 8, 19, 31, 0, true);           // UTC: 7:31 PM Local: 8:31 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 4, 15, 46, 0, true);          // UTC: 3:46 PM Local: 4:46 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 19, 3, 54, 0, true);          // UTC: 3:54 AM Local: 4:54 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 17, 19, 16, 0, true);         // UTC: 7:16 PM Local: 8:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 23, 6, 44, 0, true);          // UTC: 6:44 AM Local: 7:44 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 17, 13, 1, 0, true);          // UTC: 1:01 PM Local: 2:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 13, 20, 26, 0, true);         // UTC: 8:26 PM Local: 9:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 27, 16, 39, 0, true);         // UTC: 4:39 PM Local: 5:39 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 6, 17, 13, 0, true);          // UTC: 5:13 PM Local: 6:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 28, 20, 34, 0, false);        // UTC: 8:34 PM Local: 8:34 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 21, 6, 33, 0, true);          // UTC: 6:33 AM Local: 7:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 7, 17, 39, 0, true);          // UTC: 5:39 PM Local: 6:39 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 19, 4, 14, 0, true);          // UTC: 4:14 AM Local: 5:14 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 30, 23, 40, 0, false);        // UTC: 11:40 PM Local: 11:40 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 26, 11, 57, 0, true);         // UTC: 11:57 AM Local: 12:57 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 6, 10, 38, 0, true);          // UTC: 10:38 AM Local: 11:38 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 11, 6, 13, 0, true);          // UTC: 6:13 AM Local: 7:13 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 25, 6, 56, 0, true);          // UTC: 6:56 AM Local: 7:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 4, 4, 56, 0, true);           // UTC: 4:56 AM Local: 5:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 8, 4, 46, 0, true);           // UTC: 4:46 AM Local: 5:46 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 3, 8, 24, 0, true);           // UTC: 8:24 AM Local: 9:24 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 4, 13, 53, 0, true);          // UTC: 1:53 PM Local: 2:53 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 31, 13, 34, 0, false);        // UTC: 1:34 PM Local: 1:34 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 26, 22, 8, 0, true);          // UTC: 10:08 PM Local: 11:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 7, 12, 40, 0, true);          // UTC: 12:40 PM Local: 1:40 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 10, 22, 0, 6, 0, true);           // UTC: 12:06 AM Local: 1:06 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 7, 18, 43, 0, false);         // UTC: 6:43 PM Local: 6:43 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 12, 11, 7, 0, false);         // UTC: 11:07 AM Local: 11:07 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 23, 16, 40, 0, false);        // UTC: 4:40 PM Local: 4:40 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 25, 10, 32, 0, false);        // UTC: 10:32 AM Local: 10:32 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 22, 6, 51, 0, false);         // UTC: 6:51 AM Local: 6:51 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 3, 15, 6, 0, false);          // UTC: 3:06 PM Local: 3:06 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 1, 1, 48, 0, false);          // UTC: 1:48 AM Local: 1:48 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 18, 19, 32, 0, false);        // UTC: 7:32 PM Local: 7:32 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 29, 18, 30, 0, false);        // UTC: 6:30 PM Local: 6:30 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 5, 6, 11, 0, false);          // UTC: 6:11 AM Local: 6:11 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 4, 6, 11, 0, false);          // UTC: 6:11 AM Local: 6:11 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 27, 5, 18, 0, false);         // UTC: 5:18 AM Local: 5:18 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 30, 21, 6, 0, false);         // UTC: 9:06 PM Local: 9:06 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 19, 1, 8, 0, false);          // UTC: 1:08 AM Local: 1:08 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 22, 14, 4, 0, false);         // UTC: 2:04 PM Local: 2:04 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 25, 3, 20, 0, false);         // UTC: 3:20 AM Local: 3:20 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 13, 14, 27, 0, false);        // UTC: 2:27 PM Local: 2:27 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 17, 11, 27, 0, false);        // UTC: 11:27 AM Local: 11:27 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 7, 19, 23, 0, false);         // UTC: 7:23 PM Local: 7:23 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 1, 20, 44, 0, false);         // UTC: 8:44 PM Local: 8:44 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 2, 6, 11, 0, false);          // UTC: 6:11 AM Local: 6:11 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 14, 14, 23, 0, false);        // UTC: 2:23 PM Local: 2:23 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 24, 11, 25, 0, false);        // UTC: 11:25 AM Local: 11:25 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 30, 6, 38, 0, false);         // UTC: 6:38 AM Local: 6:38 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 11, 6, 3, 32, 0, false);          // UTC: 3:32 AM Local: 3:32 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 26, 0, 20, 0, false);         // UTC: 12:20 AM Local: 12:20 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 29, 2, 51, 0, false);         // UTC: 2:51 AM Local: 2:51 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 27, 22, 56, 0, false);        // UTC: 10:56 PM Local: 10:56 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 28, 20, 25, 0, false);        // UTC: 8:25 PM Local: 8:25 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 19, 19, 12, 0, false);        // UTC: 7:12 PM Local: 7:12 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 17, 18, 21, 0, false);        // UTC: 6:21 PM Local: 6:21 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 26, 8, 17, 0, false);         // UTC: 8:17 AM Local: 8:17 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 30, 3, 47, 0, false);         // UTC: 3:47 AM Local: 3:47 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 24, 5, 52, 0, false);         // UTC: 5:52 AM Local: 5:52 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 30, 12, 8, 0, false);         // UTC: 12:08 PM Local: 12:08 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 29, 10, 56, 0, false);        // UTC: 10:56 AM Local: 10:56 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 18, 22, 23, 0, false);        // UTC: 10:23 PM Local: 10:23 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 25, 13, 48, 0, false);        // UTC: 1:48 PM Local: 1:48 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 6, 12, 13, 0, false);         // UTC: 12:13 PM Local: 12:13 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 24, 5, 4, 0, false);          // UTC: 5:04 AM Local: 5:04 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 26, 10, 19, 0, false);        // UTC: 10:19 AM Local: 10:19 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 16, 3, 0, 0, false);          // UTC: 3:00 AM Local: 3:00 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 29, 11, 40, 0, false);        // UTC: 11:40 AM Local: 11:40 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 29, 19, 3, 0, false);         // UTC: 7:03 PM Local: 7:03 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 8, 8, 42, 0, false);          // UTC: 8:42 AM Local: 8:42 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 10, 10, 13, 0, false);        // UTC: 10:13 AM Local: 10:13 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 22, 12, 36, 0, false);        // UTC: 12:36 PM Local: 12:36 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 6, 17, 4, 0, false);          // UTC: 5:04 PM Local: 5:04 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 13, 16, 31, 0, false);        // UTC: 4:31 PM Local: 4:31 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2018, 12, 21, 6, 44, 0, false);         // UTC: 6:44 AM Local: 6:44 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 4, 12, 36, 0, false);          // UTC: 12:36 PM Local: 12:36 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 1, 3, 39, 0, false);           // UTC: 3:39 AM Local: 3:39 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 4, 23, 15, 0, false);          // UTC: 11:15 PM Local: 11:15 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 9, 14, 25, 0, false);          // UTC: 2:25 PM Local: 2:25 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 17, 1, 48, 0, false);          // UTC: 1:48 AM Local: 1:48 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 7, 20, 24, 0, false);          // UTC: 8:24 PM Local: 8:24 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 1, 3, 16, 0, false);           // UTC: 3:16 AM Local: 3:16 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 9, 8, 57, 0, false);           // UTC: 8:57 AM Local: 8:57 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 11, 17, 34, 0, false);         // UTC: 5:34 PM Local: 5:34 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 17, 13, 33, 0, false);         // UTC: 1:33 PM Local: 1:33 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 19, 3, 40, 0, false);          // UTC: 3:40 AM Local: 3:40 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 15, 20, 4, 0, false);          // UTC: 8:04 PM Local: 8:04 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 18, 19, 42, 0, false);         // UTC: 7:42 PM Local: 7:42 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 25, 1, 24, 0, false);          // UTC: 1:24 AM Local: 1:24 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 30, 5, 24, 0, false);          // UTC: 5:24 AM Local: 5:24 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 16, 5, 54, 0, false);          // UTC: 5:54 AM Local: 5:54 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 16, 17, 39, 0, false);         // UTC: 5:39 PM Local: 5:39 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 20, 1, 27, 0, false);          // UTC: 1:27 AM Local: 1:27 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 31, 15, 26, 0, false);         // UTC: 3:26 PM Local: 3:26 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 10, 16, 25, 0, false);         // UTC: 4:25 PM Local: 4:25 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 20, 9, 23, 0, false);          // UTC: 9:23 AM Local: 9:23 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 17, 9, 30, 0, false);          // UTC: 9:30 AM Local: 9:30 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 21, 8, 35, 0, false);          // UTC: 8:35 AM Local: 8:35 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 30, 9, 42, 0, false);          // UTC: 9:42 AM Local: 9:42 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 1, 23, 23, 18, 0, false);         // UTC: 11:18 PM Local: 11:18 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 1, 0, 49, 0, false);           // UTC: 12:49 AM Local: 12:49 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 8, 18, 2, 0, false);           // UTC: 6:02 PM Local: 6:02 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 21, 5, 26, 0, false);          // UTC: 5:26 AM Local: 5:26 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 25, 21, 24, 0, false);         // UTC: 9:24 PM Local: 9:24 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 2, 10, 47, 0, false);          // UTC: 10:47 AM Local: 10:47 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 13, 1, 37, 0, false);          // UTC: 1:37 AM Local: 1:37 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 24, 10, 4, 0, false);          // UTC: 10:04 AM Local: 10:04 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 26, 7, 27, 0, false);          // UTC: 7:27 AM Local: 7:27 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 24, 15, 16, 0, false);         // UTC: 3:16 PM Local: 3:16 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 25, 7, 2, 0, false);           // UTC: 7:02 AM Local: 7:02 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 17, 3, 59, 0, false);          // UTC: 3:59 AM Local: 3:59 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 26, 23, 58, 0, false);         // UTC: 11:58 PM Local: 11:58 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 15, 4, 52, 0, false);          // UTC: 4:52 AM Local: 4:52 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 8, 19, 45, 0, false);          // UTC: 7:45 PM Local: 7:45 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 4, 1, 39, 0, false);           // UTC: 1:39 AM Local: 1:39 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 14, 14, 7, 0, false);          // UTC: 2:07 PM Local: 2:07 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 7, 1, 22, 0, false);           // UTC: 1:22 AM Local: 1:22 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 17, 4, 7, 0, false);           // UTC: 4:07 AM Local: 4:07 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 12, 14, 8, 0, false);          // UTC: 2:08 PM Local: 2:08 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 22, 13, 29, 0, false);         // UTC: 1:29 PM Local: 1:29 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 20, 8, 40, 0, false);          // UTC: 8:40 AM Local: 8:40 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 19, 21, 26, 0, false);         // UTC: 9:26 PM Local: 9:26 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 12, 23, 33, 0, false);         // UTC: 11:33 PM Local: 11:33 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 27, 4, 18, 0, false);          // UTC: 4:18 AM Local: 4:18 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 2, 24, 4, 15, 0, false);          // UTC: 4:15 AM Local: 4:15 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 16, 3, 32, 0, false);          // UTC: 3:32 AM Local: 3:32 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 29, 9, 50, 0, false);          // UTC: 9:50 AM Local: 9:50 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 17, 19, 54, 0, false);         // UTC: 7:54 PM Local: 7:54 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 12, 8, 17, 0, false);          // UTC: 8:17 AM Local: 8:17 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 20, 21, 46, 0, false);         // UTC: 9:46 PM Local: 9:46 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 19, 22, 37, 0, false);         // UTC: 10:37 PM Local: 10:37 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 7, 20, 17, 0, false);          // UTC: 8:17 PM Local: 8:17 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 25, 7, 12, 0, false);          // UTC: 7:12 AM Local: 7:12 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 31, 7, 32, 0, true);           // UTC: 7:32 AM Local: 8:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 21, 6, 56, 0, false);          // UTC: 6:56 AM Local: 6:56 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 22, 1, 40, 0, false);          // UTC: 1:40 AM Local: 1:40 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 2, 0, 17, 0, false);           // UTC: 12:17 AM Local: 12:17 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 9, 13, 1, 0, false);           // UTC: 1:01 PM Local: 1:01 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 20, 1, 6, 0, false);           // UTC: 1:06 AM Local: 1:06 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 8, 17, 17, 0, false);          // UTC: 5:17 PM Local: 5:17 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 3, 2, 58, 0, false);           // UTC: 2:58 AM Local: 2:58 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 22, 5, 35, 0, false);          // UTC: 5:35 AM Local: 5:35 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 8, 20, 23, 0, false);          // UTC: 8:23 PM Local: 8:23 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 16, 15, 22, 0, false);         // UTC: 3:22 PM Local: 3:22 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 7, 10, 21, 0, false);          // UTC: 10:21 AM Local: 10:21 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 16, 23, 8, 0, false);          // UTC: 11:08 PM Local: 11:08 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 27, 2, 51, 0, false);          // UTC: 2:51 AM Local: 2:51 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 4, 14, 51, 0, false);          // UTC: 2:51 PM Local: 2:51 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 27, 19, 53, 0, false);         // UTC: 7:53 PM Local: 7:53 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 3, 25, 6, 28, 0, false);          // UTC: 6:28 AM Local: 6:28 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 14, 23, 16, 0, true);          // UTC: 11:16 PM Local: 12:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 13, 4, 23, 0, true);           // UTC: 4:23 AM Local: 5:23 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 5, 20, 53, 0, true);           // UTC: 8:53 PM Local: 9:53 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 20, 10, 18, 0, true);          // UTC: 10:18 AM Local: 11:18 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 18, 23, 52, 0, true);          // UTC: 11:52 PM Local: 12:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 30, 5, 27, 0, true);           // UTC: 5:27 AM Local: 6:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 21, 11, 37, 0, true);          // UTC: 11:37 AM Local: 12:37 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 4, 14, 56, 0, true);           // UTC: 2:56 PM Local: 3:56 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 11, 2, 34, 0, true);           // UTC: 2:34 AM Local: 3:34 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 3, 13, 36, 0, true);           // UTC: 1:36 PM Local: 2:36 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 19, 15, 52, 0, true);          // UTC: 3:52 PM Local: 4:52 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 22, 14, 19, 0, true);          // UTC: 2:19 PM Local: 3:19 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 27, 0, 4, 0, true);            // UTC: 12:04 AM Local: 1:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 10, 6, 58, 0, true);           // UTC: 6:58 AM Local: 7:58 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 22, 19, 5, 0, true);           // UTC: 7:05 PM Local: 8:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 23, 9, 31, 0, true);           // UTC: 9:31 AM Local: 10:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 24, 22, 20, 0, true);          // UTC: 10:20 PM Local: 11:20 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 10, 4, 14, 0, true);           // UTC: 4:14 AM Local: 5:14 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 12, 21, 46, 0, true);          // UTC: 9:46 PM Local: 10:46 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 11, 11, 58, 0, true);          // UTC: 11:58 AM Local: 12:58 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 4, 10, 45, 0, true);           // UTC: 10:45 AM Local: 11:45 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 15, 18, 38, 0, true);          // UTC: 6:38 PM Local: 7:38 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 30, 21, 58, 0, true);          // UTC: 9:58 PM Local: 10:58 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 9, 14, 33, 0, true);           // UTC: 2:33 PM Local: 3:33 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 4, 26, 9, 29, 0, true);           // UTC: 9:29 AM Local: 10:29 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 11, 7, 25, 0, true);           // UTC: 7:25 AM Local: 8:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 31, 23, 57, 0, true);          // UTC: 11:57 PM Local: 12:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 17, 7, 5, 0, true);            // UTC: 7:05 AM Local: 8:05 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 12, 11, 1, 0, true);           // UTC: 11:01 AM Local: 12:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 12, 21, 25, 0, true);          // UTC: 9:25 PM Local: 10:25 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 19, 12, 50, 0, true);          // UTC: 12:50 PM Local: 1:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 7, 23, 36, 0, true);           // UTC: 11:36 PM Local: 12:36 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 12, 12, 34, 0, true);          // UTC: 12:34 PM Local: 1:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 5, 18, 36, 0, true);           // UTC: 6:36 PM Local: 7:36 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 6, 5, 5, 0, true);             // UTC: 5:05 AM Local: 6:05 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 25, 14, 56, 0, true);          // UTC: 2:56 PM Local: 3:56 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 28, 9, 51, 0, true);           // UTC: 9:51 AM Local: 10:51 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 1, 7, 33, 0, true);            // UTC: 7:33 AM Local: 8:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 2, 17, 10, 0, true);           // UTC: 5:10 PM Local: 6:10 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 19, 9, 1, 0, true);            // UTC: 9:01 AM Local: 10:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 21, 13, 4, 0, true);           // UTC: 1:04 PM Local: 2:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 19, 17, 19, 0, true);          // UTC: 5:19 PM Local: 6:19 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 26, 17, 5, 0, true);           // UTC: 5:05 PM Local: 6:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 11, 2, 17, 0, true);           // UTC: 2:17 AM Local: 3:17 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 24, 3, 57, 0, true);           // UTC: 3:57 AM Local: 4:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 11, 2, 1, 0, true);            // UTC: 2:01 AM Local: 3:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 21, 20, 9, 0, true);           // UTC: 8:09 PM Local: 9:09 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 4, 23, 52, 0, true);           // UTC: 11:52 PM Local: 12:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 21, 13, 15, 0, true);          // UTC: 1:15 PM Local: 2:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 5, 23, 7, 31, 0, true);           // UTC: 7:31 AM Local: 8:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 25, 16, 21, 0, true);          // UTC: 4:21 PM Local: 5:21 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 25, 14, 25, 0, true);          // UTC: 2:25 PM Local: 3:25 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 12, 10, 51, 0, true);          // UTC: 10:51 AM Local: 11:51 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 11, 21, 8, 0, true);           // UTC: 9:08 PM Local: 10:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 16, 15, 34, 0, true);          // UTC: 3:34 PM Local: 4:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 26, 23, 4, 0, true);           // UTC: 11:04 PM Local: 12:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 23, 19, 58, 0, true);          // UTC: 7:58 PM Local: 8:58 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 2, 13, 48, 0, true);           // UTC: 1:48 PM Local: 2:48 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 27, 21, 22, 0, true);          // UTC: 9:22 PM Local: 10:22 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 28, 0, 51, 0, true);           // UTC: 12:51 AM Local: 1:51 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 13, 2, 56, 0, true);           // UTC: 2:56 AM Local: 3:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 15, 17, 40, 0, true);          // UTC: 5:40 PM Local: 6:40 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 1, 16, 23, 0, true);           // UTC: 4:23 PM Local: 5:23 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 23, 0, 51, 0, true);           // UTC: 12:51 AM Local: 1:51 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 4, 13, 59, 0, true);           // UTC: 1:59 PM Local: 2:59 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 14, 4, 15, 0, true);           // UTC: 4:15 AM Local: 5:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 24, 5, 40, 0, true);           // UTC: 5:40 AM Local: 6:40 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 13, 21, 10, 0, true);          // UTC: 9:10 PM Local: 10:10 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 11, 6, 24, 0, true);           // UTC: 6:24 AM Local: 7:24 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 14, 16, 18, 0, true);          // UTC: 4:18 PM Local: 5:18 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 9, 1, 30, 0, true);            // UTC: 1:30 AM Local: 2:30 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 10, 23, 7, 0, true);           // UTC: 11:07 PM Local: 12:07 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 10, 20, 9, 0, true);           // UTC: 8:09 PM Local: 9:09 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 25, 5, 58, 0, true);           // UTC: 5:58 AM Local: 6:58 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 6, 2, 14, 1, 0, true);            // UTC: 2:01 PM Local: 3:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 19, 15, 58, 0, true);          // UTC: 3:58 PM Local: 4:58 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 26, 1, 20, 0, true);           // UTC: 1:20 AM Local: 2:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 4, 6, 11, 0, true);            // UTC: 6:11 AM Local: 7:11 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 12, 6, 37, 0, true);           // UTC: 6:37 AM Local: 7:37 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 8, 19, 45, 0, true);           // UTC: 7:45 PM Local: 8:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 16, 19, 32, 0, true);          // UTC: 7:32 PM Local: 8:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 8, 14, 11, 0, true);           // UTC: 2:11 PM Local: 3:11 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 29, 8, 25, 0, true);           // UTC: 8:25 AM Local: 9:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 6, 9, 40, 0, true);            // UTC: 9:40 AM Local: 10:40 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 18, 17, 30, 0, true);          // UTC: 5:30 PM Local: 6:30 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 28, 8, 31, 0, true);           // UTC: 8:31 AM Local: 9:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 29, 12, 58, 0, true);          // UTC: 12:58 PM Local: 1:58 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 31, 10, 42, 0, true);          // UTC: 10:42 AM Local: 11:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 18, 2, 30, 0, true);           // UTC: 2:30 AM Local: 3:30 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 28, 7, 25, 0, true);           // UTC: 7:25 AM Local: 8:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 2, 6, 8, 0, true);             // UTC: 6:08 AM Local: 7:08 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 26, 12, 33, 0, true);          // UTC: 12:33 PM Local: 1:33 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 26, 16, 49, 0, true);          // UTC: 4:49 PM Local: 5:49 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 9, 1, 42, 0, true);            // UTC: 1:42 AM Local: 2:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 30, 7, 57, 0, true);           // UTC: 7:57 AM Local: 8:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 1, 15, 57, 0, true);           // UTC: 3:57 PM Local: 4:57 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 12, 14, 50, 0, true);          // UTC: 2:50 PM Local: 3:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 8, 22, 26, 0, true);           // UTC: 10:26 PM Local: 11:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 20, 5, 26, 0, true);           // UTC: 5:26 AM Local: 6:26 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 7, 6, 10, 9, 0, true);            // UTC: 10:09 AM Local: 11:09 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 9, 16, 8, 0, true);            // UTC: 4:08 PM Local: 5:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 21, 23, 39, 0, true);          // UTC: 11:39 PM Local: 12:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 9, 16, 34, 0, true);           // UTC: 4:34 PM Local: 5:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 2, 4, 36, 0, true);            // UTC: 4:36 AM Local: 5:36 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 25, 5, 0, 0, true);            // UTC: 5:00 AM Local: 6:00 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 7, 4, 52, 0, true);            // UTC: 4:52 AM Local: 5:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 5, 2, 22, 0, true);            // UTC: 2:22 AM Local: 3:22 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 9, 19, 45, 0, true);           // UTC: 7:45 PM Local: 8:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 17, 3, 56, 0, true);           // UTC: 3:56 AM Local: 4:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 16, 22, 29, 0, true);          // UTC: 10:29 PM Local: 11:29 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 3, 23, 37, 0, true);           // UTC: 11:37 PM Local: 12:37 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 18, 16, 19, 0, true);          // UTC: 4:19 PM Local: 5:19 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 1, 6, 26, 0, true);            // UTC: 6:26 AM Local: 7:26 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 7, 21, 5, 0, true);            // UTC: 9:05 PM Local: 10:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 26, 14, 13, 0, true);          // UTC: 2:13 PM Local: 3:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 2, 17, 26, 0, true);           // UTC: 5:26 PM Local: 6:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 17, 15, 10, 0, true);          // UTC: 3:10 PM Local: 4:10 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 31, 9, 20, 0, true);           // UTC: 9:20 AM Local: 10:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 10, 12, 4, 0, true);           // UTC: 12:04 PM Local: 1:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 18, 9, 29, 0, true);           // UTC: 9:29 AM Local: 10:29 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 22, 22, 4, 0, true);           // UTC: 10:04 PM Local: 11:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 12, 2, 43, 0, true);           // UTC: 2:43 AM Local: 3:43 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 5, 3, 42, 0, true);            // UTC: 3:42 AM Local: 4:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 13, 21, 29, 0, true);          // UTC: 9:29 PM Local: 10:29 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 8, 24, 3, 41, 0, true);           // UTC: 3:41 AM Local: 4:41 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 15, 0, 55, 0, true);           // UTC: 12:55 AM Local: 1:55 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 13, 22, 45, 0, true);          // UTC: 10:45 PM Local: 11:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 16, 7, 18, 0, true);           // UTC: 7:18 AM Local: 8:18 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 19, 3, 29, 0, true);           // UTC: 3:29 AM Local: 4:29 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 25, 0, 54, 0, true);           // UTC: 12:54 AM Local: 1:54 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 28, 23, 13, 0, true);          // UTC: 11:13 PM Local: 12:13 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 29, 19, 9, 0, true);           // UTC: 7:09 PM Local: 8:09 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 10, 20, 24, 0, true);          // UTC: 8:24 PM Local: 9:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 30, 17, 47, 0, true);          // UTC: 5:47 PM Local: 6:47 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 10, 10, 48, 0, true);          // UTC: 10:48 AM Local: 11:48 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 13, 17, 42, 0, true);          // UTC: 5:42 PM Local: 6:42 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 3, 8, 12, 0, true);            // UTC: 8:12 AM Local: 9:12 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 7, 12, 46, 0, true);           // UTC: 12:46 PM Local: 1:46 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 4, 10, 19, 0, true);           // UTC: 10:19 AM Local: 11:19 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 9, 18, 30, 0, true);           // UTC: 6:30 PM Local: 7:30 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 24, 20, 21, 0, true);          // UTC: 8:21 PM Local: 9:21 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 15, 12, 5, 0, true);           // UTC: 12:05 PM Local: 1:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 4, 4, 39, 0, true);            // UTC: 4:39 AM Local: 5:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 4, 4, 43, 0, true);            // UTC: 4:43 AM Local: 5:43 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 21, 22, 11, 0, true);          // UTC: 10:11 PM Local: 11:11 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 6, 6, 25, 0, true);            // UTC: 6:25 AM Local: 7:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 2, 14, 37, 0, true);           // UTC: 2:37 PM Local: 3:37 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 23, 2, 6, 0, true);            // UTC: 2:06 AM Local: 3:06 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 8, 1, 10, 0, true);            // UTC: 1:10 AM Local: 2:10 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 9, 4, 13, 26, 0, true);           // UTC: 1:26 PM Local: 2:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 25, 2, 21, 0, true);          // UTC: 2:21 AM Local: 3:21 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 30, 13, 59, 0, false);        // UTC: 1:59 PM Local: 1:59 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 17, 4, 41, 0, true);          // UTC: 4:41 AM Local: 5:41 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 7, 4, 52, 0, true);           // UTC: 4:52 AM Local: 5:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 23, 12, 30, 0, true);         // UTC: 12:30 PM Local: 1:30 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 11, 13, 39, 0, true);         // UTC: 1:39 PM Local: 2:39 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 1, 23, 25, 0, true);          // UTC: 11:25 PM Local: 12:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 20, 22, 20, 0, true);         // UTC: 10:20 PM Local: 11:20 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 26, 7, 42, 0, true);          // UTC: 7:42 AM Local: 8:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 20, 16, 1, 0, true);          // UTC: 4:01 PM Local: 5:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 9, 10, 12, 0, true);          // UTC: 10:12 AM Local: 11:12 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 11, 9, 41, 0, true);          // UTC: 9:41 AM Local: 10:41 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 15, 3, 35, 0, true);          // UTC: 3:35 AM Local: 4:35 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 13, 6, 32, 0, true);          // UTC: 6:32 AM Local: 7:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 11, 9, 52, 0, true);          // UTC: 9:52 AM Local: 10:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 4, 19, 45, 0, true);          // UTC: 7:45 PM Local: 8:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 6, 8, 49, 0, true);           // UTC: 8:49 AM Local: 9:49 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 18, 9, 35, 0, true);          // UTC: 9:35 AM Local: 10:35 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 8, 11, 39, 0, true);          // UTC: 11:39 AM Local: 12:39 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 17, 16, 9, 0, true);          // UTC: 4:09 PM Local: 5:09 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 19, 22, 12, 0, true);         // UTC: 10:12 PM Local: 11:12 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 30, 16, 45, 0, false);        // UTC: 4:45 PM Local: 4:45 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 23, 6, 36, 0, true);          // UTC: 6:36 AM Local: 7:36 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 31, 0, 40, 0, false);         // UTC: 12:40 AM Local: 12:40 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 10, 22, 6, 49, 0, true);          // UTC: 6:49 AM Local: 7:49 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 3, 4, 15, 0, false);          // UTC: 4:15 AM Local: 4:15 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 16, 18, 26, 0, false);        // UTC: 6:26 PM Local: 6:26 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 23, 10, 21, 0, false);        // UTC: 10:21 AM Local: 10:21 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 3, 11, 17, 0, false);         // UTC: 11:17 AM Local: 11:17 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 15, 3, 28, 0, false);         // UTC: 3:28 AM Local: 3:28 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 24, 4, 15, 0, false);         // UTC: 4:15 AM Local: 4:15 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 29, 18, 34, 0, false);        // UTC: 6:34 PM Local: 6:34 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 18, 17, 4, 0, false);         // UTC: 5:04 PM Local: 5:04 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 18, 8, 10, 0, false);         // UTC: 8:10 AM Local: 8:10 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 30, 23, 57, 0, false);        // UTC: 11:57 PM Local: 11:57 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 27, 10, 38, 0, false);        // UTC: 10:38 AM Local: 10:38 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 5, 3, 59, 0, false);          // UTC: 3:59 AM Local: 3:59 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 27, 0, 18, 0, false);         // UTC: 12:18 AM Local: 12:18 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 22, 11, 15, 0, false);        // UTC: 11:15 AM Local: 11:15 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 25, 18, 23, 0, false);        // UTC: 6:23 PM Local: 6:23 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 27, 5, 11, 0, false);         // UTC: 5:11 AM Local: 5:11 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 20, 17, 51, 0, false);        // UTC: 5:51 PM Local: 5:51 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 3, 14, 2, 0, false);          // UTC: 2:02 PM Local: 2:02 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 13, 5, 50, 0, false);         // UTC: 5:50 AM Local: 5:50 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 30, 21, 8, 0, false);         // UTC: 9:08 PM Local: 9:08 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 10, 21, 54, 0, false);        // UTC: 9:54 PM Local: 9:54 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 24, 12, 39, 0, false);        // UTC: 12:39 PM Local: 12:39 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 19, 20, 51, 0, false);        // UTC: 8:51 PM Local: 8:51 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 25, 0, 10, 0, false);         // UTC: 12:10 AM Local: 12:10 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 11, 7, 13, 29, 0, false);         // UTC: 1:29 PM Local: 1:29 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 2, 4, 33, 0, false);          // UTC: 4:33 AM Local: 4:33 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 13, 3, 36, 0, false);         // UTC: 3:36 AM Local: 3:36 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 13, 5, 21, 0, false);         // UTC: 5:21 AM Local: 5:21 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 17, 4, 16, 0, false);         // UTC: 4:16 AM Local: 4:16 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 8, 18, 59, 0, false);         // UTC: 6:59 PM Local: 6:59 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 11, 1, 41, 0, false);         // UTC: 1:41 AM Local: 1:41 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 26, 1, 46, 0, false);         // UTC: 1:46 AM Local: 1:46 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 22, 4, 25, 0, false);         // UTC: 4:25 AM Local: 4:25 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 31, 15, 38, 0, false);        // UTC: 3:38 PM Local: 3:38 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 4, 15, 22, 0, false);         // UTC: 3:22 PM Local: 3:22 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 14, 19, 58, 0, false);        // UTC: 7:58 PM Local: 7:58 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 23, 18, 48, 0, false);        // UTC: 6:48 PM Local: 6:48 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 14, 9, 31, 0, false);         // UTC: 9:31 AM Local: 9:31 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 29, 14, 53, 0, false);        // UTC: 2:53 PM Local: 2:53 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 29, 22, 26, 0, false);        // UTC: 10:26 PM Local: 10:26 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 27, 13, 7, 0, false);         // UTC: 1:07 PM Local: 1:07 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 19, 3, 57, 0, false);         // UTC: 3:57 AM Local: 3:57 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 31, 16, 21, 0, false);        // UTC: 4:21 PM Local: 4:21 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 17, 16, 27, 0, false);        // UTC: 4:27 PM Local: 4:27 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 14, 0, 20, 0, false);         // UTC: 12:20 AM Local: 12:20 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 30, 1, 18, 0, false);         // UTC: 1:18 AM Local: 1:18 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 24, 19, 57, 0, false);        // UTC: 7:57 PM Local: 7:57 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 14, 23, 24, 0, false);        // UTC: 11:24 PM Local: 11:24 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 20, 10, 48, 0, false);        // UTC: 10:48 AM Local: 10:48 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2019, 12, 26, 9, 56, 0, false);         // UTC: 9:56 AM Local: 9:56 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 19, 2, 15, 0, false);          // UTC: 2:15 AM Local: 2:15 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 4, 14, 15, 0, false);          // UTC: 2:15 PM Local: 2:15 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 17, 12, 3, 0, false);          // UTC: 12:03 PM Local: 12:03 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 16, 22, 6, 0, false);          // UTC: 10:06 PM Local: 10:06 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 17, 7, 34, 0, false);          // UTC: 7:34 AM Local: 7:34 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 10, 21, 25, 0, false);         // UTC: 9:25 PM Local: 9:25 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 31, 7, 56, 0, false);          // UTC: 7:56 AM Local: 7:56 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 3, 23, 55, 0, false);          // UTC: 11:55 PM Local: 11:55 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 22, 11, 55, 0, false);         // UTC: 11:55 AM Local: 11:55 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 18, 13, 36, 0, false);         // UTC: 1:36 PM Local: 1:36 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 26, 5, 14, 0, false);          // UTC: 5:14 AM Local: 5:14 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 21, 23, 26, 0, false);         // UTC: 11:26 PM Local: 11:26 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 19, 3, 57, 0, false);          // UTC: 3:57 AM Local: 3:57 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 3, 3, 33, 0, false);           // UTC: 3:33 AM Local: 3:33 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 26, 4, 7, 0, false);           // UTC: 4:07 AM Local: 4:07 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 29, 17, 36, 0, false);         // UTC: 5:36 PM Local: 5:36 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 31, 14, 0, 0, false);          // UTC: 2:00 PM Local: 2:00 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 10, 7, 46, 0, false);          // UTC: 7:46 AM Local: 7:46 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 10, 0, 20, 0, false);          // UTC: 12:20 AM Local: 12:20 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 6, 2, 28, 0, false);           // UTC: 2:28 AM Local: 2:28 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 29, 14, 52, 0, false);         // UTC: 2:52 PM Local: 2:52 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 17, 12, 9, 0, false);          // UTC: 12:09 PM Local: 12:09 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 12, 22, 37, 0, false);         // UTC: 10:37 PM Local: 10:37 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 8, 1, 19, 0, false);           // UTC: 1:19 AM Local: 1:19 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 1, 1, 14, 57, 0, false);          // UTC: 2:57 PM Local: 2:57 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 11, 9, 20, 0, false);          // UTC: 9:20 AM Local: 9:20 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 16, 4, 59, 0, false);          // UTC: 4:59 AM Local: 4:59 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 25, 15, 56, 0, false);         // UTC: 3:56 PM Local: 3:56 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 7, 6, 18, 0, false);           // UTC: 6:18 AM Local: 6:18 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 28, 22, 57, 0, false);         // UTC: 10:57 PM Local: 10:57 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 2, 6, 20, 0, false);           // UTC: 6:20 AM Local: 6:20 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 27, 11, 57, 0, false);         // UTC: 11:57 AM Local: 11:57 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 16, 0, 11, 0, false);          // UTC: 12:11 AM Local: 12:11 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 21, 22, 35, 0, false);         // UTC: 10:35 PM Local: 10:35 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 7, 17, 40, 0, false);          // UTC: 5:40 PM Local: 5:40 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 8, 6, 56, 0, false);           // UTC: 6:56 AM Local: 6:56 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 2, 20, 6, 0, false);           // UTC: 8:06 PM Local: 8:06 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 10, 23, 52, 0, false);         // UTC: 11:52 PM Local: 11:52 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 11, 8, 55, 0, false);          // UTC: 8:55 AM Local: 8:55 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 14, 22, 56, 0, false);         // UTC: 10:56 PM Local: 10:56 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 5, 10, 44, 0, false);          // UTC: 10:44 AM Local: 10:44 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 25, 14, 26, 0, false);         // UTC: 2:26 PM Local: 2:26 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 3, 5, 14, 0, false);           // UTC: 5:14 AM Local: 5:14 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 28, 9, 7, 0, false);           // UTC: 9:07 AM Local: 9:07 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 23, 22, 12, 0, false);         // UTC: 10:12 PM Local: 10:12 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 9, 5, 46, 0, false);           // UTC: 5:46 AM Local: 5:46 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 8, 16, 42, 0, false);          // UTC: 4:42 PM Local: 4:42 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 10, 8, 23, 0, false);          // UTC: 8:23 AM Local: 8:23 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 26, 21, 33, 0, false);         // UTC: 9:33 PM Local: 9:33 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 2, 29, 3, 37, 0, false);          // UTC: 3:37 AM Local: 3:37 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 17, 7, 19, 0, false);          // UTC: 7:19 AM Local: 7:19 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 29, 5, 42, 0, true);           // UTC: 5:42 AM Local: 6:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 8, 8, 8, 0, false);            // UTC: 8:08 AM Local: 8:08 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 21, 21, 5, 0, false);          // UTC: 9:05 PM Local: 9:05 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 15, 2, 28, 0, false);          // UTC: 2:28 AM Local: 2:28 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 30, 16, 4, 0, true);           // UTC: 4:04 PM Local: 5:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 17, 1, 0, 0, false);           // UTC: 1:00 AM Local: 1:00 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 20, 18, 18, 0, false);         // UTC: 6:18 PM Local: 6:18 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 18, 8, 27, 0, false);          // UTC: 8:27 AM Local: 8:27 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 26, 18, 5, 0, false);          // UTC: 6:05 PM Local: 6:05 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 6, 9, 48, 0, false);           // UTC: 9:48 AM Local: 9:48 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 7, 7, 11, 0, false);           // UTC: 7:11 AM Local: 7:11 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 9, 23, 35, 0, false);          // UTC: 11:35 PM Local: 11:35 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 1, 5, 50, 0, false);           // UTC: 5:50 AM Local: 5:50 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 29, 4, 57, 0, true);           // UTC: 4:57 AM Local: 5:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 2, 19, 29, 0, false);          // UTC: 7:29 PM Local: 7:29 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 30, 18, 24, 0, true);          // UTC: 6:24 PM Local: 7:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 1, 15, 3, 0, false);           // UTC: 3:03 PM Local: 3:03 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 6, 2, 35, 0, false);           // UTC: 2:35 AM Local: 2:35 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 25, 20, 58, 0, false);         // UTC: 8:58 PM Local: 8:58 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 12, 10, 42, 0, false);         // UTC: 10:42 AM Local: 10:42 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 16, 1, 33, 0, false);          // UTC: 1:33 AM Local: 1:33 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 10, 16, 52, 0, false);         // UTC: 4:52 PM Local: 4:52 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 28, 20, 43, 0, false);         // UTC: 8:43 PM Local: 8:43 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 3, 17, 23, 34, 0, false);         // UTC: 11:34 PM Local: 11:34 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 6, 19, 49, 0, true);           // UTC: 7:49 PM Local: 8:49 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 25, 5, 7, 0, true);            // UTC: 5:07 AM Local: 6:07 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 20, 13, 15, 0, true);          // UTC: 1:15 PM Local: 2:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 22, 14, 35, 0, true);          // UTC: 2:35 PM Local: 3:35 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 25, 8, 50, 0, true);           // UTC: 8:50 AM Local: 9:50 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 23, 23, 15, 0, true);          // UTC: 11:15 PM Local: 12:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 9, 15, 34, 0, true);           // UTC: 3:34 PM Local: 4:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 8, 18, 38, 0, true);           // UTC: 6:38 PM Local: 7:38 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 16, 8, 2, 0, true);            // UTC: 8:02 AM Local: 9:02 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 7, 19, 45, 0, true);           // UTC: 7:45 PM Local: 8:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 2, 18, 28, 0, true);           // UTC: 6:28 PM Local: 7:28 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 28, 5, 20, 0, true);           // UTC: 5:20 AM Local: 6:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 5, 19, 1, 0, true);            // UTC: 7:01 PM Local: 8:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 20, 15, 51, 0, true);          // UTC: 3:51 PM Local: 4:51 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 14, 16, 28, 0, true);          // UTC: 4:28 PM Local: 5:28 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 24, 8, 54, 0, true);           // UTC: 8:54 AM Local: 9:54 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 26, 0, 4, 0, true);            // UTC: 12:04 AM Local: 1:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 4, 5, 36, 0, true);            // UTC: 5:36 AM Local: 6:36 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 21, 17, 37, 0, true);          // UTC: 5:37 PM Local: 6:37 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 26, 23, 15, 0, true);          // UTC: 11:15 PM Local: 12:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 20, 4, 3, 0, true);            // UTC: 4:03 AM Local: 5:03 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 10, 13, 2, 0, true);           // UTC: 1:02 PM Local: 2:02 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 23, 10, 52, 0, true);          // UTC: 10:52 AM Local: 11:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 20, 23, 33, 0, true);          // UTC: 11:33 PM Local: 12:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 4, 25, 8, 48, 0, true);           // UTC: 8:48 AM Local: 9:48 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 19, 15, 5, 0, true);           // UTC: 3:05 PM Local: 4:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 21, 16, 10, 0, true);          // UTC: 4:10 PM Local: 5:10 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 13, 8, 15, 0, true);           // UTC: 8:15 AM Local: 9:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 6, 15, 44, 0, true);           // UTC: 3:44 PM Local: 4:44 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 22, 19, 50, 0, true);          // UTC: 7:50 PM Local: 8:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 15, 1, 20, 0, true);           // UTC: 1:20 AM Local: 2:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 14, 14, 23, 0, true);          // UTC: 2:23 PM Local: 3:23 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 23, 6, 45, 0, true);           // UTC: 6:45 AM Local: 7:45 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 31, 1, 8, 0, true);            // UTC: 1:08 AM Local: 2:08 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 16, 19, 8, 0, true);           // UTC: 7:08 PM Local: 8:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 5, 23, 29, 0, true);           // UTC: 11:29 PM Local: 12:29 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 17, 23, 2, 0, true);           // UTC: 11:02 PM Local: 12:02 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 1, 7, 26, 0, true);            // UTC: 7:26 AM Local: 8:26 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 29, 16, 9, 0, true);           // UTC: 4:09 PM Local: 5:09 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 3, 12, 35, 0, true);           // UTC: 12:35 PM Local: 1:35 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 10, 15, 27, 0, true);          // UTC: 3:27 PM Local: 4:27 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 30, 2, 2, 0, true);            // UTC: 2:02 AM Local: 3:02 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 22, 22, 48, 0, true);          // UTC: 10:48 PM Local: 11:48 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 24, 19, 14, 0, true);          // UTC: 7:14 PM Local: 8:14 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 10, 8, 7, 0, true);            // UTC: 8:07 AM Local: 9:07 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 18, 7, 26, 0, true);           // UTC: 7:26 AM Local: 8:26 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 15, 2, 59, 0, true);           // UTC: 2:59 AM Local: 3:59 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 8, 11, 19, 0, true);           // UTC: 11:19 AM Local: 12:19 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 11, 19, 13, 0, true);          // UTC: 7:13 PM Local: 8:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 5, 2, 5, 25, 0, true);            // UTC: 5:25 AM Local: 6:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 19, 20, 3, 0, true);           // UTC: 8:03 PM Local: 9:03 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 24, 10, 36, 0, true);          // UTC: 10:36 AM Local: 11:36 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 23, 18, 59, 0, true);          // UTC: 6:59 PM Local: 7:59 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 29, 5, 29, 0, true);           // UTC: 5:29 AM Local: 6:29 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 28, 12, 59, 0, true);          // UTC: 12:59 PM Local: 1:59 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 27, 6, 24, 0, true);           // UTC: 6:24 AM Local: 7:24 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 13, 1, 13, 0, true);           // UTC: 1:13 AM Local: 2:13 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 14, 11, 15, 0, true);          // UTC: 11:15 AM Local: 12:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 6, 17, 51, 0, true);           // UTC: 5:51 PM Local: 6:51 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 6, 15, 13, 0, true);           // UTC: 3:13 PM Local: 4:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 13, 6, 38, 0, true);           // UTC: 6:38 AM Local: 7:38 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 15, 9, 30, 0, true);           // UTC: 9:30 AM Local: 10:30 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 15, 15, 40, 0, true);          // UTC: 3:40 PM Local: 4:40 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 22, 5, 55, 0, true);           // UTC: 5:55 AM Local: 6:55 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 16, 6, 34, 0, true);           // UTC: 6:34 AM Local: 7:34 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 13, 13, 4, 0, true);           // UTC: 1:04 PM Local: 2:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 2, 22, 17, 0, true);           // UTC: 10:17 PM Local: 11:17 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 12, 8, 39, 0, true);           // UTC: 8:39 AM Local: 9:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 1, 16, 11, 0, true);           // UTC: 4:11 PM Local: 5:11 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 24, 8, 32, 0, true);           // UTC: 8:32 AM Local: 9:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 13, 18, 59, 0, true);          // UTC: 6:59 PM Local: 7:59 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 21, 22, 13, 0, true);          // UTC: 10:13 PM Local: 11:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 9, 3, 23, 0, true);            // UTC: 3:23 AM Local: 4:23 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 2, 4, 46, 0, true);            // UTC: 4:46 AM Local: 5:46 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 6, 30, 11, 8, 0, true);           // UTC: 11:08 AM Local: 12:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 25, 7, 46, 0, true);           // UTC: 7:46 AM Local: 8:46 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 27, 3, 1, 0, true);            // UTC: 3:01 AM Local: 4:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 11, 12, 28, 0, true);          // UTC: 12:28 PM Local: 1:28 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 3, 12, 20, 0, true);           // UTC: 12:20 PM Local: 1:20 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 9, 16, 42, 0, true);           // UTC: 4:42 PM Local: 5:42 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 2, 9, 25, 0, true);            // UTC: 9:25 AM Local: 10:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 20, 7, 31, 0, true);           // UTC: 7:31 AM Local: 8:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 2, 6, 9, 0, true);             // UTC: 6:09 AM Local: 7:09 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 17, 19, 8, 0, true);           // UTC: 7:08 PM Local: 8:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 2, 6, 19, 0, true);            // UTC: 6:19 AM Local: 7:19 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 14, 13, 30, 0, true);          // UTC: 1:30 PM Local: 2:30 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 18, 22, 8, 0, true);           // UTC: 10:08 PM Local: 11:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 17, 22, 35, 0, true);          // UTC: 10:35 PM Local: 11:35 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 9, 10, 46, 0, true);           // UTC: 10:46 AM Local: 11:46 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 15, 21, 24, 0, true);          // UTC: 9:24 PM Local: 10:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 5, 6, 53, 0, true);            // UTC: 6:53 AM Local: 7:53 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 9, 17, 45, 0, true);           // UTC: 5:45 PM Local: 6:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 15, 12, 8, 0, true);           // UTC: 12:08 PM Local: 1:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 13, 16, 55, 0, true);          // UTC: 4:55 PM Local: 5:55 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 12, 7, 6, 0, true);            // UTC: 7:06 AM Local: 8:06 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 10, 11, 22, 0, true);          // UTC: 11:22 AM Local: 12:22 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 20, 6, 8, 0, true);            // UTC: 6:08 AM Local: 7:08 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 2, 0, 47, 0, true);            // UTC: 12:47 AM Local: 1:47 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 21, 15, 36, 0, true);          // UTC: 3:36 PM Local: 4:36 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 7, 1, 23, 19, 0, true);           // UTC: 11:19 PM Local: 12:19 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 22, 21, 4, 0, true);           // UTC: 9:04 PM Local: 10:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 30, 6, 35, 0, true);           // UTC: 6:35 AM Local: 7:35 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 23, 11, 42, 0, true);          // UTC: 11:42 AM Local: 12:42 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 4, 11, 15, 0, true);           // UTC: 11:15 AM Local: 12:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 26, 20, 16, 0, true);          // UTC: 8:16 PM Local: 9:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 3, 13, 7, 0, true);            // UTC: 1:07 PM Local: 2:07 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 13, 15, 3, 0, true);           // UTC: 3:03 PM Local: 4:03 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 16, 12, 59, 0, true);          // UTC: 12:59 PM Local: 1:59 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 11, 9, 31, 0, true);           // UTC: 9:31 AM Local: 10:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 23, 8, 14, 0, true);           // UTC: 8:14 AM Local: 9:14 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 6, 12, 12, 0, true);           // UTC: 12:12 PM Local: 1:12 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 16, 5, 22, 0, true);           // UTC: 5:22 AM Local: 6:22 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 22, 22, 15, 0, true);          // UTC: 10:15 PM Local: 11:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 17, 2, 47, 0, true);           // UTC: 2:47 AM Local: 3:47 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 11, 13, 51, 0, true);          // UTC: 1:51 PM Local: 2:51 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 5, 15, 37, 0, true);           // UTC: 3:37 PM Local: 4:37 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 9, 22, 54, 0, true);           // UTC: 10:54 PM Local: 11:54 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 18, 9, 44, 0, true);           // UTC: 9:44 AM Local: 10:44 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 30, 0, 57, 0, true);           // UTC: 12:57 AM Local: 1:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 13, 3, 23, 0, true);           // UTC: 3:23 AM Local: 4:23 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 30, 2, 58, 0, true);           // UTC: 2:58 AM Local: 3:58 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 13, 8, 3, 0, true);            // UTC: 8:03 AM Local: 9:03 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 13, 15, 54, 0, true);          // UTC: 3:54 PM Local: 4:54 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 19, 9, 30, 0, true);           // UTC: 9:30 AM Local: 10:30 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 8, 24, 10, 56, 0, true);          // UTC: 10:56 AM Local: 11:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 9, 2, 1, 0, true);             // UTC: 2:01 AM Local: 3:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 2, 11, 20, 0, true);           // UTC: 11:20 AM Local: 12:20 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 29, 11, 36, 0, true);          // UTC: 11:36 AM Local: 12:36 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 10, 8, 52, 0, true);           // UTC: 8:52 AM Local: 9:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 22, 5, 41, 0, true);           // UTC: 5:41 AM Local: 6:41 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 16, 12, 39, 0, true);          // UTC: 12:39 PM Local: 1:39 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 11, 11, 1, 0, true);           // UTC: 11:01 AM Local: 12:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 19, 22, 13, 0, true);          // UTC: 10:13 PM Local: 11:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 25, 2, 40, 0, true);           // UTC: 2:40 AM Local: 3:40 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 2, 19, 34, 0, true);           // UTC: 7:34 PM Local: 8:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 14, 19, 26, 0, true);          // UTC: 7:26 PM Local: 8:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 3, 8, 4, 0, true);             // UTC: 8:04 AM Local: 9:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 27, 14, 56, 0, true);          // UTC: 2:56 PM Local: 3:56 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 15, 12, 58, 0, true);          // UTC: 12:58 PM Local: 1:58 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 13, 1, 51, 0, true);           // UTC: 1:51 AM Local: 2:51 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 5, 21, 32, 0, true);           // UTC: 9:32 PM Local: 10:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 9, 9, 31, 0, true);            // UTC: 9:31 AM Local: 10:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 12, 15, 1, 0, true);           // UTC: 3:01 PM Local: 4:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 5, 19, 12, 0, true);           // UTC: 7:12 PM Local: 8:12 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 9, 7, 16, 0, true);            // UTC: 7:16 AM Local: 8:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 22, 7, 15, 0, true);           // UTC: 7:15 AM Local: 8:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 17, 0, 59, 0, true);           // UTC: 12:59 AM Local: 1:59 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 18, 12, 0, 0, true);           // UTC: 12:00 PM Local: 1:00 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 8, 17, 31, 0, true);           // UTC: 5:31 PM Local: 6:31 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 9, 28, 20, 48, 0, true);          // UTC: 8:48 PM Local: 9:48 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 18, 2, 39, 0, true);          // UTC: 2:39 AM Local: 3:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 27, 17, 56, 0, false);        // UTC: 5:56 PM Local: 5:56 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 27, 22, 50, 0, false);        // UTC: 10:50 PM Local: 10:50 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 11, 8, 22, 0, true);          // UTC: 8:22 AM Local: 9:22 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 4, 0, 20, 0, true);           // UTC: 12:20 AM Local: 1:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 26, 22, 13, 0, false);        // UTC: 10:13 PM Local: 10:13 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 23, 12, 43, 0, true);         // UTC: 12:43 PM Local: 1:43 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 6, 6, 52, 0, true);           // UTC: 6:52 AM Local: 7:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 6, 5, 21, 0, true);           // UTC: 5:21 AM Local: 6:21 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 20, 22, 31, 0, true);         // UTC: 10:31 PM Local: 11:31 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 26, 18, 18, 0, false);        // UTC: 6:18 PM Local: 6:18 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 12, 13, 18, 0, true);         // UTC: 1:18 PM Local: 2:18 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 12, 23, 42, 0, true);         // UTC: 11:42 PM Local: 12:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 18, 15, 15, 0, true);         // UTC: 3:15 PM Local: 4:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 21, 7, 23, 0, true);          // UTC: 7:23 AM Local: 8:23 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 11, 22, 11, 0, true);         // UTC: 10:11 PM Local: 11:11 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 30, 16, 47, 0, false);        // UTC: 4:47 PM Local: 4:47 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 5, 2, 4, 0, true);            // UTC: 2:04 AM Local: 3:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 27, 3, 56, 0, false);         // UTC: 3:56 AM Local: 3:56 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 23, 9, 7, 0, true);           // UTC: 9:07 AM Local: 10:07 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 28, 14, 32, 0, false);        // UTC: 2:32 PM Local: 2:32 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 25, 21, 30, 0, false);        // UTC: 9:30 PM Local: 9:30 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 2, 5, 39, 0, true);           // UTC: 5:39 AM Local: 6:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 28, 13, 55, 0, false);        // UTC: 1:55 PM Local: 1:55 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 10, 16, 1, 22, 0, true);          // UTC: 1:22 AM Local: 2:22 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 9, 12, 32, 0, false);         // UTC: 12:32 PM Local: 12:32 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 24, 22, 25, 0, false);        // UTC: 10:25 PM Local: 10:25 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 9, 22, 40, 0, false);         // UTC: 10:40 PM Local: 10:40 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 9, 11, 45, 0, false);         // UTC: 11:45 AM Local: 11:45 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 22, 10, 11, 0, false);        // UTC: 10:11 AM Local: 10:11 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 11, 6, 53, 0, false);         // UTC: 6:53 AM Local: 6:53 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 19, 4, 36, 0, false);         // UTC: 4:36 AM Local: 4:36 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 14, 20, 45, 0, false);        // UTC: 8:45 PM Local: 8:45 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 5, 19, 47, 0, false);         // UTC: 7:47 PM Local: 7:47 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 27, 8, 51, 0, false);         // UTC: 8:51 AM Local: 8:51 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 6, 4, 12, 0, false);          // UTC: 4:12 AM Local: 4:12 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 13, 19, 42, 0, false);        // UTC: 7:42 PM Local: 7:42 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 10, 7, 41, 0, false);         // UTC: 7:41 AM Local: 7:41 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 6, 0, 30, 0, false);          // UTC: 12:30 AM Local: 12:30 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 19, 22, 50, 0, false);        // UTC: 10:50 PM Local: 10:50 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 30, 4, 17, 0, false);         // UTC: 4:17 AM Local: 4:17 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 23, 8, 26, 0, false);         // UTC: 8:26 AM Local: 8:26 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 9, 20, 42, 0, false);         // UTC: 8:42 PM Local: 8:42 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 13, 12, 59, 0, false);        // UTC: 12:59 PM Local: 12:59 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 22, 4, 3, 0, false);          // UTC: 4:03 AM Local: 4:03 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 6, 22, 7, 0, false);          // UTC: 10:07 PM Local: 10:07 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 28, 1, 12, 0, false);         // UTC: 1:12 AM Local: 1:12 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 10, 11, 46, 0, false);        // UTC: 11:46 AM Local: 11:46 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 18, 3, 25, 0, false);         // UTC: 3:25 AM Local: 3:25 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 11, 11, 0, 53, 0, false);         // UTC: 12:53 AM Local: 12:53 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 18, 15, 10, 0, false);        // UTC: 3:10 PM Local: 3:10 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 12, 2, 19, 0, false);         // UTC: 2:19 AM Local: 2:19 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 15, 20, 18, 0, false);        // UTC: 8:18 PM Local: 8:18 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 8, 12, 46, 0, false);         // UTC: 12:46 PM Local: 12:46 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 20, 13, 48, 0, false);        // UTC: 1:48 PM Local: 1:48 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 5, 18, 24, 0, false);         // UTC: 6:24 PM Local: 6:24 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 22, 22, 13, 0, false);        // UTC: 10:13 PM Local: 10:13 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 18, 9, 51, 0, false);         // UTC: 9:51 AM Local: 9:51 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 28, 4, 28, 0, false);         // UTC: 4:28 AM Local: 4:28 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 6, 3, 35, 0, false);          // UTC: 3:35 AM Local: 3:35 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 30, 8, 56, 0, false);         // UTC: 8:56 AM Local: 8:56 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 16, 13, 7, 0, false);         // UTC: 1:07 PM Local: 1:07 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 5, 10, 56, 0, false);         // UTC: 10:56 AM Local: 10:56 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 1, 8, 36, 0, false);          // UTC: 8:36 AM Local: 8:36 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 19, 4, 17, 0, false);         // UTC: 4:17 AM Local: 4:17 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 21, 12, 17, 0, false);        // UTC: 12:17 PM Local: 12:17 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 11, 7, 5, 0, false);          // UTC: 7:05 AM Local: 7:05 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 16, 6, 23, 0, false);         // UTC: 6:23 AM Local: 6:23 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 18, 8, 35, 0, false);         // UTC: 8:35 AM Local: 8:35 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 2, 4, 4, 0, false);           // UTC: 4:04 AM Local: 4:04 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 1, 9, 42, 0, false);          // UTC: 9:42 AM Local: 9:42 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 3, 0, 11, 0, false);          // UTC: 12:11 AM Local: 12:11 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 11, 15, 8, 0, false);         // UTC: 3:08 PM Local: 3:08 PM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 26, 6, 55, 0, false);         // UTC: 6:55 AM Local: 6:55 AM Offset: 00:00:00
+	testCount++; failedCount += test(timeManager, 11, 2020, 12, 14, 15, 2, 0, false);         // UTC: 3:02 PM Local: 3:02 PM Offset: 00:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
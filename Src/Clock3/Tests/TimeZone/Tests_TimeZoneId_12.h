@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_12_H
+#define TEST_TIMEZONEID_12_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_12_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 16, 8, 42, 0, false);          // UTC: 8:42 AM Local: 9:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 17, 21, 22, 0, false);         // UTC: 9:22 PM Local: 10:22 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 5, 12, 0, 0, false);           // UTC: 12:00 PM Local: 1:00 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 12, 15, 17, 0, false);         // UTC: 3:17 PM Local: 4:17 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 21, 14, 44, 0, false);         // UTC: 2:44 PM Local: 3:44 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 28, 19, 14, 0, false);         // UTC: 7:14 PM Local: 8:14 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 18, 0, 42, 0, false);          // UTC: 12:42 AM Local: 1:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 20, 4, 28, 0, false);          // UTC: 4:28 AM Local: 5:28 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 12, 5, 21, 0, false);          // UTC: 5:21 AM Local: 6:21 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 29, 6, 3, 0, false);           // UTC: 6:03 AM Local: 7:03 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 19, 6, 4, 0, false);           // UTC: 6:04 AM Local: 7:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 17, 21, 52, 0, false);         // UTC: 9:52 PM Local: 10:52 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 11, 21, 25, 0, false);         // UTC: 9:25 PM Local: 10:25 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 26, 2, 1, 0, false);           // UTC: 2:01 AM Local: 3:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 30, 1, 52, 0, false);          // UTC: 1:52 AM Local: 2:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 30, 21, 32, 0, false);         // UTC: 9:32 PM Local: 10:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 8, 2, 27, 0, false);           // UTC: 2:27 AM Local: 3:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 31, 14, 7, 0, false);          // UTC: 2:07 PM Local: 3:07 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 22, 13, 8, 0, false);          // UTC: 1:08 PM Local: 2:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 18, 10, 56, 0, false);         // UTC: 10:56 AM Local: 11:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 20, 17, 10, 0, false);         // UTC: 5:10 PM Local: 6:10 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 23, 1, 35, 0, false);          // UTC: 1:35 AM Local: 2:35 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 6, 16, 52, 0, false);          // UTC: 4:52 PM Local: 5:52 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 3, 12, 38, 0, false);          // UTC: 12:38 PM Local: 1:38 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 1, 14, 21, 38, 0, false);         // UTC: 9:38 PM Local: 10:38 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 16, 15, 38, 0, false);         // UTC: 3:38 PM Local: 4:38 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 13, 17, 1, 0, false);          // UTC: 5:01 PM Local: 6:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 21, 23, 5, 0, false);          // UTC: 11:05 PM Local: 12:05 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 7, 21, 16, 0, false);          // UTC: 9:16 PM Local: 10:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 12, 11, 55, 0, false);         // UTC: 11:55 AM Local: 12:55 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 23, 12, 43, 0, false);         // UTC: 12:43 PM Local: 1:43 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 10, 3, 16, 0, false);          // UTC: 3:16 AM Local: 4:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 8, 10, 23, 0, false);          // UTC: 10:23 AM Local: 11:23 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 12, 16, 36, 0, false);         // UTC: 4:36 PM Local: 5:36 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 26, 16, 11, 0, false);         // UTC: 4:11 PM Local: 5:11 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 1, 12, 52, 0, false);          // UTC: 12:52 PM Local: 1:52 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 28, 13, 2, 0, false);          // UTC: 1:02 PM Local: 2:02 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 17, 0, 14, 0, false);          // UTC: 12:14 AM Local: 1:14 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 22, 13, 2, 0, false);          // UTC: 1:02 PM Local: 2:02 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 13, 6, 49, 0, false);          // UTC: 6:49 AM Local: 7:49 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 20, 3, 48, 0, false);          // UTC: 3:48 AM Local: 4:48 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 18, 7, 11, 0, false);          // UTC: 7:11 AM Local: 8:11 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 3, 22, 17, 0, false);          // UTC: 10:17 PM Local: 11:17 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 2, 13, 17, 0, false);          // UTC: 1:17 PM Local: 2:17 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 16, 11, 38, 0, false);         // UTC: 11:38 AM Local: 12:38 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 21, 23, 3, 0, false);          // UTC: 11:03 PM Local: 12:03 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 17, 14, 23, 0, false);         // UTC: 2:23 PM Local: 3:23 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 7, 10, 18, 0, false);          // UTC: 10:18 AM Local: 11:18 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 15, 15, 44, 0, false);         // UTC: 3:44 PM Local: 4:44 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 2, 28, 15, 15, 0, false);         // UTC: 3:15 PM Local: 4:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 31, 5, 29, 0, true);           // UTC: 5:29 AM Local: 7:29 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 30, 17, 23, 0, true);          // UTC: 5:23 PM Local: 7:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 6, 6, 49, 0, false);           // UTC: 6:49 AM Local: 7:49 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 24, 7, 58, 0, false);          // UTC: 7:58 AM Local: 8:58 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 20, 0, 17, 0, false);          // UTC: 12:17 AM Local: 1:17 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 30, 10, 11, 0, true);          // UTC: 10:11 AM Local: 12:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 8, 0, 32, 0, false);           // UTC: 12:32 AM Local: 1:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 2, 7, 39, 0, false);           // UTC: 7:39 AM Local: 8:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 4, 11, 34, 0, false);          // UTC: 11:34 AM Local: 12:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 17, 4, 1, 0, false);           // UTC: 4:01 AM Local: 5:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 30, 10, 56, 0, true);          // UTC: 10:56 AM Local: 12:56 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 26, 21, 53, 0, true);          // UTC: 9:53 PM Local: 11:53 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 9, 20, 7, 0, false);           // UTC: 8:07 PM Local: 9:07 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 8, 16, 32, 0, false);          // UTC: 4:32 PM Local: 5:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 16, 15, 40, 0, false);         // UTC: 3:40 PM Local: 4:40 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 12, 8, 43, 0, false);          // UTC: 8:43 AM Local: 9:43 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 31, 14, 57, 0, true);          // UTC: 2:57 PM Local: 4:57 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 24, 5, 28, 0, false);          // UTC: 5:28 AM Local: 6:28 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 10, 19, 55, 0, false);         // UTC: 7:55 PM Local: 8:55 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 2, 8, 21, 0, false);           // UTC: 8:21 AM Local: 9:21 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 31, 16, 40, 0, true);          // UTC: 4:40 PM Local: 6:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 23, 14, 45, 0, false);         // UTC: 2:45 PM Local: 3:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 26, 6, 46, 0, true);           // UTC: 6:46 AM Local: 8:46 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 10, 16, 16, 0, false);         // UTC: 4:16 PM Local: 5:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 3, 1, 21, 0, 0, false);           // UTC: 9:00 PM Local: 10:00 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 23, 0, 8, 0, true);            // UTC: 12:08 AM Local: 2:08 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 18, 8, 26, 0, true);           // UTC: 8:26 AM Local: 10:26 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 5, 7, 12, 0, true);            // UTC: 7:12 AM Local: 9:12 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 14, 15, 3, 0, true);           // UTC: 3:03 PM Local: 5:03 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 18, 18, 39, 0, true);          // UTC: 6:39 PM Local: 8:39 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 24, 8, 48, 0, true);           // UTC: 8:48 AM Local: 10:48 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 2, 13, 27, 0, true);           // UTC: 1:27 PM Local: 3:27 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 19, 2, 57, 0, true);           // UTC: 2:57 AM Local: 4:57 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 13, 6, 37, 0, true);           // UTC: 6:37 AM Local: 8:37 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 18, 11, 23, 0, true);          // UTC: 11:23 AM Local: 1:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 21, 23, 24, 0, true);          // UTC: 11:24 PM Local: 1:24 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 19, 5, 1, 0, true);            // UTC: 5:01 AM Local: 7:01 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 23, 22, 9, 0, true);           // UTC: 10:09 PM Local: 12:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 29, 0, 51, 0, true);           // UTC: 12:51 AM Local: 2:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 2, 2, 58, 0, true);            // UTC: 2:58 AM Local: 4:58 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 14, 17, 12, 0, true);          // UTC: 5:12 PM Local: 7:12 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 26, 12, 50, 0, true);          // UTC: 12:50 PM Local: 2:50 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 4, 22, 22, 0, true);           // UTC: 10:22 PM Local: 12:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 7, 9, 17, 0, true);            // UTC: 9:17 AM Local: 11:17 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 30, 22, 43, 0, true);          // UTC: 10:43 PM Local: 12:43 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 18, 15, 39, 0, true);          // UTC: 3:39 PM Local: 5:39 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 20, 3, 13, 0, true);           // UTC: 3:13 AM Local: 5:13 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 18, 19, 44, 0, true);          // UTC: 7:44 PM Local: 9:44 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 22, 12, 37, 0, true);          // UTC: 12:37 PM Local: 2:37 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 4, 8, 2, 26, 0, true);            // UTC: 2:26 AM Local: 4:26 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 12, 10, 5, 0, true);           // UTC: 10:05 AM Local: 12:05 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 22, 10, 9, 0, true);           // UTC: 10:09 AM Local: 12:09 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 22, 2, 46, 0, true);           // UTC: 2:46 AM Local: 4:46 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 10, 9, 44, 0, true);           // UTC: 9:44 AM Local: 11:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 6, 21, 42, 0, true);           // UTC: 9:42 PM Local: 11:42 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 21, 13, 23, 0, true);          // UTC: 1:23 PM Local: 3:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 6, 0, 13, 0, true);            // UTC: 12:13 AM Local: 2:13 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 16, 19, 28, 0, true);          // UTC: 7:28 PM Local: 9:28 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 16, 5, 3, 0, true);            // UTC: 5:03 AM Local: 7:03 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 22, 19, 21, 0, true);          // UTC: 7:21 PM Local: 9:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 15, 7, 56, 0, true);           // UTC: 7:56 AM Local: 9:56 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 11, 3, 14, 0, true);           // UTC: 3:14 AM Local: 5:14 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 1, 11, 23, 0, true);           // UTC: 11:23 AM Local: 1:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 9, 6, 44, 0, true);            // UTC: 6:44 AM Local: 8:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 14, 9, 14, 0, true);           // UTC: 9:14 AM Local: 11:14 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 17, 4, 32, 0, true);           // UTC: 4:32 AM Local: 6:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 29, 22, 21, 0, true);          // UTC: 10:21 PM Local: 12:21 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 6, 16, 29, 0, true);           // UTC: 4:29 PM Local: 6:29 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 13, 19, 32, 0, true);          // UTC: 7:32 PM Local: 9:32 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 27, 22, 15, 0, true);          // UTC: 10:15 PM Local: 12:15 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 15, 14, 50, 0, true);          // UTC: 2:50 PM Local: 4:50 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 28, 1, 53, 0, true);           // UTC: 1:53 AM Local: 3:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 25, 7, 26, 0, true);           // UTC: 7:26 AM Local: 9:26 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 18, 22, 48, 0, true);          // UTC: 10:48 PM Local: 12:48 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 5, 26, 12, 33, 0, true);          // UTC: 12:33 PM Local: 2:33 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 22, 14, 42, 0, true);          // UTC: 2:42 PM Local: 4:42 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 2, 3, 35, 0, true);            // UTC: 3:35 AM Local: 5:35 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 19, 21, 19, 0, true);          // UTC: 9:19 PM Local: 11:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 12, 23, 1, 0, true);           // UTC: 11:01 PM Local: 1:01 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 11, 15, 57, 0, true);          // UTC: 3:57 PM Local: 5:57 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 12, 20, 19, 0, true);          // UTC: 8:19 PM Local: 10:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 6, 4, 30, 0, true);            // UTC: 4:30 AM Local: 6:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 8, 17, 8, 0, true);            // UTC: 5:08 PM Local: 7:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 9, 15, 2, 0, true);            // UTC: 3:02 PM Local: 5:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 14, 11, 18, 0, true);          // UTC: 11:18 AM Local: 1:18 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 14, 20, 38, 0, true);          // UTC: 8:38 PM Local: 10:38 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 10, 12, 52, 0, true);          // UTC: 12:52 PM Local: 2:52 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 28, 19, 20, 0, true);          // UTC: 7:20 PM Local: 9:20 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 5, 4, 16, 0, true);            // UTC: 4:16 AM Local: 6:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 21, 1, 53, 0, true);           // UTC: 1:53 AM Local: 3:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 22, 19, 50, 0, true);          // UTC: 7:50 PM Local: 9:50 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 26, 12, 26, 0, true);          // UTC: 12:26 PM Local: 2:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 14, 19, 42, 0, true);          // UTC: 7:42 PM Local: 9:42 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 9, 10, 26, 0, true);           // UTC: 10:26 AM Local: 12:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 25, 12, 31, 0, true);          // UTC: 12:31 PM Local: 2:31 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 13, 12, 52, 0, true);          // UTC: 12:52 PM Local: 2:52 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 26, 5, 10, 0, true);           // UTC: 5:10 AM Local: 7:10 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 26, 6, 53, 0, true);           // UTC: 6:53 AM Local: 8:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 9, 3, 17, 0, true);            // UTC: 3:17 AM Local: 5:17 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 6, 17, 1, 55, 0, true);           // UTC: 1:55 AM Local: 3:55 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 27, 20, 55, 0, true);          // UTC: 8:55 PM Local: 10:55 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 24, 22, 22, 0, true);          // UTC: 10:22 PM Local: 12:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 24, 9, 49, 0, true);           // UTC: 9:49 AM Local: 11:49 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 5, 9, 53, 0, true);            // UTC: 9:53 AM Local: 11:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 28, 6, 47, 0, true);           // UTC: 6:47 AM Local: 8:47 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 29, 0, 35, 0, true);           // UTC: 12:35 AM Local: 2:35 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 10, 1, 0, 0, true);            // UTC: 1:00 AM Local: 3:00 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 26, 5, 12, 0, true);           // UTC: 5:12 AM Local: 7:12 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 6, 6, 45, 0, true);            // UTC: 6:45 AM Local: 8:45 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 26, 9, 59, 0, true);           // UTC: 9:59 AM Local: 11:59 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 7, 5, 49, 0, true);            // UTC: 5:49 AM Local: 7:49 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 10, 17, 55, 0, true);          // UTC: 5:55 PM Local: 7:55 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 1, 19, 58, 0, true);           // UTC: 7:58 PM Local: 9:58 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 4, 11, 43, 0, true);           // UTC: 11:43 AM Local: 1:43 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 16, 17, 12, 0, true);          // UTC: 5:12 PM Local: 7:12 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 15, 3, 33, 0, true);           // UTC: 3:33 AM Local: 5:33 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 1, 20, 8, 0, true);            // UTC: 8:08 PM Local: 10:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 26, 12, 32, 0, true);          // UTC: 12:32 PM Local: 2:32 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 16, 20, 18, 0, true);          // UTC: 8:18 PM Local: 10:18 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 15, 11, 40, 0, true);          // UTC: 11:40 AM Local: 1:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 27, 12, 54, 0, true);          // UTC: 12:54 PM Local: 2:54 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 14, 16, 1, 0, true);           // UTC: 4:01 PM Local: 6:01 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 23, 8, 1, 0, true);            // UTC: 8:01 AM Local: 10:01 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 30, 4, 31, 0, true);           // UTC: 4:31 AM Local: 6:31 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 7, 25, 11, 44, 0, true);          // UTC: 11:44 AM Local: 1:44 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 4, 21, 50, 0, true);           // UTC: 9:50 PM Local: 11:50 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 14, 17, 25, 0, true);          // UTC: 5:25 PM Local: 7:25 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 31, 19, 23, 0, true);          // UTC: 7:23 PM Local: 9:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 25, 2, 53, 0, true);           // UTC: 2:53 AM Local: 4:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 30, 4, 22, 0, true);           // UTC: 4:22 AM Local: 6:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 2, 7, 6, 0, true);             // UTC: 7:06 AM Local: 9:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 14, 2, 51, 0, true);           // UTC: 2:51 AM Local: 4:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 2, 0, 59, 0, true);            // UTC: 12:59 AM Local: 2:59 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 8, 0, 7, 0, true);             // UTC: 12:07 AM Local: 2:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 22, 21, 36, 0, true);          // UTC: 9:36 PM Local: 11:36 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 20, 23, 41, 0, true);          // UTC: 11:41 PM Local: 1:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 24, 0, 37, 0, true);           // UTC: 12:37 AM Local: 2:37 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 8, 18, 59, 0, true);           // UTC: 6:59 PM Local: 8:59 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 26, 15, 40, 0, true);          // UTC: 3:40 PM Local: 5:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 7, 14, 48, 0, true);           // UTC: 2:48 PM Local: 4:48 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 11, 13, 41, 0, true);          // UTC: 1:41 PM Local: 3:41 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 18, 10, 51, 0, true);          // UTC: 10:51 AM Local: 12:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 8, 12, 5, 0, true);            // UTC: 12:05 PM Local: 2:05 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 21, 19, 21, 0, true);          // UTC: 7:21 PM Local: 9:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 31, 1, 50, 0, true);           // UTC: 1:50 AM Local: 3:50 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 25, 21, 59, 0, true);          // UTC: 9:59 PM Local: 11:59 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 12, 4, 19, 0, true);           // UTC: 4:19 AM Local: 6:19 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 4, 15, 38, 0, true);           // UTC: 3:38 PM Local: 5:38 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 5, 21, 17, 0, true);           // UTC: 9:17 PM Local: 11:17 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 8, 1, 6, 14, 0, true);            // UTC: 6:14 AM Local: 8:14 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 4, 15, 27, 0, true);           // UTC: 3:27 PM Local: 5:27 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 24, 10, 52, 0, true);          // UTC: 10:52 AM Local: 12:52 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 13, 10, 21, 0, true);          // UTC: 10:21 AM Local: 12:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 20, 12, 48, 0, true);          // UTC: 12:48 PM Local: 2:48 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 28, 15, 21, 0, true);          // UTC: 3:21 PM Local: 5:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 7, 19, 40, 0, true);           // UTC: 7:40 PM Local: 9:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 18, 19, 23, 0, true);          // UTC: 7:23 PM Local: 9:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 3, 7, 21, 0, true);            // UTC: 7:21 AM Local: 9:21 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 13, 8, 39, 0, true);           // UTC: 8:39 AM Local: 10:39 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 19, 4, 53, 0, true);           // UTC: 4:53 AM Local: 6:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 18, 21, 28, 0, true);          // UTC: 9:28 PM Local: 11:28 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 24, 8, 16, 0, true);           // UTC: 8:16 AM Local: 10:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 11, 13, 6, 0, true);           // UTC: 1:06 PM Local: 3:06 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 4, 23, 37, 0, true);           // UTC: 11:37 PM Local: 1:37 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 21, 15, 11, 0, true);          // UTC: 3:11 PM Local: 5:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 12, 17, 9, 0, true);           // UTC: 5:09 PM Local: 7:09 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 20, 19, 36, 0, true);          // UTC: 7:36 PM Local: 9:36 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 9, 12, 21, 0, true);           // UTC: 12:21 PM Local: 2:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 10, 11, 22, 0, true);          // UTC: 11:22 AM Local: 1:22 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 30, 10, 32, 0, true);          // UTC: 10:32 AM Local: 12:32 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 20, 14, 4, 0, true);           // UTC: 2:04 PM Local: 4:04 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 6, 19, 25, 0, true);           // UTC: 7:25 PM Local: 9:25 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 29, 6, 20, 0, true);           // UTC: 6:20 AM Local: 8:20 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 20, 11, 39, 0, true);          // UTC: 11:39 AM Local: 1:39 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 9, 12, 4, 18, 0, true);           // UTC: 4:18 AM Local: 6:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 11, 10, 42, 0, true);         // UTC: 10:42 AM Local: 12:42 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 21, 12, 2, 0, true);          // UTC: 12:02 PM Local: 2:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 17, 10, 41, 0, true);         // UTC: 10:41 AM Local: 12:41 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 18, 2, 53, 0, true);          // UTC: 2:53 AM Local: 4:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 22, 16, 6, 0, true);          // UTC: 4:06 PM Local: 6:06 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 28, 8, 10, 0, false);         // UTC: 8:10 AM Local: 9:10 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 26, 15, 5, 0, true);          // UTC: 3:05 PM Local: 5:05 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 22, 9, 10, 0, true);          // UTC: 9:10 AM Local: 11:10 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 26, 14, 14, 0, true);         // UTC: 2:14 PM Local: 4:14 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 10, 2, 53, 0, true);          // UTC: 2:53 AM Local: 4:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 23, 7, 12, 0, true);          // UTC: 7:12 AM Local: 9:12 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 7, 8, 40, 0, true);           // UTC: 8:40 AM Local: 10:40 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 4, 20, 13, 0, true);          // UTC: 8:13 PM Local: 10:13 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 19, 5, 30, 0, true);          // UTC: 5:30 AM Local: 7:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 24, 9, 29, 0, true);          // UTC: 9:29 AM Local: 11:29 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 5, 15, 25, 0, true);          // UTC: 3:25 PM Local: 5:25 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 15, 14, 24, 0, true);         // UTC: 2:24 PM Local: 4:24 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 12, 8, 45, 0, true);          // UTC: 8:45 AM Local: 10:45 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 29, 6, 15, 0, false);         // UTC: 6:15 AM Local: 7:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 19, 16, 50, 0, true);         // UTC: 4:50 PM Local: 6:50 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 24, 15, 32, 0, true);         // UTC: 3:32 PM Local: 5:32 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 22, 21, 45, 0, true);         // UTC: 9:45 PM Local: 11:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 20, 22, 21, 0, true);         // UTC: 10:21 PM Local: 12:21 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 12, 12, 19, 0, true);         // UTC: 12:19 PM Local: 2:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 10, 5, 0, 4, 0, true);            // UTC: 12:04 AM Local: 2:04 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 29, 21, 50, 0, false);        // UTC: 9:50 PM Local: 10:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 10, 12, 43, 0, false);        // UTC: 12:43 PM Local: 1:43 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 10, 15, 9, 0, false);         // UTC: 3:09 PM Local: 4:09 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 23, 16, 26, 0, false);        // UTC: 4:26 PM Local: 5:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 19, 10, 11, 0, false);        // UTC: 10:11 AM Local: 11:11 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 9, 13, 26, 0, false);         // UTC: 1:26 PM Local: 2:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 27, 1, 9, 0, false);          // UTC: 1:09 AM Local: 2:09 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 2, 14, 7, 0, false);          // UTC: 2:07 PM Local: 3:07 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 17, 9, 15, 0, false);         // UTC: 9:15 AM Local: 10:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 6, 6, 7, 0, false);           // UTC: 6:07 AM Local: 7:07 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 25, 17, 24, 0, false);        // UTC: 5:24 PM Local: 6:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 17, 15, 19, 0, false);        // UTC: 3:19 PM Local: 4:19 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 20, 2, 59, 0, false);         // UTC: 2:59 AM Local: 3:59 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 7, 4, 53, 0, false);          // UTC: 4:53 AM Local: 5:53 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 8, 12, 55, 0, false);         // UTC: 12:55 PM Local: 1:55 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 17, 8, 59, 0, false);         // UTC: 8:59 AM Local: 9:59 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 17, 11, 50, 0, false);        // UTC: 11:50 AM Local: 12:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 7, 4, 58, 0, false);          // UTC: 4:58 AM Local: 5:58 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 7, 17, 6, 0, false);          // UTC: 5:06 PM Local: 6:06 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 26, 7, 16, 0, false);         // UTC: 7:16 AM Local: 8:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 2, 17, 34, 0, false);         // UTC: 5:34 PM Local: 6:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 30, 14, 6, 0, false);         // UTC: 2:06 PM Local: 3:06 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 16, 19, 33, 0, false);        // UTC: 7:33 PM Local: 8:33 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 6, 18, 53, 0, false);         // UTC: 6:53 PM Local: 7:53 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 11, 28, 20, 3, 0, false);         // UTC: 8:03 PM Local: 9:03 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 14, 9, 1, 0, false);          // UTC: 9:01 AM Local: 10:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 16, 12, 22, 0, false);        // UTC: 12:22 PM Local: 1:22 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 27, 12, 5, 0, false);         // UTC: 12:05 PM Local: 1:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 3, 17, 58, 0, false);         // UTC: 5:58 PM Local: 6:58 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 30, 16, 29, 0, false);        // UTC: 4:29 PM Local: 5:29 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 18, 17, 25, 0, false);        // UTC: 5:25 PM Local: 6:25 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 18, 0, 54, 0, false);         // UTC: 12:54 AM Local: 1:54 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 17, 11, 26, 0, false);        // UTC: 11:26 AM Local: 12:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 29, 4, 1, 0, false);          // UTC: 4:01 AM Local: 5:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 11, 2, 33, 0, false);         // UTC: 2:33 AM Local: 3:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 22, 19, 17, 0, false);        // UTC: 7:17 PM Local: 8:17 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 10, 7, 19, 0, false);         // UTC: 7:19 AM Local: 8:19 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 14, 8, 51, 0, false);         // UTC: 8:51 AM Local: 9:51 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 17, 23, 25, 0, false);        // UTC: 11:25 PM Local: 12:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 17, 2, 49, 0, false);         // UTC: 2:49 AM Local: 3:49 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 22, 21, 2, 0, false);         // UTC: 9:02 PM Local: 10:02 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 28, 9, 41, 0, false);         // UTC: 9:41 AM Local: 10:41 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 31, 11, 44, 0, false);        // UTC: 11:44 AM Local: 12:44 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 10, 11, 5, 0, false);         // UTC: 11:05 AM Local: 12:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 21, 3, 52, 0, false);         // UTC: 3:52 AM Local: 4:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 2, 3, 51, 0, false);          // UTC: 3:51 AM Local: 4:51 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 5, 2, 38, 0, false);          // UTC: 2:38 AM Local: 3:38 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 5, 4, 50, 0, false);          // UTC: 4:50 AM Local: 5:50 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 31, 16, 34, 0, false);        // UTC: 4:34 PM Local: 5:34 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2018, 12, 6, 5, 35, 0, false);          // UTC: 5:35 AM Local: 6:35 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 27, 11, 14, 0, false);         // UTC: 11:14 AM Local: 12:14 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 27, 12, 1, 0, false);          // UTC: 12:01 PM Local: 1:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 22, 4, 18, 0, false);          // UTC: 4:18 AM Local: 5:18 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 15, 18, 29, 0, false);         // UTC: 6:29 PM Local: 7:29 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 23, 10, 48, 0, false);         // UTC: 10:48 AM Local: 11:48 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 6, 8, 48, 0, false);           // UTC: 8:48 AM Local: 9:48 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 1, 9, 27, 0, false);           // UTC: 9:27 AM Local: 10:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 25, 13, 13, 0, false);         // UTC: 1:13 PM Local: 2:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 6, 0, 59, 0, false);           // UTC: 12:59 AM Local: 1:59 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 20, 11, 22, 0, false);         // UTC: 11:22 AM Local: 12:22 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 10, 3, 39, 0, false);          // UTC: 3:39 AM Local: 4:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 16, 11, 26, 0, false);         // UTC: 11:26 AM Local: 12:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 12, 10, 2, 0, false);          // UTC: 10:02 AM Local: 11:02 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 19, 9, 34, 0, false);          // UTC: 9:34 AM Local: 10:34 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 28, 16, 39, 0, false);         // UTC: 4:39 PM Local: 5:39 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 18, 0, 19, 0, false);          // UTC: 12:19 AM Local: 1:19 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 20, 17, 20, 0, false);         // UTC: 5:20 PM Local: 6:20 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 5, 1, 58, 0, false);           // UTC: 1:58 AM Local: 2:58 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 11, 7, 59, 0, false);          // UTC: 7:59 AM Local: 8:59 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 18, 21, 50, 0, false);         // UTC: 9:50 PM Local: 10:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 23, 6, 56, 0, false);          // UTC: 6:56 AM Local: 7:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 4, 2, 4, 0, false);            // UTC: 2:04 AM Local: 3:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 20, 5, 47, 0, false);          // UTC: 5:47 AM Local: 6:47 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 14, 21, 21, 0, false);         // UTC: 9:21 PM Local: 10:21 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 1, 9, 1, 27, 0, false);           // UTC: 1:27 AM Local: 2:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 8, 11, 20, 0, false);          // UTC: 11:20 AM Local: 12:20 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 11, 1, 40, 0, false);          // UTC: 1:40 AM Local: 2:40 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 11, 21, 44, 0, false);         // UTC: 9:44 PM Local: 10:44 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 16, 6, 55, 0, false);          // UTC: 6:55 AM Local: 7:55 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 8, 19, 4, 0, false);           // UTC: 7:04 PM Local: 8:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 27, 3, 42, 0, false);          // UTC: 3:42 AM Local: 4:42 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 16, 15, 57, 0, false);         // UTC: 3:57 PM Local: 4:57 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 26, 5, 32, 0, false);          // UTC: 5:32 AM Local: 6:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 7, 21, 57, 0, false);          // UTC: 9:57 PM Local: 10:57 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 15, 17, 49, 0, false);         // UTC: 5:49 PM Local: 6:49 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 13, 22, 21, 0, false);         // UTC: 10:21 PM Local: 11:21 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 7, 21, 8, 0, false);           // UTC: 9:08 PM Local: 10:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 19, 21, 10, 0, false);         // UTC: 9:10 PM Local: 10:10 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 17, 15, 45, 0, false);         // UTC: 3:45 PM Local: 4:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 15, 4, 7, 0, false);           // UTC: 4:07 AM Local: 5:07 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 7, 20, 26, 0, false);          // UTC: 8:26 PM Local: 9:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 7, 5, 16, 0, false);           // UTC: 5:16 AM Local: 6:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 20, 2, 20, 0, false);          // UTC: 2:20 AM Local: 3:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 16, 21, 28, 0, false);         // UTC: 9:28 PM Local: 10:28 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 17, 2, 27, 0, false);          // UTC: 2:27 AM Local: 3:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 21, 12, 58, 0, false);         // UTC: 12:58 PM Local: 1:58 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 7, 5, 54, 0, false);           // UTC: 5:54 AM Local: 6:54 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 19, 20, 11, 0, false);         // UTC: 8:11 PM Local: 9:11 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 21, 18, 9, 0, false);          // UTC: 6:09 PM Local: 7:09 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 2, 3, 17, 44, 0, false);          // UTC: 5:44 PM Local: 6:44 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 6, 23, 20, 0, false);          // UTC: 11:20 PM Local: 12:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 21, 18, 42, 0, false);         // UTC: 6:42 PM Local: 7:42 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 6, 1, 14, 0, false);           // UTC: 1:14 AM Local: 2:14 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 16, 23, 54, 0, false);         // UTC: 11:54 PM Local: 12:54 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 16, 23, 56, 0, false);         // UTC: 11:56 PM Local: 12:56 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 5, 5, 58, 0, false);           // UTC: 5:58 AM Local: 6:58 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 3, 14, 38, 0, false);          // UTC: 2:38 PM Local: 3:38 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 23, 17, 35, 0, false);         // UTC: 5:35 PM Local: 6:35 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 8, 4, 59, 0, false);           // UTC: 4:59 AM Local: 5:59 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 16, 4, 57, 0, false);          // UTC: 4:57 AM Local: 5:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 9, 16, 35, 0, false);          // UTC: 4:35 PM Local: 5:35 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 20, 7, 33, 0, false);          // UTC: 7:33 AM Local: 8:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 28, 20, 16, 0, false);         // UTC: 8:16 PM Local: 9:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 9, 2, 25, 0, false);           // UTC: 2:25 AM Local: 3:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 6, 17, 17, 0, false);          // UTC: 5:17 PM Local: 6:17 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 30, 17, 56, 0, false);         // UTC: 5:56 PM Local: 6:56 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 19, 21, 1, 0, false);          // UTC: 9:01 PM Local: 10:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 14, 19, 2, 0, false);          // UTC: 7:02 PM Local: 8:02 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 15, 16, 8, 0, false);          // UTC: 4:08 PM Local: 5:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 31, 6, 40, 0, true);           // UTC: 6:40 AM Local: 8:40 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 14, 17, 11, 0, false);         // UTC: 5:11 PM Local: 6:11 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 22, 1, 43, 0, false);          // UTC: 1:43 AM Local: 2:43 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 30, 0, 0, 0, false);           // UTC: 12:00 AM Local: 1:00 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 4, 23, 34, 0, false);          // UTC: 11:34 PM Local: 12:34 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 3, 5, 12, 19, 0, false);          // UTC: 12:19 PM Local: 1:19 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 18, 6, 5, 0, true);            // UTC: 6:05 AM Local: 8:05 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 15, 20, 58, 0, true);          // UTC: 8:58 PM Local: 10:58 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 23, 17, 52, 0, true);          // UTC: 5:52 PM Local: 7:52 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 3, 16, 11, 0, true);           // UTC: 4:11 PM Local: 6:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 26, 9, 4, 0, true);            // UTC: 9:04 AM Local: 11:04 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 26, 5, 58, 0, true);           // UTC: 5:58 AM Local: 7:58 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 13, 0, 53, 0, true);           // UTC: 12:53 AM Local: 2:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 11, 0, 9, 0, true);            // UTC: 12:09 AM Local: 2:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 4, 2, 0, 0, true);             // UTC: 2:00 AM Local: 4:00 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 9, 11, 16, 0, true);           // UTC: 11:16 AM Local: 1:16 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 10, 23, 22, 0, true);          // UTC: 11:22 PM Local: 1:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 4, 21, 37, 0, true);           // UTC: 9:37 PM Local: 11:37 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 6, 14, 38, 0, true);           // UTC: 2:38 PM Local: 4:38 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 26, 23, 6, 0, true);           // UTC: 11:06 PM Local: 1:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 29, 22, 27, 0, true);          // UTC: 10:27 PM Local: 12:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 27, 13, 23, 0, true);          // UTC: 1:23 PM Local: 3:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 9, 11, 6, 0, true);            // UTC: 11:06 AM Local: 1:06 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 4, 10, 17, 0, true);           // UTC: 10:17 AM Local: 12:17 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 8, 22, 20, 0, true);           // UTC: 10:20 PM Local: 12:20 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 29, 8, 49, 0, true);           // UTC: 8:49 AM Local: 10:49 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 25, 15, 30, 0, true);          // UTC: 3:30 PM Local: 5:30 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 11, 0, 7, 0, true);            // UTC: 12:07 AM Local: 2:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 3, 12, 0, 0, true);            // UTC: 12:00 PM Local: 2:00 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 6, 7, 28, 0, true);            // UTC: 7:28 AM Local: 9:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 4, 30, 15, 43, 0, true);          // UTC: 3:43 PM Local: 5:43 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 18, 12, 56, 0, true);          // UTC: 12:56 PM Local: 2:56 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 23, 20, 24, 0, true);          // UTC: 8:24 PM Local: 10:24 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 23, 2, 5, 0, true);            // UTC: 2:05 AM Local: 4:05 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 29, 5, 38, 0, true);           // UTC: 5:38 AM Local: 7:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 15, 5, 44, 0, true);           // UTC: 5:44 AM Local: 7:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 24, 14, 19, 0, true);          // UTC: 2:19 PM Local: 4:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 18, 9, 46, 0, true);           // UTC: 9:46 AM Local: 11:46 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 8, 1, 0, 0, true);             // UTC: 1:00 AM Local: 3:00 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 28, 6, 20, 0, true);           // UTC: 6:20 AM Local: 8:20 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 16, 12, 35, 0, true);          // UTC: 12:35 PM Local: 2:35 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 11, 22, 11, 0, true);          // UTC: 10:11 PM Local: 12:11 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 30, 4, 51, 0, true);           // UTC: 4:51 AM Local: 6:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 3, 13, 8, 0, true);            // UTC: 1:08 PM Local: 3:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 3, 19, 21, 0, true);           // UTC: 7:21 PM Local: 9:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 13, 0, 20, 0, true);           // UTC: 12:20 AM Local: 2:20 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 15, 8, 22, 0, true);           // UTC: 8:22 AM Local: 10:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 3, 9, 21, 0, true);            // UTC: 9:21 AM Local: 11:21 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 11, 0, 6, 0, true);            // UTC: 12:06 AM Local: 2:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 11, 13, 15, 0, true);          // UTC: 1:15 PM Local: 3:15 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 9, 6, 3, 0, true);             // UTC: 6:03 AM Local: 8:03 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 14, 4, 13, 0, true);           // UTC: 4:13 AM Local: 6:13 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 30, 22, 39, 0, true);          // UTC: 10:39 PM Local: 12:39 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 27, 0, 47, 0, true);           // UTC: 12:47 AM Local: 2:47 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 28, 7, 18, 0, true);           // UTC: 7:18 AM Local: 9:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 5, 4, 1, 50, 0, true);            // UTC: 1:50 AM Local: 3:50 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 22, 20, 46, 0, true);          // UTC: 8:46 PM Local: 10:46 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 23, 4, 1, 0, true);            // UTC: 4:01 AM Local: 6:01 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 26, 11, 34, 0, true);          // UTC: 11:34 AM Local: 1:34 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 28, 2, 23, 0, true);           // UTC: 2:23 AM Local: 4:23 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 7, 5, 27, 0, true);            // UTC: 5:27 AM Local: 7:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 20, 3, 5, 0, true);            // UTC: 3:05 AM Local: 5:05 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 28, 2, 59, 0, true);           // UTC: 2:59 AM Local: 4:59 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 25, 17, 22, 0, true);          // UTC: 5:22 PM Local: 7:22 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 27, 15, 11, 0, true);          // UTC: 3:11 PM Local: 5:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 5, 20, 11, 0, true);           // UTC: 8:11 PM Local: 10:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 24, 15, 21, 0, true);          // UTC: 3:21 PM Local: 5:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 14, 3, 11, 0, true);           // UTC: 3:11 AM Local: 5:11 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 24, 4, 19, 0, true);           // UTC: 4:19 AM Local: 6:19 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 15, 3, 58, 0, true);           // UTC: 3:58 AM Local: 5:58 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 2, 0, 30, 0, true);            // UTC: 12:30 AM Local: 2:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 2, 1, 32, 0, true);            // UTC: 1:32 AM Local: 3:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 24, 7, 49, 0, true);           // UTC: 7:49 AM Local: 9:49 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 11, 22, 0, 0, true);           // UTC: 10:00 PM Local: 12:00 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 10, 5, 34, 0, true);           // UTC: 5:34 AM Local: 7:34 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 14, 20, 26, 0, true);          // UTC: 8:26 PM Local: 10:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 28, 2, 21, 0, true);           // UTC: 2:21 AM Local: 4:21 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 28, 3, 2, 0, true);            // UTC: 3:02 AM Local: 5:02 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 16, 21, 6, 0, true);           // UTC: 9:06 PM Local: 11:06 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 29, 1, 30, 0, true);           // UTC: 1:30 AM Local: 3:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 6, 29, 20, 27, 0, true);          // UTC: 8:27 PM Local: 10:27 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 25, 18, 19, 0, true);          // UTC: 6:19 PM Local: 8:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 21, 16, 30, 0, true);          // UTC: 4:30 PM Local: 6:30 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 16, 13, 37, 0, true);          // UTC: 1:37 PM Local: 3:37 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 8, 17, 30, 0, true);           // UTC: 5:30 PM Local: 7:30 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 13, 4, 40, 0, true);           // UTC: 4:40 AM Local: 6:40 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 7, 18, 0, 0, true);            // UTC: 6:00 PM Local: 8:00 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 31, 14, 49, 0, true);          // UTC: 2:49 PM Local: 4:49 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 11, 5, 46, 0, true);           // UTC: 5:46 AM Local: 7:46 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 8, 15, 17, 0, true);           // UTC: 3:17 PM Local: 5:17 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 17, 19, 46, 0, true);          // UTC: 7:46 PM Local: 9:46 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 25, 2, 13, 0, true);           // UTC: 2:13 AM Local: 4:13 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 5, 5, 53, 0, true);            // UTC: 5:53 AM Local: 7:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 20, 0, 10, 0, true);           // UTC: 12:10 AM Local: 2:10 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 16, 17, 51, 0, true);          // UTC: 5:51 PM Local: 7:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 29, 20, 27, 0, true);          // UTC: 8:27 PM Local: 10:27 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 28, 7, 38, 0, true);           // UTC: 7:38 AM Local: 9:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 23, 13, 42, 0, true);          // UTC: 1:42 PM Local: 3:42 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 14, 5, 11, 0, true);           // UTC: 5:11 AM Local: 7:11 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 30, 21, 57, 0, true);          // UTC: 9:57 PM Local: 11:57 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 12, 17, 31, 0, true);          // UTC: 5:31 PM Local: 7:31 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 11, 21, 11, 0, true);          // UTC: 9:11 PM Local: 11:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 30, 14, 11, 0, true);          // UTC: 2:11 PM Local: 4:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 1, 17, 6, 0, true);            // UTC: 5:06 PM Local: 7:06 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 28, 7, 50, 0, true);           // UTC: 7:50 AM Local: 9:50 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 7, 20, 8, 45, 0, true);           // UTC: 8:45 AM Local: 10:45 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 14, 18, 18, 0, true);          // UTC: 6:18 PM Local: 8:18 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 15, 10, 40, 0, true);          // UTC: 10:40 AM Local: 12:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 31, 14, 27, 0, true);          // UTC: 2:27 PM Local: 4:27 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 22, 2, 44, 0, true);           // UTC: 2:44 AM Local: 4:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 20, 0, 7, 0, true);            // UTC: 12:07 AM Local: 2:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 21, 21, 45, 0, true);          // UTC: 9:45 PM Local: 11:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 17, 3, 34, 0, true);           // UTC: 3:34 AM Local: 5:34 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 17, 17, 2, 0, true);           // UTC: 5:02 PM Local: 7:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 5, 6, 34, 0, true);            // UTC: 6:34 AM Local: 8:34 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 29, 1, 1, 0, true);            // UTC: 1:01 AM Local: 3:01 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 29, 3, 27, 0, true);           // UTC: 3:27 AM Local: 5:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 13, 14, 39, 0, true);          // UTC: 2:39 PM Local: 4:39 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 31, 0, 39, 0, true);           // UTC: 12:39 AM Local: 2:39 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 15, 12, 2, 0, true);           // UTC: 12:02 PM Local: 2:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 6, 11, 3, 0, true);            // UTC: 11:03 AM Local: 1:03 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 7, 12, 6, 0, true);            // UTC: 12:06 PM Local: 2:06 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 9, 21, 59, 0, true);           // UTC: 9:59 PM Local: 11:59 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 21, 17, 17, 0, true);          // UTC: 5:17 PM Local: 7:17 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 13, 17, 12, 0, true);          // UTC: 5:12 PM Local: 7:12 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 22, 12, 13, 0, true);          // UTC: 12:13 PM Local: 2:13 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 11, 7, 6, 0, true);            // UTC: 7:06 AM Local: 9:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 30, 5, 13, 0, true);           // UTC: 5:13 AM Local: 7:13 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 24, 15, 38, 0, true);          // UTC: 3:38 PM Local: 5:38 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 15, 6, 48, 0, true);           // UTC: 6:48 AM Local: 8:48 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 8, 6, 20, 7, 0, true);            // UTC: 8:07 PM Local: 10:07 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 18, 1, 5, 0, true);            // UTC: 1:05 AM Local: 3:05 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 25, 18, 9, 0, true);           // UTC: 6:09 PM Local: 8:09 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 14, 12, 23, 0, true);          // UTC: 12:23 PM Local: 2:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 4, 16, 24, 0, true);           // UTC: 4:24 PM Local: 6:24 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 20, 17, 31, 0, true);          // UTC: 5:31 PM Local: 7:31 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 20, 21, 27, 0, true);          // UTC: 9:27 PM Local: 11:27 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 2, 21, 14, 0, true);           // UTC: 9:14 PM Local: 11:14 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 5, 8, 51, 0, true);            // UTC: 8:51 AM Local: 10:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 16, 14, 7, 0, true);           // UTC: 2:07 PM Local: 4:07 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 22, 10, 18, 0, true);          // UTC: 10:18 AM Local: 12:18 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 1, 6, 15, 0, true);            // UTC: 6:15 AM Local: 8:15 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 23, 16, 26, 0, true);          // UTC: 4:26 PM Local: 6:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 20, 19, 52, 0, true);          // UTC: 7:52 PM Local: 9:52 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 5, 2, 2, 0, true);             // UTC: 2:02 AM Local: 4:02 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 13, 0, 32, 0, true);           // UTC: 12:32 AM Local: 2:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 30, 20, 17, 0, true);          // UTC: 8:17 PM Local: 10:17 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 10, 7, 9, 0, true);            // UTC: 7:09 AM Local: 9:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 2, 0, 39, 0, true);            // UTC: 12:39 AM Local: 2:39 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 27, 22, 28, 0, true);          // UTC: 10:28 PM Local: 12:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 25, 19, 39, 0, true);          // UTC: 7:39 PM Local: 9:39 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 16, 1, 44, 0, true);           // UTC: 1:44 AM Local: 3:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 12, 3, 40, 0, true);           // UTC: 3:40 AM Local: 5:40 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 25, 0, 11, 0, true);           // UTC: 12:11 AM Local: 2:11 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 9, 18, 51, 0, true);           // UTC: 6:51 PM Local: 8:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 9, 20, 19, 31, 0, true);          // UTC: 7:31 PM Local: 9:31 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 6, 4, 52, 0, true);           // UTC: 4:52 AM Local: 6:52 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 16, 11, 36, 0, true);         // UTC: 11:36 AM Local: 1:36 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 20, 1, 6, 0, true);           // UTC: 1:06 AM Local: 3:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 27, 14, 23, 0, false);        // UTC: 2:23 PM Local: 3:23 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 11, 12, 14, 0, true);         // UTC: 12:14 PM Local: 2:14 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 30, 18, 26, 0, false);        // UTC: 6:26 PM Local: 7:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 28, 22, 43, 0, false);        // UTC: 10:43 PM Local: 11:43 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 11, 3, 14, 0, true);          // UTC: 3:14 AM Local: 5:14 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 10, 15, 8, 0, true);          // UTC: 3:08 PM Local: 5:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 30, 12, 52, 0, false);        // UTC: 12:52 PM Local: 1:52 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 10, 20, 45, 0, true);         // UTC: 8:45 PM Local: 10:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 29, 4, 4, 0, false);          // UTC: 4:04 AM Local: 5:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 23, 7, 4, 0, true);           // UTC: 7:04 AM Local: 9:04 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 26, 6, 47, 0, true);          // UTC: 6:47 AM Local: 8:47 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 5, 18, 26, 0, true);          // UTC: 6:26 PM Local: 8:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 4, 9, 54, 0, true);           // UTC: 9:54 AM Local: 11:54 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 30, 3, 44, 0, false);         // UTC: 3:44 AM Local: 4:44 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 19, 3, 17, 0, true);          // UTC: 3:17 AM Local: 5:17 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 14, 15, 35, 0, true);         // UTC: 3:35 PM Local: 5:35 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 22, 4, 41, 0, true);          // UTC: 4:41 AM Local: 6:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 8, 10, 26, 0, true);          // UTC: 10:26 AM Local: 12:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 7, 22, 27, 0, true);          // UTC: 10:27 PM Local: 12:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 6, 21, 43, 0, true);          // UTC: 9:43 PM Local: 11:43 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 6, 17, 38, 0, true);          // UTC: 5:38 PM Local: 7:38 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 10, 24, 7, 16, 0, true);          // UTC: 7:16 AM Local: 9:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 10, 9, 57, 0, false);         // UTC: 9:57 AM Local: 10:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 28, 14, 16, 0, false);        // UTC: 2:16 PM Local: 3:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 16, 4, 17, 0, false);         // UTC: 4:17 AM Local: 5:17 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 5, 16, 12, 0, false);         // UTC: 4:12 PM Local: 5:12 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 17, 23, 14, 0, false);        // UTC: 11:14 PM Local: 12:14 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 7, 19, 39, 0, false);         // UTC: 7:39 PM Local: 8:39 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 11, 0, 0, 0, false);          // UTC: 12:00 AM Local: 1:00 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 19, 19, 32, 0, false);        // UTC: 7:32 PM Local: 8:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 26, 20, 45, 0, false);        // UTC: 8:45 PM Local: 9:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 4, 14, 29, 0, false);         // UTC: 2:29 PM Local: 3:29 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 26, 5, 23, 0, false);         // UTC: 5:23 AM Local: 6:23 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 16, 23, 39, 0, false);        // UTC: 11:39 PM Local: 12:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 20, 20, 51, 0, false);        // UTC: 8:51 PM Local: 9:51 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 24, 3, 19, 0, false);         // UTC: 3:19 AM Local: 4:19 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 18, 4, 52, 0, false);         // UTC: 4:52 AM Local: 5:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 17, 13, 46, 0, false);        // UTC: 1:46 PM Local: 2:46 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 23, 12, 26, 0, false);        // UTC: 12:26 PM Local: 1:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 16, 18, 23, 0, false);        // UTC: 6:23 PM Local: 7:23 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 11, 11, 29, 0, false);        // UTC: 11:29 AM Local: 12:29 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 23, 9, 41, 0, false);         // UTC: 9:41 AM Local: 10:41 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 29, 23, 39, 0, false);        // UTC: 11:39 PM Local: 12:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 12, 19, 56, 0, false);        // UTC: 7:56 PM Local: 8:56 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 17, 0, 29, 0, false);         // UTC: 12:29 AM Local: 1:29 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 6, 18, 41, 0, false);         // UTC: 6:41 PM Local: 7:41 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 11, 9, 14, 1, 0, false);          // UTC: 2:01 PM Local: 3:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 12, 17, 32, 0, false);        // UTC: 5:32 PM Local: 6:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 24, 4, 26, 0, false);         // UTC: 4:26 AM Local: 5:26 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 21, 17, 50, 0, false);        // UTC: 5:50 PM Local: 6:50 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 31, 11, 51, 0, false);        // UTC: 11:51 AM Local: 12:51 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 6, 4, 43, 0, false);          // UTC: 4:43 AM Local: 5:43 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 20, 23, 20, 0, false);        // UTC: 11:20 PM Local: 12:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 26, 2, 32, 0, false);         // UTC: 2:32 AM Local: 3:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 19, 13, 14, 0, false);        // UTC: 1:14 PM Local: 2:14 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 5, 9, 45, 0, false);          // UTC: 9:45 AM Local: 10:45 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 19, 8, 32, 0, false);         // UTC: 8:32 AM Local: 9:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 14, 0, 5, 0, false);          // UTC: 12:05 AM Local: 1:05 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 31, 7, 52, 0, false);         // UTC: 7:52 AM Local: 8:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 18, 13, 43, 0, false);        // UTC: 1:43 PM Local: 2:43 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 31, 15, 16, 0, false);        // UTC: 3:16 PM Local: 4:16 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 24, 3, 13, 0, false);         // UTC: 3:13 AM Local: 4:13 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 27, 22, 24, 0, false);        // UTC: 10:24 PM Local: 11:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 16, 8, 57, 0, false);         // UTC: 8:57 AM Local: 9:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 15, 11, 39, 0, false);        // UTC: 11:39 AM Local: 12:39 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 23, 7, 33, 0, false);         // UTC: 7:33 AM Local: 8:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 4, 18, 38, 0, false);         // UTC: 6:38 PM Local: 7:38 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 27, 21, 20, 0, false);        // UTC: 9:20 PM Local: 10:20 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 18, 2, 10, 0, false);         // UTC: 2:10 AM Local: 3:10 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 15, 3, 27, 0, false);         // UTC: 3:27 AM Local: 4:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 16, 17, 2, 0, false);         // UTC: 5:02 PM Local: 6:02 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2019, 12, 29, 16, 8, 0, false);         // UTC: 4:08 PM Local: 5:08 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 16, 15, 55, 0, false);         // UTC: 3:55 PM Local: 4:55 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 14, 18, 40, 0, false);         // UTC: 6:40 PM Local: 7:40 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 13, 7, 54, 0, false);          // UTC: 7:54 AM Local: 8:54 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 8, 7, 46, 0, false);           // UTC: 7:46 AM Local: 8:46 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 18, 14, 19, 0, false);         // UTC: 2:19 PM Local: 3:19 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 24, 19, 46, 0, false);         // UTC: 7:46 PM Local: 8:46 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 22, 13, 46, 0, false);         // UTC: 1:46 PM Local: 2:46 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 27, 8, 36, 0, false);          // UTC: 8:36 AM Local: 9:36 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 22, 18, 32, 0, false);         // UTC: 6:32 PM Local: 7:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 4, 22, 25, 0, false);          // UTC: 10:25 PM Local: 11:25 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 13, 10, 40, 0, false);         // UTC: 10:40 AM Local: 11:40 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 2, 22, 13, 0, false);          // UTC: 10:13 PM Local: 11:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 3, 0, 16, 0, false);           // UTC: 12:16 AM Local: 1:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 3, 5, 32, 0, false);           // UTC: 5:32 AM Local: 6:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 29, 21, 14, 0, false);         // UTC: 9:14 PM Local: 10:14 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 29, 16, 42, 0, false);         // UTC: 4:42 PM Local: 5:42 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 26, 3, 2, 0, false);           // UTC: 3:02 AM Local: 4:02 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 30, 15, 55, 0, false);         // UTC: 3:55 PM Local: 4:55 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 20, 7, 57, 0, false);          // UTC: 7:57 AM Local: 8:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 18, 8, 43, 0, false);          // UTC: 8:43 AM Local: 9:43 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 21, 17, 1, 0, false);          // UTC: 5:01 PM Local: 6:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 9, 0, 52, 0, false);           // UTC: 12:52 AM Local: 1:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 14, 11, 36, 0, false);         // UTC: 11:36 AM Local: 12:36 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 7, 16, 0, 0, false);           // UTC: 4:00 PM Local: 5:00 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 1, 11, 22, 32, 0, false);         // UTC: 10:32 PM Local: 11:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 29, 10, 2, 0, false);          // UTC: 10:02 AM Local: 11:02 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 22, 0, 22, 0, false);          // UTC: 12:22 AM Local: 1:22 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 25, 20, 26, 0, false);         // UTC: 8:26 PM Local: 9:26 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 15, 15, 1, 0, false);          // UTC: 3:01 PM Local: 4:01 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 20, 14, 59, 0, false);         // UTC: 2:59 PM Local: 3:59 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 14, 16, 55, 0, false);         // UTC: 4:55 PM Local: 5:55 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 24, 8, 24, 0, false);          // UTC: 8:24 AM Local: 9:24 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 5, 0, 33, 0, false);           // UTC: 12:33 AM Local: 1:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 15, 17, 40, 0, false);         // UTC: 5:40 PM Local: 6:40 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 12, 12, 32, 0, false);         // UTC: 12:32 PM Local: 1:32 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 14, 21, 57, 0, false);         // UTC: 9:57 PM Local: 10:57 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 5, 11, 35, 0, false);          // UTC: 11:35 AM Local: 12:35 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 11, 19, 57, 0, false);         // UTC: 7:57 PM Local: 8:57 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 21, 16, 37, 0, false);         // UTC: 4:37 PM Local: 5:37 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 5, 17, 38, 0, false);          // UTC: 5:38 PM Local: 6:38 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 1, 11, 35, 0, false);          // UTC: 11:35 AM Local: 12:35 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 7, 1, 16, 0, false);           // UTC: 1:16 AM Local: 2:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 17, 9, 14, 0, false);          // UTC: 9:14 AM Local: 10:14 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 4, 19, 17, 0, false);          // UTC: 7:17 PM Local: 8:17 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 6, 0, 20, 0, false);           // UTC: 12:20 AM Local: 1:20 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 2, 16, 37, 0, false);          // UTC: 4:37 PM Local: 5:37 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 3, 4, 16, 0, false);           // UTC: 4:16 AM Local: 5:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 13, 0, 4, 0, false);           // UTC: 12:04 AM Local: 1:04 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 14, 11, 45, 0, false);         // UTC: 11:45 AM Local: 12:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 2, 22, 18, 37, 0, false);         // UTC: 6:37 PM Local: 7:37 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 21, 8, 57, 0, false);          // UTC: 8:57 AM Local: 9:57 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 31, 3, 53, 0, true);           // UTC: 3:53 AM Local: 5:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 17, 7, 16, 0, false);          // UTC: 7:16 AM Local: 8:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 24, 19, 33, 0, false);         // UTC: 7:33 PM Local: 8:33 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 15, 20, 40, 0, false);         // UTC: 8:40 PM Local: 9:40 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 17, 2, 32, 0, false);          // UTC: 2:32 AM Local: 3:32 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 20, 13, 23, 0, false);         // UTC: 1:23 PM Local: 2:23 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 18, 18, 10, 0, false);         // UTC: 6:10 PM Local: 7:10 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 31, 10, 24, 0, true);          // UTC: 10:24 AM Local: 12:24 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 2, 15, 49, 0, false);          // UTC: 3:49 PM Local: 4:49 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 27, 21, 45, 0, false);         // UTC: 9:45 PM Local: 10:45 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 2, 17, 42, 0, false);          // UTC: 5:42 PM Local: 6:42 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 14, 17, 49, 0, false);         // UTC: 5:49 PM Local: 6:49 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 10, 19, 7, 0, false);          // UTC: 7:07 PM Local: 8:07 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 1, 11, 36, 0, false);          // UTC: 11:36 AM Local: 12:36 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 4, 21, 52, 0, false);          // UTC: 9:52 PM Local: 10:52 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 12, 9, 53, 0, false);          // UTC: 9:53 AM Local: 10:53 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 9, 23, 45, 0, false);          // UTC: 11:45 PM Local: 12:45 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 29, 1, 18, 0, true);           // UTC: 1:18 AM Local: 3:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 29, 21, 14, 0, true);          // UTC: 9:14 PM Local: 11:14 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 18, 22, 21, 0, false);         // UTC: 10:21 PM Local: 11:21 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 18, 9, 26, 0, false);          // UTC: 9:26 AM Local: 10:26 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 3, 12, 53, 0, false);          // UTC: 12:53 PM Local: 1:53 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 21, 8, 41, 0, false);          // UTC: 8:41 AM Local: 9:41 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 3, 12, 3, 16, 0, false);          // UTC: 3:16 AM Local: 4:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 3, 17, 33, 0, true);           // UTC: 5:33 PM Local: 7:33 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 16, 3, 55, 0, true);           // UTC: 3:55 AM Local: 5:55 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 23, 2, 0, 0, true);            // UTC: 2:00 AM Local: 4:00 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 11, 14, 53, 0, true);          // UTC: 2:53 PM Local: 4:53 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 22, 1, 4, 0, true);            // UTC: 1:04 AM Local: 3:04 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 17, 14, 48, 0, true);          // UTC: 2:48 PM Local: 4:48 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 1, 17, 20, 0, true);           // UTC: 5:20 PM Local: 7:20 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 21, 23, 12, 0, true);          // UTC: 11:12 PM Local: 1:12 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 11, 18, 4, 0, true);           // UTC: 6:04 PM Local: 8:04 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 28, 4, 30, 0, true);           // UTC: 4:30 AM Local: 6:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 6, 14, 54, 0, true);           // UTC: 2:54 PM Local: 4:54 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 11, 15, 51, 0, true);          // UTC: 3:51 PM Local: 5:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 29, 12, 47, 0, true);          // UTC: 12:47 PM Local: 2:47 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 11, 5, 27, 0, true);           // UTC: 5:27 AM Local: 7:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 1, 18, 10, 0, true);           // UTC: 6:10 PM Local: 8:10 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 29, 19, 45, 0, true);          // UTC: 7:45 PM Local: 9:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 4, 7, 4, 0, true);             // UTC: 7:04 AM Local: 9:04 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 12, 12, 44, 0, true);          // UTC: 12:44 PM Local: 2:44 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 2, 2, 19, 0, true);            // UTC: 2:19 AM Local: 4:19 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 15, 20, 28, 0, true);          // UTC: 8:28 PM Local: 10:28 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 8, 3, 16, 0, true);            // UTC: 3:16 AM Local: 5:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 15, 11, 16, 0, true);          // UTC: 11:16 AM Local: 1:16 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 13, 1, 11, 0, true);           // UTC: 1:11 AM Local: 3:11 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 26, 9, 6, 0, true);            // UTC: 9:06 AM Local: 11:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 4, 23, 6, 35, 0, true);           // UTC: 6:35 AM Local: 8:35 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 19, 8, 32, 0, true);           // UTC: 8:32 AM Local: 10:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 24, 21, 19, 0, true);          // UTC: 9:19 PM Local: 11:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 22, 4, 38, 0, true);           // UTC: 4:38 AM Local: 6:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 7, 21, 58, 0, true);           // UTC: 9:58 PM Local: 11:58 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 12, 7, 36, 0, true);           // UTC: 7:36 AM Local: 9:36 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 8, 11, 3, 0, true);            // UTC: 11:03 AM Local: 1:03 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 14, 22, 33, 0, true);          // UTC: 10:33 PM Local: 12:33 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 26, 3, 2, 0, true);            // UTC: 3:02 AM Local: 5:02 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 22, 3, 9, 0, true);            // UTC: 3:09 AM Local: 5:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 16, 16, 30, 0, true);          // UTC: 4:30 PM Local: 6:30 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 9, 18, 20, 0, true);           // UTC: 6:20 PM Local: 8:20 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 30, 15, 32, 0, true);          // UTC: 3:32 PM Local: 5:32 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 26, 8, 54, 0, true);           // UTC: 8:54 AM Local: 10:54 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 8, 16, 53, 0, true);           // UTC: 4:53 PM Local: 6:53 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 9, 7, 6, 0, true);             // UTC: 7:06 AM Local: 9:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 26, 2, 59, 0, true);           // UTC: 2:59 AM Local: 4:59 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 22, 6, 59, 0, true);           // UTC: 6:59 AM Local: 8:59 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 17, 5, 55, 0, true);           // UTC: 5:55 AM Local: 7:55 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 18, 10, 22, 0, true);          // UTC: 10:22 AM Local: 12:22 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 11, 13, 0, 0, true);           // UTC: 1:00 PM Local: 3:00 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 13, 4, 37, 0, true);           // UTC: 4:37 AM Local: 6:37 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 20, 1, 31, 0, true);           // UTC: 1:31 AM Local: 3:31 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 12, 6, 28, 0, true);           // UTC: 6:28 AM Local: 8:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 30, 8, 52, 0, true);           // UTC: 8:52 AM Local: 10:52 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 5, 13, 4, 8, 0, true);            // UTC: 4:08 AM Local: 6:08 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 19, 15, 49, 0, true);          // UTC: 3:49 PM Local: 5:49 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 23, 14, 11, 0, true);          // UTC: 2:11 PM Local: 4:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 21, 18, 44, 0, true);          // UTC: 6:44 PM Local: 8:44 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 6, 22, 20, 0, true);           // UTC: 10:20 PM Local: 12:20 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 10, 20, 6, 0, true);           // UTC: 8:06 PM Local: 10:06 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 4, 3, 34, 0, true);            // UTC: 3:34 AM Local: 5:34 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 26, 22, 18, 0, true);          // UTC: 10:18 PM Local: 12:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 20, 15, 35, 0, true);          // UTC: 3:35 PM Local: 5:35 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 4, 11, 43, 0, true);           // UTC: 11:43 AM Local: 1:43 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 27, 3, 32, 0, true);           // UTC: 3:32 AM Local: 5:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 1, 5, 47, 0, true);            // UTC: 5:47 AM Local: 7:47 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 30, 10, 45, 0, true);          // UTC: 10:45 AM Local: 12:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 27, 11, 18, 0, true);          // UTC: 11:18 AM Local: 1:18 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 20, 9, 53, 0, true);           // UTC: 9:53 AM Local: 11:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 19, 20, 39, 0, true);          // UTC: 8:39 PM Local: 10:39 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 7, 6, 10, 0, true);            // UTC: 6:10 AM Local: 8:10 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 27, 13, 19, 0, true);          // UTC: 1:19 PM Local: 3:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 4, 4, 47, 0, true);            // UTC: 4:47 AM Local: 6:47 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 19, 13, 50, 0, true);          // UTC: 1:50 PM Local: 3:50 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 24, 5, 32, 0, true);           // UTC: 5:32 AM Local: 7:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 19, 5, 32, 0, true);           // UTC: 5:32 AM Local: 7:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 13, 14, 25, 0, true);          // UTC: 2:25 PM Local: 4:25 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 28, 4, 30, 0, true);           // UTC: 4:30 AM Local: 6:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 5, 0, 20, 0, true);            // UTC: 12:20 AM Local: 2:20 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 6, 1, 17, 59, 0, true);           // UTC: 5:59 PM Local: 7:59 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 5, 1, 40, 0, true);            // UTC: 1:40 AM Local: 3:40 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 31, 11, 13, 0, true);          // UTC: 11:13 AM Local: 1:13 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 10, 12, 47, 0, true);          // UTC: 12:47 PM Local: 2:47 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 26, 14, 10, 0, true);          // UTC: 2:10 PM Local: 4:10 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 9, 9, 32, 0, true);            // UTC: 9:32 AM Local: 11:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 3, 20, 36, 0, true);           // UTC: 8:36 PM Local: 10:36 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 25, 9, 42, 0, true);           // UTC: 9:42 AM Local: 11:42 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 4, 0, 19, 0, true);            // UTC: 12:19 AM Local: 2:19 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 6, 3, 19, 0, true);            // UTC: 3:19 AM Local: 5:19 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 18, 18, 32, 0, true);          // UTC: 6:32 PM Local: 8:32 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 25, 3, 49, 0, true);           // UTC: 3:49 AM Local: 5:49 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 26, 15, 52, 0, true);          // UTC: 3:52 PM Local: 5:52 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 13, 9, 9, 0, true);            // UTC: 9:09 AM Local: 11:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 9, 2, 32, 0, true);            // UTC: 2:32 AM Local: 4:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 10, 8, 32, 0, true);           // UTC: 8:32 AM Local: 10:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 6, 14, 11, 0, true);           // UTC: 2:11 PM Local: 4:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 1, 10, 6, 0, true);            // UTC: 10:06 AM Local: 12:06 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 22, 7, 41, 0, true);           // UTC: 7:41 AM Local: 9:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 27, 6, 49, 0, true);           // UTC: 6:49 AM Local: 8:49 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 28, 15, 8, 0, true);           // UTC: 3:08 PM Local: 5:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 12, 4, 57, 0, true);           // UTC: 4:57 AM Local: 6:57 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 22, 1, 41, 0, true);           // UTC: 1:41 AM Local: 3:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 16, 22, 55, 0, true);          // UTC: 10:55 PM Local: 12:55 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 31, 16, 38, 0, true);          // UTC: 4:38 PM Local: 6:38 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 7, 9, 19, 46, 0, true);           // UTC: 7:46 PM Local: 9:46 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 4, 7, 24, 0, true);            // UTC: 7:24 AM Local: 9:24 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 25, 5, 51, 0, true);           // UTC: 5:51 AM Local: 7:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 4, 1, 34, 0, true);            // UTC: 1:34 AM Local: 3:34 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 26, 5, 15, 0, true);           // UTC: 5:15 AM Local: 7:15 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 16, 4, 43, 0, true);           // UTC: 4:43 AM Local: 6:43 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 2, 2, 29, 0, true);            // UTC: 2:29 AM Local: 4:29 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 7, 14, 34, 0, true);           // UTC: 2:34 PM Local: 4:34 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 6, 12, 45, 0, true);           // UTC: 12:45 PM Local: 2:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 4, 5, 43, 0, true);            // UTC: 5:43 AM Local: 7:43 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 30, 4, 22, 0, true);           // UTC: 4:22 AM Local: 6:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 11, 6, 1, 0, true);            // UTC: 6:01 AM Local: 8:01 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 21, 2, 53, 0, true);           // UTC: 2:53 AM Local: 4:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 18, 5, 22, 0, true);           // UTC: 5:22 AM Local: 7:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 31, 11, 26, 0, true);          // UTC: 11:26 AM Local: 1:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 26, 8, 10, 0, true);           // UTC: 8:10 AM Local: 10:10 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 25, 4, 48, 0, true);           // UTC: 4:48 AM Local: 6:48 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 21, 21, 1, 0, true);           // UTC: 9:01 PM Local: 11:01 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 8, 7, 28, 0, true);            // UTC: 7:28 AM Local: 9:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 27, 4, 41, 0, true);           // UTC: 4:41 AM Local: 6:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 31, 8, 5, 0, true);            // UTC: 8:05 AM Local: 10:05 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 12, 19, 51, 0, true);          // UTC: 7:51 PM Local: 9:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 21, 1, 34, 0, true);           // UTC: 1:34 AM Local: 3:34 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 21, 22, 43, 0, true);          // UTC: 10:43 PM Local: 12:43 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 17, 22, 35, 0, true);          // UTC: 10:35 PM Local: 12:35 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 8, 30, 0, 20, 0, true);           // UTC: 12:20 AM Local: 2:20 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 30, 23, 32, 0, true);          // UTC: 11:32 PM Local: 1:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 24, 15, 4, 0, true);           // UTC: 3:04 PM Local: 5:04 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 18, 22, 52, 0, true);          // UTC: 10:52 PM Local: 12:52 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 13, 4, 5, 0, true);            // UTC: 4:05 AM Local: 6:05 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 30, 8, 16, 0, true);           // UTC: 8:16 AM Local: 10:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 12, 14, 7, 0, true);           // UTC: 2:07 PM Local: 4:07 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 10, 5, 7, 0, true);            // UTC: 5:07 AM Local: 7:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 23, 9, 52, 0, true);           // UTC: 9:52 AM Local: 11:52 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 20, 20, 40, 0, true);          // UTC: 8:40 PM Local: 10:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 10, 23, 28, 0, true);          // UTC: 11:28 PM Local: 1:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 5, 0, 17, 0, true);            // UTC: 12:17 AM Local: 2:17 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 4, 5, 33, 0, true);            // UTC: 5:33 AM Local: 7:33 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 3, 23, 27, 0, true);           // UTC: 11:27 PM Local: 1:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 15, 13, 11, 0, true);          // UTC: 1:11 PM Local: 3:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 2, 19, 53, 0, true);           // UTC: 7:53 PM Local: 9:53 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 1, 6, 45, 0, true);            // UTC: 6:45 AM Local: 8:45 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 24, 6, 16, 0, true);           // UTC: 6:16 AM Local: 8:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 21, 12, 43, 0, true);          // UTC: 12:43 PM Local: 2:43 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 29, 9, 33, 0, true);           // UTC: 9:33 AM Local: 11:33 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 13, 8, 53, 0, true);           // UTC: 8:53 AM Local: 10:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 20, 17, 3, 0, true);           // UTC: 5:03 PM Local: 7:03 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 6, 0, 37, 0, true);            // UTC: 12:37 AM Local: 2:37 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 2, 17, 19, 0, true);           // UTC: 5:19 PM Local: 7:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 21, 18, 56, 0, true);          // UTC: 6:56 PM Local: 8:56 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 9, 16, 2, 9, 0, true);            // UTC: 2:09 AM Local: 4:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 31, 17, 57, 0, false);        // UTC: 5:57 PM Local: 6:57 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 5, 2, 32, 0, true);           // UTC: 2:32 AM Local: 4:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 11, 11, 16, 0, true);         // UTC: 11:16 AM Local: 1:16 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 11, 18, 54, 0, true);         // UTC: 6:54 PM Local: 8:54 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 21, 19, 17, 0, true);         // UTC: 7:17 PM Local: 9:17 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 29, 12, 24, 0, false);        // UTC: 12:24 PM Local: 1:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 4, 9, 13, 0, true);           // UTC: 9:13 AM Local: 11:13 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 14, 21, 18, 0, true);         // UTC: 9:18 PM Local: 11:18 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 11, 18, 40, 0, true);         // UTC: 6:40 PM Local: 8:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 8, 11, 51, 0, true);          // UTC: 11:51 AM Local: 1:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 23, 16, 30, 0, true);         // UTC: 4:30 PM Local: 6:30 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 5, 12, 3, 0, true);           // UTC: 12:03 PM Local: 2:03 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 6, 2, 42, 0, true);           // UTC: 2:42 AM Local: 4:42 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 27, 4, 49, 0, false);         // UTC: 4:49 AM Local: 5:49 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 30, 22, 48, 0, false);        // UTC: 10:48 PM Local: 11:48 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 24, 19, 8, 0, true);          // UTC: 7:08 PM Local: 9:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 3, 18, 33, 0, true);          // UTC: 6:33 PM Local: 8:33 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 1, 21, 2, 0, true);           // UTC: 9:02 PM Local: 11:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 25, 19, 51, 0, false);        // UTC: 7:51 PM Local: 8:51 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 1, 13, 56, 0, true);          // UTC: 1:56 PM Local: 3:56 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 12, 2, 22, 0, true);          // UTC: 2:22 AM Local: 4:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 5, 6, 19, 0, true);           // UTC: 6:19 AM Local: 8:19 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 22, 9, 9, 0, true);           // UTC: 9:09 AM Local: 11:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 3, 10, 59, 0, true);          // UTC: 10:59 AM Local: 12:59 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 10, 29, 3, 39, 0, false);         // UTC: 3:39 AM Local: 4:39 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 10, 5, 16, 0, false);         // UTC: 5:16 AM Local: 6:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 7, 5, 45, 0, false);          // UTC: 5:45 AM Local: 6:45 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 2, 14, 24, 0, false);         // UTC: 2:24 PM Local: 3:24 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 23, 15, 13, 0, false);        // UTC: 3:13 PM Local: 4:13 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 13, 18, 30, 0, false);        // UTC: 6:30 PM Local: 7:30 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 28, 19, 18, 0, false);        // UTC: 7:18 PM Local: 8:18 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 1, 11, 9, 0, false);          // UTC: 11:09 AM Local: 12:09 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 10, 21, 9, 0, false);         // UTC: 9:09 PM Local: 10:09 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 2, 18, 15, 0, false);         // UTC: 6:15 PM Local: 7:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 11, 2, 2, 0, false);          // UTC: 2:02 AM Local: 3:02 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 7, 16, 22, 0, false);         // UTC: 4:22 PM Local: 5:22 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 26, 10, 52, 0, false);        // UTC: 10:52 AM Local: 11:52 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 16, 5, 15, 0, false);         // UTC: 5:15 AM Local: 6:15 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 9, 7, 27, 0, false);          // UTC: 7:27 AM Local: 8:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 9, 21, 19, 0, false);         // UTC: 9:19 PM Local: 10:19 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 24, 6, 17, 0, false);         // UTC: 6:17 AM Local: 7:17 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 17, 8, 46, 0, false);         // UTC: 8:46 AM Local: 9:46 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 14, 8, 21, 0, false);         // UTC: 8:21 AM Local: 9:21 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 9, 23, 10, 0, false);         // UTC: 11:10 PM Local: 12:10 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 28, 22, 42, 0, false);        // UTC: 10:42 PM Local: 11:42 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 17, 1, 54, 0, false);         // UTC: 1:54 AM Local: 2:54 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 26, 14, 49, 0, false);        // UTC: 2:49 PM Local: 3:49 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 11, 6, 46, 0, false);         // UTC: 6:46 AM Local: 7:46 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 30, 8, 25, 0, false);         // UTC: 8:25 AM Local: 9:25 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 11, 22, 17, 12, 0, false);        // UTC: 5:12 PM Local: 6:12 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 19, 8, 3, 0, false);          // UTC: 8:03 AM Local: 9:03 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 14, 11, 36, 0, false);        // UTC: 11:36 AM Local: 12:36 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 14, 8, 33, 0, false);         // UTC: 8:33 AM Local: 9:33 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 18, 6, 27, 0, false);         // UTC: 6:27 AM Local: 7:27 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 8, 12, 41, 0, false);         // UTC: 12:41 PM Local: 1:41 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 17, 10, 31, 0, false);        // UTC: 10:31 AM Local: 11:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 2, 17, 15, 0, false);         // UTC: 5:15 PM Local: 6:15 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 23, 13, 6, 0, false);         // UTC: 1:06 PM Local: 2:06 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 20, 16, 4, 0, false);         // UTC: 4:04 PM Local: 5:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 22, 15, 5, 0, false);         // UTC: 3:05 PM Local: 4:05 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 6, 6, 1, 0, false);           // UTC: 6:01 AM Local: 7:01 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 17, 9, 16, 0, false);         // UTC: 9:16 AM Local: 10:16 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 11, 17, 43, 0, false);        // UTC: 5:43 PM Local: 6:43 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 23, 2, 0, 0, false);          // UTC: 2:00 AM Local: 3:00 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 7, 19, 52, 0, false);         // UTC: 7:52 PM Local: 8:52 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 8, 1, 31, 0, false);          // UTC: 1:31 AM Local: 2:31 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 4, 10, 21, 0, false);         // UTC: 10:21 AM Local: 11:21 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 17, 11, 17, 0, false);        // UTC: 11:17 AM Local: 12:17 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 22, 14, 40, 0, false);        // UTC: 2:40 PM Local: 3:40 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 5, 10, 8, 0, false);          // UTC: 10:08 AM Local: 11:08 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 8, 12, 4, 0, false);          // UTC: 12:04 PM Local: 1:04 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 23, 2, 38, 0, false);         // UTC: 2:38 AM Local: 3:38 AM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 28, 18, 55, 0, false);        // UTC: 6:55 PM Local: 7:55 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 15, 11, 23, 0, false);        // UTC: 11:23 AM Local: 12:23 PM Offset: 01:00:00
+	testCount++; failedCount += test(timeManager, 12, 2020, 12, 8, 21, 55, 0, false);         // UTC: 9:55 PM Local: 10:55 PM Offset: 01:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
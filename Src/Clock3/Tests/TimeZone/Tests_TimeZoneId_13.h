@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_13_H
+#define TEST_TIMEZONEID_13_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_13_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 9, 9, 43, 0, false);           // UTC: 9:43 AM Local: 11:43 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 30, 21, 51, 0, false);         // UTC: 9:51 PM Local: 11:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 28, 5, 41, 0, false);          // UTC: 5:41 AM Local: 7:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 8, 21, 9, 0, false);           // UTC: 9:09 PM Local: 11:09 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 28, 7, 41, 0, false);          // UTC: 7:41 AM Local: 9:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 24, 5, 8, 0, false);           // UTC: 5:08 AM Local: 7:08 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 3, 17, 54, 0, false);          // UTC: 5:54 PM Local: 7:54 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 7, 23, 18, 0, false);          // UTC: 11:18 PM Local: 1:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 1, 13, 8, 0, false);           // UTC: 1:08 PM Local: 3:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 27, 21, 38, 0, false);         // UTC: 9:38 PM Local: 11:38 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 1, 8, 53, 0, false);           // UTC: 8:53 AM Local: 10:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 5, 2, 55, 0, false);           // UTC: 2:55 AM Local: 4:55 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 26, 8, 52, 0, false);          // UTC: 8:52 AM Local: 10:52 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 15, 23, 27, 0, false);         // UTC: 11:27 PM Local: 1:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 31, 4, 50, 0, false);          // UTC: 4:50 AM Local: 6:50 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 29, 8, 22, 0, false);          // UTC: 8:22 AM Local: 10:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 28, 7, 31, 0, false);          // UTC: 7:31 AM Local: 9:31 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 29, 17, 36, 0, false);         // UTC: 5:36 PM Local: 7:36 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 14, 21, 23, 0, false);         // UTC: 9:23 PM Local: 11:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 29, 13, 40, 0, false);         // UTC: 1:40 PM Local: 3:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 11, 20, 7, 0, false);          // UTC: 8:07 PM Local: 10:07 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 12, 19, 51, 0, false);         // UTC: 7:51 PM Local: 9:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 21, 8, 44, 0, false);          // UTC: 8:44 AM Local: 10:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 15, 17, 39, 0, false);         // UTC: 5:39 PM Local: 7:39 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 1, 24, 4, 28, 0, false);          // UTC: 4:28 AM Local: 6:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 22, 23, 28, 0, false);         // UTC: 11:28 PM Local: 1:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 18, 5, 18, 0, false);          // UTC: 5:18 AM Local: 7:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 7, 5, 33, 0, false);           // UTC: 5:33 AM Local: 7:33 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 12, 8, 23, 0, false);          // UTC: 8:23 AM Local: 10:23 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 15, 8, 38, 0, false);          // UTC: 8:38 AM Local: 10:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 9, 12, 56, 0, false);          // UTC: 12:56 PM Local: 2:56 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 5, 18, 31, 0, false);          // UTC: 6:31 PM Local: 8:31 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 18, 7, 36, 0, false);          // UTC: 7:36 AM Local: 9:36 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 8, 6, 44, 0, false);           // UTC: 6:44 AM Local: 8:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 12, 4, 4, 0, false);           // UTC: 4:04 AM Local: 6:04 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 14, 20, 40, 0, false);         // UTC: 8:40 PM Local: 10:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 15, 12, 0, 0, false);          // UTC: 12:00 PM Local: 2:00 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 24, 13, 59, 0, false);         // UTC: 1:59 PM Local: 3:59 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 28, 1, 14, 0, false);          // UTC: 1:14 AM Local: 3:14 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 5, 15, 51, 0, false);          // UTC: 3:51 PM Local: 5:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 23, 14, 40, 0, false);         // UTC: 2:40 PM Local: 4:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 9, 5, 46, 0, false);           // UTC: 5:46 AM Local: 7:46 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 14, 23, 55, 0, false);         // UTC: 11:55 PM Local: 1:55 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 9, 11, 12, 0, false);          // UTC: 11:12 AM Local: 1:12 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 23, 20, 23, 0, false);         // UTC: 8:23 PM Local: 10:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 17, 22, 42, 0, false);         // UTC: 10:42 PM Local: 12:42 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 5, 22, 38, 0, false);          // UTC: 10:38 PM Local: 12:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 8, 23, 31, 0, false);          // UTC: 11:31 PM Local: 1:31 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 7, 19, 2, 0, false);           // UTC: 7:02 PM Local: 9:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 2, 19, 22, 37, 0, false);         // UTC: 10:37 PM Local: 12:37 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 2, 11, 37, 0, false);          // UTC: 11:37 AM Local: 1:37 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 24, 18, 21, 0, false);         // UTC: 6:21 PM Local: 8:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 6, 9, 12, 0, false);           // UTC: 9:12 AM Local: 11:12 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 6, 21, 35, 0, false);          // UTC: 9:35 PM Local: 11:35 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 4, 7, 10, 0, false);           // UTC: 7:10 AM Local: 9:10 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 3, 13, 41, 0, false);          // UTC: 1:41 PM Local: 3:41 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 20, 17, 51, 0, false);         // UTC: 5:51 PM Local: 7:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 18, 22, 2, 0, false);          // UTC: 10:02 PM Local: 12:02 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 15, 10, 41, 0, false);         // UTC: 10:41 AM Local: 12:41 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 3, 16, 0, 0, false);           // UTC: 4:00 PM Local: 6:00 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 5, 9, 7, 0, false);            // UTC: 9:07 AM Local: 11:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 14, 9, 58, 0, false);          // UTC: 9:58 AM Local: 11:58 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 9, 18, 38, 0, false);          // UTC: 6:38 PM Local: 8:38 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 23, 2, 30, 0, false);          // UTC: 2:30 AM Local: 4:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 17, 11, 54, 0, false);         // UTC: 11:54 AM Local: 1:54 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 27, 1, 0, 0, true);            // UTC: 1:00 AM Local: 4:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 11, 10, 9, 0, false);          // UTC: 10:09 AM Local: 12:09 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 16, 17, 34, 0, false);         // UTC: 5:34 PM Local: 7:34 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 17, 15, 14, 0, false);         // UTC: 3:14 PM Local: 5:14 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 22, 6, 18, 0, false);          // UTC: 6:18 AM Local: 8:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 26, 1, 24, 0, true);           // UTC: 1:24 AM Local: 4:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 17, 22, 58, 0, false);         // UTC: 10:58 PM Local: 12:58 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 6, 23, 9, 0, false);           // UTC: 11:09 PM Local: 1:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 9, 13, 43, 0, false);          // UTC: 1:43 PM Local: 3:43 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 3, 27, 6, 16, 0, true);           // UTC: 6:16 AM Local: 9:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 14, 18, 15, 0, true);          // UTC: 6:15 PM Local: 9:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 12, 7, 37, 0, true);           // UTC: 7:37 AM Local: 10:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 10, 13, 13, 0, true);          // UTC: 1:13 PM Local: 4:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 21, 11, 27, 0, true);          // UTC: 11:27 AM Local: 2:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 2, 10, 25, 0, true);           // UTC: 10:25 AM Local: 1:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 15, 2, 4, 0, true);            // UTC: 2:04 AM Local: 5:04 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 25, 1, 38, 0, true);           // UTC: 1:38 AM Local: 4:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 30, 0, 41, 0, true);           // UTC: 12:41 AM Local: 3:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 25, 9, 12, 0, true);           // UTC: 9:12 AM Local: 12:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 15, 15, 35, 0, true);          // UTC: 3:35 PM Local: 6:35 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 13, 10, 3, 0, true);           // UTC: 10:03 AM Local: 1:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 10, 16, 27, 0, true);          // UTC: 4:27 PM Local: 7:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 5, 4, 55, 0, true);            // UTC: 4:55 AM Local: 7:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 2, 3, 23, 0, true);            // UTC: 3:23 AM Local: 6:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 27, 5, 13, 0, true);           // UTC: 5:13 AM Local: 8:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 10, 9, 38, 0, true);           // UTC: 9:38 AM Local: 12:38 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 13, 9, 2, 0, true);            // UTC: 9:02 AM Local: 12:02 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 12, 4, 6, 0, true);            // UTC: 4:06 AM Local: 7:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 12, 15, 28, 0, true);          // UTC: 3:28 PM Local: 6:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 19, 18, 27, 0, true);          // UTC: 6:27 PM Local: 9:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 2, 11, 34, 0, true);           // UTC: 11:34 AM Local: 2:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 10, 4, 51, 0, true);           // UTC: 4:51 AM Local: 7:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 2, 10, 10, 0, true);           // UTC: 10:10 AM Local: 1:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 29, 17, 47, 0, true);          // UTC: 5:47 PM Local: 8:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 4, 5, 0, 57, 0, true);            // UTC: 12:57 AM Local: 3:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 8, 21, 9, 0, true);            // UTC: 9:09 PM Local: 12:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 3, 15, 59, 0, true);           // UTC: 3:59 PM Local: 6:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 12, 2, 22, 0, true);           // UTC: 2:22 AM Local: 5:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 9, 6, 3, 0, true);             // UTC: 6:03 AM Local: 9:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 23, 7, 42, 0, true);           // UTC: 7:42 AM Local: 10:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 27, 7, 33, 0, true);           // UTC: 7:33 AM Local: 10:33 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 26, 14, 12, 0, true);          // UTC: 2:12 PM Local: 5:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 19, 12, 39, 0, true);          // UTC: 12:39 PM Local: 3:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 2, 17, 57, 0, true);           // UTC: 5:57 PM Local: 8:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 2, 3, 39, 0, true);            // UTC: 3:39 AM Local: 6:39 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 5, 17, 48, 0, true);           // UTC: 5:48 PM Local: 8:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 26, 11, 34, 0, true);          // UTC: 11:34 AM Local: 2:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 13, 9, 9, 0, true);            // UTC: 9:09 AM Local: 12:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 31, 17, 19, 0, true);          // UTC: 5:19 PM Local: 8:19 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 9, 2, 23, 0, true);            // UTC: 2:23 AM Local: 5:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 2, 0, 10, 0, true);            // UTC: 12:10 AM Local: 3:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 24, 0, 6, 0, true);            // UTC: 12:06 AM Local: 3:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 17, 22, 17, 0, true);          // UTC: 10:17 PM Local: 1:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 28, 2, 21, 0, true);           // UTC: 2:21 AM Local: 5:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 26, 20, 27, 0, true);          // UTC: 8:27 PM Local: 11:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 6, 19, 53, 0, true);           // UTC: 7:53 PM Local: 10:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 22, 22, 44, 0, true);          // UTC: 10:44 PM Local: 1:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 10, 1, 7, 0, true);            // UTC: 1:07 AM Local: 4:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 4, 9, 25, 0, true);            // UTC: 9:25 AM Local: 12:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 5, 13, 15, 24, 0, true);          // UTC: 3:24 PM Local: 6:24 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 9, 4, 50, 0, true);            // UTC: 4:50 AM Local: 7:50 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 5, 14, 19, 0, true);           // UTC: 2:19 PM Local: 5:19 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 1, 16, 1, 0, true);            // UTC: 4:01 PM Local: 7:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 18, 8, 17, 0, true);           // UTC: 8:17 AM Local: 11:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 11, 7, 59, 0, true);           // UTC: 7:59 AM Local: 10:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 8, 11, 26, 0, true);           // UTC: 11:26 AM Local: 2:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 6, 15, 26, 0, true);           // UTC: 3:26 PM Local: 6:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 9, 4, 29, 0, true);            // UTC: 4:29 AM Local: 7:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 19, 17, 29, 0, true);          // UTC: 5:29 PM Local: 8:29 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 7, 12, 45, 0, true);           // UTC: 12:45 PM Local: 3:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 16, 6, 1, 0, true);            // UTC: 6:01 AM Local: 9:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 19, 1, 30, 0, true);           // UTC: 1:30 AM Local: 4:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 27, 16, 11, 0, true);          // UTC: 4:11 PM Local: 7:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 5, 3, 0, 0, true);             // UTC: 3:00 AM Local: 6:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 19, 4, 19, 0, true);           // UTC: 4:19 AM Local: 7:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 3, 15, 36, 0, true);           // UTC: 3:36 PM Local: 6:36 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 17, 23, 53, 0, true);          // UTC: 11:53 PM Local: 2:53 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 2, 6, 45, 0, true);            // UTC: 6:45 AM Local: 9:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 24, 20, 44, 0, true);          // UTC: 8:44 PM Local: 11:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 14, 0, 34, 0, true);           // UTC: 12:34 AM Local: 3:34 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 1, 21, 9, 0, true);            // UTC: 9:09 PM Local: 12:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 10, 19, 9, 0, true);           // UTC: 7:09 PM Local: 10:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 21, 1, 46, 0, true);           // UTC: 1:46 AM Local: 4:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 17, 13, 59, 0, true);          // UTC: 1:59 PM Local: 4:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 6, 25, 8, 14, 0, true);           // UTC: 8:14 AM Local: 11:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 16, 0, 38, 0, true);           // UTC: 12:38 AM Local: 3:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 4, 7, 20, 0, true);            // UTC: 7:20 AM Local: 10:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 17, 16, 0, 0, true);           // UTC: 4:00 PM Local: 7:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 19, 14, 57, 0, true);          // UTC: 2:57 PM Local: 5:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 25, 10, 41, 0, true);          // UTC: 10:41 AM Local: 1:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 8, 19, 3, 0, true);            // UTC: 7:03 PM Local: 10:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 17, 22, 27, 0, true);          // UTC: 10:27 PM Local: 1:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 8, 16, 47, 0, true);           // UTC: 4:47 PM Local: 7:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 1, 3, 23, 0, true);            // UTC: 3:23 AM Local: 6:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 30, 4, 59, 0, true);           // UTC: 4:59 AM Local: 7:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 15, 11, 53, 0, true);          // UTC: 11:53 AM Local: 2:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 5, 21, 22, 0, true);           // UTC: 9:22 PM Local: 12:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 24, 7, 42, 0, true);           // UTC: 7:42 AM Local: 10:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 10, 18, 5, 0, true);           // UTC: 6:05 PM Local: 9:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 9, 22, 8, 0, true);            // UTC: 10:08 PM Local: 1:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 5, 23, 11, 0, true);           // UTC: 11:11 PM Local: 2:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 20, 3, 3, 0, true);            // UTC: 3:03 AM Local: 6:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 18, 20, 9, 0, true);           // UTC: 8:09 PM Local: 11:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 20, 23, 32, 0, true);          // UTC: 11:32 PM Local: 2:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 1, 14, 56, 0, true);           // UTC: 2:56 PM Local: 5:56 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 12, 12, 36, 0, true);          // UTC: 12:36 PM Local: 3:36 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 27, 18, 31, 0, true);          // UTC: 6:31 PM Local: 9:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 26, 18, 32, 0, true);          // UTC: 6:32 PM Local: 9:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 14, 2, 59, 0, true);           // UTC: 2:59 AM Local: 5:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 7, 28, 14, 33, 0, true);          // UTC: 2:33 PM Local: 5:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 31, 8, 21, 0, true);           // UTC: 8:21 AM Local: 11:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 13, 21, 7, 0, true);           // UTC: 9:07 PM Local: 12:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 30, 6, 43, 0, true);           // UTC: 6:43 AM Local: 9:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 11, 12, 37, 0, true);          // UTC: 12:37 PM Local: 3:37 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 3, 15, 59, 0, true);           // UTC: 3:59 PM Local: 6:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 14, 9, 52, 0, true);           // UTC: 9:52 AM Local: 12:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 30, 0, 45, 0, true);           // UTC: 12:45 AM Local: 3:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 15, 12, 26, 0, true);          // UTC: 12:26 PM Local: 3:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 16, 18, 57, 0, true);          // UTC: 6:57 PM Local: 9:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 24, 1, 5, 0, true);            // UTC: 1:05 AM Local: 4:05 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 9, 6, 0, 0, true);             // UTC: 6:00 AM Local: 9:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 5, 17, 20, 0, true);           // UTC: 5:20 PM Local: 8:20 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 10, 16, 13, 0, true);          // UTC: 4:13 PM Local: 7:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 14, 17, 18, 0, true);          // UTC: 5:18 PM Local: 8:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 1, 6, 40, 0, true);            // UTC: 6:40 AM Local: 9:40 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 29, 2, 47, 0, true);           // UTC: 2:47 AM Local: 5:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 4, 20, 8, 0, true);            // UTC: 8:08 PM Local: 11:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 31, 2, 35, 0, true);           // UTC: 2:35 AM Local: 5:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 13, 20, 13, 0, true);          // UTC: 8:13 PM Local: 11:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 11, 5, 1, 0, true);            // UTC: 5:01 AM Local: 8:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 6, 22, 11, 0, true);           // UTC: 10:11 PM Local: 1:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 2, 1, 14, 0, true);            // UTC: 1:14 AM Local: 4:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 14, 18, 56, 0, true);          // UTC: 6:56 PM Local: 9:56 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 6, 21, 49, 0, true);           // UTC: 9:49 PM Local: 12:49 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 8, 23, 13, 44, 0, true);          // UTC: 1:44 PM Local: 4:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 3, 15, 54, 0, true);           // UTC: 3:54 PM Local: 6:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 17, 4, 7, 0, true);            // UTC: 4:07 AM Local: 7:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 2, 11, 39, 0, true);           // UTC: 11:39 AM Local: 2:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 2, 16, 52, 0, true);           // UTC: 4:52 PM Local: 7:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 17, 23, 11, 0, true);          // UTC: 11:11 PM Local: 2:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 3, 22, 49, 0, true);           // UTC: 10:49 PM Local: 1:49 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 14, 9, 26, 0, true);           // UTC: 9:26 AM Local: 12:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 10, 7, 16, 0, true);           // UTC: 7:16 AM Local: 10:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 10, 18, 45, 0, true);          // UTC: 6:45 PM Local: 9:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 18, 13, 58, 0, true);          // UTC: 1:58 PM Local: 4:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 10, 8, 47, 0, true);           // UTC: 8:47 AM Local: 11:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 23, 6, 6, 0, true);            // UTC: 6:06 AM Local: 9:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 27, 20, 5, 0, true);           // UTC: 8:05 PM Local: 11:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 6, 1, 54, 0, true);            // UTC: 1:54 AM Local: 4:54 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 4, 8, 9, 0, true);             // UTC: 8:09 AM Local: 11:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 26, 7, 39, 0, true);           // UTC: 7:39 AM Local: 10:39 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 10, 3, 6, 0, true);            // UTC: 3:06 AM Local: 6:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 16, 14, 38, 0, true);          // UTC: 2:38 PM Local: 5:38 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 4, 1, 45, 0, true);            // UTC: 1:45 AM Local: 4:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 29, 18, 34, 0, true);          // UTC: 6:34 PM Local: 9:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 14, 4, 45, 0, true);           // UTC: 4:45 AM Local: 7:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 16, 7, 30, 0, true);           // UTC: 7:30 AM Local: 10:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 11, 11, 7, 0, true);           // UTC: 11:07 AM Local: 2:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 1, 22, 56, 0, true);           // UTC: 10:56 PM Local: 1:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 9, 16, 2, 44, 0, true);           // UTC: 2:44 AM Local: 5:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 4, 8, 28, 0, true);           // UTC: 8:28 AM Local: 11:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 1, 13, 58, 0, true);          // UTC: 1:58 PM Local: 4:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 5, 22, 0, 0, true);           // UTC: 10:00 PM Local: 1:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 21, 16, 8, 0, true);          // UTC: 4:08 PM Local: 7:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 8, 11, 9, 0, true);           // UTC: 11:09 AM Local: 2:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 14, 13, 1, 0, true);          // UTC: 1:01 PM Local: 4:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 12, 11, 21, 0, true);         // UTC: 11:21 AM Local: 2:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 25, 11, 47, 0, true);         // UTC: 11:47 AM Local: 2:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 7, 3, 9, 0, true);            // UTC: 3:09 AM Local: 6:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 24, 5, 36, 0, true);          // UTC: 5:36 AM Local: 8:36 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 6, 20, 27, 0, true);          // UTC: 8:27 PM Local: 11:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 31, 1, 51, 0, false);         // UTC: 1:51 AM Local: 3:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 31, 19, 27, 0, false);        // UTC: 7:27 PM Local: 9:27 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 25, 3, 31, 0, true);          // UTC: 3:31 AM Local: 6:31 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 14, 17, 13, 0, true);         // UTC: 5:13 PM Local: 8:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 27, 4, 39, 0, true);          // UTC: 4:39 AM Local: 7:39 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 31, 12, 51, 0, false);        // UTC: 12:51 PM Local: 2:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 1, 12, 50, 0, true);          // UTC: 12:50 PM Local: 3:50 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 13, 10, 58, 0, true);         // UTC: 10:58 AM Local: 1:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 14, 12, 18, 0, true);         // UTC: 12:18 PM Local: 3:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 3, 17, 15, 0, true);          // UTC: 5:15 PM Local: 8:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 13, 5, 53, 0, true);          // UTC: 5:53 AM Local: 8:53 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 31, 19, 48, 0, false);        // UTC: 7:48 PM Local: 9:48 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 18, 1, 50, 0, true);          // UTC: 1:50 AM Local: 4:50 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 10, 15, 14, 6, 0, true);          // UTC: 2:06 PM Local: 5:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 18, 16, 46, 0, false);        // UTC: 4:46 PM Local: 6:46 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 15, 23, 9, 0, false);         // UTC: 11:09 PM Local: 1:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 29, 17, 2, 0, false);         // UTC: 5:02 PM Local: 7:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 18, 23, 12, 0, false);        // UTC: 11:12 PM Local: 1:12 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 1, 7, 27, 0, false);          // UTC: 7:27 AM Local: 9:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 2, 15, 17, 0, false);         // UTC: 3:17 PM Local: 5:17 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 29, 13, 2, 0, false);         // UTC: 1:02 PM Local: 3:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 25, 11, 12, 0, false);        // UTC: 11:12 AM Local: 1:12 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 24, 14, 25, 0, false);        // UTC: 2:25 PM Local: 4:25 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 28, 19, 10, 0, false);        // UTC: 7:10 PM Local: 9:10 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 15, 6, 27, 0, false);         // UTC: 6:27 AM Local: 8:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 25, 18, 25, 0, false);        // UTC: 6:25 PM Local: 8:25 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 2, 12, 25, 0, false);         // UTC: 12:25 PM Local: 2:25 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 8, 21, 47, 0, false);         // UTC: 9:47 PM Local: 11:47 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 7, 18, 56, 0, false);         // UTC: 6:56 PM Local: 8:56 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 14, 6, 2, 0, false);          // UTC: 6:02 AM Local: 8:02 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 2, 22, 1, 0, false);          // UTC: 10:01 PM Local: 12:01 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 15, 16, 46, 0, false);        // UTC: 4:46 PM Local: 6:46 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 22, 19, 25, 0, false);        // UTC: 7:25 PM Local: 9:25 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 13, 16, 8, 0, false);         // UTC: 4:08 PM Local: 6:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 28, 14, 5, 0, false);         // UTC: 2:05 PM Local: 4:05 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 16, 15, 37, 0, false);        // UTC: 3:37 PM Local: 5:37 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 21, 14, 5, 0, false);         // UTC: 2:05 PM Local: 4:05 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 30, 17, 32, 0, false);        // UTC: 5:32 PM Local: 7:32 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 11, 23, 16, 0, 0, false);         // UTC: 4:00 PM Local: 6:00 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 2, 22, 51, 0, false);         // UTC: 10:51 PM Local: 12:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 16, 20, 11, 0, false);        // UTC: 8:11 PM Local: 10:11 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 8, 23, 7, 0, false);          // UTC: 11:07 PM Local: 1:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 1, 13, 44, 0, false);         // UTC: 1:44 PM Local: 3:44 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 30, 17, 55, 0, false);        // UTC: 5:55 PM Local: 7:55 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 7, 14, 30, 0, false);         // UTC: 2:30 PM Local: 4:30 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 2, 13, 53, 0, false);         // UTC: 1:53 PM Local: 3:53 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 2, 6, 17, 0, false);          // UTC: 6:17 AM Local: 8:17 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 24, 15, 33, 0, false);        // UTC: 3:33 PM Local: 5:33 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 31, 4, 9, 0, false);          // UTC: 4:09 AM Local: 6:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 5, 23, 1, 0, false);          // UTC: 11:01 PM Local: 1:01 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 6, 18, 4, 0, false);          // UTC: 6:04 PM Local: 8:04 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 10, 5, 44, 0, false);         // UTC: 5:44 AM Local: 7:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 16, 6, 42, 0, false);         // UTC: 6:42 AM Local: 8:42 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 16, 0, 38, 0, false);         // UTC: 12:38 AM Local: 2:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 23, 7, 4, 0, false);          // UTC: 7:04 AM Local: 9:04 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 15, 3, 4, 0, false);          // UTC: 3:04 AM Local: 5:04 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 24, 19, 4, 0, false);         // UTC: 7:04 PM Local: 9:04 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 13, 16, 44, 0, false);        // UTC: 4:44 PM Local: 6:44 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 6, 6, 36, 0, false);          // UTC: 6:36 AM Local: 8:36 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 30, 1, 46, 0, false);         // UTC: 1:46 AM Local: 3:46 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 1, 12, 39, 0, false);         // UTC: 12:39 PM Local: 2:39 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 7, 23, 56, 0, false);         // UTC: 11:56 PM Local: 1:56 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 15, 21, 51, 0, false);        // UTC: 9:51 PM Local: 11:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2018, 12, 11, 4, 28, 0, false);         // UTC: 4:28 AM Local: 6:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 21, 19, 40, 0, false);         // UTC: 7:40 PM Local: 9:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 25, 5, 56, 0, false);          // UTC: 5:56 AM Local: 7:56 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 5, 7, 37, 0, false);           // UTC: 7:37 AM Local: 9:37 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 17, 22, 45, 0, false);         // UTC: 10:45 PM Local: 12:45 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 26, 18, 44, 0, false);         // UTC: 6:44 PM Local: 8:44 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 3, 16, 46, 0, false);          // UTC: 4:46 PM Local: 6:46 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 14, 16, 51, 0, false);         // UTC: 4:51 PM Local: 6:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 6, 12, 39, 0, false);          // UTC: 12:39 PM Local: 2:39 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 14, 7, 49, 0, false);          // UTC: 7:49 AM Local: 9:49 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 10, 9, 28, 0, false);          // UTC: 9:28 AM Local: 11:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 25, 0, 6, 0, false);           // UTC: 12:06 AM Local: 2:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 25, 14, 29, 0, false);         // UTC: 2:29 PM Local: 4:29 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 8, 22, 42, 0, false);          // UTC: 10:42 PM Local: 12:42 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 26, 5, 16, 0, false);          // UTC: 5:16 AM Local: 7:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 1, 23, 49, 0, false);          // UTC: 11:49 PM Local: 1:49 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 15, 6, 35, 0, false);          // UTC: 6:35 AM Local: 8:35 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 9, 19, 34, 0, false);          // UTC: 7:34 PM Local: 9:34 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 30, 22, 38, 0, false);         // UTC: 10:38 PM Local: 12:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 29, 0, 42, 0, false);          // UTC: 12:42 AM Local: 2:42 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 26, 18, 8, 0, false);          // UTC: 6:08 PM Local: 8:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 14, 10, 15, 0, false);         // UTC: 10:15 AM Local: 12:15 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 15, 0, 44, 0, false);          // UTC: 12:44 AM Local: 2:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 13, 8, 6, 0, false);           // UTC: 8:06 AM Local: 10:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 5, 1, 56, 0, false);           // UTC: 1:56 AM Local: 3:56 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 1, 11, 14, 1, 0, false);          // UTC: 2:01 PM Local: 4:01 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 3, 2, 7, 0, false);            // UTC: 2:07 AM Local: 4:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 12, 2, 39, 0, false);          // UTC: 2:39 AM Local: 4:39 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 25, 21, 49, 0, false);         // UTC: 9:49 PM Local: 11:49 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 6, 23, 36, 0, false);          // UTC: 11:36 PM Local: 1:36 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 16, 18, 29, 0, false);         // UTC: 6:29 PM Local: 8:29 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 19, 22, 0, 0, false);          // UTC: 10:00 PM Local: 12:00 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 15, 16, 45, 0, false);         // UTC: 4:45 PM Local: 6:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 1, 19, 21, 0, false);          // UTC: 7:21 PM Local: 9:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 18, 23, 22, 0, false);         // UTC: 11:22 PM Local: 1:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 3, 13, 48, 0, false);          // UTC: 1:48 PM Local: 3:48 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 14, 2, 38, 0, false);          // UTC: 2:38 AM Local: 4:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 7, 10, 9, 0, false);           // UTC: 10:09 AM Local: 12:09 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 4, 18, 9, 0, false);           // UTC: 6:09 PM Local: 8:09 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 3, 12, 37, 0, false);          // UTC: 12:37 PM Local: 2:37 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 10, 21, 31, 0, false);         // UTC: 9:31 PM Local: 11:31 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 10, 23, 51, 0, false);         // UTC: 11:51 PM Local: 1:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 22, 13, 52, 0, false);         // UTC: 1:52 PM Local: 3:52 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 7, 15, 12, 0, false);          // UTC: 3:12 PM Local: 5:12 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 4, 18, 34, 0, false);          // UTC: 6:34 PM Local: 8:34 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 13, 9, 2, 0, false);           // UTC: 9:02 AM Local: 11:02 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 3, 9, 28, 0, false);           // UTC: 9:28 AM Local: 11:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 7, 15, 0, 0, false);           // UTC: 3:00 PM Local: 5:00 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 22, 1, 27, 0, false);          // UTC: 1:27 AM Local: 3:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 17, 2, 30, 0, false);          // UTC: 2:30 AM Local: 4:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 2, 20, 9, 13, 0, false);          // UTC: 9:13 AM Local: 11:13 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 21, 3, 38, 0, false);          // UTC: 3:38 AM Local: 5:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 20, 22, 43, 0, false);         // UTC: 10:43 PM Local: 12:43 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 11, 0, 19, 0, false);          // UTC: 12:19 AM Local: 2:19 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 31, 15, 1, 0, true);           // UTC: 3:01 PM Local: 6:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 21, 5, 33, 0, false);          // UTC: 5:33 AM Local: 7:33 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 11, 1, 51, 0, false);          // UTC: 1:51 AM Local: 3:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 10, 23, 50, 0, false);         // UTC: 11:50 PM Local: 1:50 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 24, 13, 0, 0, false);          // UTC: 1:00 PM Local: 3:00 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 30, 13, 8, 0, false);          // UTC: 1:08 PM Local: 3:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 22, 13, 3, 0, false);          // UTC: 1:03 PM Local: 3:03 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 12, 4, 10, 0, false);          // UTC: 4:10 AM Local: 6:10 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 25, 11, 49, 0, false);         // UTC: 11:49 AM Local: 1:49 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 29, 21, 24, 0, false);         // UTC: 9:24 PM Local: 11:24 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 8, 9, 55, 0, false);           // UTC: 9:55 AM Local: 11:55 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 24, 16, 30, 0, false);         // UTC: 4:30 PM Local: 6:30 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 7, 0, 6, 0, false);            // UTC: 12:06 AM Local: 2:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 11, 5, 3, 0, false);           // UTC: 5:03 AM Local: 7:03 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 8, 7, 18, 0, false);           // UTC: 7:18 AM Local: 9:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 12, 19, 53, 0, false);         // UTC: 7:53 PM Local: 9:53 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 13, 16, 40, 0, false);         // UTC: 4:40 PM Local: 6:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 10, 0, 0, 0, false);           // UTC: 12:00 AM Local: 2:00 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 24, 6, 48, 0, false);          // UTC: 6:48 AM Local: 8:48 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 31, 8, 58, 0, true);           // UTC: 8:58 AM Local: 11:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 3, 17, 46, 0, false);          // UTC: 5:46 PM Local: 7:46 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 3, 24, 7, 8, 0, false);           // UTC: 7:08 AM Local: 9:08 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 4, 13, 55, 0, true);           // UTC: 1:55 PM Local: 4:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 13, 14, 52, 0, true);          // UTC: 2:52 PM Local: 5:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 10, 10, 35, 0, true);          // UTC: 10:35 AM Local: 1:35 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 9, 2, 44, 0, true);            // UTC: 2:44 AM Local: 5:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 14, 9, 41, 0, true);           // UTC: 9:41 AM Local: 12:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 8, 13, 7, 0, true);            // UTC: 1:07 PM Local: 4:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 16, 7, 6, 0, true);            // UTC: 7:06 AM Local: 10:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 3, 6, 7, 0, true);             // UTC: 6:07 AM Local: 9:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 11, 6, 10, 0, true);           // UTC: 6:10 AM Local: 9:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 22, 2, 41, 0, true);           // UTC: 2:41 AM Local: 5:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 12, 12, 15, 0, true);          // UTC: 12:15 PM Local: 3:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 7, 18, 32, 0, true);           // UTC: 6:32 PM Local: 9:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 11, 3, 5, 0, true);            // UTC: 3:05 AM Local: 6:05 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 22, 10, 26, 0, true);          // UTC: 10:26 AM Local: 1:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 15, 22, 26, 0, true);          // UTC: 10:26 PM Local: 1:26 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 13, 12, 4, 0, true);           // UTC: 12:04 PM Local: 3:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 12, 18, 26, 0, true);          // UTC: 6:26 PM Local: 9:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 17, 5, 16, 0, true);           // UTC: 5:16 AM Local: 8:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 10, 22, 24, 0, true);          // UTC: 10:24 PM Local: 1:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 16, 17, 4, 0, true);           // UTC: 5:04 PM Local: 8:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 18, 4, 58, 0, true);           // UTC: 4:58 AM Local: 7:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 27, 2, 22, 0, true);           // UTC: 2:22 AM Local: 5:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 21, 22, 39, 0, true);          // UTC: 10:39 PM Local: 1:39 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 1, 20, 21, 0, true);           // UTC: 8:21 PM Local: 11:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 4, 12, 13, 37, 0, true);          // UTC: 1:37 PM Local: 4:37 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 29, 13, 47, 0, true);          // UTC: 1:47 PM Local: 4:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 17, 12, 10, 0, true);          // UTC: 12:10 PM Local: 3:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 4, 20, 13, 0, true);           // UTC: 8:13 PM Local: 11:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 31, 23, 59, 0, true);          // UTC: 11:59 PM Local: 2:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 13, 20, 55, 0, true);          // UTC: 8:55 PM Local: 11:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 17, 3, 38, 0, true);           // UTC: 3:38 AM Local: 6:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 23, 6, 7, 0, true);            // UTC: 6:07 AM Local: 9:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 22, 20, 25, 0, true);          // UTC: 8:25 PM Local: 11:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 14, 15, 43, 0, true);          // UTC: 3:43 PM Local: 6:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 17, 6, 25, 0, true);           // UTC: 6:25 AM Local: 9:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 19, 2, 55, 0, true);           // UTC: 2:55 AM Local: 5:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 9, 14, 44, 0, true);           // UTC: 2:44 PM Local: 5:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 15, 0, 23, 0, true);           // UTC: 12:23 AM Local: 3:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 27, 6, 52, 0, true);           // UTC: 6:52 AM Local: 9:52 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 10, 15, 53, 0, true);          // UTC: 3:53 PM Local: 6:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 9, 5, 23, 0, true);            // UTC: 5:23 AM Local: 8:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 22, 9, 46, 0, true);           // UTC: 9:46 AM Local: 12:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 11, 8, 52, 0, true);           // UTC: 8:52 AM Local: 11:52 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 6, 1, 20, 0, true);            // UTC: 1:20 AM Local: 4:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 30, 2, 48, 0, true);           // UTC: 2:48 AM Local: 5:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 5, 7, 48, 0, true);            // UTC: 7:48 AM Local: 10:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 21, 8, 58, 0, true);           // UTC: 8:58 AM Local: 11:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 10, 18, 23, 0, true);          // UTC: 6:23 PM Local: 9:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 1, 15, 5, 0, true);            // UTC: 3:05 PM Local: 6:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 5, 6, 18, 24, 0, true);           // UTC: 6:24 PM Local: 9:24 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 15, 13, 22, 0, true);          // UTC: 1:22 PM Local: 4:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 14, 3, 1, 0, true);            // UTC: 3:01 AM Local: 6:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 9, 5, 15, 0, true);            // UTC: 5:15 AM Local: 8:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 26, 2, 54, 0, true);           // UTC: 2:54 AM Local: 5:54 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 27, 0, 1, 0, true);            // UTC: 12:01 AM Local: 3:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 4, 13, 15, 0, true);           // UTC: 1:15 PM Local: 4:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 6, 6, 29, 0, true);            // UTC: 6:29 AM Local: 9:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 25, 23, 11, 0, true);          // UTC: 11:11 PM Local: 2:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 23, 10, 6, 0, true);           // UTC: 10:06 AM Local: 1:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 18, 13, 33, 0, true);          // UTC: 1:33 PM Local: 4:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 3, 3, 27, 0, true);            // UTC: 3:27 AM Local: 6:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 19, 19, 57, 0, true);          // UTC: 7:57 PM Local: 10:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 13, 1, 28, 0, true);           // UTC: 1:28 AM Local: 4:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 30, 9, 4, 0, true);            // UTC: 9:04 AM Local: 12:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 29, 20, 36, 0, true);          // UTC: 8:36 PM Local: 11:36 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 10, 8, 13, 0, true);           // UTC: 8:13 AM Local: 11:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 29, 3, 30, 0, true);           // UTC: 3:30 AM Local: 6:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 20, 2, 29, 0, true);           // UTC: 2:29 AM Local: 5:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 2, 9, 46, 0, true);            // UTC: 9:46 AM Local: 12:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 21, 14, 10, 0, true);          // UTC: 2:10 PM Local: 5:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 12, 15, 49, 0, true);          // UTC: 3:49 PM Local: 6:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 27, 6, 38, 0, true);           // UTC: 6:38 AM Local: 9:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 9, 14, 33, 0, true);           // UTC: 2:33 PM Local: 5:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 30, 13, 46, 0, true);          // UTC: 1:46 PM Local: 4:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 6, 11, 8, 24, 0, true);           // UTC: 8:24 AM Local: 11:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 5, 10, 59, 0, true);           // UTC: 10:59 AM Local: 1:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 21, 17, 2, 0, true);           // UTC: 5:02 PM Local: 8:02 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 3, 15, 13, 0, true);           // UTC: 3:13 PM Local: 6:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 27, 13, 52, 0, true);          // UTC: 1:52 PM Local: 4:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 26, 17, 54, 0, true);          // UTC: 5:54 PM Local: 8:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 27, 9, 22, 0, true);           // UTC: 9:22 AM Local: 12:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 14, 19, 13, 0, true);          // UTC: 7:13 PM Local: 10:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 13, 18, 41, 0, true);          // UTC: 6:41 PM Local: 9:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 29, 1, 48, 0, true);           // UTC: 1:48 AM Local: 4:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 16, 13, 32, 0, true);          // UTC: 1:32 PM Local: 4:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 29, 18, 0, 0, true);           // UTC: 6:00 PM Local: 9:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 25, 22, 21, 0, true);          // UTC: 10:21 PM Local: 1:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 9, 9, 4, 0, true);             // UTC: 9:04 AM Local: 12:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 20, 13, 5, 0, true);           // UTC: 1:05 PM Local: 4:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 18, 1, 19, 0, true);           // UTC: 1:19 AM Local: 4:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 24, 7, 42, 0, true);           // UTC: 7:42 AM Local: 10:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 26, 21, 13, 0, true);          // UTC: 9:13 PM Local: 12:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 3, 17, 28, 0, true);           // UTC: 5:28 PM Local: 8:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 1, 4, 29, 0, true);            // UTC: 4:29 AM Local: 7:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 16, 6, 0, 0, true);            // UTC: 6:00 AM Local: 9:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 1, 3, 57, 0, true);            // UTC: 3:57 AM Local: 6:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 6, 1, 32, 0, true);            // UTC: 1:32 AM Local: 4:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 5, 9, 54, 0, true);            // UTC: 9:54 AM Local: 12:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 10, 1, 46, 0, true);           // UTC: 1:46 AM Local: 4:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 7, 26, 18, 43, 0, true);          // UTC: 6:43 PM Local: 9:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 15, 22, 28, 0, true);          // UTC: 10:28 PM Local: 1:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 4, 9, 24, 0, true);            // UTC: 9:24 AM Local: 12:24 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 8, 1, 58, 0, true);            // UTC: 1:58 AM Local: 4:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 1, 15, 17, 0, true);           // UTC: 3:17 PM Local: 6:17 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 26, 20, 56, 0, true);          // UTC: 8:56 PM Local: 11:56 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 16, 16, 11, 0, true);          // UTC: 4:11 PM Local: 7:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 5, 5, 6, 0, true);             // UTC: 5:06 AM Local: 8:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 1, 21, 59, 0, true);           // UTC: 9:59 PM Local: 12:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 11, 17, 33, 0, true);          // UTC: 5:33 PM Local: 8:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 1, 1, 17, 0, true);            // UTC: 1:17 AM Local: 4:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 31, 5, 17, 0, true);           // UTC: 5:17 AM Local: 8:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 11, 20, 40, 0, true);          // UTC: 8:40 PM Local: 11:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 20, 12, 22, 0, true);          // UTC: 12:22 PM Local: 3:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 8, 6, 18, 0, true);            // UTC: 6:18 AM Local: 9:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 18, 7, 20, 0, true);           // UTC: 7:20 AM Local: 10:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 11, 2, 24, 0, true);           // UTC: 2:24 AM Local: 5:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 6, 1, 8, 0, true);             // UTC: 1:08 AM Local: 4:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 29, 17, 12, 0, true);          // UTC: 5:12 PM Local: 8:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 31, 21, 39, 0, true);          // UTC: 9:39 PM Local: 12:39 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 15, 15, 43, 0, true);          // UTC: 3:43 PM Local: 6:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 9, 1, 5, 0, true);             // UTC: 1:05 AM Local: 4:05 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 2, 19, 43, 0, true);           // UTC: 7:43 PM Local: 10:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 23, 2, 43, 0, true);           // UTC: 2:43 AM Local: 5:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 9, 15, 6, 0, true);            // UTC: 3:06 PM Local: 6:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 8, 16, 20, 57, 0, true);          // UTC: 8:57 PM Local: 11:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 23, 19, 22, 0, true);          // UTC: 7:22 PM Local: 10:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 9, 15, 59, 0, true);           // UTC: 3:59 PM Local: 6:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 19, 0, 49, 0, true);           // UTC: 12:49 AM Local: 3:49 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 19, 4, 20, 0, true);           // UTC: 4:20 AM Local: 7:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 29, 16, 18, 0, true);          // UTC: 4:18 PM Local: 7:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 6, 9, 24, 0, true);            // UTC: 9:24 AM Local: 12:24 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 9, 11, 26, 0, true);           // UTC: 11:26 AM Local: 2:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 15, 17, 25, 0, true);          // UTC: 5:25 PM Local: 8:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 6, 6, 4, 0, true);             // UTC: 6:04 AM Local: 9:04 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 6, 14, 15, 0, true);           // UTC: 2:15 PM Local: 5:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 17, 13, 9, 0, true);           // UTC: 1:09 PM Local: 4:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 27, 20, 39, 0, true);          // UTC: 8:39 PM Local: 11:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 5, 1, 20, 0, true);            // UTC: 1:20 AM Local: 4:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 5, 20, 21, 0, true);           // UTC: 8:21 PM Local: 11:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 26, 3, 44, 0, true);           // UTC: 3:44 AM Local: 6:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 18, 18, 45, 0, true);          // UTC: 6:45 PM Local: 9:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 17, 14, 21, 0, true);          // UTC: 2:21 PM Local: 5:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 17, 18, 23, 0, true);          // UTC: 6:23 PM Local: 9:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 1, 6, 0, 0, true);             // UTC: 6:00 AM Local: 9:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 19, 16, 47, 0, true);          // UTC: 4:47 PM Local: 7:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 14, 16, 19, 0, true);          // UTC: 4:19 PM Local: 7:19 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 13, 4, 16, 0, true);           // UTC: 4:16 AM Local: 7:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 17, 1, 3, 0, true);            // UTC: 1:03 AM Local: 4:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 19, 13, 45, 0, true);          // UTC: 1:45 PM Local: 4:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 9, 8, 10, 53, 0, true);           // UTC: 10:53 AM Local: 1:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 6, 3, 3, 0, true);            // UTC: 3:03 AM Local: 6:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 4, 19, 46, 0, true);          // UTC: 7:46 PM Local: 10:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 30, 15, 44, 0, false);        // UTC: 3:44 PM Local: 5:44 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 6, 21, 8, 0, true);           // UTC: 9:08 PM Local: 12:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 28, 13, 10, 0, false);        // UTC: 1:10 PM Local: 3:10 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 14, 18, 16, 0, true);         // UTC: 6:16 PM Local: 9:16 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 23, 6, 44, 0, true);          // UTC: 6:44 AM Local: 9:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 24, 16, 32, 0, true);         // UTC: 4:32 PM Local: 7:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 25, 20, 58, 0, true);         // UTC: 8:58 PM Local: 11:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 1, 1, 26, 0, true);           // UTC: 1:26 AM Local: 4:26 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 8, 21, 29, 0, true);          // UTC: 9:29 PM Local: 12:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 23, 23, 15, 0, true);         // UTC: 11:15 PM Local: 2:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 25, 14, 17, 0, true);         // UTC: 2:17 PM Local: 5:17 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 22, 16, 18, 0, true);         // UTC: 4:18 PM Local: 7:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 7, 21, 31, 0, true);          // UTC: 9:31 PM Local: 12:31 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 2, 13, 40, 0, true);          // UTC: 1:40 PM Local: 4:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 23, 8, 32, 0, true);          // UTC: 8:32 AM Local: 11:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 4, 21, 22, 0, true);          // UTC: 9:22 PM Local: 12:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 22, 10, 41, 0, true);         // UTC: 10:41 AM Local: 1:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 15, 14, 15, 0, true);         // UTC: 2:15 PM Local: 5:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 11, 4, 21, 0, true);          // UTC: 4:21 AM Local: 7:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 29, 22, 49, 0, false);        // UTC: 10:49 PM Local: 12:49 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 8, 20, 16, 0, true);          // UTC: 8:16 PM Local: 11:16 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 25, 6, 20, 0, true);          // UTC: 6:20 AM Local: 9:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 10, 13, 5, 21, 0, true);          // UTC: 5:21 AM Local: 8:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 18, 10, 29, 0, false);        // UTC: 10:29 AM Local: 12:29 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 29, 20, 2, 0, false);         // UTC: 8:02 PM Local: 10:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 28, 14, 25, 0, false);        // UTC: 2:25 PM Local: 4:25 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 26, 11, 59, 0, false);        // UTC: 11:59 AM Local: 1:59 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 23, 12, 36, 0, false);        // UTC: 12:36 PM Local: 2:36 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 4, 19, 57, 0, false);         // UTC: 7:57 PM Local: 9:57 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 29, 15, 2, 0, false);         // UTC: 3:02 PM Local: 5:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 4, 3, 33, 0, false);          // UTC: 3:33 AM Local: 5:33 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 18, 22, 31, 0, false);        // UTC: 10:31 PM Local: 12:31 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 28, 3, 14, 0, false);         // UTC: 3:14 AM Local: 5:14 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 28, 1, 5, 0, false);          // UTC: 1:05 AM Local: 3:05 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 21, 14, 5, 0, false);         // UTC: 2:05 PM Local: 4:05 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 15, 13, 34, 0, false);        // UTC: 1:34 PM Local: 3:34 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 9, 3, 1, 0, false);           // UTC: 3:01 AM Local: 5:01 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 28, 17, 13, 0, false);        // UTC: 5:13 PM Local: 7:13 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 11, 15, 40, 0, false);        // UTC: 3:40 PM Local: 5:40 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 2, 17, 19, 0, false);         // UTC: 5:19 PM Local: 7:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 23, 10, 7, 0, false);         // UTC: 10:07 AM Local: 12:07 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 26, 19, 17, 0, false);        // UTC: 7:17 PM Local: 9:17 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 6, 18, 8, 0, false);          // UTC: 6:08 PM Local: 8:08 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 27, 17, 35, 0, false);        // UTC: 5:35 PM Local: 7:35 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 27, 12, 13, 0, false);        // UTC: 12:13 PM Local: 2:13 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 5, 5, 56, 0, false);          // UTC: 5:56 AM Local: 7:56 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 19, 23, 44, 0, false);        // UTC: 11:44 PM Local: 1:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 11, 29, 5, 16, 0, false);         // UTC: 5:16 AM Local: 7:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 17, 18, 35, 0, false);        // UTC: 6:35 PM Local: 8:35 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 17, 15, 12, 0, false);        // UTC: 3:12 PM Local: 5:12 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 11, 8, 28, 0, false);         // UTC: 8:28 AM Local: 10:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 20, 3, 22, 0, false);         // UTC: 3:22 AM Local: 5:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 4, 11, 3, 0, false);          // UTC: 11:03 AM Local: 1:03 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 8, 10, 15, 0, false);         // UTC: 10:15 AM Local: 12:15 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 1, 21, 37, 0, false);         // UTC: 9:37 PM Local: 11:37 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 4, 10, 56, 0, false);         // UTC: 10:56 AM Local: 12:56 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 7, 0, 33, 0, false);          // UTC: 12:33 AM Local: 2:33 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 26, 17, 41, 0, false);        // UTC: 5:41 PM Local: 7:41 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 30, 0, 18, 0, false);         // UTC: 12:18 AM Local: 2:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 2, 3, 15, 0, false);          // UTC: 3:15 AM Local: 5:15 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 6, 1, 52, 0, false);          // UTC: 1:52 AM Local: 3:52 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 28, 14, 9, 0, false);         // UTC: 2:09 PM Local: 4:09 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 11, 21, 4, 0, false);         // UTC: 9:04 PM Local: 11:04 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 31, 17, 44, 0, false);        // UTC: 5:44 PM Local: 7:44 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 3, 23, 41, 0, false);         // UTC: 11:41 PM Local: 1:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 26, 12, 21, 0, false);        // UTC: 12:21 PM Local: 2:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 19, 6, 54, 0, false);         // UTC: 6:54 AM Local: 8:54 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 18, 10, 26, 0, false);        // UTC: 10:26 AM Local: 12:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 6, 17, 3, 0, false);          // UTC: 5:03 PM Local: 7:03 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 10, 11, 54, 0, false);        // UTC: 11:54 AM Local: 1:54 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 23, 7, 31, 0, false);         // UTC: 7:31 AM Local: 9:31 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 31, 0, 37, 0, false);         // UTC: 12:37 AM Local: 2:37 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2019, 12, 2, 4, 56, 0, false);          // UTC: 4:56 AM Local: 6:56 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 15, 3, 41, 0, false);          // UTC: 3:41 AM Local: 5:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 3, 2, 16, 0, false);           // UTC: 2:16 AM Local: 4:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 7, 11, 43, 0, false);          // UTC: 11:43 AM Local: 1:43 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 16, 15, 19, 0, false);         // UTC: 3:19 PM Local: 5:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 5, 10, 41, 0, false);          // UTC: 10:41 AM Local: 12:41 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 29, 16, 51, 0, false);         // UTC: 4:51 PM Local: 6:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 5, 21, 58, 0, false);          // UTC: 9:58 PM Local: 11:58 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 21, 11, 34, 0, false);         // UTC: 11:34 AM Local: 1:34 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 28, 3, 28, 0, false);          // UTC: 3:28 AM Local: 5:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 22, 3, 59, 0, false);          // UTC: 3:59 AM Local: 5:59 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 15, 20, 7, 0, false);          // UTC: 8:07 PM Local: 10:07 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 12, 17, 3, 0, false);          // UTC: 5:03 PM Local: 7:03 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 30, 14, 37, 0, false);         // UTC: 2:37 PM Local: 4:37 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 16, 8, 47, 0, false);          // UTC: 8:47 AM Local: 10:47 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 19, 21, 1, 0, false);          // UTC: 9:01 PM Local: 11:01 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 8, 8, 3, 0, false);            // UTC: 8:03 AM Local: 10:03 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 16, 23, 30, 0, false);         // UTC: 11:30 PM Local: 1:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 15, 22, 19, 0, false);         // UTC: 10:19 PM Local: 12:19 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 8, 8, 32, 0, false);           // UTC: 8:32 AM Local: 10:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 24, 1, 18, 0, false);          // UTC: 1:18 AM Local: 3:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 15, 4, 20, 0, false);          // UTC: 4:20 AM Local: 6:20 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 20, 11, 37, 0, false);         // UTC: 11:37 AM Local: 1:37 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 30, 7, 56, 0, false);          // UTC: 7:56 AM Local: 9:56 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 26, 0, 23, 0, false);          // UTC: 12:23 AM Local: 2:23 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 1, 17, 6, 8, 0, false);           // UTC: 6:08 AM Local: 8:08 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 22, 6, 44, 0, false);          // UTC: 6:44 AM Local: 8:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 17, 3, 7, 0, false);           // UTC: 3:07 AM Local: 5:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 9, 19, 58, 0, false);          // UTC: 7:58 PM Local: 9:58 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 18, 6, 47, 0, false);          // UTC: 6:47 AM Local: 8:47 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 3, 17, 31, 0, false);          // UTC: 5:31 PM Local: 7:31 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 27, 8, 37, 0, false);          // UTC: 8:37 AM Local: 10:37 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 10, 4, 26, 0, false);          // UTC: 4:26 AM Local: 6:26 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 13, 19, 45, 0, false);         // UTC: 7:45 PM Local: 9:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 13, 9, 53, 0, false);          // UTC: 9:53 AM Local: 11:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 27, 4, 7, 0, false);           // UTC: 4:07 AM Local: 6:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 11, 2, 16, 0, false);          // UTC: 2:16 AM Local: 4:16 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 1, 5, 35, 0, false);           // UTC: 5:35 AM Local: 7:35 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 16, 19, 34, 0, false);         // UTC: 7:34 PM Local: 9:34 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 4, 15, 13, 0, false);          // UTC: 3:13 PM Local: 5:13 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 29, 16, 13, 0, false);         // UTC: 4:13 PM Local: 6:13 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 13, 4, 23, 0, false);          // UTC: 4:23 AM Local: 6:23 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 8, 23, 53, 0, false);          // UTC: 11:53 PM Local: 1:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 6, 3, 30, 0, false);           // UTC: 3:30 AM Local: 5:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 1, 12, 23, 0, false);          // UTC: 12:23 PM Local: 2:23 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 16, 8, 15, 0, false);          // UTC: 8:15 AM Local: 10:15 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 18, 7, 3, 0, false);           // UTC: 7:03 AM Local: 9:03 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 9, 16, 51, 0, false);          // UTC: 4:51 PM Local: 6:51 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 6, 1, 43, 0, false);           // UTC: 1:43 AM Local: 3:43 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 8, 4, 24, 0, false);           // UTC: 4:24 AM Local: 6:24 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 2, 19, 21, 21, 0, false);         // UTC: 9:21 PM Local: 11:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 27, 15, 29, 0, false);         // UTC: 3:29 PM Local: 5:29 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 17, 23, 46, 0, false);         // UTC: 11:46 PM Local: 1:46 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 17, 7, 28, 0, false);          // UTC: 7:28 AM Local: 9:28 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 9, 17, 52, 0, false);          // UTC: 5:52 PM Local: 7:52 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 25, 4, 9, 0, false);           // UTC: 4:09 AM Local: 6:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 26, 9, 18, 0, false);          // UTC: 9:18 AM Local: 11:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 19, 17, 57, 0, false);         // UTC: 5:57 PM Local: 7:57 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 3, 2, 11, 0, false);           // UTC: 2:11 AM Local: 4:11 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 17, 4, 39, 0, false);          // UTC: 4:39 AM Local: 6:39 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 9, 9, 38, 0, false);           // UTC: 9:38 AM Local: 11:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 9, 20, 19, 0, false);          // UTC: 8:19 PM Local: 10:19 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 25, 16, 52, 0, false);         // UTC: 4:52 PM Local: 6:52 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 24, 15, 32, 0, false);         // UTC: 3:32 PM Local: 5:32 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 13, 4, 51, 0, false);          // UTC: 4:51 AM Local: 6:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 2, 19, 49, 0, false);          // UTC: 7:49 PM Local: 9:49 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 29, 11, 5, 0, true);           // UTC: 11:05 AM Local: 2:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 15, 17, 22, 0, false);         // UTC: 5:22 PM Local: 7:22 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 14, 4, 18, 0, false);          // UTC: 4:18 AM Local: 6:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 19, 10, 24, 0, false);         // UTC: 10:24 AM Local: 12:24 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 11, 16, 32, 0, false);         // UTC: 4:32 PM Local: 6:32 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 13, 23, 43, 0, false);         // UTC: 11:43 PM Local: 1:43 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 4, 14, 18, 0, false);          // UTC: 2:18 PM Local: 4:18 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 21, 20, 38, 0, false);         // UTC: 8:38 PM Local: 10:38 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 30, 14, 43, 0, true);          // UTC: 2:43 PM Local: 5:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 3, 19, 14, 15, 0, false);         // UTC: 2:15 PM Local: 4:15 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 28, 0, 38, 0, true);           // UTC: 12:38 AM Local: 3:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 27, 19, 0, 0, true);           // UTC: 7:00 PM Local: 10:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 6, 19, 4, 0, true);            // UTC: 7:04 PM Local: 10:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 9, 22, 10, 0, true);           // UTC: 10:10 PM Local: 1:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 24, 4, 8, 0, true);            // UTC: 4:08 AM Local: 7:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 6, 21, 49, 0, true);           // UTC: 9:49 PM Local: 12:49 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 3, 1, 13, 0, true);            // UTC: 1:13 AM Local: 4:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 2, 12, 36, 0, true);           // UTC: 12:36 PM Local: 3:36 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 15, 21, 21, 0, true);          // UTC: 9:21 PM Local: 12:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 12, 12, 55, 0, true);          // UTC: 12:55 PM Local: 3:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 29, 0, 12, 0, true);           // UTC: 12:12 AM Local: 3:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 13, 12, 52, 0, true);          // UTC: 12:52 PM Local: 3:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 20, 5, 41, 0, true);           // UTC: 5:41 AM Local: 8:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 28, 12, 22, 0, true);          // UTC: 12:22 PM Local: 3:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 28, 20, 7, 0, true);           // UTC: 8:07 PM Local: 11:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 23, 20, 10, 0, true);          // UTC: 8:10 PM Local: 11:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 3, 11, 43, 0, true);           // UTC: 11:43 AM Local: 2:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 15, 13, 38, 0, true);          // UTC: 1:38 PM Local: 4:38 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 13, 16, 37, 0, true);          // UTC: 4:37 PM Local: 7:37 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 5, 7, 13, 0, true);            // UTC: 7:13 AM Local: 10:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 14, 10, 55, 0, true);          // UTC: 10:55 AM Local: 1:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 3, 3, 49, 0, true);            // UTC: 3:49 AM Local: 6:49 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 28, 9, 46, 0, true);           // UTC: 9:46 AM Local: 12:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 2, 7, 32, 0, true);            // UTC: 7:32 AM Local: 10:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 4, 19, 19, 2, 0, true);           // UTC: 7:02 PM Local: 10:02 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 3, 6, 39, 0, true);            // UTC: 6:39 AM Local: 9:39 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 9, 0, 38, 0, true);            // UTC: 12:38 AM Local: 3:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 6, 18, 24, 0, true);           // UTC: 6:24 PM Local: 9:24 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 18, 21, 10, 0, true);          // UTC: 9:10 PM Local: 12:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 30, 16, 54, 0, true);          // UTC: 4:54 PM Local: 7:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 24, 12, 55, 0, true);          // UTC: 12:55 PM Local: 3:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 16, 11, 21, 0, true);          // UTC: 11:21 AM Local: 2:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 15, 1, 44, 0, true);           // UTC: 1:44 AM Local: 4:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 20, 14, 6, 0, true);           // UTC: 2:06 PM Local: 5:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 26, 18, 43, 0, true);          // UTC: 6:43 PM Local: 9:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 4, 2, 43, 0, true);            // UTC: 2:43 AM Local: 5:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 2, 9, 37, 0, true);            // UTC: 9:37 AM Local: 12:37 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 25, 18, 50, 0, true);          // UTC: 6:50 PM Local: 9:50 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 13, 3, 3, 0, true);            // UTC: 3:03 AM Local: 6:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 24, 20, 21, 0, true);          // UTC: 8:21 PM Local: 11:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 13, 13, 37, 0, true);          // UTC: 1:37 PM Local: 4:37 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 26, 3, 56, 0, true);           // UTC: 3:56 AM Local: 6:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 10, 14, 21, 0, true);          // UTC: 2:21 PM Local: 5:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 17, 16, 28, 0, true);          // UTC: 4:28 PM Local: 7:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 14, 18, 23, 0, true);          // UTC: 6:23 PM Local: 9:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 17, 1, 49, 0, true);           // UTC: 1:49 AM Local: 4:49 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 10, 7, 57, 0, true);           // UTC: 7:57 AM Local: 10:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 26, 18, 20, 0, true);          // UTC: 6:20 PM Local: 9:20 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 11, 21, 32, 0, true);          // UTC: 9:32 PM Local: 12:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 5, 6, 15, 26, 0, true);           // UTC: 3:26 PM Local: 6:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 28, 0, 37, 0, true);           // UTC: 12:37 AM Local: 3:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 11, 19, 13, 0, true);          // UTC: 7:13 PM Local: 10:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 8, 4, 22, 0, true);            // UTC: 4:22 AM Local: 7:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 16, 0, 29, 0, true);           // UTC: 12:29 AM Local: 3:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 5, 8, 44, 0, true);            // UTC: 8:44 AM Local: 11:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 11, 12, 58, 0, true);          // UTC: 12:58 PM Local: 3:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 17, 4, 52, 0, true);           // UTC: 4:52 AM Local: 7:52 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 17, 22, 51, 0, true);          // UTC: 10:51 PM Local: 1:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 7, 8, 47, 0, true);            // UTC: 8:47 AM Local: 11:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 4, 21, 59, 0, true);           // UTC: 9:59 PM Local: 12:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 19, 14, 32, 0, true);          // UTC: 2:32 PM Local: 5:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 20, 16, 38, 0, true);          // UTC: 4:38 PM Local: 7:38 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 27, 1, 53, 0, true);           // UTC: 1:53 AM Local: 4:53 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 13, 21, 8, 0, true);           // UTC: 9:08 PM Local: 12:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 9, 19, 49, 0, true);           // UTC: 7:49 PM Local: 10:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 16, 18, 46, 0, true);          // UTC: 6:46 PM Local: 9:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 16, 15, 17, 0, true);          // UTC: 3:17 PM Local: 6:17 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 27, 2, 18, 0, true);           // UTC: 2:18 AM Local: 5:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 2, 2, 25, 0, true);            // UTC: 2:25 AM Local: 5:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 28, 16, 50, 0, true);          // UTC: 4:50 PM Local: 7:50 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 21, 7, 42, 0, true);           // UTC: 7:42 AM Local: 10:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 15, 16, 41, 0, true);          // UTC: 4:41 PM Local: 7:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 12, 14, 46, 0, true);          // UTC: 2:46 PM Local: 5:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 18, 3, 13, 0, true);           // UTC: 3:13 AM Local: 6:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 6, 8, 18, 6, 0, true);            // UTC: 6:06 PM Local: 9:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 15, 8, 50, 0, true);           // UTC: 8:50 AM Local: 11:50 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 31, 22, 15, 0, true);          // UTC: 10:15 PM Local: 1:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 12, 4, 32, 0, true);           // UTC: 4:32 AM Local: 7:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 1, 21, 23, 0, true);           // UTC: 9:23 PM Local: 12:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 10, 20, 35, 0, true);          // UTC: 8:35 PM Local: 11:35 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 26, 3, 22, 0, true);           // UTC: 3:22 AM Local: 6:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 14, 22, 27, 0, true);          // UTC: 10:27 PM Local: 1:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 13, 22, 13, 0, true);          // UTC: 10:13 PM Local: 1:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 7, 16, 43, 0, true);           // UTC: 4:43 PM Local: 7:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 6, 3, 14, 0, true);            // UTC: 3:14 AM Local: 6:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 31, 17, 5, 0, true);           // UTC: 5:05 PM Local: 8:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 24, 20, 22, 0, true);          // UTC: 8:22 PM Local: 11:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 24, 0, 35, 0, true);           // UTC: 12:35 AM Local: 3:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 7, 8, 38, 0, true);            // UTC: 8:38 AM Local: 11:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 12, 0, 57, 0, true);           // UTC: 12:57 AM Local: 3:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 6, 14, 43, 0, true);           // UTC: 2:43 PM Local: 5:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 18, 5, 8, 0, true);            // UTC: 5:08 AM Local: 8:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 16, 9, 52, 0, true);           // UTC: 9:52 AM Local: 12:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 22, 19, 10, 0, true);          // UTC: 7:10 PM Local: 10:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 27, 4, 39, 0, true);           // UTC: 4:39 AM Local: 7:39 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 18, 4, 14, 0, true);           // UTC: 4:14 AM Local: 7:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 26, 8, 25, 0, true);           // UTC: 8:25 AM Local: 11:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 8, 0, 37, 0, true);            // UTC: 12:37 AM Local: 3:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 12, 13, 54, 0, true);          // UTC: 1:54 PM Local: 4:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 7, 12, 8, 1, 0, true);            // UTC: 8:01 AM Local: 11:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 25, 13, 31, 0, true);          // UTC: 1:31 PM Local: 4:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 7, 6, 23, 0, true);            // UTC: 6:23 AM Local: 9:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 22, 2, 37, 0, true);           // UTC: 2:37 AM Local: 5:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 5, 5, 42, 0, true);            // UTC: 5:42 AM Local: 8:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 22, 14, 22, 0, true);          // UTC: 2:22 PM Local: 5:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 12, 4, 9, 0, true);            // UTC: 4:09 AM Local: 7:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 24, 7, 17, 0, true);           // UTC: 7:17 AM Local: 10:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 11, 8, 17, 0, true);           // UTC: 8:17 AM Local: 11:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 23, 20, 44, 0, true);          // UTC: 8:44 PM Local: 11:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 8, 20, 3, 0, true);            // UTC: 8:03 PM Local: 11:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 1, 17, 33, 0, true);           // UTC: 5:33 PM Local: 8:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 24, 4, 21, 0, true);           // UTC: 4:21 AM Local: 7:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 3, 16, 10, 0, true);           // UTC: 4:10 PM Local: 7:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 18, 4, 57, 0, true);           // UTC: 4:57 AM Local: 7:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 21, 0, 19, 0, true);           // UTC: 12:19 AM Local: 3:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 4, 3, 13, 0, true);            // UTC: 3:13 AM Local: 6:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 5, 22, 0, 0, true);            // UTC: 10:00 PM Local: 1:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 4, 5, 35, 0, true);            // UTC: 5:35 AM Local: 8:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 10, 9, 25, 0, true);           // UTC: 9:25 AM Local: 12:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 24, 21, 17, 0, true);          // UTC: 9:17 PM Local: 12:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 2, 15, 59, 0, true);           // UTC: 3:59 PM Local: 6:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 12, 0, 43, 0, true);           // UTC: 12:43 AM Local: 3:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 21, 12, 30, 0, true);          // UTC: 12:30 PM Local: 3:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 22, 11, 57, 0, true);          // UTC: 11:57 AM Local: 2:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 8, 19, 22, 45, 0, true);          // UTC: 10:45 PM Local: 1:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 9, 13, 11, 0, true);           // UTC: 1:11 PM Local: 4:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 1, 1, 51, 0, true);            // UTC: 1:51 AM Local: 4:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 18, 11, 27, 0, true);          // UTC: 11:27 AM Local: 2:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 11, 10, 18, 0, true);          // UTC: 10:18 AM Local: 1:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 13, 21, 8, 0, true);           // UTC: 9:08 PM Local: 12:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 14, 2, 0, 0, true);            // UTC: 2:00 AM Local: 5:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 10, 1, 28, 0, true);           // UTC: 1:28 AM Local: 4:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 23, 5, 7, 0, true);            // UTC: 5:07 AM Local: 8:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 24, 10, 0, 0, true);           // UTC: 10:00 AM Local: 1:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 11, 9, 20, 0, true);           // UTC: 9:20 AM Local: 12:20 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 13, 15, 40, 0, true);          // UTC: 3:40 PM Local: 6:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 27, 23, 30, 0, true);          // UTC: 11:30 PM Local: 2:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 22, 17, 12, 0, true);          // UTC: 5:12 PM Local: 8:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 8, 0, 3, 0, true);             // UTC: 12:03 AM Local: 3:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 15, 18, 3, 0, true);           // UTC: 6:03 PM Local: 9:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 1, 13, 30, 0, true);           // UTC: 1:30 PM Local: 4:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 30, 14, 6, 0, true);           // UTC: 2:06 PM Local: 5:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 30, 16, 15, 0, true);          // UTC: 4:15 PM Local: 7:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 25, 20, 8, 0, true);           // UTC: 8:08 PM Local: 11:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 23, 2, 11, 0, true);           // UTC: 2:11 AM Local: 5:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 25, 4, 21, 0, true);           // UTC: 4:21 AM Local: 7:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 6, 23, 34, 0, true);           // UTC: 11:34 PM Local: 2:34 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 25, 11, 21, 0, true);          // UTC: 11:21 AM Local: 2:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 8, 12, 53, 0, true);           // UTC: 12:53 PM Local: 3:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 9, 14, 4, 6, 0, true);            // UTC: 4:06 AM Local: 7:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 15, 18, 18, 0, true);         // UTC: 6:18 PM Local: 9:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 24, 13, 10, 0, true);         // UTC: 1:10 PM Local: 4:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 15, 4, 35, 0, true);          // UTC: 4:35 AM Local: 7:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 30, 20, 2, 0, false);         // UTC: 8:02 PM Local: 10:02 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 25, 21, 45, 0, false);        // UTC: 9:45 PM Local: 11:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 31, 11, 53, 0, false);        // UTC: 11:53 AM Local: 1:53 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 26, 16, 28, 0, false);        // UTC: 4:28 PM Local: 6:28 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 27, 17, 21, 0, false);        // UTC: 5:21 PM Local: 7:21 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 6, 16, 43, 0, true);          // UTC: 4:43 PM Local: 7:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 17, 2, 22, 0, true);          // UTC: 2:22 AM Local: 5:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 8, 9, 56, 0, true);           // UTC: 9:56 AM Local: 12:56 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 10, 9, 19, 0, true);          // UTC: 9:19 AM Local: 12:19 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 4, 18, 58, 0, true);          // UTC: 6:58 PM Local: 9:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 28, 12, 34, 0, false);        // UTC: 12:34 PM Local: 2:34 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 19, 7, 12, 0, true);          // UTC: 7:12 AM Local: 10:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 22, 13, 36, 0, true);         // UTC: 1:36 PM Local: 4:36 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 26, 14, 5, 0, false);         // UTC: 2:05 PM Local: 4:05 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 28, 8, 36, 0, false);         // UTC: 8:36 AM Local: 10:36 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 18, 13, 24, 0, true);         // UTC: 1:24 PM Local: 4:24 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 29, 4, 32, 0, false);         // UTC: 4:32 AM Local: 6:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 12, 15, 52, 0, true);         // UTC: 3:52 PM Local: 6:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 7, 3, 13, 0, true);           // UTC: 3:13 AM Local: 6:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 19, 15, 41, 0, true);         // UTC: 3:41 PM Local: 6:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 5, 2, 56, 0, true);           // UTC: 2:56 AM Local: 5:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 10, 7, 15, 43, 0, true);          // UTC: 3:43 PM Local: 6:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 5, 3, 41, 0, false);          // UTC: 3:41 AM Local: 5:41 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 23, 19, 17, 0, false);        // UTC: 7:17 PM Local: 9:17 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 11, 6, 30, 0, false);         // UTC: 6:30 AM Local: 8:30 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 24, 12, 35, 0, false);        // UTC: 12:35 PM Local: 2:35 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 20, 22, 18, 0, false);        // UTC: 10:18 PM Local: 12:18 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 1, 6, 27, 0, false);          // UTC: 6:27 AM Local: 8:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 24, 9, 6, 0, false);          // UTC: 9:06 AM Local: 11:06 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 9, 0, 44, 0, false);          // UTC: 12:44 AM Local: 2:44 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 27, 12, 13, 0, false);        // UTC: 12:13 PM Local: 2:13 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 19, 21, 46, 0, false);        // UTC: 9:46 PM Local: 11:46 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 22, 9, 9, 0, false);          // UTC: 9:09 AM Local: 11:09 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 20, 9, 3, 0, false);          // UTC: 9:03 AM Local: 11:03 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 14, 21, 22, 0, false);        // UTC: 9:22 PM Local: 11:22 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 30, 14, 55, 0, false);        // UTC: 2:55 PM Local: 4:55 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 27, 1, 24, 0, false);         // UTC: 1:24 AM Local: 3:24 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 14, 9, 7, 0, false);          // UTC: 9:07 AM Local: 11:07 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 12, 9, 56, 0, false);         // UTC: 9:56 AM Local: 11:56 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 26, 3, 32, 0, false);         // UTC: 3:32 AM Local: 5:32 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 6, 6, 51, 0, false);          // UTC: 6:51 AM Local: 8:51 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 30, 23, 0, 0, false);         // UTC: 11:00 PM Local: 1:00 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 5, 23, 27, 0, false);         // UTC: 11:27 PM Local: 1:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 8, 1, 43, 0, false);          // UTC: 1:43 AM Local: 3:43 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 28, 6, 56, 0, false);         // UTC: 6:56 AM Local: 8:56 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 8, 1, 8, 0, false);           // UTC: 1:08 AM Local: 3:08 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 11, 26, 7, 15, 0, false);         // UTC: 7:15 AM Local: 9:15 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 27, 4, 42, 0, false);         // UTC: 4:42 AM Local: 6:42 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 31, 12, 18, 0, false);        // UTC: 12:18 PM Local: 2:18 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 29, 17, 28, 0, false);        // UTC: 5:28 PM Local: 7:28 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 18, 17, 50, 0, false);        // UTC: 5:50 PM Local: 7:50 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 31, 11, 53, 0, false);        // UTC: 11:53 AM Local: 1:53 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 26, 17, 42, 0, false);        // UTC: 5:42 PM Local: 7:42 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 6, 1, 3, 0, false);           // UTC: 1:03 AM Local: 3:03 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 15, 20, 14, 0, false);        // UTC: 8:14 PM Local: 10:14 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 10, 10, 26, 0, false);        // UTC: 10:26 AM Local: 12:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 6, 17, 26, 0, false);         // UTC: 5:26 PM Local: 7:26 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 15, 8, 4, 0, false);          // UTC: 8:04 AM Local: 10:04 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 7, 20, 45, 0, false);         // UTC: 8:45 PM Local: 10:45 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 28, 3, 11, 0, false);         // UTC: 3:11 AM Local: 5:11 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 16, 11, 33, 0, false);        // UTC: 11:33 AM Local: 1:33 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 20, 23, 53, 0, false);        // UTC: 11:53 PM Local: 1:53 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 3, 2, 11, 0, false);          // UTC: 2:11 AM Local: 4:11 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 12, 3, 27, 0, false);         // UTC: 3:27 AM Local: 5:27 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 17, 11, 6, 0, false);         // UTC: 11:06 AM Local: 1:06 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 29, 22, 15, 0, false);        // UTC: 10:15 PM Local: 12:15 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 10, 2, 38, 0, false);         // UTC: 2:38 AM Local: 4:38 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 8, 11, 49, 0, false);         // UTC: 11:49 AM Local: 1:49 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 6, 15, 54, 0, false);         // UTC: 3:54 PM Local: 5:54 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 5, 2, 22, 0, false);          // UTC: 2:22 AM Local: 4:22 AM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 4, 11, 1, 0, false);          // UTC: 11:01 AM Local: 1:01 PM Offset: 02:00:00
+	testCount++; failedCount += test(timeManager, 13, 2020, 12, 7, 21, 22, 0, false);         // UTC: 9:22 PM Local: 11:22 PM Offset: 02:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
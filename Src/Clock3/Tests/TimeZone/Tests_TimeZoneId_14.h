@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_14_H
+#define TEST_TIMEZONEID_14_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_14_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 4, 19, 44, 0, false);          // UTC: 7:44 PM Local: 10:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 25, 20, 33, 0, false);         // UTC: 8:33 PM Local: 11:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 31, 7, 17, 0, false);          // UTC: 7:17 AM Local: 10:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 24, 8, 18, 0, false);          // UTC: 8:18 AM Local: 11:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 24, 2, 42, 0, false);          // UTC: 2:42 AM Local: 5:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 15, 9, 29, 0, false);          // UTC: 9:29 AM Local: 12:29 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 22, 12, 25, 0, false);         // UTC: 12:25 PM Local: 3:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 25, 3, 16, 0, false);          // UTC: 3:16 AM Local: 6:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 8, 10, 22, 0, false);          // UTC: 10:22 AM Local: 1:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 26, 8, 23, 0, false);          // UTC: 8:23 AM Local: 11:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 26, 20, 40, 0, false);         // UTC: 8:40 PM Local: 11:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 17, 4, 10, 0, false);          // UTC: 4:10 AM Local: 7:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 18, 21, 42, 0, false);         // UTC: 9:42 PM Local: 12:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 9, 5, 0, 0, false);            // UTC: 5:00 AM Local: 8:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 21, 2, 7, 0, false);           // UTC: 2:07 AM Local: 5:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 20, 10, 1, 0, false);          // UTC: 10:01 AM Local: 1:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 3, 8, 13, 0, false);           // UTC: 8:13 AM Local: 11:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 28, 12, 25, 0, false);         // UTC: 12:25 PM Local: 3:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 19, 14, 57, 0, false);         // UTC: 2:57 PM Local: 5:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 20, 3, 55, 0, false);          // UTC: 3:55 AM Local: 6:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 21, 21, 56, 0, false);         // UTC: 9:56 PM Local: 12:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 4, 18, 37, 0, false);          // UTC: 6:37 PM Local: 9:37 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 21, 20, 23, 0, false);         // UTC: 8:23 PM Local: 11:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 6, 3, 47, 0, false);           // UTC: 3:47 AM Local: 6:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 1, 28, 15, 32, 0, false);         // UTC: 3:32 PM Local: 6:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 22, 6, 17, 0, false);          // UTC: 6:17 AM Local: 9:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 15, 19, 13, 0, false);         // UTC: 7:13 PM Local: 10:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 16, 9, 32, 0, false);          // UTC: 9:32 AM Local: 12:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 9, 3, 7, 0, false);            // UTC: 3:07 AM Local: 6:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 27, 2, 17, 0, false);          // UTC: 2:17 AM Local: 5:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 9, 3, 1, 0, false);            // UTC: 3:01 AM Local: 6:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 6, 23, 26, 0, false);          // UTC: 11:26 PM Local: 2:26 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 4, 21, 33, 0, false);          // UTC: 9:33 PM Local: 12:33 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 19, 2, 27, 0, false);          // UTC: 2:27 AM Local: 5:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 16, 21, 10, 0, false);         // UTC: 9:10 PM Local: 12:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 18, 12, 29, 0, false);         // UTC: 12:29 PM Local: 3:29 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 10, 15, 29, 0, false);         // UTC: 3:29 PM Local: 6:29 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 14, 13, 38, 0, false);         // UTC: 1:38 PM Local: 4:38 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 27, 3, 16, 0, false);          // UTC: 3:16 AM Local: 6:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 16, 12, 15, 0, false);         // UTC: 12:15 PM Local: 3:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 15, 19, 31, 0, false);         // UTC: 7:31 PM Local: 10:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 3, 18, 9, 0, false);           // UTC: 6:09 PM Local: 9:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 16, 22, 17, 0, false);         // UTC: 10:17 PM Local: 1:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 19, 14, 1, 0, false);          // UTC: 2:01 PM Local: 5:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 27, 22, 25, 0, false);         // UTC: 10:25 PM Local: 1:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 14, 0, 22, 0, false);          // UTC: 12:22 AM Local: 3:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 23, 18, 23, 0, false);         // UTC: 6:23 PM Local: 9:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 16, 8, 22, 0, false);          // UTC: 8:22 AM Local: 11:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 10, 16, 12, 0, false);         // UTC: 4:12 PM Local: 7:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 2, 2, 20, 35, 0, false);          // UTC: 8:35 PM Local: 11:35 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 16, 8, 6, 0, false);           // UTC: 8:06 AM Local: 11:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 13, 3, 2, 0, false);           // UTC: 3:02 AM Local: 6:02 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 7, 9, 1, 0, false);            // UTC: 9:01 AM Local: 12:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 1, 18, 32, 0, false);          // UTC: 6:32 PM Local: 9:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 10, 16, 59, 0, false);         // UTC: 4:59 PM Local: 7:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 26, 11, 16, 0, false);         // UTC: 11:16 AM Local: 2:16 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 4, 1, 9, 0, false);            // UTC: 1:09 AM Local: 4:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 25, 6, 0, 0, false);           // UTC: 6:00 AM Local: 9:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 8, 8, 55, 0, false);           // UTC: 8:55 AM Local: 11:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 17, 8, 11, 0, false);          // UTC: 8:11 AM Local: 11:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 8, 6, 38, 0, false);           // UTC: 6:38 AM Local: 9:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 22, 10, 18, 0, false);         // UTC: 10:18 AM Local: 1:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 24, 11, 2, 0, false);          // UTC: 11:02 AM Local: 2:02 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 18, 19, 47, 0, false);         // UTC: 7:47 PM Local: 10:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 31, 5, 32, 0, false);          // UTC: 5:32 AM Local: 8:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 21, 6, 23, 0, false);          // UTC: 6:23 AM Local: 9:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 16, 12, 15, 0, false);         // UTC: 12:15 PM Local: 3:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 31, 12, 34, 0, false);         // UTC: 12:34 PM Local: 3:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 18, 10, 31, 0, false);         // UTC: 10:31 AM Local: 1:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 30, 19, 2, 0, false);          // UTC: 7:02 PM Local: 10:02 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 8, 20, 59, 0, false);          // UTC: 8:59 PM Local: 11:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 14, 15, 49, 0, false);         // UTC: 3:49 PM Local: 6:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 11, 2, 16, 0, false);          // UTC: 2:16 AM Local: 5:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 26, 3, 8, 0, false);           // UTC: 3:08 AM Local: 6:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 3, 7, 1, 44, 0, false);           // UTC: 1:44 AM Local: 4:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 30, 4, 13, 0, false);          // UTC: 4:13 AM Local: 7:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 9, 15, 28, 0, false);          // UTC: 3:28 PM Local: 6:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 5, 17, 57, 0, false);          // UTC: 5:57 PM Local: 8:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 13, 1, 50, 0, false);          // UTC: 1:50 AM Local: 4:50 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 4, 8, 45, 0, false);           // UTC: 8:45 AM Local: 11:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 12, 17, 27, 0, false);         // UTC: 5:27 PM Local: 8:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 14, 4, 28, 0, false);          // UTC: 4:28 AM Local: 7:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 8, 2, 9, 0, false);            // UTC: 2:09 AM Local: 5:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 26, 23, 11, 0, false);         // UTC: 11:11 PM Local: 2:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 5, 0, 42, 0, false);           // UTC: 12:42 AM Local: 3:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 30, 7, 41, 0, false);          // UTC: 7:41 AM Local: 10:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 28, 21, 52, 0, false);         // UTC: 9:52 PM Local: 12:52 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 12, 19, 42, 0, false);         // UTC: 7:42 PM Local: 10:42 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 27, 17, 45, 0, false);         // UTC: 5:45 PM Local: 8:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 2, 18, 26, 0, false);          // UTC: 6:26 PM Local: 9:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 15, 8, 30, 0, false);          // UTC: 8:30 AM Local: 11:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 11, 2, 55, 0, false);          // UTC: 2:55 AM Local: 5:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 12, 1, 43, 0, false);          // UTC: 1:43 AM Local: 4:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 21, 20, 34, 0, false);         // UTC: 8:34 PM Local: 11:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 27, 3, 58, 0, false);          // UTC: 3:58 AM Local: 6:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 28, 2, 27, 0, false);          // UTC: 2:27 AM Local: 5:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 27, 3, 55, 0, false);          // UTC: 3:55 AM Local: 6:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 2, 20, 59, 0, false);          // UTC: 8:59 PM Local: 11:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 6, 2, 0, 0, false);            // UTC: 2:00 AM Local: 5:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 4, 26, 21, 19, 0, false);         // UTC: 9:19 PM Local: 12:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 2, 4, 24, 0, false);           // UTC: 4:24 AM Local: 7:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 29, 18, 9, 0, false);          // UTC: 6:09 PM Local: 9:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 1, 14, 29, 0, false);          // UTC: 2:29 PM Local: 5:29 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 26, 15, 45, 0, false);         // UTC: 3:45 PM Local: 6:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 17, 0, 18, 0, false);          // UTC: 12:18 AM Local: 3:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 3, 8, 15, 0, false);           // UTC: 8:15 AM Local: 11:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 10, 21, 37, 0, false);         // UTC: 9:37 PM Local: 12:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 21, 16, 0, 0, false);          // UTC: 4:00 PM Local: 7:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 18, 7, 46, 0, false);          // UTC: 7:46 AM Local: 10:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 1, 11, 57, 0, false);          // UTC: 11:57 AM Local: 2:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 4, 3, 25, 0, false);           // UTC: 3:25 AM Local: 6:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 13, 14, 18, 0, false);         // UTC: 2:18 PM Local: 5:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 12, 23, 59, 0, false);         // UTC: 11:59 PM Local: 2:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 11, 0, 16, 0, false);          // UTC: 12:16 AM Local: 3:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 5, 9, 36, 0, false);           // UTC: 9:36 AM Local: 12:36 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 26, 22, 19, 0, false);         // UTC: 10:19 PM Local: 1:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 31, 6, 33, 0, false);          // UTC: 6:33 AM Local: 9:33 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 19, 14, 1, 0, false);          // UTC: 2:01 PM Local: 5:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 29, 20, 4, 0, false);          // UTC: 8:04 PM Local: 11:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 15, 10, 36, 0, false);         // UTC: 10:36 AM Local: 1:36 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 13, 19, 27, 0, false);         // UTC: 7:27 PM Local: 10:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 9, 21, 48, 0, false);          // UTC: 9:48 PM Local: 12:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 31, 13, 12, 0, false);         // UTC: 1:12 PM Local: 4:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 26, 0, 24, 0, false);          // UTC: 12:24 AM Local: 3:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 5, 28, 22, 30, 0, false);         // UTC: 10:30 PM Local: 1:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 8, 12, 52, 0, false);          // UTC: 12:52 PM Local: 3:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 17, 3, 48, 0, false);          // UTC: 3:48 AM Local: 6:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 8, 7, 12, 0, false);           // UTC: 7:12 AM Local: 10:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 9, 2, 15, 0, false);           // UTC: 2:15 AM Local: 5:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 26, 2, 29, 0, false);          // UTC: 2:29 AM Local: 5:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 28, 21, 35, 0, false);         // UTC: 9:35 PM Local: 12:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 2, 0, 12, 0, false);           // UTC: 12:12 AM Local: 3:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 22, 21, 38, 0, false);         // UTC: 9:38 PM Local: 12:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 21, 9, 49, 0, false);          // UTC: 9:49 AM Local: 12:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 14, 14, 14, 0, false);         // UTC: 2:14 PM Local: 5:14 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 29, 23, 4, 0, false);          // UTC: 11:04 PM Local: 2:04 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 21, 2, 45, 0, false);          // UTC: 2:45 AM Local: 5:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 23, 5, 45, 0, false);          // UTC: 5:45 AM Local: 8:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 12, 14, 44, 0, false);         // UTC: 2:44 PM Local: 5:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 7, 12, 6, 0, false);           // UTC: 12:06 PM Local: 3:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 20, 11, 30, 0, false);         // UTC: 11:30 AM Local: 2:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 7, 21, 22, 0, false);          // UTC: 9:22 PM Local: 12:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 11, 15, 34, 0, false);         // UTC: 3:34 PM Local: 6:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 27, 9, 3, 0, false);           // UTC: 9:03 AM Local: 12:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 6, 19, 40, 0, false);          // UTC: 7:40 PM Local: 10:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 15, 4, 57, 0, false);          // UTC: 4:57 AM Local: 7:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 28, 8, 30, 0, false);          // UTC: 8:30 AM Local: 11:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 29, 9, 34, 0, false);          // UTC: 9:34 AM Local: 12:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 2, 4, 3, 0, false);            // UTC: 4:03 AM Local: 7:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 6, 17, 0, 43, 0, false);          // UTC: 12:43 AM Local: 3:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 10, 15, 23, 0, false);         // UTC: 3:23 PM Local: 6:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 21, 9, 23, 0, false);          // UTC: 9:23 AM Local: 12:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 22, 23, 11, 0, false);         // UTC: 11:11 PM Local: 2:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 5, 0, 13, 0, false);           // UTC: 12:13 AM Local: 3:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 17, 2, 8, 0, false);           // UTC: 2:08 AM Local: 5:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 29, 18, 14, 0, false);         // UTC: 6:14 PM Local: 9:14 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 29, 9, 54, 0, false);          // UTC: 9:54 AM Local: 12:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 13, 18, 30, 0, false);         // UTC: 6:30 PM Local: 9:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 27, 19, 51, 0, false);         // UTC: 7:51 PM Local: 10:51 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 12, 5, 22, 0, false);          // UTC: 5:22 AM Local: 8:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 8, 17, 40, 0, false);          // UTC: 5:40 PM Local: 8:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 12, 10, 52, 0, false);         // UTC: 10:52 AM Local: 1:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 17, 13, 7, 0, false);          // UTC: 1:07 PM Local: 4:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 1, 1, 19, 0, false);           // UTC: 1:19 AM Local: 4:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 28, 8, 10, 0, false);          // UTC: 8:10 AM Local: 11:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 10, 6, 51, 0, false);          // UTC: 6:51 AM Local: 9:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 26, 6, 7, 0, false);           // UTC: 6:07 AM Local: 9:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 17, 23, 14, 0, false);         // UTC: 11:14 PM Local: 2:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 30, 12, 18, 0, false);         // UTC: 12:18 PM Local: 3:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 20, 14, 7, 0, false);          // UTC: 2:07 PM Local: 5:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 13, 3, 28, 0, false);          // UTC: 3:28 AM Local: 6:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 25, 19, 48, 0, false);         // UTC: 7:48 PM Local: 10:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 26, 2, 45, 0, false);          // UTC: 2:45 AM Local: 5:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 27, 17, 52, 0, false);         // UTC: 5:52 PM Local: 8:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 7, 30, 7, 3, 0, false);           // UTC: 7:03 AM Local: 10:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 19, 17, 13, 0, false);         // UTC: 5:13 PM Local: 8:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 18, 17, 48, 0, false);         // UTC: 5:48 PM Local: 8:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 19, 12, 12, 0, false);         // UTC: 12:12 PM Local: 3:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 18, 2, 8, 0, false);           // UTC: 2:08 AM Local: 5:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 12, 20, 30, 0, false);         // UTC: 8:30 PM Local: 11:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 27, 3, 5, 0, false);           // UTC: 3:05 AM Local: 6:05 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 25, 23, 5, 0, false);          // UTC: 11:05 PM Local: 2:05 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 28, 17, 37, 0, false);         // UTC: 5:37 PM Local: 8:37 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 8, 7, 57, 0, false);           // UTC: 7:57 AM Local: 10:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 31, 3, 8, 0, false);           // UTC: 3:08 AM Local: 6:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 16, 17, 30, 0, false);         // UTC: 5:30 PM Local: 8:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 11, 12, 32, 0, false);         // UTC: 12:32 PM Local: 3:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 3, 20, 42, 0, false);          // UTC: 8:42 PM Local: 11:42 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 29, 11, 7, 0, false);          // UTC: 11:07 AM Local: 2:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 29, 16, 21, 0, false);         // UTC: 4:21 PM Local: 7:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 28, 8, 10, 0, false);          // UTC: 8:10 AM Local: 11:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 15, 15, 45, 0, false);         // UTC: 3:45 PM Local: 6:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 25, 3, 40, 0, false);          // UTC: 3:40 AM Local: 6:40 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 12, 1, 34, 0, false);          // UTC: 1:34 AM Local: 4:34 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 15, 10, 0, 0, false);          // UTC: 10:00 AM Local: 1:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 25, 1, 34, 0, false);          // UTC: 1:34 AM Local: 4:34 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 13, 6, 15, 0, false);          // UTC: 6:15 AM Local: 9:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 18, 3, 22, 0, false);          // UTC: 3:22 AM Local: 6:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 17, 22, 50, 0, false);         // UTC: 10:50 PM Local: 1:50 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 8, 30, 5, 58, 0, false);          // UTC: 5:58 AM Local: 8:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 9, 13, 3, 0, false);           // UTC: 1:03 PM Local: 4:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 6, 2, 27, 0, false);           // UTC: 2:27 AM Local: 5:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 21, 10, 30, 0, false);         // UTC: 10:30 AM Local: 1:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 27, 6, 35, 0, false);          // UTC: 6:35 AM Local: 9:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 29, 22, 56, 0, false);         // UTC: 10:56 PM Local: 1:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 14, 4, 48, 0, false);          // UTC: 4:48 AM Local: 7:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 18, 17, 48, 0, false);         // UTC: 5:48 PM Local: 8:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 23, 13, 19, 0, false);         // UTC: 1:19 PM Local: 4:19 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 23, 7, 51, 0, false);          // UTC: 7:51 AM Local: 10:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 10, 6, 10, 0, false);          // UTC: 6:10 AM Local: 9:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 23, 20, 7, 0, false);          // UTC: 8:07 PM Local: 11:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 9, 7, 32, 0, false);           // UTC: 7:32 AM Local: 10:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 21, 1, 13, 0, false);          // UTC: 1:13 AM Local: 4:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 5, 6, 25, 0, false);           // UTC: 6:25 AM Local: 9:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 9, 3, 14, 0, false);           // UTC: 3:14 AM Local: 6:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 8, 0, 12, 0, false);           // UTC: 12:12 AM Local: 3:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 24, 21, 42, 0, false);         // UTC: 9:42 PM Local: 12:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 25, 9, 2, 0, false);           // UTC: 9:02 AM Local: 12:02 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 29, 8, 35, 0, false);          // UTC: 8:35 AM Local: 11:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 8, 7, 21, 0, false);           // UTC: 7:21 AM Local: 10:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 5, 7, 3, 0, false);            // UTC: 7:03 AM Local: 10:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 26, 8, 52, 0, false);          // UTC: 8:52 AM Local: 11:52 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 6, 0, 35, 0, false);           // UTC: 12:35 AM Local: 3:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 28, 13, 40, 0, false);         // UTC: 1:40 PM Local: 4:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 9, 17, 8, 31, 0, false);          // UTC: 8:31 AM Local: 11:31 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 15, 7, 47, 0, false);         // UTC: 7:47 AM Local: 10:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 2, 15, 56, 0, false);         // UTC: 3:56 PM Local: 6:56 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 5, 14, 13, 0, false);         // UTC: 2:13 PM Local: 5:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 23, 23, 41, 0, false);        // UTC: 11:41 PM Local: 2:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 9, 6, 32, 0, false);          // UTC: 6:32 AM Local: 9:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 19, 20, 19, 0, false);        // UTC: 8:19 PM Local: 11:19 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 30, 3, 31, 0, false);         // UTC: 3:31 AM Local: 6:31 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 21, 12, 1, 0, false);         // UTC: 12:01 PM Local: 3:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 16, 17, 20, 0, false);        // UTC: 5:20 PM Local: 8:20 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 14, 10, 18, 0, false);        // UTC: 10:18 AM Local: 1:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 18, 10, 53, 0, false);        // UTC: 10:53 AM Local: 1:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 18, 2, 51, 0, false);         // UTC: 2:51 AM Local: 5:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 21, 0, 21, 0, false);         // UTC: 12:21 AM Local: 3:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 3, 7, 10, 0, false);          // UTC: 7:10 AM Local: 10:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 31, 6, 28, 0, false);         // UTC: 6:28 AM Local: 9:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 9, 14, 31, 0, false);         // UTC: 2:31 PM Local: 5:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 30, 22, 24, 0, false);        // UTC: 10:24 PM Local: 1:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 25, 12, 0, 0, false);         // UTC: 12:00 PM Local: 3:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 13, 18, 15, 0, false);        // UTC: 6:15 PM Local: 9:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 28, 22, 4, 0, false);         // UTC: 10:04 PM Local: 1:04 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 10, 2, 32, 0, false);         // UTC: 2:32 AM Local: 5:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 20, 18, 13, 0, false);        // UTC: 6:13 PM Local: 9:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 25, 21, 47, 0, false);        // UTC: 9:47 PM Local: 12:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 17, 15, 51, 0, false);        // UTC: 3:51 PM Local: 6:51 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 10, 31, 13, 45, 0, false);        // UTC: 1:45 PM Local: 4:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 26, 14, 21, 0, false);        // UTC: 2:21 PM Local: 5:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 12, 12, 55, 0, false);        // UTC: 12:55 PM Local: 3:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 19, 15, 45, 0, false);        // UTC: 3:45 PM Local: 6:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 24, 8, 24, 0, false);         // UTC: 8:24 AM Local: 11:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 9, 11, 11, 0, false);         // UTC: 11:11 AM Local: 2:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 1, 4, 46, 0, false);          // UTC: 4:46 AM Local: 7:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 10, 3, 31, 0, false);         // UTC: 3:31 AM Local: 6:31 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 27, 23, 59, 0, false);        // UTC: 11:59 PM Local: 2:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 27, 20, 31, 0, false);        // UTC: 8:31 PM Local: 11:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 22, 1, 14, 0, false);         // UTC: 1:14 AM Local: 4:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 16, 0, 3, 0, false);          // UTC: 12:03 AM Local: 3:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 5, 13, 41, 0, false);         // UTC: 1:41 PM Local: 4:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 30, 5, 38, 0, false);         // UTC: 5:38 AM Local: 8:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 7, 22, 11, 0, false);         // UTC: 10:11 PM Local: 1:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 13, 1, 13, 0, false);         // UTC: 1:13 AM Local: 4:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 10, 4, 59, 0, false);         // UTC: 4:59 AM Local: 7:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 27, 1, 20, 0, false);         // UTC: 1:20 AM Local: 4:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 11, 2, 32, 0, false);         // UTC: 2:32 AM Local: 5:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 7, 0, 6, 0, false);           // UTC: 12:06 AM Local: 3:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 24, 2, 35, 0, false);         // UTC: 2:35 AM Local: 5:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 25, 0, 48, 0, false);         // UTC: 12:48 AM Local: 3:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 8, 17, 26, 0, false);         // UTC: 5:26 PM Local: 8:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 5, 1, 21, 0, false);          // UTC: 1:21 AM Local: 4:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 11, 18, 38, 0, false);        // UTC: 6:38 PM Local: 9:38 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 11, 26, 13, 39, 0, false);        // UTC: 1:39 PM Local: 4:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 14, 19, 1, 0, false);         // UTC: 7:01 PM Local: 10:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 21, 17, 30, 0, false);        // UTC: 5:30 PM Local: 8:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 1, 1, 1, 0, false);           // UTC: 1:01 AM Local: 4:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 31, 3, 45, 0, false);         // UTC: 3:45 AM Local: 6:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 14, 6, 39, 0, false);         // UTC: 6:39 AM Local: 9:39 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 20, 0, 51, 0, false);         // UTC: 12:51 AM Local: 3:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 21, 4, 6, 0, false);          // UTC: 4:06 AM Local: 7:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 10, 10, 1, 0, false);         // UTC: 10:01 AM Local: 1:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 2, 17, 46, 0, false);         // UTC: 5:46 PM Local: 8:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 7, 14, 49, 0, false);         // UTC: 2:49 PM Local: 5:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 22, 10, 11, 0, false);        // UTC: 10:11 AM Local: 1:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 8, 9, 17, 0, false);          // UTC: 9:17 AM Local: 12:17 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 27, 15, 26, 0, false);        // UTC: 3:26 PM Local: 6:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 7, 15, 43, 0, false);         // UTC: 3:43 PM Local: 6:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 24, 6, 32, 0, false);         // UTC: 6:32 AM Local: 9:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 6, 19, 31, 0, false);         // UTC: 7:31 PM Local: 10:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 8, 8, 30, 0, false);          // UTC: 8:30 AM Local: 11:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 6, 1, 5, 0, false);           // UTC: 1:05 AM Local: 4:05 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 22, 12, 21, 0, false);        // UTC: 12:21 PM Local: 3:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 16, 5, 11, 0, false);         // UTC: 5:11 AM Local: 8:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 26, 18, 33, 0, false);        // UTC: 6:33 PM Local: 9:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 14, 10, 41, 0, false);        // UTC: 10:41 AM Local: 1:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 30, 9, 27, 0, false);         // UTC: 9:27 AM Local: 12:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 25, 17, 21, 0, false);        // UTC: 5:21 PM Local: 8:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2018, 12, 1, 1, 22, 0, false);          // UTC: 1:22 AM Local: 4:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 2, 17, 32, 0, false);          // UTC: 5:32 PM Local: 8:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 26, 7, 1, 0, false);           // UTC: 7:01 AM Local: 10:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 18, 0, 58, 0, false);          // UTC: 12:58 AM Local: 3:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 2, 10, 4, 0, false);           // UTC: 10:04 AM Local: 1:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 17, 5, 48, 0, false);          // UTC: 5:48 AM Local: 8:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 11, 19, 31, 0, false);         // UTC: 7:31 PM Local: 10:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 13, 23, 24, 0, false);         // UTC: 11:24 PM Local: 2:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 19, 4, 21, 0, false);          // UTC: 4:21 AM Local: 7:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 13, 6, 7, 0, false);           // UTC: 6:07 AM Local: 9:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 5, 17, 57, 0, false);          // UTC: 5:57 PM Local: 8:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 13, 12, 54, 0, false);         // UTC: 12:54 PM Local: 3:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 7, 9, 7, 0, false);            // UTC: 9:07 AM Local: 12:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 28, 22, 22, 0, false);         // UTC: 10:22 PM Local: 1:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 21, 2, 38, 0, false);          // UTC: 2:38 AM Local: 5:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 10, 20, 32, 0, false);         // UTC: 8:32 PM Local: 11:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 29, 8, 42, 0, false);          // UTC: 8:42 AM Local: 11:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 18, 9, 28, 0, false);          // UTC: 9:28 AM Local: 12:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 8, 1, 59, 0, false);           // UTC: 1:59 AM Local: 4:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 24, 19, 40, 0, false);         // UTC: 7:40 PM Local: 10:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 15, 3, 24, 0, false);          // UTC: 3:24 AM Local: 6:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 29, 3, 24, 0, false);          // UTC: 3:24 AM Local: 6:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 13, 10, 7, 0, false);          // UTC: 10:07 AM Local: 1:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 31, 10, 5, 0, false);          // UTC: 10:05 AM Local: 1:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 10, 20, 47, 0, false);         // UTC: 8:47 PM Local: 11:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 1, 8, 9, 55, 0, false);           // UTC: 9:55 AM Local: 12:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 27, 6, 53, 0, false);          // UTC: 6:53 AM Local: 9:53 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 4, 10, 31, 0, false);          // UTC: 10:31 AM Local: 1:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 23, 14, 58, 0, false);         // UTC: 2:58 PM Local: 5:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 25, 1, 17, 0, false);          // UTC: 1:17 AM Local: 4:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 18, 9, 35, 0, false);          // UTC: 9:35 AM Local: 12:35 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 10, 17, 58, 0, false);         // UTC: 5:58 PM Local: 8:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 5, 10, 35, 0, false);          // UTC: 10:35 AM Local: 1:35 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 27, 22, 19, 0, false);         // UTC: 10:19 PM Local: 1:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 9, 21, 30, 0, false);          // UTC: 9:30 PM Local: 12:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 3, 3, 28, 0, false);           // UTC: 3:28 AM Local: 6:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 16, 8, 0, 0, false);           // UTC: 8:00 AM Local: 11:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 10, 20, 58, 0, false);         // UTC: 8:58 PM Local: 11:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 13, 8, 55, 0, false);          // UTC: 8:55 AM Local: 11:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 11, 22, 43, 0, false);         // UTC: 10:43 PM Local: 1:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 5, 4, 5, 0, false);            // UTC: 4:05 AM Local: 7:05 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 9, 19, 39, 0, false);          // UTC: 7:39 PM Local: 10:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 17, 5, 59, 0, false);          // UTC: 5:59 AM Local: 8:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 7, 15, 38, 0, false);          // UTC: 3:38 PM Local: 6:38 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 28, 6, 45, 0, false);          // UTC: 6:45 AM Local: 9:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 22, 17, 25, 0, false);         // UTC: 5:25 PM Local: 8:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 9, 12, 26, 0, false);          // UTC: 12:26 PM Local: 3:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 11, 3, 6, 0, false);           // UTC: 3:06 AM Local: 6:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 18, 16, 30, 0, false);         // UTC: 4:30 PM Local: 7:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 11, 3, 14, 0, false);          // UTC: 3:14 AM Local: 6:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 2, 14, 5, 57, 0, false);          // UTC: 5:57 AM Local: 8:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 13, 14, 1, 0, false);          // UTC: 2:01 PM Local: 5:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 30, 18, 46, 0, false);         // UTC: 6:46 PM Local: 9:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 26, 23, 55, 0, false);         // UTC: 11:55 PM Local: 2:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 22, 8, 54, 0, false);          // UTC: 8:54 AM Local: 11:54 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 26, 11, 38, 0, false);         // UTC: 11:38 AM Local: 2:38 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 23, 9, 30, 0, false);          // UTC: 9:30 AM Local: 12:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 14, 23, 25, 0, false);         // UTC: 11:25 PM Local: 2:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 9, 8, 29, 0, false);           // UTC: 8:29 AM Local: 11:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 27, 12, 11, 0, false);         // UTC: 12:11 PM Local: 3:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 10, 23, 49, 0, false);         // UTC: 11:49 PM Local: 2:49 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 7, 14, 26, 0, false);          // UTC: 2:26 PM Local: 5:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 24, 12, 42, 0, false);         // UTC: 12:42 PM Local: 3:42 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 18, 18, 28, 0, false);         // UTC: 6:28 PM Local: 9:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 9, 5, 59, 0, false);           // UTC: 5:59 AM Local: 8:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 29, 1, 56, 0, false);          // UTC: 1:56 AM Local: 4:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 16, 9, 8, 0, false);           // UTC: 9:08 AM Local: 12:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 4, 16, 14, 0, false);          // UTC: 4:14 PM Local: 7:14 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 2, 0, 46, 0, false);           // UTC: 12:46 AM Local: 3:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 6, 18, 53, 0, false);          // UTC: 6:53 PM Local: 9:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 30, 3, 37, 0, false);          // UTC: 3:37 AM Local: 6:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 30, 4, 52, 0, false);          // UTC: 4:52 AM Local: 7:52 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 4, 17, 15, 0, false);          // UTC: 5:15 PM Local: 8:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 16, 22, 13, 0, false);         // UTC: 10:13 PM Local: 1:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 19, 5, 44, 0, false);          // UTC: 5:44 AM Local: 8:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 3, 28, 6, 2, 0, false);           // UTC: 6:02 AM Local: 9:02 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 16, 10, 8, 0, false);          // UTC: 10:08 AM Local: 1:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 1, 18, 51, 0, false);          // UTC: 6:51 PM Local: 9:51 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 23, 13, 28, 0, false);         // UTC: 1:28 PM Local: 4:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 19, 3, 10, 0, false);          // UTC: 3:10 AM Local: 6:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 4, 15, 14, 0, false);          // UTC: 3:14 PM Local: 6:14 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 6, 23, 38, 0, false);          // UTC: 11:38 PM Local: 2:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 7, 10, 30, 0, false);          // UTC: 10:30 AM Local: 1:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 25, 10, 10, 0, false);         // UTC: 10:10 AM Local: 1:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 5, 11, 16, 0, false);          // UTC: 11:16 AM Local: 2:16 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 16, 8, 58, 0, false);          // UTC: 8:58 AM Local: 11:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 17, 7, 27, 0, false);          // UTC: 7:27 AM Local: 10:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 28, 9, 48, 0, false);          // UTC: 9:48 AM Local: 12:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 8, 8, 22, 0, false);           // UTC: 8:22 AM Local: 11:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 17, 16, 42, 0, false);         // UTC: 4:42 PM Local: 7:42 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 17, 2, 2, 0, false);           // UTC: 2:02 AM Local: 5:02 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 7, 14, 25, 0, false);          // UTC: 2:25 PM Local: 5:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 28, 18, 18, 0, false);         // UTC: 6:18 PM Local: 9:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 3, 19, 1, 0, false);           // UTC: 7:01 PM Local: 10:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 23, 17, 1, 0, false);          // UTC: 5:01 PM Local: 8:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 22, 21, 51, 0, false);         // UTC: 9:51 PM Local: 12:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 15, 15, 41, 0, false);         // UTC: 3:41 PM Local: 6:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 16, 23, 14, 0, false);         // UTC: 11:14 PM Local: 2:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 7, 2, 23, 0, false);           // UTC: 2:23 AM Local: 5:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 14, 16, 59, 0, false);         // UTC: 4:59 PM Local: 7:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 4, 22, 0, 8, 0, false);           // UTC: 12:08 AM Local: 3:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 11, 22, 25, 0, false);         // UTC: 10:25 PM Local: 1:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 10, 18, 18, 0, false);         // UTC: 6:18 PM Local: 9:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 26, 13, 49, 0, false);         // UTC: 1:49 PM Local: 4:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 28, 1, 0, 0, false);           // UTC: 1:00 AM Local: 4:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 2, 12, 2, 0, false);           // UTC: 12:02 PM Local: 3:02 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 2, 14, 15, 0, false);          // UTC: 2:15 PM Local: 5:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 2, 17, 9, 0, false);           // UTC: 5:09 PM Local: 8:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 2, 18, 17, 0, false);          // UTC: 6:17 PM Local: 9:17 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 15, 4, 16, 0, false);          // UTC: 4:16 AM Local: 7:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 4, 4, 42, 0, false);           // UTC: 4:42 AM Local: 7:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 9, 17, 6, 0, false);           // UTC: 5:06 PM Local: 8:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 11, 7, 59, 0, false);          // UTC: 7:59 AM Local: 10:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 10, 2, 10, 0, false);          // UTC: 2:10 AM Local: 5:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 20, 13, 54, 0, false);         // UTC: 1:54 PM Local: 4:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 25, 12, 34, 0, false);         // UTC: 12:34 PM Local: 3:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 25, 14, 0, 0, false);          // UTC: 2:00 PM Local: 5:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 10, 16, 56, 0, false);         // UTC: 4:56 PM Local: 7:56 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 24, 18, 27, 0, false);         // UTC: 6:27 PM Local: 9:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 22, 3, 36, 0, false);          // UTC: 3:36 AM Local: 6:36 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 18, 9, 4, 0, false);           // UTC: 9:04 AM Local: 12:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 24, 0, 10, 0, false);          // UTC: 12:10 AM Local: 3:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 26, 19, 21, 0, false);         // UTC: 7:21 PM Local: 10:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 23, 23, 38, 0, false);         // UTC: 11:38 PM Local: 2:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 2, 14, 6, 0, false);           // UTC: 2:06 PM Local: 5:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 5, 27, 23, 26, 0, false);         // UTC: 11:26 PM Local: 2:26 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 27, 2, 34, 0, false);          // UTC: 2:34 AM Local: 5:34 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 5, 18, 9, 0, false);           // UTC: 6:09 PM Local: 9:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 29, 13, 4, 0, false);          // UTC: 1:04 PM Local: 4:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 19, 18, 42, 0, false);         // UTC: 6:42 PM Local: 9:42 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 3, 1, 57, 0, false);           // UTC: 1:57 AM Local: 4:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 22, 7, 23, 0, false);          // UTC: 7:23 AM Local: 10:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 18, 7, 14, 0, false);          // UTC: 7:14 AM Local: 10:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 30, 4, 40, 0, false);          // UTC: 4:40 AM Local: 7:40 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 3, 7, 14, 0, false);           // UTC: 7:14 AM Local: 10:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 23, 6, 36, 0, false);          // UTC: 6:36 AM Local: 9:36 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 6, 10, 18, 0, false);          // UTC: 10:18 AM Local: 1:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 19, 15, 13, 0, false);         // UTC: 3:13 PM Local: 6:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 19, 5, 3, 0, false);           // UTC: 5:03 AM Local: 8:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 2, 22, 24, 0, false);          // UTC: 10:24 PM Local: 1:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 4, 12, 52, 0, false);          // UTC: 12:52 PM Local: 3:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 30, 8, 46, 0, false);          // UTC: 8:46 AM Local: 11:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 15, 3, 51, 0, false);          // UTC: 3:51 AM Local: 6:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 13, 15, 28, 0, false);         // UTC: 3:28 PM Local: 6:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 11, 0, 58, 0, false);          // UTC: 12:58 AM Local: 3:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 12, 7, 33, 0, false);          // UTC: 7:33 AM Local: 10:33 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 27, 1, 46, 0, false);          // UTC: 1:46 AM Local: 4:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 27, 4, 22, 0, false);          // UTC: 4:22 AM Local: 7:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 11, 0, 26, 0, false);          // UTC: 12:26 AM Local: 3:26 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 7, 16, 25, 0, false);          // UTC: 4:25 PM Local: 7:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 6, 1, 16, 49, 0, false);          // UTC: 4:49 PM Local: 7:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 9, 4, 2, 0, false);            // UTC: 4:02 AM Local: 7:02 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 2, 6, 15, 0, false);           // UTC: 6:15 AM Local: 9:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 4, 3, 48, 0, false);           // UTC: 3:48 AM Local: 6:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 17, 7, 12, 0, false);          // UTC: 7:12 AM Local: 10:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 25, 10, 7, 0, false);          // UTC: 10:07 AM Local: 1:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 9, 20, 28, 0, false);          // UTC: 8:28 PM Local: 11:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 8, 10, 39, 0, false);          // UTC: 10:39 AM Local: 1:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 21, 23, 13, 0, false);         // UTC: 11:13 PM Local: 2:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 23, 21, 37, 0, false);         // UTC: 9:37 PM Local: 12:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 30, 14, 5, 0, false);          // UTC: 2:05 PM Local: 5:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 15, 15, 41, 0, false);         // UTC: 3:41 PM Local: 6:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 27, 3, 4, 0, false);           // UTC: 3:04 AM Local: 6:04 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 24, 10, 7, 0, false);          // UTC: 10:07 AM Local: 1:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 1, 3, 35, 0, false);           // UTC: 3:35 AM Local: 6:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 1, 0, 54, 0, false);           // UTC: 12:54 AM Local: 3:54 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 23, 0, 3, 0, false);           // UTC: 12:03 AM Local: 3:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 16, 12, 37, 0, false);         // UTC: 12:37 PM Local: 3:37 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 6, 15, 45, 0, false);          // UTC: 3:45 PM Local: 6:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 30, 19, 54, 0, false);         // UTC: 7:54 PM Local: 10:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 1, 12, 46, 0, false);          // UTC: 12:46 PM Local: 3:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 6, 12, 57, 0, false);          // UTC: 12:57 PM Local: 3:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 25, 7, 16, 0, false);          // UTC: 7:16 AM Local: 10:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 22, 5, 28, 0, false);          // UTC: 5:28 AM Local: 8:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 27, 13, 22, 0, false);         // UTC: 1:22 PM Local: 4:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 7, 18, 8, 51, 0, false);          // UTC: 8:51 AM Local: 11:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 21, 19, 7, 0, false);          // UTC: 7:07 PM Local: 10:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 26, 15, 52, 0, false);         // UTC: 3:52 PM Local: 6:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 29, 3, 47, 0, false);          // UTC: 3:47 AM Local: 6:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 27, 16, 20, 0, false);         // UTC: 4:20 PM Local: 7:20 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 18, 1, 36, 0, false);          // UTC: 1:36 AM Local: 4:36 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 28, 6, 27, 0, false);          // UTC: 6:27 AM Local: 9:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 17, 17, 22, 0, false);         // UTC: 5:22 PM Local: 8:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 17, 10, 24, 0, false);         // UTC: 10:24 AM Local: 1:24 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 30, 18, 13, 0, false);         // UTC: 6:13 PM Local: 9:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 18, 17, 21, 0, false);         // UTC: 5:21 PM Local: 8:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 15, 0, 18, 0, false);          // UTC: 12:18 AM Local: 3:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 24, 18, 3, 0, false);          // UTC: 6:03 PM Local: 9:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 31, 16, 6, 0, false);          // UTC: 4:06 PM Local: 7:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 19, 11, 24, 0, false);         // UTC: 11:24 AM Local: 2:24 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 22, 17, 6, 0, false);          // UTC: 5:06 PM Local: 8:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 3, 5, 51, 0, false);           // UTC: 5:51 AM Local: 8:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 18, 22, 19, 0, false);         // UTC: 10:19 PM Local: 1:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 3, 16, 44, 0, false);          // UTC: 4:44 PM Local: 7:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 16, 20, 5, 0, false);          // UTC: 8:05 PM Local: 11:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 1, 7, 42, 0, false);           // UTC: 7:42 AM Local: 10:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 22, 10, 49, 0, false);         // UTC: 10:49 AM Local: 1:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 6, 14, 23, 0, false);          // UTC: 2:23 PM Local: 5:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 28, 15, 50, 0, false);         // UTC: 3:50 PM Local: 6:50 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 7, 14, 3, 0, false);           // UTC: 2:03 PM Local: 5:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 8, 28, 12, 33, 0, false);         // UTC: 12:33 PM Local: 3:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 25, 4, 37, 0, false);          // UTC: 4:37 AM Local: 7:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 23, 4, 55, 0, false);          // UTC: 4:55 AM Local: 7:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 22, 21, 10, 0, false);         // UTC: 9:10 PM Local: 12:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 10, 19, 30, 0, false);         // UTC: 7:30 PM Local: 10:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 25, 4, 26, 0, false);          // UTC: 4:26 AM Local: 7:26 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 8, 21, 4, 0, false);           // UTC: 9:04 PM Local: 12:04 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 6, 23, 46, 0, false);          // UTC: 11:46 PM Local: 2:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 22, 15, 59, 0, false);         // UTC: 3:59 PM Local: 6:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 22, 22, 47, 0, false);         // UTC: 10:47 PM Local: 1:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 16, 12, 16, 0, false);         // UTC: 12:16 PM Local: 3:16 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 7, 15, 48, 0, false);          // UTC: 3:48 PM Local: 6:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 18, 4, 24, 0, false);          // UTC: 4:24 AM Local: 7:24 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 16, 7, 22, 0, false);          // UTC: 7:22 AM Local: 10:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 19, 12, 41, 0, false);         // UTC: 12:41 PM Local: 3:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 21, 7, 37, 0, false);          // UTC: 7:37 AM Local: 10:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 5, 3, 48, 0, false);           // UTC: 3:48 AM Local: 6:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 29, 6, 46, 0, false);          // UTC: 6:46 AM Local: 9:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 26, 23, 35, 0, false);         // UTC: 11:35 PM Local: 2:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 13, 18, 50, 0, false);         // UTC: 6:50 PM Local: 9:50 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 15, 5, 53, 0, false);          // UTC: 5:53 AM Local: 8:53 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 4, 5, 8, 0, false);            // UTC: 5:08 AM Local: 8:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 3, 9, 47, 0, false);           // UTC: 9:47 AM Local: 12:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 19, 19, 14, 0, false);         // UTC: 7:14 PM Local: 10:14 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 29, 21, 48, 0, false);         // UTC: 9:48 PM Local: 12:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 9, 12, 20, 46, 0, false);         // UTC: 8:46 PM Local: 11:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 25, 13, 19, 0, false);        // UTC: 1:19 PM Local: 4:19 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 30, 1, 46, 0, false);         // UTC: 1:46 AM Local: 4:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 19, 22, 13, 0, false);        // UTC: 10:13 PM Local: 1:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 6, 14, 49, 0, false);         // UTC: 2:49 PM Local: 5:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 25, 4, 58, 0, false);         // UTC: 4:58 AM Local: 7:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 30, 13, 14, 0, false);        // UTC: 1:14 PM Local: 4:14 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 22, 16, 39, 0, false);        // UTC: 4:39 PM Local: 7:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 26, 4, 43, 0, false);         // UTC: 4:43 AM Local: 7:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 23, 12, 23, 0, false);        // UTC: 12:23 PM Local: 3:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 29, 15, 10, 0, false);        // UTC: 3:10 PM Local: 6:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 25, 8, 53, 0, false);         // UTC: 8:53 AM Local: 11:53 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 21, 3, 12, 0, false);         // UTC: 3:12 AM Local: 6:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 13, 4, 6, 0, false);          // UTC: 4:06 AM Local: 7:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 9, 11, 36, 0, false);         // UTC: 11:36 AM Local: 2:36 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 13, 2, 10, 0, false);         // UTC: 2:10 AM Local: 5:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 20, 14, 34, 0, false);        // UTC: 2:34 PM Local: 5:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 27, 14, 42, 0, false);        // UTC: 2:42 PM Local: 5:42 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 26, 9, 44, 0, false);         // UTC: 9:44 AM Local: 12:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 4, 3, 2, 0, false);           // UTC: 3:02 AM Local: 6:02 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 27, 8, 9, 0, false);          // UTC: 8:09 AM Local: 11:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 18, 10, 12, 0, false);        // UTC: 10:12 AM Local: 1:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 1, 22, 19, 0, false);         // UTC: 10:19 PM Local: 1:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 3, 15, 28, 0, false);         // UTC: 3:28 PM Local: 6:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 15, 15, 32, 0, false);        // UTC: 3:32 PM Local: 6:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 10, 18, 6, 0, 0, false);          // UTC: 6:00 AM Local: 9:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 22, 19, 13, 0, false);        // UTC: 7:13 PM Local: 10:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 20, 2, 58, 0, false);         // UTC: 2:58 AM Local: 5:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 9, 4, 21, 0, false);          // UTC: 4:21 AM Local: 7:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 24, 1, 55, 0, false);         // UTC: 1:55 AM Local: 4:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 2, 2, 34, 0, false);          // UTC: 2:34 AM Local: 5:34 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 11, 14, 44, 0, false);        // UTC: 2:44 PM Local: 5:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 7, 21, 19, 0, false);         // UTC: 9:19 PM Local: 12:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 13, 16, 50, 0, false);        // UTC: 4:50 PM Local: 7:50 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 7, 16, 11, 0, false);         // UTC: 4:11 PM Local: 7:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 5, 3, 48, 0, false);          // UTC: 3:48 AM Local: 6:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 18, 8, 47, 0, false);         // UTC: 8:47 AM Local: 11:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 9, 16, 12, 0, false);         // UTC: 4:12 PM Local: 7:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 22, 7, 19, 0, false);         // UTC: 7:19 AM Local: 10:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 6, 8, 13, 0, false);          // UTC: 8:13 AM Local: 11:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 13, 8, 17, 0, false);         // UTC: 8:17 AM Local: 11:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 13, 7, 32, 0, false);         // UTC: 7:32 AM Local: 10:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 22, 8, 3, 0, false);          // UTC: 8:03 AM Local: 11:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 12, 9, 51, 0, false);         // UTC: 9:51 AM Local: 12:51 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 9, 8, 45, 0, false);          // UTC: 8:45 AM Local: 11:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 19, 3, 57, 0, false);         // UTC: 3:57 AM Local: 6:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 21, 16, 39, 0, false);        // UTC: 4:39 PM Local: 7:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 9, 5, 36, 0, false);          // UTC: 5:36 AM Local: 8:36 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 27, 19, 46, 0, false);        // UTC: 7:46 PM Local: 10:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 9, 23, 9, 0, false);          // UTC: 11:09 PM Local: 2:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 11, 16, 23, 14, 0, false);        // UTC: 11:14 PM Local: 2:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 20, 14, 12, 0, false);        // UTC: 2:12 PM Local: 5:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 6, 1, 29, 0, false);          // UTC: 1:29 AM Local: 4:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 11, 8, 25, 0, false);         // UTC: 8:25 AM Local: 11:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 12, 3, 55, 0, false);         // UTC: 3:55 AM Local: 6:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 10, 16, 32, 0, false);        // UTC: 4:32 PM Local: 7:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 2, 17, 10, 0, false);         // UTC: 5:10 PM Local: 8:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 17, 3, 45, 0, false);         // UTC: 3:45 AM Local: 6:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 30, 18, 23, 0, false);        // UTC: 6:23 PM Local: 9:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 15, 8, 43, 0, false);         // UTC: 8:43 AM Local: 11:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 20, 17, 6, 0, false);         // UTC: 5:06 PM Local: 8:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 23, 23, 42, 0, false);        // UTC: 11:42 PM Local: 2:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 26, 0, 22, 0, false);         // UTC: 12:22 AM Local: 3:22 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 7, 0, 9, 0, false);           // UTC: 12:09 AM Local: 3:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 11, 23, 48, 0, false);        // UTC: 11:48 PM Local: 2:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 30, 10, 53, 0, false);        // UTC: 10:53 AM Local: 1:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 28, 20, 5, 0, false);         // UTC: 8:05 PM Local: 11:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 13, 23, 26, 0, false);        // UTC: 11:26 PM Local: 2:26 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 18, 15, 58, 0, false);        // UTC: 3:58 PM Local: 6:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 10, 11, 31, 0, false);        // UTC: 11:31 AM Local: 2:31 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 12, 9, 28, 0, false);         // UTC: 9:28 AM Local: 12:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 7, 14, 23, 0, false);         // UTC: 2:23 PM Local: 5:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 7, 14, 53, 0, false);         // UTC: 2:53 PM Local: 5:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 2, 20, 40, 0, false);         // UTC: 8:40 PM Local: 11:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 22, 1, 20, 0, false);         // UTC: 1:20 AM Local: 4:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2019, 12, 22, 14, 28, 0, false);        // UTC: 2:28 PM Local: 5:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 31, 20, 53, 0, false);         // UTC: 8:53 PM Local: 11:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 29, 22, 28, 0, false);         // UTC: 10:28 PM Local: 1:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 19, 15, 0, 0, false);          // UTC: 3:00 PM Local: 6:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 20, 6, 56, 0, false);          // UTC: 6:56 AM Local: 9:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 10, 11, 4, 0, false);          // UTC: 11:04 AM Local: 2:04 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 14, 23, 42, 0, false);         // UTC: 11:42 PM Local: 2:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 10, 22, 3, 0, false);          // UTC: 10:03 PM Local: 1:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 23, 20, 26, 0, false);         // UTC: 8:26 PM Local: 11:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 13, 8, 30, 0, false);          // UTC: 8:30 AM Local: 11:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 25, 23, 13, 0, false);         // UTC: 11:13 PM Local: 2:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 17, 8, 44, 0, false);          // UTC: 8:44 AM Local: 11:44 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 3, 1, 33, 0, false);           // UTC: 1:33 AM Local: 4:33 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 30, 16, 47, 0, false);         // UTC: 4:47 PM Local: 7:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 30, 13, 55, 0, false);         // UTC: 1:55 PM Local: 4:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 1, 9, 28, 0, false);           // UTC: 9:28 AM Local: 12:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 18, 11, 26, 0, false);         // UTC: 11:26 AM Local: 2:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 7, 1, 31, 0, false);           // UTC: 1:31 AM Local: 4:31 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 28, 7, 23, 0, false);          // UTC: 7:23 AM Local: 10:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 31, 23, 18, 0, false);         // UTC: 11:18 PM Local: 2:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 9, 12, 10, 0, false);          // UTC: 12:10 PM Local: 3:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 18, 6, 41, 0, false);          // UTC: 6:41 AM Local: 9:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 30, 2, 21, 0, false);          // UTC: 2:21 AM Local: 5:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 30, 18, 35, 0, false);         // UTC: 6:35 PM Local: 9:35 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 12, 6, 6, 0, false);           // UTC: 6:06 AM Local: 9:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 1, 29, 1, 43, 0, false);          // UTC: 1:43 AM Local: 4:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 10, 10, 14, 0, false);         // UTC: 10:14 AM Local: 1:14 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 26, 16, 50, 0, false);         // UTC: 4:50 PM Local: 7:50 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 20, 14, 10, 0, false);         // UTC: 2:10 PM Local: 5:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 18, 6, 48, 0, false);          // UTC: 6:48 AM Local: 9:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 27, 2, 57, 0, false);          // UTC: 2:57 AM Local: 5:57 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 17, 3, 2, 0, false);           // UTC: 3:02 AM Local: 6:02 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 16, 6, 34, 0, false);          // UTC: 6:34 AM Local: 9:34 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 4, 7, 11, 0, false);           // UTC: 7:11 AM Local: 10:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 26, 0, 1, 0, false);           // UTC: 12:01 AM Local: 3:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 6, 15, 9, 0, false);           // UTC: 3:09 PM Local: 6:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 3, 17, 0, 0, false);           // UTC: 5:00 PM Local: 8:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 29, 20, 32, 0, false);         // UTC: 8:32 PM Local: 11:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 5, 20, 8, 0, false);           // UTC: 8:08 PM Local: 11:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 19, 1, 0, 0, false);           // UTC: 1:00 AM Local: 4:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 7, 21, 56, 0, false);          // UTC: 9:56 PM Local: 12:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 22, 6, 32, 0, false);          // UTC: 6:32 AM Local: 9:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 13, 6, 43, 0, false);          // UTC: 6:43 AM Local: 9:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 2, 18, 47, 0, false);          // UTC: 6:47 PM Local: 9:47 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 24, 2, 2, 0, false);           // UTC: 2:02 AM Local: 5:02 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 3, 7, 42, 0, false);           // UTC: 7:42 AM Local: 10:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 22, 23, 8, 0, false);          // UTC: 11:08 PM Local: 2:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 22, 8, 51, 0, false);          // UTC: 8:51 AM Local: 11:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 23, 0, 8, 0, false);           // UTC: 12:08 AM Local: 3:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 10, 2, 18, 0, false);          // UTC: 2:18 AM Local: 5:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 2, 4, 23, 23, 0, false);          // UTC: 11:23 PM Local: 2:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 13, 15, 56, 0, false);         // UTC: 3:56 PM Local: 6:56 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 5, 0, 17, 0, false);           // UTC: 12:17 AM Local: 3:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 15, 14, 42, 0, false);         // UTC: 2:42 PM Local: 5:42 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 12, 21, 35, 0, false);         // UTC: 9:35 PM Local: 12:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 28, 23, 20, 0, false);         // UTC: 11:20 PM Local: 2:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 20, 14, 1, 0, false);          // UTC: 2:01 PM Local: 5:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 25, 12, 33, 0, false);         // UTC: 12:33 PM Local: 3:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 3, 13, 33, 0, false);          // UTC: 1:33 PM Local: 4:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 31, 6, 16, 0, false);          // UTC: 6:16 AM Local: 9:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 19, 22, 21, 0, false);         // UTC: 10:21 PM Local: 1:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 12, 20, 42, 0, false);         // UTC: 8:42 PM Local: 11:42 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 25, 1, 56, 0, false);          // UTC: 1:56 AM Local: 4:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 10, 12, 32, 0, false);         // UTC: 12:32 PM Local: 3:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 28, 18, 19, 0, false);         // UTC: 6:19 PM Local: 9:19 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 22, 16, 48, 0, false);         // UTC: 4:48 PM Local: 7:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 24, 18, 1, 0, false);          // UTC: 6:01 PM Local: 9:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 31, 0, 51, 0, false);          // UTC: 12:51 AM Local: 3:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 31, 0, 41, 0, false);          // UTC: 12:41 AM Local: 3:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 25, 3, 2, 0, false);           // UTC: 3:02 AM Local: 6:02 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 10, 15, 8, 0, false);          // UTC: 3:08 PM Local: 6:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 17, 10, 30, 0, false);         // UTC: 10:30 AM Local: 1:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 5, 23, 52, 0, false);          // UTC: 11:52 PM Local: 2:52 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 5, 5, 29, 0, false);           // UTC: 5:29 AM Local: 8:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 27, 1, 8, 0, false);           // UTC: 1:08 AM Local: 4:08 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 3, 13, 5, 16, 0, false);          // UTC: 5:16 AM Local: 8:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 11, 17, 41, 0, false);         // UTC: 5:41 PM Local: 8:41 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 9, 23, 13, 0, false);          // UTC: 11:13 PM Local: 2:13 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 12, 11, 55, 0, false);         // UTC: 11:55 AM Local: 2:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 13, 18, 10, 0, false);         // UTC: 6:10 PM Local: 9:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 1, 23, 3, 0, false);           // UTC: 11:03 PM Local: 2:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 12, 10, 56, 0, false);         // UTC: 10:56 AM Local: 1:56 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 25, 8, 46, 0, false);          // UTC: 8:46 AM Local: 11:46 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 7, 22, 12, 0, false);          // UTC: 10:12 PM Local: 1:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 16, 12, 28, 0, false);         // UTC: 12:28 PM Local: 3:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 16, 1, 47, 0, false);          // UTC: 1:47 AM Local: 4:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 22, 11, 40, 0, false);         // UTC: 11:40 AM Local: 2:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 9, 11, 34, 0, false);          // UTC: 11:34 AM Local: 2:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 5, 20, 16, 0, false);          // UTC: 8:16 PM Local: 11:16 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 19, 16, 5, 0, false);          // UTC: 4:05 PM Local: 7:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 6, 19, 23, 0, false);          // UTC: 7:23 PM Local: 10:23 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 25, 22, 47, 0, false);         // UTC: 10:47 PM Local: 1:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 2, 11, 44, 0, false);          // UTC: 11:44 AM Local: 2:44 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 22, 15, 13, 0, false);         // UTC: 3:13 PM Local: 6:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 16, 8, 59, 0, false);          // UTC: 8:59 AM Local: 11:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 21, 3, 18, 0, false);          // UTC: 3:18 AM Local: 6:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 17, 2, 43, 0, false);          // UTC: 2:43 AM Local: 5:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 15, 1, 59, 0, false);          // UTC: 1:59 AM Local: 4:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 2, 15, 3, 0, false);           // UTC: 3:03 PM Local: 6:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 4, 21, 53, 0, false);          // UTC: 9:53 PM Local: 12:53 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 4, 23, 18, 54, 0, false);         // UTC: 6:54 PM Local: 9:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 18, 7, 11, 0, false);          // UTC: 7:11 AM Local: 10:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 28, 11, 21, 0, false);         // UTC: 11:21 AM Local: 2:21 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 7, 12, 1, 0, false);           // UTC: 12:01 PM Local: 3:01 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 13, 22, 25, 0, false);         // UTC: 10:25 PM Local: 1:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 4, 17, 5, 0, false);           // UTC: 5:05 PM Local: 8:05 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 20, 2, 52, 0, false);          // UTC: 2:52 AM Local: 5:52 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 3, 3, 2, 0, false);            // UTC: 3:02 AM Local: 6:02 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 15, 21, 9, 0, false);          // UTC: 9:09 PM Local: 12:09 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 19, 10, 40, 0, false);         // UTC: 10:40 AM Local: 1:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 15, 9, 59, 0, false);          // UTC: 9:59 AM Local: 12:59 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 11, 14, 32, 0, false);         // UTC: 2:32 PM Local: 5:32 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 23, 11, 12, 0, false);         // UTC: 11:12 AM Local: 2:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 25, 5, 55, 0, false);          // UTC: 5:55 AM Local: 8:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 15, 9, 11, 0, false);          // UTC: 9:11 AM Local: 12:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 8, 4, 28, 0, false);           // UTC: 4:28 AM Local: 7:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 27, 12, 51, 0, false);         // UTC: 12:51 PM Local: 3:51 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 12, 3, 41, 0, false);          // UTC: 3:41 AM Local: 6:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 22, 14, 3, 0, false);          // UTC: 2:03 PM Local: 5:03 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 3, 22, 4, 0, false);           // UTC: 10:04 PM Local: 1:04 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 26, 19, 6, 0, false);          // UTC: 7:06 PM Local: 10:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 22, 16, 16, 0, false);         // UTC: 4:16 PM Local: 7:16 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 23, 10, 48, 0, false);         // UTC: 10:48 AM Local: 1:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 8, 22, 3, 0, false);           // UTC: 10:03 PM Local: 1:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 3, 12, 25, 0, false);          // UTC: 12:25 PM Local: 3:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 5, 4, 23, 35, 0, false);          // UTC: 11:35 PM Local: 2:35 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 26, 7, 58, 0, false);          // UTC: 7:58 AM Local: 10:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 19, 8, 15, 0, false);          // UTC: 8:15 AM Local: 11:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 12, 18, 12, 0, false);         // UTC: 6:12 PM Local: 9:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 14, 10, 42, 0, false);         // UTC: 10:42 AM Local: 1:42 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 5, 9, 0, 0, false);            // UTC: 9:00 AM Local: 12:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 14, 12, 48, 0, false);         // UTC: 12:48 PM Local: 3:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 27, 22, 40, 0, false);         // UTC: 10:40 PM Local: 1:40 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 22, 21, 19, 0, false);         // UTC: 9:19 PM Local: 12:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 15, 6, 10, 0, false);          // UTC: 6:10 AM Local: 9:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 25, 8, 7, 0, false);           // UTC: 8:07 AM Local: 11:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 4, 0, 38, 0, false);           // UTC: 12:38 AM Local: 3:38 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 4, 5, 42, 0, false);           // UTC: 5:42 AM Local: 8:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 22, 5, 1, 0, false);           // UTC: 5:01 AM Local: 8:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 8, 23, 32, 0, false);          // UTC: 11:32 PM Local: 2:32 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 8, 0, 10, 0, false);           // UTC: 12:10 AM Local: 3:10 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 15, 23, 14, 0, false);         // UTC: 11:14 PM Local: 2:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 16, 2, 41, 0, false);          // UTC: 2:41 AM Local: 5:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 18, 14, 58, 0, false);         // UTC: 2:58 PM Local: 5:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 18, 7, 49, 0, false);          // UTC: 7:49 AM Local: 10:49 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 20, 20, 27, 0, false);         // UTC: 8:27 PM Local: 11:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 15, 17, 7, 0, false);          // UTC: 5:07 PM Local: 8:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 15, 20, 58, 0, false);         // UTC: 8:58 PM Local: 11:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 26, 12, 49, 0, false);         // UTC: 12:49 PM Local: 3:49 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 7, 0, 21, 0, false);           // UTC: 12:21 AM Local: 3:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 6, 3, 6, 7, 0, false);            // UTC: 6:07 AM Local: 9:07 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 26, 1, 23, 0, false);          // UTC: 1:23 AM Local: 4:23 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 17, 15, 20, 0, false);         // UTC: 3:20 PM Local: 6:20 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 15, 7, 29, 0, false);          // UTC: 7:29 AM Local: 10:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 28, 21, 27, 0, false);         // UTC: 9:27 PM Local: 12:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 20, 6, 1, 0, false);           // UTC: 6:01 AM Local: 9:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 16, 23, 54, 0, false);         // UTC: 11:54 PM Local: 2:54 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 17, 14, 46, 0, false);         // UTC: 2:46 PM Local: 5:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 15, 8, 18, 0, false);          // UTC: 8:18 AM Local: 11:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 15, 13, 14, 0, false);         // UTC: 1:14 PM Local: 4:14 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 13, 9, 12, 0, false);          // UTC: 9:12 AM Local: 12:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 1, 19, 52, 0, false);          // UTC: 7:52 PM Local: 10:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 3, 9, 15, 0, false);           // UTC: 9:15 AM Local: 12:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 7, 0, 27, 0, false);           // UTC: 12:27 AM Local: 3:27 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 26, 11, 27, 0, false);         // UTC: 11:27 AM Local: 2:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 18, 12, 18, 0, false);         // UTC: 12:18 PM Local: 3:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 28, 12, 48, 0, false);         // UTC: 12:48 PM Local: 3:48 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 16, 7, 48, 0, false);          // UTC: 7:48 AM Local: 10:48 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 21, 8, 41, 0, false);          // UTC: 8:41 AM Local: 11:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 12, 15, 6, 0, false);          // UTC: 3:06 PM Local: 6:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 17, 8, 40, 0, false);          // UTC: 8:40 AM Local: 11:40 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 23, 8, 16, 0, false);          // UTC: 8:16 AM Local: 11:16 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 12, 5, 15, 0, false);          // UTC: 5:15 AM Local: 8:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 22, 21, 37, 0, false);         // UTC: 9:37 PM Local: 12:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 30, 13, 54, 0, false);         // UTC: 1:54 PM Local: 4:54 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 7, 5, 5, 51, 0, false);           // UTC: 5:51 AM Local: 8:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 20, 12, 28, 0, false);         // UTC: 12:28 PM Local: 3:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 10, 7, 52, 0, false);          // UTC: 7:52 AM Local: 10:52 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 23, 8, 18, 0, false);          // UTC: 8:18 AM Local: 11:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 2, 5, 40, 0, false);           // UTC: 5:40 AM Local: 8:40 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 16, 2, 54, 0, false);          // UTC: 2:54 AM Local: 5:54 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 7, 5, 12, 0, false);           // UTC: 5:12 AM Local: 8:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 9, 11, 7, 0, false);           // UTC: 11:07 AM Local: 2:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 22, 5, 11, 0, false);          // UTC: 5:11 AM Local: 8:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 28, 5, 6, 0, false);           // UTC: 5:06 AM Local: 8:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 12, 3, 59, 0, false);          // UTC: 3:59 AM Local: 6:59 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 3, 17, 58, 0, false);          // UTC: 5:58 PM Local: 8:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 26, 13, 30, 0, false);         // UTC: 1:30 PM Local: 4:30 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 8, 23, 11, 0, false);          // UTC: 11:11 PM Local: 2:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 9, 23, 1, 0, false);           // UTC: 11:01 PM Local: 2:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 2, 16, 11, 0, false);          // UTC: 4:11 PM Local: 7:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 14, 22, 34, 0, false);         // UTC: 10:34 PM Local: 1:34 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 1, 11, 45, 0, false);          // UTC: 11:45 AM Local: 2:45 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 30, 6, 3, 0, false);           // UTC: 6:03 AM Local: 9:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 5, 4, 21, 0, false);           // UTC: 4:21 AM Local: 7:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 2, 9, 6, 0, false);            // UTC: 9:06 AM Local: 12:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 12, 8, 17, 0, false);          // UTC: 8:17 AM Local: 11:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 16, 19, 15, 0, false);         // UTC: 7:15 PM Local: 10:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 14, 5, 6, 0, false);           // UTC: 5:06 AM Local: 8:06 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 5, 7, 51, 0, false);           // UTC: 7:51 AM Local: 10:51 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 8, 28, 19, 18, 0, false);         // UTC: 7:18 PM Local: 10:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 1, 21, 19, 0, false);          // UTC: 9:19 PM Local: 12:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 28, 16, 58, 0, false);         // UTC: 4:58 PM Local: 7:58 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 17, 18, 0, 0, false);          // UTC: 6:00 PM Local: 9:00 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 8, 0, 25, 0, false);           // UTC: 12:25 AM Local: 3:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 17, 16, 13, 0, false);         // UTC: 4:13 PM Local: 7:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 3, 6, 18, 0, false);           // UTC: 6:18 AM Local: 9:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 25, 3, 17, 0, false);          // UTC: 3:17 AM Local: 6:17 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 24, 4, 15, 0, false);          // UTC: 4:15 AM Local: 7:15 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 24, 4, 55, 0, false);          // UTC: 4:55 AM Local: 7:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 10, 19, 39, 0, false);         // UTC: 7:39 PM Local: 10:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 6, 22, 1, 0, false);           // UTC: 10:01 PM Local: 1:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 12, 10, 24, 0, false);         // UTC: 10:24 AM Local: 1:24 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 10, 1, 11, 0, false);          // UTC: 1:11 AM Local: 4:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 16, 17, 40, 0, false);         // UTC: 5:40 PM Local: 8:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 7, 17, 8, 0, false);           // UTC: 5:08 PM Local: 8:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 21, 17, 25, 0, false);         // UTC: 5:25 PM Local: 8:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 27, 4, 55, 0, false);          // UTC: 4:55 AM Local: 7:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 25, 15, 8, 0, false);          // UTC: 3:08 PM Local: 6:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 28, 20, 10, 0, false);         // UTC: 8:10 PM Local: 11:10 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 29, 5, 53, 0, false);          // UTC: 5:53 AM Local: 8:53 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 29, 1, 20, 0, false);          // UTC: 1:20 AM Local: 4:20 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 26, 12, 11, 0, false);         // UTC: 12:11 PM Local: 3:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 4, 14, 36, 0, false);          // UTC: 2:36 PM Local: 5:36 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 16, 23, 58, 0, false);         // UTC: 11:58 PM Local: 2:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 9, 3, 8, 18, 0, false);           // UTC: 8:18 AM Local: 11:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 2, 1, 25, 0, false);          // UTC: 1:25 AM Local: 4:25 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 14, 17, 14, 0, false);        // UTC: 5:14 PM Local: 8:14 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 12, 18, 15, 0, false);        // UTC: 6:15 PM Local: 9:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 22, 13, 27, 0, false);        // UTC: 1:27 PM Local: 4:27 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 18, 15, 8, 0, false);         // UTC: 3:08 PM Local: 6:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 9, 21, 56, 0, false);         // UTC: 9:56 PM Local: 12:56 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 4, 14, 18, 0, false);         // UTC: 2:18 PM Local: 5:18 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 29, 10, 9, 0, false);         // UTC: 10:09 AM Local: 1:09 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 23, 15, 11, 0, false);        // UTC: 3:11 PM Local: 6:11 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 21, 1, 53, 0, false);         // UTC: 1:53 AM Local: 4:53 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 14, 4, 55, 0, false);         // UTC: 4:55 AM Local: 7:55 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 5, 21, 45, 0, false);         // UTC: 9:45 PM Local: 12:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 2, 22, 47, 0, false);         // UTC: 10:47 PM Local: 1:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 22, 15, 7, 0, false);         // UTC: 3:07 PM Local: 6:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 3, 4, 42, 0, false);          // UTC: 4:42 AM Local: 7:42 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 30, 8, 0, 0, false);          // UTC: 8:00 AM Local: 11:00 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 13, 7, 31, 0, false);         // UTC: 7:31 AM Local: 10:31 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 26, 14, 40, 0, false);        // UTC: 2:40 PM Local: 5:40 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 8, 4, 45, 0, false);          // UTC: 4:45 AM Local: 7:45 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 20, 4, 28, 0, false);         // UTC: 4:28 AM Local: 7:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 31, 15, 22, 0, false);        // UTC: 3:22 PM Local: 6:22 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 15, 18, 2, 0, false);         // UTC: 6:02 PM Local: 9:02 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 4, 13, 52, 0, false);         // UTC: 1:52 PM Local: 4:52 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 13, 11, 26, 0, false);        // UTC: 11:26 AM Local: 2:26 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 10, 7, 6, 58, 0, false);          // UTC: 6:58 AM Local: 9:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 19, 6, 58, 0, false);         // UTC: 6:58 AM Local: 9:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 22, 5, 14, 0, false);         // UTC: 5:14 AM Local: 8:14 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 24, 12, 55, 0, false);        // UTC: 12:55 PM Local: 3:55 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 7, 17, 35, 0, false);         // UTC: 5:35 PM Local: 8:35 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 29, 16, 57, 0, false);        // UTC: 4:57 PM Local: 7:57 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 12, 20, 7, 0, false);         // UTC: 8:07 PM Local: 11:07 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 25, 3, 28, 0, false);         // UTC: 3:28 AM Local: 6:28 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 23, 3, 4, 0, false);          // UTC: 3:04 AM Local: 6:04 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 14, 14, 15, 0, false);        // UTC: 2:15 PM Local: 5:15 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 9, 6, 37, 0, false);          // UTC: 6:37 AM Local: 9:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 14, 23, 54, 0, false);        // UTC: 11:54 PM Local: 2:54 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 9, 5, 12, 0, false);          // UTC: 5:12 AM Local: 8:12 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 27, 22, 18, 0, false);        // UTC: 10:18 PM Local: 1:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 14, 13, 56, 0, false);        // UTC: 1:56 PM Local: 4:56 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 29, 15, 43, 0, false);        // UTC: 3:43 PM Local: 6:43 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 24, 20, 6, 0, false);         // UTC: 8:06 PM Local: 11:06 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 2, 15, 13, 0, false);         // UTC: 3:13 PM Local: 6:13 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 8, 8, 47, 0, false);          // UTC: 8:47 AM Local: 11:47 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 15, 1, 29, 0, false);         // UTC: 1:29 AM Local: 4:29 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 14, 22, 19, 0, false);        // UTC: 10:19 PM Local: 1:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 21, 3, 37, 0, false);         // UTC: 3:37 AM Local: 6:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 23, 8, 11, 0, false);         // UTC: 8:11 AM Local: 11:11 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 26, 17, 12, 0, false);        // UTC: 5:12 PM Local: 8:12 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 6, 8, 33, 0, false);          // UTC: 8:33 AM Local: 11:33 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 11, 21, 0, 37, 0, false);         // UTC: 12:37 AM Local: 3:37 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 30, 13, 28, 0, false);        // UTC: 1:28 PM Local: 4:28 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 3, 2, 30, 0, false);          // UTC: 2:30 AM Local: 5:30 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 8, 17, 19, 0, false);         // UTC: 5:19 PM Local: 8:19 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 21, 11, 39, 0, false);        // UTC: 11:39 AM Local: 2:39 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 23, 8, 21, 0, false);         // UTC: 8:21 AM Local: 11:21 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 19, 21, 3, 0, false);         // UTC: 9:03 PM Local: 12:03 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 10, 17, 53, 0, false);        // UTC: 5:53 PM Local: 8:53 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 29, 4, 58, 0, false);         // UTC: 4:58 AM Local: 7:58 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 10, 2, 43, 0, false);         // UTC: 2:43 AM Local: 5:43 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 1, 13, 25, 0, false);         // UTC: 1:25 PM Local: 4:25 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 3, 16, 46, 0, false);         // UTC: 4:46 PM Local: 7:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 18, 18, 35, 0, false);        // UTC: 6:35 PM Local: 9:35 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 24, 15, 46, 0, false);        // UTC: 3:46 PM Local: 6:46 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 25, 0, 1, 0, false);          // UTC: 12:01 AM Local: 3:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 28, 17, 33, 0, false);        // UTC: 5:33 PM Local: 8:33 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 20, 8, 18, 0, false);         // UTC: 8:18 AM Local: 11:18 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 31, 12, 34, 0, false);        // UTC: 12:34 PM Local: 3:34 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 6, 3, 39, 0, false);          // UTC: 3:39 AM Local: 6:39 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 28, 17, 50, 0, false);        // UTC: 5:50 PM Local: 8:50 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 8, 21, 1, 0, false);          // UTC: 9:01 PM Local: 12:01 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 16, 3, 41, 0, false);         // UTC: 3:41 AM Local: 6:41 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 9, 7, 19, 0, false);          // UTC: 7:19 AM Local: 10:19 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 29, 12, 8, 0, false);         // UTC: 12:08 PM Local: 3:08 PM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 5, 8, 31, 0, false);          // UTC: 8:31 AM Local: 11:31 AM Offset: 03:00:00
+	testCount++; failedCount += test(timeManager, 14, 2020, 12, 19, 7, 30, 0, false);         // UTC: 7:30 AM Local: 10:30 AM Offset: 03:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
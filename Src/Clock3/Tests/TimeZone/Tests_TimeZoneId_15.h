@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_15_H
+#define TEST_TIMEZONEID_15_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_15_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 31, 6, 0, 0, false);           // UTC: 6:00 AM Local: 11:30 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 17, 23, 2, 0, false);          // UTC: 11:02 PM Local: 4:32 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 6, 7, 1, 0, false);            // UTC: 7:01 AM Local: 12:31 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 2, 21, 9, 0, false);           // UTC: 9:09 PM Local: 2:39 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 28, 22, 23, 0, false);         // UTC: 10:23 PM Local: 3:53 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 8, 3, 21, 0, false);           // UTC: 3:21 AM Local: 8:51 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 15, 22, 22, 0, false);         // UTC: 10:22 PM Local: 3:52 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 9, 12, 16, 0, false);          // UTC: 12:16 PM Local: 5:46 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 12, 7, 59, 0, false);          // UTC: 7:59 AM Local: 1:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 28, 6, 55, 0, false);          // UTC: 6:55 AM Local: 12:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 12, 10, 14, 0, false);         // UTC: 10:14 AM Local: 3:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 10, 23, 32, 0, false);         // UTC: 11:32 PM Local: 5:02 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 14, 7, 36, 0, false);          // UTC: 7:36 AM Local: 1:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 15, 13, 31, 0, false);         // UTC: 1:31 PM Local: 7:01 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 3, 14, 36, 0, false);          // UTC: 2:36 PM Local: 8:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 26, 11, 28, 0, false);         // UTC: 11:28 AM Local: 4:58 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 19, 10, 59, 0, false);         // UTC: 10:59 AM Local: 4:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 23, 20, 28, 0, false);         // UTC: 8:28 PM Local: 1:58 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 13, 2, 31, 0, false);          // UTC: 2:31 AM Local: 8:01 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 31, 0, 12, 0, false);          // UTC: 12:12 AM Local: 5:42 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 5, 17, 11, 0, false);          // UTC: 5:11 PM Local: 10:41 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 20, 22, 54, 0, false);         // UTC: 10:54 PM Local: 4:24 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 24, 0, 18, 0, false);          // UTC: 12:18 AM Local: 5:48 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 17, 15, 9, 0, false);          // UTC: 3:09 PM Local: 8:39 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 1, 29, 3, 57, 0, false);          // UTC: 3:57 AM Local: 9:27 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 4, 12, 3, 0, false);           // UTC: 12:03 PM Local: 5:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 3, 14, 46, 0, false);          // UTC: 2:46 PM Local: 8:16 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 27, 17, 18, 0, false);         // UTC: 5:18 PM Local: 10:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 13, 16, 14, 0, false);         // UTC: 4:14 PM Local: 9:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 6, 17, 32, 0, false);          // UTC: 5:32 PM Local: 11:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 12, 2, 15, 0, false);          // UTC: 2:15 AM Local: 7:45 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 10, 9, 10, 0, false);          // UTC: 9:10 AM Local: 2:40 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 27, 20, 20, 0, false);         // UTC: 8:20 PM Local: 1:50 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 13, 15, 21, 0, false);         // UTC: 3:21 PM Local: 8:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 28, 14, 50, 0, false);         // UTC: 2:50 PM Local: 8:20 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 3, 8, 30, 0, false);           // UTC: 8:30 AM Local: 2:00 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 5, 3, 43, 0, false);           // UTC: 3:43 AM Local: 9:13 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 16, 12, 24, 0, false);         // UTC: 12:24 PM Local: 5:54 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 1, 8, 59, 0, false);           // UTC: 8:59 AM Local: 2:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 24, 2, 18, 0, false);          // UTC: 2:18 AM Local: 7:48 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 3, 1, 28, 0, false);           // UTC: 1:28 AM Local: 6:58 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 2, 8, 10, 0, false);           // UTC: 8:10 AM Local: 1:40 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 27, 15, 36, 0, false);         // UTC: 3:36 PM Local: 9:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 16, 15, 2, 0, false);          // UTC: 3:02 PM Local: 8:32 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 17, 1, 30, 0, false);          // UTC: 1:30 AM Local: 7:00 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 27, 2, 36, 0, false);          // UTC: 2:36 AM Local: 8:06 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 15, 7, 49, 0, false);          // UTC: 7:49 AM Local: 1:19 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 25, 18, 28, 0, false);         // UTC: 6:28 PM Local: 11:58 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 23, 23, 16, 0, false);         // UTC: 11:16 PM Local: 4:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 2, 22, 2, 39, 0, false);          // UTC: 2:39 AM Local: 8:09 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 1, 1, 21, 0, false);           // UTC: 1:21 AM Local: 6:51 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 25, 20, 53, 0, false);         // UTC: 8:53 PM Local: 2:23 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 13, 13, 22, 0, false);         // UTC: 1:22 PM Local: 6:52 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 2, 19, 59, 0, false);          // UTC: 7:59 PM Local: 1:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 23, 9, 38, 0, false);          // UTC: 9:38 AM Local: 3:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 15, 9, 35, 0, false);          // UTC: 9:35 AM Local: 3:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 27, 0, 51, 0, false);          // UTC: 12:51 AM Local: 6:21 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 14, 12, 0, 0, false);          // UTC: 12:00 PM Local: 5:30 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 29, 21, 58, 0, false);         // UTC: 9:58 PM Local: 3:28 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 12, 19, 24, 0, false);         // UTC: 7:24 PM Local: 12:54 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 30, 16, 0, 0, false);          // UTC: 4:00 PM Local: 9:30 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 5, 8, 15, 0, false);           // UTC: 8:15 AM Local: 1:45 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 16, 16, 21, 0, false);         // UTC: 4:21 PM Local: 9:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 11, 7, 43, 0, false);          // UTC: 7:43 AM Local: 1:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 19, 10, 31, 0, false);         // UTC: 10:31 AM Local: 4:01 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 11, 0, 38, 0, false);          // UTC: 12:38 AM Local: 6:08 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 12, 22, 14, 0, false);         // UTC: 10:14 PM Local: 3:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 11, 1, 54, 0, false);          // UTC: 1:54 AM Local: 7:24 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 6, 20, 55, 0, false);          // UTC: 8:55 PM Local: 2:25 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 17, 23, 6, 0, false);          // UTC: 11:06 PM Local: 4:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 27, 23, 36, 0, false);         // UTC: 11:36 PM Local: 5:06 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 13, 10, 55, 0, false);         // UTC: 10:55 AM Local: 4:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 29, 4, 21, 0, false);          // UTC: 4:21 AM Local: 9:51 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 4, 10, 21, 0, false);          // UTC: 10:21 AM Local: 3:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 3, 15, 23, 39, 0, false);         // UTC: 11:39 PM Local: 5:09 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 18, 19, 30, 0, false);         // UTC: 7:30 PM Local: 1:00 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 19, 3, 25, 0, false);          // UTC: 3:25 AM Local: 8:55 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 30, 18, 0, 0, false);          // UTC: 6:00 PM Local: 11:30 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 4, 4, 45, 0, false);           // UTC: 4:45 AM Local: 10:15 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 21, 14, 53, 0, false);         // UTC: 2:53 PM Local: 8:23 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 6, 20, 12, 0, false);          // UTC: 8:12 PM Local: 1:42 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 19, 17, 35, 0, false);         // UTC: 5:35 PM Local: 11:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 20, 10, 23, 0, false);         // UTC: 10:23 AM Local: 3:53 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 13, 7, 35, 0, false);          // UTC: 7:35 AM Local: 1:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 21, 16, 40, 0, false);         // UTC: 4:40 PM Local: 10:10 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 4, 16, 46, 0, false);          // UTC: 4:46 PM Local: 10:16 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 15, 18, 10, 0, false);         // UTC: 6:10 PM Local: 11:40 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 27, 22, 43, 0, false);         // UTC: 10:43 PM Local: 4:13 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 25, 10, 29, 0, false);         // UTC: 10:29 AM Local: 3:59 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 28, 19, 36, 0, false);         // UTC: 7:36 PM Local: 1:06 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 22, 13, 1, 0, false);          // UTC: 1:01 PM Local: 6:31 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 9, 10, 8, 0, false);           // UTC: 10:08 AM Local: 3:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 25, 8, 22, 0, false);          // UTC: 8:22 AM Local: 1:52 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 6, 1, 29, 0, false);           // UTC: 1:29 AM Local: 6:59 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 30, 22, 37, 0, false);         // UTC: 10:37 PM Local: 4:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 26, 6, 6, 0, false);           // UTC: 6:06 AM Local: 11:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 3, 20, 16, 0, false);          // UTC: 8:16 PM Local: 1:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 7, 23, 43, 0, false);          // UTC: 11:43 PM Local: 5:13 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 3, 23, 28, 0, false);          // UTC: 11:28 PM Local: 4:58 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 4, 18, 5, 56, 0, false);          // UTC: 5:56 AM Local: 11:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 29, 7, 20, 0, false);          // UTC: 7:20 AM Local: 12:50 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 6, 19, 55, 0, false);          // UTC: 7:55 PM Local: 1:25 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 29, 1, 23, 0, false);          // UTC: 1:23 AM Local: 6:53 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 14, 7, 26, 0, false);          // UTC: 7:26 AM Local: 12:56 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 24, 5, 23, 0, false);          // UTC: 5:23 AM Local: 10:53 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 25, 18, 9, 0, false);          // UTC: 6:09 PM Local: 11:39 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 17, 5, 30, 0, false);          // UTC: 5:30 AM Local: 11:00 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 16, 14, 29, 0, false);         // UTC: 2:29 PM Local: 7:59 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 20, 5, 27, 0, false);          // UTC: 5:27 AM Local: 10:57 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 3, 13, 17, 0, false);          // UTC: 1:17 PM Local: 6:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 30, 14, 47, 0, false);         // UTC: 2:47 PM Local: 8:17 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 8, 21, 1, 0, false);           // UTC: 9:01 PM Local: 2:31 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 15, 10, 25, 0, false);         // UTC: 10:25 AM Local: 3:55 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 29, 20, 10, 0, false);         // UTC: 8:10 PM Local: 1:40 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 2, 21, 37, 0, false);          // UTC: 9:37 PM Local: 3:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 1, 19, 43, 0, false);          // UTC: 7:43 PM Local: 1:13 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 15, 14, 1, 0, false);          // UTC: 2:01 PM Local: 7:31 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 11, 14, 56, 0, false);         // UTC: 2:56 PM Local: 8:26 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 15, 19, 50, 0, false);         // UTC: 7:50 PM Local: 1:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 9, 12, 29, 0, false);          // UTC: 12:29 PM Local: 5:59 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 26, 14, 25, 0, false);         // UTC: 2:25 PM Local: 7:55 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 23, 20, 32, 0, false);         // UTC: 8:32 PM Local: 2:02 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 25, 3, 10, 0, false);          // UTC: 3:10 AM Local: 8:40 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 22, 10, 28, 0, false);         // UTC: 10:28 AM Local: 3:58 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 5, 30, 15, 21, 0, false);         // UTC: 3:21 PM Local: 8:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 23, 18, 29, 0, false);         // UTC: 6:29 PM Local: 11:59 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 17, 2, 13, 0, false);          // UTC: 2:13 AM Local: 7:43 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 28, 7, 10, 0, false);          // UTC: 7:10 AM Local: 12:40 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 25, 17, 32, 0, false);         // UTC: 5:32 PM Local: 11:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 13, 21, 6, 0, false);          // UTC: 9:06 PM Local: 2:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 23, 12, 43, 0, false);         // UTC: 12:43 PM Local: 6:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 11, 10, 57, 0, false);         // UTC: 10:57 AM Local: 4:27 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 28, 14, 16, 0, false);         // UTC: 2:16 PM Local: 7:46 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 6, 8, 57, 0, false);           // UTC: 8:57 AM Local: 2:27 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 14, 3, 19, 0, false);          // UTC: 3:19 AM Local: 8:49 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 29, 22, 44, 0, false);         // UTC: 10:44 PM Local: 4:14 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 8, 8, 10, 0, false);           // UTC: 8:10 AM Local: 1:40 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 19, 8, 59, 0, false);          // UTC: 8:59 AM Local: 2:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 10, 4, 28, 0, false);          // UTC: 4:28 AM Local: 9:58 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 22, 16, 15, 0, false);         // UTC: 4:15 PM Local: 9:45 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 5, 15, 33, 0, false);          // UTC: 3:33 PM Local: 9:03 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 4, 20, 15, 0, false);          // UTC: 8:15 PM Local: 1:45 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 26, 6, 25, 0, false);          // UTC: 6:25 AM Local: 11:55 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 14, 7, 39, 0, false);          // UTC: 7:39 AM Local: 1:09 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 10, 13, 44, 0, false);         // UTC: 1:44 PM Local: 7:14 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 21, 15, 41, 0, false);         // UTC: 3:41 PM Local: 9:11 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 21, 21, 25, 0, false);         // UTC: 9:25 PM Local: 2:55 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 24, 15, 49, 0, false);         // UTC: 3:49 PM Local: 9:19 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 8, 10, 51, 0, false);          // UTC: 10:51 AM Local: 4:21 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 6, 13, 11, 21, 0, false);         // UTC: 11:21 AM Local: 4:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 13, 10, 42, 0, false);         // UTC: 10:42 AM Local: 4:12 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 11, 3, 49, 0, false);          // UTC: 3:49 AM Local: 9:19 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 5, 15, 14, 0, false);          // UTC: 3:14 PM Local: 8:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 31, 21, 47, 0, false);         // UTC: 9:47 PM Local: 3:17 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 8, 18, 42, 0, false);          // UTC: 6:42 PM Local: 12:12 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 27, 2, 11, 0, false);          // UTC: 2:11 AM Local: 7:41 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 23, 16, 44, 0, false);         // UTC: 4:44 PM Local: 10:14 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 10, 8, 13, 0, false);          // UTC: 8:13 AM Local: 1:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 8, 15, 16, 0, false);          // UTC: 3:16 PM Local: 8:46 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 16, 5, 53, 0, false);          // UTC: 5:53 AM Local: 11:23 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 8, 15, 59, 0, false);          // UTC: 3:59 PM Local: 9:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 12, 5, 56, 0, false);          // UTC: 5:56 AM Local: 11:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 17, 20, 42, 0, false);         // UTC: 8:42 PM Local: 2:12 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 7, 17, 54, 0, false);          // UTC: 5:54 PM Local: 11:24 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 18, 19, 49, 0, false);         // UTC: 7:49 PM Local: 1:19 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 21, 22, 21, 0, false);         // UTC: 10:21 PM Local: 3:51 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 20, 3, 51, 0, false);          // UTC: 3:51 AM Local: 9:21 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 20, 1, 16, 0, false);          // UTC: 1:16 AM Local: 6:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 25, 1, 14, 0, false);          // UTC: 1:14 AM Local: 6:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 2, 11, 54, 0, false);          // UTC: 11:54 AM Local: 5:24 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 13, 10, 33, 0, false);         // UTC: 10:33 AM Local: 4:03 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 10, 18, 40, 0, false);         // UTC: 6:40 PM Local: 12:10 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 19, 10, 20, 0, false);         // UTC: 10:20 AM Local: 3:50 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 12, 13, 41, 0, false);         // UTC: 1:41 PM Local: 7:11 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 7, 18, 20, 24, 0, false);         // UTC: 8:24 PM Local: 1:54 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 25, 0, 58, 0, false);          // UTC: 12:58 AM Local: 6:28 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 28, 15, 56, 0, false);         // UTC: 3:56 PM Local: 9:26 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 24, 18, 40, 0, false);         // UTC: 6:40 PM Local: 12:10 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 8, 13, 44, 0, false);          // UTC: 1:44 PM Local: 7:14 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 3, 21, 58, 0, false);          // UTC: 9:58 PM Local: 3:28 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 6, 13, 8, 0, false);           // UTC: 1:08 PM Local: 6:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 4, 1, 39, 0, false);           // UTC: 1:39 AM Local: 7:09 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 3, 1, 40, 0, false);           // UTC: 1:40 AM Local: 7:10 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 13, 23, 38, 0, false);         // UTC: 11:38 PM Local: 5:08 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 18, 13, 22, 0, false);         // UTC: 1:22 PM Local: 6:52 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 5, 6, 34, 0, false);           // UTC: 6:34 AM Local: 12:04 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 12, 2, 8, 0, false);           // UTC: 2:08 AM Local: 7:38 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 2, 11, 33, 0, false);          // UTC: 11:33 AM Local: 5:03 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 31, 8, 56, 0, false);          // UTC: 8:56 AM Local: 2:26 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 17, 16, 3, 0, false);          // UTC: 4:03 PM Local: 9:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 15, 16, 1, 0, false);          // UTC: 4:01 PM Local: 9:31 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 5, 0, 37, 0, false);           // UTC: 12:37 AM Local: 6:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 15, 15, 14, 0, false);         // UTC: 3:14 PM Local: 8:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 23, 4, 43, 0, false);          // UTC: 4:43 AM Local: 10:13 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 6, 16, 39, 0, false);          // UTC: 4:39 PM Local: 10:09 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 13, 7, 50, 0, false);          // UTC: 7:50 AM Local: 1:20 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 24, 7, 45, 0, false);          // UTC: 7:45 AM Local: 1:15 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 31, 13, 54, 0, false);         // UTC: 1:54 PM Local: 7:24 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 11, 20, 51, 0, false);         // UTC: 8:51 PM Local: 2:21 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 8, 16, 1, 7, 0, false);           // UTC: 1:07 AM Local: 6:37 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 25, 17, 11, 0, false);         // UTC: 5:11 PM Local: 10:41 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 13, 18, 18, 0, false);         // UTC: 6:18 PM Local: 11:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 30, 10, 48, 0, false);         // UTC: 10:48 AM Local: 4:18 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 25, 20, 6, 0, false);          // UTC: 8:06 PM Local: 1:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 29, 8, 9, 0, false);           // UTC: 8:09 AM Local: 1:39 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 17, 0, 15, 0, false);          // UTC: 12:15 AM Local: 5:45 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 9, 14, 9, 0, false);           // UTC: 2:09 PM Local: 7:39 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 25, 12, 18, 0, false);         // UTC: 12:18 PM Local: 5:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 21, 2, 39, 0, false);          // UTC: 2:39 AM Local: 8:09 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 17, 12, 59, 0, false);         // UTC: 12:59 PM Local: 6:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 8, 21, 53, 0, false);          // UTC: 9:53 PM Local: 3:23 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 24, 1, 46, 0, false);          // UTC: 1:46 AM Local: 7:16 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 16, 19, 22, 0, false);         // UTC: 7:22 PM Local: 12:52 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 6, 5, 58, 0, false);           // UTC: 5:58 AM Local: 11:28 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 7, 3, 6, 0, false);            // UTC: 3:06 AM Local: 8:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 10, 11, 43, 0, false);         // UTC: 11:43 AM Local: 5:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 6, 7, 8, 0, false);            // UTC: 7:08 AM Local: 12:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 29, 18, 18, 0, false);         // UTC: 6:18 PM Local: 11:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 14, 4, 36, 0, false);          // UTC: 4:36 AM Local: 10:06 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 16, 7, 44, 0, false);          // UTC: 7:44 AM Local: 1:14 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 1, 4, 33, 0, false);           // UTC: 4:33 AM Local: 10:03 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 21, 21, 48, 0, false);         // UTC: 9:48 PM Local: 3:18 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 27, 1, 50, 0, false);          // UTC: 1:50 AM Local: 7:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 29, 11, 27, 0, false);         // UTC: 11:27 AM Local: 4:57 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 9, 3, 15, 21, 0, false);          // UTC: 3:21 PM Local: 8:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 20, 5, 41, 0, false);         // UTC: 5:41 AM Local: 11:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 28, 22, 23, 0, false);        // UTC: 10:23 PM Local: 3:53 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 26, 17, 3, 0, false);         // UTC: 5:03 PM Local: 10:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 24, 20, 29, 0, false);        // UTC: 8:29 PM Local: 1:59 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 2, 15, 42, 0, false);         // UTC: 3:42 PM Local: 9:12 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 11, 19, 38, 0, false);        // UTC: 7:38 PM Local: 1:08 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 6, 7, 25, 0, false);          // UTC: 7:25 AM Local: 12:55 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 23, 11, 28, 0, false);        // UTC: 11:28 AM Local: 4:58 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 31, 18, 56, 0, false);        // UTC: 6:56 PM Local: 12:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 13, 21, 49, 0, false);        // UTC: 9:49 PM Local: 3:19 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 27, 11, 24, 0, false);        // UTC: 11:24 AM Local: 4:54 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 3, 4, 17, 0, false);          // UTC: 4:17 AM Local: 9:47 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 22, 19, 15, 0, false);        // UTC: 7:15 PM Local: 12:45 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 20, 3, 6, 0, false);          // UTC: 3:06 AM Local: 8:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 3, 6, 25, 0, false);          // UTC: 6:25 AM Local: 11:55 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 7, 10, 4, 0, false);          // UTC: 10:04 AM Local: 3:34 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 14, 11, 13, 0, false);        // UTC: 11:13 AM Local: 4:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 2, 23, 24, 0, false);         // UTC: 11:24 PM Local: 4:54 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 23, 6, 27, 0, false);         // UTC: 6:27 AM Local: 11:57 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 18, 23, 26, 0, false);        // UTC: 11:26 PM Local: 4:56 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 1, 18, 50, 0, false);         // UTC: 6:50 PM Local: 12:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 28, 20, 1, 0, false);         // UTC: 8:01 PM Local: 1:31 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 25, 0, 9, 0, false);          // UTC: 12:09 AM Local: 5:39 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 3, 3, 30, 0, false);          // UTC: 3:30 AM Local: 9:00 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 10, 11, 5, 33, 0, false);         // UTC: 5:33 AM Local: 11:03 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 14, 22, 53, 0, false);        // UTC: 10:53 PM Local: 4:23 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 15, 22, 34, 0, false);        // UTC: 10:34 PM Local: 4:04 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 2, 3, 45, 0, false);          // UTC: 3:45 AM Local: 9:15 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 4, 12, 9, 0, false);          // UTC: 12:09 PM Local: 5:39 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 30, 0, 8, 0, false);          // UTC: 12:08 AM Local: 5:38 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 16, 9, 19, 0, false);         // UTC: 9:19 AM Local: 2:49 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 18, 9, 20, 0, false);         // UTC: 9:20 AM Local: 2:50 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 12, 14, 53, 0, false);        // UTC: 2:53 PM Local: 8:23 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 28, 19, 32, 0, false);        // UTC: 7:32 PM Local: 1:02 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 8, 2, 50, 0, false);          // UTC: 2:50 AM Local: 8:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 5, 9, 24, 0, false);          // UTC: 9:24 AM Local: 2:54 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 11, 17, 55, 0, false);        // UTC: 5:55 PM Local: 11:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 16, 20, 27, 0, false);        // UTC: 8:27 PM Local: 1:57 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 9, 16, 11, 0, false);         // UTC: 4:11 PM Local: 9:41 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 10, 14, 18, 0, false);        // UTC: 2:18 PM Local: 7:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 8, 0, 23, 0, false);          // UTC: 12:23 AM Local: 5:53 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 13, 21, 53, 0, false);        // UTC: 9:53 PM Local: 3:23 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 8, 12, 23, 0, false);         // UTC: 12:23 PM Local: 5:53 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 21, 8, 4, 0, false);          // UTC: 8:04 AM Local: 1:34 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 1, 6, 59, 0, false);          // UTC: 6:59 AM Local: 12:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 3, 11, 48, 0, false);         // UTC: 11:48 AM Local: 5:18 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 27, 1, 42, 0, false);         // UTC: 1:42 AM Local: 7:12 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 10, 16, 14, 0, false);        // UTC: 4:14 PM Local: 9:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 29, 21, 51, 0, false);        // UTC: 9:51 PM Local: 3:21 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 11, 29, 9, 1, 0, false);          // UTC: 9:01 AM Local: 2:31 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 1, 5, 48, 0, false);          // UTC: 5:48 AM Local: 11:18 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 5, 23, 54, 0, false);         // UTC: 11:54 PM Local: 5:24 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 30, 4, 3, 0, false);          // UTC: 4:03 AM Local: 9:33 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 22, 19, 39, 0, false);        // UTC: 7:39 PM Local: 1:09 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 25, 10, 49, 0, false);        // UTC: 10:49 AM Local: 4:19 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 7, 10, 5, 0, false);          // UTC: 10:05 AM Local: 3:35 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 22, 8, 38, 0, false);         // UTC: 8:38 AM Local: 2:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 31, 20, 9, 0, false);         // UTC: 8:09 PM Local: 1:39 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 26, 16, 3, 0, false);         // UTC: 4:03 PM Local: 9:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 29, 7, 39, 0, false);         // UTC: 7:39 AM Local: 1:09 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 17, 20, 1, 0, false);         // UTC: 8:01 PM Local: 1:31 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 6, 3, 38, 0, false);          // UTC: 3:38 AM Local: 9:08 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 9, 6, 45, 0, false);          // UTC: 6:45 AM Local: 12:15 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 7, 13, 18, 0, false);         // UTC: 1:18 PM Local: 6:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 30, 4, 32, 0, false);         // UTC: 4:32 AM Local: 10:02 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 8, 4, 39, 0, false);          // UTC: 4:39 AM Local: 10:09 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 31, 0, 47, 0, false);         // UTC: 12:47 AM Local: 6:17 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 11, 18, 49, 0, false);        // UTC: 6:49 PM Local: 12:19 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 26, 16, 49, 0, false);        // UTC: 4:49 PM Local: 10:19 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 29, 1, 8, 0, false);          // UTC: 1:08 AM Local: 6:38 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 30, 0, 34, 0, false);         // UTC: 12:34 AM Local: 6:04 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 9, 4, 54, 0, false);          // UTC: 4:54 AM Local: 10:24 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 3, 17, 48, 0, false);         // UTC: 5:48 PM Local: 11:18 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 11, 17, 37, 0, false);        // UTC: 5:37 PM Local: 11:07 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2018, 12, 5, 17, 13, 0, false);         // UTC: 5:13 PM Local: 10:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 12, 23, 6, 0, false);          // UTC: 11:06 PM Local: 4:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 13, 5, 56, 0, false);          // UTC: 5:56 AM Local: 11:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 3, 1, 33, 0, false);           // UTC: 1:33 AM Local: 7:03 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 19, 5, 54, 0, false);          // UTC: 5:54 AM Local: 11:24 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 30, 7, 56, 0, false);          // UTC: 7:56 AM Local: 1:26 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 9, 18, 33, 0, false);          // UTC: 6:33 PM Local: 12:03 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 6, 18, 41, 0, false);          // UTC: 6:41 PM Local: 12:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 25, 6, 20, 0, false);          // UTC: 6:20 AM Local: 11:50 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 28, 5, 32, 0, false);          // UTC: 5:32 AM Local: 11:02 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 29, 1, 41, 0, false);          // UTC: 1:41 AM Local: 7:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 28, 1, 26, 0, false);          // UTC: 1:26 AM Local: 6:56 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 4, 5, 24, 0, false);           // UTC: 5:24 AM Local: 10:54 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 18, 18, 41, 0, false);         // UTC: 6:41 PM Local: 12:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 20, 15, 4, 0, false);          // UTC: 3:04 PM Local: 8:34 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 23, 18, 29, 0, false);         // UTC: 6:29 PM Local: 11:59 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 8, 22, 30, 0, false);          // UTC: 10:30 PM Local: 4:00 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 11, 7, 14, 0, false);          // UTC: 7:14 AM Local: 12:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 13, 4, 19, 0, false);          // UTC: 4:19 AM Local: 9:49 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 9, 18, 7, 0, false);           // UTC: 6:07 PM Local: 11:37 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 10, 8, 39, 0, false);          // UTC: 8:39 AM Local: 2:09 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 18, 22, 54, 0, false);         // UTC: 10:54 PM Local: 4:24 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 8, 15, 23, 0, false);          // UTC: 3:23 PM Local: 8:53 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 16, 11, 59, 0, false);         // UTC: 11:59 AM Local: 5:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 14, 17, 30, 0, false);         // UTC: 5:30 PM Local: 11:00 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 1, 20, 14, 31, 0, false);         // UTC: 2:31 PM Local: 8:01 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 22, 14, 12, 0, false);         // UTC: 2:12 PM Local: 7:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 25, 6, 32, 0, false);          // UTC: 6:32 AM Local: 12:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 11, 19, 28, 0, false);         // UTC: 7:28 PM Local: 12:58 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 12, 8, 18, 0, false);          // UTC: 8:18 AM Local: 1:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 19, 10, 4, 0, false);          // UTC: 10:04 AM Local: 3:34 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 12, 13, 26, 0, false);         // UTC: 1:26 PM Local: 6:56 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 15, 8, 38, 0, false);          // UTC: 8:38 AM Local: 2:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 5, 23, 41, 0, false);          // UTC: 11:41 PM Local: 5:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 20, 14, 33, 0, false);         // UTC: 2:33 PM Local: 8:03 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 3, 4, 1, 0, false);            // UTC: 4:01 AM Local: 9:31 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 13, 11, 50, 0, false);         // UTC: 11:50 AM Local: 5:20 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 28, 23, 51, 0, false);         // UTC: 11:51 PM Local: 5:21 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 2, 14, 14, 0, false);          // UTC: 2:14 PM Local: 7:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 22, 8, 35, 0, false);          // UTC: 8:35 AM Local: 2:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 21, 15, 42, 0, false);         // UTC: 3:42 PM Local: 9:12 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 14, 6, 59, 0, false);          // UTC: 6:59 AM Local: 12:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 28, 14, 20, 0, false);         // UTC: 2:20 PM Local: 7:50 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 8, 7, 51, 0, false);           // UTC: 7:51 AM Local: 1:21 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 27, 2, 49, 0, false);          // UTC: 2:49 AM Local: 8:19 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 5, 21, 47, 0, false);          // UTC: 9:47 PM Local: 3:17 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 26, 6, 39, 0, false);          // UTC: 6:39 AM Local: 12:09 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 11, 19, 21, 0, false);         // UTC: 7:21 PM Local: 12:51 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 13, 1, 11, 0, false);          // UTC: 1:11 AM Local: 6:41 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 17, 15, 6, 0, false);          // UTC: 3:06 PM Local: 8:36 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 2, 16, 18, 20, 0, false);         // UTC: 6:20 PM Local: 11:50 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 21, 23, 45, 0, false);         // UTC: 11:45 PM Local: 5:15 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 29, 5, 50, 0, false);          // UTC: 5:50 AM Local: 11:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 15, 0, 41, 0, false);          // UTC: 12:41 AM Local: 6:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 28, 0, 14, 0, false);          // UTC: 12:14 AM Local: 5:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 5, 8, 26, 0, false);           // UTC: 8:26 AM Local: 1:56 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 8, 19, 10, 0, false);          // UTC: 7:10 PM Local: 12:40 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 22, 17, 16, 0, false);         // UTC: 5:16 PM Local: 10:46 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 31, 20, 44, 0, false);         // UTC: 8:44 PM Local: 2:14 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 27, 17, 4, 0, false);          // UTC: 5:04 PM Local: 10:34 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 31, 5, 52, 0, false);          // UTC: 5:52 AM Local: 11:22 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 5, 13, 9, 0, false);           // UTC: 1:09 PM Local: 6:39 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 4, 17, 1, 0, false);           // UTC: 5:01 PM Local: 10:31 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 13, 10, 38, 0, false);         // UTC: 10:38 AM Local: 4:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 28, 7, 1, 0, false);           // UTC: 7:01 AM Local: 12:31 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 1, 14, 53, 0, false);          // UTC: 2:53 PM Local: 8:23 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 17, 1, 59, 0, false);          // UTC: 1:59 AM Local: 7:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 2, 13, 47, 0, false);          // UTC: 1:47 PM Local: 7:17 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 17, 14, 8, 0, false);          // UTC: 2:08 PM Local: 7:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 16, 11, 43, 0, false);         // UTC: 11:43 AM Local: 5:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 19, 8, 51, 0, false);          // UTC: 8:51 AM Local: 2:21 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 31, 9, 32, 0, false);          // UTC: 9:32 AM Local: 3:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 28, 8, 4, 0, false);           // UTC: 8:04 AM Local: 1:34 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 3, 1, 16, 0, false);           // UTC: 1:16 AM Local: 6:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 20, 2, 47, 0, false);          // UTC: 2:47 AM Local: 8:17 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 3, 21, 7, 4, 0, false);           // UTC: 7:04 AM Local: 12:34 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 18, 1, 59, 0, false);          // UTC: 1:59 AM Local: 7:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 9, 2, 45, 0, false);           // UTC: 2:45 AM Local: 8:15 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 23, 0, 16, 0, false);          // UTC: 12:16 AM Local: 5:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 15, 5, 56, 0, false);          // UTC: 5:56 AM Local: 11:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 8, 15, 40, 0, false);          // UTC: 3:40 PM Local: 9:10 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 28, 8, 41, 0, false);          // UTC: 8:41 AM Local: 2:11 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 24, 5, 22, 0, false);          // UTC: 5:22 AM Local: 10:52 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 19, 2, 56, 0, false);          // UTC: 2:56 AM Local: 8:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 26, 12, 32, 0, false);         // UTC: 12:32 PM Local: 6:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 5, 7, 14, 0, false);           // UTC: 7:14 AM Local: 12:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 21, 5, 16, 0, false);          // UTC: 5:16 AM Local: 10:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 12, 12, 16, 0, false);         // UTC: 12:16 PM Local: 5:46 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 19, 22, 46, 0, false);         // UTC: 10:46 PM Local: 4:16 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 29, 23, 33, 0, false);         // UTC: 11:33 PM Local: 5:03 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 4, 12, 31, 0, false);          // UTC: 12:31 PM Local: 6:01 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 17, 21, 19, 0, false);         // UTC: 9:19 PM Local: 2:49 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 9, 2, 23, 0, false);           // UTC: 2:23 AM Local: 7:53 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 9, 3, 27, 0, false);           // UTC: 3:27 AM Local: 8:57 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 26, 20, 27, 0, false);         // UTC: 8:27 PM Local: 1:57 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 6, 6, 25, 0, false);           // UTC: 6:25 AM Local: 11:55 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 19, 5, 13, 0, false);          // UTC: 5:13 AM Local: 10:43 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 26, 4, 41, 0, false);          // UTC: 4:41 AM Local: 10:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 10, 10, 27, 0, false);         // UTC: 10:27 AM Local: 3:57 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 29, 9, 32, 0, false);          // UTC: 9:32 AM Local: 3:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 4, 1, 14, 25, 0, false);          // UTC: 2:25 PM Local: 7:55 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 31, 7, 17, 0, false);          // UTC: 7:17 AM Local: 12:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 23, 0, 46, 0, false);          // UTC: 12:46 AM Local: 6:16 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 15, 16, 39, 0, false);         // UTC: 4:39 PM Local: 10:09 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 18, 21, 38, 0, false);         // UTC: 9:38 PM Local: 3:08 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 1, 0, 29, 0, false);           // UTC: 12:29 AM Local: 5:59 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 22, 13, 59, 0, false);         // UTC: 1:59 PM Local: 7:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 3, 15, 15, 0, false);          // UTC: 3:15 PM Local: 8:45 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 25, 0, 11, 0, false);          // UTC: 12:11 AM Local: 5:41 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 2, 4, 28, 0, false);           // UTC: 4:28 AM Local: 9:58 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 15, 6, 53, 0, false);          // UTC: 6:53 AM Local: 12:23 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 4, 17, 38, 0, false);          // UTC: 5:38 PM Local: 11:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 22, 11, 1, 0, false);          // UTC: 11:01 AM Local: 4:31 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 25, 15, 12, 0, false);         // UTC: 3:12 PM Local: 8:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 26, 19, 38, 0, false);         // UTC: 7:38 PM Local: 1:08 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 7, 1, 22, 0, false);           // UTC: 1:22 AM Local: 6:52 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 7, 13, 12, 0, false);          // UTC: 1:12 PM Local: 6:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 2, 1, 47, 0, false);           // UTC: 1:47 AM Local: 7:17 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 8, 13, 8, 0, false);           // UTC: 1:08 PM Local: 6:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 5, 6, 58, 0, false);           // UTC: 6:58 AM Local: 12:28 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 22, 13, 53, 0, false);         // UTC: 1:53 PM Local: 7:23 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 17, 6, 35, 0, false);          // UTC: 6:35 AM Local: 12:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 9, 23, 15, 0, false);          // UTC: 11:15 PM Local: 4:45 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 20, 14, 32, 0, false);         // UTC: 2:32 PM Local: 8:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 5, 2, 1, 0, false);            // UTC: 2:01 AM Local: 7:31 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 5, 13, 0, 56, 0, false);          // UTC: 12:56 AM Local: 6:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 2, 8, 57, 0, false);           // UTC: 8:57 AM Local: 2:27 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 30, 9, 55, 0, false);          // UTC: 9:55 AM Local: 3:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 18, 6, 32, 0, false);          // UTC: 6:32 AM Local: 12:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 4, 2, 31, 0, false);           // UTC: 2:31 AM Local: 8:01 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 11, 4, 27, 0, false);          // UTC: 4:27 AM Local: 9:57 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 18, 17, 58, 0, false);         // UTC: 5:58 PM Local: 11:28 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 12, 16, 33, 0, false);         // UTC: 4:33 PM Local: 10:03 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 2, 3, 31, 0, false);           // UTC: 3:31 AM Local: 9:01 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 23, 12, 37, 0, false);         // UTC: 12:37 PM Local: 6:07 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 8, 5, 31, 0, false);           // UTC: 5:31 AM Local: 11:01 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 15, 16, 37, 0, false);         // UTC: 4:37 PM Local: 10:07 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 16, 2, 14, 0, false);          // UTC: 2:14 AM Local: 7:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 5, 15, 28, 0, false);          // UTC: 3:28 PM Local: 8:58 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 18, 7, 12, 0, false);          // UTC: 7:12 AM Local: 12:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 28, 11, 8, 0, false);          // UTC: 11:08 AM Local: 4:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 17, 5, 20, 0, false);          // UTC: 5:20 AM Local: 10:50 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 20, 16, 50, 0, false);         // UTC: 4:50 PM Local: 10:20 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 4, 15, 31, 0, false);          // UTC: 3:31 PM Local: 9:01 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 25, 21, 50, 0, false);         // UTC: 9:50 PM Local: 3:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 20, 14, 35, 0, false);         // UTC: 2:35 PM Local: 8:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 8, 22, 24, 0, false);          // UTC: 10:24 PM Local: 3:54 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 22, 16, 25, 0, false);         // UTC: 4:25 PM Local: 9:55 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 16, 3, 31, 0, false);          // UTC: 3:31 AM Local: 9:01 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 10, 0, 37, 0, false);          // UTC: 12:37 AM Local: 6:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 6, 25, 12, 7, 0, false);          // UTC: 12:07 PM Local: 5:37 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 11, 10, 54, 0, false);         // UTC: 10:54 AM Local: 4:24 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 13, 12, 48, 0, false);         // UTC: 12:48 PM Local: 6:18 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 25, 22, 6, 0, false);          // UTC: 10:06 PM Local: 3:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 17, 17, 3, 0, false);          // UTC: 5:03 PM Local: 10:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 2, 16, 0, 0, false);           // UTC: 4:00 PM Local: 9:30 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 26, 9, 17, 0, false);          // UTC: 9:17 AM Local: 2:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 26, 20, 48, 0, false);         // UTC: 8:48 PM Local: 2:18 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 24, 16, 26, 0, false);         // UTC: 4:26 PM Local: 9:56 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 17, 5, 12, 0, false);          // UTC: 5:12 AM Local: 10:42 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 23, 8, 55, 0, false);          // UTC: 8:55 AM Local: 2:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 26, 1, 14, 0, false);          // UTC: 1:14 AM Local: 6:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 29, 15, 23, 0, false);         // UTC: 3:23 PM Local: 8:53 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 20, 2, 50, 0, false);          // UTC: 2:50 AM Local: 8:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 21, 14, 18, 0, false);         // UTC: 2:18 PM Local: 7:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 29, 0, 8, 0, false);           // UTC: 12:08 AM Local: 5:38 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 25, 23, 44, 0, false);         // UTC: 11:44 PM Local: 5:14 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 22, 7, 17, 0, false);          // UTC: 7:17 AM Local: 12:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 5, 11, 43, 0, false);          // UTC: 11:43 AM Local: 5:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 28, 2, 21, 0, false);          // UTC: 2:21 AM Local: 7:51 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 10, 6, 58, 0, false);          // UTC: 6:58 AM Local: 12:28 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 29, 23, 12, 0, false);         // UTC: 11:12 PM Local: 4:42 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 13, 5, 28, 0, false);          // UTC: 5:28 AM Local: 10:58 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 27, 8, 1, 0, false);           // UTC: 8:01 AM Local: 1:31 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 24, 17, 2, 0, false);          // UTC: 5:02 PM Local: 10:32 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 7, 20, 22, 14, 0, false);         // UTC: 10:14 PM Local: 3:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 3, 20, 16, 0, false);          // UTC: 8:16 PM Local: 1:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 12, 22, 59, 0, false);         // UTC: 10:59 PM Local: 4:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 4, 13, 3, 0, false);           // UTC: 1:03 PM Local: 6:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 21, 17, 19, 0, false);         // UTC: 5:19 PM Local: 10:49 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 23, 14, 11, 0, false);         // UTC: 2:11 PM Local: 7:41 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 9, 6, 14, 0, false);           // UTC: 6:14 AM Local: 11:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 24, 11, 43, 0, false);         // UTC: 11:43 AM Local: 5:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 21, 17, 41, 0, false);         // UTC: 5:41 PM Local: 11:11 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 28, 3, 17, 0, false);          // UTC: 3:17 AM Local: 8:47 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 9, 21, 14, 0, false);          // UTC: 9:14 PM Local: 2:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 17, 10, 38, 0, false);         // UTC: 10:38 AM Local: 4:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 13, 13, 21, 0, false);         // UTC: 1:21 PM Local: 6:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 3, 9, 12, 0, false);           // UTC: 9:12 AM Local: 2:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 26, 1, 20, 0, false);          // UTC: 1:20 AM Local: 6:50 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 29, 8, 6, 0, false);           // UTC: 8:06 AM Local: 1:36 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 27, 20, 0, 0, false);          // UTC: 8:00 PM Local: 1:30 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 17, 10, 8, 0, false);          // UTC: 10:08 AM Local: 3:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 6, 11, 47, 0, false);          // UTC: 11:47 AM Local: 5:17 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 5, 4, 44, 0, false);           // UTC: 4:44 AM Local: 10:14 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 1, 8, 43, 0, false);           // UTC: 8:43 AM Local: 2:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 22, 2, 8, 0, false);           // UTC: 2:08 AM Local: 7:38 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 24, 3, 20, 0, false);          // UTC: 3:20 AM Local: 8:50 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 26, 4, 35, 0, false);          // UTC: 4:35 AM Local: 10:05 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 14, 18, 38, 0, false);         // UTC: 6:38 PM Local: 12:08 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 8, 10, 2, 31, 0, false);          // UTC: 2:31 AM Local: 8:01 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 18, 20, 53, 0, false);         // UTC: 8:53 PM Local: 2:23 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 14, 15, 47, 0, false);         // UTC: 3:47 PM Local: 9:17 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 18, 17, 2, 0, false);          // UTC: 5:02 PM Local: 10:32 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 2, 4, 16, 0, false);           // UTC: 4:16 AM Local: 9:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 5, 9, 10, 0, false);           // UTC: 9:10 AM Local: 2:40 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 18, 18, 59, 0, false);         // UTC: 6:59 PM Local: 12:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 21, 14, 30, 0, false);         // UTC: 2:30 PM Local: 8:00 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 6, 19, 31, 0, false);          // UTC: 7:31 PM Local: 1:01 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 20, 11, 32, 0, false);         // UTC: 11:32 AM Local: 5:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 17, 11, 59, 0, false);         // UTC: 11:59 AM Local: 5:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 14, 3, 59, 0, false);          // UTC: 3:59 AM Local: 9:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 30, 6, 46, 0, false);          // UTC: 6:46 AM Local: 12:16 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 16, 4, 14, 0, false);          // UTC: 4:14 AM Local: 9:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 5, 17, 12, 0, false);          // UTC: 5:12 PM Local: 10:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 2, 22, 45, 0, false);          // UTC: 10:45 PM Local: 4:15 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 4, 13, 48, 0, false);          // UTC: 1:48 PM Local: 7:18 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 21, 4, 20, 0, false);          // UTC: 4:20 AM Local: 9:50 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 11, 19, 14, 0, false);         // UTC: 7:14 PM Local: 12:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 10, 4, 59, 0, false);          // UTC: 4:59 AM Local: 10:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 1, 20, 12, 0, false);          // UTC: 8:12 PM Local: 1:42 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 10, 5, 13, 0, false);          // UTC: 5:13 AM Local: 10:43 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 5, 7, 15, 0, false);           // UTC: 7:15 AM Local: 12:45 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 3, 15, 51, 0, false);          // UTC: 3:51 PM Local: 9:21 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 25, 15, 28, 0, false);         // UTC: 3:28 PM Local: 8:58 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 9, 22, 1, 22, 0, false);          // UTC: 1:22 AM Local: 6:52 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 5, 0, 41, 0, false);          // UTC: 12:41 AM Local: 6:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 23, 8, 19, 0, false);         // UTC: 8:19 AM Local: 1:49 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 30, 7, 35, 0, false);         // UTC: 7:35 AM Local: 1:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 11, 1, 12, 0, false);         // UTC: 1:12 AM Local: 6:42 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 22, 10, 29, 0, false);        // UTC: 10:29 AM Local: 3:59 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 15, 4, 57, 0, false);         // UTC: 4:57 AM Local: 10:27 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 27, 12, 17, 0, false);        // UTC: 12:17 PM Local: 5:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 19, 8, 49, 0, false);         // UTC: 8:49 AM Local: 2:19 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 1, 10, 4, 0, false);          // UTC: 10:04 AM Local: 3:34 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 5, 5, 36, 0, false);          // UTC: 5:36 AM Local: 11:06 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 17, 8, 0, 0, false);          // UTC: 8:00 AM Local: 1:30 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 27, 14, 24, 0, false);        // UTC: 2:24 PM Local: 7:54 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 27, 2, 6, 0, false);          // UTC: 2:06 AM Local: 7:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 16, 2, 5, 0, false);          // UTC: 2:05 AM Local: 7:35 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 26, 0, 20, 0, false);         // UTC: 12:20 AM Local: 5:50 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 30, 7, 6, 0, false);          // UTC: 7:06 AM Local: 12:36 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 9, 3, 16, 0, false);          // UTC: 3:16 AM Local: 8:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 9, 17, 7, 0, false);          // UTC: 5:07 PM Local: 10:37 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 20, 13, 58, 0, false);        // UTC: 1:58 PM Local: 7:28 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 22, 16, 25, 0, false);        // UTC: 4:25 PM Local: 9:55 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 28, 17, 44, 0, false);        // UTC: 5:44 PM Local: 11:14 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 2, 5, 16, 0, false);          // UTC: 5:16 AM Local: 10:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 2, 20, 46, 0, false);         // UTC: 8:46 PM Local: 2:16 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 24, 21, 43, 0, false);        // UTC: 9:43 PM Local: 3:13 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 10, 16, 5, 42, 0, false);         // UTC: 5:42 AM Local: 11:12 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 12, 11, 24, 0, false);        // UTC: 11:24 AM Local: 4:54 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 9, 21, 41, 0, false);         // UTC: 9:41 PM Local: 3:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 16, 18, 30, 0, false);        // UTC: 6:30 PM Local: 12:00 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 28, 23, 26, 0, false);        // UTC: 11:26 PM Local: 4:56 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 23, 3, 58, 0, false);         // UTC: 3:58 AM Local: 9:28 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 16, 16, 13, 0, false);        // UTC: 4:13 PM Local: 9:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 25, 16, 7, 0, false);         // UTC: 4:07 PM Local: 9:37 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 29, 0, 10, 0, false);         // UTC: 12:10 AM Local: 5:40 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 16, 17, 43, 0, false);        // UTC: 5:43 PM Local: 11:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 29, 1, 54, 0, false);         // UTC: 1:54 AM Local: 7:24 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 9, 23, 47, 0, false);         // UTC: 11:47 PM Local: 5:17 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 23, 19, 37, 0, false);        // UTC: 7:37 PM Local: 1:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 7, 8, 30, 0, false);          // UTC: 8:30 AM Local: 2:00 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 19, 12, 38, 0, false);        // UTC: 12:38 PM Local: 6:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 24, 8, 39, 0, false);         // UTC: 8:39 AM Local: 2:09 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 7, 13, 18, 0, false);         // UTC: 1:18 PM Local: 6:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 24, 15, 14, 0, false);        // UTC: 3:14 PM Local: 8:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 8, 19, 53, 0, false);         // UTC: 7:53 PM Local: 1:23 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 22, 17, 38, 0, false);        // UTC: 5:38 PM Local: 11:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 26, 16, 35, 0, false);        // UTC: 4:35 PM Local: 10:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 7, 14, 17, 0, false);         // UTC: 2:17 PM Local: 7:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 2, 20, 40, 0, false);         // UTC: 8:40 PM Local: 2:10 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 7, 8, 13, 0, false);          // UTC: 8:13 AM Local: 1:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 20, 23, 57, 0, false);        // UTC: 11:57 PM Local: 5:27 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 11, 5, 22, 56, 0, false);         // UTC: 10:56 PM Local: 4:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 24, 9, 6, 0, false);          // UTC: 9:06 AM Local: 2:36 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 14, 20, 58, 0, false);        // UTC: 8:58 PM Local: 2:28 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 28, 17, 12, 0, false);        // UTC: 5:12 PM Local: 10:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 22, 8, 18, 0, false);         // UTC: 8:18 AM Local: 1:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 29, 22, 35, 0, false);        // UTC: 10:35 PM Local: 4:05 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 9, 16, 12, 0, false);         // UTC: 4:12 PM Local: 9:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 25, 10, 33, 0, false);        // UTC: 10:33 AM Local: 4:03 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 3, 19, 11, 0, false);         // UTC: 7:11 PM Local: 12:41 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 29, 18, 23, 0, false);        // UTC: 6:23 PM Local: 11:53 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 21, 11, 44, 0, false);        // UTC: 11:44 AM Local: 5:14 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 23, 6, 17, 0, false);         // UTC: 6:17 AM Local: 11:47 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 17, 3, 33, 0, false);         // UTC: 3:33 AM Local: 9:03 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 14, 17, 37, 0, false);        // UTC: 5:37 PM Local: 11:07 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 6, 18, 38, 0, false);         // UTC: 6:38 PM Local: 12:08 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 22, 9, 0, 0, false);          // UTC: 9:00 AM Local: 2:30 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 15, 19, 14, 0, false);        // UTC: 7:14 PM Local: 12:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 11, 7, 26, 0, false);         // UTC: 7:26 AM Local: 12:56 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 8, 11, 28, 0, false);         // UTC: 11:28 AM Local: 4:58 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 8, 8, 9, 0, false);           // UTC: 8:09 AM Local: 1:39 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 22, 2, 50, 0, false);         // UTC: 2:50 AM Local: 8:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 3, 1, 43, 0, false);          // UTC: 1:43 AM Local: 7:13 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 20, 11, 34, 0, false);        // UTC: 11:34 AM Local: 5:04 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 12, 6, 24, 0, false);         // UTC: 6:24 AM Local: 11:54 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 17, 8, 59, 0, false);         // UTC: 8:59 AM Local: 2:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2019, 12, 8, 8, 20, 0, false);          // UTC: 8:20 AM Local: 1:50 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 22, 16, 2, 0, false);          // UTC: 4:02 PM Local: 9:32 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 28, 3, 30, 0, false);          // UTC: 3:30 AM Local: 9:00 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 1, 18, 13, 0, false);          // UTC: 6:13 PM Local: 11:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 24, 8, 12, 0, false);          // UTC: 8:12 AM Local: 1:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 24, 5, 19, 0, false);          // UTC: 5:19 AM Local: 10:49 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 28, 3, 30, 0, false);          // UTC: 3:30 AM Local: 9:00 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 11, 13, 13, 0, false);         // UTC: 1:13 PM Local: 6:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 28, 15, 4, 0, false);          // UTC: 3:04 PM Local: 8:34 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 2, 5, 2, 0, false);            // UTC: 5:02 AM Local: 10:32 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 8, 0, 2, 0, false);            // UTC: 12:02 AM Local: 5:32 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 14, 22, 28, 0, false);         // UTC: 10:28 PM Local: 3:58 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 28, 22, 39, 0, false);         // UTC: 10:39 PM Local: 4:09 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 15, 11, 3, 0, false);          // UTC: 11:03 AM Local: 4:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 19, 14, 22, 0, false);         // UTC: 2:22 PM Local: 7:52 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 16, 0, 55, 0, false);          // UTC: 12:55 AM Local: 6:25 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 13, 3, 50, 0, false);          // UTC: 3:50 AM Local: 9:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 16, 8, 32, 0, false);          // UTC: 8:32 AM Local: 2:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 9, 11, 15, 0, false);          // UTC: 11:15 AM Local: 4:45 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 27, 19, 22, 0, false);         // UTC: 7:22 PM Local: 12:52 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 17, 10, 5, 0, false);          // UTC: 10:05 AM Local: 3:35 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 8, 2, 10, 0, false);           // UTC: 2:10 AM Local: 7:40 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 10, 8, 36, 0, false);          // UTC: 8:36 AM Local: 2:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 7, 9, 25, 0, false);           // UTC: 9:25 AM Local: 2:55 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 20, 20, 35, 0, false);         // UTC: 8:35 PM Local: 2:05 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 1, 30, 8, 14, 0, false);          // UTC: 8:14 AM Local: 1:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 22, 7, 56, 0, false);          // UTC: 7:56 AM Local: 1:26 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 1, 21, 41, 0, false);          // UTC: 9:41 PM Local: 3:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 11, 0, 26, 0, false);          // UTC: 12:26 AM Local: 5:56 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 29, 2, 40, 0, false);          // UTC: 2:40 AM Local: 8:10 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 12, 9, 2, 0, false);           // UTC: 9:02 AM Local: 2:32 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 7, 11, 17, 0, false);          // UTC: 11:17 AM Local: 4:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 17, 2, 2, 0, false);           // UTC: 2:02 AM Local: 7:32 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 9, 5, 57, 0, false);           // UTC: 5:57 AM Local: 11:27 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 15, 22, 46, 0, false);         // UTC: 10:46 PM Local: 4:16 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 23, 19, 25, 0, false);         // UTC: 7:25 PM Local: 12:55 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 26, 18, 29, 0, false);         // UTC: 6:29 PM Local: 11:59 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 25, 9, 27, 0, false);          // UTC: 9:27 AM Local: 2:57 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 2, 13, 48, 0, false);          // UTC: 1:48 PM Local: 7:18 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 9, 16, 17, 0, false);          // UTC: 4:17 PM Local: 9:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 29, 3, 29, 0, false);          // UTC: 3:29 AM Local: 8:59 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 11, 18, 52, 0, false);         // UTC: 6:52 PM Local: 12:22 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 5, 2, 27, 0, false);           // UTC: 2:27 AM Local: 7:57 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 29, 5, 26, 0, false);          // UTC: 5:26 AM Local: 10:56 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 1, 14, 6, 0, false);           // UTC: 2:06 PM Local: 7:36 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 8, 22, 22, 0, false);          // UTC: 10:22 PM Local: 3:52 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 29, 12, 3, 0, false);          // UTC: 12:03 PM Local: 5:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 1, 4, 34, 0, false);           // UTC: 4:34 AM Local: 10:04 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 13, 14, 19, 0, false);         // UTC: 2:19 PM Local: 7:49 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 2, 8, 41, 0, false);           // UTC: 8:41 AM Local: 2:11 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 2, 1, 4, 29, 0, false);           // UTC: 4:29 AM Local: 9:59 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 17, 13, 21, 0, false);         // UTC: 1:21 PM Local: 6:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 11, 11, 21, 0, false);         // UTC: 11:21 AM Local: 4:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 3, 0, 29, 0, false);           // UTC: 12:29 AM Local: 5:59 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 2, 4, 27, 0, false);           // UTC: 4:27 AM Local: 9:57 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 7, 14, 22, 0, false);          // UTC: 2:22 PM Local: 7:52 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 20, 15, 36, 0, false);         // UTC: 3:36 PM Local: 9:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 24, 12, 53, 0, false);         // UTC: 12:53 PM Local: 6:23 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 28, 9, 0, 0, false);           // UTC: 9:00 AM Local: 2:30 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 27, 21, 22, 0, false);         // UTC: 9:22 PM Local: 2:52 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 2, 17, 36, 0, false);          // UTC: 5:36 PM Local: 11:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 22, 20, 20, 0, false);         // UTC: 8:20 PM Local: 1:50 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 23, 20, 0, 0, false);          // UTC: 8:00 PM Local: 1:30 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 14, 12, 52, 0, false);         // UTC: 12:52 PM Local: 6:22 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 12, 2, 23, 0, false);          // UTC: 2:23 AM Local: 7:53 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 1, 3, 7, 0, false);            // UTC: 3:07 AM Local: 8:37 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 25, 12, 23, 0, false);         // UTC: 12:23 PM Local: 5:53 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 5, 19, 18, 0, false);          // UTC: 7:18 PM Local: 12:48 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 2, 0, 18, 0, false);           // UTC: 12:18 AM Local: 5:48 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 16, 6, 11, 0, false);          // UTC: 6:11 AM Local: 11:41 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 25, 22, 58, 0, false);         // UTC: 10:58 PM Local: 4:28 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 29, 2, 25, 0, false);          // UTC: 2:25 AM Local: 7:55 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 27, 5, 5, 0, false);           // UTC: 5:05 AM Local: 10:35 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 6, 20, 16, 0, false);          // UTC: 8:16 PM Local: 1:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 8, 19, 7, 0, false);           // UTC: 7:07 PM Local: 12:37 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 3, 25, 12, 42, 0, false);         // UTC: 12:42 PM Local: 6:12 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 12, 9, 46, 0, false);          // UTC: 9:46 AM Local: 3:16 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 14, 0, 42, 0, false);          // UTC: 12:42 AM Local: 6:12 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 17, 8, 25, 0, false);          // UTC: 8:25 AM Local: 1:55 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 18, 11, 28, 0, false);         // UTC: 11:28 AM Local: 4:58 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 8, 3, 12, 0, false);           // UTC: 3:12 AM Local: 8:42 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 10, 13, 55, 0, false);         // UTC: 1:55 PM Local: 7:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 29, 0, 6, 0, false);           // UTC: 12:06 AM Local: 5:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 29, 17, 34, 0, false);         // UTC: 5:34 PM Local: 11:04 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 24, 18, 3, 0, false);          // UTC: 6:03 PM Local: 11:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 6, 22, 46, 0, false);          // UTC: 10:46 PM Local: 4:16 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 4, 6, 17, 0, false);           // UTC: 6:17 AM Local: 11:47 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 27, 14, 8, 0, false);          // UTC: 2:08 PM Local: 7:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 11, 1, 18, 0, false);          // UTC: 1:18 AM Local: 6:48 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 20, 4, 50, 0, false);          // UTC: 4:50 AM Local: 10:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 13, 21, 55, 0, false);         // UTC: 9:55 PM Local: 3:25 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 29, 14, 24, 0, false);         // UTC: 2:24 PM Local: 7:54 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 27, 3, 48, 0, false);          // UTC: 3:48 AM Local: 9:18 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 21, 15, 27, 0, false);         // UTC: 3:27 PM Local: 8:57 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 25, 4, 31, 0, false);          // UTC: 4:31 AM Local: 10:01 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 18, 10, 40, 0, false);         // UTC: 10:40 AM Local: 4:10 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 3, 14, 26, 0, false);          // UTC: 2:26 PM Local: 7:56 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 16, 3, 59, 0, false);          // UTC: 3:59 AM Local: 9:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 6, 7, 17, 0, false);           // UTC: 7:17 AM Local: 12:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 11, 15, 59, 0, false);         // UTC: 3:59 PM Local: 9:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 4, 14, 21, 26, 0, false);         // UTC: 9:26 PM Local: 2:56 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 29, 2, 9, 0, false);           // UTC: 2:09 AM Local: 7:39 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 23, 2, 38, 0, false);          // UTC: 2:38 AM Local: 8:08 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 8, 11, 38, 0, false);          // UTC: 11:38 AM Local: 5:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 15, 13, 45, 0, false);         // UTC: 1:45 PM Local: 7:15 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 30, 0, 18, 0, false);          // UTC: 12:18 AM Local: 5:48 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 8, 10, 30, 0, false);          // UTC: 10:30 AM Local: 4:00 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 20, 7, 29, 0, false);          // UTC: 7:29 AM Local: 12:59 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 29, 17, 48, 0, false);         // UTC: 5:48 PM Local: 11:18 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 1, 19, 10, 0, false);          // UTC: 7:10 PM Local: 12:40 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 21, 12, 56, 0, false);         // UTC: 12:56 PM Local: 6:26 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 17, 21, 15, 0, false);         // UTC: 9:15 PM Local: 2:45 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 3, 10, 12, 0, false);          // UTC: 10:12 AM Local: 3:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 6, 19, 11, 0, false);          // UTC: 7:11 PM Local: 12:41 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 26, 4, 36, 0, false);          // UTC: 4:36 AM Local: 10:06 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 30, 11, 32, 0, false);         // UTC: 11:32 AM Local: 5:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 8, 12, 54, 0, false);          // UTC: 12:54 PM Local: 6:24 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 4, 19, 34, 0, false);          // UTC: 7:34 PM Local: 1:04 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 5, 13, 58, 0, false);          // UTC: 1:58 PM Local: 7:28 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 14, 12, 39, 0, false);         // UTC: 12:39 PM Local: 6:09 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 3, 14, 57, 0, false);          // UTC: 2:57 PM Local: 8:27 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 17, 8, 6, 0, false);           // UTC: 8:06 AM Local: 1:36 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 30, 5, 26, 0, false);          // UTC: 5:26 AM Local: 10:56 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 18, 12, 24, 0, false);         // UTC: 12:24 PM Local: 5:54 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 29, 4, 21, 0, false);          // UTC: 4:21 AM Local: 9:51 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 5, 8, 11, 54, 0, false);          // UTC: 11:54 AM Local: 5:24 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 15, 17, 40, 0, false);         // UTC: 5:40 PM Local: 11:10 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 16, 17, 10, 0, false);         // UTC: 5:10 PM Local: 10:40 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 27, 22, 17, 0, false);         // UTC: 10:17 PM Local: 3:47 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 16, 20, 41, 0, false);         // UTC: 8:41 PM Local: 2:11 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 26, 21, 43, 0, false);         // UTC: 9:43 PM Local: 3:13 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 28, 20, 11, 0, false);         // UTC: 8:11 PM Local: 1:41 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 21, 7, 19, 0, false);          // UTC: 7:19 AM Local: 12:49 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 16, 4, 0, 0, false);           // UTC: 4:00 AM Local: 9:30 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 24, 9, 36, 0, false);          // UTC: 9:36 AM Local: 3:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 29, 3, 57, 0, false);          // UTC: 3:57 AM Local: 9:27 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 27, 16, 13, 0, false);         // UTC: 4:13 PM Local: 9:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 26, 12, 17, 0, false);         // UTC: 12:17 PM Local: 5:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 6, 0, 24, 0, false);           // UTC: 12:24 AM Local: 5:54 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 17, 23, 8, 0, false);          // UTC: 11:08 PM Local: 4:38 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 14, 7, 49, 0, false);          // UTC: 7:49 AM Local: 1:19 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 27, 3, 18, 0, false);          // UTC: 3:18 AM Local: 8:48 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 8, 23, 36, 0, false);          // UTC: 11:36 PM Local: 5:06 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 15, 7, 50, 0, false);          // UTC: 7:50 AM Local: 1:20 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 16, 3, 11, 0, false);          // UTC: 3:11 AM Local: 8:41 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 21, 4, 4, 0, false);           // UTC: 4:04 AM Local: 9:34 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 3, 22, 4, 0, false);           // UTC: 10:04 PM Local: 3:34 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 9, 5, 9, 0, false);            // UTC: 5:09 AM Local: 10:39 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 29, 12, 34, 0, false);         // UTC: 12:34 PM Local: 6:04 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 26, 13, 0, 0, false);          // UTC: 1:00 PM Local: 6:30 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 6, 21, 16, 12, 0, false);         // UTC: 4:12 PM Local: 9:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 2, 15, 50, 0, false);          // UTC: 3:50 PM Local: 9:20 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 31, 12, 53, 0, false);         // UTC: 12:53 PM Local: 6:23 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 9, 12, 26, 0, false);          // UTC: 12:26 PM Local: 5:56 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 4, 2, 53, 0, false);           // UTC: 2:53 AM Local: 8:23 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 19, 12, 45, 0, false);         // UTC: 12:45 PM Local: 6:15 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 21, 20, 39, 0, false);         // UTC: 8:39 PM Local: 2:09 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 5, 11, 35, 0, false);          // UTC: 11:35 AM Local: 5:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 31, 7, 43, 0, false);          // UTC: 7:43 AM Local: 1:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 24, 4, 56, 0, false);          // UTC: 4:56 AM Local: 10:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 23, 7, 31, 0, false);          // UTC: 7:31 AM Local: 1:01 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 26, 3, 40, 0, false);          // UTC: 3:40 AM Local: 9:10 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 14, 1, 37, 0, false);          // UTC: 1:37 AM Local: 7:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 14, 20, 25, 0, false);         // UTC: 8:25 PM Local: 1:55 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 23, 19, 59, 0, false);         // UTC: 7:59 PM Local: 1:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 21, 7, 38, 0, false);          // UTC: 7:38 AM Local: 1:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 30, 5, 33, 0, false);          // UTC: 5:33 AM Local: 11:03 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 15, 17, 54, 0, false);         // UTC: 5:54 PM Local: 11:24 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 16, 9, 13, 0, false);          // UTC: 9:13 AM Local: 2:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 2, 20, 55, 0, false);          // UTC: 8:55 PM Local: 2:25 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 11, 12, 27, 0, false);         // UTC: 12:27 PM Local: 5:57 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 15, 0, 54, 0, false);          // UTC: 12:54 AM Local: 6:24 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 17, 13, 38, 0, false);         // UTC: 1:38 PM Local: 7:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 8, 9, 11, 0, false);           // UTC: 9:11 AM Local: 2:41 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 23, 6, 55, 0, false);          // UTC: 6:55 AM Local: 12:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 7, 24, 19, 1, 0, false);          // UTC: 7:01 PM Local: 12:31 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 27, 12, 32, 0, false);         // UTC: 12:32 PM Local: 6:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 10, 23, 37, 0, false);         // UTC: 11:37 PM Local: 5:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 14, 22, 52, 0, false);         // UTC: 10:52 PM Local: 4:22 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 15, 21, 59, 0, false);         // UTC: 9:59 PM Local: 3:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 23, 17, 57, 0, false);         // UTC: 5:57 PM Local: 11:27 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 21, 11, 35, 0, false);         // UTC: 11:35 AM Local: 5:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 31, 21, 36, 0, false);         // UTC: 9:36 PM Local: 3:06 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 11, 2, 52, 0, false);          // UTC: 2:52 AM Local: 8:22 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 30, 0, 47, 0, false);          // UTC: 12:47 AM Local: 6:17 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 27, 8, 31, 0, false);          // UTC: 8:31 AM Local: 2:01 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 19, 1, 30, 0, false);          // UTC: 1:30 AM Local: 7:00 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 1, 10, 36, 0, false);          // UTC: 10:36 AM Local: 4:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 7, 20, 27, 0, false);          // UTC: 8:27 PM Local: 1:57 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 30, 0, 59, 0, false);          // UTC: 12:59 AM Local: 6:29 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 1, 14, 55, 0, false);          // UTC: 2:55 PM Local: 8:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 27, 15, 20, 0, false);         // UTC: 3:20 PM Local: 8:50 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 12, 11, 31, 0, false);         // UTC: 11:31 AM Local: 5:01 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 10, 4, 51, 0, false);          // UTC: 4:51 AM Local: 10:21 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 16, 13, 40, 0, false);         // UTC: 1:40 PM Local: 7:10 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 2, 4, 5, 0, false);            // UTC: 4:05 AM Local: 9:35 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 3, 16, 38, 0, false);          // UTC: 4:38 PM Local: 10:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 5, 10, 59, 0, false);          // UTC: 10:59 AM Local: 4:29 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 11, 6, 43, 0, false);          // UTC: 6:43 AM Local: 12:13 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 27, 21, 37, 0, false);         // UTC: 9:37 PM Local: 3:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 8, 30, 17, 10, 0, false);         // UTC: 5:10 PM Local: 10:40 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 16, 8, 48, 0, false);          // UTC: 8:48 AM Local: 2:18 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 9, 9, 42, 0, false);           // UTC: 9:42 AM Local: 3:12 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 28, 1, 55, 0, false);          // UTC: 1:55 AM Local: 7:25 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 22, 12, 23, 0, false);         // UTC: 12:23 PM Local: 5:53 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 5, 18, 46, 0, false);          // UTC: 6:46 PM Local: 12:16 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 11, 10, 32, 0, false);         // UTC: 10:32 AM Local: 4:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 27, 2, 2, 0, false);           // UTC: 2:02 AM Local: 7:32 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 1, 8, 55, 0, false);           // UTC: 8:55 AM Local: 2:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 7, 20, 28, 0, false);          // UTC: 8:28 PM Local: 1:58 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 26, 16, 48, 0, false);         // UTC: 4:48 PM Local: 10:18 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 29, 0, 35, 0, false);          // UTC: 12:35 AM Local: 6:05 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 16, 3, 16, 0, false);          // UTC: 3:16 AM Local: 8:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 8, 5, 6, 0, false);            // UTC: 5:06 AM Local: 10:36 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 14, 10, 12, 0, false);         // UTC: 10:12 AM Local: 3:42 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 23, 9, 38, 0, false);          // UTC: 9:38 AM Local: 3:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 9, 3, 50, 0, false);           // UTC: 3:50 AM Local: 9:20 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 28, 23, 55, 0, false);         // UTC: 11:55 PM Local: 5:25 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 9, 10, 7, 0, false);           // UTC: 10:07 AM Local: 3:37 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 15, 15, 8, 0, false);          // UTC: 3:08 PM Local: 8:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 7, 2, 8, 0, false);            // UTC: 2:08 AM Local: 7:38 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 23, 20, 29, 0, false);         // UTC: 8:29 PM Local: 1:59 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 15, 23, 9, 0, false);          // UTC: 11:09 PM Local: 4:39 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 6, 0, 8, 0, false);            // UTC: 12:08 AM Local: 5:38 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 17, 16, 20, 0, false);         // UTC: 4:20 PM Local: 9:50 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 9, 26, 15, 42, 0, false);         // UTC: 3:42 PM Local: 9:12 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 7, 8, 27, 0, false);          // UTC: 8:27 AM Local: 1:57 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 28, 18, 37, 0, false);        // UTC: 6:37 PM Local: 12:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 1, 0, 24, 0, false);          // UTC: 12:24 AM Local: 5:54 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 30, 17, 16, 0, false);        // UTC: 5:16 PM Local: 10:46 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 3, 5, 31, 0, false);          // UTC: 5:31 AM Local: 11:01 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 5, 1, 34, 0, false);          // UTC: 1:34 AM Local: 7:04 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 3, 22, 9, 0, false);          // UTC: 10:09 PM Local: 3:39 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 14, 18, 24, 0, false);        // UTC: 6:24 PM Local: 11:54 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 4, 16, 34, 0, false);         // UTC: 4:34 PM Local: 10:04 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 21, 17, 31, 0, false);        // UTC: 5:31 PM Local: 11:01 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 16, 8, 14, 0, false);         // UTC: 8:14 AM Local: 1:44 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 6, 5, 35, 0, false);          // UTC: 5:35 AM Local: 11:05 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 11, 4, 32, 0, false);         // UTC: 4:32 AM Local: 10:02 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 23, 11, 15, 0, false);        // UTC: 11:15 AM Local: 4:45 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 28, 5, 14, 0, false);         // UTC: 5:14 AM Local: 10:44 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 28, 6, 41, 0, false);         // UTC: 6:41 AM Local: 12:11 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 6, 17, 41, 0, false);         // UTC: 5:41 PM Local: 11:11 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 12, 1, 32, 0, false);         // UTC: 1:32 AM Local: 7:02 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 24, 1, 48, 0, false);         // UTC: 1:48 AM Local: 7:18 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 22, 16, 32, 0, false);        // UTC: 4:32 PM Local: 10:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 17, 10, 35, 0, false);        // UTC: 10:35 AM Local: 4:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 13, 21, 22, 0, false);        // UTC: 9:22 PM Local: 2:52 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 25, 3, 1, 0, false);          // UTC: 3:01 AM Local: 8:31 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 6, 3, 13, 0, false);          // UTC: 3:13 AM Local: 8:43 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 10, 25, 21, 49, 0, false);        // UTC: 9:49 PM Local: 3:19 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 25, 14, 36, 0, false);        // UTC: 2:36 PM Local: 8:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 6, 13, 34, 0, false);         // UTC: 1:34 PM Local: 7:04 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 7, 10, 20, 0, false);         // UTC: 10:20 AM Local: 3:50 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 15, 14, 7, 0, false);         // UTC: 2:07 PM Local: 7:37 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 23, 9, 27, 0, false);         // UTC: 9:27 AM Local: 2:57 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 12, 1, 35, 0, false);         // UTC: 1:35 AM Local: 7:05 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 20, 20, 2, 0, false);         // UTC: 8:02 PM Local: 1:32 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 23, 21, 46, 0, false);        // UTC: 9:46 PM Local: 3:16 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 16, 21, 42, 0, false);        // UTC: 9:42 PM Local: 3:12 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 8, 6, 55, 0, false);          // UTC: 6:55 AM Local: 12:25 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 7, 4, 24, 0, false);          // UTC: 4:24 AM Local: 9:54 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 13, 3, 44, 0, false);         // UTC: 3:44 AM Local: 9:14 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 13, 5, 32, 0, false);         // UTC: 5:32 AM Local: 11:02 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 9, 18, 13, 0, false);         // UTC: 6:13 PM Local: 11:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 28, 19, 13, 0, false);        // UTC: 7:13 PM Local: 12:43 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 9, 13, 6, 0, false);          // UTC: 1:06 PM Local: 6:36 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 6, 6, 1, 0, false);           // UTC: 6:01 AM Local: 11:31 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 8, 23, 12, 0, false);         // UTC: 11:12 PM Local: 4:42 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 27, 22, 26, 0, false);        // UTC: 10:26 PM Local: 3:56 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 30, 7, 3, 0, false);          // UTC: 7:03 AM Local: 12:33 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 20, 11, 10, 0, false);        // UTC: 11:10 AM Local: 4:40 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 6, 23, 16, 0, false);         // UTC: 11:16 PM Local: 4:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 13, 5, 0, 0, false);          // UTC: 5:00 AM Local: 10:30 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 11, 9, 8, 0, false);          // UTC: 9:08 AM Local: 2:38 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 11, 30, 6, 16, 0, false);         // UTC: 6:16 AM Local: 11:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 2, 8, 49, 0, false);          // UTC: 8:49 AM Local: 2:19 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 30, 20, 37, 0, false);        // UTC: 8:37 PM Local: 2:07 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 18, 23, 29, 0, false);        // UTC: 11:29 PM Local: 4:59 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 19, 16, 35, 0, false);        // UTC: 4:35 PM Local: 10:05 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 28, 19, 18, 0, false);        // UTC: 7:18 PM Local: 12:48 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 27, 17, 38, 0, false);        // UTC: 5:38 PM Local: 11:08 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 21, 12, 21, 0, false);        // UTC: 12:21 PM Local: 5:51 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 7, 6, 21, 0, false);          // UTC: 6:21 AM Local: 11:51 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 27, 16, 32, 0, false);        // UTC: 4:32 PM Local: 10:02 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 2, 5, 17, 0, false);          // UTC: 5:17 AM Local: 10:47 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 28, 11, 13, 0, false);        // UTC: 11:13 AM Local: 4:43 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 7, 9, 29, 0, false);          // UTC: 9:29 AM Local: 2:59 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 13, 18, 56, 0, false);        // UTC: 6:56 PM Local: 12:26 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 12, 15, 36, 0, false);        // UTC: 3:36 PM Local: 9:06 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 31, 4, 17, 0, false);         // UTC: 4:17 AM Local: 9:47 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 16, 9, 2, 0, false);          // UTC: 9:02 AM Local: 2:32 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 2, 13, 18, 0, false);         // UTC: 1:18 PM Local: 6:48 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 15, 23, 16, 0, false);        // UTC: 11:16 PM Local: 4:46 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 29, 22, 47, 0, false);        // UTC: 10:47 PM Local: 4:17 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 13, 22, 2, 0, false);         // UTC: 10:02 PM Local: 3:32 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 28, 14, 17, 0, false);        // UTC: 2:17 PM Local: 7:47 PM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 29, 5, 0, 0, false);          // UTC: 5:00 AM Local: 10:30 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 4, 0, 8, 0, false);           // UTC: 12:08 AM Local: 5:38 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 29, 0, 21, 0, false);         // UTC: 12:21 AM Local: 5:51 AM Offset: 05:30:00
+	testCount++; failedCount += test(timeManager, 15, 2020, 12, 8, 11, 36, 0, false);         // UTC: 11:36 AM Local: 5:06 PM Offset: 05:30:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_16_H
+#define TEST_TIMEZONEID_16_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_16_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 12, 15, 30, 0, false);         // UTC: 3:30 PM Local: 11:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 10, 13, 14, 0, false);         // UTC: 1:14 PM Local: 9:14 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 15, 0, 26, 0, false);          // UTC: 12:26 AM Local: 8:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 28, 21, 45, 0, false);         // UTC: 9:45 PM Local: 5:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 9, 7, 40, 0, false);           // UTC: 7:40 AM Local: 3:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 8, 0, 18, 0, false);           // UTC: 12:18 AM Local: 8:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 10, 10, 42, 0, false);         // UTC: 10:42 AM Local: 6:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 5, 23, 38, 0, false);          // UTC: 11:38 PM Local: 7:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 10, 0, 50, 0, false);          // UTC: 12:50 AM Local: 8:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 8, 19, 16, 0, false);          // UTC: 7:16 PM Local: 3:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 1, 4, 51, 0, false);           // UTC: 4:51 AM Local: 12:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 20, 21, 40, 0, false);         // UTC: 9:40 PM Local: 5:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 1, 14, 29, 0, false);          // UTC: 2:29 PM Local: 10:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 20, 20, 45, 0, false);         // UTC: 8:45 PM Local: 4:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 10, 7, 50, 0, false);          // UTC: 7:50 AM Local: 3:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 10, 11, 16, 0, false);         // UTC: 11:16 AM Local: 7:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 14, 2, 22, 0, false);          // UTC: 2:22 AM Local: 10:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 16, 13, 33, 0, false);         // UTC: 1:33 PM Local: 9:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 21, 5, 36, 0, false);          // UTC: 5:36 AM Local: 1:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 10, 18, 2, 0, false);          // UTC: 6:02 PM Local: 2:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 10, 2, 53, 0, false);          // UTC: 2:53 AM Local: 10:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 26, 0, 33, 0, false);          // UTC: 12:33 AM Local: 8:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 12, 7, 31, 0, false);          // UTC: 7:31 AM Local: 3:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 5, 9, 19, 0, false);           // UTC: 9:19 AM Local: 5:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 1, 11, 14, 29, 0, false);         // UTC: 2:29 PM Local: 10:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 3, 5, 44, 0, false);           // UTC: 5:44 AM Local: 1:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 16, 23, 54, 0, false);         // UTC: 11:54 PM Local: 7:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 1, 14, 53, 0, false);          // UTC: 2:53 PM Local: 10:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 28, 15, 0, 0, false);          // UTC: 3:00 PM Local: 11:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 27, 15, 44, 0, false);         // UTC: 3:44 PM Local: 11:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 26, 3, 29, 0, false);          // UTC: 3:29 AM Local: 11:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 27, 19, 5, 0, false);          // UTC: 7:05 PM Local: 3:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 16, 20, 1, 0, false);          // UTC: 8:01 PM Local: 4:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 5, 22, 14, 0, false);          // UTC: 10:14 PM Local: 6:14 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 13, 11, 2, 0, false);          // UTC: 11:02 AM Local: 7:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 18, 1, 42, 0, false);          // UTC: 1:42 AM Local: 9:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 21, 12, 38, 0, false);         // UTC: 12:38 PM Local: 8:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 11, 15, 32, 0, false);         // UTC: 3:32 PM Local: 11:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 22, 21, 41, 0, false);         // UTC: 9:41 PM Local: 5:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 27, 2, 14, 0, false);          // UTC: 2:14 AM Local: 10:14 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 11, 3, 45, 0, false);          // UTC: 3:45 AM Local: 11:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 3, 17, 7, 0, false);           // UTC: 5:07 PM Local: 1:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 8, 0, 25, 0, false);           // UTC: 12:25 AM Local: 8:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 21, 1, 58, 0, false);          // UTC: 1:58 AM Local: 9:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 27, 3, 47, 0, false);          // UTC: 3:47 AM Local: 11:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 22, 1, 54, 0, false);          // UTC: 1:54 AM Local: 9:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 25, 12, 9, 0, false);          // UTC: 12:09 PM Local: 8:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 21, 22, 16, 0, false);         // UTC: 10:16 PM Local: 6:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 8, 5, 37, 0, false);           // UTC: 5:37 AM Local: 1:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 2, 1, 7, 33, 0, false);           // UTC: 7:33 AM Local: 3:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 8, 3, 6, 0, false);            // UTC: 3:06 AM Local: 11:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 21, 4, 17, 0, false);          // UTC: 4:17 AM Local: 12:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 13, 13, 2, 0, false);          // UTC: 1:02 PM Local: 9:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 13, 14, 56, 0, false);         // UTC: 2:56 PM Local: 10:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 24, 14, 29, 0, false);         // UTC: 2:29 PM Local: 10:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 9, 1, 3, 0, false);            // UTC: 1:03 AM Local: 9:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 1, 22, 12, 0, false);          // UTC: 10:12 PM Local: 6:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 14, 21, 16, 0, false);         // UTC: 9:16 PM Local: 5:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 30, 16, 24, 0, false);         // UTC: 4:24 PM Local: 12:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 4, 6, 7, 0, false);            // UTC: 6:07 AM Local: 2:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 14, 20, 6, 0, false);          // UTC: 8:06 PM Local: 4:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 10, 3, 29, 0, false);          // UTC: 3:29 AM Local: 11:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 14, 4, 53, 0, false);          // UTC: 4:53 AM Local: 12:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 13, 7, 8, 0, false);           // UTC: 7:08 AM Local: 3:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 29, 4, 56, 0, false);          // UTC: 4:56 AM Local: 12:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 13, 13, 32, 0, false);         // UTC: 1:32 PM Local: 9:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 8, 12, 11, 0, false);          // UTC: 12:11 PM Local: 8:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 12, 21, 31, 0, false);         // UTC: 9:31 PM Local: 5:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 27, 5, 55, 0, false);          // UTC: 5:55 AM Local: 1:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 14, 6, 42, 0, false);          // UTC: 6:42 AM Local: 2:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 14, 0, 31, 0, false);          // UTC: 12:31 AM Local: 8:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 10, 18, 18, 0, false);         // UTC: 6:18 PM Local: 2:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 4, 2, 48, 0, false);           // UTC: 2:48 AM Local: 10:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 26, 9, 47, 0, false);          // UTC: 9:47 AM Local: 5:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 3, 16, 7, 34, 0, false);          // UTC: 7:34 AM Local: 3:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 21, 15, 13, 0, false);         // UTC: 3:13 PM Local: 11:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 19, 14, 32, 0, false);         // UTC: 2:32 PM Local: 10:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 5, 15, 35, 0, false);          // UTC: 3:35 PM Local: 11:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 3, 20, 42, 0, false);          // UTC: 8:42 PM Local: 4:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 4, 23, 42, 0, false);          // UTC: 11:42 PM Local: 7:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 11, 1, 29, 0, false);          // UTC: 1:29 AM Local: 9:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 3, 15, 46, 0, false);          // UTC: 3:46 PM Local: 11:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 25, 1, 32, 0, false);          // UTC: 1:32 AM Local: 9:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 11, 17, 10, 0, false);         // UTC: 5:10 PM Local: 1:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 4, 22, 23, 0, false);          // UTC: 10:23 PM Local: 6:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 13, 9, 25, 0, false);          // UTC: 9:25 AM Local: 5:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 3, 7, 12, 0, false);           // UTC: 7:12 AM Local: 3:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 15, 6, 45, 0, false);          // UTC: 6:45 AM Local: 2:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 1, 20, 0, 0, false);           // UTC: 8:00 PM Local: 4:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 8, 10, 25, 0, false);          // UTC: 10:25 AM Local: 6:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 20, 19, 13, 0, false);         // UTC: 7:13 PM Local: 3:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 2, 8, 57, 0, false);           // UTC: 8:57 AM Local: 4:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 21, 0, 24, 0, false);          // UTC: 12:24 AM Local: 8:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 21, 1, 9, 0, false);           // UTC: 1:09 AM Local: 9:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 22, 17, 44, 0, false);         // UTC: 5:44 PM Local: 1:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 8, 6, 32, 0, false);           // UTC: 6:32 AM Local: 2:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 26, 20, 54, 0, false);         // UTC: 8:54 PM Local: 4:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 18, 21, 52, 0, false);         // UTC: 9:52 PM Local: 5:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 21, 23, 47, 0, false);         // UTC: 11:47 PM Local: 7:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 4, 30, 8, 32, 0, false);          // UTC: 8:32 AM Local: 4:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 1, 19, 39, 0, false);          // UTC: 7:39 PM Local: 3:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 26, 16, 13, 0, false);         // UTC: 4:13 PM Local: 12:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 16, 18, 30, 0, false);         // UTC: 6:30 PM Local: 2:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 12, 4, 45, 0, false);          // UTC: 4:45 AM Local: 12:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 15, 23, 45, 0, false);         // UTC: 11:45 PM Local: 7:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 30, 5, 6, 0, false);           // UTC: 5:06 AM Local: 1:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 7, 0, 5, 0, false);            // UTC: 12:05 AM Local: 8:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 30, 11, 46, 0, false);         // UTC: 11:46 AM Local: 7:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 10, 20, 52, 0, false);         // UTC: 8:52 PM Local: 4:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 21, 3, 9, 0, false);           // UTC: 3:09 AM Local: 11:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 2, 5, 59, 0, false);           // UTC: 5:59 AM Local: 1:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 20, 22, 48, 0, false);         // UTC: 10:48 PM Local: 6:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 23, 3, 46, 0, false);          // UTC: 3:46 AM Local: 11:46 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 31, 7, 22, 0, false);          // UTC: 7:22 AM Local: 3:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 7, 18, 27, 0, false);          // UTC: 6:27 PM Local: 2:27 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 3, 5, 59, 0, false);           // UTC: 5:59 AM Local: 1:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 3, 14, 5, 0, false);           // UTC: 2:05 PM Local: 10:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 29, 1, 36, 0, false);          // UTC: 1:36 AM Local: 9:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 5, 4, 43, 0, false);           // UTC: 4:43 AM Local: 12:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 24, 5, 49, 0, false);          // UTC: 5:49 AM Local: 1:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 7, 13, 2, 0, false);           // UTC: 1:02 PM Local: 9:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 25, 11, 7, 0, false);          // UTC: 11:07 AM Local: 7:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 22, 12, 26, 0, false);         // UTC: 12:26 PM Local: 8:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 9, 3, 39, 0, false);           // UTC: 3:39 AM Local: 11:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 5, 13, 19, 12, 0, false);         // UTC: 7:12 PM Local: 3:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 12, 23, 28, 0, false);         // UTC: 11:28 PM Local: 7:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 12, 13, 1, 0, false);          // UTC: 1:01 PM Local: 9:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 12, 6, 52, 0, false);          // UTC: 6:52 AM Local: 2:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 3, 6, 24, 0, false);           // UTC: 6:24 AM Local: 2:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 14, 1, 37, 0, false);          // UTC: 1:37 AM Local: 9:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 7, 13, 49, 0, false);          // UTC: 1:49 PM Local: 9:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 24, 21, 35, 0, false);         // UTC: 9:35 PM Local: 5:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 11, 1, 33, 0, false);          // UTC: 1:33 AM Local: 9:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 13, 11, 1, 0, false);          // UTC: 11:01 AM Local: 7:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 21, 4, 26, 0, false);          // UTC: 4:26 AM Local: 12:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 8, 10, 10, 0, false);          // UTC: 10:10 AM Local: 6:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 13, 1, 24, 0, false);          // UTC: 1:24 AM Local: 9:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 2, 12, 40, 0, false);          // UTC: 12:40 PM Local: 8:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 28, 23, 28, 0, false);         // UTC: 11:28 PM Local: 7:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 21, 1, 9, 0, false);           // UTC: 1:09 AM Local: 9:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 29, 0, 10, 0, false);          // UTC: 12:10 AM Local: 8:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 24, 6, 42, 0, false);          // UTC: 6:42 AM Local: 2:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 19, 9, 39, 0, false);          // UTC: 9:39 AM Local: 5:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 22, 18, 26, 0, false);         // UTC: 6:26 PM Local: 2:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 27, 0, 3, 0, false);           // UTC: 12:03 AM Local: 8:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 4, 16, 52, 0, false);          // UTC: 4:52 PM Local: 12:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 18, 0, 8, 0, false);           // UTC: 12:08 AM Local: 8:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 11, 19, 39, 0, false);         // UTC: 7:39 PM Local: 3:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 3, 18, 34, 0, false);          // UTC: 6:34 PM Local: 2:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 6, 10, 14, 9, 0, false);          // UTC: 2:09 PM Local: 10:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 20, 13, 18, 0, false);         // UTC: 1:18 PM Local: 9:18 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 19, 19, 51, 0, false);         // UTC: 7:51 PM Local: 3:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 14, 17, 5, 0, false);          // UTC: 5:05 PM Local: 1:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 29, 22, 49, 0, false);         // UTC: 10:49 PM Local: 6:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 30, 4, 39, 0, false);          // UTC: 4:39 AM Local: 12:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 2, 9, 16, 0, false);           // UTC: 9:16 AM Local: 5:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 10, 20, 44, 0, false);         // UTC: 8:44 PM Local: 4:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 15, 23, 20, 0, false);         // UTC: 11:20 PM Local: 7:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 3, 20, 16, 0, false);          // UTC: 8:16 PM Local: 4:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 13, 9, 55, 0, false);          // UTC: 9:55 AM Local: 5:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 21, 18, 50, 0, false);         // UTC: 6:50 PM Local: 2:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 16, 0, 7, 0, false);           // UTC: 12:07 AM Local: 8:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 4, 10, 56, 0, false);          // UTC: 10:56 AM Local: 6:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 13, 8, 55, 0, false);          // UTC: 8:55 AM Local: 4:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 15, 9, 53, 0, false);          // UTC: 9:53 AM Local: 5:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 26, 6, 17, 0, false);          // UTC: 6:17 AM Local: 2:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 31, 0, 30, 0, false);          // UTC: 12:30 AM Local: 8:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 23, 0, 46, 0, false);          // UTC: 12:46 AM Local: 8:46 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 7, 2, 51, 0, false);           // UTC: 2:51 AM Local: 10:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 14, 4, 37, 0, false);          // UTC: 4:37 AM Local: 12:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 8, 10, 26, 0, false);          // UTC: 10:26 AM Local: 6:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 19, 3, 47, 0, false);          // UTC: 3:47 AM Local: 11:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 27, 8, 56, 0, false);          // UTC: 8:56 AM Local: 4:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 27, 0, 20, 0, false);          // UTC: 12:20 AM Local: 8:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 7, 6, 11, 26, 0, false);          // UTC: 11:26 AM Local: 7:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 19, 9, 23, 0, false);          // UTC: 9:23 AM Local: 5:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 25, 6, 10, 0, false);          // UTC: 6:10 AM Local: 2:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 21, 6, 51, 0, false);          // UTC: 6:51 AM Local: 2:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 24, 16, 2, 0, false);          // UTC: 4:02 PM Local: 12:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 18, 2, 17, 0, false);          // UTC: 2:17 AM Local: 10:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 1, 22, 1, 0, false);           // UTC: 10:01 PM Local: 6:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 18, 3, 54, 0, false);          // UTC: 3:54 AM Local: 11:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 24, 8, 12, 0, false);          // UTC: 8:12 AM Local: 4:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 4, 3, 31, 0, false);           // UTC: 3:31 AM Local: 11:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 16, 11, 1, 0, false);          // UTC: 11:01 AM Local: 7:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 1, 2, 45, 0, false);           // UTC: 2:45 AM Local: 10:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 9, 21, 26, 0, false);          // UTC: 9:26 PM Local: 5:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 28, 3, 21, 0, false);          // UTC: 3:21 AM Local: 11:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 14, 19, 30, 0, false);         // UTC: 7:30 PM Local: 3:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 13, 7, 38, 0, false);          // UTC: 7:38 AM Local: 3:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 7, 9, 10, 0, false);           // UTC: 9:10 AM Local: 5:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 8, 21, 11, 0, false);          // UTC: 9:11 PM Local: 5:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 6, 12, 47, 0, false);          // UTC: 12:47 PM Local: 8:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 31, 11, 4, 0, false);          // UTC: 11:04 AM Local: 7:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 5, 0, 41, 0, false);           // UTC: 12:41 AM Local: 8:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 7, 4, 59, 0, false);           // UTC: 4:59 AM Local: 12:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 25, 20, 26, 0, false);         // UTC: 8:26 PM Local: 4:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 3, 22, 16, 0, false);          // UTC: 10:16 PM Local: 6:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 31, 9, 56, 0, false);          // UTC: 9:56 AM Local: 5:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 8, 14, 10, 44, 0, false);         // UTC: 10:44 AM Local: 6:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 26, 10, 50, 0, false);         // UTC: 10:50 AM Local: 6:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 13, 6, 21, 0, false);          // UTC: 6:21 AM Local: 2:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 8, 14, 1, 0, false);           // UTC: 2:01 PM Local: 10:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 18, 0, 22, 0, false);          // UTC: 12:22 AM Local: 8:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 1, 14, 34, 0, false);          // UTC: 2:34 PM Local: 10:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 14, 16, 26, 0, false);         // UTC: 4:26 PM Local: 12:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 30, 18, 5, 0, false);          // UTC: 6:05 PM Local: 2:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 17, 4, 44, 0, false);          // UTC: 4:44 AM Local: 12:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 8, 17, 15, 0, false);          // UTC: 5:15 PM Local: 1:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 1, 5, 2, 0, false);            // UTC: 5:02 AM Local: 1:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 6, 8, 14, 0, false);           // UTC: 8:14 AM Local: 4:14 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 12, 15, 2, 0, false);          // UTC: 3:02 PM Local: 11:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 16, 4, 53, 0, false);          // UTC: 4:53 AM Local: 12:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 27, 7, 20, 0, false);          // UTC: 7:20 AM Local: 3:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 16, 13, 40, 0, false);         // UTC: 1:40 PM Local: 9:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 12, 23, 21, 0, false);         // UTC: 11:21 PM Local: 7:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 8, 9, 26, 0, false);           // UTC: 9:26 AM Local: 5:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 21, 0, 59, 0, false);          // UTC: 12:59 AM Local: 8:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 14, 0, 52, 0, false);          // UTC: 12:52 AM Local: 8:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 7, 20, 41, 0, false);          // UTC: 8:41 PM Local: 4:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 14, 20, 9, 0, false);          // UTC: 8:09 PM Local: 4:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 1, 6, 56, 0, false);           // UTC: 6:56 AM Local: 2:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 28, 19, 58, 0, false);         // UTC: 7:58 PM Local: 3:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 20, 21, 8, 0, false);          // UTC: 9:08 PM Local: 5:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 9, 1, 18, 6, 0, false);           // UTC: 6:06 PM Local: 2:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 29, 16, 12, 0, false);        // UTC: 4:12 PM Local: 12:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 20, 7, 59, 0, false);         // UTC: 7:59 AM Local: 3:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 13, 8, 0, 0, false);          // UTC: 8:00 AM Local: 4:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 15, 1, 58, 0, false);         // UTC: 1:58 AM Local: 9:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 11, 23, 19, 0, false);        // UTC: 11:19 PM Local: 7:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 11, 22, 21, 0, false);        // UTC: 10:21 PM Local: 6:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 25, 7, 15, 0, false);         // UTC: 7:15 AM Local: 3:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 2, 16, 18, 0, false);         // UTC: 4:18 PM Local: 12:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 5, 22, 16, 0, false);         // UTC: 10:16 PM Local: 6:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 11, 11, 7, 0, false);         // UTC: 11:07 AM Local: 7:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 8, 2, 31, 0, false);          // UTC: 2:31 AM Local: 10:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 2, 9, 40, 0, false);          // UTC: 9:40 AM Local: 5:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 8, 8, 25, 0, false);          // UTC: 8:25 AM Local: 4:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 17, 4, 46, 0, false);         // UTC: 4:46 AM Local: 12:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 10, 16, 3, 0, false);         // UTC: 4:03 PM Local: 12:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 27, 11, 24, 0, false);        // UTC: 11:24 AM Local: 7:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 1, 6, 22, 0, false);          // UTC: 6:22 AM Local: 2:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 3, 21, 20, 0, false);         // UTC: 9:20 PM Local: 5:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 11, 11, 27, 0, false);        // UTC: 11:27 AM Local: 7:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 17, 9, 15, 0, false);         // UTC: 9:15 AM Local: 5:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 20, 3, 56, 0, false);         // UTC: 3:56 AM Local: 11:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 7, 19, 46, 0, false);         // UTC: 7:46 PM Local: 3:46 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 29, 19, 41, 0, false);        // UTC: 7:41 PM Local: 3:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 29, 2, 37, 0, false);         // UTC: 2:37 AM Local: 10:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 10, 5, 13, 35, 0, false);         // UTC: 1:35 PM Local: 9:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 6, 23, 57, 0, false);         // UTC: 11:57 PM Local: 7:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 18, 19, 57, 0, false);        // UTC: 7:57 PM Local: 3:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 5, 6, 38, 0, false);          // UTC: 6:38 AM Local: 2:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 6, 6, 44, 0, false);          // UTC: 6:44 AM Local: 2:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 24, 19, 29, 0, false);        // UTC: 7:29 PM Local: 3:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 17, 7, 13, 0, false);         // UTC: 7:13 AM Local: 3:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 5, 13, 39, 0, false);         // UTC: 1:39 PM Local: 9:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 10, 1, 6, 0, false);          // UTC: 1:06 AM Local: 9:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 8, 22, 50, 0, false);         // UTC: 10:50 PM Local: 6:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 21, 11, 53, 0, false);        // UTC: 11:53 AM Local: 7:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 27, 17, 51, 0, false);        // UTC: 5:51 PM Local: 1:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 10, 7, 40, 0, false);         // UTC: 7:40 AM Local: 3:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 30, 21, 3, 0, false);         // UTC: 9:03 PM Local: 5:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 19, 3, 0, 0, false);          // UTC: 3:00 AM Local: 11:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 3, 21, 42, 0, false);         // UTC: 9:42 PM Local: 5:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 4, 5, 57, 0, false);          // UTC: 5:57 AM Local: 1:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 5, 1, 24, 0, false);          // UTC: 1:24 AM Local: 9:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 14, 11, 19, 0, false);        // UTC: 11:19 AM Local: 7:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 8, 17, 10, 0, false);         // UTC: 5:10 PM Local: 1:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 6, 10, 44, 0, false);         // UTC: 10:44 AM Local: 6:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 12, 20, 39, 0, false);        // UTC: 8:39 PM Local: 4:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 13, 23, 37, 0, false);        // UTC: 11:37 PM Local: 7:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 14, 17, 55, 0, false);        // UTC: 5:55 PM Local: 1:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 8, 17, 19, 0, false);         // UTC: 5:19 PM Local: 1:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 11, 14, 22, 9, 0, false);         // UTC: 10:09 PM Local: 6:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 12, 22, 6, 0, false);         // UTC: 10:06 PM Local: 6:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 31, 13, 24, 0, false);        // UTC: 1:24 PM Local: 9:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 16, 11, 9, 0, false);         // UTC: 11:09 AM Local: 7:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 13, 7, 27, 0, false);         // UTC: 7:27 AM Local: 3:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 30, 18, 51, 0, false);        // UTC: 6:51 PM Local: 2:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 27, 13, 36, 0, false);        // UTC: 1:36 PM Local: 9:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 25, 20, 11, 0, false);        // UTC: 8:11 PM Local: 4:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 7, 13, 35, 0, false);         // UTC: 1:35 PM Local: 9:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 31, 2, 48, 0, false);         // UTC: 2:48 AM Local: 10:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 20, 12, 34, 0, false);        // UTC: 12:34 PM Local: 8:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 14, 3, 0, 0, false);          // UTC: 3:00 AM Local: 11:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 17, 19, 15, 0, false);        // UTC: 7:15 PM Local: 3:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 15, 21, 20, 0, false);        // UTC: 9:20 PM Local: 5:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 12, 14, 4, 0, false);         // UTC: 2:04 PM Local: 10:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 31, 19, 49, 0, false);        // UTC: 7:49 PM Local: 3:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 18, 22, 58, 0, false);        // UTC: 10:58 PM Local: 6:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 6, 9, 5, 0, false);           // UTC: 9:05 AM Local: 5:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 4, 19, 23, 0, false);         // UTC: 7:23 PM Local: 3:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 25, 10, 39, 0, false);        // UTC: 10:39 AM Local: 6:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 27, 16, 56, 0, false);        // UTC: 4:56 PM Local: 12:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 9, 19, 3, 0, false);          // UTC: 7:03 PM Local: 3:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 25, 6, 27, 0, false);         // UTC: 6:27 AM Local: 2:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 4, 8, 27, 0, false);          // UTC: 8:27 AM Local: 4:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 8, 21, 34, 0, false);         // UTC: 9:34 PM Local: 5:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2018, 12, 11, 2, 53, 0, false);         // UTC: 2:53 AM Local: 10:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 14, 14, 59, 0, false);         // UTC: 2:59 PM Local: 10:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 8, 16, 23, 0, false);          // UTC: 4:23 PM Local: 12:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 28, 8, 23, 0, false);          // UTC: 8:23 AM Local: 4:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 17, 10, 28, 0, false);         // UTC: 10:28 AM Local: 6:28 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 17, 2, 15, 0, false);          // UTC: 2:15 AM Local: 10:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 26, 10, 46, 0, false);         // UTC: 10:46 AM Local: 6:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 1, 7, 5, 0, false);            // UTC: 7:05 AM Local: 3:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 20, 21, 28, 0, false);         // UTC: 9:28 PM Local: 5:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 10, 16, 22, 0, false);         // UTC: 4:22 PM Local: 12:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 6, 21, 58, 0, false);          // UTC: 9:58 PM Local: 5:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 12, 21, 39, 0, false);         // UTC: 9:39 PM Local: 5:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 21, 2, 48, 0, false);          // UTC: 2:48 AM Local: 10:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 13, 10, 40, 0, false);         // UTC: 10:40 AM Local: 6:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 20, 15, 8, 0, false);          // UTC: 3:08 PM Local: 11:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 5, 21, 6, 0, false);           // UTC: 9:06 PM Local: 5:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 12, 21, 33, 0, false);         // UTC: 9:33 PM Local: 5:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 13, 9, 39, 0, false);          // UTC: 9:39 AM Local: 5:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 7, 1, 51, 0, false);           // UTC: 1:51 AM Local: 9:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 11, 9, 36, 0, false);          // UTC: 9:36 AM Local: 5:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 29, 8, 10, 0, false);          // UTC: 8:10 AM Local: 4:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 12, 17, 48, 0, false);         // UTC: 5:48 PM Local: 1:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 31, 9, 41, 0, false);          // UTC: 9:41 AM Local: 5:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 10, 20, 51, 0, false);         // UTC: 8:51 PM Local: 4:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 5, 13, 27, 0, false);          // UTC: 1:27 PM Local: 9:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 1, 13, 0, 17, 0, false);          // UTC: 12:17 AM Local: 8:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 23, 19, 19, 0, false);         // UTC: 7:19 PM Local: 3:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 28, 9, 47, 0, false);          // UTC: 9:47 AM Local: 5:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 27, 14, 23, 0, false);         // UTC: 2:23 PM Local: 10:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 25, 15, 56, 0, false);         // UTC: 3:56 PM Local: 11:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 10, 17, 21, 0, false);         // UTC: 5:21 PM Local: 1:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 11, 18, 19, 0, false);         // UTC: 6:19 PM Local: 2:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 2, 14, 10, 0, false);          // UTC: 2:10 PM Local: 10:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 16, 17, 22, 0, false);         // UTC: 5:22 PM Local: 1:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 14, 6, 1, 0, false);           // UTC: 6:01 AM Local: 2:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 3, 10, 30, 0, false);          // UTC: 10:30 AM Local: 6:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 1, 8, 2, 0, false);            // UTC: 8:02 AM Local: 4:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 22, 15, 50, 0, false);         // UTC: 3:50 PM Local: 11:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 28, 23, 31, 0, false);         // UTC: 11:31 PM Local: 7:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 21, 11, 24, 0, false);         // UTC: 11:24 AM Local: 7:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 8, 18, 55, 0, false);          // UTC: 6:55 PM Local: 2:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 10, 20, 25, 0, false);         // UTC: 8:25 PM Local: 4:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 25, 10, 24, 0, false);         // UTC: 10:24 AM Local: 6:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 9, 22, 21, 0, false);          // UTC: 10:21 PM Local: 6:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 9, 6, 4, 0, false);            // UTC: 6:04 AM Local: 2:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 7, 11, 19, 0, false);          // UTC: 11:19 AM Local: 7:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 6, 3, 32, 0, false);           // UTC: 3:32 AM Local: 11:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 1, 13, 18, 0, false);          // UTC: 1:18 PM Local: 9:18 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 24, 15, 23, 0, false);         // UTC: 3:23 PM Local: 11:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 12, 6, 12, 0, false);          // UTC: 6:12 AM Local: 2:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 2, 26, 13, 45, 0, false);         // UTC: 1:45 PM Local: 9:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 6, 12, 19, 0, false);          // UTC: 12:19 PM Local: 8:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 23, 2, 19, 0, false);          // UTC: 2:19 AM Local: 10:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 16, 6, 41, 0, false);          // UTC: 6:41 AM Local: 2:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 15, 18, 3, 0, false);          // UTC: 6:03 PM Local: 2:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 10, 20, 34, 0, false);         // UTC: 8:34 PM Local: 4:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 8, 14, 3, 0, false);           // UTC: 2:03 PM Local: 10:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 18, 12, 48, 0, false);         // UTC: 12:48 PM Local: 8:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 24, 1, 37, 0, false);          // UTC: 1:37 AM Local: 9:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 4, 16, 21, 0, false);          // UTC: 4:21 PM Local: 12:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 3, 6, 12, 0, false);           // UTC: 6:12 AM Local: 2:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 13, 19, 28, 0, false);         // UTC: 7:28 PM Local: 3:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 25, 14, 7, 0, false);          // UTC: 2:07 PM Local: 10:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 20, 21, 29, 0, false);         // UTC: 9:29 PM Local: 5:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 4, 0, 48, 0, false);           // UTC: 12:48 AM Local: 8:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 25, 22, 5, 0, false);          // UTC: 10:05 PM Local: 6:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 12, 19, 22, 0, false);         // UTC: 7:22 PM Local: 3:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 9, 23, 54, 0, false);          // UTC: 11:54 PM Local: 7:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 28, 3, 31, 0, false);          // UTC: 3:31 AM Local: 11:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 9, 2, 55, 0, false);           // UTC: 2:55 AM Local: 10:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 8, 13, 13, 0, false);          // UTC: 1:13 PM Local: 9:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 30, 4, 31, 0, false);          // UTC: 4:31 AM Local: 12:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 2, 1, 18, 0, false);           // UTC: 1:18 AM Local: 9:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 24, 20, 36, 0, false);         // UTC: 8:36 PM Local: 4:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 1, 5, 0, 0, false);            // UTC: 5:00 AM Local: 1:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 3, 6, 17, 6, 0, false);           // UTC: 5:06 PM Local: 1:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 6, 12, 25, 0, false);          // UTC: 12:25 PM Local: 8:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 5, 11, 6, 0, false);           // UTC: 11:06 AM Local: 7:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 28, 17, 33, 0, false);         // UTC: 5:33 PM Local: 1:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 5, 2, 0, 0, false);            // UTC: 2:00 AM Local: 10:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 3, 1, 49, 0, false);           // UTC: 1:49 AM Local: 9:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 20, 21, 3, 0, false);          // UTC: 9:03 PM Local: 5:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 1, 14, 24, 0, false);          // UTC: 2:24 PM Local: 10:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 28, 0, 28, 0, false);          // UTC: 12:28 AM Local: 8:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 29, 11, 0, 0, false);          // UTC: 11:00 AM Local: 7:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 15, 6, 50, 0, false);          // UTC: 6:50 AM Local: 2:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 4, 3, 35, 0, false);           // UTC: 3:35 AM Local: 11:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 27, 21, 58, 0, false);         // UTC: 9:58 PM Local: 5:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 7, 1, 37, 0, false);           // UTC: 1:37 AM Local: 9:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 13, 8, 4, 0, false);           // UTC: 8:04 AM Local: 4:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 28, 5, 36, 0, false);          // UTC: 5:36 AM Local: 1:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 25, 0, 39, 0, false);          // UTC: 12:39 AM Local: 8:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 10, 23, 17, 0, false);         // UTC: 11:17 PM Local: 7:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 3, 18, 23, 0, false);          // UTC: 6:23 PM Local: 2:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 1, 0, 53, 0, false);           // UTC: 12:53 AM Local: 8:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 20, 23, 33, 0, false);         // UTC: 11:33 PM Local: 7:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 2, 19, 12, 0, false);          // UTC: 7:12 PM Local: 3:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 7, 4, 42, 0, false);           // UTC: 4:42 AM Local: 12:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 20, 20, 36, 0, false);         // UTC: 8:36 PM Local: 4:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 8, 13, 29, 0, false);          // UTC: 1:29 PM Local: 9:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 4, 9, 16, 57, 0, false);          // UTC: 4:57 PM Local: 12:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 22, 14, 48, 0, false);         // UTC: 2:48 PM Local: 10:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 13, 9, 29, 0, false);          // UTC: 9:29 AM Local: 5:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 10, 16, 59, 0, false);         // UTC: 4:59 PM Local: 12:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 23, 0, 11, 0, false);          // UTC: 12:11 AM Local: 8:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 8, 16, 52, 0, false);          // UTC: 4:52 PM Local: 12:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 11, 14, 42, 0, false);         // UTC: 2:42 PM Local: 10:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 9, 21, 16, 0, false);          // UTC: 9:16 PM Local: 5:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 28, 20, 35, 0, false);         // UTC: 8:35 PM Local: 4:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 22, 4, 24, 0, false);          // UTC: 4:24 AM Local: 12:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 17, 3, 6, 0, false);           // UTC: 3:06 AM Local: 11:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 16, 14, 44, 0, false);         // UTC: 2:44 PM Local: 10:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 14, 5, 23, 0, false);          // UTC: 5:23 AM Local: 1:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 17, 7, 25, 0, false);          // UTC: 7:25 AM Local: 3:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 6, 2, 17, 0, false);           // UTC: 2:17 AM Local: 10:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 24, 21, 23, 0, false);         // UTC: 9:23 PM Local: 5:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 6, 23, 30, 0, false);          // UTC: 11:30 PM Local: 7:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 15, 1, 58, 0, false);          // UTC: 1:58 AM Local: 9:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 25, 9, 32, 0, false);          // UTC: 9:32 AM Local: 5:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 12, 18, 11, 0, false);         // UTC: 6:11 PM Local: 2:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 16, 11, 28, 0, false);         // UTC: 11:28 AM Local: 7:28 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 15, 1, 48, 0, false);          // UTC: 1:48 AM Local: 9:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 29, 7, 42, 0, false);          // UTC: 7:42 AM Local: 3:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 30, 0, 18, 0, false);          // UTC: 12:18 AM Local: 8:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 29, 8, 42, 0, false);          // UTC: 8:42 AM Local: 4:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 5, 28, 10, 57, 0, false);         // UTC: 10:57 AM Local: 6:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 8, 15, 43, 0, false);          // UTC: 3:43 PM Local: 11:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 4, 16, 47, 0, false);          // UTC: 4:47 PM Local: 12:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 30, 22, 23, 0, false);         // UTC: 10:23 PM Local: 6:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 21, 20, 55, 0, false);         // UTC: 8:55 PM Local: 4:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 29, 1, 34, 0, false);          // UTC: 1:34 AM Local: 9:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 15, 11, 8, 0, false);          // UTC: 11:08 AM Local: 7:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 19, 20, 18, 0, false);         // UTC: 8:18 PM Local: 4:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 28, 22, 13, 0, false);         // UTC: 10:13 PM Local: 6:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 25, 2, 33, 0, false);          // UTC: 2:33 AM Local: 10:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 20, 7, 3, 0, false);           // UTC: 7:03 AM Local: 3:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 29, 15, 30, 0, false);         // UTC: 3:30 PM Local: 11:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 5, 10, 58, 0, false);          // UTC: 10:58 AM Local: 6:58 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 29, 0, 8, 0, false);           // UTC: 12:08 AM Local: 8:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 26, 23, 4, 0, false);          // UTC: 11:04 PM Local: 7:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 10, 3, 29, 0, false);          // UTC: 3:29 AM Local: 11:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 22, 9, 2, 0, false);           // UTC: 9:02 AM Local: 5:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 11, 15, 36, 0, false);         // UTC: 3:36 PM Local: 11:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 30, 9, 13, 0, false);          // UTC: 9:13 AM Local: 5:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 7, 22, 20, 0, false);          // UTC: 10:20 PM Local: 6:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 4, 11, 57, 0, false);          // UTC: 11:57 AM Local: 7:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 8, 0, 44, 0, false);           // UTC: 12:44 AM Local: 8:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 8, 17, 15, 0, false);          // UTC: 5:15 PM Local: 1:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 1, 20, 38, 0, false);          // UTC: 8:38 PM Local: 4:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 17, 13, 42, 0, false);         // UTC: 1:42 PM Local: 9:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 6, 9, 18, 39, 0, false);          // UTC: 6:39 PM Local: 2:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 28, 6, 12, 0, false);          // UTC: 6:12 AM Local: 2:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 20, 6, 23, 0, false);          // UTC: 6:23 AM Local: 2:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 19, 10, 49, 0, false);         // UTC: 10:49 AM Local: 6:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 24, 14, 9, 0, false);          // UTC: 2:09 PM Local: 10:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 30, 19, 15, 0, false);         // UTC: 7:15 PM Local: 3:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 29, 14, 32, 0, false);         // UTC: 2:32 PM Local: 10:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 6, 23, 10, 0, false);          // UTC: 11:10 PM Local: 7:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 10, 21, 50, 0, false);         // UTC: 9:50 PM Local: 5:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 12, 5, 46, 0, false);          // UTC: 5:46 AM Local: 1:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 24, 19, 12, 0, false);         // UTC: 7:12 PM Local: 3:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 19, 3, 35, 0, false);          // UTC: 3:35 AM Local: 11:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 29, 13, 51, 0, false);         // UTC: 1:51 PM Local: 9:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 23, 10, 30, 0, false);         // UTC: 10:30 AM Local: 6:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 26, 10, 35, 0, false);         // UTC: 10:35 AM Local: 6:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 19, 11, 26, 0, false);         // UTC: 11:26 AM Local: 7:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 12, 20, 40, 0, false);         // UTC: 8:40 PM Local: 4:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 11, 19, 54, 0, false);         // UTC: 7:54 PM Local: 3:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 26, 5, 28, 0, false);          // UTC: 5:28 AM Local: 1:28 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 3, 14, 30, 0, false);          // UTC: 2:30 PM Local: 10:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 25, 21, 5, 0, false);          // UTC: 9:05 PM Local: 5:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 10, 6, 9, 0, false);           // UTC: 6:09 AM Local: 2:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 20, 17, 7, 0, false);          // UTC: 5:07 PM Local: 1:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 30, 8, 47, 0, false);          // UTC: 8:47 AM Local: 4:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 7, 2, 29, 0, false);           // UTC: 2:29 AM Local: 10:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 7, 28, 1, 7, 0, false);           // UTC: 1:07 AM Local: 9:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 31, 23, 15, 0, false);         // UTC: 11:15 PM Local: 7:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 27, 0, 19, 0, false);          // UTC: 12:19 AM Local: 8:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 18, 13, 41, 0, false);         // UTC: 1:41 PM Local: 9:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 20, 4, 1, 0, false);           // UTC: 4:01 AM Local: 12:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 16, 18, 3, 0, false);          // UTC: 6:03 PM Local: 2:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 20, 3, 19, 0, false);          // UTC: 3:19 AM Local: 11:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 30, 12, 39, 0, false);         // UTC: 12:39 PM Local: 8:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 14, 8, 1, 0, false);           // UTC: 8:01 AM Local: 4:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 19, 23, 9, 0, false);          // UTC: 11:09 PM Local: 7:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 28, 11, 12, 0, false);         // UTC: 11:12 AM Local: 7:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 23, 9, 53, 0, false);          // UTC: 9:53 AM Local: 5:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 3, 10, 6, 0, false);           // UTC: 10:06 AM Local: 6:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 26, 19, 50, 0, false);         // UTC: 7:50 PM Local: 3:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 14, 17, 35, 0, false);         // UTC: 5:35 PM Local: 1:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 24, 1, 16, 0, false);          // UTC: 1:16 AM Local: 9:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 5, 14, 52, 0, false);          // UTC: 2:52 PM Local: 10:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 11, 18, 27, 0, false);         // UTC: 6:27 PM Local: 2:27 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 15, 20, 25, 0, false);         // UTC: 8:25 PM Local: 4:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 14, 11, 50, 0, false);         // UTC: 11:50 AM Local: 7:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 29, 21, 20, 0, false);         // UTC: 9:20 PM Local: 5:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 22, 13, 25, 0, false);         // UTC: 1:25 PM Local: 9:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 6, 9, 49, 0, false);           // UTC: 9:49 AM Local: 5:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 19, 22, 40, 0, false);         // UTC: 10:40 PM Local: 6:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 8, 15, 40, 0, false);          // UTC: 3:40 PM Local: 11:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 8, 7, 6, 19, 0, false);           // UTC: 6:19 AM Local: 2:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 17, 11, 17, 0, false);         // UTC: 11:17 AM Local: 7:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 15, 23, 31, 0, false);         // UTC: 11:31 PM Local: 7:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 23, 2, 24, 0, false);          // UTC: 2:24 AM Local: 10:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 8, 9, 19, 0, false);           // UTC: 9:19 AM Local: 5:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 24, 23, 44, 0, false);         // UTC: 11:44 PM Local: 7:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 20, 14, 33, 0, false);         // UTC: 2:33 PM Local: 10:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 17, 2, 30, 0, false);          // UTC: 2:30 AM Local: 10:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 9, 11, 53, 0, false);          // UTC: 11:53 AM Local: 7:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 24, 15, 3, 0, false);          // UTC: 3:03 PM Local: 11:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 17, 9, 52, 0, false);          // UTC: 9:52 AM Local: 5:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 15, 12, 37, 0, false);         // UTC: 12:37 PM Local: 8:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 14, 2, 42, 0, false);          // UTC: 2:42 AM Local: 10:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 17, 5, 34, 0, false);          // UTC: 5:34 AM Local: 1:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 15, 3, 3, 0, false);           // UTC: 3:03 AM Local: 11:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 26, 11, 13, 0, false);         // UTC: 11:13 AM Local: 7:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 29, 19, 28, 0, false);         // UTC: 7:28 PM Local: 3:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 8, 18, 4, 0, false);           // UTC: 6:04 PM Local: 2:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 17, 0, 10, 0, false);          // UTC: 12:10 AM Local: 8:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 29, 21, 11, 0, false);         // UTC: 9:11 PM Local: 5:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 5, 15, 56, 0, false);          // UTC: 3:56 PM Local: 11:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 30, 13, 17, 0, false);         // UTC: 1:17 PM Local: 9:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 9, 0, 7, 0, false);            // UTC: 12:07 AM Local: 8:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 3, 1, 5, 0, false);            // UTC: 1:05 AM Local: 9:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 2, 11, 40, 0, false);          // UTC: 11:40 AM Local: 7:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 9, 24, 5, 41, 0, false);          // UTC: 5:41 AM Local: 1:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 19, 3, 28, 0, false);         // UTC: 3:28 AM Local: 11:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 5, 20, 29, 0, false);         // UTC: 8:29 PM Local: 4:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 31, 21, 9, 0, false);         // UTC: 9:09 PM Local: 5:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 10, 2, 1, 0, false);          // UTC: 2:01 AM Local: 10:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 2, 18, 24, 0, false);         // UTC: 6:24 PM Local: 2:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 9, 9, 18, 0, false);          // UTC: 9:18 AM Local: 5:18 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 10, 13, 26, 0, false);        // UTC: 1:26 PM Local: 9:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 17, 14, 5, 0, false);         // UTC: 2:05 PM Local: 10:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 10, 0, 56, 0, false);         // UTC: 12:56 AM Local: 8:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 13, 5, 38, 0, false);         // UTC: 5:38 AM Local: 1:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 25, 15, 44, 0, false);        // UTC: 3:44 PM Local: 11:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 16, 0, 56, 0, false);         // UTC: 12:56 AM Local: 8:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 13, 20, 58, 0, false);        // UTC: 8:58 PM Local: 4:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 15, 16, 41, 0, false);        // UTC: 4:41 PM Local: 12:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 3, 0, 50, 0, false);          // UTC: 12:50 AM Local: 8:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 2, 5, 2, 0, false);           // UTC: 5:02 AM Local: 1:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 17, 12, 47, 0, false);        // UTC: 12:47 PM Local: 8:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 17, 0, 52, 0, false);         // UTC: 12:52 AM Local: 8:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 8, 2, 29, 0, false);          // UTC: 2:29 AM Local: 10:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 1, 11, 17, 0, false);         // UTC: 11:17 AM Local: 7:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 8, 0, 50, 0, false);          // UTC: 12:50 AM Local: 8:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 21, 15, 27, 0, false);        // UTC: 3:27 PM Local: 11:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 17, 5, 37, 0, false);         // UTC: 5:37 AM Local: 1:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 5, 2, 22, 0, false);          // UTC: 2:22 AM Local: 10:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 10, 16, 17, 26, 0, false);        // UTC: 5:26 PM Local: 1:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 16, 11, 52, 0, false);        // UTC: 11:52 AM Local: 7:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 4, 22, 2, 0, false);          // UTC: 10:02 PM Local: 6:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 3, 13, 40, 0, false);         // UTC: 1:40 PM Local: 9:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 9, 20, 39, 0, false);         // UTC: 8:39 PM Local: 4:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 22, 17, 3, 0, false);         // UTC: 5:03 PM Local: 1:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 12, 22, 15, 0, false);        // UTC: 10:15 PM Local: 6:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 17, 1, 4, 0, false);          // UTC: 1:04 AM Local: 9:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 14, 4, 12, 0, false);         // UTC: 4:12 AM Local: 12:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 7, 11, 22, 0, false);         // UTC: 11:22 AM Local: 7:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 12, 7, 31, 0, false);         // UTC: 7:31 AM Local: 3:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 21, 17, 45, 0, false);        // UTC: 5:45 PM Local: 1:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 19, 13, 38, 0, false);        // UTC: 1:38 PM Local: 9:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 16, 19, 29, 0, false);        // UTC: 7:29 PM Local: 3:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 17, 22, 42, 0, false);        // UTC: 10:42 PM Local: 6:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 24, 2, 4, 0, false);          // UTC: 2:04 AM Local: 10:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 13, 20, 16, 0, false);        // UTC: 8:16 PM Local: 4:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 14, 9, 0, 0, false);          // UTC: 9:00 AM Local: 5:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 8, 17, 50, 0, false);         // UTC: 5:50 PM Local: 1:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 27, 4, 5, 0, false);          // UTC: 4:05 AM Local: 12:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 20, 16, 36, 0, false);        // UTC: 4:36 PM Local: 12:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 20, 23, 4, 0, false);         // UTC: 11:04 PM Local: 7:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 14, 6, 35, 0, false);         // UTC: 6:35 AM Local: 2:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 29, 10, 12, 0, false);        // UTC: 10:12 AM Local: 6:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 8, 0, 22, 0, false);          // UTC: 12:22 AM Local: 8:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 11, 7, 8, 3, 0, false);           // UTC: 8:03 AM Local: 4:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 5, 22, 11, 0, false);         // UTC: 10:11 PM Local: 6:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 19, 7, 3, 0, false);          // UTC: 7:03 AM Local: 3:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 26, 8, 17, 0, false);         // UTC: 8:17 AM Local: 4:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 12, 5, 15, 0, false);         // UTC: 5:15 AM Local: 1:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 1, 17, 47, 0, false);         // UTC: 5:47 PM Local: 1:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 30, 15, 50, 0, false);        // UTC: 3:50 PM Local: 11:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 9, 1, 54, 0, false);          // UTC: 1:54 AM Local: 9:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 25, 21, 58, 0, false);        // UTC: 9:58 PM Local: 5:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 9, 14, 34, 0, false);         // UTC: 2:34 PM Local: 10:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 12, 13, 30, 0, false);        // UTC: 1:30 PM Local: 9:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 18, 18, 23, 0, false);        // UTC: 6:23 PM Local: 2:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 21, 5, 32, 0, false);         // UTC: 5:32 AM Local: 1:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 28, 21, 22, 0, false);        // UTC: 9:22 PM Local: 5:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 19, 15, 31, 0, false);        // UTC: 3:31 PM Local: 11:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 8, 4, 28, 0, false);          // UTC: 4:28 AM Local: 12:28 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 16, 18, 2, 0, false);         // UTC: 6:02 PM Local: 2:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 14, 11, 54, 0, false);        // UTC: 11:54 AM Local: 7:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 17, 8, 40, 0, false);         // UTC: 8:40 AM Local: 4:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 5, 4, 28, 0, false);          // UTC: 4:28 AM Local: 12:28 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 4, 6, 8, 0, false);           // UTC: 6:08 AM Local: 2:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 26, 8, 30, 0, false);         // UTC: 8:30 AM Local: 4:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 22, 5, 47, 0, false);         // UTC: 5:47 AM Local: 1:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 14, 22, 2, 0, false);         // UTC: 10:02 PM Local: 6:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 12, 4, 56, 0, false);         // UTC: 4:56 AM Local: 12:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2019, 12, 4, 15, 53, 0, false);         // UTC: 3:53 PM Local: 11:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 29, 3, 39, 0, false);          // UTC: 3:39 AM Local: 11:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 15, 1, 18, 0, false);          // UTC: 1:18 AM Local: 9:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 29, 11, 11, 0, false);         // UTC: 11:11 AM Local: 7:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 19, 5, 56, 0, false);          // UTC: 5:56 AM Local: 1:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 29, 15, 8, 0, false);          // UTC: 3:08 PM Local: 11:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 16, 21, 26, 0, false);         // UTC: 9:26 PM Local: 5:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 30, 18, 33, 0, false);         // UTC: 6:33 PM Local: 2:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 8, 14, 47, 0, false);          // UTC: 2:47 PM Local: 10:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 16, 2, 47, 0, false);          // UTC: 2:47 AM Local: 10:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 7, 15, 1, 0, false);           // UTC: 3:01 PM Local: 11:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 2, 10, 38, 0, false);          // UTC: 10:38 AM Local: 6:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 15, 10, 45, 0, false);         // UTC: 10:45 AM Local: 6:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 15, 7, 4, 0, false);           // UTC: 7:04 AM Local: 3:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 26, 17, 21, 0, false);         // UTC: 5:21 PM Local: 1:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 4, 8, 47, 0, false);           // UTC: 8:47 AM Local: 4:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 8, 18, 36, 0, false);          // UTC: 6:36 PM Local: 2:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 13, 5, 34, 0, false);          // UTC: 5:34 AM Local: 1:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 19, 2, 45, 0, false);          // UTC: 2:45 AM Local: 10:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 19, 17, 33, 0, false);         // UTC: 5:33 PM Local: 1:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 10, 20, 38, 0, false);         // UTC: 8:38 PM Local: 4:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 29, 23, 2, 0, false);          // UTC: 11:02 PM Local: 7:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 9, 7, 15, 0, false);           // UTC: 7:15 AM Local: 3:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 21, 14, 37, 0, false);         // UTC: 2:37 PM Local: 10:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 22, 20, 10, 0, false);         // UTC: 8:10 PM Local: 4:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 1, 26, 11, 42, 0, false);         // UTC: 11:42 AM Local: 7:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 13, 7, 52, 0, false);          // UTC: 7:52 AM Local: 3:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 5, 5, 37, 0, false);           // UTC: 5:37 AM Local: 1:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 22, 18, 6, 0, false);          // UTC: 6:06 PM Local: 2:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 27, 19, 49, 0, false);         // UTC: 7:49 PM Local: 3:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 21, 14, 34, 0, false);         // UTC: 2:34 PM Local: 10:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 13, 16, 14, 0, false);         // UTC: 4:14 PM Local: 12:14 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 7, 0, 7, 0, false);            // UTC: 12:07 AM Local: 8:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 18, 7, 59, 0, false);          // UTC: 7:59 AM Local: 3:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 22, 8, 15, 0, false);          // UTC: 8:15 AM Local: 4:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 15, 9, 44, 0, false);          // UTC: 9:44 AM Local: 5:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 8, 22, 51, 0, false);          // UTC: 10:51 PM Local: 6:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 21, 12, 19, 0, false);         // UTC: 12:19 PM Local: 8:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 11, 17, 15, 0, false);         // UTC: 5:15 PM Local: 1:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 10, 21, 41, 0, false);         // UTC: 9:41 PM Local: 5:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 15, 19, 22, 0, false);         // UTC: 7:22 PM Local: 3:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 28, 3, 18, 0, false);          // UTC: 3:18 AM Local: 11:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 19, 7, 49, 0, false);          // UTC: 7:49 AM Local: 3:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 19, 7, 10, 0, false);          // UTC: 7:10 AM Local: 3:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 9, 20, 6, 0, false);           // UTC: 8:06 PM Local: 4:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 24, 13, 58, 0, false);         // UTC: 1:58 PM Local: 9:58 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 28, 19, 39, 0, false);         // UTC: 7:39 PM Local: 3:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 19, 1, 51, 0, false);          // UTC: 1:51 AM Local: 9:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 5, 2, 43, 0, false);           // UTC: 2:43 AM Local: 10:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 12, 5, 7, 0, false);           // UTC: 5:07 AM Local: 1:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 2, 3, 1, 6, 0, false);            // UTC: 1:06 AM Local: 9:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 13, 1, 25, 0, false);          // UTC: 1:25 AM Local: 9:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 15, 16, 57, 0, false);         // UTC: 4:57 PM Local: 12:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 18, 9, 16, 0, false);          // UTC: 9:16 AM Local: 5:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 30, 19, 59, 0, false);         // UTC: 7:59 PM Local: 3:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 7, 23, 57, 0, false);          // UTC: 11:57 PM Local: 7:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 12, 17, 19, 0, false);         // UTC: 5:19 PM Local: 1:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 5, 0, 1, 0, false);            // UTC: 12:01 AM Local: 8:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 30, 23, 38, 0, false);         // UTC: 11:38 PM Local: 7:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 8, 10, 15, 0, false);          // UTC: 10:15 AM Local: 6:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 3, 20, 23, 0, false);          // UTC: 8:23 PM Local: 4:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 15, 8, 7, 0, false);           // UTC: 8:07 AM Local: 4:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 3, 22, 21, 0, false);          // UTC: 10:21 PM Local: 6:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 1, 14, 20, 0, false);          // UTC: 2:20 PM Local: 10:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 24, 21, 28, 0, false);         // UTC: 9:28 PM Local: 5:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 20, 1, 30, 0, false);          // UTC: 1:30 AM Local: 9:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 10, 16, 18, 0, false);         // UTC: 4:18 PM Local: 12:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 19, 4, 57, 0, false);          // UTC: 4:57 AM Local: 12:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 18, 21, 44, 0, false);         // UTC: 9:44 PM Local: 5:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 1, 15, 58, 0, false);          // UTC: 3:58 PM Local: 11:58 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 27, 13, 41, 0, false);         // UTC: 1:41 PM Local: 9:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 16, 23, 33, 0, false);         // UTC: 11:33 PM Local: 7:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 26, 12, 29, 0, false);         // UTC: 12:29 PM Local: 8:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 24, 21, 23, 0, false);         // UTC: 9:23 PM Local: 5:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 2, 1, 42, 0, false);           // UTC: 1:42 AM Local: 9:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 3, 1, 17, 22, 0, false);          // UTC: 5:22 PM Local: 1:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 12, 11, 21, 0, false);         // UTC: 11:21 AM Local: 7:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 20, 3, 5, 0, false);           // UTC: 3:05 AM Local: 11:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 23, 8, 24, 0, false);          // UTC: 8:24 AM Local: 4:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 25, 15, 32, 0, false);         // UTC: 3:32 PM Local: 11:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 20, 1, 3, 0, false);           // UTC: 1:03 AM Local: 9:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 4, 15, 9, 0, false);           // UTC: 3:09 PM Local: 11:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 28, 15, 30, 0, false);         // UTC: 3:30 PM Local: 11:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 16, 7, 40, 0, false);          // UTC: 7:40 AM Local: 3:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 11, 13, 16, 0, false);         // UTC: 1:16 PM Local: 9:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 7, 13, 51, 0, false);          // UTC: 1:51 PM Local: 9:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 15, 22, 21, 0, false);         // UTC: 10:21 PM Local: 6:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 21, 11, 4, 0, false);          // UTC: 11:04 AM Local: 7:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 14, 0, 26, 0, false);          // UTC: 12:26 AM Local: 8:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 11, 6, 11, 0, false);          // UTC: 6:11 AM Local: 2:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 19, 19, 24, 0, false);         // UTC: 7:24 PM Local: 3:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 10, 7, 28, 0, false);          // UTC: 7:28 AM Local: 3:28 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 23, 8, 13, 0, false);          // UTC: 8:13 AM Local: 4:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 11, 20, 59, 0, false);         // UTC: 8:59 PM Local: 4:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 4, 22, 2, 0, false);           // UTC: 10:02 PM Local: 6:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 9, 20, 0, 0, false);           // UTC: 8:00 PM Local: 4:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 15, 21, 57, 0, false);         // UTC: 9:57 PM Local: 5:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 10, 18, 10, 0, false);         // UTC: 6:10 PM Local: 2:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 15, 4, 50, 0, false);          // UTC: 4:50 AM Local: 12:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 22, 20, 16, 0, false);         // UTC: 8:16 PM Local: 4:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 4, 27, 14, 33, 0, false);         // UTC: 2:33 PM Local: 10:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 19, 20, 48, 0, false);         // UTC: 8:48 PM Local: 4:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 12, 10, 58, 0, false);         // UTC: 10:58 AM Local: 6:58 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 15, 15, 12, 0, false);         // UTC: 3:12 PM Local: 11:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 5, 12, 57, 0, false);          // UTC: 12:57 PM Local: 8:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 1, 7, 1, 0, false);            // UTC: 7:01 AM Local: 3:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 20, 1, 52, 0, false);          // UTC: 1:52 AM Local: 9:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 24, 1, 20, 0, false);          // UTC: 1:20 AM Local: 9:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 25, 9, 2, 0, false);           // UTC: 9:02 AM Local: 5:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 2, 12, 35, 0, false);          // UTC: 12:35 PM Local: 8:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 18, 10, 56, 0, false);         // UTC: 10:56 AM Local: 6:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 19, 11, 33, 0, false);         // UTC: 11:33 AM Local: 7:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 15, 19, 34, 0, false);         // UTC: 7:34 PM Local: 3:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 6, 8, 37, 0, false);           // UTC: 8:37 AM Local: 4:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 14, 22, 12, 0, false);         // UTC: 10:12 PM Local: 6:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 19, 23, 49, 0, false);         // UTC: 11:49 PM Local: 7:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 7, 10, 13, 0, false);          // UTC: 10:13 AM Local: 6:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 19, 19, 35, 0, false);         // UTC: 7:35 PM Local: 3:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 31, 12, 27, 0, false);         // UTC: 12:27 PM Local: 8:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 19, 16, 38, 0, false);         // UTC: 4:38 PM Local: 12:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 20, 16, 44, 0, false);         // UTC: 4:44 PM Local: 12:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 2, 9, 43, 0, false);           // UTC: 9:43 AM Local: 5:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 18, 5, 15, 0, false);          // UTC: 5:15 AM Local: 1:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 27, 23, 25, 0, false);         // UTC: 11:25 PM Local: 7:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 26, 9, 19, 0, false);          // UTC: 9:19 AM Local: 5:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 5, 20, 1, 27, 0, false);          // UTC: 1:27 AM Local: 9:27 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 26, 20, 41, 0, false);         // UTC: 8:41 PM Local: 4:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 27, 23, 49, 0, false);         // UTC: 11:49 PM Local: 7:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 21, 10, 6, 0, false);          // UTC: 10:06 AM Local: 6:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 27, 2, 58, 0, false);          // UTC: 2:58 AM Local: 10:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 24, 6, 5, 0, false);           // UTC: 6:05 AM Local: 2:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 21, 18, 45, 0, false);         // UTC: 6:45 PM Local: 2:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 24, 18, 16, 0, false);         // UTC: 6:16 PM Local: 2:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 29, 3, 18, 0, false);          // UTC: 3:18 AM Local: 11:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 2, 21, 1, 0, false);           // UTC: 9:01 PM Local: 5:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 19, 3, 48, 0, false);          // UTC: 3:48 AM Local: 11:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 7, 13, 55, 0, false);          // UTC: 1:55 PM Local: 9:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 22, 17, 41, 0, false);         // UTC: 5:41 PM Local: 1:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 3, 15, 29, 0, false);          // UTC: 3:29 PM Local: 11:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 15, 16, 2, 0, false);          // UTC: 4:02 PM Local: 12:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 14, 2, 38, 0, false);          // UTC: 2:38 AM Local: 10:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 11, 16, 17, 0, false);         // UTC: 4:17 PM Local: 12:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 1, 13, 48, 0, false);          // UTC: 1:48 PM Local: 9:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 4, 11, 37, 0, false);          // UTC: 11:37 AM Local: 7:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 14, 6, 8, 0, false);           // UTC: 6:08 AM Local: 2:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 27, 11, 48, 0, false);         // UTC: 11:48 AM Local: 7:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 8, 22, 22, 0, false);          // UTC: 10:22 PM Local: 6:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 23, 4, 57, 0, false);          // UTC: 4:57 AM Local: 12:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 28, 17, 41, 0, false);         // UTC: 5:41 PM Local: 1:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 26, 0, 50, 0, false);          // UTC: 12:50 AM Local: 8:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 6, 19, 10, 30, 0, false);         // UTC: 10:30 AM Local: 6:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 27, 23, 48, 0, false);         // UTC: 11:48 PM Local: 7:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 15, 2, 21, 0, false);          // UTC: 2:21 AM Local: 10:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 7, 17, 50, 0, false);          // UTC: 5:50 PM Local: 1:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 19, 1, 39, 0, false);          // UTC: 1:39 AM Local: 9:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 30, 6, 43, 0, false);          // UTC: 6:43 AM Local: 2:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 28, 22, 6, 0, false);          // UTC: 10:06 PM Local: 6:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 15, 3, 40, 0, false);          // UTC: 3:40 AM Local: 11:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 3, 0, 4, 0, false);            // UTC: 12:04 AM Local: 8:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 19, 16, 33, 0, false);         // UTC: 4:33 PM Local: 12:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 15, 20, 4, 0, false);          // UTC: 8:04 PM Local: 4:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 26, 22, 16, 0, false);         // UTC: 10:16 PM Local: 6:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 28, 7, 4, 0, false);           // UTC: 7:04 AM Local: 3:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 24, 10, 39, 0, false);         // UTC: 10:39 AM Local: 6:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 22, 21, 31, 0, false);         // UTC: 9:31 PM Local: 5:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 28, 2, 35, 0, false);          // UTC: 2:35 AM Local: 10:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 23, 23, 1, 0, false);          // UTC: 11:01 PM Local: 7:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 22, 1, 28, 0, false);          // UTC: 1:28 AM Local: 9:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 6, 1, 59, 0, false);           // UTC: 1:59 AM Local: 9:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 7, 22, 7, 0, false);           // UTC: 10:07 PM Local: 6:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 2, 11, 52, 0, false);          // UTC: 11:52 AM Local: 7:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 2, 5, 29, 0, false);           // UTC: 5:29 AM Local: 1:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 3, 17, 51, 0, false);          // UTC: 5:51 PM Local: 1:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 13, 13, 18, 0, false);         // UTC: 1:18 PM Local: 9:18 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 25, 3, 48, 0, false);          // UTC: 3:48 AM Local: 11:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 7, 28, 5, 11, 0, false);          // UTC: 5:11 AM Local: 1:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 27, 20, 53, 0, false);         // UTC: 8:53 PM Local: 4:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 3, 12, 48, 0, false);          // UTC: 12:48 PM Local: 8:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 28, 16, 57, 0, false);         // UTC: 4:57 PM Local: 12:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 25, 4, 58, 0, false);          // UTC: 4:58 AM Local: 12:58 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 30, 8, 37, 0, false);          // UTC: 8:37 AM Local: 4:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 11, 21, 9, 0, false);          // UTC: 9:09 PM Local: 5:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 1, 22, 24, 0, false);          // UTC: 10:24 PM Local: 6:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 13, 18, 26, 0, false);         // UTC: 6:26 PM Local: 2:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 12, 1, 15, 0, false);          // UTC: 1:15 AM Local: 9:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 15, 3, 58, 0, false);          // UTC: 3:58 AM Local: 11:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 30, 0, 52, 0, false);          // UTC: 12:52 AM Local: 8:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 5, 11, 1, 0, false);           // UTC: 11:01 AM Local: 7:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 18, 22, 59, 0, false);         // UTC: 10:59 PM Local: 6:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 2, 13, 51, 0, false);          // UTC: 1:51 PM Local: 9:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 3, 17, 33, 0, false);          // UTC: 5:33 PM Local: 1:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 12, 21, 10, 0, false);         // UTC: 9:10 PM Local: 5:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 8, 16, 25, 0, false);          // UTC: 4:25 PM Local: 12:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 31, 17, 56, 0, false);         // UTC: 5:56 PM Local: 1:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 8, 1, 56, 0, false);           // UTC: 1:56 AM Local: 9:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 31, 20, 7, 0, false);          // UTC: 8:07 PM Local: 4:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 31, 20, 12, 0, false);         // UTC: 8:12 PM Local: 4:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 9, 8, 55, 0, false);           // UTC: 8:55 AM Local: 4:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 12, 18, 25, 0, false);         // UTC: 6:25 PM Local: 2:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 5, 6, 45, 0, false);           // UTC: 6:45 AM Local: 2:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 8, 9, 3, 11, 0, false);           // UTC: 3:11 AM Local: 11:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 15, 14, 43, 0, false);         // UTC: 2:43 PM Local: 10:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 26, 23, 11, 0, false);         // UTC: 11:11 PM Local: 7:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 13, 12, 45, 0, false);         // UTC: 12:45 PM Local: 8:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 3, 11, 11, 0, false);          // UTC: 11:11 AM Local: 7:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 15, 3, 19, 0, false);          // UTC: 3:19 AM Local: 11:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 13, 3, 14, 0, false);          // UTC: 3:14 AM Local: 11:14 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 30, 10, 6, 0, false);          // UTC: 10:06 AM Local: 6:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 1, 12, 43, 0, false);          // UTC: 12:43 PM Local: 8:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 17, 8, 7, 0, false);           // UTC: 8:07 AM Local: 4:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 20, 5, 0, 0, false);           // UTC: 5:00 AM Local: 1:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 10, 21, 15, 0, false);         // UTC: 9:15 PM Local: 5:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 18, 8, 54, 0, false);          // UTC: 8:54 AM Local: 4:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 13, 7, 44, 0, false);          // UTC: 7:44 AM Local: 3:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 25, 23, 25, 0, false);         // UTC: 11:25 PM Local: 7:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 24, 0, 58, 0, false);          // UTC: 12:58 AM Local: 8:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 28, 1, 31, 0, false);          // UTC: 1:31 AM Local: 9:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 15, 2, 12, 0, false);          // UTC: 2:12 AM Local: 10:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 14, 20, 14, 0, false);         // UTC: 8:14 PM Local: 4:14 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 25, 7, 8, 0, false);           // UTC: 7:08 AM Local: 3:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 21, 21, 15, 0, false);         // UTC: 9:15 PM Local: 5:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 21, 19, 25, 0, false);         // UTC: 7:25 PM Local: 3:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 29, 15, 0, 0, false);          // UTC: 3:00 PM Local: 11:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 16, 9, 15, 0, false);          // UTC: 9:15 AM Local: 5:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 13, 17, 9, 0, false);          // UTC: 5:09 PM Local: 1:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 9, 15, 21, 24, 0, false);         // UTC: 9:24 PM Local: 5:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 31, 13, 11, 0, false);        // UTC: 1:11 PM Local: 9:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 8, 15, 25, 0, false);         // UTC: 3:25 PM Local: 11:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 30, 5, 20, 0, false);         // UTC: 5:20 AM Local: 1:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 15, 1, 5, 0, false);          // UTC: 1:05 AM Local: 9:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 23, 4, 40, 0, false);         // UTC: 4:40 AM Local: 12:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 23, 10, 29, 0, false);        // UTC: 10:29 AM Local: 6:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 11, 17, 25, 0, false);        // UTC: 5:25 PM Local: 1:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 2, 16, 34, 0, false);         // UTC: 4:34 PM Local: 12:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 21, 16, 49, 0, false);        // UTC: 4:49 PM Local: 12:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 29, 14, 51, 0, false);        // UTC: 2:51 PM Local: 10:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 27, 12, 37, 0, false);        // UTC: 12:37 PM Local: 8:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 21, 11, 23, 0, false);        // UTC: 11:23 AM Local: 7:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 29, 2, 21, 0, false);         // UTC: 2:21 AM Local: 10:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 17, 15, 52, 0, false);        // UTC: 3:52 PM Local: 11:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 24, 19, 37, 0, false);        // UTC: 7:37 PM Local: 3:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 3, 18, 31, 0, false);         // UTC: 6:31 PM Local: 2:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 19, 4, 20, 0, false);         // UTC: 4:20 AM Local: 12:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 30, 17, 40, 0, false);        // UTC: 5:40 PM Local: 1:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 8, 10, 20, 0, false);         // UTC: 10:20 AM Local: 6:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 2, 0, 11, 0, false);          // UTC: 12:11 AM Local: 8:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 15, 18, 17, 0, false);        // UTC: 6:17 PM Local: 2:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 27, 20, 30, 0, false);        // UTC: 8:30 PM Local: 4:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 5, 2, 59, 0, false);          // UTC: 2:59 AM Local: 10:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 28, 8, 54, 0, false);         // UTC: 8:54 AM Local: 4:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 10, 27, 1, 58, 0, false);         // UTC: 1:58 AM Local: 9:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 23, 19, 7, 0, false);         // UTC: 7:07 PM Local: 3:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 4, 5, 2, 0, false);           // UTC: 5:02 AM Local: 1:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 5, 10, 38, 0, false);         // UTC: 10:38 AM Local: 6:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 2, 21, 38, 0, false);         // UTC: 9:38 PM Local: 5:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 28, 19, 40, 0, false);        // UTC: 7:40 PM Local: 3:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 18, 19, 38, 0, false);        // UTC: 7:38 PM Local: 3:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 13, 22, 12, 0, false);        // UTC: 10:12 PM Local: 6:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 1, 20, 23, 0, false);         // UTC: 8:23 PM Local: 4:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 13, 17, 16, 0, false);        // UTC: 5:16 PM Local: 1:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 6, 7, 43, 0, false);          // UTC: 7:43 AM Local: 3:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 22, 21, 38, 0, false);        // UTC: 9:38 PM Local: 5:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 7, 11, 38, 0, false);         // UTC: 11:38 AM Local: 7:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 2, 10, 2, 0, false);          // UTC: 10:02 AM Local: 6:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 5, 20, 16, 0, false);         // UTC: 8:16 PM Local: 4:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 6, 23, 47, 0, false);         // UTC: 11:47 PM Local: 7:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 19, 16, 50, 0, false);        // UTC: 4:50 PM Local: 12:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 4, 18, 11, 0, false);         // UTC: 6:11 PM Local: 2:11 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 1, 12, 56, 0, false);         // UTC: 12:56 PM Local: 8:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 22, 15, 24, 0, false);        // UTC: 3:24 PM Local: 11:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 7, 6, 5, 0, false);           // UTC: 6:05 AM Local: 2:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 19, 7, 20, 0, false);         // UTC: 7:20 AM Local: 3:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 23, 19, 22, 0, false);        // UTC: 7:22 PM Local: 3:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 6, 4, 30, 0, false);          // UTC: 4:30 AM Local: 12:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 10, 6, 4, 0, false);          // UTC: 6:04 AM Local: 2:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 11, 5, 15, 6, 0, false);          // UTC: 3:06 PM Local: 11:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 2, 14, 3, 0, false);          // UTC: 2:03 PM Local: 10:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 9, 2, 56, 0, false);          // UTC: 2:56 AM Local: 10:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 31, 6, 0, 0, false);          // UTC: 6:00 AM Local: 2:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 18, 21, 26, 0, false);        // UTC: 9:26 PM Local: 5:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 18, 6, 6, 0, false);          // UTC: 6:06 AM Local: 2:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 31, 4, 59, 0, false);         // UTC: 4:59 AM Local: 12:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 10, 20, 36, 0, false);        // UTC: 8:36 PM Local: 4:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 23, 8, 27, 0, false);         // UTC: 8:27 AM Local: 4:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 30, 22, 23, 0, false);        // UTC: 10:23 PM Local: 6:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 20, 17, 12, 0, false);        // UTC: 5:12 PM Local: 1:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 8, 5, 16, 0, false);          // UTC: 5:16 AM Local: 1:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 28, 21, 45, 0, false);        // UTC: 9:45 PM Local: 5:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 1, 22, 52, 0, false);         // UTC: 10:52 PM Local: 6:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 24, 8, 50, 0, false);         // UTC: 8:50 AM Local: 4:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 27, 17, 32, 0, false);        // UTC: 5:32 PM Local: 1:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 24, 11, 1, 0, false);         // UTC: 11:01 AM Local: 7:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 6, 3, 23, 0, false);          // UTC: 3:23 AM Local: 11:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 21, 7, 37, 0, false);         // UTC: 7:37 AM Local: 3:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 7, 1, 4, 0, false);           // UTC: 1:04 AM Local: 9:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 17, 19, 0, 0, false);         // UTC: 7:00 PM Local: 3:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 9, 5, 3, 0, false);           // UTC: 5:03 AM Local: 1:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 3, 3, 59, 0, false);          // UTC: 3:59 AM Local: 11:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 3, 16, 0, 0, false);          // UTC: 4:00 PM Local: 12:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 11, 12, 21, 0, false);        // UTC: 12:21 PM Local: 8:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 16, 2020, 12, 24, 11, 12, 0, false);        // UTC: 11:12 AM Local: 7:12 PM Offset: 08:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
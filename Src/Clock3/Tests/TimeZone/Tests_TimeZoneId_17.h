@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_17_H
+#define TEST_TIMEZONEID_17_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_17_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 17, 13, 51, 0, false);         // UTC: 1:51 PM Local: 10:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 10, 11, 18, 0, false);         // UTC: 11:18 AM Local: 8:18 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 6, 22, 45, 0, false);          // UTC: 10:45 PM Local: 7:45 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 18, 21, 17, 0, false);         // UTC: 9:17 PM Local: 6:17 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 4, 0, 15, 0, false);           // UTC: 12:15 AM Local: 9:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 13, 23, 26, 0, false);         // UTC: 11:26 PM Local: 8:26 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 9, 16, 51, 0, false);          // UTC: 4:51 PM Local: 1:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 11, 20, 54, 0, false);         // UTC: 8:54 PM Local: 5:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 22, 23, 25, 0, false);         // UTC: 11:25 PM Local: 8:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 5, 17, 3, 0, false);           // UTC: 5:03 PM Local: 2:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 5, 6, 9, 0, false);            // UTC: 6:09 AM Local: 3:09 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 29, 22, 34, 0, false);         // UTC: 10:34 PM Local: 7:34 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 18, 21, 13, 0, false);         // UTC: 9:13 PM Local: 6:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 11, 17, 7, 0, false);          // UTC: 5:07 PM Local: 2:07 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 29, 22, 40, 0, false);         // UTC: 10:40 PM Local: 7:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 3, 9, 26, 0, false);           // UTC: 9:26 AM Local: 6:26 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 3, 16, 54, 0, false);          // UTC: 4:54 PM Local: 1:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 16, 20, 38, 0, false);         // UTC: 8:38 PM Local: 5:38 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 5, 21, 51, 0, false);          // UTC: 9:51 PM Local: 6:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 14, 16, 58, 0, false);         // UTC: 4:58 PM Local: 1:58 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 11, 0, 27, 0, false);          // UTC: 12:27 AM Local: 9:27 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 12, 18, 3, 0, false);          // UTC: 6:03 PM Local: 3:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 29, 23, 22, 0, false);         // UTC: 11:22 PM Local: 8:22 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 2, 15, 23, 0, false);          // UTC: 3:23 PM Local: 12:23 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 1, 19, 0, 55, 0, false);          // UTC: 12:55 AM Local: 9:55 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 13, 7, 7, 0, false);           // UTC: 7:07 AM Local: 4:07 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 18, 6, 15, 0, false);          // UTC: 6:15 AM Local: 3:15 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 17, 11, 3, 0, false);          // UTC: 11:03 AM Local: 8:03 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 9, 2, 50, 0, false);           // UTC: 2:50 AM Local: 11:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 9, 6, 47, 0, false);           // UTC: 6:47 AM Local: 3:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 20, 17, 34, 0, false);         // UTC: 5:34 PM Local: 2:34 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 18, 4, 16, 0, false);          // UTC: 4:16 AM Local: 1:16 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 22, 9, 58, 0, false);          // UTC: 9:58 AM Local: 6:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 12, 10, 10, 0, false);         // UTC: 10:10 AM Local: 7:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 11, 3, 58, 0, false);          // UTC: 3:58 AM Local: 12:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 19, 18, 50, 0, false);         // UTC: 6:50 PM Local: 3:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 9, 10, 0, 0, false);           // UTC: 10:00 AM Local: 7:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 2, 11, 1, 0, false);           // UTC: 11:01 AM Local: 8:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 15, 23, 17, 0, false);         // UTC: 11:17 PM Local: 8:17 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 16, 20, 3, 0, false);          // UTC: 8:03 PM Local: 5:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 24, 6, 19, 0, false);          // UTC: 6:19 AM Local: 3:19 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 9, 2, 47, 0, false);           // UTC: 2:47 AM Local: 11:47 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 23, 15, 1, 0, false);          // UTC: 3:01 PM Local: 12:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 20, 18, 33, 0, false);         // UTC: 6:33 PM Local: 3:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 22, 4, 25, 0, false);          // UTC: 4:25 AM Local: 1:25 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 16, 23, 37, 0, false);         // UTC: 11:37 PM Local: 8:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 27, 12, 11, 0, false);         // UTC: 12:11 PM Local: 9:11 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 7, 8, 9, 0, false);            // UTC: 8:09 AM Local: 5:09 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 22, 3, 58, 0, false);          // UTC: 3:58 AM Local: 12:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 2, 7, 1, 53, 0, false);           // UTC: 1:53 AM Local: 10:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 18, 9, 51, 0, false);          // UTC: 9:51 AM Local: 6:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 29, 10, 51, 0, false);         // UTC: 10:51 AM Local: 7:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 11, 1, 10, 0, false);          // UTC: 1:10 AM Local: 10:10 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 30, 13, 5, 0, false);          // UTC: 1:05 PM Local: 10:05 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 23, 9, 53, 0, false);          // UTC: 9:53 AM Local: 6:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 9, 21, 25, 0, false);          // UTC: 9:25 PM Local: 6:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 16, 2, 34, 0, false);          // UTC: 2:34 AM Local: 11:34 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 3, 17, 40, 0, false);          // UTC: 5:40 PM Local: 2:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 8, 7, 34, 0, false);           // UTC: 7:34 AM Local: 4:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 31, 8, 36, 0, false);          // UTC: 8:36 AM Local: 5:36 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 6, 9, 3, 0, false);            // UTC: 9:03 AM Local: 6:03 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 24, 15, 37, 0, false);         // UTC: 3:37 PM Local: 12:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 13, 15, 14, 0, false);         // UTC: 3:14 PM Local: 12:14 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 18, 13, 33, 0, false);         // UTC: 1:33 PM Local: 10:33 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 21, 14, 4, 0, false);          // UTC: 2:04 PM Local: 11:04 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 31, 14, 48, 0, false);         // UTC: 2:48 PM Local: 11:48 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 7, 7, 30, 0, false);           // UTC: 7:30 AM Local: 4:30 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 11, 6, 23, 0, false);          // UTC: 6:23 AM Local: 3:23 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 20, 0, 47, 0, false);          // UTC: 12:47 AM Local: 9:47 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 19, 18, 33, 0, false);         // UTC: 6:33 PM Local: 3:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 14, 1, 57, 0, false);          // UTC: 1:57 AM Local: 10:57 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 27, 10, 37, 0, false);         // UTC: 10:37 AM Local: 7:37 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 6, 17, 14, 0, false);          // UTC: 5:14 PM Local: 2:14 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 20, 10, 23, 0, false);         // UTC: 10:23 AM Local: 7:23 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 3, 6, 6, 19, 0, false);           // UTC: 6:19 AM Local: 3:19 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 14, 11, 28, 0, false);         // UTC: 11:28 AM Local: 8:28 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 19, 2, 33, 0, false);          // UTC: 2:33 AM Local: 11:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 4, 16, 0, 0, false);           // UTC: 4:00 PM Local: 1:00 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 7, 18, 57, 0, false);          // UTC: 6:57 PM Local: 3:57 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 23, 17, 48, 0, false);         // UTC: 5:48 PM Local: 2:48 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 6, 14, 29, 0, false);          // UTC: 2:29 PM Local: 11:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 15, 16, 8, 0, false);          // UTC: 4:08 PM Local: 1:08 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 18, 17, 30, 0, false);         // UTC: 5:30 PM Local: 2:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 15, 0, 18, 0, false);          // UTC: 12:18 AM Local: 9:18 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 9, 5, 0, 0, false);            // UTC: 5:00 AM Local: 2:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 27, 14, 21, 0, false);         // UTC: 2:21 PM Local: 11:21 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 25, 10, 13, 0, false);         // UTC: 10:13 AM Local: 7:13 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 2, 8, 6, 0, false);            // UTC: 8:06 AM Local: 5:06 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 17, 21, 44, 0, false);         // UTC: 9:44 PM Local: 6:44 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 1, 0, 7, 0, false);            // UTC: 12:07 AM Local: 9:07 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 16, 22, 57, 0, false);         // UTC: 10:57 PM Local: 7:57 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 10, 19, 13, 0, false);         // UTC: 7:13 PM Local: 4:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 25, 3, 49, 0, false);          // UTC: 3:49 AM Local: 12:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 30, 0, 29, 0, false);          // UTC: 12:29 AM Local: 9:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 18, 7, 55, 0, false);          // UTC: 7:55 AM Local: 4:55 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 21, 0, 54, 0, false);          // UTC: 12:54 AM Local: 9:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 13, 3, 27, 0, false);          // UTC: 3:27 AM Local: 12:27 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 2, 23, 34, 0, false);          // UTC: 11:34 PM Local: 8:34 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 2, 6, 34, 0, false);           // UTC: 6:34 AM Local: 3:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 4, 9, 8, 22, 0, false);           // UTC: 8:22 AM Local: 5:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 12, 17, 37, 0, false);         // UTC: 5:37 PM Local: 2:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 27, 13, 25, 0, false);         // UTC: 1:25 PM Local: 10:25 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 30, 0, 33, 0, false);          // UTC: 12:33 AM Local: 9:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 25, 10, 5, 0, false);          // UTC: 10:05 AM Local: 7:05 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 25, 23, 53, 0, false);         // UTC: 11:53 PM Local: 8:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 26, 1, 40, 0, false);          // UTC: 1:40 AM Local: 10:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 24, 9, 20, 0, false);          // UTC: 9:20 AM Local: 6:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 11, 3, 21, 0, false);          // UTC: 3:21 AM Local: 12:21 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 5, 17, 53, 0, false);          // UTC: 5:53 PM Local: 2:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 8, 15, 52, 0, false);          // UTC: 3:52 PM Local: 12:52 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 10, 14, 7, 0, false);          // UTC: 2:07 PM Local: 11:07 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 9, 7, 4, 0, false);            // UTC: 7:04 AM Local: 4:04 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 22, 13, 19, 0, false);         // UTC: 1:19 PM Local: 10:19 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 22, 6, 30, 0, false);          // UTC: 6:30 AM Local: 3:30 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 12, 4, 13, 0, false);          // UTC: 4:13 AM Local: 1:13 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 17, 18, 9, 0, false);          // UTC: 6:09 PM Local: 3:09 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 26, 9, 5, 0, false);           // UTC: 9:05 AM Local: 6:05 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 14, 14, 33, 0, false);         // UTC: 2:33 PM Local: 11:33 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 29, 12, 49, 0, false);         // UTC: 12:49 PM Local: 9:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 17, 19, 48, 0, false);         // UTC: 7:48 PM Local: 4:48 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 29, 4, 42, 0, false);          // UTC: 4:42 AM Local: 1:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 18, 4, 10, 0, false);          // UTC: 4:10 AM Local: 1:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 19, 17, 59, 0, false);         // UTC: 5:59 PM Local: 2:59 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 11, 15, 51, 0, false);         // UTC: 3:51 PM Local: 12:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 5, 28, 9, 59, 0, false);          // UTC: 9:59 AM Local: 6:59 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 14, 2, 39, 0, false);          // UTC: 2:39 AM Local: 11:39 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 8, 5, 57, 0, false);           // UTC: 5:57 AM Local: 2:57 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 23, 4, 49, 0, false);          // UTC: 4:49 AM Local: 1:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 8, 13, 35, 0, false);          // UTC: 1:35 PM Local: 10:35 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 11, 17, 48, 0, false);         // UTC: 5:48 PM Local: 2:48 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 15, 16, 51, 0, false);         // UTC: 4:51 PM Local: 1:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 5, 9, 15, 0, false);           // UTC: 9:15 AM Local: 6:15 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 16, 8, 32, 0, false);          // UTC: 8:32 AM Local: 5:32 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 7, 11, 0, 0, false);           // UTC: 11:00 AM Local: 8:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 21, 3, 21, 0, false);          // UTC: 3:21 AM Local: 12:21 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 16, 2, 27, 0, false);          // UTC: 2:27 AM Local: 11:27 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 3, 16, 24, 0, false);          // UTC: 4:24 PM Local: 1:24 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 8, 5, 4, 0, false);            // UTC: 5:04 AM Local: 2:04 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 30, 9, 4, 0, false);           // UTC: 9:04 AM Local: 6:04 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 10, 10, 58, 0, false);         // UTC: 10:58 AM Local: 7:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 25, 14, 20, 0, false);         // UTC: 2:20 PM Local: 11:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 5, 4, 47, 0, false);           // UTC: 4:47 AM Local: 1:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 9, 9, 24, 0, false);           // UTC: 9:24 AM Local: 6:24 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 28, 10, 58, 0, false);         // UTC: 10:58 AM Local: 7:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 19, 16, 40, 0, false);         // UTC: 4:40 PM Local: 1:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 5, 13, 6, 0, false);           // UTC: 1:06 PM Local: 10:06 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 27, 20, 40, 0, false);         // UTC: 8:40 PM Local: 5:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 25, 8, 15, 0, false);          // UTC: 8:15 AM Local: 5:15 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 7, 6, 34, 0, false);           // UTC: 6:34 AM Local: 3:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 6, 28, 11, 53, 0, false);         // UTC: 11:53 AM Local: 8:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 24, 13, 24, 0, false);         // UTC: 1:24 PM Local: 10:24 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 9, 2, 19, 0, false);           // UTC: 2:19 AM Local: 11:19 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 13, 20, 13, 0, false);         // UTC: 8:13 PM Local: 5:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 29, 10, 0, 0, false);          // UTC: 10:00 AM Local: 7:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 2, 18, 37, 0, false);          // UTC: 6:37 PM Local: 3:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 2, 11, 43, 0, false);          // UTC: 11:43 AM Local: 8:43 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 21, 15, 25, 0, false);         // UTC: 3:25 PM Local: 12:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 14, 19, 16, 0, false);         // UTC: 7:16 PM Local: 4:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 23, 9, 28, 0, false);          // UTC: 9:28 AM Local: 6:28 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 29, 5, 48, 0, false);          // UTC: 5:48 AM Local: 2:48 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 14, 6, 12, 0, false);          // UTC: 6:12 AM Local: 3:12 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 7, 11, 47, 0, false);          // UTC: 11:47 AM Local: 8:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 29, 22, 12, 0, false);         // UTC: 10:12 PM Local: 7:12 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 8, 20, 53, 0, false);          // UTC: 8:53 PM Local: 5:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 13, 2, 29, 0, false);          // UTC: 2:29 AM Local: 11:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 22, 6, 22, 0, false);          // UTC: 6:22 AM Local: 3:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 24, 16, 50, 0, false);         // UTC: 4:50 PM Local: 1:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 5, 18, 30, 0, false);          // UTC: 6:30 PM Local: 3:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 24, 14, 52, 0, false);         // UTC: 2:52 PM Local: 11:52 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 21, 2, 8, 0, false);           // UTC: 2:08 AM Local: 11:08 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 8, 13, 49, 0, false);          // UTC: 1:49 PM Local: 10:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 13, 7, 43, 0, false);          // UTC: 7:43 AM Local: 4:43 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 13, 12, 31, 0, false);         // UTC: 12:31 PM Local: 9:31 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 11, 22, 50, 0, false);         // UTC: 10:50 PM Local: 7:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 7, 8, 10, 24, 0, false);          // UTC: 10:24 AM Local: 7:24 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 30, 6, 54, 0, false);          // UTC: 6:54 AM Local: 3:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 6, 15, 0, 0, false);           // UTC: 3:00 PM Local: 12:00 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 16, 3, 26, 0, false);          // UTC: 3:26 AM Local: 12:26 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 28, 20, 30, 0, false);         // UTC: 8:30 PM Local: 5:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 4, 5, 31, 0, false);           // UTC: 5:31 AM Local: 2:31 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 1, 8, 30, 0, false);           // UTC: 8:30 AM Local: 5:30 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 5, 6, 10, 0, false);           // UTC: 6:10 AM Local: 3:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 9, 4, 2, 0, false);            // UTC: 4:02 AM Local: 1:02 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 28, 3, 18, 0, false);          // UTC: 3:18 AM Local: 12:18 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 15, 1, 5, 0, false);           // UTC: 1:05 AM Local: 10:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 29, 9, 54, 0, false);          // UTC: 9:54 AM Local: 6:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 20, 20, 16, 0, false);         // UTC: 8:16 PM Local: 5:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 18, 9, 41, 0, false);          // UTC: 9:41 AM Local: 6:41 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 13, 16, 16, 0, false);         // UTC: 4:16 PM Local: 1:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 26, 18, 2, 0, false);          // UTC: 6:02 PM Local: 3:02 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 25, 20, 1, 0, false);          // UTC: 8:01 PM Local: 5:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 23, 17, 18, 0, false);         // UTC: 5:18 PM Local: 2:18 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 18, 19, 58, 0, false);         // UTC: 7:58 PM Local: 4:58 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 3, 22, 3, 0, false);           // UTC: 10:03 PM Local: 7:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 9, 9, 39, 0, false);           // UTC: 9:39 AM Local: 6:39 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 12, 15, 13, 0, false);         // UTC: 3:13 PM Local: 12:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 25, 16, 6, 0, false);          // UTC: 4:06 PM Local: 1:06 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 2, 11, 23, 0, false);          // UTC: 11:23 AM Local: 8:23 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 16, 14, 21, 0, false);         // UTC: 2:21 PM Local: 11:21 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 8, 26, 15, 23, 0, false);         // UTC: 3:23 PM Local: 12:23 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 8, 0, 38, 0, false);           // UTC: 12:38 AM Local: 9:38 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 26, 3, 22, 0, false);          // UTC: 3:22 AM Local: 12:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 17, 4, 54, 0, false);          // UTC: 4:54 AM Local: 1:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 13, 3, 39, 0, false);          // UTC: 3:39 AM Local: 12:39 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 18, 2, 2, 0, false);           // UTC: 2:02 AM Local: 11:02 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 23, 12, 7, 0, false);          // UTC: 12:07 PM Local: 9:07 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 22, 23, 29, 0, false);         // UTC: 11:29 PM Local: 8:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 5, 20, 12, 0, false);          // UTC: 8:12 PM Local: 5:12 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 18, 14, 3, 0, false);          // UTC: 2:03 PM Local: 11:03 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 22, 8, 1, 0, false);           // UTC: 8:01 AM Local: 5:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 19, 3, 49, 0, false);          // UTC: 3:49 AM Local: 12:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 4, 4, 30, 0, false);           // UTC: 4:30 AM Local: 1:30 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 8, 9, 50, 0, false);           // UTC: 9:50 AM Local: 6:50 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 21, 9, 19, 0, false);          // UTC: 9:19 AM Local: 6:19 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 20, 10, 35, 0, false);         // UTC: 10:35 AM Local: 7:35 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 1, 13, 5, 0, false);           // UTC: 1:05 PM Local: 10:05 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 13, 0, 40, 0, false);          // UTC: 12:40 AM Local: 9:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 15, 3, 56, 0, false);          // UTC: 3:56 AM Local: 12:56 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 11, 17, 48, 0, false);         // UTC: 5:48 PM Local: 2:48 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 11, 23, 29, 0, false);         // UTC: 11:29 PM Local: 8:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 30, 1, 55, 0, false);          // UTC: 1:55 AM Local: 10:55 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 16, 2, 34, 0, false);          // UTC: 2:34 AM Local: 11:34 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 21, 14, 19, 0, false);         // UTC: 2:19 PM Local: 11:19 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 20, 3, 46, 0, false);          // UTC: 3:46 AM Local: 12:46 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 9, 28, 18, 53, 0, false);         // UTC: 6:53 PM Local: 3:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 22, 4, 48, 0, false);         // UTC: 4:48 AM Local: 1:48 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 31, 2, 43, 0, false);         // UTC: 2:43 AM Local: 11:43 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 11, 21, 2, 0, false);         // UTC: 9:02 PM Local: 6:02 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 28, 4, 53, 0, false);         // UTC: 4:53 AM Local: 1:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 30, 18, 43, 0, false);        // UTC: 6:43 PM Local: 3:43 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 7, 9, 47, 0, false);          // UTC: 9:47 AM Local: 6:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 14, 2, 6, 0, false);          // UTC: 2:06 AM Local: 11:06 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 27, 12, 51, 0, false);        // UTC: 12:51 PM Local: 9:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 2, 15, 32, 0, false);         // UTC: 3:32 PM Local: 12:32 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 14, 13, 51, 0, false);        // UTC: 1:51 PM Local: 10:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 25, 21, 16, 0, false);        // UTC: 9:16 PM Local: 6:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 19, 7, 36, 0, false);         // UTC: 7:36 AM Local: 4:36 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 17, 23, 25, 0, false);        // UTC: 11:25 PM Local: 8:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 20, 4, 49, 0, false);         // UTC: 4:49 AM Local: 1:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 24, 7, 55, 0, false);         // UTC: 7:55 AM Local: 4:55 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 11, 7, 42, 0, false);         // UTC: 7:42 AM Local: 4:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 11, 15, 20, 0, false);        // UTC: 3:20 PM Local: 12:20 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 26, 6, 39, 0, false);         // UTC: 6:39 AM Local: 3:39 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 4, 6, 48, 0, false);          // UTC: 6:48 AM Local: 3:48 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 17, 14, 13, 0, false);        // UTC: 2:13 PM Local: 11:13 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 15, 13, 23, 0, false);        // UTC: 1:23 PM Local: 10:23 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 27, 13, 39, 0, false);        // UTC: 1:39 PM Local: 10:39 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 2, 6, 7, 0, false);           // UTC: 6:07 AM Local: 3:07 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 8, 0, 16, 0, false);          // UTC: 12:16 AM Local: 9:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 10, 2, 8, 55, 0, false);          // UTC: 8:55 AM Local: 5:55 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 23, 11, 53, 0, false);        // UTC: 11:53 AM Local: 8:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 14, 12, 45, 0, false);        // UTC: 12:45 PM Local: 9:45 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 2, 17, 35, 0, false);         // UTC: 5:35 PM Local: 2:35 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 17, 0, 1, 0, false);          // UTC: 12:01 AM Local: 9:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 21, 17, 48, 0, false);        // UTC: 5:48 PM Local: 2:48 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 11, 22, 37, 0, false);        // UTC: 10:37 PM Local: 7:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 11, 21, 56, 0, false);        // UTC: 9:56 PM Local: 6:56 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 6, 11, 37, 0, false);         // UTC: 11:37 AM Local: 8:37 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 20, 21, 20, 0, false);        // UTC: 9:20 PM Local: 6:20 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 20, 7, 52, 0, false);         // UTC: 7:52 AM Local: 4:52 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 9, 18, 28, 0, false);         // UTC: 6:28 PM Local: 3:28 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 30, 14, 7, 0, false);         // UTC: 2:07 PM Local: 11:07 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 5, 0, 57, 0, false);          // UTC: 12:57 AM Local: 9:57 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 5, 14, 32, 0, false);         // UTC: 2:32 PM Local: 11:32 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 5, 22, 28, 0, false);         // UTC: 10:28 PM Local: 7:28 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 30, 18, 0, 0, false);         // UTC: 6:00 PM Local: 3:00 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 29, 0, 11, 0, false);         // UTC: 12:11 AM Local: 9:11 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 13, 12, 42, 0, false);        // UTC: 12:42 PM Local: 9:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 23, 12, 6, 0, false);         // UTC: 12:06 PM Local: 9:06 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 9, 6, 12, 0, false);          // UTC: 6:12 AM Local: 3:12 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 5, 22, 1, 0, false);          // UTC: 10:01 PM Local: 7:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 20, 14, 20, 0, false);        // UTC: 2:20 PM Local: 11:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 5, 15, 14, 0, false);         // UTC: 3:14 PM Local: 12:14 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 14, 22, 23, 0, false);        // UTC: 10:23 PM Local: 7:23 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 11, 9, 22, 46, 0, false);         // UTC: 10:46 PM Local: 7:46 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 29, 14, 30, 0, false);        // UTC: 2:30 PM Local: 11:30 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 3, 5, 6, 0, false);           // UTC: 5:06 AM Local: 2:06 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 8, 15, 15, 0, false);         // UTC: 3:15 PM Local: 12:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 10, 3, 16, 0, false);         // UTC: 3:16 AM Local: 12:16 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 17, 23, 37, 0, false);        // UTC: 11:37 PM Local: 8:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 9, 10, 28, 0, false);         // UTC: 10:28 AM Local: 7:28 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 9, 16, 25, 0, false);         // UTC: 4:25 PM Local: 1:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 1, 14, 51, 0, false);         // UTC: 2:51 PM Local: 11:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 29, 8, 47, 0, false);         // UTC: 8:47 AM Local: 5:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 6, 16, 13, 0, false);         // UTC: 4:13 PM Local: 1:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 7, 3, 2, 0, false);           // UTC: 3:02 AM Local: 12:02 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 12, 3, 45, 0, false);         // UTC: 3:45 AM Local: 12:45 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 2, 6, 22, 0, false);          // UTC: 6:22 AM Local: 3:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 25, 10, 14, 0, false);        // UTC: 10:14 AM Local: 7:14 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 7, 16, 11, 0, false);         // UTC: 4:11 PM Local: 1:11 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 6, 18, 38, 0, false);         // UTC: 6:38 PM Local: 3:38 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 20, 0, 31, 0, false);         // UTC: 12:31 AM Local: 9:31 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 30, 1, 45, 0, false);         // UTC: 1:45 AM Local: 10:45 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 25, 20, 29, 0, false);        // UTC: 8:29 PM Local: 5:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 14, 13, 21, 0, false);        // UTC: 1:21 PM Local: 10:21 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 17, 17, 29, 0, false);        // UTC: 5:29 PM Local: 2:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 19, 1, 1, 0, false);          // UTC: 1:01 AM Local: 10:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 3, 2, 39, 0, false);          // UTC: 2:39 AM Local: 11:39 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 6, 9, 48, 0, false);          // UTC: 9:48 AM Local: 6:48 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2018, 12, 19, 12, 41, 0, false);        // UTC: 12:41 PM Local: 9:41 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 2, 4, 52, 0, false);           // UTC: 4:52 AM Local: 1:52 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 10, 5, 51, 0, false);          // UTC: 5:51 AM Local: 2:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 11, 23, 10, 0, false);         // UTC: 11:10 PM Local: 8:10 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 30, 23, 54, 0, false);         // UTC: 11:54 PM Local: 8:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 11, 10, 31, 0, false);         // UTC: 10:31 AM Local: 7:31 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 8, 18, 29, 0, false);          // UTC: 6:29 PM Local: 3:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 31, 9, 41, 0, false);          // UTC: 9:41 AM Local: 6:41 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 24, 20, 45, 0, false);         // UTC: 8:45 PM Local: 5:45 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 14, 6, 10, 0, false);          // UTC: 6:10 AM Local: 3:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 19, 19, 27, 0, false);         // UTC: 7:27 PM Local: 4:27 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 30, 9, 29, 0, false);          // UTC: 9:29 AM Local: 6:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 18, 9, 40, 0, false);          // UTC: 9:40 AM Local: 6:40 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 2, 22, 49, 0, false);          // UTC: 10:49 PM Local: 7:49 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 26, 16, 47, 0, false);         // UTC: 4:47 PM Local: 1:47 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 11, 4, 20, 0, false);          // UTC: 4:20 AM Local: 1:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 2, 0, 46, 0, false);           // UTC: 12:46 AM Local: 9:46 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 31, 9, 50, 0, false);          // UTC: 9:50 AM Local: 6:50 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 4, 2, 23, 0, false);           // UTC: 2:23 AM Local: 11:23 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 19, 3, 32, 0, false);          // UTC: 3:32 AM Local: 12:32 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 7, 2, 51, 0, false);           // UTC: 2:51 AM Local: 11:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 25, 11, 10, 0, false);         // UTC: 11:10 AM Local: 8:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 16, 19, 30, 0, false);         // UTC: 7:30 PM Local: 4:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 11, 4, 52, 0, false);          // UTC: 4:52 AM Local: 1:52 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 15, 15, 13, 0, false);         // UTC: 3:13 PM Local: 12:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 1, 20, 7, 51, 0, false);          // UTC: 7:51 AM Local: 4:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 14, 0, 50, 0, false);          // UTC: 12:50 AM Local: 9:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 8, 17, 57, 0, false);          // UTC: 5:57 PM Local: 2:57 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 27, 6, 49, 0, false);          // UTC: 6:49 AM Local: 3:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 17, 20, 4, 0, false);          // UTC: 8:04 PM Local: 5:04 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 14, 18, 15, 0, false);         // UTC: 6:15 PM Local: 3:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 16, 8, 37, 0, false);          // UTC: 8:37 AM Local: 5:37 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 10, 17, 11, 0, false);         // UTC: 5:11 PM Local: 2:11 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 11, 14, 9, 0, false);          // UTC: 2:09 PM Local: 11:09 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 22, 10, 49, 0, false);         // UTC: 10:49 AM Local: 7:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 9, 8, 4, 0, false);            // UTC: 8:04 AM Local: 5:04 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 24, 15, 16, 0, false);         // UTC: 3:16 PM Local: 12:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 15, 12, 51, 0, false);         // UTC: 12:51 PM Local: 9:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 22, 0, 33, 0, false);          // UTC: 12:33 AM Local: 9:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 25, 5, 26, 0, false);          // UTC: 5:26 AM Local: 2:26 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 22, 10, 0, 0, false);          // UTC: 10:00 AM Local: 7:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 7, 20, 47, 0, false);          // UTC: 8:47 PM Local: 5:47 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 2, 15, 18, 0, false);          // UTC: 3:18 PM Local: 12:18 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 4, 19, 51, 0, false);          // UTC: 7:51 PM Local: 4:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 21, 20, 23, 0, false);         // UTC: 8:23 PM Local: 5:23 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 9, 16, 23, 0, false);          // UTC: 4:23 PM Local: 1:23 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 23, 9, 44, 0, false);          // UTC: 9:44 AM Local: 6:44 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 8, 1, 15, 0, false);           // UTC: 1:15 AM Local: 10:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 1, 15, 4, 0, false);           // UTC: 3:04 PM Local: 12:04 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 25, 13, 52, 0, false);         // UTC: 1:52 PM Local: 10:52 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 2, 2, 12, 41, 0, false);          // UTC: 12:41 PM Local: 9:41 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 31, 23, 22, 0, false);         // UTC: 11:22 PM Local: 8:22 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 28, 19, 52, 0, false);         // UTC: 7:52 PM Local: 4:52 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 8, 19, 41, 0, false);          // UTC: 7:41 PM Local: 4:41 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 29, 8, 17, 0, false);          // UTC: 8:17 AM Local: 5:17 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 30, 16, 18, 0, false);         // UTC: 4:18 PM Local: 1:18 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 19, 17, 52, 0, false);         // UTC: 5:52 PM Local: 2:52 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 2, 0, 16, 0, false);           // UTC: 12:16 AM Local: 9:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 31, 20, 51, 0, false);         // UTC: 8:51 PM Local: 5:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 12, 0, 44, 0, false);          // UTC: 12:44 AM Local: 9:44 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 19, 23, 14, 0, false);         // UTC: 11:14 PM Local: 8:14 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 18, 4, 43, 0, false);          // UTC: 4:43 AM Local: 1:43 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 15, 1, 59, 0, false);          // UTC: 1:59 AM Local: 10:59 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 27, 10, 51, 0, false);         // UTC: 10:51 AM Local: 7:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 3, 19, 49, 0, false);          // UTC: 7:49 PM Local: 4:49 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 20, 11, 2, 0, false);          // UTC: 11:02 AM Local: 8:02 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 7, 9, 32, 0, false);           // UTC: 9:32 AM Local: 6:32 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 26, 8, 35, 0, false);          // UTC: 8:35 AM Local: 5:35 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 24, 6, 32, 0, false);          // UTC: 6:32 AM Local: 3:32 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 1, 11, 27, 0, false);          // UTC: 11:27 AM Local: 8:27 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 4, 8, 49, 0, false);           // UTC: 8:49 AM Local: 5:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 31, 23, 56, 0, false);         // UTC: 11:56 PM Local: 8:56 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 22, 23, 58, 0, false);         // UTC: 11:58 PM Local: 8:58 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 19, 8, 40, 0, false);          // UTC: 8:40 AM Local: 5:40 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 30, 17, 32, 0, false);         // UTC: 5:32 PM Local: 2:32 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 3, 18, 12, 34, 0, false);         // UTC: 12:34 PM Local: 9:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 19, 6, 39, 0, false);          // UTC: 6:39 AM Local: 3:39 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 5, 9, 3, 0, false);            // UTC: 9:03 AM Local: 6:03 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 19, 22, 58, 0, false);         // UTC: 10:58 PM Local: 7:58 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 6, 14, 55, 0, false);          // UTC: 2:55 PM Local: 11:55 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 20, 20, 55, 0, false);         // UTC: 8:55 PM Local: 5:55 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 10, 3, 57, 0, false);          // UTC: 3:57 AM Local: 12:57 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 6, 2, 3, 0, false);            // UTC: 2:03 AM Local: 11:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 7, 6, 50, 0, false);           // UTC: 6:50 AM Local: 3:50 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 8, 11, 33, 0, false);          // UTC: 11:33 AM Local: 8:33 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 30, 9, 31, 0, false);          // UTC: 9:31 AM Local: 6:31 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 1, 2, 59, 0, false);           // UTC: 2:59 AM Local: 11:59 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 14, 17, 28, 0, false);         // UTC: 5:28 PM Local: 2:28 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 19, 22, 44, 0, false);         // UTC: 10:44 PM Local: 7:44 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 22, 5, 6, 0, false);           // UTC: 5:06 AM Local: 2:06 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 21, 10, 31, 0, false);         // UTC: 10:31 AM Local: 7:31 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 13, 22, 33, 0, false);         // UTC: 10:33 PM Local: 7:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 1, 16, 26, 0, false);          // UTC: 4:26 PM Local: 1:26 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 15, 6, 39, 0, false);          // UTC: 6:39 AM Local: 3:39 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 30, 0, 7, 0, false);           // UTC: 12:07 AM Local: 9:07 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 1, 8, 20, 0, false);           // UTC: 8:20 AM Local: 5:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 20, 6, 11, 0, false);          // UTC: 6:11 AM Local: 3:11 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 22, 18, 38, 0, false);         // UTC: 6:38 PM Local: 3:38 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 7, 12, 45, 0, false);          // UTC: 12:45 PM Local: 9:45 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 24, 3, 53, 0, false);          // UTC: 3:53 AM Local: 12:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 4, 9, 21, 13, 0, false);          // UTC: 9:13 PM Local: 6:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 7, 8, 8, 0, false);            // UTC: 8:08 AM Local: 5:08 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 12, 17, 59, 0, false);         // UTC: 5:59 PM Local: 2:59 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 22, 4, 58, 0, false);          // UTC: 4:58 AM Local: 1:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 17, 9, 57, 0, false);          // UTC: 9:57 AM Local: 6:57 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 3, 2, 40, 0, false);           // UTC: 2:40 AM Local: 11:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 16, 9, 40, 0, false);          // UTC: 9:40 AM Local: 6:40 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 18, 13, 26, 0, false);         // UTC: 1:26 PM Local: 10:26 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 30, 10, 37, 0, false);         // UTC: 10:37 AM Local: 7:37 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 7, 16, 44, 0, false);          // UTC: 4:44 PM Local: 1:44 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 31, 7, 15, 0, false);          // UTC: 7:15 AM Local: 4:15 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 10, 8, 24, 0, false);          // UTC: 8:24 AM Local: 5:24 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 31, 9, 10, 0, false);          // UTC: 9:10 AM Local: 6:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 7, 19, 25, 0, false);          // UTC: 7:25 PM Local: 4:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 21, 17, 21, 0, false);         // UTC: 5:21 PM Local: 2:21 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 8, 8, 49, 0, false);           // UTC: 8:49 AM Local: 5:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 1, 6, 21, 0, false);           // UTC: 6:21 AM Local: 3:21 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 17, 11, 43, 0, false);         // UTC: 11:43 AM Local: 8:43 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 29, 9, 29, 0, false);          // UTC: 9:29 AM Local: 6:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 12, 12, 33, 0, false);         // UTC: 12:33 PM Local: 9:33 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 13, 8, 40, 0, false);          // UTC: 8:40 AM Local: 5:40 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 29, 5, 13, 0, false);          // UTC: 5:13 AM Local: 2:13 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 2, 19, 16, 0, false);          // UTC: 7:16 PM Local: 4:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 19, 18, 26, 0, false);         // UTC: 6:26 PM Local: 3:26 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 12, 7, 10, 0, false);          // UTC: 7:10 AM Local: 4:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 5, 11, 17, 50, 0, false);         // UTC: 5:50 PM Local: 2:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 16, 1, 15, 0, false);          // UTC: 1:15 AM Local: 10:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 6, 6, 43, 0, false);           // UTC: 6:43 AM Local: 3:43 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 7, 3, 7, 0, false);            // UTC: 3:07 AM Local: 12:07 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 28, 16, 27, 0, false);         // UTC: 4:27 PM Local: 1:27 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 11, 22, 43, 0, false);         // UTC: 10:43 PM Local: 7:43 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 2, 7, 8, 0, false);            // UTC: 7:08 AM Local: 4:08 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 17, 4, 22, 0, false);          // UTC: 4:22 AM Local: 1:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 9, 0, 13, 0, false);           // UTC: 12:13 AM Local: 9:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 12, 13, 37, 0, false);         // UTC: 1:37 PM Local: 10:37 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 23, 20, 5, 0, false);          // UTC: 8:05 PM Local: 5:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 30, 23, 16, 0, false);         // UTC: 11:16 PM Local: 8:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 11, 2, 26, 0, false);          // UTC: 2:26 AM Local: 11:26 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 27, 11, 23, 0, false);         // UTC: 11:23 AM Local: 8:23 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 8, 6, 20, 0, false);           // UTC: 6:20 AM Local: 3:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 5, 22, 30, 0, false);          // UTC: 10:30 PM Local: 7:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 14, 1, 3, 0, false);           // UTC: 1:03 AM Local: 10:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 6, 13, 42, 0, false);          // UTC: 1:42 PM Local: 10:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 2, 1, 36, 0, false);           // UTC: 1:36 AM Local: 10:36 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 3, 10, 33, 0, false);          // UTC: 10:33 AM Local: 7:33 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 26, 13, 44, 0, false);         // UTC: 1:44 PM Local: 10:44 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 6, 18, 57, 0, false);          // UTC: 6:57 PM Local: 3:57 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 20, 11, 22, 0, false);         // UTC: 11:22 AM Local: 8:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 9, 1, 1, 0, false);            // UTC: 1:01 AM Local: 10:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 14, 15, 32, 0, false);         // UTC: 3:32 PM Local: 12:32 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 6, 21, 5, 1, 0, false);           // UTC: 5:01 AM Local: 2:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 30, 21, 20, 0, false);         // UTC: 9:20 PM Local: 6:20 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 8, 4, 39, 0, false);           // UTC: 4:39 AM Local: 1:39 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 3, 5, 40, 0, false);           // UTC: 5:40 AM Local: 2:40 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 17, 1, 27, 0, false);          // UTC: 1:27 AM Local: 10:27 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 16, 19, 15, 0, false);         // UTC: 7:15 PM Local: 4:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 2, 10, 4, 0, false);           // UTC: 10:04 AM Local: 7:04 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 8, 0, 1, 0, false);            // UTC: 12:01 AM Local: 9:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 21, 0, 58, 0, false);          // UTC: 12:58 AM Local: 9:58 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 29, 18, 9, 0, false);          // UTC: 6:09 PM Local: 3:09 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 19, 2, 21, 0, false);          // UTC: 2:21 AM Local: 11:21 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 21, 6, 20, 0, false);          // UTC: 6:20 AM Local: 3:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 27, 17, 47, 0, false);         // UTC: 5:47 PM Local: 2:47 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 1, 1, 30, 0, false);           // UTC: 1:30 AM Local: 10:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 20, 4, 11, 0, false);          // UTC: 4:11 AM Local: 1:11 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 28, 4, 54, 0, false);          // UTC: 4:54 AM Local: 1:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 25, 13, 48, 0, false);         // UTC: 1:48 PM Local: 10:48 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 3, 16, 3, 0, false);           // UTC: 4:03 PM Local: 1:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 24, 21, 21, 0, false);         // UTC: 9:21 PM Local: 6:21 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 26, 7, 52, 0, false);          // UTC: 7:52 AM Local: 4:52 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 11, 6, 17, 0, false);          // UTC: 6:17 AM Local: 3:17 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 28, 18, 31, 0, false);         // UTC: 6:31 PM Local: 3:31 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 25, 20, 51, 0, false);         // UTC: 8:51 PM Local: 5:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 18, 21, 41, 0, false);         // UTC: 9:41 PM Local: 6:41 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 7, 17, 45, 0, false);          // UTC: 5:45 PM Local: 2:45 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 7, 7, 7, 28, 0, false);           // UTC: 7:28 AM Local: 4:28 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 5, 4, 27, 0, false);           // UTC: 4:27 AM Local: 1:27 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 15, 15, 25, 0, false);         // UTC: 3:25 PM Local: 12:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 4, 21, 44, 0, false);          // UTC: 9:44 PM Local: 6:44 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 25, 3, 40, 0, false);          // UTC: 3:40 AM Local: 12:40 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 13, 5, 45, 0, false);          // UTC: 5:45 AM Local: 2:45 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 21, 19, 43, 0, false);         // UTC: 7:43 PM Local: 4:43 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 25, 8, 18, 0, false);          // UTC: 8:18 AM Local: 5:18 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 4, 21, 3, 0, false);           // UTC: 9:03 PM Local: 6:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 7, 22, 10, 0, false);          // UTC: 10:10 PM Local: 7:10 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 30, 16, 1, 0, false);          // UTC: 4:01 PM Local: 1:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 28, 13, 10, 0, false);         // UTC: 1:10 PM Local: 10:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 26, 5, 54, 0, false);          // UTC: 5:54 AM Local: 2:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 5, 5, 23, 0, false);           // UTC: 5:23 AM Local: 2:23 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 12, 1, 19, 0, false);          // UTC: 1:19 AM Local: 10:19 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 13, 20, 47, 0, false);         // UTC: 8:47 PM Local: 5:47 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 30, 8, 2, 0, false);           // UTC: 8:02 AM Local: 5:02 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 21, 8, 36, 0, false);          // UTC: 8:36 AM Local: 5:36 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 16, 9, 34, 0, false);          // UTC: 9:34 AM Local: 6:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 6, 16, 45, 0, false);          // UTC: 4:45 PM Local: 1:45 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 23, 7, 32, 0, false);          // UTC: 7:32 AM Local: 4:32 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 3, 1, 37, 0, false);           // UTC: 1:37 AM Local: 10:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 19, 16, 53, 0, false);         // UTC: 4:53 PM Local: 1:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 9, 11, 41, 0, false);          // UTC: 11:41 AM Local: 8:41 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 16, 13, 26, 0, false);         // UTC: 1:26 PM Local: 10:26 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 8, 6, 1, 15, 0, false);           // UTC: 1:15 AM Local: 10:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 26, 15, 55, 0, false);         // UTC: 3:55 PM Local: 12:55 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 25, 1, 30, 0, false);          // UTC: 1:30 AM Local: 10:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 9, 1, 5, 0, false);            // UTC: 1:05 AM Local: 10:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 10, 17, 34, 0, false);         // UTC: 5:34 PM Local: 2:34 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 13, 5, 56, 0, false);          // UTC: 5:56 AM Local: 2:56 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 21, 9, 3, 0, false);           // UTC: 9:03 AM Local: 6:03 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 4, 17, 29, 0, false);          // UTC: 5:29 PM Local: 2:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 28, 6, 46, 0, false);          // UTC: 6:46 AM Local: 3:46 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 3, 16, 33, 0, false);          // UTC: 4:33 PM Local: 1:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 14, 8, 20, 0, false);          // UTC: 8:20 AM Local: 5:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 1, 11, 22, 0, false);          // UTC: 11:22 AM Local: 8:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 28, 15, 41, 0, false);         // UTC: 3:41 PM Local: 12:41 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 18, 22, 0, 0, false);          // UTC: 10:00 PM Local: 7:00 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 26, 9, 27, 0, false);          // UTC: 9:27 AM Local: 6:27 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 13, 19, 51, 0, false);         // UTC: 7:51 PM Local: 4:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 10, 3, 10, 0, false);          // UTC: 3:10 AM Local: 12:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 9, 23, 58, 0, false);          // UTC: 11:58 PM Local: 8:58 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 17, 7, 14, 0, false);          // UTC: 7:14 AM Local: 4:14 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 13, 16, 20, 0, false);         // UTC: 4:20 PM Local: 1:20 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 5, 4, 20, 0, false);           // UTC: 4:20 AM Local: 1:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 29, 2, 5, 0, false);           // UTC: 2:05 AM Local: 11:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 11, 5, 42, 0, false);          // UTC: 5:42 AM Local: 2:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 5, 10, 33, 0, false);          // UTC: 10:33 AM Local: 7:33 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 10, 13, 38, 0, false);         // UTC: 1:38 PM Local: 10:38 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 9, 22, 6, 40, 0, false);          // UTC: 6:40 AM Local: 3:40 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 7, 12, 39, 0, false);         // UTC: 12:39 PM Local: 9:39 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 25, 21, 6, 0, false);         // UTC: 9:06 PM Local: 6:06 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 27, 12, 0, 0, false);         // UTC: 12:00 PM Local: 9:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 30, 15, 29, 0, false);        // UTC: 3:29 PM Local: 12:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 29, 17, 58, 0, false);        // UTC: 5:58 PM Local: 2:58 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 9, 22, 25, 0, false);         // UTC: 10:25 PM Local: 7:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 30, 15, 9, 0, false);         // UTC: 3:09 PM Local: 12:09 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 25, 12, 19, 0, false);        // UTC: 12:19 PM Local: 9:19 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 16, 10, 58, 0, false);        // UTC: 10:58 AM Local: 7:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 2, 9, 15, 0, false);          // UTC: 9:15 AM Local: 6:15 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 7, 20, 49, 0, false);         // UTC: 8:49 PM Local: 5:49 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 21, 17, 36, 0, false);        // UTC: 5:36 PM Local: 2:36 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 26, 1, 5, 0, false);          // UTC: 1:05 AM Local: 10:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 14, 13, 58, 0, false);        // UTC: 1:58 PM Local: 10:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 14, 8, 34, 0, false);         // UTC: 8:34 AM Local: 5:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 31, 6, 49, 0, false);         // UTC: 6:49 AM Local: 3:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 9, 12, 54, 0, false);         // UTC: 12:54 PM Local: 9:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 8, 13, 13, 0, false);         // UTC: 1:13 PM Local: 10:13 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 18, 7, 39, 0, false);         // UTC: 7:39 AM Local: 4:39 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 17, 18, 26, 0, false);        // UTC: 6:26 PM Local: 3:26 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 5, 20, 59, 0, false);         // UTC: 8:59 PM Local: 5:59 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 11, 6, 10, 0, false);         // UTC: 6:10 AM Local: 3:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 22, 14, 56, 0, false);        // UTC: 2:56 PM Local: 11:56 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 7, 1, 30, 0, false);          // UTC: 1:30 AM Local: 10:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 10, 22, 11, 42, 0, false);        // UTC: 11:42 AM Local: 8:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 6, 9, 41, 0, false);          // UTC: 9:41 AM Local: 6:41 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 29, 9, 56, 0, false);         // UTC: 9:56 AM Local: 6:56 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 19, 10, 13, 0, false);        // UTC: 10:13 AM Local: 7:13 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 29, 14, 58, 0, false);        // UTC: 2:58 PM Local: 11:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 22, 1, 10, 0, false);         // UTC: 1:10 AM Local: 10:10 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 19, 12, 28, 0, false);        // UTC: 12:28 PM Local: 9:28 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 25, 9, 54, 0, false);         // UTC: 9:54 AM Local: 6:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 5, 7, 32, 0, false);          // UTC: 7:32 AM Local: 4:32 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 11, 15, 54, 0, false);        // UTC: 3:54 PM Local: 12:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 14, 6, 0, 0, false);          // UTC: 6:00 AM Local: 3:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 9, 21, 53, 0, false);         // UTC: 9:53 PM Local: 6:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 13, 9, 49, 0, false);         // UTC: 9:49 AM Local: 6:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 1, 13, 53, 0, false);         // UTC: 1:53 PM Local: 10:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 5, 9, 14, 0, false);          // UTC: 9:14 AM Local: 6:14 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 21, 11, 54, 0, false);        // UTC: 11:54 AM Local: 8:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 26, 6, 5, 0, false);          // UTC: 6:05 AM Local: 3:05 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 26, 19, 17, 0, false);        // UTC: 7:17 PM Local: 4:17 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 19, 21, 29, 0, false);        // UTC: 9:29 PM Local: 6:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 10, 23, 49, 0, false);        // UTC: 11:49 PM Local: 8:49 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 23, 21, 42, 0, false);        // UTC: 9:42 PM Local: 6:42 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 7, 16, 26, 0, false);         // UTC: 4:26 PM Local: 1:26 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 14, 0, 40, 0, false);         // UTC: 12:40 AM Local: 9:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 10, 3, 20, 0, false);         // UTC: 3:20 AM Local: 12:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 4, 0, 37, 0, false);          // UTC: 12:37 AM Local: 9:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 11, 23, 4, 29, 0, false);         // UTC: 4:29 AM Local: 1:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 3, 7, 28, 0, false);          // UTC: 7:28 AM Local: 4:28 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 12, 9, 37, 0, false);         // UTC: 9:37 AM Local: 6:37 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 16, 15, 30, 0, false);        // UTC: 3:30 PM Local: 12:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 4, 21, 4, 0, false);          // UTC: 9:04 PM Local: 6:04 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 6, 1, 59, 0, false);          // UTC: 1:59 AM Local: 10:59 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 3, 2, 51, 0, false);          // UTC: 2:51 AM Local: 11:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 12, 13, 49, 0, false);        // UTC: 1:49 PM Local: 10:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 15, 2, 37, 0, false);         // UTC: 2:37 AM Local: 11:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 13, 8, 29, 0, false);         // UTC: 8:29 AM Local: 5:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 10, 19, 38, 0, false);        // UTC: 7:38 PM Local: 4:38 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 18, 8, 16, 0, false);         // UTC: 8:16 AM Local: 5:16 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 16, 3, 42, 0, false);         // UTC: 3:42 AM Local: 12:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 12, 9, 27, 0, false);         // UTC: 9:27 AM Local: 6:27 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 31, 13, 16, 0, false);        // UTC: 1:16 PM Local: 10:16 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 11, 3, 2, 0, false);          // UTC: 3:02 AM Local: 12:02 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 26, 20, 18, 0, false);        // UTC: 8:18 PM Local: 5:18 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 30, 16, 32, 0, false);        // UTC: 4:32 PM Local: 1:32 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 27, 0, 8, 0, false);          // UTC: 12:08 AM Local: 9:08 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 15, 14, 34, 0, false);        // UTC: 2:34 PM Local: 11:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 1, 13, 28, 0, false);         // UTC: 1:28 PM Local: 10:28 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 1, 21, 10, 0, false);         // UTC: 9:10 PM Local: 6:10 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 17, 7, 14, 0, false);         // UTC: 7:14 AM Local: 4:14 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 11, 17, 16, 0, false);        // UTC: 5:16 PM Local: 2:16 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 22, 18, 50, 0, false);        // UTC: 6:50 PM Local: 3:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2019, 12, 12, 18, 49, 0, false);        // UTC: 6:49 PM Local: 3:49 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 17, 7, 30, 0, false);          // UTC: 7:30 AM Local: 4:30 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 14, 10, 20, 0, false);         // UTC: 10:20 AM Local: 7:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 13, 5, 18, 0, false);          // UTC: 5:18 AM Local: 2:18 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 1, 22, 34, 0, false);          // UTC: 10:34 PM Local: 7:34 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 2, 13, 31, 0, false);          // UTC: 1:31 PM Local: 10:31 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 30, 19, 45, 0, false);         // UTC: 7:45 PM Local: 4:45 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 28, 8, 59, 0, false);          // UTC: 8:59 AM Local: 5:59 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 9, 14, 42, 0, false);          // UTC: 2:42 PM Local: 11:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 31, 7, 25, 0, false);          // UTC: 7:25 AM Local: 4:25 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 9, 10, 4, 0, false);           // UTC: 10:04 AM Local: 7:04 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 14, 2, 55, 0, false);          // UTC: 2:55 AM Local: 11:55 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 7, 10, 34, 0, false);          // UTC: 10:34 AM Local: 7:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 8, 6, 16, 0, false);           // UTC: 6:16 AM Local: 3:16 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 20, 16, 27, 0, false);         // UTC: 4:27 PM Local: 1:27 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 19, 19, 19, 0, false);         // UTC: 7:19 PM Local: 4:19 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 29, 3, 57, 0, false);          // UTC: 3:57 AM Local: 12:57 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 25, 23, 33, 0, false);         // UTC: 11:33 PM Local: 8:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 31, 7, 47, 0, false);          // UTC: 7:47 AM Local: 4:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 13, 1, 31, 0, false);          // UTC: 1:31 AM Local: 10:31 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 26, 0, 33, 0, false);          // UTC: 12:33 AM Local: 9:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 23, 21, 7, 0, false);          // UTC: 9:07 PM Local: 6:07 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 13, 0, 23, 0, false);          // UTC: 12:23 AM Local: 9:23 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 30, 20, 28, 0, false);         // UTC: 8:28 PM Local: 5:28 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 19, 5, 1, 0, false);           // UTC: 5:01 AM Local: 2:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 1, 8, 20, 55, 0, false);          // UTC: 8:55 PM Local: 5:55 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 25, 9, 1, 0, false);           // UTC: 9:01 AM Local: 6:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 14, 15, 27, 0, false);         // UTC: 3:27 PM Local: 12:27 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 19, 23, 40, 0, false);         // UTC: 11:40 PM Local: 8:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 2, 15, 36, 0, false);          // UTC: 3:36 PM Local: 12:36 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 14, 21, 30, 0, false);         // UTC: 9:30 PM Local: 6:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 24, 2, 19, 0, false);          // UTC: 2:19 AM Local: 11:19 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 8, 21, 15, 0, false);          // UTC: 9:15 PM Local: 6:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 1, 13, 8, 0, false);           // UTC: 1:08 PM Local: 10:08 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 22, 16, 23, 0, false);         // UTC: 4:23 PM Local: 1:23 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 12, 22, 26, 0, false);         // UTC: 10:26 PM Local: 7:26 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 29, 18, 39, 0, false);         // UTC: 6:39 PM Local: 3:39 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 25, 13, 18, 0, false);         // UTC: 1:18 PM Local: 10:18 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 2, 1, 43, 0, false);           // UTC: 1:43 AM Local: 10:43 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 20, 14, 1, 0, false);          // UTC: 2:01 PM Local: 11:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 10, 7, 14, 0, false);          // UTC: 7:14 AM Local: 4:14 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 4, 2, 14, 0, false);           // UTC: 2:14 AM Local: 11:14 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 27, 0, 6, 0, false);           // UTC: 12:06 AM Local: 9:06 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 2, 17, 30, 0, false);          // UTC: 5:30 PM Local: 2:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 29, 13, 0, 0, false);          // UTC: 1:00 PM Local: 10:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 26, 12, 51, 0, false);         // UTC: 12:51 PM Local: 9:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 9, 13, 50, 0, false);          // UTC: 1:50 PM Local: 10:50 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 6, 9, 18, 0, false);           // UTC: 9:18 AM Local: 6:18 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 24, 1, 5, 0, false);           // UTC: 1:05 AM Local: 10:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 18, 18, 13, 0, false);         // UTC: 6:13 PM Local: 3:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 2, 27, 2, 6, 0, false);           // UTC: 2:06 AM Local: 11:06 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 6, 2, 59, 0, false);           // UTC: 2:59 AM Local: 11:59 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 28, 14, 11, 0, false);         // UTC: 2:11 PM Local: 11:11 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 7, 13, 24, 0, false);          // UTC: 1:24 PM Local: 10:24 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 13, 10, 48, 0, false);         // UTC: 10:48 AM Local: 7:48 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 1, 1, 52, 0, false);           // UTC: 1:52 AM Local: 10:52 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 2, 13, 58, 0, false);          // UTC: 1:58 PM Local: 10:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 20, 21, 42, 0, false);         // UTC: 9:42 PM Local: 6:42 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 20, 20, 53, 0, false);         // UTC: 8:53 PM Local: 5:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 3, 17, 37, 0, false);          // UTC: 5:37 PM Local: 2:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 12, 19, 19, 0, false);         // UTC: 7:19 PM Local: 4:19 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 8, 20, 10, 0, false);          // UTC: 8:10 PM Local: 5:10 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 7, 22, 30, 0, false);          // UTC: 10:30 PM Local: 7:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 31, 12, 56, 0, false);         // UTC: 12:56 PM Local: 9:56 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 27, 2, 31, 0, false);          // UTC: 2:31 AM Local: 11:31 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 24, 16, 45, 0, false);         // UTC: 4:45 PM Local: 1:45 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 18, 23, 13, 0, false);         // UTC: 11:13 PM Local: 8:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 13, 2, 30, 0, false);          // UTC: 2:30 AM Local: 11:30 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 27, 4, 8, 0, false);           // UTC: 4:08 AM Local: 1:08 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 29, 11, 14, 0, false);         // UTC: 11:14 AM Local: 8:14 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 4, 20, 39, 0, false);          // UTC: 8:39 PM Local: 5:39 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 9, 9, 42, 0, false);           // UTC: 9:42 AM Local: 6:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 25, 17, 2, 0, false);          // UTC: 5:02 PM Local: 2:02 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 22, 1, 31, 0, false);          // UTC: 1:31 AM Local: 10:31 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 17, 13, 52, 0, false);         // UTC: 1:52 PM Local: 10:52 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 3, 3, 5, 18, 0, false);           // UTC: 5:18 AM Local: 2:18 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 11, 21, 29, 0, false);         // UTC: 9:29 PM Local: 6:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 13, 5, 47, 0, false);          // UTC: 5:47 AM Local: 2:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 4, 18, 51, 0, false);          // UTC: 6:51 PM Local: 3:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 1, 18, 40, 0, false);          // UTC: 6:40 PM Local: 3:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 15, 7, 36, 0, false);          // UTC: 7:36 AM Local: 4:36 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 4, 5, 53, 0, false);           // UTC: 5:53 AM Local: 2:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 30, 4, 29, 0, false);          // UTC: 4:29 AM Local: 1:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 23, 22, 15, 0, false);         // UTC: 10:15 PM Local: 7:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 28, 8, 38, 0, false);          // UTC: 8:38 AM Local: 5:38 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 16, 20, 9, 0, false);          // UTC: 8:09 PM Local: 5:09 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 20, 2, 21, 0, false);          // UTC: 2:21 AM Local: 11:21 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 28, 7, 29, 0, false);          // UTC: 7:29 AM Local: 4:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 8, 9, 54, 0, false);           // UTC: 9:54 AM Local: 6:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 20, 17, 19, 0, false);         // UTC: 5:19 PM Local: 2:19 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 16, 13, 49, 0, false);         // UTC: 1:49 PM Local: 10:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 22, 21, 27, 0, false);         // UTC: 9:27 PM Local: 6:27 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 22, 17, 12, 0, false);         // UTC: 5:12 PM Local: 2:12 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 24, 17, 58, 0, false);         // UTC: 5:58 PM Local: 2:58 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 7, 11, 36, 0, false);          // UTC: 11:36 AM Local: 8:36 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 1, 7, 53, 0, false);           // UTC: 7:53 AM Local: 4:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 13, 22, 40, 0, false);         // UTC: 10:40 PM Local: 7:40 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 28, 15, 46, 0, false);         // UTC: 3:46 PM Local: 12:46 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 9, 0, 14, 0, false);           // UTC: 12:14 AM Local: 9:14 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 19, 16, 12, 0, false);         // UTC: 4:12 PM Local: 1:12 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 4, 4, 11, 35, 0, false);          // UTC: 11:35 AM Local: 8:35 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 18, 16, 50, 0, false);         // UTC: 4:50 PM Local: 1:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 15, 18, 50, 0, false);         // UTC: 6:50 PM Local: 3:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 26, 12, 12, 0, false);         // UTC: 12:12 PM Local: 9:12 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 26, 7, 50, 0, false);          // UTC: 7:50 AM Local: 4:50 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 25, 5, 29, 0, false);          // UTC: 5:29 AM Local: 2:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 11, 13, 56, 0, false);         // UTC: 1:56 PM Local: 10:56 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 13, 5, 27, 0, false);          // UTC: 5:27 AM Local: 2:27 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 12, 9, 1, 0, false);           // UTC: 9:01 AM Local: 6:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 17, 12, 4, 0, false);          // UTC: 12:04 PM Local: 9:04 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 19, 5, 16, 0, false);          // UTC: 5:16 AM Local: 2:16 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 12, 16, 15, 0, false);         // UTC: 4:15 PM Local: 1:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 18, 4, 31, 0, false);          // UTC: 4:31 AM Local: 1:31 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 9, 23, 26, 0, false);          // UTC: 11:26 PM Local: 8:26 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 10, 21, 13, 0, false);         // UTC: 9:13 PM Local: 6:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 30, 12, 1, 0, false);          // UTC: 12:01 PM Local: 9:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 25, 16, 9, 0, false);          // UTC: 4:09 PM Local: 1:09 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 5, 13, 51, 0, false);          // UTC: 1:51 PM Local: 10:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 6, 4, 57, 0, false);           // UTC: 4:57 AM Local: 1:57 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 20, 4, 32, 0, false);          // UTC: 4:32 AM Local: 1:32 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 21, 22, 3, 0, false);          // UTC: 10:03 PM Local: 7:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 16, 0, 22, 0, false);          // UTC: 12:22 AM Local: 9:22 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 29, 11, 48, 0, false);         // UTC: 11:48 AM Local: 8:48 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 28, 21, 54, 0, false);         // UTC: 9:54 PM Local: 6:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 22, 9, 46, 0, false);          // UTC: 9:46 AM Local: 6:46 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 5, 14, 9, 32, 0, false);          // UTC: 9:32 AM Local: 6:32 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 20, 12, 45, 0, false);         // UTC: 12:45 PM Local: 9:45 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 6, 20, 36, 0, false);          // UTC: 8:36 PM Local: 5:36 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 5, 0, 58, 0, false);           // UTC: 12:58 AM Local: 9:58 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 25, 9, 29, 0, false);          // UTC: 9:29 AM Local: 6:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 22, 5, 31, 0, false);          // UTC: 5:31 AM Local: 2:31 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 14, 23, 22, 0, false);         // UTC: 11:22 PM Local: 8:22 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 27, 12, 5, 0, false);          // UTC: 12:05 PM Local: 9:05 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 2, 4, 37, 0, false);           // UTC: 4:37 AM Local: 1:37 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 4, 8, 33, 0, false);           // UTC: 8:33 AM Local: 5:33 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 21, 2, 11, 0, false);          // UTC: 2:11 AM Local: 11:11 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 25, 14, 49, 0, false);         // UTC: 2:49 PM Local: 11:49 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 17, 23, 5, 0, false);          // UTC: 11:05 PM Local: 8:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 13, 11, 33, 0, false);         // UTC: 11:33 AM Local: 8:33 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 6, 11, 29, 0, false);          // UTC: 11:29 AM Local: 8:29 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 10, 22, 3, 0, false);          // UTC: 10:03 PM Local: 7:03 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 26, 11, 46, 0, false);         // UTC: 11:46 AM Local: 8:46 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 25, 8, 59, 0, false);          // UTC: 8:59 AM Local: 5:59 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 3, 11, 2, 0, false);           // UTC: 11:02 AM Local: 8:02 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 27, 21, 8, 0, false);          // UTC: 9:08 PM Local: 6:08 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 12, 20, 53, 0, false);         // UTC: 8:53 PM Local: 5:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 16, 11, 57, 0, false);         // UTC: 11:57 AM Local: 8:57 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 29, 6, 53, 0, false);          // UTC: 6:53 AM Local: 3:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 7, 5, 20, 0, false);           // UTC: 5:20 AM Local: 2:20 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 22, 0, 49, 0, false);          // UTC: 12:49 AM Local: 9:49 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 6, 27, 23, 10, 0, false);         // UTC: 11:10 PM Local: 8:10 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 22, 10, 57, 0, false);         // UTC: 10:57 AM Local: 7:57 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 26, 6, 15, 0, false);          // UTC: 6:15 AM Local: 3:15 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 31, 16, 42, 0, false);         // UTC: 4:42 PM Local: 1:42 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 12, 2, 21, 0, false);          // UTC: 2:21 AM Local: 11:21 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 7, 20, 54, 0, false);          // UTC: 8:54 PM Local: 5:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 17, 11, 2, 0, false);          // UTC: 11:02 AM Local: 8:02 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 27, 11, 14, 0, false);         // UTC: 11:14 AM Local: 8:14 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 20, 10, 47, 0, false);         // UTC: 10:47 AM Local: 7:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 22, 15, 24, 0, false);         // UTC: 3:24 PM Local: 12:24 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 24, 19, 22, 0, false);         // UTC: 7:22 PM Local: 4:22 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 30, 22, 33, 0, false);         // UTC: 10:33 PM Local: 7:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 10, 15, 15, 0, false);         // UTC: 3:15 PM Local: 12:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 4, 19, 0, 0, false);           // UTC: 7:00 PM Local: 4:00 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 21, 7, 26, 0, false);          // UTC: 7:26 AM Local: 4:26 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 9, 3, 4, 0, false);            // UTC: 3:04 AM Local: 12:04 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 11, 18, 6, 0, false);          // UTC: 6:06 PM Local: 3:06 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 30, 4, 27, 0, false);          // UTC: 4:27 AM Local: 1:27 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 7, 8, 3, 0, false);            // UTC: 8:03 AM Local: 5:03 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 24, 17, 45, 0, false);         // UTC: 5:45 PM Local: 2:45 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 7, 11, 17, 0, false);          // UTC: 11:17 AM Local: 8:17 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 1, 8, 48, 0, false);           // UTC: 8:48 AM Local: 5:48 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 5, 4, 0, 0, false);            // UTC: 4:00 AM Local: 1:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 11, 7, 15, 0, false);          // UTC: 7:15 AM Local: 4:15 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 16, 16, 1, 0, false);          // UTC: 4:01 PM Local: 1:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 7, 1, 19, 22, 0, false);          // UTC: 7:22 PM Local: 4:22 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 23, 14, 34, 0, false);         // UTC: 2:34 PM Local: 11:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 28, 13, 25, 0, false);         // UTC: 1:25 PM Local: 10:25 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 1, 2, 47, 0, false);           // UTC: 2:47 AM Local: 11:47 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 18, 9, 14, 0, false);          // UTC: 9:14 AM Local: 6:14 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 23, 6, 45, 0, false);          // UTC: 6:45 AM Local: 3:45 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 20, 20, 51, 0, false);         // UTC: 8:51 PM Local: 5:51 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 19, 19, 44, 0, false);         // UTC: 7:44 PM Local: 4:44 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 25, 2, 41, 0, false);          // UTC: 2:41 AM Local: 11:41 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 15, 15, 47, 0, false);         // UTC: 3:47 PM Local: 12:47 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 7, 23, 39, 0, false);          // UTC: 11:39 PM Local: 8:39 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 2, 3, 34, 0, false);           // UTC: 3:34 AM Local: 12:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 1, 22, 57, 0, false);          // UTC: 10:57 PM Local: 7:57 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 4, 20, 55, 0, false);          // UTC: 8:55 PM Local: 5:55 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 10, 13, 16, 0, false);         // UTC: 1:16 PM Local: 10:16 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 16, 19, 33, 0, false);         // UTC: 7:33 PM Local: 4:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 14, 4, 22, 0, false);          // UTC: 4:22 AM Local: 1:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 28, 2, 42, 0, false);          // UTC: 2:42 AM Local: 11:42 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 18, 19, 5, 0, false);          // UTC: 7:05 PM Local: 4:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 18, 16, 25, 0, false);         // UTC: 4:25 PM Local: 1:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 16, 6, 35, 0, false);          // UTC: 6:35 AM Local: 3:35 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 24, 22, 0, 0, false);          // UTC: 10:00 PM Local: 7:00 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 6, 15, 5, 0, false);           // UTC: 3:05 PM Local: 12:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 22, 10, 22, 0, false);         // UTC: 10:22 AM Local: 7:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 28, 20, 27, 0, false);         // UTC: 8:27 PM Local: 5:27 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 8, 20, 22, 0, 0, false);          // UTC: 10:00 PM Local: 7:00 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 8, 18, 54, 0, false);          // UTC: 6:54 PM Local: 3:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 29, 16, 46, 0, false);         // UTC: 4:46 PM Local: 1:46 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 22, 2, 36, 0, false);          // UTC: 2:36 AM Local: 11:36 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 25, 5, 16, 0, false);          // UTC: 5:16 AM Local: 2:16 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 2, 5, 5, 0, false);            // UTC: 5:05 AM Local: 2:05 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 21, 20, 5, 0, false);          // UTC: 8:05 PM Local: 5:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 6, 14, 59, 0, false);          // UTC: 2:59 PM Local: 11:59 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 30, 18, 49, 0, false);         // UTC: 6:49 PM Local: 3:49 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 23, 3, 8, 0, false);           // UTC: 3:08 AM Local: 12:08 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 15, 20, 55, 0, false);         // UTC: 8:55 PM Local: 5:55 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 26, 7, 51, 0, false);          // UTC: 7:51 AM Local: 4:51 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 10, 18, 54, 0, false);         // UTC: 6:54 PM Local: 3:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 29, 20, 6, 0, false);          // UTC: 8:06 PM Local: 5:06 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 12, 11, 41, 0, false);         // UTC: 11:41 AM Local: 8:41 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 10, 20, 25, 0, false);         // UTC: 8:25 PM Local: 5:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 16, 4, 33, 0, false);          // UTC: 4:33 AM Local: 1:33 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 15, 0, 19, 0, false);          // UTC: 12:19 AM Local: 9:19 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 2, 15, 13, 0, false);          // UTC: 3:13 PM Local: 12:13 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 22, 1, 5, 0, false);           // UTC: 1:05 AM Local: 10:05 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 14, 12, 58, 0, false);         // UTC: 12:58 PM Local: 9:58 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 30, 13, 12, 0, false);         // UTC: 1:12 PM Local: 10:12 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 18, 8, 2, 0, false);           // UTC: 8:02 AM Local: 5:02 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 19, 23, 42, 0, false);         // UTC: 11:42 PM Local: 8:42 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 14, 18, 10, 0, false);         // UTC: 6:10 PM Local: 3:10 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 9, 4, 17, 54, 0, false);          // UTC: 5:54 PM Local: 2:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 26, 22, 15, 0, false);        // UTC: 10:15 PM Local: 7:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 23, 5, 27, 0, false);         // UTC: 5:27 AM Local: 2:27 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 29, 4, 10, 0, false);         // UTC: 4:10 AM Local: 1:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 24, 12, 47, 0, false);        // UTC: 12:47 PM Local: 9:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 7, 2, 59, 0, false);          // UTC: 2:59 AM Local: 11:59 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 21, 13, 13, 0, false);        // UTC: 1:13 PM Local: 10:13 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 30, 13, 0, 0, false);         // UTC: 1:00 PM Local: 10:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 22, 14, 34, 0, false);        // UTC: 2:34 PM Local: 11:34 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 24, 9, 8, 0, false);          // UTC: 9:08 AM Local: 6:08 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 1, 22, 39, 0, false);         // UTC: 10:39 PM Local: 7:39 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 9, 14, 45, 0, false);         // UTC: 2:45 PM Local: 11:45 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 31, 18, 10, 0, false);        // UTC: 6:10 PM Local: 3:10 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 1, 23, 48, 0, false);         // UTC: 11:48 PM Local: 8:48 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 5, 3, 57, 0, false);          // UTC: 3:57 AM Local: 12:57 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 18, 21, 53, 0, false);        // UTC: 9:53 PM Local: 6:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 2, 7, 1, 0, false);           // UTC: 7:01 AM Local: 4:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 26, 7, 52, 0, false);         // UTC: 7:52 AM Local: 4:52 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 20, 23, 15, 0, false);        // UTC: 11:15 PM Local: 8:15 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 24, 2, 2, 0, false);          // UTC: 2:02 AM Local: 11:02 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 2, 10, 3, 0, false);          // UTC: 10:03 AM Local: 7:03 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 5, 3, 45, 0, false);          // UTC: 3:45 AM Local: 12:45 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 1, 11, 15, 0, false);         // UTC: 11:15 AM Local: 8:15 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 8, 14, 8, 0, false);          // UTC: 2:08 PM Local: 11:08 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 23, 5, 47, 0, false);         // UTC: 5:47 AM Local: 2:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 10, 7, 17, 31, 0, false);         // UTC: 5:31 PM Local: 2:31 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 19, 1, 18, 0, false);         // UTC: 1:18 AM Local: 10:18 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 26, 7, 10, 0, false);         // UTC: 7:10 AM Local: 4:10 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 30, 21, 29, 0, false);        // UTC: 9:29 PM Local: 6:29 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 16, 15, 46, 0, false);        // UTC: 3:46 PM Local: 12:46 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 4, 9, 44, 0, false);          // UTC: 9:44 AM Local: 6:44 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 16, 7, 1, 0, false);          // UTC: 7:01 AM Local: 4:01 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 26, 7, 44, 0, false);         // UTC: 7:44 AM Local: 4:44 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 15, 2, 44, 0, false);         // UTC: 2:44 AM Local: 11:44 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 16, 0, 28, 0, false);         // UTC: 12:28 AM Local: 9:28 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 23, 17, 47, 0, false);        // UTC: 5:47 PM Local: 2:47 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 13, 9, 0, 0, false);          // UTC: 9:00 AM Local: 6:00 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 10, 23, 44, 0, false);        // UTC: 11:44 PM Local: 8:44 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 24, 4, 31, 0, false);         // UTC: 4:31 AM Local: 1:31 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 11, 20, 33, 0, false);        // UTC: 8:33 PM Local: 5:33 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 14, 15, 37, 0, false);        // UTC: 3:37 PM Local: 12:37 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 16, 18, 7, 0, false);         // UTC: 6:07 PM Local: 3:07 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 21, 10, 53, 0, false);        // UTC: 10:53 AM Local: 7:53 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 4, 14, 27, 0, false);         // UTC: 2:27 PM Local: 11:27 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 2, 12, 54, 0, false);         // UTC: 12:54 PM Local: 9:54 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 6, 2, 21, 0, false);          // UTC: 2:21 AM Local: 11:21 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 2, 12, 9, 0, false);          // UTC: 12:09 PM Local: 9:09 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 20, 19, 8, 0, false);         // UTC: 7:08 PM Local: 4:08 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 2, 19, 46, 0, false);         // UTC: 7:46 PM Local: 4:46 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 18, 5, 22, 0, false);         // UTC: 5:22 AM Local: 2:22 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 11, 13, 15, 54, 0, false);        // UTC: 3:54 PM Local: 12:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 26, 20, 26, 0, false);        // UTC: 8:26 PM Local: 5:26 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 18, 12, 37, 0, false);        // UTC: 12:37 PM Local: 9:37 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 4, 16, 50, 0, false);         // UTC: 4:50 PM Local: 1:50 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 30, 3, 11, 0, false);         // UTC: 3:11 AM Local: 12:11 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 15, 1, 7, 0, false);          // UTC: 1:07 AM Local: 10:07 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 17, 21, 46, 0, false);        // UTC: 9:46 PM Local: 6:46 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 9, 12, 42, 0, false);         // UTC: 12:42 PM Local: 9:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 14, 2, 53, 0, false);         // UTC: 2:53 AM Local: 11:53 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 30, 21, 19, 0, false);        // UTC: 9:19 PM Local: 6:19 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 6, 22, 1, 0, false);          // UTC: 10:01 PM Local: 7:01 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 31, 23, 25, 0, false);        // UTC: 11:25 PM Local: 8:25 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 6, 8, 57, 0, false);          // UTC: 8:57 AM Local: 5:57 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 5, 17, 42, 0, false);         // UTC: 5:42 PM Local: 2:42 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 18, 14, 35, 0, false);        // UTC: 2:35 PM Local: 11:35 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 14, 5, 11, 0, false);         // UTC: 5:11 AM Local: 2:11 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 29, 10, 11, 0, false);        // UTC: 10:11 AM Local: 7:11 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 18, 6, 2, 0, false);          // UTC: 6:02 AM Local: 3:02 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 7, 8, 30, 0, false);          // UTC: 8:30 AM Local: 5:30 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 31, 23, 54, 0, false);        // UTC: 11:54 PM Local: 8:54 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 10, 23, 21, 0, false);        // UTC: 11:21 PM Local: 8:21 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 31, 5, 42, 0, false);         // UTC: 5:42 AM Local: 2:42 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 2, 7, 17, 0, false);          // UTC: 7:17 AM Local: 4:17 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 9, 23, 14, 0, false);         // UTC: 11:14 PM Local: 8:14 AM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 4, 6, 47, 0, false);          // UTC: 6:47 AM Local: 3:47 PM Offset: 09:00:00
+	testCount++; failedCount += test(timeManager, 17, 2020, 12, 27, 12, 18, 0, false);        // UTC: 12:18 PM Local: 9:18 PM Offset: 09:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
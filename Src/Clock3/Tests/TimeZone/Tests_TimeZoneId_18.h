@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_18_H
+#define TEST_TIMEZONEID_18_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_18_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 6, 3, 42, 0, false);           // UTC: 3:42 AM Local: 11:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 15, 10, 15, 0, false);         // UTC: 10:15 AM Local: 6:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 7, 15, 40, 0, false);          // UTC: 3:40 PM Local: 11:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 16, 5, 30, 0, false);          // UTC: 5:30 AM Local: 1:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 10, 14, 56, 0, false);         // UTC: 2:56 PM Local: 10:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 9, 6, 16, 0, false);           // UTC: 6:16 AM Local: 2:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 29, 22, 7, 0, false);          // UTC: 10:07 PM Local: 6:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 11, 16, 43, 0, false);         // UTC: 4:43 PM Local: 12:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 25, 5, 55, 0, false);          // UTC: 5:55 AM Local: 1:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 31, 7, 10, 0, false);          // UTC: 7:10 AM Local: 3:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 8, 6, 47, 0, false);           // UTC: 6:47 AM Local: 2:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 12, 18, 32, 0, false);         // UTC: 6:32 PM Local: 2:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 7, 21, 57, 0, false);          // UTC: 9:57 PM Local: 5:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 28, 15, 13, 0, false);         // UTC: 3:13 PM Local: 11:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 23, 9, 16, 0, false);          // UTC: 9:16 AM Local: 5:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 1, 10, 25, 0, false);          // UTC: 10:25 AM Local: 6:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 8, 23, 25, 0, false);          // UTC: 11:25 PM Local: 7:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 18, 11, 37, 0, false);         // UTC: 11:37 AM Local: 7:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 19, 16, 17, 0, false);         // UTC: 4:17 PM Local: 12:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 27, 8, 38, 0, false);          // UTC: 8:38 AM Local: 4:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 23, 9, 35, 0, false);          // UTC: 9:35 AM Local: 5:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 4, 9, 30, 0, false);           // UTC: 9:30 AM Local: 5:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 19, 16, 9, 0, false);          // UTC: 4:09 PM Local: 12:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 16, 21, 50, 0, false);         // UTC: 9:50 PM Local: 5:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 1, 21, 5, 12, 0, false);          // UTC: 5:12 AM Local: 1:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 7, 20, 43, 0, false);          // UTC: 8:43 PM Local: 4:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 26, 13, 8, 0, false);          // UTC: 1:08 PM Local: 9:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 14, 16, 30, 0, false);         // UTC: 4:30 PM Local: 12:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 19, 3, 58, 0, false);          // UTC: 3:58 AM Local: 11:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 23, 6, 37, 0, false);          // UTC: 6:37 AM Local: 2:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 9, 17, 54, 0, false);          // UTC: 5:54 PM Local: 1:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 11, 21, 34, 0, false);         // UTC: 9:34 PM Local: 5:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 16, 2, 31, 0, false);          // UTC: 2:31 AM Local: 10:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 5, 15, 9, 0, false);           // UTC: 3:09 PM Local: 11:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 16, 2, 15, 0, false);          // UTC: 2:15 AM Local: 10:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 21, 2, 34, 0, false);          // UTC: 2:34 AM Local: 10:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 12, 6, 59, 0, false);          // UTC: 6:59 AM Local: 2:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 26, 20, 25, 0, false);         // UTC: 8:25 PM Local: 4:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 26, 18, 52, 0, false);         // UTC: 6:52 PM Local: 2:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 18, 21, 48, 0, false);         // UTC: 9:48 PM Local: 5:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 17, 0, 8, 0, false);           // UTC: 12:08 AM Local: 8:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 25, 22, 54, 0, false);         // UTC: 10:54 PM Local: 6:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 3, 15, 25, 0, false);          // UTC: 3:25 PM Local: 11:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 27, 12, 11, 0, false);         // UTC: 12:11 PM Local: 8:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 13, 13, 8, 0, false);          // UTC: 1:08 PM Local: 9:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 9, 22, 25, 0, false);          // UTC: 10:25 PM Local: 6:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 22, 22, 23, 0, false);         // UTC: 10:23 PM Local: 6:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 5, 10, 21, 0, false);          // UTC: 10:21 AM Local: 6:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 24, 19, 19, 0, false);         // UTC: 7:19 PM Local: 3:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 2, 5, 13, 44, 0, false);          // UTC: 1:44 PM Local: 9:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 18, 0, 57, 0, false);          // UTC: 12:57 AM Local: 8:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 19, 13, 9, 0, false);          // UTC: 1:09 PM Local: 9:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 25, 5, 39, 0, false);          // UTC: 5:39 AM Local: 1:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 24, 20, 57, 0, false);         // UTC: 8:57 PM Local: 4:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 14, 0, 32, 0, false);          // UTC: 12:32 AM Local: 8:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 18, 17, 52, 0, false);         // UTC: 5:52 PM Local: 1:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 15, 17, 6, 0, false);          // UTC: 5:06 PM Local: 1:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 1, 19, 49, 0, false);          // UTC: 7:49 PM Local: 3:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 9, 13, 47, 0, false);          // UTC: 1:47 PM Local: 9:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 13, 15, 39, 0, false);         // UTC: 3:39 PM Local: 11:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 18, 15, 55, 0, false);         // UTC: 3:55 PM Local: 11:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 14, 4, 14, 0, false);          // UTC: 4:14 AM Local: 12:14 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 6, 5, 23, 0, false);           // UTC: 5:23 AM Local: 1:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 24, 20, 19, 0, false);         // UTC: 8:19 PM Local: 4:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 16, 1, 49, 0, false);          // UTC: 1:49 AM Local: 9:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 27, 2, 59, 0, false);          // UTC: 2:59 AM Local: 10:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 12, 17, 47, 0, false);         // UTC: 5:47 PM Local: 1:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 6, 16, 9, 0, false);           // UTC: 4:09 PM Local: 12:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 30, 6, 16, 0, false);          // UTC: 6:16 AM Local: 2:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 31, 2, 10, 0, false);          // UTC: 2:10 AM Local: 10:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 27, 18, 44, 0, false);         // UTC: 6:44 PM Local: 2:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 26, 7, 8, 0, false);           // UTC: 7:08 AM Local: 3:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 30, 9, 6, 0, false);           // UTC: 9:06 AM Local: 5:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 19, 11, 4, 0, false);          // UTC: 11:04 AM Local: 7:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 3, 12, 10, 5, 0, false);          // UTC: 10:05 AM Local: 6:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 20, 8, 59, 0, false);          // UTC: 8:59 AM Local: 4:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 12, 23, 10, 0, false);         // UTC: 11:10 PM Local: 7:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 13, 22, 26, 0, false);         // UTC: 10:26 PM Local: 6:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 27, 16, 26, 0, false);         // UTC: 4:26 PM Local: 12:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 24, 16, 45, 0, false);         // UTC: 4:45 PM Local: 12:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 1, 8, 59, 0, false);           // UTC: 8:59 AM Local: 4:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 14, 23, 2, 0, false);          // UTC: 11:02 PM Local: 7:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 19, 8, 25, 0, false);          // UTC: 8:25 AM Local: 4:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 9, 2, 13, 0, false);           // UTC: 2:13 AM Local: 10:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 10, 5, 23, 0, false);          // UTC: 5:23 AM Local: 1:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 5, 22, 43, 0, false);          // UTC: 10:43 PM Local: 6:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 21, 14, 5, 0, false);          // UTC: 2:05 PM Local: 10:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 4, 10, 53, 0, false);          // UTC: 10:53 AM Local: 6:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 22, 8, 49, 0, false);          // UTC: 8:49 AM Local: 4:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 27, 17, 49, 0, false);         // UTC: 5:49 PM Local: 1:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 15, 16, 36, 0, false);         // UTC: 4:36 PM Local: 12:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 3, 7, 45, 0, false);           // UTC: 7:45 AM Local: 3:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 3, 14, 56, 0, false);          // UTC: 2:56 PM Local: 10:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 25, 10, 10, 0, false);         // UTC: 10:10 AM Local: 6:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 25, 23, 5, 0, false);          // UTC: 11:05 PM Local: 7:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 8, 11, 55, 0, false);          // UTC: 11:55 AM Local: 7:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 18, 20, 31, 0, false);         // UTC: 8:31 PM Local: 4:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 17, 16, 49, 0, false);         // UTC: 4:49 PM Local: 12:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 13, 12, 43, 0, false);         // UTC: 12:43 PM Local: 8:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 4, 10, 14, 48, 0, false);         // UTC: 2:48 PM Local: 10:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 1, 16, 41, 0, false);          // UTC: 4:41 PM Local: 12:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 30, 6, 42, 0, false);          // UTC: 6:42 AM Local: 2:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 7, 0, 5, 0, false);            // UTC: 12:05 AM Local: 8:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 13, 21, 48, 0, false);         // UTC: 9:48 PM Local: 5:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 12, 22, 4, 0, false);          // UTC: 10:04 PM Local: 6:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 19, 0, 17, 0, false);          // UTC: 12:17 AM Local: 8:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 7, 7, 34, 0, false);           // UTC: 7:34 AM Local: 3:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 5, 22, 41, 0, false);          // UTC: 10:41 PM Local: 6:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 11, 0, 8, 0, false);           // UTC: 12:08 AM Local: 8:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 8, 22, 45, 0, false);          // UTC: 10:45 PM Local: 6:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 15, 8, 1, 0, false);           // UTC: 8:01 AM Local: 4:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 17, 13, 43, 0, false);         // UTC: 1:43 PM Local: 9:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 30, 23, 32, 0, false);         // UTC: 11:32 PM Local: 7:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 6, 8, 26, 0, false);           // UTC: 8:26 AM Local: 4:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 5, 15, 39, 0, false);          // UTC: 3:39 PM Local: 11:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 8, 19, 17, 0, false);          // UTC: 7:17 PM Local: 3:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 16, 1, 33, 0, false);          // UTC: 1:33 AM Local: 9:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 20, 22, 50, 0, false);         // UTC: 10:50 PM Local: 6:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 12, 16, 3, 0, false);          // UTC: 4:03 PM Local: 12:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 20, 14, 18, 0, false);         // UTC: 2:18 PM Local: 10:18 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 26, 22, 18, 0, false);         // UTC: 10:18 PM Local: 6:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 23, 19, 0, 0, false);          // UTC: 7:00 PM Local: 3:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 7, 21, 40, 0, false);          // UTC: 9:40 PM Local: 5:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 28, 16, 36, 0, false);         // UTC: 4:36 PM Local: 12:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 5, 29, 6, 1, 0, false);           // UTC: 6:01 AM Local: 2:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 6, 9, 53, 0, false);           // UTC: 9:53 AM Local: 5:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 8, 6, 26, 0, false);           // UTC: 6:26 AM Local: 2:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 3, 17, 55, 0, false);          // UTC: 5:55 PM Local: 1:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 6, 0, 29, 0, false);           // UTC: 12:29 AM Local: 8:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 18, 20, 15, 0, false);         // UTC: 8:15 PM Local: 4:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 15, 2, 47, 0, false);          // UTC: 2:47 AM Local: 10:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 23, 15, 30, 0, false);         // UTC: 3:30 PM Local: 11:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 7, 6, 48, 0, false);           // UTC: 6:48 AM Local: 2:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 15, 10, 40, 0, false);         // UTC: 10:40 AM Local: 6:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 9, 13, 19, 0, false);          // UTC: 1:19 PM Local: 9:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 5, 6, 24, 0, false);           // UTC: 6:24 AM Local: 2:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 27, 20, 21, 0, false);         // UTC: 8:21 PM Local: 4:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 24, 22, 43, 0, false);         // UTC: 10:43 PM Local: 6:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 18, 17, 16, 0, false);         // UTC: 5:16 PM Local: 1:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 29, 11, 13, 0, false);         // UTC: 11:13 AM Local: 7:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 2, 21, 41, 0, false);          // UTC: 9:41 PM Local: 5:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 24, 2, 39, 0, false);          // UTC: 2:39 AM Local: 10:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 30, 4, 25, 0, false);          // UTC: 4:25 AM Local: 12:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 3, 2, 31, 0, false);           // UTC: 2:31 AM Local: 10:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 9, 11, 13, 0, false);          // UTC: 11:13 AM Local: 7:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 16, 2, 56, 0, false);          // UTC: 2:56 AM Local: 10:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 3, 11, 9, 0, false);           // UTC: 11:09 AM Local: 7:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 11, 10, 0, 0, false);          // UTC: 10:00 AM Local: 6:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 14, 11, 12, 0, false);         // UTC: 11:12 AM Local: 7:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 6, 2, 9, 13, 0, false);           // UTC: 9:13 AM Local: 5:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 27, 7, 11, 0, false);          // UTC: 7:11 AM Local: 3:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 20, 4, 22, 0, false);          // UTC: 4:22 AM Local: 12:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 27, 20, 12, 0, false);         // UTC: 8:12 PM Local: 4:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 1, 18, 2, 0, false);           // UTC: 6:02 PM Local: 2:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 5, 17, 51, 0, false);          // UTC: 5:51 PM Local: 1:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 31, 10, 9, 0, false);          // UTC: 10:09 AM Local: 6:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 2, 7, 42, 0, false);           // UTC: 7:42 AM Local: 3:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 26, 23, 10, 0, false);         // UTC: 11:10 PM Local: 7:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 11, 9, 44, 0, false);          // UTC: 9:44 AM Local: 5:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 18, 10, 49, 0, false);         // UTC: 10:49 AM Local: 6:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 19, 10, 54, 0, false);         // UTC: 10:54 AM Local: 6:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 17, 18, 21, 0, false);         // UTC: 6:21 PM Local: 2:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 28, 8, 18, 0, false);          // UTC: 8:18 AM Local: 4:18 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 31, 11, 14, 0, false);         // UTC: 11:14 AM Local: 7:14 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 16, 11, 26, 0, false);         // UTC: 11:26 AM Local: 7:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 14, 11, 51, 0, false);         // UTC: 11:51 AM Local: 7:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 18, 3, 17, 0, false);          // UTC: 3:17 AM Local: 11:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 15, 4, 43, 0, false);          // UTC: 4:43 AM Local: 12:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 30, 6, 31, 0, false);          // UTC: 6:31 AM Local: 2:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 12, 7, 29, 0, false);          // UTC: 7:29 AM Local: 3:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 10, 6, 30, 0, false);          // UTC: 6:30 AM Local: 2:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 5, 8, 19, 0, false);           // UTC: 8:19 AM Local: 4:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 29, 12, 44, 0, false);         // UTC: 12:44 PM Local: 8:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 31, 11, 48, 0, false);         // UTC: 11:48 AM Local: 7:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 7, 9, 15, 19, 0, false);          // UTC: 3:19 PM Local: 11:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 7, 9, 36, 0, false);           // UTC: 9:36 AM Local: 5:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 1, 22, 24, 0, false);          // UTC: 10:24 PM Local: 6:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 22, 7, 48, 0, false);          // UTC: 7:48 AM Local: 3:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 25, 21, 45, 0, false);         // UTC: 9:45 PM Local: 5:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 13, 1, 33, 0, false);          // UTC: 1:33 AM Local: 9:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 20, 3, 54, 0, false);          // UTC: 3:54 AM Local: 11:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 22, 11, 3, 0, false);          // UTC: 11:03 AM Local: 7:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 25, 12, 48, 0, false);         // UTC: 12:48 PM Local: 8:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 14, 2, 26, 0, false);          // UTC: 2:26 AM Local: 10:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 29, 19, 45, 0, false);         // UTC: 7:45 PM Local: 3:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 22, 11, 30, 0, false);         // UTC: 11:30 AM Local: 7:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 12, 17, 12, 0, false);         // UTC: 5:12 PM Local: 1:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 30, 21, 27, 0, false);         // UTC: 9:27 PM Local: 5:27 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 26, 9, 34, 0, false);          // UTC: 9:34 AM Local: 5:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 13, 18, 57, 0, false);         // UTC: 6:57 PM Local: 2:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 8, 22, 51, 0, false);          // UTC: 10:51 PM Local: 6:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 25, 16, 5, 0, false);          // UTC: 4:05 PM Local: 12:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 8, 2, 48, 0, false);           // UTC: 2:48 AM Local: 10:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 25, 18, 32, 0, false);         // UTC: 6:32 PM Local: 2:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 14, 10, 51, 0, false);         // UTC: 10:51 AM Local: 6:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 9, 13, 22, 0, false);          // UTC: 1:22 PM Local: 9:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 22, 10, 34, 0, false);         // UTC: 10:34 AM Local: 6:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 29, 11, 36, 0, false);         // UTC: 11:36 AM Local: 7:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 12, 22, 37, 0, false);         // UTC: 10:37 PM Local: 6:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 8, 22, 5, 18, 0, false);          // UTC: 5:18 AM Local: 1:18 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 6, 1, 20, 0, false);           // UTC: 1:20 AM Local: 9:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 1, 22, 54, 0, false);          // UTC: 10:54 PM Local: 6:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 7, 12, 49, 0, false);          // UTC: 12:49 PM Local: 8:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 8, 10, 35, 0, false);          // UTC: 10:35 AM Local: 6:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 16, 3, 30, 0, false);          // UTC: 3:30 AM Local: 11:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 28, 9, 52, 0, false);          // UTC: 9:52 AM Local: 5:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 11, 4, 40, 0, false);          // UTC: 4:40 AM Local: 12:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 3, 9, 14, 0, false);           // UTC: 9:14 AM Local: 5:14 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 9, 7, 56, 0, false);           // UTC: 7:56 AM Local: 3:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 23, 13, 26, 0, false);         // UTC: 1:26 PM Local: 9:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 7, 2, 7, 0, false);            // UTC: 2:07 AM Local: 10:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 14, 10, 20, 0, false);         // UTC: 10:20 AM Local: 6:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 11, 19, 13, 0, false);         // UTC: 7:13 PM Local: 3:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 24, 0, 57, 0, false);          // UTC: 12:57 AM Local: 8:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 3, 19, 43, 0, false);          // UTC: 7:43 PM Local: 3:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 30, 17, 39, 0, false);         // UTC: 5:39 PM Local: 1:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 19, 5, 10, 0, false);          // UTC: 5:10 AM Local: 1:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 30, 21, 0, 0, false);          // UTC: 9:00 PM Local: 5:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 1, 17, 8, 0, false);           // UTC: 5:08 PM Local: 1:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 13, 16, 7, 0, false);          // UTC: 4:07 PM Local: 12:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 19, 4, 53, 0, false);          // UTC: 4:53 AM Local: 12:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 17, 19, 13, 0, false);         // UTC: 7:13 PM Local: 3:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 14, 12, 14, 0, false);         // UTC: 12:14 PM Local: 8:14 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 11, 4, 42, 0, false);          // UTC: 4:42 AM Local: 12:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 9, 19, 12, 27, 0, false);         // UTC: 12:27 PM Local: 8:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 2, 17, 24, 0, false);         // UTC: 5:24 PM Local: 1:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 28, 6, 31, 0, false);         // UTC: 6:31 AM Local: 2:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 29, 22, 20, 0, false);        // UTC: 10:20 PM Local: 6:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 30, 14, 43, 0, false);        // UTC: 2:43 PM Local: 10:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 20, 14, 3, 0, false);         // UTC: 2:03 PM Local: 10:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 14, 2, 2, 0, false);          // UTC: 2:02 AM Local: 10:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 17, 19, 16, 0, false);        // UTC: 7:16 PM Local: 3:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 6, 1, 43, 0, false);          // UTC: 1:43 AM Local: 9:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 24, 23, 17, 0, false);        // UTC: 11:17 PM Local: 7:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 20, 4, 41, 0, false);         // UTC: 4:41 AM Local: 12:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 27, 10, 40, 0, false);        // UTC: 10:40 AM Local: 6:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 4, 0, 43, 0, false);          // UTC: 12:43 AM Local: 8:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 27, 1, 1, 0, false);          // UTC: 1:01 AM Local: 9:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 4, 9, 21, 0, false);          // UTC: 9:21 AM Local: 5:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 9, 9, 29, 0, false);          // UTC: 9:29 AM Local: 5:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 31, 17, 9, 0, false);         // UTC: 5:09 PM Local: 1:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 29, 10, 25, 0, false);        // UTC: 10:25 AM Local: 6:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 27, 9, 47, 0, false);         // UTC: 9:47 AM Local: 5:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 3, 2, 14, 0, false);          // UTC: 2:14 AM Local: 10:14 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 17, 19, 26, 0, false);        // UTC: 7:26 PM Local: 3:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 29, 2, 8, 0, false);          // UTC: 2:08 AM Local: 10:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 9, 21, 33, 0, false);         // UTC: 9:33 PM Local: 5:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 11, 7, 35, 0, false);         // UTC: 7:35 AM Local: 3:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 2, 0, 32, 0, false);          // UTC: 12:32 AM Local: 8:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 10, 30, 19, 48, 0, false);        // UTC: 7:48 PM Local: 3:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 15, 20, 7, 0, false);         // UTC: 8:07 PM Local: 4:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 13, 10, 53, 0, false);        // UTC: 10:53 AM Local: 6:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 3, 16, 27, 0, false);         // UTC: 4:27 PM Local: 12:27 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 22, 3, 17, 0, false);         // UTC: 3:17 AM Local: 11:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 21, 5, 43, 0, false);         // UTC: 5:43 AM Local: 1:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 23, 1, 20, 0, false);         // UTC: 1:20 AM Local: 9:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 26, 1, 34, 0, false);         // UTC: 1:34 AM Local: 9:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 10, 6, 26, 0, false);         // UTC: 6:26 AM Local: 2:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 6, 6, 51, 0, false);          // UTC: 6:51 AM Local: 2:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 5, 22, 30, 0, false);         // UTC: 10:30 PM Local: 6:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 15, 19, 32, 0, false);        // UTC: 7:32 PM Local: 3:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 8, 22, 3, 0, false);          // UTC: 10:03 PM Local: 6:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 5, 16, 22, 0, false);         // UTC: 4:22 PM Local: 12:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 12, 8, 44, 0, false);         // UTC: 8:44 AM Local: 4:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 17, 5, 39, 0, false);         // UTC: 5:39 AM Local: 1:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 13, 14, 33, 0, false);        // UTC: 2:33 PM Local: 10:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 7, 11, 15, 0, false);         // UTC: 11:15 AM Local: 7:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 21, 10, 38, 0, false);        // UTC: 10:38 AM Local: 6:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 16, 23, 24, 0, false);        // UTC: 11:24 PM Local: 7:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 12, 15, 53, 0, false);        // UTC: 3:53 PM Local: 11:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 8, 13, 34, 0, false);         // UTC: 1:34 PM Local: 9:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 13, 4, 30, 0, false);         // UTC: 4:30 AM Local: 12:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 1, 11, 10, 0, false);         // UTC: 11:10 AM Local: 7:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 27, 17, 40, 0, false);        // UTC: 5:40 PM Local: 1:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 11, 7, 15, 29, 0, false);         // UTC: 3:29 PM Local: 11:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 10, 13, 15, 0, false);        // UTC: 1:15 PM Local: 9:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 4, 9, 45, 0, false);          // UTC: 9:45 AM Local: 5:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 30, 0, 2, 0, false);          // UTC: 12:02 AM Local: 8:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 26, 22, 5, 0, false);         // UTC: 10:05 PM Local: 6:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 16, 7, 39, 0, false);         // UTC: 7:39 AM Local: 3:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 14, 2, 43, 0, false);         // UTC: 2:43 AM Local: 10:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 13, 16, 23, 0, false);        // UTC: 4:23 PM Local: 12:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 2, 17, 45, 0, false);         // UTC: 5:45 PM Local: 1:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 31, 9, 54, 0, false);         // UTC: 9:54 AM Local: 5:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 2, 10, 11, 0, false);         // UTC: 10:11 AM Local: 6:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 12, 7, 35, 0, false);         // UTC: 7:35 AM Local: 3:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 4, 21, 8, 0, false);          // UTC: 9:08 PM Local: 5:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 22, 19, 37, 0, false);        // UTC: 7:37 PM Local: 3:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 19, 5, 56, 0, false);         // UTC: 5:56 AM Local: 1:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 27, 7, 11, 0, false);         // UTC: 7:11 AM Local: 3:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 11, 1, 54, 0, false);         // UTC: 1:54 AM Local: 9:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 14, 18, 53, 0, false);        // UTC: 6:53 PM Local: 2:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 9, 12, 8, 0, false);          // UTC: 12:08 PM Local: 8:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 30, 15, 13, 0, false);        // UTC: 3:13 PM Local: 11:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 21, 11, 9, 0, false);         // UTC: 11:09 AM Local: 7:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 5, 2, 16, 0, false);          // UTC: 2:16 AM Local: 10:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 26, 13, 37, 0, false);        // UTC: 1:37 PM Local: 9:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 6, 19, 23, 0, false);         // UTC: 7:23 PM Local: 3:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 27, 8, 38, 0, false);         // UTC: 8:38 AM Local: 4:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2018, 12, 13, 20, 36, 0, false);        // UTC: 8:36 PM Local: 4:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 2, 6, 4, 0, false);            // UTC: 6:04 AM Local: 2:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 9, 22, 30, 0, false);          // UTC: 10:30 PM Local: 6:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 18, 16, 18, 0, false);         // UTC: 4:18 PM Local: 12:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 30, 14, 26, 0, false);         // UTC: 2:26 PM Local: 10:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 19, 14, 27, 0, false);         // UTC: 2:27 PM Local: 10:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 15, 5, 57, 0, false);          // UTC: 5:57 AM Local: 1:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 22, 15, 34, 0, false);         // UTC: 3:34 PM Local: 11:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 22, 15, 47, 0, false);         // UTC: 3:47 PM Local: 11:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 28, 16, 22, 0, false);         // UTC: 4:22 PM Local: 12:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 18, 1, 55, 0, false);          // UTC: 1:55 AM Local: 9:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 6, 17, 39, 0, false);          // UTC: 5:39 PM Local: 1:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 6, 22, 23, 0, false);          // UTC: 10:23 PM Local: 6:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 9, 22, 35, 0, false);          // UTC: 10:35 PM Local: 6:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 2, 15, 46, 0, false);          // UTC: 3:46 PM Local: 11:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 7, 4, 3, 0, false);            // UTC: 4:03 AM Local: 12:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 6, 7, 45, 0, false);           // UTC: 7:45 AM Local: 3:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 31, 2, 57, 0, false);          // UTC: 2:57 AM Local: 10:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 25, 8, 10, 0, false);          // UTC: 8:10 AM Local: 4:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 3, 0, 21, 0, false);           // UTC: 12:21 AM Local: 8:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 8, 21, 53, 0, false);          // UTC: 9:53 PM Local: 5:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 27, 19, 30, 0, false);         // UTC: 7:30 PM Local: 3:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 31, 7, 49, 0, false);          // UTC: 7:49 AM Local: 3:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 16, 0, 59, 0, false);          // UTC: 12:59 AM Local: 8:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 6, 4, 48, 0, false);           // UTC: 4:48 AM Local: 12:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 1, 10, 12, 37, 0, false);         // UTC: 12:37 PM Local: 8:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 1, 0, 55, 0, false);           // UTC: 12:55 AM Local: 8:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 13, 13, 2, 0, false);          // UTC: 1:02 PM Local: 9:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 27, 6, 55, 0, false);          // UTC: 6:55 AM Local: 2:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 12, 20, 37, 0, false);         // UTC: 8:37 PM Local: 4:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 18, 16, 51, 0, false);         // UTC: 4:51 PM Local: 12:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 19, 9, 27, 0, false);          // UTC: 9:27 AM Local: 5:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 4, 6, 54, 0, false);           // UTC: 6:54 AM Local: 2:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 17, 9, 17, 0, false);          // UTC: 9:17 AM Local: 5:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 14, 13, 17, 0, false);         // UTC: 1:17 PM Local: 9:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 25, 8, 21, 0, false);          // UTC: 8:21 AM Local: 4:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 4, 21, 2, 0, false);           // UTC: 9:02 PM Local: 5:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 4, 1, 58, 0, false);           // UTC: 1:58 AM Local: 9:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 18, 21, 51, 0, false);         // UTC: 9:51 PM Local: 5:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 13, 1, 32, 0, false);          // UTC: 1:32 AM Local: 9:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 19, 21, 52, 0, false);         // UTC: 9:52 PM Local: 5:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 18, 21, 8, 0, false);          // UTC: 9:08 PM Local: 5:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 11, 5, 7, 0, false);           // UTC: 5:07 AM Local: 1:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 4, 23, 40, 0, false);          // UTC: 11:40 PM Local: 7:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 24, 3, 0, 0, false);           // UTC: 3:00 AM Local: 11:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 28, 0, 49, 0, false);          // UTC: 12:49 AM Local: 8:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 20, 8, 29, 0, false);          // UTC: 8:29 AM Local: 4:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 15, 2, 6, 0, false);           // UTC: 2:06 AM Local: 10:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 27, 5, 29, 0, false);          // UTC: 5:29 AM Local: 1:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 1, 19, 27, 0, false);          // UTC: 7:27 PM Local: 3:27 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 2, 12, 13, 13, 0, false);         // UTC: 1:13 PM Local: 9:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 18, 4, 50, 0, false);          // UTC: 4:50 AM Local: 12:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 14, 18, 43, 0, false);         // UTC: 6:43 PM Local: 2:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 21, 13, 23, 0, false);         // UTC: 1:23 PM Local: 9:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 7, 23, 15, 0, false);          // UTC: 11:15 PM Local: 7:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 19, 9, 1, 0, false);           // UTC: 9:01 AM Local: 5:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 5, 16, 34, 0, false);          // UTC: 4:34 PM Local: 12:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 20, 11, 12, 0, false);         // UTC: 11:12 AM Local: 7:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 15, 20, 26, 0, false);         // UTC: 8:26 PM Local: 4:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 19, 23, 48, 0, false);         // UTC: 11:48 PM Local: 7:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 24, 23, 30, 0, false);         // UTC: 11:30 PM Local: 7:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 22, 20, 59, 0, false);         // UTC: 8:59 PM Local: 4:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 7, 1, 44, 0, false);           // UTC: 1:44 AM Local: 9:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 17, 0, 33, 0, false);          // UTC: 12:33 AM Local: 8:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 28, 10, 58, 0, false);         // UTC: 10:58 AM Local: 6:58 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 10, 14, 51, 0, false);         // UTC: 2:51 PM Local: 10:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 4, 12, 11, 0, false);          // UTC: 12:11 PM Local: 8:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 17, 19, 1, 0, false);          // UTC: 7:01 PM Local: 3:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 1, 3, 20, 0, false);           // UTC: 3:20 AM Local: 11:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 10, 0, 47, 0, false);          // UTC: 12:47 AM Local: 8:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 3, 13, 6, 0, false);           // UTC: 1:06 PM Local: 9:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 22, 19, 49, 0, false);         // UTC: 7:49 PM Local: 3:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 15, 14, 3, 0, false);          // UTC: 2:03 PM Local: 10:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 23, 0, 7, 0, false);           // UTC: 12:07 AM Local: 8:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 27, 23, 58, 0, false);         // UTC: 11:58 PM Local: 7:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 3, 8, 22, 36, 0, false);          // UTC: 10:36 PM Local: 6:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 13, 0, 54, 0, false);          // UTC: 12:54 AM Local: 8:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 18, 2, 8, 0, false);           // UTC: 2:08 AM Local: 10:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 3, 20, 56, 0, false);          // UTC: 8:56 PM Local: 4:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 21, 14, 21, 0, false);         // UTC: 2:21 PM Local: 10:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 11, 4, 25, 0, false);          // UTC: 4:25 AM Local: 12:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 18, 3, 32, 0, false);          // UTC: 3:32 AM Local: 11:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 21, 12, 40, 0, false);         // UTC: 12:40 PM Local: 8:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 27, 18, 5, 0, false);          // UTC: 6:05 PM Local: 2:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 15, 12, 11, 0, false);         // UTC: 12:11 PM Local: 8:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 21, 11, 32, 0, false);         // UTC: 11:32 AM Local: 7:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 17, 13, 5, 0, false);          // UTC: 1:05 PM Local: 9:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 20, 6, 11, 0, false);          // UTC: 6:11 AM Local: 2:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 8, 16, 3, 0, false);           // UTC: 4:03 PM Local: 12:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 2, 4, 17, 0, false);           // UTC: 4:17 AM Local: 12:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 14, 1, 29, 0, false);          // UTC: 1:29 AM Local: 9:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 10, 10, 2, 0, false);          // UTC: 10:02 AM Local: 6:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 4, 6, 2, 0, false);            // UTC: 6:02 AM Local: 2:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 16, 4, 59, 0, false);          // UTC: 4:59 AM Local: 12:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 30, 19, 53, 0, false);         // UTC: 7:53 PM Local: 3:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 17, 23, 1, 0, false);          // UTC: 11:01 PM Local: 7:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 10, 2, 31, 0, false);          // UTC: 2:31 AM Local: 10:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 12, 15, 8, 0, false);          // UTC: 3:08 PM Local: 11:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 11, 20, 38, 0, false);         // UTC: 8:38 PM Local: 4:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 11, 8, 21, 0, false);          // UTC: 8:21 AM Local: 4:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 4, 30, 19, 38, 0, false);         // UTC: 7:38 PM Local: 3:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 10, 1, 27, 0, false);          // UTC: 1:27 AM Local: 9:27 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 13, 16, 4, 0, false);          // UTC: 4:04 PM Local: 12:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 3, 21, 35, 0, false);          // UTC: 9:35 PM Local: 5:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 28, 9, 3, 0, false);           // UTC: 9:03 AM Local: 5:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 11, 6, 19, 0, false);          // UTC: 6:19 AM Local: 2:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 20, 9, 22, 0, false);          // UTC: 9:22 AM Local: 5:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 30, 1, 50, 0, false);          // UTC: 1:50 AM Local: 9:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 10, 4, 13, 0, false);          // UTC: 4:13 AM Local: 12:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 2, 21, 49, 0, false);          // UTC: 9:49 PM Local: 5:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 8, 2, 30, 0, false);           // UTC: 2:30 AM Local: 10:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 15, 0, 55, 0, false);          // UTC: 12:55 AM Local: 8:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 10, 12, 11, 0, false);         // UTC: 12:11 PM Local: 8:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 9, 22, 14, 0, false);          // UTC: 10:14 PM Local: 6:14 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 9, 12, 27, 0, false);          // UTC: 12:27 PM Local: 8:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 27, 7, 41, 0, false);          // UTC: 7:41 AM Local: 3:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 1, 1, 7, 0, false);            // UTC: 1:07 AM Local: 9:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 22, 11, 41, 0, false);         // UTC: 11:41 AM Local: 7:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 21, 4, 48, 0, false);          // UTC: 4:48 AM Local: 12:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 2, 0, 30, 0, false);           // UTC: 12:30 AM Local: 8:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 23, 9, 49, 0, false);          // UTC: 9:49 AM Local: 5:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 28, 0, 44, 0, false);          // UTC: 12:44 AM Local: 8:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 27, 12, 26, 0, false);         // UTC: 12:26 PM Local: 8:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 26, 0, 33, 0, false);          // UTC: 12:33 AM Local: 8:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 17, 20, 17, 0, false);         // UTC: 8:17 PM Local: 4:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 5, 26, 9, 49, 0, false);          // UTC: 9:49 AM Local: 5:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 18, 5, 43, 0, false);          // UTC: 5:43 AM Local: 1:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 29, 2, 32, 0, false);          // UTC: 2:32 AM Local: 10:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 17, 6, 29, 0, false);          // UTC: 6:29 AM Local: 2:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 30, 22, 53, 0, false);         // UTC: 10:53 PM Local: 6:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 28, 21, 34, 0, false);         // UTC: 9:34 PM Local: 5:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 3, 0, 18, 0, false);           // UTC: 12:18 AM Local: 8:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 25, 21, 5, 0, false);          // UTC: 9:05 PM Local: 5:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 23, 14, 13, 0, false);         // UTC: 2:13 PM Local: 10:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 5, 23, 30, 0, false);          // UTC: 11:30 PM Local: 7:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 15, 19, 59, 0, false);         // UTC: 7:59 PM Local: 3:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 21, 10, 19, 0, false);         // UTC: 10:19 AM Local: 6:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 19, 8, 16, 0, false);          // UTC: 8:16 AM Local: 4:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 23, 18, 57, 0, false);         // UTC: 6:57 PM Local: 2:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 24, 11, 32, 0, false);         // UTC: 11:32 AM Local: 7:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 11, 9, 47, 0, false);          // UTC: 9:47 AM Local: 5:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 7, 4, 49, 0, false);           // UTC: 4:49 AM Local: 12:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 26, 10, 22, 0, false);         // UTC: 10:22 AM Local: 6:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 27, 6, 44, 0, false);          // UTC: 6:44 AM Local: 2:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 18, 15, 46, 0, false);         // UTC: 3:46 PM Local: 11:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 22, 19, 20, 0, false);         // UTC: 7:20 PM Local: 3:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 20, 4, 34, 0, false);          // UTC: 4:34 AM Local: 12:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 30, 9, 48, 0, false);          // UTC: 9:48 AM Local: 5:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 3, 22, 40, 0, false);          // UTC: 10:40 PM Local: 6:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 14, 2, 29, 0, false);          // UTC: 2:29 AM Local: 10:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 6, 14, 11, 12, 0, false);         // UTC: 11:12 AM Local: 7:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 26, 2, 43, 0, false);          // UTC: 2:43 AM Local: 10:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 10, 19, 45, 0, false);         // UTC: 7:45 PM Local: 3:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 17, 23, 15, 0, false);         // UTC: 11:15 PM Local: 7:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 9, 9, 54, 0, false);           // UTC: 9:54 AM Local: 5:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 14, 3, 33, 0, false);          // UTC: 3:33 AM Local: 11:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 11, 14, 25, 0, false);         // UTC: 2:25 PM Local: 10:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 7, 20, 16, 0, false);          // UTC: 8:16 PM Local: 4:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 26, 5, 39, 0, false);          // UTC: 5:39 AM Local: 1:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 18, 6, 29, 0, false);          // UTC: 6:29 AM Local: 2:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 10, 0, 20, 0, false);          // UTC: 12:20 AM Local: 8:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 10, 2, 36, 0, false);          // UTC: 2:36 AM Local: 10:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 22, 1, 32, 0, false);          // UTC: 1:32 AM Local: 9:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 10, 13, 6, 0, false);          // UTC: 1:06 PM Local: 9:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 26, 13, 41, 0, false);         // UTC: 1:41 PM Local: 9:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 27, 21, 13, 0, false);         // UTC: 9:13 PM Local: 5:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 28, 18, 43, 0, false);         // UTC: 6:43 PM Local: 2:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 5, 2, 37, 0, false);           // UTC: 2:37 AM Local: 10:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 28, 6, 7, 0, false);           // UTC: 6:07 AM Local: 2:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 27, 12, 4, 0, false);          // UTC: 12:04 PM Local: 8:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 4, 3, 44, 0, false);           // UTC: 3:44 AM Local: 11:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 5, 13, 14, 0, false);          // UTC: 1:14 PM Local: 9:14 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 23, 23, 33, 0, false);         // UTC: 11:33 PM Local: 7:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 20, 11, 43, 0, false);         // UTC: 11:43 AM Local: 7:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 25, 19, 47, 0, false);         // UTC: 7:47 PM Local: 3:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 7, 26, 14, 51, 0, false);         // UTC: 2:51 PM Local: 10:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 1, 12, 36, 0, false);          // UTC: 12:36 PM Local: 8:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 4, 15, 49, 0, false);          // UTC: 3:49 PM Local: 11:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 20, 18, 49, 0, false);         // UTC: 6:49 PM Local: 2:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 7, 21, 5, 0, false);           // UTC: 9:05 PM Local: 5:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 6, 8, 29, 0, false);           // UTC: 8:29 AM Local: 4:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 5, 4, 7, 0, false);            // UTC: 4:07 AM Local: 12:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 4, 5, 1, 0, false);            // UTC: 5:01 AM Local: 1:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 21, 6, 46, 0, false);          // UTC: 6:46 AM Local: 2:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 11, 1, 1, 0, false);           // UTC: 1:01 AM Local: 9:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 18, 11, 56, 0, false);         // UTC: 11:56 AM Local: 7:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 27, 21, 5, 0, false);          // UTC: 9:05 PM Local: 5:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 18, 4, 44, 0, false);          // UTC: 4:44 AM Local: 12:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 5, 23, 18, 0, false);          // UTC: 11:18 PM Local: 7:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 10, 13, 48, 0, false);         // UTC: 1:48 PM Local: 9:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 12, 19, 30, 0, false);         // UTC: 7:30 PM Local: 3:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 10, 13, 38, 0, false);         // UTC: 1:38 PM Local: 9:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 24, 12, 38, 0, false);         // UTC: 12:38 PM Local: 8:38 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 19, 11, 56, 0, false);         // UTC: 11:56 AM Local: 7:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 20, 9, 26, 0, false);          // UTC: 9:26 AM Local: 5:26 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 29, 4, 46, 0, false);          // UTC: 4:46 AM Local: 12:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 11, 14, 58, 0, false);         // UTC: 2:58 PM Local: 10:58 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 15, 17, 5, 0, false);          // UTC: 5:05 PM Local: 1:05 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 6, 0, 30, 0, false);           // UTC: 12:30 AM Local: 8:30 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 7, 10, 23, 0, false);          // UTC: 10:23 AM Local: 6:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 8, 2, 21, 37, 0, false);          // UTC: 9:37 PM Local: 5:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 15, 21, 21, 0, false);         // UTC: 9:21 PM Local: 5:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 4, 2, 45, 0, false);           // UTC: 2:45 AM Local: 10:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 5, 2, 9, 0, false);            // UTC: 2:09 AM Local: 10:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 27, 7, 37, 0, false);          // UTC: 7:37 AM Local: 3:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 20, 9, 24, 0, false);          // UTC: 9:24 AM Local: 5:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 1, 7, 42, 0, false);           // UTC: 7:42 AM Local: 3:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 18, 9, 48, 0, false);          // UTC: 9:48 AM Local: 5:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 20, 23, 43, 0, false);         // UTC: 11:43 PM Local: 7:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 27, 23, 39, 0, false);         // UTC: 11:39 PM Local: 7:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 14, 14, 20, 0, false);         // UTC: 2:20 PM Local: 10:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 20, 6, 16, 0, false);          // UTC: 6:16 AM Local: 2:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 4, 13, 1, 0, false);           // UTC: 1:01 PM Local: 9:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 19, 6, 9, 0, false);           // UTC: 6:09 AM Local: 2:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 26, 9, 52, 0, false);          // UTC: 9:52 AM Local: 5:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 21, 1, 44, 0, false);          // UTC: 1:44 AM Local: 9:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 30, 13, 49, 0, false);         // UTC: 1:49 PM Local: 9:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 12, 16, 17, 0, false);         // UTC: 4:17 PM Local: 12:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 11, 7, 23, 0, false);          // UTC: 7:23 AM Local: 3:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 15, 15, 50, 0, false);         // UTC: 3:50 PM Local: 11:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 15, 10, 16, 0, false);         // UTC: 10:16 AM Local: 6:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 6, 20, 20, 0, false);          // UTC: 8:20 PM Local: 4:20 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 30, 17, 38, 0, false);         // UTC: 5:38 PM Local: 1:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 5, 14, 6, 0, false);           // UTC: 2:06 PM Local: 10:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 1, 2, 47, 0, false);           // UTC: 2:47 AM Local: 10:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 9, 12, 17, 28, 0, false);         // UTC: 5:28 PM Local: 1:28 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 13, 9, 13, 0, false);         // UTC: 9:13 AM Local: 5:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 26, 20, 1, 0, false);         // UTC: 8:01 PM Local: 4:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 4, 2, 56, 0, false);          // UTC: 2:56 AM Local: 10:56 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 1, 7, 9, 0, false);           // UTC: 7:09 AM Local: 3:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 3, 16, 26, 0, false);         // UTC: 4:26 PM Local: 12:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 2, 1, 3, 0, false);           // UTC: 1:03 AM Local: 9:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 28, 8, 54, 0, false);         // UTC: 8:54 AM Local: 4:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 10, 7, 53, 0, false);         // UTC: 7:53 AM Local: 3:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 14, 9, 31, 0, false);         // UTC: 9:31 AM Local: 5:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 1, 9, 2, 0, false);           // UTC: 9:02 AM Local: 5:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 5, 8, 7, 0, false);           // UTC: 8:07 AM Local: 4:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 23, 23, 36, 0, false);        // UTC: 11:36 PM Local: 7:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 6, 20, 3, 0, false);          // UTC: 8:03 PM Local: 4:03 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 18, 13, 0, 0, false);         // UTC: 1:00 PM Local: 9:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 23, 6, 44, 0, false);         // UTC: 6:44 AM Local: 2:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 16, 11, 22, 0, false);        // UTC: 11:22 AM Local: 7:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 15, 1, 16, 0, false);         // UTC: 1:16 AM Local: 9:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 2, 23, 13, 0, false);         // UTC: 11:13 PM Local: 7:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 21, 17, 7, 0, false);         // UTC: 5:07 PM Local: 1:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 13, 5, 35, 0, false);         // UTC: 5:35 AM Local: 1:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 7, 19, 39, 0, false);         // UTC: 7:39 PM Local: 3:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 12, 9, 41, 0, false);         // UTC: 9:41 AM Local: 5:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 13, 16, 1, 0, false);         // UTC: 4:01 PM Local: 12:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 10, 12, 0, 0, false);         // UTC: 12:00 PM Local: 8:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 10, 10, 11, 32, 0, false);        // UTC: 11:32 AM Local: 7:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 11, 16, 32, 0, false);        // UTC: 4:32 PM Local: 12:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 23, 3, 22, 0, false);         // UTC: 3:22 AM Local: 11:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 17, 16, 4, 0, false);         // UTC: 4:04 PM Local: 12:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 18, 9, 5, 0, false);          // UTC: 9:05 AM Local: 5:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 11, 18, 25, 0, false);        // UTC: 6:25 PM Local: 2:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 21, 21, 58, 0, false);        // UTC: 9:58 PM Local: 5:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 7, 18, 41, 0, false);         // UTC: 6:41 PM Local: 2:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 17, 8, 43, 0, false);         // UTC: 8:43 AM Local: 4:43 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 2, 4, 44, 0, false);          // UTC: 4:44 AM Local: 12:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 17, 21, 46, 0, false);        // UTC: 9:46 PM Local: 5:46 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 15, 14, 25, 0, false);        // UTC: 2:25 PM Local: 10:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 11, 23, 36, 0, false);        // UTC: 11:36 PM Local: 7:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 23, 10, 4, 0, false);         // UTC: 10:04 AM Local: 6:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 25, 11, 21, 0, false);        // UTC: 11:21 AM Local: 7:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 13, 16, 43, 0, false);        // UTC: 4:43 PM Local: 12:43 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 15, 8, 29, 0, false);         // UTC: 8:29 AM Local: 4:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 27, 16, 18, 0, false);        // UTC: 4:18 PM Local: 12:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 3, 13, 13, 0, false);         // UTC: 1:13 PM Local: 9:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 6, 16, 13, 0, false);         // UTC: 4:13 PM Local: 12:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 2, 23, 45, 0, false);         // UTC: 11:45 PM Local: 7:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 8, 3, 36, 0, false);          // UTC: 3:36 AM Local: 11:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 21, 8, 48, 0, false);         // UTC: 8:48 AM Local: 4:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 8, 17, 12, 0, false);         // UTC: 5:12 PM Local: 1:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 1, 7, 30, 0, false);          // UTC: 7:30 AM Local: 3:30 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 11, 6, 10, 25, 0, false);         // UTC: 10:25 AM Local: 6:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 4, 6, 40, 0, false);          // UTC: 6:40 AM Local: 2:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 30, 8, 19, 0, false);         // UTC: 8:19 AM Local: 4:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 11, 9, 56, 0, false);         // UTC: 9:56 AM Local: 5:56 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 25, 16, 0, 0, false);         // UTC: 4:00 PM Local: 12:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 1, 12, 36, 0, false);         // UTC: 12:36 PM Local: 8:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 23, 20, 15, 0, false);        // UTC: 8:15 PM Local: 4:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 2, 6, 9, 0, false);           // UTC: 6:09 AM Local: 2:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 9, 1, 51, 0, false);          // UTC: 1:51 AM Local: 9:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 5, 22, 52, 0, false);         // UTC: 10:52 PM Local: 6:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 8, 17, 29, 0, false);         // UTC: 5:29 PM Local: 1:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 23, 14, 57, 0, false);        // UTC: 2:57 PM Local: 10:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 20, 3, 9, 0, false);          // UTC: 3:09 AM Local: 11:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 20, 23, 7, 0, false);         // UTC: 11:07 PM Local: 7:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 9, 11, 24, 0, false);         // UTC: 11:24 AM Local: 7:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 3, 15, 16, 0, false);         // UTC: 3:16 PM Local: 11:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 15, 23, 45, 0, false);        // UTC: 11:45 PM Local: 7:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 17, 1, 37, 0, false);         // UTC: 1:37 AM Local: 9:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 28, 20, 40, 0, false);        // UTC: 8:40 PM Local: 4:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 16, 17, 32, 0, false);        // UTC: 5:32 PM Local: 1:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 24, 17, 17, 0, false);        // UTC: 5:17 PM Local: 1:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 30, 1, 2, 0, false);          // UTC: 1:02 AM Local: 9:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 7, 7, 24, 0, false);          // UTC: 7:24 AM Local: 3:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 25, 8, 3, 0, false);          // UTC: 8:03 AM Local: 4:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 8, 19, 26, 0, false);         // UTC: 7:26 PM Local: 3:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2019, 12, 16, 18, 22, 0, false);        // UTC: 6:22 PM Local: 2:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 20, 22, 38, 0, false);         // UTC: 10:38 PM Local: 6:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 14, 1, 15, 0, false);          // UTC: 1:15 AM Local: 9:15 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 14, 1, 46, 0, false);          // UTC: 1:46 AM Local: 9:46 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 29, 9, 52, 0, false);          // UTC: 9:52 AM Local: 5:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 11, 22, 36, 0, false);         // UTC: 10:36 PM Local: 6:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 10, 7, 13, 0, false);          // UTC: 7:13 AM Local: 3:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 17, 22, 44, 0, false);         // UTC: 10:44 PM Local: 6:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 13, 22, 24, 0, false);         // UTC: 10:24 PM Local: 6:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 21, 3, 51, 0, false);          // UTC: 3:51 AM Local: 11:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 2, 15, 34, 0, false);          // UTC: 3:34 PM Local: 11:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 28, 3, 14, 0, false);          // UTC: 3:14 AM Local: 11:14 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 20, 20, 59, 0, false);         // UTC: 8:59 PM Local: 4:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 22, 8, 3, 0, false);           // UTC: 8:03 AM Local: 4:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 15, 5, 42, 0, false);          // UTC: 5:42 AM Local: 1:42 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 31, 20, 44, 0, false);         // UTC: 8:44 PM Local: 4:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 21, 4, 31, 0, false);          // UTC: 4:31 AM Local: 12:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 23, 5, 39, 0, false);          // UTC: 5:39 AM Local: 1:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 17, 4, 57, 0, false);          // UTC: 4:57 AM Local: 12:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 15, 15, 11, 0, false);         // UTC: 3:11 PM Local: 11:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 9, 0, 48, 0, false);           // UTC: 12:48 AM Local: 8:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 26, 18, 33, 0, false);         // UTC: 6:33 PM Local: 2:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 30, 9, 46, 0, false);          // UTC: 9:46 AM Local: 5:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 19, 22, 38, 0, false);         // UTC: 10:38 PM Local: 6:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 1, 15, 3, 0, false);           // UTC: 3:03 PM Local: 11:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 1, 24, 19, 37, 0, false);         // UTC: 7:37 PM Local: 3:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 10, 16, 12, 0, false);         // UTC: 4:12 PM Local: 12:12 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 11, 11, 22, 0, false);         // UTC: 11:22 AM Local: 7:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 28, 2, 55, 0, false);          // UTC: 2:55 AM Local: 10:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 16, 19, 51, 0, false);         // UTC: 7:51 PM Local: 3:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 5, 12, 16, 0, false);          // UTC: 12:16 PM Local: 8:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 19, 6, 24, 0, false);          // UTC: 6:24 AM Local: 2:24 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 10, 3, 46, 0, false);          // UTC: 3:46 AM Local: 11:46 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 28, 20, 21, 0, false);         // UTC: 8:21 PM Local: 4:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 10, 12, 10, 0, false);         // UTC: 12:10 PM Local: 8:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 4, 12, 12, 0, false);          // UTC: 12:12 PM Local: 8:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 23, 14, 34, 0, false);         // UTC: 2:34 PM Local: 10:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 7, 9, 51, 0, false);           // UTC: 9:51 AM Local: 5:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 17, 10, 21, 0, false);         // UTC: 10:21 AM Local: 6:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 2, 1, 41, 0, false);           // UTC: 1:41 AM Local: 9:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 8, 12, 33, 0, false);          // UTC: 12:33 PM Local: 8:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 22, 18, 6, 0, false);          // UTC: 6:06 PM Local: 2:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 26, 19, 25, 0, false);         // UTC: 7:25 PM Local: 3:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 5, 1, 18, 0, false);           // UTC: 1:18 AM Local: 9:18 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 9, 15, 36, 0, false);          // UTC: 3:36 PM Local: 11:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 24, 2, 21, 0, false);          // UTC: 2:21 AM Local: 10:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 15, 5, 46, 0, false);          // UTC: 5:46 AM Local: 1:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 17, 19, 46, 0, false);         // UTC: 7:46 PM Local: 3:46 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 14, 20, 0, 0, false);          // UTC: 8:00 PM Local: 4:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 11, 16, 49, 0, false);         // UTC: 4:49 PM Local: 12:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 2, 3, 19, 39, 0, false);          // UTC: 7:39 PM Local: 3:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 30, 12, 29, 0, false);         // UTC: 12:29 PM Local: 8:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 27, 3, 48, 0, false);          // UTC: 3:48 AM Local: 11:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 1, 4, 23, 0, false);           // UTC: 4:23 AM Local: 12:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 22, 2, 13, 0, false);          // UTC: 2:13 AM Local: 10:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 9, 18, 10, 0, false);          // UTC: 6:10 PM Local: 2:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 26, 20, 53, 0, false);         // UTC: 8:53 PM Local: 4:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 18, 6, 13, 0, false);          // UTC: 6:13 AM Local: 2:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 10, 9, 54, 0, false);          // UTC: 9:54 AM Local: 5:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 19, 12, 40, 0, false);         // UTC: 12:40 PM Local: 8:40 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 18, 2, 26, 0, false);          // UTC: 2:26 AM Local: 10:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 19, 0, 0, 0, false);           // UTC: 12:00 AM Local: 8:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 22, 16, 58, 0, false);         // UTC: 4:58 PM Local: 12:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 11, 4, 46, 0, false);          // UTC: 4:46 AM Local: 12:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 27, 23, 0, 0, false);          // UTC: 11:00 PM Local: 7:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 12, 20, 24, 0, false);         // UTC: 8:24 PM Local: 4:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 17, 14, 33, 0, false);         // UTC: 2:33 PM Local: 10:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 22, 12, 21, 0, false);         // UTC: 12:21 PM Local: 8:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 4, 1, 39, 0, false);           // UTC: 1:39 AM Local: 9:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 20, 4, 35, 0, false);          // UTC: 4:35 AM Local: 12:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 24, 16, 40, 0, false);         // UTC: 4:40 PM Local: 12:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 23, 22, 39, 0, false);         // UTC: 10:39 PM Local: 6:39 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 17, 3, 47, 0, false);          // UTC: 3:47 AM Local: 11:47 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 14, 15, 51, 0, false);         // UTC: 3:51 PM Local: 11:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 27, 1, 37, 0, false);          // UTC: 1:37 AM Local: 9:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 3, 31, 15, 20, 0, false);         // UTC: 3:20 PM Local: 11:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 5, 18, 13, 0, false);          // UTC: 6:13 PM Local: 2:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 24, 10, 9, 0, false);          // UTC: 10:09 AM Local: 6:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 9, 16, 34, 0, false);          // UTC: 4:34 PM Local: 12:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 17, 5, 23, 0, false);          // UTC: 5:23 AM Local: 1:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 29, 11, 31, 0, false);         // UTC: 11:31 AM Local: 7:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 2, 6, 13, 0, false);           // UTC: 6:13 AM Local: 2:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 10, 17, 29, 0, false);         // UTC: 5:29 PM Local: 1:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 30, 11, 8, 0, false);          // UTC: 11:08 AM Local: 7:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 8, 11, 53, 0, false);          // UTC: 11:53 AM Local: 7:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 13, 11, 53, 0, false);         // UTC: 11:53 AM Local: 7:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 3, 23, 37, 0, false);          // UTC: 11:37 PM Local: 7:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 24, 12, 10, 0, false);         // UTC: 12:10 PM Local: 8:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 23, 19, 42, 0, false);         // UTC: 7:42 PM Local: 3:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 3, 14, 35, 0, false);          // UTC: 2:35 PM Local: 10:35 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 14, 8, 14, 0, false);          // UTC: 8:14 AM Local: 4:14 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 14, 6, 17, 0, false);          // UTC: 6:17 AM Local: 2:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 28, 0, 42, 0, false);          // UTC: 12:42 AM Local: 8:42 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 3, 18, 6, 0, false);           // UTC: 6:06 PM Local: 2:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 23, 22, 19, 0, false);         // UTC: 10:19 PM Local: 6:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 2, 14, 3, 0, false);           // UTC: 2:03 PM Local: 10:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 1, 11, 4, 0, false);           // UTC: 11:04 AM Local: 7:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 7, 11, 45, 0, false);          // UTC: 11:45 AM Local: 7:45 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 24, 7, 14, 0, false);          // UTC: 7:14 AM Local: 3:14 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 10, 23, 33, 0, false);         // UTC: 11:33 PM Local: 7:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 4, 16, 18, 29, 0, false);         // UTC: 6:29 PM Local: 2:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 14, 20, 40, 0, false);         // UTC: 8:40 PM Local: 4:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 28, 15, 28, 0, false);         // UTC: 3:28 PM Local: 11:28 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 2, 13, 41, 0, false);          // UTC: 1:41 PM Local: 9:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 21, 14, 23, 0, false);         // UTC: 2:23 PM Local: 10:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 14, 16, 23, 0, false);         // UTC: 4:23 PM Local: 12:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 20, 6, 21, 0, false);          // UTC: 6:21 AM Local: 2:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 23, 18, 46, 0, false);         // UTC: 6:46 PM Local: 2:46 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 21, 9, 11, 0, false);          // UTC: 9:11 AM Local: 5:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 23, 8, 20, 0, false);          // UTC: 8:20 AM Local: 4:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 24, 3, 4, 0, false);           // UTC: 3:04 AM Local: 11:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 31, 23, 45, 0, false);         // UTC: 11:45 PM Local: 7:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 30, 16, 14, 0, false);         // UTC: 4:14 PM Local: 12:14 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 23, 4, 0, 0, false);           // UTC: 4:00 AM Local: 12:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 21, 11, 3, 0, false);          // UTC: 11:03 AM Local: 7:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 17, 15, 29, 0, false);         // UTC: 3:29 PM Local: 11:29 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 17, 12, 1, 0, false);          // UTC: 12:01 PM Local: 8:01 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 22, 12, 59, 0, false);         // UTC: 12:59 PM Local: 8:59 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 29, 1, 4, 0, false);           // UTC: 1:04 AM Local: 9:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 20, 9, 37, 0, false);          // UTC: 9:37 AM Local: 5:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 20, 4, 46, 0, false);          // UTC: 4:46 AM Local: 12:46 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 15, 10, 4, 0, false);          // UTC: 10:04 AM Local: 6:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 14, 17, 50, 0, false);         // UTC: 5:50 PM Local: 1:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 3, 22, 24, 0, false);          // UTC: 10:24 PM Local: 6:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 23, 4, 22, 0, false);          // UTC: 4:22 AM Local: 12:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 5, 13, 8, 54, 0, false);          // UTC: 8:54 AM Local: 4:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 5, 0, 13, 0, false);           // UTC: 12:13 AM Local: 8:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 24, 0, 24, 0, false);          // UTC: 12:24 AM Local: 8:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 23, 2, 32, 0, false);          // UTC: 2:32 AM Local: 10:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 1, 8, 17, 0, false);           // UTC: 8:17 AM Local: 4:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 15, 4, 32, 0, false);          // UTC: 4:32 AM Local: 12:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 8, 11, 12, 0, false);          // UTC: 11:12 AM Local: 7:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 16, 13, 58, 0, false);         // UTC: 1:58 PM Local: 9:58 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 29, 18, 52, 0, false);         // UTC: 6:52 PM Local: 2:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 11, 10, 57, 0, false);         // UTC: 10:57 AM Local: 6:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 14, 11, 19, 0, false);         // UTC: 11:19 AM Local: 7:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 8, 3, 55, 0, false);           // UTC: 3:55 AM Local: 11:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 8, 11, 58, 0, false);          // UTC: 11:58 AM Local: 7:58 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 7, 23, 0, 0, false);           // UTC: 11:00 PM Local: 7:00 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 3, 21, 35, 0, false);          // UTC: 9:35 PM Local: 5:35 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 30, 9, 7, 0, false);           // UTC: 9:07 AM Local: 5:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 21, 15, 39, 0, false);         // UTC: 3:39 PM Local: 11:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 10, 11, 21, 0, false);         // UTC: 11:21 AM Local: 7:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 30, 9, 13, 0, false);          // UTC: 9:13 AM Local: 5:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 17, 0, 59, 0, false);          // UTC: 12:59 AM Local: 8:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 13, 21, 10, 0, false);         // UTC: 9:10 PM Local: 5:10 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 26, 22, 46, 0, false);         // UTC: 10:46 PM Local: 6:46 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 12, 13, 33, 0, false);         // UTC: 1:33 PM Local: 9:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 16, 15, 31, 0, false);         // UTC: 3:31 PM Local: 11:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 29, 15, 49, 0, false);         // UTC: 3:49 PM Local: 11:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 6, 14, 16, 9, 0, false);          // UTC: 4:09 PM Local: 12:09 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 30, 7, 37, 0, false);          // UTC: 7:37 AM Local: 3:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 19, 19, 48, 0, false);         // UTC: 7:48 PM Local: 3:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 12, 4, 16, 0, false);          // UTC: 4:16 AM Local: 12:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 6, 13, 22, 0, false);          // UTC: 1:22 PM Local: 9:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 28, 7, 5, 0, false);           // UTC: 7:05 AM Local: 3:05 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 25, 16, 31, 0, false);         // UTC: 4:31 PM Local: 12:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 4, 5, 52, 0, false);           // UTC: 5:52 AM Local: 1:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 4, 17, 1, 0, false);           // UTC: 5:01 PM Local: 1:01 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 31, 19, 52, 0, false);         // UTC: 7:52 PM Local: 3:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 31, 4, 8, 0, false);           // UTC: 4:08 AM Local: 12:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 23, 4, 52, 0, false);          // UTC: 4:52 AM Local: 12:52 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 22, 18, 53, 0, false);         // UTC: 6:53 PM Local: 2:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 30, 22, 22, 0, false);         // UTC: 10:22 PM Local: 6:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 1, 13, 39, 0, false);          // UTC: 1:39 PM Local: 9:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 3, 10, 32, 0, false);          // UTC: 10:32 AM Local: 6:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 8, 10, 49, 0, false);          // UTC: 10:49 AM Local: 6:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 16, 14, 44, 0, false);         // UTC: 2:44 PM Local: 10:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 19, 23, 53, 0, false);         // UTC: 11:53 PM Local: 7:53 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 22, 8, 20, 0, false);          // UTC: 8:20 AM Local: 4:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 26, 1, 40, 0, false);          // UTC: 1:40 AM Local: 9:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 6, 16, 32, 0, false);          // UTC: 4:32 PM Local: 12:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 5, 12, 15, 0, false);          // UTC: 12:15 PM Local: 8:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 13, 22, 22, 0, false);         // UTC: 10:22 PM Local: 6:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 31, 2, 58, 0, false);          // UTC: 2:58 AM Local: 10:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 7, 7, 21, 4, 0, false);           // UTC: 9:04 PM Local: 5:04 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 3, 9, 13, 0, false);           // UTC: 9:13 AM Local: 5:13 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 8, 17, 37, 0, false);          // UTC: 5:37 PM Local: 1:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 25, 0, 38, 0, false);          // UTC: 12:38 AM Local: 8:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 7, 1, 52, 0, false);           // UTC: 1:52 AM Local: 9:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 16, 3, 44, 0, false);          // UTC: 3:44 AM Local: 11:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 27, 12, 54, 0, false);         // UTC: 12:54 PM Local: 8:54 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 4, 2, 44, 0, false);           // UTC: 2:44 AM Local: 10:44 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 6, 19, 40, 0, false);          // UTC: 7:40 PM Local: 3:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 4, 23, 26, 0, false);          // UTC: 11:26 PM Local: 7:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 6, 19, 22, 0, false);          // UTC: 7:22 PM Local: 3:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 4, 6, 49, 0, false);           // UTC: 6:49 AM Local: 2:49 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 16, 4, 31, 0, false);          // UTC: 4:31 AM Local: 12:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 23, 9, 50, 0, false);          // UTC: 9:50 AM Local: 5:50 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 10, 10, 22, 0, false);         // UTC: 10:22 AM Local: 6:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 22, 22, 32, 0, false);         // UTC: 10:32 PM Local: 6:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 17, 12, 37, 0, false);         // UTC: 12:37 PM Local: 8:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 31, 8, 51, 0, false);          // UTC: 8:51 AM Local: 4:51 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 7, 11, 53, 0, false);          // UTC: 11:53 AM Local: 7:53 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 10, 21, 40, 0, false);         // UTC: 9:40 PM Local: 5:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 24, 15, 11, 0, false);         // UTC: 3:11 PM Local: 11:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 8, 1, 49, 0, false);           // UTC: 1:49 AM Local: 9:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 19, 19, 57, 0, false);         // UTC: 7:57 PM Local: 3:57 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 6, 15, 28, 0, false);          // UTC: 3:28 PM Local: 11:28 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 3, 15, 6, 0, false);           // UTC: 3:06 PM Local: 11:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 8, 3, 21, 2, 0, false);           // UTC: 9:02 PM Local: 5:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 22, 18, 48, 0, false);         // UTC: 6:48 PM Local: 2:48 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 7, 13, 27, 0, false);          // UTC: 1:27 PM Local: 9:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 8, 15, 11, 0, false);          // UTC: 3:11 PM Local: 11:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 7, 8, 22, 0, false);           // UTC: 8:22 AM Local: 4:22 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 7, 15, 2, 0, false);           // UTC: 3:02 PM Local: 11:02 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 18, 2, 6, 0, false);           // UTC: 2:06 AM Local: 10:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 9, 8, 20, 0, false);           // UTC: 8:20 AM Local: 4:20 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 6, 11, 55, 0, false);          // UTC: 11:55 AM Local: 7:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 5, 12, 4, 0, false);           // UTC: 12:04 PM Local: 8:04 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 21, 22, 38, 0, false);         // UTC: 10:38 PM Local: 6:38 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 19, 8, 12, 0, false);          // UTC: 8:12 AM Local: 4:12 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 5, 17, 21, 0, false);          // UTC: 5:21 PM Local: 1:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 14, 2, 54, 0, false);          // UTC: 2:54 AM Local: 10:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 21, 8, 18, 0, false);          // UTC: 8:18 AM Local: 4:18 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 10, 14, 3, 0, false);          // UTC: 2:03 PM Local: 10:03 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 20, 20, 58, 0, false);         // UTC: 8:58 PM Local: 4:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 7, 3, 21, 0, false);           // UTC: 3:21 AM Local: 11:21 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 30, 11, 34, 0, false);         // UTC: 11:34 AM Local: 7:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 26, 14, 47, 0, false);         // UTC: 2:47 PM Local: 10:47 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 2, 4, 28, 0, false);           // UTC: 4:28 AM Local: 12:28 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 25, 8, 41, 0, false);          // UTC: 8:41 AM Local: 4:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 20, 22, 25, 0, false);         // UTC: 10:25 PM Local: 6:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 22, 22, 58, 0, false);         // UTC: 10:58 PM Local: 6:58 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 12, 3, 29, 0, false);          // UTC: 3:29 AM Local: 11:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 9, 15, 18, 37, 0, false);         // UTC: 6:37 PM Local: 2:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 16, 7, 31, 0, false);         // UTC: 7:31 AM Local: 3:31 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 10, 20, 40, 0, false);        // UTC: 8:40 PM Local: 4:40 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 6, 14, 21, 0, false);         // UTC: 2:21 PM Local: 10:21 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 30, 11, 23, 0, false);        // UTC: 11:23 AM Local: 7:23 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 24, 13, 36, 0, false);        // UTC: 1:36 PM Local: 9:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 6, 13, 44, 0, false);         // UTC: 1:44 PM Local: 9:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 11, 3, 55, 0, false);         // UTC: 3:55 AM Local: 11:55 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 24, 2, 50, 0, false);         // UTC: 2:50 AM Local: 10:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 10, 7, 0, 0, false);          // UTC: 7:00 AM Local: 3:00 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 3, 0, 22, 0, false);          // UTC: 12:22 AM Local: 8:22 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 8, 10, 7, 0, false);          // UTC: 10:07 AM Local: 6:07 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 29, 6, 34, 0, false);         // UTC: 6:34 AM Local: 2:34 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 22, 11, 6, 0, false);         // UTC: 11:06 AM Local: 7:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 14, 11, 27, 0, false);        // UTC: 11:27 AM Local: 7:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 6, 11, 41, 0, false);         // UTC: 11:41 AM Local: 7:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 6, 9, 6, 0, false);           // UTC: 9:06 AM Local: 5:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 21, 8, 8, 0, false);          // UTC: 8:08 AM Local: 4:08 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 23, 21, 51, 0, false);        // UTC: 9:51 PM Local: 5:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 26, 13, 27, 0, false);        // UTC: 1:27 PM Local: 9:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 20, 16, 25, 0, false);        // UTC: 4:25 PM Local: 12:25 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 31, 7, 15, 0, false);         // UTC: 7:15 AM Local: 3:15 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 13, 14, 48, 0, false);        // UTC: 2:48 PM Local: 10:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 31, 0, 6, 0, false);          // UTC: 12:06 AM Local: 8:06 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 4, 21, 51, 0, false);         // UTC: 9:51 PM Local: 5:51 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 10, 7, 4, 9, 0, false);           // UTC: 4:09 AM Local: 12:09 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 21, 17, 49, 0, false);        // UTC: 5:49 PM Local: 1:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 3, 19, 52, 0, false);         // UTC: 7:52 PM Local: 3:52 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 26, 16, 37, 0, false);        // UTC: 4:37 PM Local: 12:37 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 21, 0, 17, 0, false);         // UTC: 12:17 AM Local: 8:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 6, 11, 48, 0, false);         // UTC: 11:48 AM Local: 7:48 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 7, 9, 36, 0, false);          // UTC: 9:36 AM Local: 5:36 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 11, 12, 44, 0, false);        // UTC: 12:44 PM Local: 8:44 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 20, 4, 33, 0, false);         // UTC: 4:33 AM Local: 12:33 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 16, 18, 54, 0, false);        // UTC: 6:54 PM Local: 2:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 20, 17, 41, 0, false);        // UTC: 5:41 PM Local: 1:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 19, 23, 29, 0, false);        // UTC: 11:29 PM Local: 7:29 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 25, 13, 32, 0, false);        // UTC: 1:32 PM Local: 9:32 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 26, 12, 16, 0, false);        // UTC: 12:16 PM Local: 8:16 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 23, 3, 8, 0, false);          // UTC: 3:08 AM Local: 11:08 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 28, 22, 54, 0, false);        // UTC: 10:54 PM Local: 6:54 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 30, 2, 36, 0, false);         // UTC: 2:36 AM Local: 10:36 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 8, 5, 41, 0, false);          // UTC: 5:41 AM Local: 1:41 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 1, 11, 39, 0, false);         // UTC: 11:39 AM Local: 7:39 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 15, 10, 19, 0, false);        // UTC: 10:19 AM Local: 6:19 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 25, 3, 26, 0, false);         // UTC: 3:26 AM Local: 11:26 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 6, 1, 34, 0, false);          // UTC: 1:34 AM Local: 9:34 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 11, 0, 24, 0, false);         // UTC: 12:24 AM Local: 8:24 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 14, 3, 45, 0, false);         // UTC: 3:45 AM Local: 11:45 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 14, 15, 17, 0, false);        // UTC: 3:17 PM Local: 11:17 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 11, 3, 7, 18, 0, false);          // UTC: 7:18 AM Local: 3:18 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 31, 23, 19, 0, false);        // UTC: 11:19 PM Local: 7:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 10, 3, 7, 0, false);          // UTC: 3:07 AM Local: 11:07 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 20, 19, 49, 0, false);        // UTC: 7:49 PM Local: 3:49 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 12, 23, 59, 0, false);        // UTC: 11:59 PM Local: 7:59 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 7, 7, 55, 0, false);          // UTC: 7:55 AM Local: 3:55 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 27, 16, 2, 0, false);         // UTC: 4:02 PM Local: 12:02 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 19, 6, 11, 0, false);         // UTC: 6:11 AM Local: 2:11 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 15, 1, 19, 0, false);         // UTC: 1:19 AM Local: 9:19 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 27, 20, 31, 0, false);        // UTC: 8:31 PM Local: 4:31 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 1, 23, 50, 0, false);         // UTC: 11:50 PM Local: 7:50 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 12, 21, 23, 0, false);        // UTC: 9:23 PM Local: 5:23 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 29, 18, 32, 0, false);        // UTC: 6:32 PM Local: 2:32 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 13, 5, 27, 0, false);         // UTC: 5:27 AM Local: 1:27 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 28, 1, 41, 0, false);         // UTC: 1:41 AM Local: 9:41 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 4, 4, 37, 0, false);          // UTC: 4:37 AM Local: 12:37 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 10, 0, 17, 0, false);         // UTC: 12:17 AM Local: 8:17 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 4, 2, 13, 0, false);          // UTC: 2:13 AM Local: 10:13 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 19, 19, 16, 0, false);        // UTC: 7:16 PM Local: 3:16 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 30, 4, 6, 0, false);          // UTC: 4:06 AM Local: 12:06 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 22, 9, 57, 0, false);         // UTC: 9:57 AM Local: 5:57 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 22, 23, 27, 0, false);        // UTC: 11:27 PM Local: 7:27 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 11, 17, 33, 0, false);        // UTC: 5:33 PM Local: 1:33 AM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 16, 8, 10, 0, false);         // UTC: 8:10 AM Local: 4:10 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 28, 11, 25, 0, false);        // UTC: 11:25 AM Local: 7:25 PM Offset: 08:00:00
+	testCount++; failedCount += test(timeManager, 18, 2020, 12, 6, 17, 24, 0, false);         // UTC: 5:24 PM Local: 1:24 AM Offset: 08:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
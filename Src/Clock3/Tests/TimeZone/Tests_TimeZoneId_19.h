@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_19_H
+#define TEST_TIMEZONEID_19_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_19_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 22, 1, 50, 0, true);           // UTC: 1:50 AM Local: 12:20 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 29, 16, 7, 0, true);           // UTC: 4:07 PM Local: 2:37 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 17, 6, 25, 0, true);           // UTC: 6:25 AM Local: 4:55 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 12, 16, 18, 0, true);          // UTC: 4:18 PM Local: 2:48 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 19, 4, 38, 0, true);           // UTC: 4:38 AM Local: 3:08 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 9, 3, 16, 0, true);            // UTC: 3:16 AM Local: 1:46 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 14, 10, 17, 0, true);          // UTC: 10:17 AM Local: 8:47 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 27, 3, 49, 0, true);           // UTC: 3:49 AM Local: 2:19 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 11, 9, 1, 0, true);            // UTC: 9:01 AM Local: 7:31 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 19, 19, 12, 0, true);          // UTC: 7:12 PM Local: 5:42 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 29, 2, 58, 0, true);           // UTC: 2:58 AM Local: 1:28 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 7, 3, 34, 0, true);            // UTC: 3:34 AM Local: 2:04 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 15, 12, 55, 0, true);          // UTC: 12:55 PM Local: 11:25 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 24, 2, 51, 0, true);           // UTC: 2:51 AM Local: 1:21 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 4, 13, 1, 0, true);            // UTC: 1:01 PM Local: 11:31 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 4, 18, 46, 0, true);           // UTC: 6:46 PM Local: 5:16 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 14, 12, 28, 0, true);          // UTC: 12:28 PM Local: 10:58 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 22, 9, 36, 0, true);           // UTC: 9:36 AM Local: 8:06 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 30, 16, 53, 0, true);          // UTC: 4:53 PM Local: 3:23 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 6, 20, 26, 0, true);           // UTC: 8:26 PM Local: 6:56 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 8, 17, 36, 0, true);           // UTC: 5:36 PM Local: 4:06 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 24, 3, 51, 0, true);           // UTC: 3:51 AM Local: 2:21 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 7, 12, 12, 0, true);           // UTC: 12:12 PM Local: 10:42 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 5, 4, 40, 0, true);            // UTC: 4:40 AM Local: 3:10 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 1, 16, 3, 35, 0, true);           // UTC: 3:35 AM Local: 2:05 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 23, 14, 0, 0, true);           // UTC: 2:00 PM Local: 12:30 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 15, 15, 38, 0, true);          // UTC: 3:38 PM Local: 2:08 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 4, 16, 30, 0, true);           // UTC: 4:30 PM Local: 3:00 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 27, 16, 31, 0, true);          // UTC: 4:31 PM Local: 3:01 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 12, 13, 57, 0, true);          // UTC: 1:57 PM Local: 12:27 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 18, 5, 56, 0, true);           // UTC: 5:56 AM Local: 4:26 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 1, 7, 5, 0, true);             // UTC: 7:05 AM Local: 5:35 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 1, 14, 24, 0, true);           // UTC: 2:24 PM Local: 12:54 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 15, 3, 43, 0, true);           // UTC: 3:43 AM Local: 2:13 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 23, 20, 16, 0, true);          // UTC: 8:16 PM Local: 6:46 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 5, 15, 18, 0, true);           // UTC: 3:18 PM Local: 1:48 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 15, 12, 18, 0, true);          // UTC: 12:18 PM Local: 10:48 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 24, 5, 29, 0, true);           // UTC: 5:29 AM Local: 3:59 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 15, 9, 19, 0, true);           // UTC: 9:19 AM Local: 7:49 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 22, 1, 4, 0, true);            // UTC: 1:04 AM Local: 11:34 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 7, 9, 43, 0, true);            // UTC: 9:43 AM Local: 8:13 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 25, 13, 6, 0, true);           // UTC: 1:06 PM Local: 11:36 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 15, 2, 29, 0, true);           // UTC: 2:29 AM Local: 12:59 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 17, 14, 42, 0, true);          // UTC: 2:42 PM Local: 1:12 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 1, 5, 27, 0, true);            // UTC: 5:27 AM Local: 3:57 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 21, 8, 4, 0, true);            // UTC: 8:04 AM Local: 6:34 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 3, 4, 10, 0, true);            // UTC: 4:10 AM Local: 2:40 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 14, 9, 56, 0, true);           // UTC: 9:56 AM Local: 8:26 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 15, 3, 12, 0, true);           // UTC: 3:12 AM Local: 1:42 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 2, 20, 15, 56, 0, true);          // UTC: 3:56 PM Local: 2:26 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 22, 2, 27, 0, true);           // UTC: 2:27 AM Local: 12:57 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 21, 20, 9, 0, true);           // UTC: 8:09 PM Local: 6:39 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 1, 12, 39, 0, true);           // UTC: 12:39 PM Local: 11:09 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 21, 9, 40, 0, true);           // UTC: 9:40 AM Local: 8:10 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 30, 1, 36, 0, true);           // UTC: 1:36 AM Local: 12:06 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 18, 18, 22, 0, true);          // UTC: 6:22 PM Local: 4:52 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 31, 8, 13, 0, true);           // UTC: 8:13 AM Local: 6:43 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 9, 16, 20, 0, true);           // UTC: 4:20 PM Local: 2:50 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 2, 0, 49, 0, true);            // UTC: 12:49 AM Local: 11:19 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 9, 20, 54, 0, true);           // UTC: 8:54 PM Local: 7:24 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 7, 2, 12, 0, true);            // UTC: 2:12 AM Local: 12:42 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 10, 16, 29, 0, true);          // UTC: 4:29 PM Local: 2:59 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 25, 16, 8, 0, true);           // UTC: 4:08 PM Local: 2:38 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 11, 16, 51, 0, true);          // UTC: 4:51 PM Local: 3:21 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 9, 17, 56, 0, true);           // UTC: 5:56 PM Local: 4:26 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 23, 23, 47, 0, true);          // UTC: 11:47 PM Local: 10:17 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 31, 9, 41, 0, true);           // UTC: 9:41 AM Local: 8:11 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 24, 21, 33, 0, true);          // UTC: 9:33 PM Local: 8:03 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 10, 20, 32, 0, true);          // UTC: 8:32 PM Local: 7:02 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 19, 13, 52, 0, true);          // UTC: 1:52 PM Local: 12:22 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 16, 1, 55, 0, true);           // UTC: 1:55 AM Local: 12:25 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 28, 7, 9, 0, true);            // UTC: 7:09 AM Local: 5:39 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 2, 14, 54, 0, true);           // UTC: 2:54 PM Local: 1:24 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 30, 3, 32, 0, true);           // UTC: 3:32 AM Local: 2:02 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 3, 19, 3, 16, 0, true);           // UTC: 3:16 AM Local: 1:46 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 23, 14, 44, 0, false);         // UTC: 2:44 PM Local: 12:14 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 13, 21, 20, 0, false);         // UTC: 9:20 PM Local: 6:50 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 11, 11, 11, 0, false);         // UTC: 11:11 AM Local: 8:41 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 15, 10, 46, 0, false);         // UTC: 10:46 AM Local: 8:16 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 4, 20, 42, 0, false);          // UTC: 8:42 PM Local: 6:12 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 22, 16, 28, 0, false);         // UTC: 4:28 PM Local: 1:58 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 14, 19, 2, 0, false);          // UTC: 7:02 PM Local: 4:32 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 28, 11, 5, 0, false);          // UTC: 11:05 AM Local: 8:35 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 11, 13, 23, 0, false);         // UTC: 1:23 PM Local: 10:53 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 15, 18, 46, 0, false);         // UTC: 6:46 PM Local: 4:16 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 12, 1, 18, 0, false);          // UTC: 1:18 AM Local: 10:48 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 9, 8, 5, 0, false);            // UTC: 8:05 AM Local: 5:35 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 8, 12, 2, 0, false);           // UTC: 12:02 PM Local: 9:32 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 6, 5, 30, 0, false);           // UTC: 5:30 AM Local: 3:00 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 22, 22, 35, 0, false);         // UTC: 10:35 PM Local: 8:05 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 4, 22, 38, 0, false);          // UTC: 10:38 PM Local: 8:08 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 17, 2, 55, 0, false);          // UTC: 2:55 AM Local: 12:25 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 2, 18, 27, 0, false);          // UTC: 6:27 PM Local: 3:57 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 2, 22, 43, 0, false);          // UTC: 10:43 PM Local: 8:13 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 5, 19, 20, 0, false);          // UTC: 7:20 PM Local: 4:50 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 8, 17, 46, 0, false);          // UTC: 5:46 PM Local: 3:16 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 18, 1, 17, 0, false);          // UTC: 1:17 AM Local: 10:47 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 7, 4, 15, 0, false);           // UTC: 4:15 AM Local: 1:45 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 10, 3, 37, 0, false);          // UTC: 3:37 AM Local: 1:07 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 4, 28, 14, 8, 0, false);          // UTC: 2:08 PM Local: 11:38 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 3, 22, 28, 0, false);          // UTC: 10:28 PM Local: 7:58 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 10, 17, 25, 0, false);         // UTC: 5:25 PM Local: 2:55 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 19, 7, 22, 0, false);          // UTC: 7:22 AM Local: 4:52 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 24, 3, 43, 0, false);          // UTC: 3:43 AM Local: 1:13 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 8, 8, 8, 0, false);            // UTC: 8:08 AM Local: 5:38 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 12, 14, 59, 0, false);         // UTC: 2:59 PM Local: 12:29 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 18, 7, 35, 0, false);          // UTC: 7:35 AM Local: 5:05 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 15, 9, 3, 0, false);           // UTC: 9:03 AM Local: 6:33 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 19, 14, 7, 0, false);          // UTC: 2:07 PM Local: 11:37 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 7, 19, 4, 0, false);           // UTC: 7:04 PM Local: 4:34 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 16, 4, 24, 0, false);          // UTC: 4:24 AM Local: 1:54 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 17, 8, 31, 0, false);          // UTC: 8:31 AM Local: 6:01 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 12, 14, 3, 0, false);          // UTC: 2:03 PM Local: 11:33 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 17, 13, 1, 0, false);          // UTC: 1:01 PM Local: 10:31 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 19, 7, 42, 0, false);          // UTC: 7:42 AM Local: 5:12 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 10, 17, 15, 0, false);         // UTC: 5:15 PM Local: 2:45 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 4, 12, 26, 0, false);          // UTC: 12:26 PM Local: 9:56 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 21, 4, 44, 0, false);          // UTC: 4:44 AM Local: 2:14 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 18, 7, 9, 0, false);           // UTC: 7:09 AM Local: 4:39 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 15, 5, 45, 0, false);          // UTC: 5:45 AM Local: 3:15 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 20, 15, 5, 0, false);          // UTC: 3:05 PM Local: 12:35 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 9, 12, 28, 0, false);          // UTC: 12:28 PM Local: 9:58 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 19, 2, 36, 0, false);          // UTC: 2:36 AM Local: 12:06 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 22, 0, 47, 0, false);          // UTC: 12:47 AM Local: 10:17 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 5, 8, 2, 17, 0, false);           // UTC: 2:17 AM Local: 11:47 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 8, 15, 10, 0, false);          // UTC: 3:10 PM Local: 12:40 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 24, 16, 25, 0, false);         // UTC: 4:25 PM Local: 1:55 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 9, 14, 27, 0, false);          // UTC: 2:27 PM Local: 11:57 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 26, 0, 8, 0, false);           // UTC: 12:08 AM Local: 9:38 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 4, 5, 27, 0, false);           // UTC: 5:27 AM Local: 2:57 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 26, 0, 17, 0, false);          // UTC: 12:17 AM Local: 9:47 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 20, 15, 59, 0, false);         // UTC: 3:59 PM Local: 1:29 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 20, 10, 15, 0, false);         // UTC: 10:15 AM Local: 7:45 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 10, 5, 49, 0, false);          // UTC: 5:49 AM Local: 3:19 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 3, 17, 59, 0, false);          // UTC: 5:59 PM Local: 3:29 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 10, 0, 7, 0, false);           // UTC: 12:07 AM Local: 9:37 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 3, 1, 42, 0, false);           // UTC: 1:42 AM Local: 11:12 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 25, 2, 34, 0, false);          // UTC: 2:34 AM Local: 12:04 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 15, 2, 2, 0, false);           // UTC: 2:02 AM Local: 11:32 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 3, 12, 44, 0, false);          // UTC: 12:44 PM Local: 10:14 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 16, 9, 23, 0, false);          // UTC: 9:23 AM Local: 6:53 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 11, 8, 9, 0, false);           // UTC: 8:09 AM Local: 5:39 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 4, 19, 3, 0, false);           // UTC: 7:03 PM Local: 4:33 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 2, 11, 59, 0, false);          // UTC: 11:59 AM Local: 9:29 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 6, 3, 40, 0, false);           // UTC: 3:40 AM Local: 1:10 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 11, 15, 22, 0, false);         // UTC: 3:22 PM Local: 12:52 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 9, 22, 40, 0, false);          // UTC: 10:40 PM Local: 8:10 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 15, 3, 34, 0, false);          // UTC: 3:34 AM Local: 1:04 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 21, 18, 13, 0, false);         // UTC: 6:13 PM Local: 3:43 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 6, 2, 19, 10, 0, false);          // UTC: 7:10 PM Local: 4:40 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 9, 18, 24, 0, false);          // UTC: 6:24 PM Local: 3:54 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 11, 0, 13, 0, false);          // UTC: 12:13 AM Local: 9:43 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 18, 15, 51, 0, false);         // UTC: 3:51 PM Local: 1:21 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 3, 0, 46, 0, false);           // UTC: 12:46 AM Local: 10:16 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 26, 15, 14, 0, false);         // UTC: 3:14 PM Local: 12:44 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 22, 19, 57, 0, false);         // UTC: 7:57 PM Local: 5:27 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 6, 5, 10, 0, false);           // UTC: 5:10 AM Local: 2:40 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 21, 12, 10, 0, false);         // UTC: 12:10 PM Local: 9:40 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 23, 17, 4, 0, false);          // UTC: 5:04 PM Local: 2:34 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 26, 6, 16, 0, false);          // UTC: 6:16 AM Local: 3:46 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 4, 5, 41, 0, false);           // UTC: 5:41 AM Local: 3:11 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 16, 16, 57, 0, false);         // UTC: 4:57 PM Local: 2:27 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 17, 13, 13, 0, false);         // UTC: 1:13 PM Local: 10:43 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 18, 2, 38, 0, false);          // UTC: 2:38 AM Local: 12:08 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 17, 13, 22, 0, false);         // UTC: 1:22 PM Local: 10:52 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 20, 6, 20, 0, false);          // UTC: 6:20 AM Local: 3:50 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 17, 4, 40, 0, false);          // UTC: 4:40 AM Local: 2:10 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 22, 18, 12, 0, false);         // UTC: 6:12 PM Local: 3:42 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 30, 0, 53, 0, false);          // UTC: 12:53 AM Local: 10:23 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 31, 1, 44, 0, false);          // UTC: 1:44 AM Local: 11:14 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 9, 9, 53, 0, false);           // UTC: 9:53 AM Local: 7:23 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 23, 13, 29, 0, false);         // UTC: 1:29 PM Local: 10:59 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 6, 22, 44, 0, false);          // UTC: 10:44 PM Local: 8:14 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 29, 17, 4, 0, false);          // UTC: 5:04 PM Local: 2:34 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 7, 23, 20, 25, 0, false);         // UTC: 8:25 PM Local: 5:55 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 17, 0, 55, 0, false);          // UTC: 12:55 AM Local: 10:25 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 19, 19, 41, 0, false);         // UTC: 7:41 PM Local: 5:11 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 22, 14, 37, 0, false);         // UTC: 2:37 PM Local: 12:07 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 9, 16, 56, 0, false);          // UTC: 4:56 PM Local: 2:26 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 29, 21, 36, 0, false);         // UTC: 9:36 PM Local: 7:06 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 9, 14, 58, 0, false);          // UTC: 2:58 PM Local: 12:28 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 27, 12, 48, 0, false);         // UTC: 12:48 PM Local: 10:18 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 19, 10, 6, 0, false);          // UTC: 10:06 AM Local: 7:36 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 16, 4, 54, 0, false);          // UTC: 4:54 AM Local: 2:24 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 28, 17, 34, 0, false);         // UTC: 5:34 PM Local: 3:04 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 30, 12, 9, 0, false);          // UTC: 12:09 PM Local: 9:39 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 2, 22, 48, 0, false);          // UTC: 10:48 PM Local: 8:18 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 13, 19, 13, 0, false);         // UTC: 7:13 PM Local: 4:43 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 8, 3, 47, 0, false);           // UTC: 3:47 AM Local: 1:17 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 3, 11, 42, 0, false);          // UTC: 11:42 AM Local: 9:12 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 5, 15, 25, 0, false);          // UTC: 3:25 PM Local: 12:55 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 12, 20, 6, 0, false);          // UTC: 8:06 PM Local: 5:36 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 17, 18, 58, 0, false);         // UTC: 6:58 PM Local: 4:28 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 16, 1, 9, 0, false);           // UTC: 1:09 AM Local: 10:39 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 18, 0, 59, 0, false);          // UTC: 12:59 AM Local: 10:29 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 22, 15, 10, 0, false);         // UTC: 3:10 PM Local: 12:40 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 11, 15, 56, 0, false);         // UTC: 3:56 PM Local: 1:26 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 15, 4, 59, 0, false);          // UTC: 4:59 AM Local: 2:29 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 9, 4, 50, 0, false);           // UTC: 4:50 AM Local: 2:20 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 8, 10, 10, 19, 0, false);         // UTC: 10:19 AM Local: 7:49 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 17, 15, 24, 0, false);         // UTC: 3:24 PM Local: 12:54 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 10, 19, 59, 0, false);         // UTC: 7:59 PM Local: 5:29 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 13, 12, 42, 0, false);         // UTC: 12:42 PM Local: 10:12 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 1, 7, 35, 0, false);           // UTC: 7:35 AM Local: 5:05 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 24, 6, 23, 0, false);          // UTC: 6:23 AM Local: 3:53 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 6, 6, 0, 0, false);            // UTC: 6:00 AM Local: 3:30 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 25, 4, 42, 0, false);          // UTC: 4:42 AM Local: 2:12 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 20, 1, 47, 0, false);          // UTC: 1:47 AM Local: 11:17 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 10, 2, 22, 0, false);          // UTC: 2:22 AM Local: 11:52 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 17, 23, 21, 0, false);         // UTC: 11:21 PM Local: 8:51 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 16, 20, 23, 0, false);         // UTC: 8:23 PM Local: 5:53 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 18, 12, 26, 0, false);         // UTC: 12:26 PM Local: 9:56 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 15, 15, 50, 0, false);         // UTC: 3:50 PM Local: 1:20 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 25, 2, 4, 0, false);           // UTC: 2:04 AM Local: 11:34 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 25, 18, 22, 0, false);         // UTC: 6:22 PM Local: 3:52 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 26, 11, 9, 0, false);          // UTC: 11:09 AM Local: 8:39 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 7, 9, 9, 0, false);            // UTC: 9:09 AM Local: 6:39 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 30, 11, 17, 0, false);         // UTC: 11:17 AM Local: 8:47 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 17, 12, 31, 0, false);         // UTC: 12:31 PM Local: 10:01 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 11, 5, 20, 0, false);          // UTC: 5:20 AM Local: 2:50 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 12, 18, 32, 0, false);         // UTC: 6:32 PM Local: 4:02 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 2, 13, 29, 0, false);          // UTC: 1:29 PM Local: 10:59 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 29, 8, 40, 0, false);          // UTC: 8:40 AM Local: 6:10 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 17, 20, 5, 0, false);          // UTC: 8:05 PM Local: 5:35 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 9, 15, 2, 20, 0, false);          // UTC: 2:20 AM Local: 11:50 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 16, 1, 33, 0, true);          // UTC: 1:33 AM Local: 12:03 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 5, 19, 37, 0, false);         // UTC: 7:37 PM Local: 5:07 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 28, 6, 23, 0, true);          // UTC: 6:23 AM Local: 4:53 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 5, 17, 39, 0, false);         // UTC: 5:39 PM Local: 3:09 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 27, 12, 28, 0, true);         // UTC: 12:28 PM Local: 10:58 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 27, 8, 52, 0, true);          // UTC: 8:52 AM Local: 7:22 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 27, 21, 20, 0, true);         // UTC: 9:20 PM Local: 7:50 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 6, 17, 55, 0, true);          // UTC: 5:55 PM Local: 4:25 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 26, 22, 51, 0, true);         // UTC: 10:51 PM Local: 9:21 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 18, 7, 52, 0, true);          // UTC: 7:52 AM Local: 6:22 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 16, 21, 1, 0, true);          // UTC: 9:01 PM Local: 7:31 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 6, 23, 50, 0, true);          // UTC: 11:50 PM Local: 10:20 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 15, 18, 13, 0, true);         // UTC: 6:13 PM Local: 4:43 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 31, 10, 56, 0, true);         // UTC: 10:56 AM Local: 9:26 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 9, 19, 19, 0, true);          // UTC: 7:19 PM Local: 5:49 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 1, 11, 27, 0, false);         // UTC: 11:27 AM Local: 8:57 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 5, 10, 52, 0, false);         // UTC: 10:52 AM Local: 8:22 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 17, 4, 56, 0, true);          // UTC: 4:56 AM Local: 3:26 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 22, 5, 54, 0, true);          // UTC: 5:54 AM Local: 4:24 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 18, 3, 28, 0, true);          // UTC: 3:28 AM Local: 1:58 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 24, 1, 17, 0, true);          // UTC: 1:17 AM Local: 11:47 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 12, 8, 37, 0, true);          // UTC: 8:37 AM Local: 7:07 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 10, 22, 56, 0, true);         // UTC: 10:56 PM Local: 9:26 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 9, 8, 42, 0, true);           // UTC: 8:42 AM Local: 7:12 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 10, 5, 17, 4, 0, false);          // UTC: 5:04 PM Local: 2:34 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 12, 19, 32, 0, true);         // UTC: 7:32 PM Local: 6:02 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 12, 0, 50, 0, true);          // UTC: 12:50 AM Local: 11:20 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 22, 13, 19, 0, true);         // UTC: 1:19 PM Local: 11:49 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 26, 9, 28, 0, true);          // UTC: 9:28 AM Local: 7:58 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 6, 15, 29, 0, true);          // UTC: 3:29 PM Local: 1:59 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 8, 10, 31, 0, true);          // UTC: 10:31 AM Local: 9:01 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 10, 1, 33, 0, true);          // UTC: 1:33 AM Local: 12:03 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 28, 7, 23, 0, true);          // UTC: 7:23 AM Local: 5:53 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 4, 11, 28, 0, true);          // UTC: 11:28 AM Local: 9:58 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 28, 2, 43, 0, true);          // UTC: 2:43 AM Local: 1:13 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 8, 14, 29, 0, true);          // UTC: 2:29 PM Local: 12:59 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 28, 23, 38, 0, true);         // UTC: 11:38 PM Local: 10:08 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 5, 3, 16, 0, true);           // UTC: 3:16 AM Local: 1:46 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 29, 23, 27, 0, true);         // UTC: 11:27 PM Local: 9:57 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 13, 21, 48, 0, true);         // UTC: 9:48 PM Local: 8:18 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 24, 13, 37, 0, true);         // UTC: 1:37 PM Local: 12:07 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 6, 3, 7, 0, true);            // UTC: 3:07 AM Local: 1:37 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 11, 3, 13, 0, true);          // UTC: 3:13 AM Local: 1:43 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 27, 10, 49, 0, true);         // UTC: 10:49 AM Local: 9:19 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 17, 4, 50, 0, true);          // UTC: 4:50 AM Local: 3:20 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 26, 21, 9, 0, true);          // UTC: 9:09 PM Local: 7:39 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 20, 12, 59, 0, true);         // UTC: 12:59 PM Local: 11:29 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 27, 17, 31, 0, true);         // UTC: 5:31 PM Local: 4:01 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 10, 10, 48, 0, true);         // UTC: 10:48 AM Local: 9:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 11, 8, 21, 9, 0, true);           // UTC: 9:09 PM Local: 7:39 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 15, 15, 31, 0, true);         // UTC: 3:31 PM Local: 2:01 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 21, 0, 34, 0, true);          // UTC: 12:34 AM Local: 11:04 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 26, 3, 39, 0, true);          // UTC: 3:39 AM Local: 2:09 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 27, 20, 8, 0, true);          // UTC: 8:08 PM Local: 6:38 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 28, 13, 40, 0, true);         // UTC: 1:40 PM Local: 12:10 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 25, 13, 33, 0, true);         // UTC: 1:33 PM Local: 12:03 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 31, 1, 33, 0, true);          // UTC: 1:33 AM Local: 12:03 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 22, 2, 32, 0, true);          // UTC: 2:32 AM Local: 1:02 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 3, 17, 13, 0, true);          // UTC: 5:13 PM Local: 3:43 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 30, 10, 35, 0, true);         // UTC: 10:35 AM Local: 9:05 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 18, 10, 45, 0, true);         // UTC: 10:45 AM Local: 9:15 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 19, 11, 11, 0, true);         // UTC: 11:11 AM Local: 9:41 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 30, 13, 58, 0, true);         // UTC: 1:58 PM Local: 12:28 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 8, 6, 42, 0, true);           // UTC: 6:42 AM Local: 5:12 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 6, 12, 34, 0, true);          // UTC: 12:34 PM Local: 11:04 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 15, 5, 50, 0, true);          // UTC: 5:50 AM Local: 4:20 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 20, 15, 28, 0, true);         // UTC: 3:28 PM Local: 1:58 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 3, 14, 30, 0, true);          // UTC: 2:30 PM Local: 1:00 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 15, 22, 37, 0, true);         // UTC: 10:37 PM Local: 9:07 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 20, 7, 47, 0, true);          // UTC: 7:47 AM Local: 6:17 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 31, 14, 6, 0, true);          // UTC: 2:06 PM Local: 12:36 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 21, 0, 31, 0, true);          // UTC: 12:31 AM Local: 11:01 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 8, 20, 56, 0, true);          // UTC: 8:56 PM Local: 7:26 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 24, 16, 9, 0, true);          // UTC: 4:09 PM Local: 2:39 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2018, 12, 22, 11, 23, 0, true);         // UTC: 11:23 AM Local: 9:53 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 12, 0, 28, 0, true);           // UTC: 12:28 AM Local: 10:58 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 10, 5, 30, 0, true);           // UTC: 5:30 AM Local: 4:00 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 20, 10, 54, 0, true);          // UTC: 10:54 AM Local: 9:24 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 31, 14, 49, 0, true);          // UTC: 2:49 PM Local: 1:19 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 23, 6, 58, 0, true);           // UTC: 6:58 AM Local: 5:28 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 30, 9, 7, 0, true);            // UTC: 9:07 AM Local: 7:37 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 26, 7, 28, 0, true);           // UTC: 7:28 AM Local: 5:58 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 16, 16, 35, 0, true);          // UTC: 4:35 PM Local: 3:05 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 14, 11, 22, 0, true);          // UTC: 11:22 AM Local: 9:52 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 11, 18, 8, 0, true);           // UTC: 6:08 PM Local: 4:38 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 17, 23, 7, 0, true);           // UTC: 11:07 PM Local: 9:37 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 20, 15, 14, 0, true);          // UTC: 3:14 PM Local: 1:44 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 16, 11, 53, 0, true);          // UTC: 11:53 AM Local: 10:23 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 1, 5, 36, 0, true);            // UTC: 5:36 AM Local: 4:06 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 7, 2, 50, 0, true);            // UTC: 2:50 AM Local: 1:20 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 13, 12, 26, 0, true);          // UTC: 12:26 PM Local: 10:56 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 1, 11, 11, 0, true);           // UTC: 11:11 AM Local: 9:41 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 3, 21, 59, 0, true);           // UTC: 9:59 PM Local: 8:29 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 28, 1, 23, 0, true);           // UTC: 1:23 AM Local: 11:53 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 22, 7, 37, 0, true);           // UTC: 7:37 AM Local: 6:07 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 16, 12, 23, 0, true);          // UTC: 12:23 PM Local: 10:53 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 17, 3, 19, 0, true);           // UTC: 3:19 AM Local: 1:49 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 7, 10, 5, 0, true);            // UTC: 10:05 AM Local: 8:35 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 28, 22, 55, 0, true);          // UTC: 10:55 PM Local: 9:25 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 1, 1, 21, 28, 0, true);           // UTC: 9:28 PM Local: 7:58 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 9, 11, 6, 0, true);            // UTC: 11:06 AM Local: 9:36 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 4, 10, 47, 0, true);           // UTC: 10:47 AM Local: 9:17 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 10, 4, 5, 0, true);            // UTC: 4:05 AM Local: 2:35 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 9, 23, 12, 0, true);           // UTC: 11:12 PM Local: 9:42 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 10, 23, 7, 0, true);           // UTC: 11:07 PM Local: 9:37 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 18, 3, 35, 0, true);           // UTC: 3:35 AM Local: 2:05 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 16, 9, 35, 0, true);           // UTC: 9:35 AM Local: 8:05 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 17, 23, 5, 0, true);           // UTC: 11:05 PM Local: 9:35 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 18, 15, 0, 0, true);           // UTC: 3:00 PM Local: 1:30 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 16, 0, 0, 0, true);            // UTC: 12:00 AM Local: 10:30 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 20, 9, 7, 0, true);            // UTC: 9:07 AM Local: 7:37 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 7, 21, 49, 0, true);           // UTC: 9:49 PM Local: 8:19 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 22, 19, 40, 0, true);          // UTC: 7:40 PM Local: 6:10 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 10, 13, 51, 0, true);          // UTC: 1:51 PM Local: 12:21 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 23, 15, 44, 0, true);          // UTC: 3:44 PM Local: 2:14 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 4, 1, 47, 0, true);            // UTC: 1:47 AM Local: 12:17 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 7, 0, 13, 0, true);            // UTC: 12:13 AM Local: 10:43 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 18, 19, 9, 0, true);           // UTC: 7:09 PM Local: 5:39 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 26, 9, 18, 0, true);           // UTC: 9:18 AM Local: 7:48 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 15, 11, 42, 0, true);          // UTC: 11:42 AM Local: 10:12 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 18, 9, 22, 0, true);           // UTC: 9:22 AM Local: 7:52 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 9, 6, 57, 0, true);            // UTC: 6:57 AM Local: 5:27 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 3, 12, 29, 0, true);           // UTC: 12:29 PM Local: 10:59 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 27, 13, 45, 0, true);          // UTC: 1:45 PM Local: 12:15 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 2, 5, 2, 13, 0, true);            // UTC: 2:13 AM Local: 12:43 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 20, 13, 40, 0, true);          // UTC: 1:40 PM Local: 12:10 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 7, 14, 30, 0, true);           // UTC: 2:30 PM Local: 1:00 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 4, 19, 23, 0, true);           // UTC: 7:23 PM Local: 5:53 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 1, 13, 24, 0, true);           // UTC: 1:24 PM Local: 11:54 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 19, 23, 9, 0, true);           // UTC: 11:09 PM Local: 9:39 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 19, 9, 11, 0, true);           // UTC: 9:11 AM Local: 7:41 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 4, 10, 9, 0, true);            // UTC: 10:09 AM Local: 8:39 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 17, 9, 50, 0, true);           // UTC: 9:50 AM Local: 8:20 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 15, 4, 48, 0, true);           // UTC: 4:48 AM Local: 3:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 5, 4, 12, 0, true);            // UTC: 4:12 AM Local: 2:42 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 13, 15, 21, 0, true);          // UTC: 3:21 PM Local: 1:51 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 16, 8, 19, 0, true);           // UTC: 8:19 AM Local: 6:49 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 22, 11, 59, 0, true);          // UTC: 11:59 AM Local: 10:29 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 8, 21, 32, 0, true);           // UTC: 9:32 PM Local: 8:02 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 23, 7, 59, 0, true);           // UTC: 7:59 AM Local: 6:29 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 28, 20, 49, 0, true);          // UTC: 8:49 PM Local: 7:19 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 13, 22, 14, 0, true);          // UTC: 10:14 PM Local: 8:44 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 21, 7, 21, 0, true);           // UTC: 7:21 AM Local: 5:51 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 6, 10, 53, 0, true);           // UTC: 10:53 AM Local: 9:23 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 21, 11, 23, 0, true);          // UTC: 11:23 AM Local: 9:53 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 13, 18, 26, 0, true);          // UTC: 6:26 PM Local: 4:56 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 7, 18, 59, 0, true);           // UTC: 6:59 PM Local: 5:29 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 28, 3, 41, 0, true);           // UTC: 3:41 AM Local: 2:11 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 28, 9, 8, 0, true);            // UTC: 9:08 AM Local: 7:38 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 3, 10, 10, 57, 0, true);          // UTC: 10:57 AM Local: 9:27 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 11, 5, 52, 0, false);          // UTC: 5:52 AM Local: 3:22 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 8, 3, 57, 0, false);           // UTC: 3:57 AM Local: 1:27 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 20, 6, 15, 0, false);          // UTC: 6:15 AM Local: 3:45 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 18, 13, 45, 0, false);         // UTC: 1:45 PM Local: 11:15 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 23, 13, 37, 0, false);         // UTC: 1:37 PM Local: 11:07 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 7, 18, 45, 0, false);          // UTC: 6:45 PM Local: 4:15 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 11, 1, 36, 0, false);          // UTC: 1:36 AM Local: 11:06 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 2, 23, 41, 0, true);           // UTC: 11:41 PM Local: 10:11 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 11, 17, 57, 0, false);         // UTC: 5:57 PM Local: 3:27 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 19, 16, 23, 0, false);         // UTC: 4:23 PM Local: 1:53 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 10, 9, 13, 0, false);          // UTC: 9:13 AM Local: 6:43 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 16, 5, 47, 0, false);          // UTC: 5:47 AM Local: 3:17 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 5, 11, 0, 0, true);            // UTC: 11:00 AM Local: 9:30 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 23, 14, 15, 0, false);         // UTC: 2:15 PM Local: 11:45 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 27, 22, 50, 0, false);         // UTC: 10:50 PM Local: 8:20 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 11, 20, 8, 0, false);          // UTC: 8:08 PM Local: 5:38 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 19, 21, 18, 0, false);         // UTC: 9:18 PM Local: 6:48 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 24, 12, 46, 0, false);         // UTC: 12:46 PM Local: 10:16 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 29, 11, 43, 0, false);         // UTC: 11:43 AM Local: 9:13 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 20, 4, 56, 0, false);          // UTC: 4:56 AM Local: 2:26 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 27, 12, 26, 0, false);         // UTC: 12:26 PM Local: 9:56 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 9, 0, 17, 0, false);           // UTC: 12:17 AM Local: 9:47 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 18, 19, 46, 0, false);         // UTC: 7:46 PM Local: 5:16 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 9, 16, 36, 0, false);          // UTC: 4:36 PM Local: 2:06 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 4, 4, 2, 57, 0, true);            // UTC: 2:57 AM Local: 1:27 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 3, 6, 3, 0, false);            // UTC: 6:03 AM Local: 3:33 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 18, 17, 29, 0, false);         // UTC: 5:29 PM Local: 2:59 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 18, 10, 25, 0, false);         // UTC: 10:25 AM Local: 7:55 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 21, 20, 11, 0, false);         // UTC: 8:11 PM Local: 5:41 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 7, 11, 8, 0, false);           // UTC: 11:08 AM Local: 8:38 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 6, 8, 26, 0, false);           // UTC: 8:26 AM Local: 5:56 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 20, 20, 42, 0, false);         // UTC: 8:42 PM Local: 6:12 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 4, 10, 32, 0, false);          // UTC: 10:32 AM Local: 8:02 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 3, 7, 46, 0, false);           // UTC: 7:46 AM Local: 5:16 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 31, 2, 1, 0, false);           // UTC: 2:01 AM Local: 11:31 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 16, 15, 39, 0, false);         // UTC: 3:39 PM Local: 1:09 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 22, 6, 31, 0, false);          // UTC: 6:31 AM Local: 4:01 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 30, 5, 28, 0, false);          // UTC: 5:28 AM Local: 2:58 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 6, 14, 32, 0, false);          // UTC: 2:32 PM Local: 12:02 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 6, 20, 37, 0, false);          // UTC: 8:37 PM Local: 6:07 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 13, 22, 34, 0, false);         // UTC: 10:34 PM Local: 8:04 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 12, 17, 13, 0, false);         // UTC: 5:13 PM Local: 2:43 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 26, 13, 28, 0, false);         // UTC: 1:28 PM Local: 10:58 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 8, 5, 57, 0, false);           // UTC: 5:57 AM Local: 3:27 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 25, 20, 13, 0, false);         // UTC: 8:13 PM Local: 5:43 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 5, 9, 28, 0, false);           // UTC: 9:28 AM Local: 6:58 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 1, 8, 33, 0, false);           // UTC: 8:33 AM Local: 6:03 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 23, 4, 30, 0, false);          // UTC: 4:30 AM Local: 2:00 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 9, 2, 42, 0, false);           // UTC: 2:42 AM Local: 12:12 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 5, 5, 9, 45, 0, false);           // UTC: 9:45 AM Local: 7:15 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 14, 16, 22, 0, false);         // UTC: 4:22 PM Local: 1:52 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 16, 16, 14, 0, false);         // UTC: 4:14 PM Local: 1:44 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 18, 12, 35, 0, false);         // UTC: 12:35 PM Local: 10:05 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 19, 6, 57, 0, false);          // UTC: 6:57 AM Local: 4:27 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 26, 7, 32, 0, false);          // UTC: 7:32 AM Local: 5:02 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 17, 21, 51, 0, false);         // UTC: 9:51 PM Local: 7:21 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 17, 12, 11, 0, false);         // UTC: 12:11 PM Local: 9:41 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 8, 22, 59, 0, false);          // UTC: 10:59 PM Local: 8:29 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 6, 5, 13, 0, false);           // UTC: 5:13 AM Local: 2:43 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 10, 21, 49, 0, false);         // UTC: 9:49 PM Local: 7:19 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 5, 8, 9, 0, false);            // UTC: 8:09 AM Local: 5:39 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 12, 21, 19, 0, false);         // UTC: 9:19 PM Local: 6:49 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 3, 16, 21, 0, false);          // UTC: 4:21 PM Local: 1:51 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 15, 14, 11, 0, false);         // UTC: 2:11 PM Local: 11:41 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 6, 23, 47, 0, false);          // UTC: 11:47 PM Local: 9:17 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 17, 8, 49, 0, false);          // UTC: 8:49 AM Local: 6:19 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 7, 2, 54, 0, false);           // UTC: 2:54 AM Local: 12:24 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 30, 13, 13, 0, false);         // UTC: 1:13 PM Local: 10:43 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 23, 6, 34, 0, false);          // UTC: 6:34 AM Local: 4:04 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 8, 21, 49, 0, false);          // UTC: 9:49 PM Local: 7:19 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 17, 19, 25, 0, false);         // UTC: 7:25 PM Local: 4:55 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 21, 0, 0, 0, false);           // UTC: 12:00 AM Local: 9:30 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 3, 15, 11, 0, false);          // UTC: 3:11 PM Local: 12:41 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 10, 12, 19, 0, false);         // UTC: 12:19 PM Local: 9:49 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 6, 2, 4, 16, 0, false);           // UTC: 4:16 AM Local: 1:46 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 22, 13, 6, 0, false);          // UTC: 1:06 PM Local: 10:36 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 28, 4, 47, 0, false);          // UTC: 4:47 AM Local: 2:17 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 14, 13, 21, 0, false);         // UTC: 1:21 PM Local: 10:51 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 21, 16, 23, 0, false);         // UTC: 4:23 PM Local: 1:53 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 18, 3, 0, 0, false);           // UTC: 3:00 AM Local: 12:30 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 16, 9, 46, 0, false);          // UTC: 9:46 AM Local: 7:16 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 5, 8, 15, 0, false);           // UTC: 8:15 AM Local: 5:45 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 12, 9, 28, 0, false);          // UTC: 9:28 AM Local: 6:58 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 14, 14, 6, 0, false);          // UTC: 2:06 PM Local: 11:36 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 15, 5, 40, 0, false);          // UTC: 5:40 AM Local: 3:10 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 6, 21, 1, 0, false);           // UTC: 9:01 PM Local: 6:31 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 18, 7, 33, 0, false);          // UTC: 7:33 AM Local: 5:03 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 9, 6, 26, 0, false);           // UTC: 6:26 AM Local: 3:56 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 4, 0, 28, 0, false);           // UTC: 12:28 AM Local: 9:58 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 28, 20, 29, 0, false);         // UTC: 8:29 PM Local: 5:59 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 15, 12, 4, 0, false);          // UTC: 12:04 PM Local: 9:34 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 3, 8, 53, 0, false);           // UTC: 8:53 AM Local: 6:23 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 19, 5, 45, 0, false);          // UTC: 5:45 AM Local: 3:15 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 15, 2, 57, 0, false);          // UTC: 2:57 AM Local: 12:27 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 15, 2, 21, 0, false);          // UTC: 2:21 AM Local: 11:51 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 10, 14, 46, 0, false);         // UTC: 2:46 PM Local: 12:16 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 26, 23, 15, 0, false);         // UTC: 11:15 PM Local: 8:45 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 11, 5, 37, 0, false);          // UTC: 5:37 AM Local: 3:07 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 25, 14, 13, 0, false);         // UTC: 2:13 PM Local: 11:43 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 7, 29, 6, 57, 0, false);          // UTC: 6:57 AM Local: 4:27 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 1, 8, 45, 0, false);           // UTC: 8:45 AM Local: 6:15 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 28, 20, 8, 0, false);          // UTC: 8:08 PM Local: 5:38 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 23, 11, 9, 0, false);          // UTC: 11:09 AM Local: 8:39 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 8, 20, 53, 0, false);          // UTC: 8:53 PM Local: 6:23 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 16, 14, 48, 0, false);         // UTC: 2:48 PM Local: 12:18 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 10, 18, 19, 0, false);         // UTC: 6:19 PM Local: 3:49 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 29, 13, 36, 0, false);         // UTC: 1:36 PM Local: 11:06 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 29, 6, 10, 0, false);          // UTC: 6:10 AM Local: 3:40 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 15, 19, 34, 0, false);         // UTC: 7:34 PM Local: 5:04 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 13, 17, 20, 0, false);         // UTC: 5:20 PM Local: 2:50 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 23, 16, 26, 0, false);         // UTC: 4:26 PM Local: 1:56 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 4, 18, 21, 0, false);          // UTC: 6:21 PM Local: 3:51 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 27, 19, 53, 0, false);         // UTC: 7:53 PM Local: 5:23 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 31, 18, 21, 0, false);         // UTC: 6:21 PM Local: 3:51 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 15, 12, 55, 0, false);         // UTC: 12:55 PM Local: 10:25 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 15, 4, 8, 0, false);           // UTC: 4:08 AM Local: 1:38 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 16, 0, 39, 0, false);          // UTC: 12:39 AM Local: 10:09 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 26, 13, 5, 0, false);          // UTC: 1:05 PM Local: 10:35 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 17, 23, 2, 0, false);          // UTC: 11:02 PM Local: 8:32 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 27, 16, 54, 0, false);         // UTC: 4:54 PM Local: 2:24 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 9, 0, 23, 0, false);           // UTC: 12:23 AM Local: 9:53 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 17, 17, 1, 0, false);          // UTC: 5:01 PM Local: 2:31 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 10, 3, 1, 0, false);           // UTC: 3:01 AM Local: 12:31 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 9, 10, 29, 0, false);          // UTC: 10:29 AM Local: 7:59 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 8, 16, 11, 53, 0, false);         // UTC: 11:53 AM Local: 9:23 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 5, 9, 28, 0, false);           // UTC: 9:28 AM Local: 6:58 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 15, 21, 39, 0, false);         // UTC: 9:39 PM Local: 7:09 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 11, 21, 44, 0, false);         // UTC: 9:44 PM Local: 7:14 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 8, 10, 21, 0, false);          // UTC: 10:21 AM Local: 7:51 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 26, 4, 44, 0, false);          // UTC: 4:44 AM Local: 2:14 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 30, 15, 7, 0, false);          // UTC: 3:07 PM Local: 12:37 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 11, 16, 18, 0, false);         // UTC: 4:18 PM Local: 1:48 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 23, 7, 1, 0, false);           // UTC: 7:01 AM Local: 4:31 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 12, 16, 46, 0, false);         // UTC: 4:46 PM Local: 2:16 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 1, 13, 56, 0, false);          // UTC: 1:56 PM Local: 11:26 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 16, 1, 18, 0, false);          // UTC: 1:18 AM Local: 10:48 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 1, 13, 29, 0, false);          // UTC: 1:29 PM Local: 10:59 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 29, 11, 48, 0, false);         // UTC: 11:48 AM Local: 9:18 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 29, 5, 8, 0, false);           // UTC: 5:08 AM Local: 2:38 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 13, 19, 35, 0, false);         // UTC: 7:35 PM Local: 5:05 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 8, 8, 20, 0, false);           // UTC: 8:20 AM Local: 5:50 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 26, 19, 51, 0, false);         // UTC: 7:51 PM Local: 5:21 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 5, 1, 35, 0, false);           // UTC: 1:35 AM Local: 11:05 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 19, 22, 0, 0, false);          // UTC: 10:00 PM Local: 7:30 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 16, 15, 0, 0, false);          // UTC: 3:00 PM Local: 12:30 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 15, 20, 38, 0, false);         // UTC: 8:38 PM Local: 6:08 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 3, 1, 21, 0, false);           // UTC: 1:21 AM Local: 10:51 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 23, 21, 3, 0, false);          // UTC: 9:03 PM Local: 6:33 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 12, 1, 24, 0, false);          // UTC: 1:24 AM Local: 10:54 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 9, 19, 21, 14, 0, false);         // UTC: 9:14 PM Local: 6:44 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 20, 13, 7, 0, true);          // UTC: 1:07 PM Local: 11:37 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 23, 6, 35, 0, true);          // UTC: 6:35 AM Local: 5:05 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 28, 23, 41, 0, true);         // UTC: 11:41 PM Local: 10:11 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 27, 5, 18, 0, true);          // UTC: 5:18 AM Local: 3:48 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 9, 22, 11, 0, true);          // UTC: 10:11 PM Local: 8:41 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 24, 19, 52, 0, true);         // UTC: 7:52 PM Local: 6:22 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 7, 4, 14, 0, true);           // UTC: 4:14 AM Local: 2:44 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 13, 3, 16, 0, true);          // UTC: 3:16 AM Local: 1:46 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 15, 7, 10, 0, true);          // UTC: 7:10 AM Local: 5:40 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 14, 20, 33, 0, true);         // UTC: 8:33 PM Local: 7:03 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 8, 22, 51, 0, true);          // UTC: 10:51 PM Local: 9:21 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 17, 15, 30, 0, true);         // UTC: 3:30 PM Local: 2:00 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 9, 14, 45, 0, true);          // UTC: 2:45 PM Local: 1:15 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 5, 5, 55, 0, false);          // UTC: 5:55 AM Local: 3:25 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 8, 8, 19, 0, true);           // UTC: 8:19 AM Local: 6:49 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 18, 5, 10, 0, true);          // UTC: 5:10 AM Local: 3:40 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 21, 13, 56, 0, true);         // UTC: 1:56 PM Local: 12:26 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 25, 10, 45, 0, true);         // UTC: 10:45 AM Local: 9:15 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 5, 4, 32, 0, false);          // UTC: 4:32 AM Local: 2:02 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 7, 12, 49, 0, true);          // UTC: 12:49 PM Local: 11:19 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 27, 22, 20, 0, true);         // UTC: 10:20 PM Local: 8:50 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 17, 12, 18, 0, true);         // UTC: 12:18 PM Local: 10:48 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 13, 10, 42, 0, true);         // UTC: 10:42 AM Local: 9:12 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 18, 7, 28, 0, true);          // UTC: 7:28 AM Local: 5:58 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 10, 31, 21, 34, 0, true);         // UTC: 9:34 PM Local: 8:04 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 12, 12, 48, 0, true);         // UTC: 12:48 PM Local: 11:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 19, 13, 1, 0, true);          // UTC: 1:01 PM Local: 11:31 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 22, 13, 7, 0, true);          // UTC: 1:07 PM Local: 11:37 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 20, 16, 4, 0, true);          // UTC: 4:04 PM Local: 2:34 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 4, 4, 23, 0, true);           // UTC: 4:23 AM Local: 2:53 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 30, 20, 8, 0, true);          // UTC: 8:08 PM Local: 6:38 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 29, 17, 4, 0, true);          // UTC: 5:04 PM Local: 3:34 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 15, 10, 48, 0, true);         // UTC: 10:48 AM Local: 9:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 23, 3, 0, 0, true);           // UTC: 3:00 AM Local: 1:30 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 16, 17, 32, 0, true);         // UTC: 5:32 PM Local: 4:02 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 17, 14, 46, 0, true);         // UTC: 2:46 PM Local: 1:16 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 6, 13, 45, 0, true);          // UTC: 1:45 PM Local: 12:15 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 17, 1, 30, 0, true);          // UTC: 1:30 AM Local: 12:00 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 7, 22, 17, 0, true);          // UTC: 10:17 PM Local: 8:47 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 12, 21, 23, 0, true);         // UTC: 9:23 PM Local: 7:53 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 19, 8, 48, 0, true);          // UTC: 8:48 AM Local: 7:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 20, 18, 18, 0, true);         // UTC: 6:18 PM Local: 4:48 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 2, 13, 50, 0, true);          // UTC: 1:50 PM Local: 12:20 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 21, 20, 12, 0, true);         // UTC: 8:12 PM Local: 6:42 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 10, 2, 32, 0, true);          // UTC: 2:32 AM Local: 1:02 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 10, 21, 18, 0, true);         // UTC: 9:18 PM Local: 7:48 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 4, 13, 59, 0, true);          // UTC: 1:59 PM Local: 12:29 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 25, 20, 29, 0, true);         // UTC: 8:29 PM Local: 6:59 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 8, 18, 19, 0, true);          // UTC: 6:19 PM Local: 4:49 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 11, 14, 8, 46, 0, true);          // UTC: 8:46 AM Local: 7:16 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 10, 22, 38, 0, true);         // UTC: 10:38 PM Local: 9:08 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 23, 13, 24, 0, true);         // UTC: 1:24 PM Local: 11:54 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 6, 1, 41, 0, true);           // UTC: 1:41 AM Local: 12:11 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 31, 3, 34, 0, true);          // UTC: 3:34 AM Local: 2:04 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 1, 6, 37, 0, true);           // UTC: 6:37 AM Local: 5:07 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 24, 4, 56, 0, true);          // UTC: 4:56 AM Local: 3:26 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 11, 2, 28, 0, true);          // UTC: 2:28 AM Local: 12:58 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 4, 15, 13, 0, true);          // UTC: 3:13 PM Local: 1:43 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 24, 4, 39, 0, true);          // UTC: 4:39 AM Local: 3:09 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 2, 23, 22, 0, true);          // UTC: 11:22 PM Local: 9:52 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 19, 8, 46, 0, true);          // UTC: 8:46 AM Local: 7:16 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 5, 4, 41, 0, true);           // UTC: 4:41 AM Local: 3:11 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 18, 11, 27, 0, true);         // UTC: 11:27 AM Local: 9:57 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 4, 3, 7, 0, true);            // UTC: 3:07 AM Local: 1:37 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 31, 16, 29, 0, true);         // UTC: 4:29 PM Local: 2:59 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 26, 8, 20, 0, true);          // UTC: 8:20 AM Local: 6:50 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 28, 7, 48, 0, true);          // UTC: 7:48 AM Local: 6:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 11, 12, 45, 0, true);         // UTC: 12:45 PM Local: 11:15 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 17, 13, 16, 0, true);         // UTC: 1:16 PM Local: 11:46 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 14, 18, 36, 0, true);         // UTC: 6:36 PM Local: 5:06 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 26, 4, 25, 0, true);          // UTC: 4:25 AM Local: 2:55 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 10, 2, 44, 0, true);          // UTC: 2:44 AM Local: 1:14 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 21, 16, 31, 0, true);         // UTC: 4:31 PM Local: 3:01 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 6, 15, 47, 0, true);          // UTC: 3:47 PM Local: 2:17 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2019, 12, 30, 3, 48, 0, true);          // UTC: 3:48 AM Local: 2:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 26, 13, 55, 0, true);          // UTC: 1:55 PM Local: 12:25 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 29, 19, 37, 0, true);          // UTC: 7:37 PM Local: 6:07 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 1, 12, 27, 0, true);           // UTC: 12:27 PM Local: 10:57 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 16, 20, 13, 0, true);          // UTC: 8:13 PM Local: 6:43 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 17, 2, 39, 0, true);           // UTC: 2:39 AM Local: 1:09 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 12, 23, 36, 0, true);          // UTC: 11:36 PM Local: 10:06 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 26, 16, 33, 0, true);          // UTC: 4:33 PM Local: 3:03 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 6, 10, 2, 0, true);            // UTC: 10:02 AM Local: 8:32 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 17, 14, 41, 0, true);          // UTC: 2:41 PM Local: 1:11 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 9, 5, 9, 0, true);             // UTC: 5:09 AM Local: 3:39 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 8, 3, 36, 0, true);            // UTC: 3:36 AM Local: 2:06 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 21, 20, 37, 0, true);          // UTC: 8:37 PM Local: 7:07 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 25, 15, 1, 0, true);           // UTC: 3:01 PM Local: 1:31 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 31, 15, 51, 0, true);          // UTC: 3:51 PM Local: 2:21 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 28, 17, 18, 0, true);          // UTC: 5:18 PM Local: 3:48 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 28, 5, 46, 0, true);           // UTC: 5:46 AM Local: 4:16 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 7, 0, 19, 0, true);            // UTC: 12:19 AM Local: 10:49 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 26, 19, 31, 0, true);          // UTC: 7:31 PM Local: 6:01 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 25, 21, 48, 0, true);          // UTC: 9:48 PM Local: 8:18 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 30, 9, 40, 0, true);           // UTC: 9:40 AM Local: 8:10 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 28, 6, 14, 0, true);           // UTC: 6:14 AM Local: 4:44 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 8, 16, 19, 0, true);           // UTC: 4:19 PM Local: 2:49 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 19, 20, 47, 0, true);          // UTC: 8:47 PM Local: 7:17 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 21, 13, 33, 0, true);          // UTC: 1:33 PM Local: 12:03 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 1, 14, 20, 27, 0, true);          // UTC: 8:27 PM Local: 6:57 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 5, 1, 0, 0, true);             // UTC: 1:00 AM Local: 11:30 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 27, 22, 54, 0, true);          // UTC: 10:54 PM Local: 9:24 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 25, 22, 36, 0, true);          // UTC: 10:36 PM Local: 9:06 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 21, 17, 58, 0, true);          // UTC: 5:58 PM Local: 4:28 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 9, 23, 28, 0, true);           // UTC: 11:28 PM Local: 9:58 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 5, 20, 15, 0, true);           // UTC: 8:15 PM Local: 6:45 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 19, 22, 47, 0, true);          // UTC: 10:47 PM Local: 9:17 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 6, 3, 46, 0, true);            // UTC: 3:46 AM Local: 2:16 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 28, 13, 45, 0, true);          // UTC: 1:45 PM Local: 12:15 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 8, 5, 27, 0, true);            // UTC: 5:27 AM Local: 3:57 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 1, 2, 27, 0, true);            // UTC: 2:27 AM Local: 12:57 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 25, 13, 43, 0, true);          // UTC: 1:43 PM Local: 12:13 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 21, 4, 50, 0, true);           // UTC: 4:50 AM Local: 3:20 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 21, 18, 40, 0, true);          // UTC: 6:40 PM Local: 5:10 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 5, 12, 35, 0, true);           // UTC: 12:35 PM Local: 11:05 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 27, 7, 37, 0, true);           // UTC: 7:37 AM Local: 6:07 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 27, 16, 48, 0, true);          // UTC: 4:48 PM Local: 3:18 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 23, 20, 35, 0, true);          // UTC: 8:35 PM Local: 7:05 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 23, 1, 39, 0, true);           // UTC: 1:39 AM Local: 12:09 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 9, 6, 2, 0, true);             // UTC: 6:02 AM Local: 4:32 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 10, 8, 39, 0, true);           // UTC: 8:39 AM Local: 7:09 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 19, 16, 47, 0, true);          // UTC: 4:47 PM Local: 3:17 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 7, 6, 26, 0, true);            // UTC: 6:26 AM Local: 4:56 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 25, 22, 28, 0, true);          // UTC: 10:28 PM Local: 8:58 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 2, 22, 13, 8, 0, true);           // UTC: 1:08 PM Local: 11:38 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 31, 6, 18, 0, true);           // UTC: 6:18 AM Local: 4:48 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 16, 23, 46, 0, true);          // UTC: 11:46 PM Local: 10:16 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 16, 13, 40, 0, true);          // UTC: 1:40 PM Local: 12:10 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 12, 7, 52, 0, true);           // UTC: 7:52 AM Local: 6:22 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 14, 17, 39, 0, true);          // UTC: 5:39 PM Local: 4:09 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 19, 5, 5, 0, true);            // UTC: 5:05 AM Local: 3:35 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 2, 4, 0, 0, true);             // UTC: 4:00 AM Local: 2:30 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 19, 18, 52, 0, true);          // UTC: 6:52 PM Local: 5:22 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 28, 17, 20, 0, true);          // UTC: 5:20 PM Local: 3:50 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 14, 22, 27, 0, true);          // UTC: 10:27 PM Local: 8:57 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 12, 8, 48, 0, true);           // UTC: 8:48 AM Local: 7:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 1, 14, 46, 0, true);           // UTC: 2:46 PM Local: 1:16 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 5, 9, 27, 0, true);            // UTC: 9:27 AM Local: 7:57 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 20, 18, 15, 0, true);          // UTC: 6:15 PM Local: 4:45 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 7, 0, 3, 0, true);             // UTC: 12:03 AM Local: 10:33 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 5, 15, 42, 0, true);           // UTC: 3:42 PM Local: 2:12 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 10, 0, 7, 0, true);            // UTC: 12:07 AM Local: 10:37 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 30, 9, 36, 0, true);           // UTC: 9:36 AM Local: 8:06 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 19, 7, 20, 0, true);           // UTC: 7:20 AM Local: 5:50 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 4, 9, 36, 0, true);            // UTC: 9:36 AM Local: 8:06 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 22, 22, 52, 0, true);          // UTC: 10:52 PM Local: 9:22 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 3, 7, 37, 0, true);            // UTC: 7:37 AM Local: 6:07 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 13, 8, 59, 0, true);           // UTC: 8:59 AM Local: 7:29 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 2, 21, 14, 0, true);           // UTC: 9:14 PM Local: 7:44 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 3, 10, 0, 23, 0, true);           // UTC: 12:23 AM Local: 10:53 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 19, 8, 18, 0, false);          // UTC: 8:18 AM Local: 5:48 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 2, 6, 30, 0, true);            // UTC: 6:30 AM Local: 5:00 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 24, 13, 5, 0, false);          // UTC: 1:05 PM Local: 10:35 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 26, 18, 0, 0, false);          // UTC: 6:00 PM Local: 3:30 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 27, 0, 55, 0, false);          // UTC: 12:55 AM Local: 10:25 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 9, 5, 48, 0, false);           // UTC: 5:48 AM Local: 3:18 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 26, 13, 49, 0, false);         // UTC: 1:49 PM Local: 11:19 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 22, 12, 56, 0, false);         // UTC: 12:56 PM Local: 10:26 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 16, 10, 51, 0, false);         // UTC: 10:51 AM Local: 8:21 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 5, 17, 1, 0, false);           // UTC: 5:01 PM Local: 2:31 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 24, 8, 28, 0, false);          // UTC: 8:28 AM Local: 5:58 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 27, 0, 21, 0, false);          // UTC: 12:21 AM Local: 9:51 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 9, 18, 36, 0, false);          // UTC: 6:36 PM Local: 4:06 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 30, 5, 16, 0, false);          // UTC: 5:16 AM Local: 2:46 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 25, 7, 58, 0, false);          // UTC: 7:58 AM Local: 5:28 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 15, 9, 0, 0, false);           // UTC: 9:00 AM Local: 6:30 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 23, 10, 49, 0, false);         // UTC: 10:49 AM Local: 8:19 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 6, 17, 42, 0, false);          // UTC: 5:42 PM Local: 3:12 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 18, 18, 37, 0, false);         // UTC: 6:37 PM Local: 4:07 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 2, 18, 43, 0, true);           // UTC: 6:43 PM Local: 5:13 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 4, 12, 10, 0, true);           // UTC: 12:10 PM Local: 10:40 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 12, 21, 32, 0, false);         // UTC: 9:32 PM Local: 7:02 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 5, 13, 37, 0, false);          // UTC: 1:37 PM Local: 11:07 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 14, 22, 13, 0, false);         // UTC: 10:13 PM Local: 7:43 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 4, 14, 14, 30, 0, false);         // UTC: 2:30 PM Local: 12:00 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 29, 9, 30, 0, false);          // UTC: 9:30 AM Local: 7:00 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 17, 22, 41, 0, false);         // UTC: 10:41 PM Local: 8:11 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 23, 12, 42, 0, false);         // UTC: 12:42 PM Local: 10:12 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 15, 15, 26, 0, false);         // UTC: 3:26 PM Local: 12:56 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 2, 22, 28, 0, false);          // UTC: 10:28 PM Local: 7:58 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 25, 14, 42, 0, false);         // UTC: 2:42 PM Local: 12:12 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 27, 9, 15, 0, false);          // UTC: 9:15 AM Local: 6:45 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 1, 23, 16, 0, false);          // UTC: 11:16 PM Local: 8:46 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 19, 2, 45, 0, false);          // UTC: 2:45 AM Local: 12:15 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 13, 17, 2, 0, false);          // UTC: 5:02 PM Local: 2:32 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 23, 19, 11, 0, false);         // UTC: 7:11 PM Local: 4:41 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 31, 5, 2, 0, false);           // UTC: 5:02 AM Local: 2:32 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 12, 6, 16, 0, false);          // UTC: 6:16 AM Local: 3:46 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 26, 11, 27, 0, false);         // UTC: 11:27 AM Local: 8:57 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 28, 1, 17, 0, false);          // UTC: 1:17 AM Local: 10:47 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 23, 12, 51, 0, false);         // UTC: 12:51 PM Local: 10:21 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 10, 14, 18, 0, false);         // UTC: 2:18 PM Local: 11:48 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 12, 12, 48, 0, false);         // UTC: 12:48 PM Local: 10:18 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 13, 1, 55, 0, false);          // UTC: 1:55 AM Local: 11:25 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 5, 16, 25, 0, false);          // UTC: 4:25 PM Local: 1:55 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 25, 6, 1, 0, false);           // UTC: 6:01 AM Local: 3:31 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 1, 18, 5, 0, false);           // UTC: 6:05 PM Local: 3:35 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 7, 10, 9, 0, false);           // UTC: 10:09 AM Local: 7:39 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 21, 18, 44, 0, false);         // UTC: 6:44 PM Local: 4:14 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 5, 21, 1, 40, 0, false);          // UTC: 1:40 AM Local: 11:10 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 25, 20, 16, 0, false);         // UTC: 8:16 PM Local: 5:46 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 29, 20, 28, 0, false);         // UTC: 8:28 PM Local: 5:58 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 26, 21, 4, 0, false);          // UTC: 9:04 PM Local: 6:34 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 4, 14, 3, 0, false);           // UTC: 2:03 PM Local: 11:33 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 11, 2, 32, 0, false);          // UTC: 2:32 AM Local: 12:02 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 11, 23, 27, 0, false);         // UTC: 11:27 PM Local: 8:57 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 1, 12, 3, 0, false);           // UTC: 12:03 PM Local: 9:33 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 11, 10, 29, 0, false);         // UTC: 10:29 AM Local: 7:59 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 30, 14, 5, 0, false);          // UTC: 2:05 PM Local: 11:35 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 24, 2, 29, 0, false);          // UTC: 2:29 AM Local: 11:59 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 14, 4, 8, 0, false);           // UTC: 4:08 AM Local: 1:38 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 27, 22, 51, 0, false);         // UTC: 10:51 PM Local: 8:21 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 26, 3, 18, 0, false);          // UTC: 3:18 AM Local: 12:48 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 29, 23, 54, 0, false);         // UTC: 11:54 PM Local: 9:24 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 16, 2, 51, 0, false);          // UTC: 2:51 AM Local: 12:21 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 15, 4, 31, 0, false);          // UTC: 4:31 AM Local: 2:01 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 14, 19, 31, 0, false);         // UTC: 7:31 PM Local: 5:01 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 16, 12, 4, 0, false);          // UTC: 12:04 PM Local: 9:34 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 7, 7, 52, 0, false);           // UTC: 7:52 AM Local: 5:22 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 19, 8, 57, 0, false);          // UTC: 8:57 AM Local: 6:27 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 5, 20, 39, 0, false);          // UTC: 8:39 PM Local: 6:09 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 28, 18, 48, 0, false);         // UTC: 6:48 PM Local: 4:18 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 30, 6, 31, 0, false);          // UTC: 6:31 AM Local: 4:01 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 3, 4, 10, 0, false);           // UTC: 4:10 AM Local: 1:40 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 6, 26, 15, 59, 0, false);         // UTC: 3:59 PM Local: 1:29 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 31, 20, 10, 0, false);         // UTC: 8:10 PM Local: 5:40 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 10, 4, 10, 0, false);          // UTC: 4:10 AM Local: 1:40 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 2, 15, 30, 0, false);          // UTC: 3:30 PM Local: 1:00 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 18, 3, 51, 0, false);          // UTC: 3:51 AM Local: 1:21 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 21, 22, 19, 0, false);         // UTC: 10:19 PM Local: 7:49 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 28, 2, 35, 0, false);          // UTC: 2:35 AM Local: 12:05 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 28, 11, 43, 0, false);         // UTC: 11:43 AM Local: 9:13 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 25, 7, 16, 0, false);          // UTC: 7:16 AM Local: 4:46 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 22, 4, 49, 0, false);          // UTC: 4:49 AM Local: 2:19 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 3, 9, 25, 0, false);           // UTC: 9:25 AM Local: 6:55 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 5, 14, 52, 0, false);          // UTC: 2:52 PM Local: 12:22 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 18, 23, 42, 0, false);         // UTC: 11:42 PM Local: 9:12 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 4, 21, 13, 0, false);          // UTC: 9:13 PM Local: 6:43 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 6, 15, 55, 0, false);          // UTC: 3:55 PM Local: 1:25 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 23, 6, 28, 0, false);          // UTC: 6:28 AM Local: 3:58 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 15, 8, 2, 0, false);           // UTC: 8:02 AM Local: 5:32 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 7, 3, 18, 0, false);           // UTC: 3:18 AM Local: 12:48 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 5, 15, 25, 0, false);          // UTC: 3:25 PM Local: 12:55 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 15, 22, 34, 0, false);         // UTC: 10:34 PM Local: 8:04 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 1, 6, 32, 0, false);           // UTC: 6:32 AM Local: 4:02 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 19, 22, 41, 0, false);         // UTC: 10:41 PM Local: 8:11 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 15, 23, 29, 0, false);         // UTC: 11:29 PM Local: 8:59 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 4, 11, 55, 0, false);          // UTC: 11:55 AM Local: 9:25 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 1, 18, 3, 0, false);           // UTC: 6:03 PM Local: 3:33 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 7, 17, 23, 46, 0, false);         // UTC: 11:46 PM Local: 9:16 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 19, 22, 50, 0, false);         // UTC: 10:50 PM Local: 8:20 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 5, 3, 34, 0, false);           // UTC: 3:34 AM Local: 1:04 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 16, 3, 47, 0, false);          // UTC: 3:47 AM Local: 1:17 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 18, 6, 33, 0, false);          // UTC: 6:33 AM Local: 4:03 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 3, 13, 29, 0, false);          // UTC: 1:29 PM Local: 10:59 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 6, 17, 7, 0, false);           // UTC: 5:07 PM Local: 2:37 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 23, 5, 14, 0, false);          // UTC: 5:14 AM Local: 2:44 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 4, 0, 4, 0, false);            // UTC: 12:04 AM Local: 9:34 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 26, 2, 33, 0, false);          // UTC: 2:33 AM Local: 12:03 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 3, 1, 56, 0, false);           // UTC: 1:56 AM Local: 11:26 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 29, 4, 36, 0, false);          // UTC: 4:36 AM Local: 2:06 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 10, 13, 44, 0, false);         // UTC: 1:44 PM Local: 11:14 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 30, 6, 8, 0, false);           // UTC: 6:08 AM Local: 3:38 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 31, 4, 16, 0, false);          // UTC: 4:16 AM Local: 1:46 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 24, 21, 27, 0, false);         // UTC: 9:27 PM Local: 6:57 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 12, 7, 35, 0, false);          // UTC: 7:35 AM Local: 5:05 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 2, 7, 34, 0, false);           // UTC: 7:34 AM Local: 5:04 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 17, 21, 11, 0, false);         // UTC: 9:11 PM Local: 6:41 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 6, 2, 8, 0, false);            // UTC: 2:08 AM Local: 11:38 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 7, 22, 8, 0, false);           // UTC: 10:08 PM Local: 7:38 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 16, 2, 59, 0, false);          // UTC: 2:59 AM Local: 12:29 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 13, 11, 36, 0, false);         // UTC: 11:36 AM Local: 9:06 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 30, 7, 19, 0, false);          // UTC: 7:19 AM Local: 4:49 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 19, 12, 31, 0, false);         // UTC: 12:31 PM Local: 10:01 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 8, 27, 5, 40, 0, false);          // UTC: 5:40 AM Local: 3:10 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 15, 1, 37, 0, false);          // UTC: 1:37 AM Local: 11:07 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 20, 16, 9, 0, false);          // UTC: 4:09 PM Local: 1:39 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 28, 17, 10, 0, false);         // UTC: 5:10 PM Local: 2:40 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 24, 22, 23, 0, false);         // UTC: 10:23 PM Local: 7:53 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 14, 9, 39, 0, false);          // UTC: 9:39 AM Local: 7:09 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 27, 23, 46, 0, false);         // UTC: 11:46 PM Local: 9:16 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 25, 1, 46, 0, false);          // UTC: 1:46 AM Local: 11:16 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 7, 2, 25, 0, false);           // UTC: 2:25 AM Local: 11:55 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 24, 19, 49, 0, false);         // UTC: 7:49 PM Local: 5:19 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 24, 15, 55, 0, false);         // UTC: 3:55 PM Local: 1:25 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 20, 5, 43, 0, false);          // UTC: 5:43 AM Local: 3:13 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 26, 17, 39, 0, false);         // UTC: 5:39 PM Local: 3:09 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 19, 16, 2, 0, false);          // UTC: 4:02 PM Local: 1:32 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 15, 13, 16, 0, false);         // UTC: 1:16 PM Local: 10:46 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 27, 17, 26, 0, false);         // UTC: 5:26 PM Local: 2:56 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 30, 20, 10, 0, false);         // UTC: 8:10 PM Local: 5:40 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 27, 5, 29, 0, false);          // UTC: 5:29 AM Local: 2:59 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 26, 19, 39, 0, false);         // UTC: 7:39 PM Local: 5:09 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 5, 2, 15, 0, false);           // UTC: 2:15 AM Local: 11:45 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 22, 3, 12, 0, false);          // UTC: 3:12 AM Local: 12:42 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 6, 5, 59, 0, false);           // UTC: 5:59 AM Local: 3:29 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 22, 13, 6, 0, false);          // UTC: 1:06 PM Local: 10:36 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 9, 0, 57, 0, false);           // UTC: 12:57 AM Local: 10:27 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 24, 16, 19, 0, false);         // UTC: 4:19 PM Local: 1:49 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 9, 9, 7, 5, 0, false);            // UTC: 7:05 AM Local: 4:35 PM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 27, 9, 54, 0, true);          // UTC: 9:54 AM Local: 8:24 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 15, 15, 11, 0, true);         // UTC: 3:11 PM Local: 1:41 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 18, 2, 6, 0, true);           // UTC: 2:06 AM Local: 12:36 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 18, 10, 48, 0, true);         // UTC: 10:48 AM Local: 9:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 12, 8, 57, 0, true);          // UTC: 8:57 AM Local: 7:27 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 28, 22, 4, 0, true);          // UTC: 10:04 PM Local: 8:34 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 28, 5, 50, 0, true);          // UTC: 5:50 AM Local: 4:20 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 1, 18, 52, 0, false);         // UTC: 6:52 PM Local: 4:22 AM Offset: 09:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 24, 8, 5, 0, true);           // UTC: 8:05 AM Local: 6:35 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 8, 23, 49, 0, true);          // UTC: 11:49 PM Local: 10:19 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 18, 5, 40, 0, true);          // UTC: 5:40 AM Local: 4:10 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 23, 7, 28, 0, true);          // UTC: 7:28 AM Local: 5:58 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 11, 3, 38, 0, true);          // UTC: 3:38 AM Local: 2:08 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 27, 8, 12, 0, true);          // UTC: 8:12 AM Local: 6:42 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 15, 5, 8, 0, true);           // UTC: 5:08 AM Local: 3:38 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 26, 9, 3, 0, true);           // UTC: 9:03 AM Local: 7:33 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 5, 10, 45, 0, true);          // UTC: 10:45 AM Local: 9:15 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 22, 12, 0, 0, true);          // UTC: 12:00 PM Local: 10:30 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 30, 3, 57, 0, true);          // UTC: 3:57 AM Local: 2:27 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 7, 9, 39, 0, true);           // UTC: 9:39 AM Local: 8:09 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 14, 13, 29, 0, true);         // UTC: 1:29 PM Local: 11:59 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 23, 15, 4, 0, true);          // UTC: 3:04 PM Local: 1:34 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 13, 14, 53, 0, true);         // UTC: 2:53 PM Local: 1:23 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 26, 18, 16, 0, true);         // UTC: 6:16 PM Local: 4:46 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 10, 20, 18, 19, 0, true);         // UTC: 6:19 PM Local: 4:49 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 6, 7, 15, 0, true);           // UTC: 7:15 AM Local: 5:45 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 19, 18, 57, 0, true);         // UTC: 6:57 PM Local: 5:27 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 21, 15, 2, 0, true);          // UTC: 3:02 PM Local: 1:32 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 10, 2, 43, 0, true);          // UTC: 2:43 AM Local: 1:13 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 1, 18, 14, 0, true);          // UTC: 6:14 PM Local: 4:44 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 18, 15, 17, 0, true);         // UTC: 3:17 PM Local: 1:47 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 5, 10, 32, 0, true);          // UTC: 10:32 AM Local: 9:02 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 21, 1, 38, 0, true);          // UTC: 1:38 AM Local: 12:08 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 23, 15, 23, 0, true);         // UTC: 3:23 PM Local: 1:53 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 29, 16, 14, 0, true);         // UTC: 4:14 PM Local: 2:44 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 26, 21, 13, 0, true);         // UTC: 9:13 PM Local: 7:43 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 25, 22, 9, 0, true);          // UTC: 10:09 PM Local: 8:39 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 26, 13, 11, 0, true);         // UTC: 1:11 PM Local: 11:41 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 5, 19, 37, 0, true);          // UTC: 7:37 PM Local: 6:07 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 4, 14, 20, 0, true);          // UTC: 2:20 PM Local: 12:50 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 28, 14, 13, 0, true);         // UTC: 2:13 PM Local: 12:43 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 14, 19, 25, 0, true);         // UTC: 7:25 PM Local: 5:55 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 23, 14, 9, 0, true);          // UTC: 2:09 PM Local: 12:39 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 14, 17, 8, 0, true);          // UTC: 5:08 PM Local: 3:38 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 8, 16, 48, 0, true);          // UTC: 4:48 PM Local: 3:18 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 24, 3, 25, 0, true);          // UTC: 3:25 AM Local: 1:55 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 30, 5, 53, 0, true);          // UTC: 5:53 AM Local: 4:23 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 7, 10, 13, 0, true);          // UTC: 10:13 AM Local: 8:43 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 30, 22, 42, 0, true);         // UTC: 10:42 PM Local: 9:12 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 11, 12, 2, 17, 0, true);          // UTC: 2:17 AM Local: 12:47 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 5, 4, 51, 0, true);           // UTC: 4:51 AM Local: 3:21 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 9, 0, 21, 0, true);           // UTC: 12:21 AM Local: 10:51 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 24, 20, 41, 0, true);         // UTC: 8:41 PM Local: 7:11 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 7, 13, 55, 0, true);          // UTC: 1:55 PM Local: 12:25 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 14, 10, 19, 0, true);         // UTC: 10:19 AM Local: 8:49 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 12, 7, 51, 0, true);          // UTC: 7:51 AM Local: 6:21 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 20, 8, 13, 0, true);          // UTC: 8:13 AM Local: 6:43 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 20, 7, 31, 0, true);          // UTC: 7:31 AM Local: 6:01 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 28, 17, 42, 0, true);         // UTC: 5:42 PM Local: 4:12 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 10, 4, 29, 0, true);          // UTC: 4:29 AM Local: 2:59 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 20, 8, 41, 0, true);          // UTC: 8:41 AM Local: 7:11 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 30, 22, 12, 0, true);         // UTC: 10:12 PM Local: 8:42 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 11, 0, 7, 0, true);           // UTC: 12:07 AM Local: 10:37 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 29, 19, 10, 0, true);         // UTC: 7:10 PM Local: 5:40 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 26, 17, 31, 0, true);         // UTC: 5:31 PM Local: 4:01 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 15, 5, 23, 0, true);          // UTC: 5:23 AM Local: 3:53 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 21, 9, 6, 0, true);           // UTC: 9:06 AM Local: 7:36 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 22, 13, 15, 0, true);         // UTC: 1:15 PM Local: 11:45 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 27, 1, 6, 0, true);           // UTC: 1:06 AM Local: 11:36 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 1, 19, 27, 0, true);          // UTC: 7:27 PM Local: 5:57 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 21, 21, 36, 0, true);         // UTC: 9:36 PM Local: 8:06 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 3, 0, 44, 0, true);           // UTC: 12:44 AM Local: 11:14 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 26, 4, 48, 0, true);          // UTC: 4:48 AM Local: 3:18 PM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 5, 13, 56, 0, true);          // UTC: 1:56 PM Local: 12:26 AM Offset: 10:30:00
+	testCount++; failedCount += test(timeManager, 19, 2020, 12, 21, 18, 9, 0, true);          // UTC: 6:09 PM Local: 4:39 AM Offset: 10:30:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
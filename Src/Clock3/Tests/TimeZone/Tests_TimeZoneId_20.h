@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_20_H
+#define TEST_TIMEZONEID_20_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_20_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 29, 23, 43, 0, true);          // UTC: 11:43 PM Local: 10:43 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 26, 4, 16, 0, true);           // UTC: 4:16 AM Local: 3:16 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 22, 20, 54, 0, true);          // UTC: 8:54 PM Local: 7:54 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 29, 3, 55, 0, true);           // UTC: 3:55 AM Local: 2:55 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 11, 18, 57, 0, true);          // UTC: 6:57 PM Local: 5:57 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 6, 0, 26, 0, true);            // UTC: 12:26 AM Local: 11:26 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 14, 2, 6, 0, true);            // UTC: 2:06 AM Local: 1:06 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 5, 10, 30, 0, true);           // UTC: 10:30 AM Local: 9:30 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 31, 18, 28, 0, true);          // UTC: 6:28 PM Local: 5:28 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 14, 6, 12, 0, true);           // UTC: 6:12 AM Local: 5:12 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 11, 20, 58, 0, true);          // UTC: 8:58 PM Local: 7:58 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 22, 10, 21, 0, true);          // UTC: 10:21 AM Local: 9:21 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 14, 2, 40, 0, true);           // UTC: 2:40 AM Local: 1:40 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 17, 15, 25, 0, true);          // UTC: 3:25 PM Local: 2:25 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 3, 6, 36, 0, true);            // UTC: 6:36 AM Local: 5:36 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 8, 1, 12, 0, true);            // UTC: 1:12 AM Local: 12:12 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 4, 2, 12, 0, true);            // UTC: 2:12 AM Local: 1:12 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 9, 22, 48, 0, true);           // UTC: 10:48 PM Local: 9:48 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 10, 9, 44, 0, true);           // UTC: 9:44 AM Local: 8:44 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 9, 5, 39, 0, true);            // UTC: 5:39 AM Local: 4:39 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 4, 0, 17, 0, true);            // UTC: 12:17 AM Local: 11:17 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 23, 7, 54, 0, true);           // UTC: 7:54 AM Local: 6:54 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 27, 7, 36, 0, true);           // UTC: 7:36 AM Local: 6:36 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 8, 1, 0, 0, true);             // UTC: 1:00 AM Local: 12:00 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 1, 26, 20, 39, 0, true);          // UTC: 8:39 PM Local: 7:39 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 10, 8, 8, 0, true);            // UTC: 8:08 AM Local: 7:08 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 23, 20, 21, 0, true);          // UTC: 8:21 PM Local: 7:21 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 20, 23, 28, 0, true);          // UTC: 11:28 PM Local: 10:28 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 5, 20, 17, 0, true);           // UTC: 8:17 PM Local: 7:17 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 18, 13, 10, 0, true);          // UTC: 1:10 PM Local: 12:10 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 6, 12, 59, 0, true);           // UTC: 12:59 PM Local: 11:59 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 23, 3, 44, 0, true);           // UTC: 3:44 AM Local: 2:44 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 5, 18, 27, 0, true);           // UTC: 6:27 PM Local: 5:27 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 12, 7, 7, 0, true);            // UTC: 7:07 AM Local: 6:07 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 20, 1, 33, 0, true);           // UTC: 1:33 AM Local: 12:33 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 7, 13, 11, 0, true);           // UTC: 1:11 PM Local: 12:11 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 6, 2, 7, 0, true);             // UTC: 2:07 AM Local: 1:07 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 26, 9, 0, 0, true);            // UTC: 9:00 AM Local: 8:00 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 26, 20, 51, 0, true);          // UTC: 8:51 PM Local: 7:51 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 11, 21, 46, 0, true);          // UTC: 9:46 PM Local: 8:46 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 13, 14, 33, 0, true);          // UTC: 2:33 PM Local: 1:33 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 25, 23, 3, 0, true);           // UTC: 11:03 PM Local: 10:03 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 27, 21, 10, 0, true);          // UTC: 9:10 PM Local: 8:10 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 4, 14, 35, 0, true);           // UTC: 2:35 PM Local: 1:35 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 11, 0, 4, 0, true);            // UTC: 12:04 AM Local: 11:04 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 19, 23, 6, 0, true);           // UTC: 11:06 PM Local: 10:06 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 3, 10, 16, 0, true);           // UTC: 10:16 AM Local: 9:16 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 21, 2, 42, 0, true);           // UTC: 2:42 AM Local: 1:42 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 25, 9, 42, 0, true);           // UTC: 9:42 AM Local: 8:42 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 2, 2, 0, 12, 0, true);            // UTC: 12:12 AM Local: 11:12 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 8, 16, 32, 0, true);           // UTC: 4:32 PM Local: 3:32 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 23, 0, 10, 0, true);           // UTC: 12:10 AM Local: 11:10 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 1, 21, 47, 0, true);           // UTC: 9:47 PM Local: 8:47 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 17, 4, 57, 0, true);           // UTC: 4:57 AM Local: 3:57 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 10, 4, 26, 0, true);           // UTC: 4:26 AM Local: 3:26 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 9, 3, 24, 0, true);            // UTC: 3:24 AM Local: 2:24 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 4, 6, 15, 0, true);            // UTC: 6:15 AM Local: 5:15 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 7, 7, 6, 0, true);             // UTC: 7:06 AM Local: 6:06 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 10, 4, 35, 0, true);           // UTC: 4:35 AM Local: 3:35 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 13, 4, 41, 0, true);           // UTC: 4:41 AM Local: 3:41 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 3, 14, 31, 0, true);           // UTC: 2:31 PM Local: 1:31 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 1, 5, 12, 0, true);            // UTC: 5:12 AM Local: 4:12 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 27, 20, 19, 0, true);          // UTC: 8:19 PM Local: 7:19 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 13, 3, 58, 0, true);           // UTC: 3:58 AM Local: 2:58 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 27, 9, 13, 0, true);           // UTC: 9:13 AM Local: 8:13 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 12, 19, 19, 0, true);          // UTC: 7:19 PM Local: 6:19 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 5, 21, 46, 0, true);           // UTC: 9:46 PM Local: 8:46 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 4, 0, 17, 0, true);            // UTC: 12:17 AM Local: 11:17 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 2, 12, 23, 0, true);           // UTC: 12:23 PM Local: 11:23 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 24, 9, 25, 0, true);           // UTC: 9:25 AM Local: 8:25 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 27, 14, 51, 0, true);          // UTC: 2:51 PM Local: 1:51 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 4, 2, 36, 0, true);            // UTC: 2:36 AM Local: 1:36 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 16, 6, 58, 0, true);           // UTC: 6:58 AM Local: 5:58 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 1, 22, 46, 0, true);           // UTC: 10:46 PM Local: 9:46 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 3, 17, 2, 59, 0, true);           // UTC: 2:59 AM Local: 1:59 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 25, 17, 39, 0, false);         // UTC: 5:39 PM Local: 3:39 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 11, 22, 0, 0, false);          // UTC: 10:00 PM Local: 8:00 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 6, 8, 18, 0, false);           // UTC: 8:18 AM Local: 6:18 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 20, 3, 0, 0, false);           // UTC: 3:00 AM Local: 1:00 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 2, 6, 47, 0, false);           // UTC: 6:47 AM Local: 4:47 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 7, 19, 25, 0, false);          // UTC: 7:25 PM Local: 5:25 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 23, 19, 5, 0, false);          // UTC: 7:05 PM Local: 5:05 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 19, 11, 50, 0, false);         // UTC: 11:50 AM Local: 9:50 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 10, 14, 3, 0, false);          // UTC: 2:03 PM Local: 12:03 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 26, 20, 8, 0, false);          // UTC: 8:08 PM Local: 6:08 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 29, 19, 24, 0, false);         // UTC: 7:24 PM Local: 5:24 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 29, 17, 25, 0, false);         // UTC: 5:25 PM Local: 3:25 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 13, 8, 0, 0, false);           // UTC: 8:00 AM Local: 6:00 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 26, 14, 5, 0, false);          // UTC: 2:05 PM Local: 12:05 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 19, 15, 20, 0, false);         // UTC: 3:20 PM Local: 1:20 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 8, 6, 18, 0, false);           // UTC: 6:18 AM Local: 4:18 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 15, 10, 24, 0, false);         // UTC: 10:24 AM Local: 8:24 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 7, 19, 3, 0, false);           // UTC: 7:03 PM Local: 5:03 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 12, 4, 5, 0, false);           // UTC: 4:05 AM Local: 2:05 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 24, 11, 1, 0, false);          // UTC: 11:01 AM Local: 9:01 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 25, 3, 30, 0, false);          // UTC: 3:30 AM Local: 1:30 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 8, 17, 9, 0, false);           // UTC: 5:09 PM Local: 3:09 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 10, 23, 0, 0, false);          // UTC: 11:00 PM Local: 9:00 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 5, 21, 23, 0, false);          // UTC: 9:23 PM Local: 7:23 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 4, 12, 16, 9, 0, false);          // UTC: 4:09 PM Local: 2:09 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 1, 7, 27, 0, false);           // UTC: 7:27 AM Local: 5:27 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 17, 14, 15, 0, false);         // UTC: 2:15 PM Local: 12:15 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 30, 12, 24, 0, false);         // UTC: 12:24 PM Local: 10:24 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 23, 17, 53, 0, false);         // UTC: 5:53 PM Local: 3:53 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 23, 9, 32, 0, false);          // UTC: 9:32 AM Local: 7:32 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 20, 20, 45, 0, false);         // UTC: 8:45 PM Local: 6:45 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 10, 19, 48, 0, false);         // UTC: 7:48 PM Local: 5:48 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 25, 2, 41, 0, false);          // UTC: 2:41 AM Local: 12:41 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 16, 8, 22, 0, false);          // UTC: 8:22 AM Local: 6:22 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 24, 4, 29, 0, false);          // UTC: 4:29 AM Local: 2:29 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 22, 23, 54, 0, false);         // UTC: 11:54 PM Local: 9:54 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 8, 15, 8, 0, false);           // UTC: 3:08 PM Local: 1:08 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 12, 10, 57, 0, false);         // UTC: 10:57 AM Local: 8:57 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 21, 17, 9, 0, false);          // UTC: 5:09 PM Local: 3:09 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 21, 23, 44, 0, false);         // UTC: 11:44 PM Local: 9:44 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 24, 21, 43, 0, false);         // UTC: 9:43 PM Local: 7:43 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 18, 3, 47, 0, false);          // UTC: 3:47 AM Local: 1:47 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 9, 20, 2, 0, false);           // UTC: 8:02 PM Local: 6:02 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 17, 6, 23, 0, false);          // UTC: 6:23 AM Local: 4:23 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 13, 6, 34, 0, false);          // UTC: 6:34 AM Local: 4:34 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 17, 22, 19, 0, false);         // UTC: 10:19 PM Local: 8:19 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 27, 15, 40, 0, false);         // UTC: 3:40 PM Local: 1:40 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 6, 4, 8, 0, false);            // UTC: 4:08 AM Local: 2:08 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 9, 0, 36, 0, false);           // UTC: 12:36 AM Local: 10:36 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 5, 22, 2, 56, 0, false);          // UTC: 2:56 AM Local: 12:56 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 25, 5, 21, 0, false);          // UTC: 5:21 AM Local: 3:21 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 9, 7, 49, 0, false);           // UTC: 7:49 AM Local: 5:49 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 22, 10, 5, 0, false);          // UTC: 10:05 AM Local: 8:05 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 5, 8, 16, 0, false);           // UTC: 8:16 AM Local: 6:16 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 4, 4, 19, 0, false);           // UTC: 4:19 AM Local: 2:19 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 3, 15, 2, 0, false);           // UTC: 3:02 PM Local: 1:02 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 17, 1, 30, 0, false);          // UTC: 1:30 AM Local: 11:30 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 16, 12, 45, 0, false);         // UTC: 12:45 PM Local: 10:45 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 28, 16, 47, 0, false);         // UTC: 4:47 PM Local: 2:47 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 22, 3, 41, 0, false);          // UTC: 3:41 AM Local: 1:41 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 29, 4, 52, 0, false);          // UTC: 4:52 AM Local: 2:52 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 23, 9, 32, 0, false);          // UTC: 9:32 AM Local: 7:32 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 18, 13, 59, 0, false);         // UTC: 1:59 PM Local: 11:59 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 6, 14, 28, 0, false);          // UTC: 2:28 PM Local: 12:28 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 22, 16, 30, 0, false);         // UTC: 4:30 PM Local: 2:30 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 27, 4, 11, 0, false);          // UTC: 4:11 AM Local: 2:11 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 7, 6, 18, 0, false);           // UTC: 6:18 AM Local: 4:18 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 4, 6, 28, 0, false);           // UTC: 6:28 AM Local: 4:28 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 13, 14, 4, 0, false);          // UTC: 2:04 PM Local: 12:04 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 28, 9, 40, 0, false);          // UTC: 9:40 AM Local: 7:40 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 18, 3, 51, 0, false);          // UTC: 3:51 AM Local: 1:51 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 7, 23, 57, 0, false);          // UTC: 11:57 PM Local: 9:57 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 27, 6, 46, 0, false);          // UTC: 6:46 AM Local: 4:46 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 10, 6, 32, 0, false);          // UTC: 6:32 AM Local: 4:32 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 6, 10, 13, 54, 0, false);         // UTC: 1:54 PM Local: 11:54 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 16, 3, 23, 0, false);          // UTC: 3:23 AM Local: 1:23 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 17, 7, 47, 0, false);          // UTC: 7:47 AM Local: 5:47 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 26, 5, 35, 0, false);          // UTC: 5:35 AM Local: 3:35 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 19, 11, 52, 0, false);         // UTC: 11:52 AM Local: 9:52 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 10, 4, 0, 0, false);           // UTC: 4:00 AM Local: 2:00 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 11, 12, 9, 0, false);          // UTC: 12:09 PM Local: 10:09 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 10, 16, 58, 0, false);         // UTC: 4:58 PM Local: 2:58 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 28, 23, 8, 0, false);          // UTC: 11:08 PM Local: 9:08 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 17, 2, 11, 0, false);          // UTC: 2:11 AM Local: 12:11 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 20, 16, 33, 0, false);         // UTC: 4:33 PM Local: 2:33 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 2, 3, 55, 0, false);           // UTC: 3:55 AM Local: 1:55 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 9, 13, 36, 0, false);          // UTC: 1:36 PM Local: 11:36 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 30, 2, 34, 0, false);          // UTC: 2:34 AM Local: 12:34 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 7, 19, 53, 0, false);          // UTC: 7:53 PM Local: 5:53 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 29, 21, 28, 0, false);         // UTC: 9:28 PM Local: 7:28 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 15, 13, 59, 0, false);         // UTC: 1:59 PM Local: 11:59 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 23, 1, 45, 0, false);          // UTC: 1:45 AM Local: 11:45 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 22, 5, 53, 0, false);          // UTC: 5:53 AM Local: 3:53 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 6, 3, 31, 0, false);           // UTC: 3:31 AM Local: 1:31 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 23, 19, 36, 0, false);         // UTC: 7:36 PM Local: 5:36 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 24, 20, 19, 0, false);         // UTC: 8:19 PM Local: 6:19 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 6, 7, 17, 0, false);           // UTC: 7:17 AM Local: 5:17 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 31, 7, 7, 0, false);           // UTC: 7:07 AM Local: 5:07 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 4, 17, 44, 0, false);          // UTC: 5:44 PM Local: 3:44 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 7, 18, 18, 28, 0, false);         // UTC: 6:28 PM Local: 4:28 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 14, 10, 50, 0, false);         // UTC: 10:50 AM Local: 8:50 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 8, 17, 46, 0, false);          // UTC: 5:46 PM Local: 3:46 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 6, 16, 3, 0, false);           // UTC: 4:03 PM Local: 2:03 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 15, 2, 32, 0, false);          // UTC: 2:32 AM Local: 12:32 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 1, 9, 1, 0, false);            // UTC: 9:01 AM Local: 7:01 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 29, 8, 49, 0, false);          // UTC: 8:49 AM Local: 6:49 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 12, 8, 59, 0, false);          // UTC: 8:59 AM Local: 6:59 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 10, 17, 25, 0, false);         // UTC: 5:25 PM Local: 3:25 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 21, 21, 4, 0, false);          // UTC: 9:04 PM Local: 7:04 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 22, 11, 0, 0, false);          // UTC: 11:00 AM Local: 9:00 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 2, 18, 47, 0, false);          // UTC: 6:47 PM Local: 4:47 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 25, 5, 10, 0, false);          // UTC: 5:10 AM Local: 3:10 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 8, 20, 4, 0, false);           // UTC: 8:04 PM Local: 6:04 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 24, 14, 26, 0, false);         // UTC: 2:26 PM Local: 12:26 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 27, 1, 0, 0, false);           // UTC: 1:00 AM Local: 11:00 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 20, 6, 24, 0, false);          // UTC: 6:24 AM Local: 4:24 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 18, 17, 51, 0, false);         // UTC: 5:51 PM Local: 3:51 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 15, 2, 18, 0, false);          // UTC: 2:18 AM Local: 12:18 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 25, 14, 57, 0, false);         // UTC: 2:57 PM Local: 12:57 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 23, 21, 49, 0, false);         // UTC: 9:49 PM Local: 7:49 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 27, 16, 18, 0, false);         // UTC: 4:18 PM Local: 2:18 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 11, 3, 28, 0, false);          // UTC: 3:28 AM Local: 1:28 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 7, 4, 39, 0, false);           // UTC: 4:39 AM Local: 2:39 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 21, 3, 47, 0, false);          // UTC: 3:47 AM Local: 1:47 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 8, 2, 11, 11, 0, false);          // UTC: 11:11 AM Local: 9:11 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 22, 6, 11, 0, false);          // UTC: 6:11 AM Local: 4:11 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 8, 9, 0, 0, false);            // UTC: 9:00 AM Local: 7:00 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 4, 1, 14, 0, false);           // UTC: 1:14 AM Local: 11:14 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 30, 13, 32, 0, false);         // UTC: 1:32 PM Local: 11:32 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 21, 19, 24, 0, false);         // UTC: 7:24 PM Local: 5:24 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 22, 8, 39, 0, false);          // UTC: 8:39 AM Local: 6:39 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 11, 20, 49, 0, false);         // UTC: 8:49 PM Local: 6:49 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 20, 17, 8, 0, false);          // UTC: 5:08 PM Local: 3:08 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 11, 1, 0, 0, false);           // UTC: 1:00 AM Local: 11:00 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 28, 2, 32, 0, false);          // UTC: 2:32 AM Local: 12:32 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 17, 16, 30, 0, false);         // UTC: 4:30 PM Local: 2:30 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 6, 4, 13, 0, false);           // UTC: 4:13 AM Local: 2:13 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 18, 11, 8, 0, false);          // UTC: 11:08 AM Local: 9:08 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 5, 9, 50, 0, false);           // UTC: 9:50 AM Local: 7:50 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 4, 5, 35, 0, false);           // UTC: 5:35 AM Local: 3:35 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 30, 9, 52, 0, false);          // UTC: 9:52 AM Local: 7:52 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 15, 6, 55, 0, false);          // UTC: 6:55 AM Local: 4:55 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 3, 3, 9, 0, false);            // UTC: 3:09 AM Local: 1:09 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 1, 19, 9, 0, false);           // UTC: 7:09 PM Local: 5:09 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 17, 11, 19, 0, false);         // UTC: 11:19 AM Local: 9:19 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 12, 23, 53, 0, false);         // UTC: 11:53 PM Local: 9:53 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 1, 8, 45, 0, false);           // UTC: 8:45 AM Local: 6:45 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 1, 14, 0, 0, false);           // UTC: 2:00 PM Local: 12:00 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 11, 9, 44, 0, false);          // UTC: 9:44 AM Local: 7:44 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 9, 16, 14, 50, 0, false);         // UTC: 2:50 PM Local: 12:50 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 10, 1, 1, 0, true);           // UTC: 1:01 AM Local: 12:01 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 2, 2, 1, 0, false);           // UTC: 2:01 AM Local: 12:01 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 17, 9, 26, 0, true);          // UTC: 9:26 AM Local: 8:26 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 9, 14, 39, 0, true);          // UTC: 2:39 PM Local: 1:39 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 30, 8, 5, 0, true);           // UTC: 8:05 AM Local: 7:05 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 27, 20, 56, 0, true);         // UTC: 8:56 PM Local: 7:56 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 14, 22, 4, 0, true);          // UTC: 10:04 PM Local: 9:04 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 1, 12, 48, 0, false);         // UTC: 12:48 PM Local: 10:48 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 1, 8, 47, 0, false);          // UTC: 8:47 AM Local: 6:47 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 1, 21, 33, 0, false);         // UTC: 9:33 PM Local: 7:33 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 19, 2, 43, 0, true);          // UTC: 2:43 AM Local: 1:43 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 31, 0, 52, 0, true);          // UTC: 12:52 AM Local: 11:52 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 11, 23, 6, 0, true);          // UTC: 11:06 PM Local: 10:06 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 16, 13, 6, 0, true);          // UTC: 1:06 PM Local: 12:06 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 11, 16, 1, 0, true);          // UTC: 4:01 PM Local: 3:01 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 24, 0, 43, 0, true);          // UTC: 12:43 AM Local: 11:43 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 4, 18, 53, 0, false);         // UTC: 6:53 PM Local: 4:53 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 22, 20, 2, 0, true);          // UTC: 8:02 PM Local: 7:02 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 29, 19, 14, 0, true);         // UTC: 7:14 PM Local: 6:14 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 15, 7, 22, 0, true);          // UTC: 7:22 AM Local: 6:22 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 12, 17, 4, 0, true);          // UTC: 5:04 PM Local: 4:04 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 23, 16, 52, 0, true);         // UTC: 4:52 PM Local: 3:52 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 4, 22, 4, 0, false);          // UTC: 10:04 PM Local: 8:04 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 8, 8, 37, 0, true);           // UTC: 8:37 AM Local: 7:37 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 10, 15, 14, 31, 0, true);         // UTC: 2:31 PM Local: 1:31 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 2, 1, 51, 0, true);           // UTC: 1:51 AM Local: 12:51 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 28, 20, 29, 0, true);         // UTC: 8:29 PM Local: 7:29 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 3, 5, 57, 0, true);           // UTC: 5:57 AM Local: 4:57 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 6, 18, 33, 0, true);          // UTC: 6:33 PM Local: 5:33 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 20, 6, 35, 0, true);          // UTC: 6:35 AM Local: 5:35 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 20, 19, 36, 0, true);         // UTC: 7:36 PM Local: 6:36 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 8, 6, 15, 0, true);           // UTC: 6:15 AM Local: 5:15 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 10, 1, 8, 0, true);           // UTC: 1:08 AM Local: 12:08 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 30, 11, 37, 0, true);         // UTC: 11:37 AM Local: 10:37 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 27, 23, 46, 0, true);         // UTC: 11:46 PM Local: 10:46 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 29, 19, 29, 0, true);         // UTC: 7:29 PM Local: 6:29 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 30, 23, 20, 0, true);         // UTC: 11:20 PM Local: 10:20 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 15, 15, 0, 0, true);          // UTC: 3:00 PM Local: 2:00 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 30, 9, 38, 0, true);          // UTC: 9:38 AM Local: 8:38 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 4, 11, 47, 0, true);          // UTC: 11:47 AM Local: 10:47 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 7, 9, 49, 0, true);           // UTC: 9:49 AM Local: 8:49 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 28, 4, 38, 0, true);          // UTC: 4:38 AM Local: 3:38 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 19, 22, 52, 0, true);         // UTC: 10:52 PM Local: 9:52 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 28, 18, 46, 0, true);         // UTC: 6:46 PM Local: 5:46 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 17, 5, 3, 0, true);           // UTC: 5:03 AM Local: 4:03 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 28, 7, 16, 0, true);          // UTC: 7:16 AM Local: 6:16 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 6, 16, 2, 0, true);           // UTC: 4:02 PM Local: 3:02 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 25, 16, 0, 0, true);          // UTC: 4:00 PM Local: 3:00 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 21, 3, 12, 0, true);          // UTC: 3:12 AM Local: 2:12 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 11, 4, 15, 29, 0, true);          // UTC: 3:29 PM Local: 2:29 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 31, 16, 17, 0, true);         // UTC: 4:17 PM Local: 3:17 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 8, 1, 27, 0, true);           // UTC: 1:27 AM Local: 12:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 31, 7, 18, 0, true);          // UTC: 7:18 AM Local: 6:18 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 26, 10, 19, 0, true);         // UTC: 10:19 AM Local: 9:19 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 8, 11, 31, 0, true);          // UTC: 11:31 AM Local: 10:31 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 14, 21, 4, 0, true);          // UTC: 9:04 PM Local: 8:04 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 30, 6, 13, 0, true);          // UTC: 6:13 AM Local: 5:13 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 29, 6, 46, 0, true);          // UTC: 6:46 AM Local: 5:46 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 16, 14, 53, 0, true);         // UTC: 2:53 PM Local: 1:53 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 21, 10, 9, 0, true);          // UTC: 10:09 AM Local: 9:09 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 15, 21, 34, 0, true);         // UTC: 9:34 PM Local: 8:34 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 31, 12, 4, 0, true);          // UTC: 12:04 PM Local: 11:04 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 1, 4, 30, 0, true);           // UTC: 4:30 AM Local: 3:30 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 7, 18, 37, 0, true);          // UTC: 6:37 PM Local: 5:37 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 24, 16, 3, 0, true);          // UTC: 4:03 PM Local: 3:03 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 16, 22, 16, 0, true);         // UTC: 10:16 PM Local: 9:16 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 1, 3, 32, 0, true);           // UTC: 3:32 AM Local: 2:32 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 15, 1, 14, 0, true);          // UTC: 1:14 AM Local: 12:14 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 4, 21, 50, 0, true);          // UTC: 9:50 PM Local: 8:50 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 1, 4, 59, 0, true);           // UTC: 4:59 AM Local: 3:59 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 29, 2, 59, 0, true);          // UTC: 2:59 AM Local: 1:59 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 8, 12, 33, 0, true);          // UTC: 12:33 PM Local: 11:33 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 1, 17, 21, 0, true);          // UTC: 5:21 PM Local: 4:21 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 7, 8, 41, 0, true);           // UTC: 8:41 AM Local: 7:41 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2018, 12, 24, 17, 17, 0, true);         // UTC: 5:17 PM Local: 4:17 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 31, 10, 13, 0, true);          // UTC: 10:13 AM Local: 9:13 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 23, 7, 56, 0, true);           // UTC: 7:56 AM Local: 6:56 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 14, 1, 16, 0, true);           // UTC: 1:16 AM Local: 12:16 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 31, 20, 34, 0, true);          // UTC: 8:34 PM Local: 7:34 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 20, 23, 0, 0, true);           // UTC: 11:00 PM Local: 10:00 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 17, 7, 44, 0, true);           // UTC: 7:44 AM Local: 6:44 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 15, 10, 26, 0, true);          // UTC: 10:26 AM Local: 9:26 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 11, 23, 23, 0, true);          // UTC: 11:23 PM Local: 10:23 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 3, 2, 39, 0, true);            // UTC: 2:39 AM Local: 1:39 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 13, 15, 11, 0, true);          // UTC: 3:11 PM Local: 2:11 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 9, 4, 4, 0, true);             // UTC: 4:04 AM Local: 3:04 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 31, 22, 9, 0, true);           // UTC: 10:09 PM Local: 9:09 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 2, 4, 47, 0, true);            // UTC: 4:47 AM Local: 3:47 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 8, 3, 37, 0, true);            // UTC: 3:37 AM Local: 2:37 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 31, 0, 13, 0, true);           // UTC: 12:13 AM Local: 11:13 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 3, 10, 15, 0, true);           // UTC: 10:15 AM Local: 9:15 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 2, 15, 14, 0, true);           // UTC: 3:14 PM Local: 2:14 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 30, 4, 45, 0, true);           // UTC: 4:45 AM Local: 3:45 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 27, 12, 6, 0, true);           // UTC: 12:06 PM Local: 11:06 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 15, 8, 51, 0, true);           // UTC: 8:51 AM Local: 7:51 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 27, 17, 13, 0, true);          // UTC: 5:13 PM Local: 4:13 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 27, 1, 20, 0, true);           // UTC: 1:20 AM Local: 12:20 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 13, 2, 27, 0, true);           // UTC: 2:27 AM Local: 1:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 15, 13, 26, 0, true);          // UTC: 1:26 PM Local: 12:26 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 1, 18, 3, 59, 0, true);           // UTC: 3:59 AM Local: 2:59 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 21, 23, 14, 0, true);          // UTC: 11:14 PM Local: 10:14 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 19, 22, 40, 0, true);          // UTC: 10:40 PM Local: 9:40 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 24, 16, 55, 0, true);          // UTC: 4:55 PM Local: 3:55 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 20, 22, 15, 0, true);          // UTC: 10:15 PM Local: 9:15 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 11, 3, 56, 0, true);           // UTC: 3:56 AM Local: 2:56 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 18, 0, 58, 0, true);           // UTC: 12:58 AM Local: 11:58 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 7, 0, 56, 0, true);            // UTC: 12:56 AM Local: 11:56 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 28, 16, 53, 0, true);          // UTC: 4:53 PM Local: 3:53 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 2, 10, 58, 0, true);           // UTC: 10:58 AM Local: 9:58 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 6, 21, 26, 0, true);           // UTC: 9:26 PM Local: 8:26 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 11, 1, 14, 0, true);           // UTC: 1:14 AM Local: 12:14 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 5, 8, 19, 0, true);            // UTC: 8:19 AM Local: 7:19 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 16, 21, 39, 0, true);          // UTC: 9:39 PM Local: 8:39 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 26, 9, 6, 0, true);            // UTC: 9:06 AM Local: 8:06 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 11, 2, 14, 0, true);           // UTC: 2:14 AM Local: 1:14 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 21, 18, 29, 0, true);          // UTC: 6:29 PM Local: 5:29 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 20, 16, 14, 0, true);          // UTC: 4:14 PM Local: 3:14 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 10, 0, 42, 0, true);           // UTC: 12:42 AM Local: 11:42 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 21, 6, 24, 0, true);           // UTC: 6:24 AM Local: 5:24 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 27, 17, 7, 0, true);           // UTC: 5:07 PM Local: 4:07 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 7, 2, 52, 0, true);            // UTC: 2:52 AM Local: 1:52 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 15, 12, 57, 0, true);          // UTC: 12:57 PM Local: 11:57 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 16, 19, 32, 0, true);          // UTC: 7:32 PM Local: 6:32 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 14, 6, 8, 0, true);            // UTC: 6:08 AM Local: 5:08 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 2, 3, 16, 8, 0, true);            // UTC: 4:08 PM Local: 3:08 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 13, 15, 43, 0, true);          // UTC: 3:43 PM Local: 2:43 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 19, 16, 32, 0, true);          // UTC: 4:32 PM Local: 3:32 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 18, 22, 34, 0, true);          // UTC: 10:34 PM Local: 9:34 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 2, 18, 29, 0, true);           // UTC: 6:29 PM Local: 5:29 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 8, 2, 24, 0, true);            // UTC: 2:24 AM Local: 1:24 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 11, 2, 56, 0, true);           // UTC: 2:56 AM Local: 1:56 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 3, 19, 50, 0, true);           // UTC: 7:50 PM Local: 6:50 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 12, 4, 13, 0, true);           // UTC: 4:13 AM Local: 3:13 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 2, 1, 15, 0, true);            // UTC: 1:15 AM Local: 12:15 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 5, 0, 6, 0, true);             // UTC: 12:06 AM Local: 11:06 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 22, 4, 16, 0, true);           // UTC: 4:16 AM Local: 3:16 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 16, 13, 35, 0, true);          // UTC: 1:35 PM Local: 12:35 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 19, 8, 10, 0, true);           // UTC: 8:10 AM Local: 7:10 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 25, 14, 49, 0, true);          // UTC: 2:49 PM Local: 1:49 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 6, 4, 57, 0, true);            // UTC: 4:57 AM Local: 3:57 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 29, 1, 12, 0, true);           // UTC: 1:12 AM Local: 12:12 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 4, 16, 22, 0, true);           // UTC: 4:22 PM Local: 3:22 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 15, 15, 20, 0, true);          // UTC: 3:20 PM Local: 2:20 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 27, 23, 54, 0, true);          // UTC: 11:54 PM Local: 10:54 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 2, 10, 21, 0, true);           // UTC: 10:21 AM Local: 9:21 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 27, 12, 57, 0, true);          // UTC: 12:57 PM Local: 11:57 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 4, 0, 57, 0, true);            // UTC: 12:57 AM Local: 11:57 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 23, 14, 11, 0, true);          // UTC: 2:11 PM Local: 1:11 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 3, 20, 33, 0, true);           // UTC: 8:33 PM Local: 7:33 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 3, 25, 14, 35, 0, true);          // UTC: 2:35 PM Local: 1:35 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 5, 6, 20, 0, true);            // UTC: 6:20 AM Local: 5:20 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 20, 23, 40, 0, false);         // UTC: 11:40 PM Local: 9:40 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 22, 13, 39, 0, false);         // UTC: 1:39 PM Local: 11:39 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 7, 23, 47, 0, false);          // UTC: 11:47 PM Local: 9:47 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 22, 5, 22, 0, false);          // UTC: 5:22 AM Local: 3:22 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 2, 21, 35, 0, true);           // UTC: 9:35 PM Local: 8:35 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 19, 4, 41, 0, false);          // UTC: 4:41 AM Local: 2:41 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 10, 22, 22, 0, false);         // UTC: 10:22 PM Local: 8:22 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 28, 22, 38, 0, false);         // UTC: 10:38 PM Local: 8:38 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 9, 2, 52, 0, false);           // UTC: 2:52 AM Local: 12:52 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 21, 17, 15, 0, false);         // UTC: 5:15 PM Local: 3:15 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 13, 15, 3, 0, false);          // UTC: 3:03 PM Local: 1:03 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 20, 0, 1, 0, false);           // UTC: 12:01 AM Local: 10:01 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 22, 22, 44, 0, false);         // UTC: 10:44 PM Local: 8:44 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 16, 19, 40, 0, false);         // UTC: 7:40 PM Local: 5:40 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 26, 16, 34, 0, false);         // UTC: 4:34 PM Local: 2:34 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 12, 17, 58, 0, false);         // UTC: 5:58 PM Local: 3:58 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 22, 7, 25, 0, false);          // UTC: 7:25 AM Local: 5:25 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 3, 22, 50, 0, true);           // UTC: 10:50 PM Local: 9:50 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 17, 15, 20, 0, false);         // UTC: 3:20 PM Local: 1:20 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 19, 6, 43, 0, false);          // UTC: 6:43 AM Local: 4:43 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 17, 14, 42, 0, false);         // UTC: 2:42 PM Local: 12:42 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 4, 12, 5, 0, true);            // UTC: 12:05 PM Local: 11:05 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 29, 19, 44, 0, false);         // UTC: 7:44 PM Local: 5:44 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 4, 4, 18, 35, 0, true);           // UTC: 6:35 PM Local: 5:35 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 28, 5, 27, 0, false);          // UTC: 5:27 AM Local: 3:27 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 13, 4, 47, 0, false);          // UTC: 4:47 AM Local: 2:47 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 10, 4, 36, 0, false);          // UTC: 4:36 AM Local: 2:36 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 19, 22, 46, 0, false);         // UTC: 10:46 PM Local: 8:46 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 30, 9, 51, 0, false);          // UTC: 9:51 AM Local: 7:51 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 22, 9, 54, 0, false);          // UTC: 9:54 AM Local: 7:54 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 28, 11, 36, 0, false);         // UTC: 11:36 AM Local: 9:36 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 21, 5, 27, 0, false);          // UTC: 5:27 AM Local: 3:27 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 12, 10, 52, 0, false);         // UTC: 10:52 AM Local: 8:52 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 22, 8, 54, 0, false);          // UTC: 8:54 AM Local: 6:54 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 7, 7, 21, 0, false);           // UTC: 7:21 AM Local: 5:21 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 4, 0, 54, 0, false);           // UTC: 12:54 AM Local: 10:54 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 10, 15, 8, 0, false);          // UTC: 3:08 PM Local: 1:08 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 11, 15, 58, 0, false);         // UTC: 3:58 PM Local: 1:58 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 7, 18, 53, 0, false);          // UTC: 6:53 PM Local: 4:53 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 24, 17, 23, 0, false);         // UTC: 5:23 PM Local: 3:23 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 24, 18, 19, 0, false);         // UTC: 6:19 PM Local: 4:19 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 8, 18, 21, 0, false);          // UTC: 6:21 PM Local: 4:21 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 10, 14, 41, 0, false);         // UTC: 2:41 PM Local: 12:41 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 19, 20, 5, 0, false);          // UTC: 8:05 PM Local: 6:05 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 5, 8, 55, 0, false);           // UTC: 8:55 AM Local: 6:55 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 4, 9, 13, 0, false);           // UTC: 9:13 AM Local: 7:13 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 16, 2, 44, 0, false);          // UTC: 2:44 AM Local: 12:44 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 24, 21, 17, 0, false);         // UTC: 9:17 PM Local: 7:17 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 5, 16, 4, 24, 0, false);          // UTC: 4:24 AM Local: 2:24 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 3, 1, 2, 0, false);            // UTC: 1:02 AM Local: 11:02 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 26, 19, 19, 0, false);         // UTC: 7:19 PM Local: 5:19 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 9, 4, 2, 0, false);            // UTC: 4:02 AM Local: 2:02 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 17, 5, 21, 0, false);          // UTC: 5:21 AM Local: 3:21 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 21, 21, 2, 0, false);          // UTC: 9:02 PM Local: 7:02 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 21, 8, 43, 0, false);          // UTC: 8:43 AM Local: 6:43 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 30, 0, 16, 0, false);          // UTC: 12:16 AM Local: 10:16 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 14, 21, 31, 0, false);         // UTC: 9:31 PM Local: 7:31 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 2, 20, 46, 0, false);          // UTC: 8:46 PM Local: 6:46 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 2, 4, 41, 0, false);           // UTC: 4:41 AM Local: 2:41 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 2, 17, 57, 0, false);          // UTC: 5:57 PM Local: 3:57 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 5, 23, 43, 0, false);          // UTC: 11:43 PM Local: 9:43 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 26, 5, 45, 0, false);          // UTC: 5:45 AM Local: 3:45 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 30, 21, 57, 0, false);         // UTC: 9:57 PM Local: 7:57 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 27, 0, 24, 0, false);          // UTC: 12:24 AM Local: 10:24 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 9, 20, 7, 0, false);           // UTC: 8:07 PM Local: 6:07 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 8, 1, 58, 0, false);           // UTC: 1:58 AM Local: 11:58 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 6, 1, 6, 0, false);            // UTC: 1:06 AM Local: 11:06 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 9, 9, 9, 0, false);            // UTC: 9:09 AM Local: 7:09 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 17, 3, 19, 0, false);          // UTC: 3:19 AM Local: 1:19 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 20, 19, 34, 0, false);         // UTC: 7:34 PM Local: 5:34 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 14, 3, 14, 0, false);          // UTC: 3:14 AM Local: 1:14 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 4, 2, 10, 0, false);           // UTC: 2:10 AM Local: 12:10 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 28, 23, 2, 0, false);          // UTC: 11:02 PM Local: 9:02 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 6, 14, 22, 44, 0, false);         // UTC: 10:44 PM Local: 8:44 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 27, 12, 1, 0, false);          // UTC: 12:01 PM Local: 10:01 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 23, 1, 25, 0, false);          // UTC: 1:25 AM Local: 11:25 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 12, 12, 47, 0, false);         // UTC: 12:47 PM Local: 10:47 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 31, 5, 37, 0, false);          // UTC: 5:37 AM Local: 3:37 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 5, 21, 1, 0, false);           // UTC: 9:01 PM Local: 7:01 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 28, 8, 20, 0, false);          // UTC: 8:20 AM Local: 6:20 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 1, 9, 31, 0, false);           // UTC: 9:31 AM Local: 7:31 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 22, 14, 49, 0, false);         // UTC: 2:49 PM Local: 12:49 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 27, 8, 35, 0, false);          // UTC: 8:35 AM Local: 6:35 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 20, 9, 39, 0, false);          // UTC: 9:39 AM Local: 7:39 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 8, 3, 46, 0, false);           // UTC: 3:46 AM Local: 1:46 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 27, 3, 10, 0, false);          // UTC: 3:10 AM Local: 1:10 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 9, 2, 59, 0, false);           // UTC: 2:59 AM Local: 12:59 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 8, 8, 45, 0, false);           // UTC: 8:45 AM Local: 6:45 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 30, 14, 41, 0, false);         // UTC: 2:41 PM Local: 12:41 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 10, 21, 19, 0, false);         // UTC: 9:19 PM Local: 7:19 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 8, 2, 17, 0, false);           // UTC: 2:17 AM Local: 12:17 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 2, 9, 5, 0, false);            // UTC: 9:05 AM Local: 7:05 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 10, 18, 10, 0, false);         // UTC: 6:10 PM Local: 4:10 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 19, 14, 59, 0, false);         // UTC: 2:59 PM Local: 12:59 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 9, 13, 4, 0, false);           // UTC: 1:04 PM Local: 11:04 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 3, 21, 23, 0, false);          // UTC: 9:23 PM Local: 7:23 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 26, 15, 14, 0, false);         // UTC: 3:14 PM Local: 1:14 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 3, 4, 30, 0, false);           // UTC: 4:30 AM Local: 2:30 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 7, 22, 9, 22, 0, false);          // UTC: 9:22 AM Local: 7:22 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 24, 23, 4, 0, false);          // UTC: 11:04 PM Local: 9:04 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 23, 8, 25, 0, false);          // UTC: 8:25 AM Local: 6:25 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 30, 6, 28, 0, false);          // UTC: 6:28 AM Local: 4:28 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 14, 22, 47, 0, false);         // UTC: 10:47 PM Local: 8:47 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 25, 10, 42, 0, false);         // UTC: 10:42 AM Local: 8:42 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 10, 12, 0, 0, false);          // UTC: 12:00 PM Local: 10:00 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 12, 18, 30, 0, false);         // UTC: 6:30 PM Local: 4:30 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 6, 23, 23, 0, false);          // UTC: 11:23 PM Local: 9:23 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 17, 0, 29, 0, false);          // UTC: 12:29 AM Local: 10:29 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 15, 17, 30, 0, false);         // UTC: 5:30 PM Local: 3:30 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 20, 18, 28, 0, false);         // UTC: 6:28 PM Local: 4:28 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 15, 15, 20, 0, false);         // UTC: 3:20 PM Local: 1:20 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 26, 11, 47, 0, false);         // UTC: 11:47 AM Local: 9:47 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 26, 9, 36, 0, false);          // UTC: 9:36 AM Local: 7:36 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 2, 3, 51, 0, false);           // UTC: 3:51 AM Local: 1:51 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 21, 18, 21, 0, false);         // UTC: 6:21 PM Local: 4:21 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 1, 2, 30, 0, false);           // UTC: 2:30 AM Local: 12:30 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 17, 20, 44, 0, false);         // UTC: 8:44 PM Local: 6:44 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 12, 4, 34, 0, false);          // UTC: 4:34 AM Local: 2:34 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 15, 5, 9, 0, false);           // UTC: 5:09 AM Local: 3:09 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 27, 4, 37, 0, false);          // UTC: 4:37 AM Local: 2:37 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 4, 0, 31, 0, false);           // UTC: 12:31 AM Local: 10:31 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 21, 8, 18, 0, false);          // UTC: 8:18 AM Local: 6:18 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 9, 20, 18, 0, false);          // UTC: 8:18 PM Local: 6:18 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 8, 5, 4, 13, 0, false);           // UTC: 4:13 AM Local: 2:13 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 20, 15, 40, 0, false);         // UTC: 3:40 PM Local: 1:40 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 22, 10, 57, 0, false);         // UTC: 10:57 AM Local: 8:57 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 22, 20, 35, 0, false);         // UTC: 8:35 PM Local: 6:35 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 6, 19, 5, 0, false);           // UTC: 7:05 PM Local: 5:05 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 27, 15, 27, 0, false);         // UTC: 3:27 PM Local: 1:27 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 14, 21, 51, 0, false);         // UTC: 9:51 PM Local: 7:51 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 26, 7, 27, 0, false);          // UTC: 7:27 AM Local: 5:27 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 1, 17, 45, 0, false);          // UTC: 5:45 PM Local: 3:45 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 2, 8, 54, 0, false);           // UTC: 8:54 AM Local: 6:54 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 13, 18, 46, 0, false);         // UTC: 6:46 PM Local: 4:46 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 22, 17, 22, 0, false);         // UTC: 5:22 PM Local: 3:22 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 2, 2, 28, 0, false);           // UTC: 2:28 AM Local: 12:28 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 6, 3, 28, 0, false);           // UTC: 3:28 AM Local: 1:28 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 9, 9, 20, 0, false);           // UTC: 9:20 AM Local: 7:20 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 7, 20, 50, 0, false);          // UTC: 8:50 PM Local: 6:50 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 25, 1, 38, 0, false);          // UTC: 1:38 AM Local: 11:38 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 29, 18, 44, 0, false);         // UTC: 6:44 PM Local: 4:44 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 1, 6, 54, 0, false);           // UTC: 6:54 AM Local: 4:54 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 27, 23, 21, 0, false);         // UTC: 11:21 PM Local: 9:21 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 3, 1, 31, 0, false);           // UTC: 1:31 AM Local: 11:31 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 11, 4, 54, 0, false);          // UTC: 4:54 AM Local: 2:54 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 1, 17, 15, 0, false);          // UTC: 5:15 PM Local: 3:15 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 21, 14, 54, 0, false);         // UTC: 2:54 PM Local: 12:54 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 16, 13, 1, 0, false);          // UTC: 1:01 PM Local: 11:01 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 9, 3, 9, 29, 0, false);           // UTC: 9:29 AM Local: 7:29 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 13, 16, 5, 0, true);          // UTC: 4:05 PM Local: 3:05 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 24, 16, 19, 0, true);         // UTC: 4:19 PM Local: 3:19 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 7, 22, 21, 0, true);          // UTC: 10:21 PM Local: 9:21 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 8, 14, 6, 0, true);           // UTC: 2:06 PM Local: 1:06 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 10, 21, 44, 0, true);         // UTC: 9:44 PM Local: 8:44 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 12, 9, 24, 0, true);          // UTC: 9:24 AM Local: 8:24 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 9, 13, 34, 0, true);          // UTC: 1:34 PM Local: 12:34 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 15, 17, 51, 0, true);         // UTC: 5:51 PM Local: 4:51 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 12, 1, 56, 0, true);          // UTC: 1:56 AM Local: 12:56 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 29, 10, 4, 0, true);          // UTC: 10:04 AM Local: 9:04 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 3, 15, 25, 0, false);         // UTC: 3:25 PM Local: 1:25 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 20, 19, 20, 0, true);         // UTC: 7:20 PM Local: 6:20 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 6, 20, 32, 0, true);          // UTC: 8:32 PM Local: 7:32 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 25, 11, 27, 0, true);         // UTC: 11:27 AM Local: 10:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 10, 8, 27, 0, true);          // UTC: 8:27 AM Local: 7:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 22, 14, 48, 0, true);         // UTC: 2:48 PM Local: 1:48 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 13, 19, 12, 0, true);         // UTC: 7:12 PM Local: 6:12 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 28, 1, 58, 0, true);          // UTC: 1:58 AM Local: 12:58 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 2, 13, 50, 0, false);         // UTC: 1:50 PM Local: 11:50 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 2, 18, 17, 0, false);         // UTC: 6:17 PM Local: 4:17 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 17, 1, 37, 0, true);          // UTC: 1:37 AM Local: 12:37 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 25, 16, 51, 0, true);         // UTC: 4:51 PM Local: 3:51 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 28, 5, 55, 0, true);          // UTC: 5:55 AM Local: 4:55 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 24, 3, 32, 0, true);          // UTC: 3:32 AM Local: 2:32 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 10, 27, 7, 9, 0, true);           // UTC: 7:09 AM Local: 6:09 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 1, 14, 7, 0, true);           // UTC: 2:07 PM Local: 1:07 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 1, 4, 22, 0, true);           // UTC: 4:22 AM Local: 3:22 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 27, 16, 10, 0, true);         // UTC: 4:10 PM Local: 3:10 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 19, 6, 3, 0, true);           // UTC: 6:03 AM Local: 5:03 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 27, 16, 16, 0, true);         // UTC: 4:16 PM Local: 3:16 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 30, 14, 16, 0, true);         // UTC: 2:16 PM Local: 1:16 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 22, 0, 25, 0, true);          // UTC: 12:25 AM Local: 11:25 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 4, 14, 32, 0, true);          // UTC: 2:32 PM Local: 1:32 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 5, 13, 55, 0, true);          // UTC: 1:55 PM Local: 12:55 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 12, 16, 55, 0, true);         // UTC: 4:55 PM Local: 3:55 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 6, 3, 49, 0, true);           // UTC: 3:49 AM Local: 2:49 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 12, 11, 33, 0, true);         // UTC: 11:33 AM Local: 10:33 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 23, 9, 48, 0, true);          // UTC: 9:48 AM Local: 8:48 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 12, 14, 36, 0, true);         // UTC: 2:36 PM Local: 1:36 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 10, 15, 53, 0, true);         // UTC: 3:53 PM Local: 2:53 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 23, 7, 27, 0, true);          // UTC: 7:27 AM Local: 6:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 16, 13, 18, 0, true);         // UTC: 1:18 PM Local: 12:18 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 3, 2, 1, 0, true);            // UTC: 2:01 AM Local: 1:01 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 6, 17, 5, 0, true);           // UTC: 5:05 PM Local: 4:05 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 12, 13, 52, 0, true);         // UTC: 1:52 PM Local: 12:52 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 21, 20, 57, 0, true);         // UTC: 8:57 PM Local: 7:57 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 20, 20, 23, 0, true);         // UTC: 8:23 PM Local: 7:23 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 2, 3, 13, 0, true);           // UTC: 3:13 AM Local: 2:13 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 30, 20, 50, 0, true);         // UTC: 8:50 PM Local: 7:50 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 11, 13, 5, 27, 0, true);          // UTC: 5:27 AM Local: 4:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 21, 3, 16, 0, true);          // UTC: 3:16 AM Local: 2:16 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 25, 4, 16, 0, true);          // UTC: 4:16 AM Local: 3:16 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 12, 3, 43, 0, true);          // UTC: 3:43 AM Local: 2:43 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 8, 21, 19, 0, true);          // UTC: 9:19 PM Local: 8:19 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 22, 19, 54, 0, true);         // UTC: 7:54 PM Local: 6:54 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 26, 6, 35, 0, true);          // UTC: 6:35 AM Local: 5:35 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 21, 22, 13, 0, true);         // UTC: 10:13 PM Local: 9:13 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 17, 12, 40, 0, true);         // UTC: 12:40 PM Local: 11:40 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 16, 22, 39, 0, true);         // UTC: 10:39 PM Local: 9:39 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 17, 15, 53, 0, true);         // UTC: 3:53 PM Local: 2:53 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 14, 13, 3, 0, true);          // UTC: 1:03 PM Local: 12:03 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 6, 14, 7, 0, true);           // UTC: 2:07 PM Local: 1:07 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 2, 6, 15, 0, true);           // UTC: 6:15 AM Local: 5:15 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 7, 22, 37, 0, true);          // UTC: 10:37 PM Local: 9:37 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 13, 20, 40, 0, true);         // UTC: 8:40 PM Local: 7:40 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 8, 22, 10, 0, true);          // UTC: 10:10 PM Local: 9:10 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 19, 21, 46, 0, true);         // UTC: 9:46 PM Local: 8:46 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 21, 16, 10, 0, true);         // UTC: 4:10 PM Local: 3:10 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 8, 12, 54, 0, true);          // UTC: 12:54 PM Local: 11:54 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 26, 2, 36, 0, true);          // UTC: 2:36 AM Local: 1:36 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 21, 6, 18, 0, true);          // UTC: 6:18 AM Local: 5:18 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 1, 21, 57, 0, true);          // UTC: 9:57 PM Local: 8:57 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 8, 3, 19, 0, true);           // UTC: 3:19 AM Local: 2:19 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 21, 15, 9, 0, true);          // UTC: 3:09 PM Local: 2:09 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2019, 12, 11, 23, 11, 0, true);         // UTC: 11:11 PM Local: 10:11 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 27, 13, 8, 0, true);           // UTC: 1:08 PM Local: 12:08 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 2, 18, 47, 0, true);           // UTC: 6:47 PM Local: 5:47 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 1, 10, 51, 0, true);           // UTC: 10:51 AM Local: 9:51 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 23, 23, 47, 0, true);          // UTC: 11:47 PM Local: 10:47 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 20, 20, 31, 0, true);          // UTC: 8:31 PM Local: 7:31 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 12, 5, 31, 0, true);           // UTC: 5:31 AM Local: 4:31 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 22, 2, 27, 0, true);           // UTC: 2:27 AM Local: 1:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 23, 21, 23, 0, true);          // UTC: 9:23 PM Local: 8:23 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 1, 3, 49, 0, true);            // UTC: 3:49 AM Local: 2:49 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 27, 21, 46, 0, true);          // UTC: 9:46 PM Local: 8:46 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 19, 2, 16, 0, true);           // UTC: 2:16 AM Local: 1:16 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 17, 19, 35, 0, true);          // UTC: 7:35 PM Local: 6:35 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 4, 9, 58, 0, true);            // UTC: 9:58 AM Local: 8:58 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 7, 6, 18, 0, true);            // UTC: 6:18 AM Local: 5:18 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 2, 0, 14, 0, true);            // UTC: 12:14 AM Local: 11:14 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 6, 7, 46, 0, true);            // UTC: 7:46 AM Local: 6:46 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 18, 9, 47, 0, true);           // UTC: 9:47 AM Local: 8:47 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 28, 13, 52, 0, true);          // UTC: 1:52 PM Local: 12:52 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 8, 16, 27, 0, true);           // UTC: 4:27 PM Local: 3:27 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 11, 13, 57, 0, true);          // UTC: 1:57 PM Local: 12:57 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 5, 5, 19, 0, true);            // UTC: 5:19 AM Local: 4:19 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 4, 21, 51, 0, true);           // UTC: 9:51 PM Local: 8:51 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 3, 17, 38, 0, true);           // UTC: 5:38 PM Local: 4:38 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 25, 23, 22, 0, true);          // UTC: 11:22 PM Local: 10:22 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 1, 2, 2, 55, 0, true);            // UTC: 2:55 AM Local: 1:55 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 23, 3, 24, 0, true);           // UTC: 3:24 AM Local: 2:24 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 13, 9, 4, 0, true);            // UTC: 9:04 AM Local: 8:04 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 1, 16, 34, 0, true);           // UTC: 4:34 PM Local: 3:34 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 16, 19, 16, 0, true);          // UTC: 7:16 PM Local: 6:16 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 13, 16, 9, 0, true);           // UTC: 4:09 PM Local: 3:09 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 6, 20, 10, 0, true);           // UTC: 8:10 PM Local: 7:10 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 5, 22, 59, 0, true);           // UTC: 10:59 PM Local: 9:59 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 24, 7, 52, 0, true);           // UTC: 7:52 AM Local: 6:52 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 15, 14, 43, 0, true);          // UTC: 2:43 PM Local: 1:43 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 21, 9, 47, 0, true);           // UTC: 9:47 AM Local: 8:47 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 23, 12, 55, 0, true);          // UTC: 12:55 PM Local: 11:55 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 24, 12, 2, 0, true);           // UTC: 12:02 PM Local: 11:02 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 16, 3, 41, 0, true);           // UTC: 3:41 AM Local: 2:41 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 23, 22, 25, 0, true);          // UTC: 10:25 PM Local: 9:25 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 3, 3, 35, 0, true);            // UTC: 3:35 AM Local: 2:35 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 17, 22, 45, 0, true);          // UTC: 10:45 PM Local: 9:45 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 2, 22, 14, 0, true);           // UTC: 10:14 PM Local: 9:14 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 27, 7, 58, 0, true);           // UTC: 7:58 AM Local: 6:58 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 8, 12, 20, 0, true);           // UTC: 12:20 PM Local: 11:20 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 2, 12, 0, 0, true);            // UTC: 12:00 PM Local: 11:00 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 8, 19, 30, 0, true);           // UTC: 7:30 PM Local: 6:30 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 11, 6, 56, 0, true);           // UTC: 6:56 AM Local: 5:56 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 29, 9, 45, 0, true);           // UTC: 9:45 AM Local: 8:45 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 1, 11, 15, 0, true);           // UTC: 11:15 AM Local: 10:15 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 2, 6, 9, 14, 0, true);            // UTC: 9:14 AM Local: 8:14 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 22, 1, 28, 0, true);           // UTC: 1:28 AM Local: 12:28 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 12, 22, 31, 0, true);          // UTC: 10:31 PM Local: 9:31 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 27, 13, 33, 0, true);          // UTC: 1:33 PM Local: 12:33 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 28, 11, 12, 0, true);          // UTC: 11:12 AM Local: 10:12 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 29, 18, 25, 0, true);          // UTC: 6:25 PM Local: 5:25 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 9, 20, 38, 0, true);           // UTC: 8:38 PM Local: 7:38 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 13, 11, 6, 0, true);           // UTC: 11:06 AM Local: 10:06 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 26, 9, 59, 0, true);           // UTC: 9:59 AM Local: 8:59 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 27, 23, 32, 0, true);          // UTC: 11:32 PM Local: 10:32 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 6, 22, 17, 0, true);           // UTC: 10:17 PM Local: 9:17 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 6, 13, 9, 0, true);            // UTC: 1:09 PM Local: 12:09 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 3, 17, 36, 0, true);           // UTC: 5:36 PM Local: 4:36 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 20, 19, 43, 0, true);          // UTC: 7:43 PM Local: 6:43 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 19, 7, 44, 0, true);           // UTC: 7:44 AM Local: 6:44 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 30, 4, 35, 0, true);           // UTC: 4:35 AM Local: 3:35 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 9, 11, 40, 0, true);           // UTC: 11:40 AM Local: 10:40 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 28, 20, 23, 0, true);          // UTC: 8:23 PM Local: 7:23 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 12, 0, 38, 0, true);           // UTC: 12:38 AM Local: 11:38 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 19, 22, 10, 0, true);          // UTC: 10:10 PM Local: 9:10 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 23, 12, 28, 0, true);          // UTC: 12:28 PM Local: 11:28 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 24, 4, 5, 0, true);            // UTC: 4:05 AM Local: 3:05 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 19, 4, 41, 0, true);           // UTC: 4:41 AM Local: 3:41 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 31, 9, 27, 0, true);           // UTC: 9:27 AM Local: 8:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 25, 23, 35, 0, true);          // UTC: 11:35 PM Local: 10:35 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 3, 13, 10, 36, 0, true);          // UTC: 10:36 AM Local: 9:36 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 17, 10, 43, 0, false);         // UTC: 10:43 AM Local: 8:43 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 4, 19, 3, 0, false);           // UTC: 7:03 PM Local: 5:03 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 6, 11, 58, 0, false);          // UTC: 11:58 AM Local: 9:58 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 12, 19, 58, 0, false);         // UTC: 7:58 PM Local: 5:58 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 23, 10, 14, 0, false);         // UTC: 10:14 AM Local: 8:14 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 7, 20, 59, 0, false);          // UTC: 8:59 PM Local: 6:59 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 14, 20, 48, 0, false);         // UTC: 8:48 PM Local: 6:48 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 7, 19, 35, 0, false);          // UTC: 7:35 PM Local: 5:35 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 7, 9, 1, 0, false);            // UTC: 9:01 AM Local: 7:01 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 17, 7, 52, 0, false);          // UTC: 7:52 AM Local: 5:52 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 13, 3, 5, 0, false);           // UTC: 3:05 AM Local: 1:05 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 2, 12, 24, 0, true);           // UTC: 12:24 PM Local: 11:24 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 22, 8, 35, 0, false);          // UTC: 8:35 AM Local: 6:35 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 5, 9, 27, 0, false);           // UTC: 9:27 AM Local: 7:27 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 27, 3, 28, 0, false);          // UTC: 3:28 AM Local: 1:28 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 28, 23, 45, 0, false);         // UTC: 11:45 PM Local: 9:45 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 6, 12, 31, 0, false);          // UTC: 12:31 PM Local: 10:31 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 25, 14, 14, 0, false);         // UTC: 2:14 PM Local: 12:14 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 9, 23, 7, 0, false);           // UTC: 11:07 PM Local: 9:07 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 9, 22, 56, 0, false);          // UTC: 10:56 PM Local: 8:56 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 21, 5, 17, 0, false);          // UTC: 5:17 AM Local: 3:17 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 29, 14, 0, 0, false);          // UTC: 2:00 PM Local: 12:00 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 28, 17, 50, 0, false);         // UTC: 5:50 PM Local: 3:50 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 28, 17, 12, 0, false);         // UTC: 5:12 PM Local: 3:12 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 4, 27, 9, 48, 0, false);          // UTC: 9:48 AM Local: 7:48 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 5, 3, 2, 0, false);            // UTC: 3:02 AM Local: 1:02 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 5, 23, 0, 0, false);           // UTC: 11:00 PM Local: 9:00 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 12, 9, 1, 0, false);           // UTC: 9:01 AM Local: 7:01 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 20, 15, 50, 0, false);         // UTC: 3:50 PM Local: 1:50 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 7, 8, 42, 0, false);           // UTC: 8:42 AM Local: 6:42 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 6, 21, 30, 0, false);          // UTC: 9:30 PM Local: 7:30 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 30, 14, 11, 0, false);         // UTC: 2:11 PM Local: 12:11 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 12, 0, 14, 0, false);          // UTC: 12:14 AM Local: 10:14 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 1, 16, 38, 0, false);          // UTC: 4:38 PM Local: 2:38 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 24, 0, 16, 0, false);          // UTC: 12:16 AM Local: 10:16 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 2, 7, 1, 0, false);            // UTC: 7:01 AM Local: 5:01 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 9, 1, 19, 0, false);           // UTC: 1:19 AM Local: 11:19 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 4, 4, 5, 0, false);            // UTC: 4:05 AM Local: 2:05 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 25, 18, 9, 0, false);          // UTC: 6:09 PM Local: 4:09 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 16, 16, 14, 0, false);         // UTC: 4:14 PM Local: 2:14 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 18, 13, 30, 0, false);         // UTC: 1:30 PM Local: 11:30 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 28, 3, 30, 0, false);          // UTC: 3:30 AM Local: 1:30 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 18, 20, 4, 0, false);          // UTC: 8:04 PM Local: 6:04 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 19, 1, 14, 0, false);          // UTC: 1:14 AM Local: 11:14 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 7, 6, 55, 0, false);           // UTC: 6:55 AM Local: 4:55 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 23, 6, 56, 0, false);          // UTC: 6:56 AM Local: 4:56 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 31, 1, 38, 0, false);          // UTC: 1:38 AM Local: 11:38 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 18, 12, 6, 0, false);          // UTC: 12:06 PM Local: 10:06 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 16, 8, 35, 0, false);          // UTC: 8:35 AM Local: 6:35 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 5, 7, 12, 30, 0, false);          // UTC: 12:30 PM Local: 10:30 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 14, 3, 22, 0, false);          // UTC: 3:22 AM Local: 1:22 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 13, 5, 40, 0, false);          // UTC: 5:40 AM Local: 3:40 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 24, 21, 0, 0, false);          // UTC: 9:00 PM Local: 7:00 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 17, 21, 49, 0, false);         // UTC: 9:49 PM Local: 7:49 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 30, 19, 26, 0, false);         // UTC: 7:26 PM Local: 5:26 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 28, 10, 22, 0, false);         // UTC: 10:22 AM Local: 8:22 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 30, 21, 53, 0, false);         // UTC: 9:53 PM Local: 7:53 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 9, 19, 15, 0, false);          // UTC: 7:15 PM Local: 5:15 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 13, 10, 26, 0, false);         // UTC: 10:26 AM Local: 8:26 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 8, 22, 44, 0, false);          // UTC: 10:44 PM Local: 8:44 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 2, 23, 42, 0, false);          // UTC: 11:42 PM Local: 9:42 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 20, 17, 22, 0, false);         // UTC: 5:22 PM Local: 3:22 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 6, 1, 20, 0, false);           // UTC: 1:20 AM Local: 11:20 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 4, 16, 46, 0, false);          // UTC: 4:46 PM Local: 2:46 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 26, 19, 1, 0, false);          // UTC: 7:01 PM Local: 5:01 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 28, 10, 37, 0, false);         // UTC: 10:37 AM Local: 8:37 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 27, 3, 38, 0, false);          // UTC: 3:38 AM Local: 1:38 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 15, 0, 57, 0, false);          // UTC: 12:57 AM Local: 10:57 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 26, 23, 20, 0, false);         // UTC: 11:20 PM Local: 9:20 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 30, 15, 55, 0, false);         // UTC: 3:55 PM Local: 1:55 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 9, 14, 23, 0, false);          // UTC: 2:23 PM Local: 12:23 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 19, 17, 45, 0, false);         // UTC: 5:45 PM Local: 3:45 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 27, 10, 27, 0, false);         // UTC: 10:27 AM Local: 8:27 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 10, 16, 17, 0, false);         // UTC: 4:17 PM Local: 2:17 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 6, 27, 14, 38, 0, false);         // UTC: 2:38 PM Local: 12:38 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 7, 19, 56, 0, false);          // UTC: 7:56 PM Local: 5:56 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 24, 9, 7, 0, false);           // UTC: 9:07 AM Local: 7:07 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 4, 23, 11, 0, false);          // UTC: 11:11 PM Local: 9:11 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 22, 15, 28, 0, false);         // UTC: 3:28 PM Local: 1:28 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 17, 14, 16, 0, false);         // UTC: 2:16 PM Local: 12:16 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 5, 19, 1, 0, false);           // UTC: 7:01 PM Local: 5:01 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 17, 10, 41, 0, false);         // UTC: 10:41 AM Local: 8:41 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 1, 20, 49, 0, false);          // UTC: 8:49 PM Local: 6:49 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 4, 2, 39, 0, false);           // UTC: 2:39 AM Local: 12:39 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 10, 11, 26, 0, false);         // UTC: 11:26 AM Local: 9:26 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 11, 9, 50, 0, false);          // UTC: 9:50 AM Local: 7:50 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 7, 3, 50, 0, false);           // UTC: 3:50 AM Local: 1:50 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 16, 18, 9, 0, false);          // UTC: 6:09 PM Local: 4:09 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 8, 20, 11, 0, false);          // UTC: 8:11 PM Local: 6:11 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 26, 23, 45, 0, false);         // UTC: 11:45 PM Local: 9:45 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 14, 14, 26, 0, false);         // UTC: 2:26 PM Local: 12:26 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 31, 9, 4, 0, false);           // UTC: 9:04 AM Local: 7:04 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 31, 9, 41, 0, false);          // UTC: 9:41 AM Local: 7:41 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 7, 22, 52, 0, false);          // UTC: 10:52 PM Local: 8:52 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 19, 0, 14, 0, false);          // UTC: 12:14 AM Local: 10:14 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 26, 5, 48, 0, false);          // UTC: 5:48 AM Local: 3:48 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 28, 5, 31, 0, false);          // UTC: 5:31 AM Local: 3:31 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 3, 16, 19, 0, false);          // UTC: 4:19 PM Local: 2:19 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 16, 2, 5, 0, false);           // UTC: 2:05 AM Local: 12:05 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 7, 11, 0, 51, 0, false);          // UTC: 12:51 AM Local: 10:51 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 20, 2, 9, 0, false);           // UTC: 2:09 AM Local: 12:09 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 5, 19, 13, 0, false);          // UTC: 7:13 PM Local: 5:13 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 19, 14, 45, 0, false);         // UTC: 2:45 PM Local: 12:45 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 13, 15, 15, 0, false);         // UTC: 3:15 PM Local: 1:15 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 16, 15, 28, 0, false);         // UTC: 3:28 PM Local: 1:28 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 22, 5, 55, 0, false);          // UTC: 5:55 AM Local: 3:55 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 4, 21, 53, 0, false);          // UTC: 9:53 PM Local: 7:53 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 24, 0, 29, 0, false);          // UTC: 12:29 AM Local: 10:29 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 26, 13, 33, 0, false);         // UTC: 1:33 PM Local: 11:33 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 22, 7, 29, 0, false);          // UTC: 7:29 AM Local: 5:29 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 17, 15, 31, 0, false);         // UTC: 3:31 PM Local: 1:31 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 4, 20, 54, 0, false);          // UTC: 8:54 PM Local: 6:54 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 18, 5, 55, 0, false);          // UTC: 5:55 AM Local: 3:55 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 25, 4, 9, 0, false);           // UTC: 4:09 AM Local: 2:09 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 16, 6, 45, 0, false);          // UTC: 6:45 AM Local: 4:45 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 20, 14, 47, 0, false);         // UTC: 2:47 PM Local: 12:47 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 2, 8, 31, 0, false);           // UTC: 8:31 AM Local: 6:31 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 8, 7, 42, 0, false);           // UTC: 7:42 AM Local: 5:42 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 4, 11, 43, 0, false);          // UTC: 11:43 AM Local: 9:43 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 4, 18, 37, 0, false);          // UTC: 6:37 PM Local: 4:37 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 16, 10, 6, 0, false);          // UTC: 10:06 AM Local: 8:06 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 31, 0, 41, 0, false);          // UTC: 12:41 AM Local: 10:41 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 6, 4, 48, 0, false);           // UTC: 4:48 AM Local: 2:48 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 1, 13, 44, 0, false);          // UTC: 1:44 PM Local: 11:44 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 8, 31, 4, 52, 0, false);          // UTC: 4:52 AM Local: 2:52 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 18, 4, 37, 0, false);          // UTC: 4:37 AM Local: 2:37 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 10, 0, 1, 0, false);           // UTC: 12:01 AM Local: 10:01 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 20, 5, 4, 0, false);           // UTC: 5:04 AM Local: 3:04 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 29, 9, 9, 0, false);           // UTC: 9:09 AM Local: 7:09 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 9, 0, 6, 0, false);            // UTC: 12:06 AM Local: 10:06 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 22, 21, 36, 0, false);         // UTC: 9:36 PM Local: 7:36 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 3, 8, 56, 0, false);           // UTC: 8:56 AM Local: 6:56 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 25, 7, 10, 0, false);          // UTC: 7:10 AM Local: 5:10 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 25, 13, 45, 0, false);         // UTC: 1:45 PM Local: 11:45 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 1, 21, 24, 0, false);          // UTC: 9:24 PM Local: 7:24 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 15, 7, 9, 0, false);           // UTC: 7:09 AM Local: 5:09 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 3, 0, 34, 0, false);           // UTC: 12:34 AM Local: 10:34 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 6, 23, 58, 0, false);          // UTC: 11:58 PM Local: 9:58 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 28, 17, 27, 0, false);         // UTC: 5:27 PM Local: 3:27 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 30, 4, 13, 0, false);          // UTC: 4:13 AM Local: 2:13 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 25, 17, 17, 0, false);         // UTC: 5:17 PM Local: 3:17 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 12, 22, 39, 0, false);         // UTC: 10:39 PM Local: 8:39 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 17, 3, 3, 0, false);           // UTC: 3:03 AM Local: 1:03 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 23, 2, 23, 0, false);          // UTC: 2:23 AM Local: 12:23 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 28, 16, 8, 0, false);          // UTC: 4:08 PM Local: 2:08 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 12, 18, 19, 0, false);         // UTC: 6:19 PM Local: 4:19 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 10, 5, 16, 0, false);          // UTC: 5:16 AM Local: 3:16 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 21, 7, 13, 0, false);          // UTC: 7:13 AM Local: 5:13 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 23, 4, 40, 0, false);          // UTC: 4:40 AM Local: 2:40 PM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 9, 27, 19, 31, 0, false);         // UTC: 7:31 PM Local: 5:31 AM Offset: 10:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 31, 4, 27, 0, true);          // UTC: 4:27 AM Local: 3:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 23, 22, 33, 0, true);         // UTC: 10:33 PM Local: 9:33 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 11, 1, 56, 0, true);          // UTC: 1:56 AM Local: 12:56 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 23, 2, 34, 0, true);          // UTC: 2:34 AM Local: 1:34 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 20, 12, 57, 0, true);         // UTC: 12:57 PM Local: 11:57 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 28, 11, 50, 0, true);         // UTC: 11:50 AM Local: 10:50 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 9, 20, 55, 0, true);          // UTC: 8:55 PM Local: 7:55 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 26, 10, 51, 0, true);         // UTC: 10:51 AM Local: 9:51 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 21, 5, 12, 0, true);          // UTC: 5:12 AM Local: 4:12 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 5, 16, 3, 0, true);           // UTC: 4:03 PM Local: 3:03 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 5, 8, 18, 0, true);           // UTC: 8:18 AM Local: 7:18 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 30, 7, 11, 0, true);          // UTC: 7:11 AM Local: 6:11 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 16, 23, 37, 0, true);         // UTC: 11:37 PM Local: 10:37 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 10, 9, 26, 0, true);          // UTC: 9:26 AM Local: 8:26 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 30, 20, 57, 0, true);         // UTC: 8:57 PM Local: 7:57 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 7, 2, 22, 0, true);           // UTC: 2:22 AM Local: 1:22 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 30, 12, 0, 0, true);          // UTC: 12:00 PM Local: 11:00 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 23, 1, 8, 0, true);           // UTC: 1:08 AM Local: 12:08 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 5, 9, 52, 0, true);           // UTC: 9:52 AM Local: 8:52 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 26, 18, 41, 0, true);         // UTC: 6:41 PM Local: 5:41 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 6, 16, 47, 0, true);          // UTC: 4:47 PM Local: 3:47 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 28, 14, 12, 0, true);         // UTC: 2:12 PM Local: 1:12 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 11, 3, 46, 0, true);          // UTC: 3:46 AM Local: 2:46 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 4, 13, 7, 0, true);           // UTC: 1:07 PM Local: 12:07 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 10, 13, 14, 29, 0, true);         // UTC: 2:29 PM Local: 1:29 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 25, 2, 45, 0, true);          // UTC: 2:45 AM Local: 1:45 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 29, 13, 12, 0, true);         // UTC: 1:12 PM Local: 12:12 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 15, 19, 20, 0, true);         // UTC: 7:20 PM Local: 6:20 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 29, 20, 7, 0, true);          // UTC: 8:07 PM Local: 7:07 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 18, 13, 3, 0, true);          // UTC: 1:03 PM Local: 12:03 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 7, 23, 27, 0, true);          // UTC: 11:27 PM Local: 10:27 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 5, 12, 37, 0, true);          // UTC: 12:37 PM Local: 11:37 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 20, 8, 33, 0, true);          // UTC: 8:33 AM Local: 7:33 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 13, 1, 18, 0, true);          // UTC: 1:18 AM Local: 12:18 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 9, 21, 4, 0, true);           // UTC: 9:04 PM Local: 8:04 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 12, 22, 48, 0, true);         // UTC: 10:48 PM Local: 9:48 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 16, 20, 50, 0, true);         // UTC: 8:50 PM Local: 7:50 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 25, 8, 7, 0, true);           // UTC: 8:07 AM Local: 7:07 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 27, 17, 26, 0, true);         // UTC: 5:26 PM Local: 4:26 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 10, 5, 54, 0, true);          // UTC: 5:54 AM Local: 4:54 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 27, 13, 30, 0, true);         // UTC: 1:30 PM Local: 12:30 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 2, 5, 44, 0, true);           // UTC: 5:44 AM Local: 4:44 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 23, 12, 31, 0, true);         // UTC: 12:31 PM Local: 11:31 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 1, 16, 4, 0, true);           // UTC: 4:04 PM Local: 3:04 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 1, 0, 35, 0, true);           // UTC: 12:35 AM Local: 11:35 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 27, 13, 5, 0, true);          // UTC: 1:05 PM Local: 12:05 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 26, 10, 59, 0, true);         // UTC: 10:59 AM Local: 9:59 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 25, 4, 14, 0, true);          // UTC: 4:14 AM Local: 3:14 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 13, 0, 54, 0, true);          // UTC: 12:54 AM Local: 11:54 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 11, 12, 3, 39, 0, true);          // UTC: 3:39 AM Local: 2:39 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 19, 14, 28, 0, true);         // UTC: 2:28 PM Local: 1:28 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 14, 15, 17, 0, true);         // UTC: 3:17 PM Local: 2:17 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 30, 7, 40, 0, true);          // UTC: 7:40 AM Local: 6:40 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 10, 13, 15, 0, true);         // UTC: 1:15 PM Local: 12:15 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 9, 0, 33, 0, true);           // UTC: 12:33 AM Local: 11:33 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 12, 10, 27, 0, true);         // UTC: 10:27 AM Local: 9:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 21, 22, 38, 0, true);         // UTC: 10:38 PM Local: 9:38 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 6, 22, 39, 0, true);          // UTC: 10:39 PM Local: 9:39 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 27, 14, 4, 0, true);          // UTC: 2:04 PM Local: 1:04 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 24, 15, 0, 0, true);          // UTC: 3:00 PM Local: 2:00 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 31, 7, 7, 0, true);           // UTC: 7:07 AM Local: 6:07 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 11, 0, 36, 0, true);          // UTC: 12:36 AM Local: 11:36 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 29, 9, 39, 0, true);          // UTC: 9:39 AM Local: 8:39 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 18, 0, 44, 0, true);          // UTC: 12:44 AM Local: 11:44 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 3, 19, 32, 0, true);          // UTC: 7:32 PM Local: 6:32 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 6, 10, 55, 0, true);          // UTC: 10:55 AM Local: 9:55 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 6, 12, 35, 0, true);          // UTC: 12:35 PM Local: 11:35 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 1, 6, 11, 0, true);           // UTC: 6:11 AM Local: 5:11 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 4, 22, 33, 0, true);          // UTC: 10:33 PM Local: 9:33 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 6, 5, 0, 0, true);            // UTC: 5:00 AM Local: 4:00 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 15, 23, 46, 0, true);         // UTC: 11:46 PM Local: 10:46 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 23, 4, 27, 0, true);          // UTC: 4:27 AM Local: 3:27 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 5, 21, 20, 0, true);          // UTC: 9:20 PM Local: 8:20 AM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 25, 1, 25, 0, true);          // UTC: 1:25 AM Local: 12:25 PM Offset: 11:00:00
+	testCount++; failedCount += test(timeManager, 20, 2020, 12, 1, 13, 15, 0, true);          // UTC: 1:15 PM Local: 12:15 AM Offset: 11:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
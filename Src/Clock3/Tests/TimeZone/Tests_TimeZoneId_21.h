@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_21_H
+#define TEST_TIMEZONEID_21_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_21_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 6, 13, 44, 0, true);           // UTC: 1:44 PM Local: 2:44 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 14, 20, 18, 0, true);          // UTC: 8:18 PM Local: 9:18 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 16, 6, 50, 0, true);           // UTC: 6:50 AM Local: 7:50 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 16, 16, 11, 0, true);          // UTC: 4:11 PM Local: 5:11 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 17, 16, 15, 0, true);          // UTC: 4:15 PM Local: 5:15 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 26, 0, 0, 0, true);            // UTC: 12:00 AM Local: 1:00 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 12, 18, 27, 0, true);          // UTC: 6:27 PM Local: 7:27 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 3, 4, 50, 0, true);            // UTC: 4:50 AM Local: 5:50 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 25, 7, 58, 0, true);           // UTC: 7:58 AM Local: 8:58 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 8, 22, 2, 0, true);            // UTC: 10:02 PM Local: 11:02 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 14, 23, 49, 0, true);          // UTC: 11:49 PM Local: 12:49 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 29, 13, 39, 0, true);          // UTC: 1:39 PM Local: 2:39 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 15, 1, 21, 0, true);           // UTC: 1:21 AM Local: 2:21 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 18, 15, 44, 0, true);          // UTC: 3:44 PM Local: 4:44 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 4, 20, 23, 0, true);           // UTC: 8:23 PM Local: 9:23 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 1, 4, 47, 0, true);            // UTC: 4:47 AM Local: 5:47 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 27, 2, 7, 0, true);            // UTC: 2:07 AM Local: 3:07 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 26, 0, 29, 0, true);           // UTC: 12:29 AM Local: 1:29 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 6, 17, 46, 0, true);           // UTC: 5:46 PM Local: 6:46 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 11, 12, 31, 0, true);          // UTC: 12:31 PM Local: 1:31 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 5, 5, 42, 0, true);            // UTC: 5:42 AM Local: 6:42 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 2, 15, 55, 0, true);           // UTC: 3:55 PM Local: 4:55 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 27, 7, 4, 0, true);            // UTC: 7:04 AM Local: 8:04 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 25, 6, 13, 0, true);           // UTC: 6:13 AM Local: 7:13 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 1, 22, 21, 48, 0, true);          // UTC: 9:48 PM Local: 10:48 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 25, 18, 46, 0, true);          // UTC: 6:46 PM Local: 7:46 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 3, 3, 35, 0, true);            // UTC: 3:35 AM Local: 4:35 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 16, 17, 52, 0, true);          // UTC: 5:52 PM Local: 6:52 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 13, 6, 21, 0, true);           // UTC: 6:21 AM Local: 7:21 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 5, 17, 26, 0, true);           // UTC: 5:26 PM Local: 6:26 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 10, 11, 28, 0, true);          // UTC: 11:28 AM Local: 12:28 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 17, 12, 20, 0, true);          // UTC: 12:20 PM Local: 1:20 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 16, 12, 17, 0, true);          // UTC: 12:17 PM Local: 1:17 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 1, 2, 10, 0, true);            // UTC: 2:10 AM Local: 3:10 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 23, 22, 31, 0, true);          // UTC: 10:31 PM Local: 11:31 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 1, 15, 4, 0, true);            // UTC: 3:04 PM Local: 4:04 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 18, 19, 47, 0, true);          // UTC: 7:47 PM Local: 8:47 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 17, 7, 36, 0, true);           // UTC: 7:36 AM Local: 8:36 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 20, 10, 35, 0, true);          // UTC: 10:35 AM Local: 11:35 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 20, 3, 11, 0, true);           // UTC: 3:11 AM Local: 4:11 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 22, 5, 40, 0, true);           // UTC: 5:40 AM Local: 6:40 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 12, 10, 22, 0, true);          // UTC: 10:22 AM Local: 11:22 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 25, 19, 59, 0, true);          // UTC: 7:59 PM Local: 8:59 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 10, 7, 6, 0, true);            // UTC: 7:06 AM Local: 8:06 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 6, 2, 59, 0, true);            // UTC: 2:59 AM Local: 3:59 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 27, 5, 49, 0, true);           // UTC: 5:49 AM Local: 6:49 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 14, 11, 10, 0, true);          // UTC: 11:10 AM Local: 12:10 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 22, 1, 43, 0, true);           // UTC: 1:43 AM Local: 2:43 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 17, 21, 15, 0, true);          // UTC: 9:15 PM Local: 10:15 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 2, 14, 5, 47, 0, true);           // UTC: 5:47 AM Local: 6:47 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 19, 0, 56, 0, true);           // UTC: 12:56 AM Local: 1:56 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 12, 15, 32, 0, true);          // UTC: 3:32 PM Local: 4:32 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 13, 21, 15, 0, true);          // UTC: 9:15 PM Local: 10:15 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 30, 7, 10, 0, true);           // UTC: 7:10 AM Local: 8:10 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 18, 2, 28, 0, true);           // UTC: 2:28 AM Local: 3:28 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 26, 13, 49, 0, true);          // UTC: 1:49 PM Local: 2:49 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 24, 15, 3, 0, true);           // UTC: 3:03 PM Local: 4:03 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 27, 9, 3, 0, true);            // UTC: 9:03 AM Local: 10:03 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 28, 8, 42, 0, true);           // UTC: 8:42 AM Local: 9:42 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 10, 1, 26, 0, true);           // UTC: 1:26 AM Local: 2:26 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 8, 5, 25, 0, true);            // UTC: 5:25 AM Local: 6:25 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 3, 10, 41, 0, true);           // UTC: 10:41 AM Local: 11:41 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 29, 4, 9, 0, true);            // UTC: 4:09 AM Local: 5:09 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 24, 23, 30, 0, true);          // UTC: 11:30 PM Local: 12:30 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 2, 8, 8, 0, true);             // UTC: 8:08 AM Local: 9:08 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 31, 20, 33, 0, false);         // UTC: 8:33 PM Local: 8:33 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 30, 23, 30, 0, true);          // UTC: 11:30 PM Local: 12:30 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 1, 6, 57, 0, true);            // UTC: 6:57 AM Local: 7:57 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 27, 11, 50, 0, true);          // UTC: 11:50 AM Local: 12:50 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 5, 11, 38, 0, true);           // UTC: 11:38 AM Local: 12:38 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 25, 13, 31, 0, true);          // UTC: 1:31 PM Local: 2:31 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 19, 15, 19, 0, true);          // UTC: 3:19 PM Local: 4:19 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 5, 17, 37, 0, true);           // UTC: 5:37 PM Local: 6:37 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 9, 4, 49, 0, true);            // UTC: 4:49 AM Local: 5:49 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 3, 24, 0, 24, 0, true);           // UTC: 12:24 AM Local: 1:24 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 22, 4, 45, 0, false);          // UTC: 4:45 AM Local: 4:45 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 1, 8, 37, 0, false);           // UTC: 8:37 AM Local: 8:37 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 11, 20, 15, 0, false);         // UTC: 8:15 PM Local: 8:15 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 28, 18, 26, 0, false);         // UTC: 6:26 PM Local: 6:26 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 9, 21, 25, 0, false);          // UTC: 9:25 PM Local: 9:25 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 25, 4, 8, 0, false);           // UTC: 4:08 AM Local: 4:08 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 5, 3, 25, 0, false);           // UTC: 3:25 AM Local: 3:25 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 4, 5, 1, 0, false);            // UTC: 5:01 AM Local: 5:01 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 21, 14, 50, 0, false);         // UTC: 2:50 PM Local: 2:50 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 5, 2, 55, 0, false);           // UTC: 2:55 AM Local: 2:55 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 4, 20, 18, 0, false);          // UTC: 8:18 PM Local: 8:18 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 5, 9, 34, 0, false);           // UTC: 9:34 AM Local: 9:34 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 11, 12, 31, 0, false);         // UTC: 12:31 PM Local: 12:31 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 29, 7, 39, 0, false);          // UTC: 7:39 AM Local: 7:39 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 6, 5, 11, 0, false);           // UTC: 5:11 AM Local: 5:11 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 28, 12, 12, 0, false);         // UTC: 12:12 PM Local: 12:12 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 23, 23, 35, 0, false);         // UTC: 11:35 PM Local: 11:35 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 25, 1, 38, 0, false);          // UTC: 1:38 AM Local: 1:38 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 23, 16, 55, 0, false);         // UTC: 4:55 PM Local: 4:55 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 24, 1, 50, 0, false);          // UTC: 1:50 AM Local: 1:50 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 30, 0, 24, 0, false);          // UTC: 12:24 AM Local: 12:24 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 15, 2, 25, 0, false);          // UTC: 2:25 AM Local: 2:25 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 25, 18, 11, 0, false);         // UTC: 6:11 PM Local: 6:11 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 28, 22, 14, 0, false);         // UTC: 10:14 PM Local: 10:14 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 4, 9, 22, 38, 0, false);          // UTC: 10:38 PM Local: 10:38 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 11, 23, 2, 0, false);          // UTC: 11:02 PM Local: 11:02 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 8, 12, 9, 0, false);           // UTC: 12:09 PM Local: 12:09 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 10, 23, 57, 0, false);         // UTC: 11:57 PM Local: 11:57 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 10, 16, 51, 0, false);         // UTC: 4:51 PM Local: 4:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 18, 15, 36, 0, false);         // UTC: 3:36 PM Local: 3:36 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 4, 17, 38, 0, false);          // UTC: 5:38 PM Local: 5:38 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 2, 16, 38, 0, false);          // UTC: 4:38 PM Local: 4:38 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 24, 10, 33, 0, false);         // UTC: 10:33 AM Local: 10:33 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 10, 9, 44, 0, false);          // UTC: 9:44 AM Local: 9:44 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 20, 16, 48, 0, false);         // UTC: 4:48 PM Local: 4:48 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 18, 6, 4, 0, false);           // UTC: 6:04 AM Local: 6:04 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 20, 10, 12, 0, false);         // UTC: 10:12 AM Local: 10:12 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 12, 2, 20, 0, false);          // UTC: 2:20 AM Local: 2:20 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 22, 13, 6, 0, false);          // UTC: 1:06 PM Local: 1:06 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 28, 2, 41, 0, false);          // UTC: 2:41 AM Local: 2:41 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 3, 20, 52, 0, false);          // UTC: 8:52 PM Local: 8:52 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 26, 14, 32, 0, false);         // UTC: 2:32 PM Local: 2:32 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 20, 0, 43, 0, false);          // UTC: 12:43 AM Local: 12:43 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 21, 22, 28, 0, false);         // UTC: 10:28 PM Local: 10:28 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 16, 16, 32, 0, false);         // UTC: 4:32 PM Local: 4:32 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 13, 12, 4, 0, false);          // UTC: 12:04 PM Local: 12:04 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 8, 0, 3, 0, false);            // UTC: 12:03 AM Local: 12:03 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 22, 13, 2, 0, false);          // UTC: 1:02 PM Local: 1:02 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 8, 8, 45, 0, false);           // UTC: 8:45 AM Local: 8:45 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 5, 19, 12, 46, 0, false);         // UTC: 12:46 PM Local: 12:46 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 14, 14, 51, 0, false);         // UTC: 2:51 PM Local: 2:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 8, 12, 24, 0, false);          // UTC: 12:24 PM Local: 12:24 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 11, 15, 14, 0, false);         // UTC: 3:14 PM Local: 3:14 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 21, 20, 5, 0, false);          // UTC: 8:05 PM Local: 8:05 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 2, 15, 11, 0, false);          // UTC: 3:11 PM Local: 3:11 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 16, 11, 45, 0, false);         // UTC: 11:45 AM Local: 11:45 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 20, 6, 49, 0, false);          // UTC: 6:49 AM Local: 6:49 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 15, 20, 40, 0, false);         // UTC: 8:40 PM Local: 8:40 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 25, 19, 42, 0, false);         // UTC: 7:42 PM Local: 7:42 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 24, 19, 44, 0, false);         // UTC: 7:44 PM Local: 7:44 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 27, 21, 16, 0, false);         // UTC: 9:16 PM Local: 9:16 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 8, 15, 58, 0, false);          // UTC: 3:58 PM Local: 3:58 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 16, 12, 19, 0, false);         // UTC: 12:19 PM Local: 12:19 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 20, 12, 52, 0, false);         // UTC: 12:52 PM Local: 12:52 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 17, 22, 58, 0, false);         // UTC: 10:58 PM Local: 10:58 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 1, 5, 20, 0, false);           // UTC: 5:20 AM Local: 5:20 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 7, 9, 56, 0, false);           // UTC: 9:56 AM Local: 9:56 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 13, 22, 9, 0, false);          // UTC: 10:09 PM Local: 10:09 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 3, 17, 11, 0, false);          // UTC: 5:11 PM Local: 5:11 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 3, 16, 19, 0, false);          // UTC: 4:19 PM Local: 4:19 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 20, 12, 47, 0, false);         // UTC: 12:47 PM Local: 12:47 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 24, 14, 6, 0, false);          // UTC: 2:06 PM Local: 2:06 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 6, 22, 27, 0, false);          // UTC: 10:27 PM Local: 10:27 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 7, 21, 21, 0, false);          // UTC: 9:21 PM Local: 9:21 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 6, 12, 20, 37, 0, false);         // UTC: 8:37 PM Local: 8:37 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 22, 6, 16, 0, false);          // UTC: 6:16 AM Local: 6:16 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 3, 0, 20, 0, false);           // UTC: 12:20 AM Local: 12:20 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 17, 8, 54, 0, false);          // UTC: 8:54 AM Local: 8:54 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 31, 4, 57, 0, false);          // UTC: 4:57 AM Local: 4:57 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 22, 16, 12, 0, false);         // UTC: 4:12 PM Local: 4:12 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 8, 19, 44, 0, false);          // UTC: 7:44 PM Local: 7:44 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 9, 22, 24, 0, false);          // UTC: 10:24 PM Local: 10:24 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 6, 12, 29, 0, false);          // UTC: 12:29 PM Local: 12:29 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 13, 13, 29, 0, false);         // UTC: 1:29 PM Local: 1:29 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 20, 21, 17, 0, false);         // UTC: 9:17 PM Local: 9:17 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 22, 5, 42, 0, false);          // UTC: 5:42 AM Local: 5:42 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 13, 19, 17, 0, false);         // UTC: 7:17 PM Local: 7:17 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 4, 6, 13, 0, false);           // UTC: 6:13 AM Local: 6:13 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 2, 11, 51, 0, false);          // UTC: 11:51 AM Local: 11:51 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 21, 22, 23, 0, false);         // UTC: 10:23 PM Local: 10:23 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 1, 2, 32, 0, false);           // UTC: 2:32 AM Local: 2:32 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 19, 1, 25, 0, false);          // UTC: 1:25 AM Local: 1:25 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 20, 14, 44, 0, false);         // UTC: 2:44 PM Local: 2:44 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 15, 7, 0, 0, false);           // UTC: 7:00 AM Local: 7:00 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 31, 17, 9, 0, false);          // UTC: 5:09 PM Local: 5:09 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 4, 9, 12, 0, false);           // UTC: 9:12 AM Local: 9:12 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 15, 11, 57, 0, false);         // UTC: 11:57 AM Local: 11:57 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 1, 11, 10, 0, false);          // UTC: 11:10 AM Local: 11:10 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 5, 18, 50, 0, false);          // UTC: 6:50 PM Local: 6:50 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 7, 30, 13, 33, 0, false);         // UTC: 1:33 PM Local: 1:33 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 27, 1, 19, 0, false);          // UTC: 1:19 AM Local: 1:19 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 7, 13, 25, 0, false);          // UTC: 1:25 PM Local: 1:25 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 29, 17, 15, 0, false);         // UTC: 5:15 PM Local: 5:15 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 8, 18, 51, 0, false);          // UTC: 6:51 PM Local: 6:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 27, 18, 59, 0, false);         // UTC: 6:59 PM Local: 6:59 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 15, 0, 42, 0, false);          // UTC: 12:42 AM Local: 12:42 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 19, 2, 5, 0, false);           // UTC: 2:05 AM Local: 2:05 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 14, 23, 48, 0, false);         // UTC: 11:48 PM Local: 11:48 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 22, 6, 9, 0, false);           // UTC: 6:09 AM Local: 6:09 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 2, 15, 52, 0, false);          // UTC: 3:52 PM Local: 3:52 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 17, 19, 34, 0, false);         // UTC: 7:34 PM Local: 7:34 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 20, 15, 30, 0, false);         // UTC: 3:30 PM Local: 3:30 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 22, 21, 21, 0, false);         // UTC: 9:21 PM Local: 9:21 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 5, 8, 9, 0, false);            // UTC: 8:09 AM Local: 8:09 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 12, 9, 19, 0, false);          // UTC: 9:19 AM Local: 9:19 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 21, 20, 0, 0, false);          // UTC: 8:00 PM Local: 8:00 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 29, 2, 42, 0, false);          // UTC: 2:42 AM Local: 2:42 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 3, 5, 32, 0, false);           // UTC: 5:32 AM Local: 5:32 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 4, 21, 53, 0, false);          // UTC: 9:53 PM Local: 9:53 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 7, 11, 17, 0, false);          // UTC: 11:17 AM Local: 11:17 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 12, 1, 10, 0, false);          // UTC: 1:10 AM Local: 1:10 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 2, 18, 31, 0, false);          // UTC: 6:31 PM Local: 6:31 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 9, 21, 50, 0, false);          // UTC: 9:50 PM Local: 9:50 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 21, 12, 10, 0, false);         // UTC: 12:10 PM Local: 12:10 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 8, 2, 3, 14, 0, false);           // UTC: 3:14 AM Local: 3:14 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 30, 11, 34, 0, true);          // UTC: 11:34 AM Local: 12:34 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 9, 13, 12, 0, false);          // UTC: 1:12 PM Local: 1:12 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 23, 6, 46, 0, false);          // UTC: 6:46 AM Local: 6:46 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 17, 13, 5, 0, false);          // UTC: 1:05 PM Local: 1:05 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 11, 7, 13, 0, false);          // UTC: 7:13 AM Local: 7:13 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 17, 1, 46, 0, false);          // UTC: 1:46 AM Local: 1:46 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 12, 19, 34, 0, false);         // UTC: 7:34 PM Local: 7:34 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 21, 20, 41, 0, false);         // UTC: 8:41 PM Local: 8:41 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 6, 0, 45, 0, false);           // UTC: 12:45 AM Local: 12:45 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 12, 15, 30, 0, false);         // UTC: 3:30 PM Local: 3:30 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 6, 14, 51, 0, false);          // UTC: 2:51 PM Local: 2:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 1, 8, 43, 0, false);           // UTC: 8:43 AM Local: 8:43 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 2, 6, 43, 0, false);           // UTC: 6:43 AM Local: 6:43 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 25, 20, 57, 0, false);         // UTC: 8:57 PM Local: 8:57 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 20, 17, 38, 0, false);         // UTC: 5:38 PM Local: 5:38 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 30, 3, 19, 0, true);           // UTC: 3:19 AM Local: 4:19 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 13, 6, 29, 0, false);          // UTC: 6:29 AM Local: 6:29 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 30, 22, 50, 0, true);          // UTC: 10:50 PM Local: 11:50 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 12, 0, 58, 0, false);          // UTC: 12:58 AM Local: 12:58 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 12, 5, 39, 0, false);          // UTC: 5:39 AM Local: 5:39 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 9, 19, 1, 0, false);           // UTC: 7:01 PM Local: 7:01 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 25, 12, 41, 0, false);         // UTC: 12:41 PM Local: 12:41 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 24, 5, 11, 0, false);          // UTC: 5:11 AM Local: 5:11 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 30, 17, 32, 0, true);          // UTC: 5:32 PM Local: 6:32 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 9, 29, 13, 13, 0, false);         // UTC: 1:13 PM Local: 1:13 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 8, 16, 35, 0, true);          // UTC: 4:35 PM Local: 5:35 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 10, 14, 47, 0, true);         // UTC: 2:47 PM Local: 3:47 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 25, 11, 58, 0, true);         // UTC: 11:58 AM Local: 12:58 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 3, 7, 25, 0, true);           // UTC: 7:25 AM Local: 8:25 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 20, 5, 22, 0, true);          // UTC: 5:22 AM Local: 6:22 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 18, 21, 52, 0, true);         // UTC: 9:52 PM Local: 10:52 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 28, 11, 36, 0, true);         // UTC: 11:36 AM Local: 12:36 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 5, 0, 58, 0, true);           // UTC: 12:58 AM Local: 1:58 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 14, 18, 48, 0, true);         // UTC: 6:48 PM Local: 7:48 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 1, 21, 47, 0, true);          // UTC: 9:47 PM Local: 10:47 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 7, 23, 6, 0, true);           // UTC: 11:06 PM Local: 12:06 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 7, 17, 33, 0, true);          // UTC: 5:33 PM Local: 6:33 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 12, 16, 18, 0, true);         // UTC: 4:18 PM Local: 5:18 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 4, 5, 15, 0, true);           // UTC: 5:15 AM Local: 6:15 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 22, 13, 39, 0, true);         // UTC: 1:39 PM Local: 2:39 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 21, 14, 49, 0, true);         // UTC: 2:49 PM Local: 3:49 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 16, 6, 41, 0, true);          // UTC: 6:41 AM Local: 7:41 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 7, 8, 11, 0, true);           // UTC: 8:11 AM Local: 9:11 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 14, 12, 14, 0, true);         // UTC: 12:14 PM Local: 1:14 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 16, 15, 16, 0, true);         // UTC: 3:16 PM Local: 4:16 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 2, 17, 54, 0, true);          // UTC: 5:54 PM Local: 6:54 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 15, 6, 2, 0, true);           // UTC: 6:02 AM Local: 7:02 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 26, 10, 37, 0, true);         // UTC: 10:37 AM Local: 11:37 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 15, 9, 47, 0, true);          // UTC: 9:47 AM Local: 10:47 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 10, 5, 23, 14, 0, true);          // UTC: 11:14 PM Local: 12:14 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 6, 12, 9, 0, true);           // UTC: 12:09 PM Local: 1:09 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 13, 1, 0, 0, true);           // UTC: 1:00 AM Local: 2:00 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 25, 21, 55, 0, true);         // UTC: 9:55 PM Local: 10:55 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 19, 9, 36, 0, true);          // UTC: 9:36 AM Local: 10:36 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 27, 14, 12, 0, true);         // UTC: 2:12 PM Local: 3:12 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 16, 7, 55, 0, true);          // UTC: 7:55 AM Local: 8:55 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 24, 17, 51, 0, true);         // UTC: 5:51 PM Local: 6:51 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 25, 15, 43, 0, true);         // UTC: 3:43 PM Local: 4:43 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 2, 0, 23, 0, true);           // UTC: 12:23 AM Local: 1:23 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 30, 4, 31, 0, true);          // UTC: 4:31 AM Local: 5:31 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 11, 14, 22, 0, true);         // UTC: 2:22 PM Local: 3:22 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 13, 18, 40, 0, true);         // UTC: 6:40 PM Local: 7:40 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 15, 19, 45, 0, true);         // UTC: 7:45 PM Local: 8:45 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 23, 2, 55, 0, true);          // UTC: 2:55 AM Local: 3:55 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 9, 3, 23, 0, true);           // UTC: 3:23 AM Local: 4:23 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 21, 8, 46, 0, true);          // UTC: 8:46 AM Local: 9:46 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 26, 14, 50, 0, true);         // UTC: 2:50 PM Local: 3:50 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 4, 6, 38, 0, true);           // UTC: 6:38 AM Local: 7:38 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 28, 10, 56, 0, true);         // UTC: 10:56 AM Local: 11:56 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 28, 2, 47, 0, true);          // UTC: 2:47 AM Local: 3:47 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 10, 7, 40, 0, true);          // UTC: 7:40 AM Local: 8:40 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 5, 4, 48, 0, true);           // UTC: 4:48 AM Local: 5:48 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 27, 8, 6, 0, true);           // UTC: 8:06 AM Local: 9:06 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 22, 19, 18, 0, true);         // UTC: 7:18 PM Local: 8:18 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 11, 21, 6, 32, 0, true);          // UTC: 6:32 AM Local: 7:32 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 7, 4, 31, 0, true);           // UTC: 4:31 AM Local: 5:31 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 25, 22, 31, 0, true);         // UTC: 10:31 PM Local: 11:31 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 7, 1, 43, 0, true);           // UTC: 1:43 AM Local: 2:43 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 29, 10, 58, 0, true);         // UTC: 10:58 AM Local: 11:58 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 21, 16, 23, 0, true);         // UTC: 4:23 PM Local: 5:23 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 1, 6, 53, 0, true);           // UTC: 6:53 AM Local: 7:53 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 5, 9, 3, 0, true);            // UTC: 9:03 AM Local: 10:03 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 9, 22, 52, 0, true);          // UTC: 10:52 PM Local: 11:52 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 14, 1, 7, 0, true);           // UTC: 1:07 AM Local: 2:07 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 25, 19, 41, 0, true);         // UTC: 7:41 PM Local: 8:41 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 17, 0, 46, 0, true);          // UTC: 12:46 AM Local: 1:46 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 8, 19, 45, 0, true);          // UTC: 7:45 PM Local: 8:45 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 15, 15, 32, 0, true);         // UTC: 3:32 PM Local: 4:32 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 18, 17, 23, 0, true);         // UTC: 5:23 PM Local: 6:23 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 14, 20, 1, 0, true);          // UTC: 8:01 PM Local: 9:01 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 21, 11, 9, 0, true);          // UTC: 11:09 AM Local: 12:09 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 12, 12, 48, 0, true);         // UTC: 12:48 PM Local: 1:48 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 15, 20, 41, 0, true);         // UTC: 8:41 PM Local: 9:41 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 15, 23, 32, 0, true);         // UTC: 11:32 PM Local: 12:32 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 19, 7, 28, 0, true);          // UTC: 7:28 AM Local: 8:28 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 26, 7, 1, 0, true);           // UTC: 7:01 AM Local: 8:01 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 28, 20, 57, 0, true);         // UTC: 8:57 PM Local: 9:57 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 15, 7, 49, 0, true);          // UTC: 7:49 AM Local: 8:49 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 19, 18, 47, 0, true);         // UTC: 6:47 PM Local: 7:47 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2018, 12, 3, 11, 31, 0, true);          // UTC: 11:31 AM Local: 12:31 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 5, 5, 0, 0, true);             // UTC: 5:00 AM Local: 6:00 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 26, 8, 20, 0, true);           // UTC: 8:20 AM Local: 9:20 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 23, 10, 19, 0, true);          // UTC: 10:19 AM Local: 11:19 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 7, 1, 29, 0, true);            // UTC: 1:29 AM Local: 2:29 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 6, 6, 9, 0, true);             // UTC: 6:09 AM Local: 7:09 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 1, 19, 10, 0, true);           // UTC: 7:10 PM Local: 8:10 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 28, 4, 14, 0, true);           // UTC: 4:14 AM Local: 5:14 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 18, 3, 10, 0, true);           // UTC: 3:10 AM Local: 4:10 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 18, 20, 7, 0, true);           // UTC: 8:07 PM Local: 9:07 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 21, 12, 7, 0, true);           // UTC: 12:07 PM Local: 1:07 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 25, 3, 13, 0, true);           // UTC: 3:13 AM Local: 4:13 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 23, 22, 13, 0, true);          // UTC: 10:13 PM Local: 11:13 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 18, 0, 5, 0, true);            // UTC: 12:05 AM Local: 1:05 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 25, 7, 14, 0, true);           // UTC: 7:14 AM Local: 8:14 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 20, 18, 6, 0, true);           // UTC: 6:06 PM Local: 7:06 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 8, 6, 27, 0, true);            // UTC: 6:27 AM Local: 7:27 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 19, 16, 44, 0, true);          // UTC: 4:44 PM Local: 5:44 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 22, 0, 25, 0, true);           // UTC: 12:25 AM Local: 1:25 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 10, 10, 51, 0, true);          // UTC: 10:51 AM Local: 11:51 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 30, 21, 22, 0, true);          // UTC: 9:22 PM Local: 10:22 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 29, 13, 2, 0, true);           // UTC: 1:02 PM Local: 2:02 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 19, 15, 2, 0, true);           // UTC: 3:02 PM Local: 4:02 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 29, 12, 49, 0, true);          // UTC: 12:49 PM Local: 1:49 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 26, 18, 30, 0, true);          // UTC: 6:30 PM Local: 7:30 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 1, 6, 1, 59, 0, true);            // UTC: 1:59 AM Local: 2:59 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 21, 2, 49, 0, true);           // UTC: 2:49 AM Local: 3:49 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 9, 15, 46, 0, true);           // UTC: 3:46 PM Local: 4:46 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 9, 16, 52, 0, true);           // UTC: 4:52 PM Local: 5:52 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 6, 9, 21, 0, true);            // UTC: 9:21 AM Local: 10:21 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 12, 21, 31, 0, true);          // UTC: 9:31 PM Local: 10:31 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 21, 8, 24, 0, true);           // UTC: 8:24 AM Local: 9:24 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 26, 9, 3, 0, true);            // UTC: 9:03 AM Local: 10:03 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 4, 9, 37, 0, true);            // UTC: 9:37 AM Local: 10:37 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 3, 15, 20, 0, true);           // UTC: 3:20 PM Local: 4:20 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 27, 4, 48, 0, true);           // UTC: 4:48 AM Local: 5:48 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 24, 4, 19, 0, true);           // UTC: 4:19 AM Local: 5:19 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 10, 12, 7, 0, true);           // UTC: 12:07 PM Local: 1:07 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 9, 21, 43, 0, true);           // UTC: 9:43 PM Local: 10:43 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 15, 7, 3, 0, true);            // UTC: 7:03 AM Local: 8:03 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 12, 23, 55, 0, true);          // UTC: 11:55 PM Local: 12:55 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 27, 13, 32, 0, true);          // UTC: 1:32 PM Local: 2:32 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 23, 3, 40, 0, true);           // UTC: 3:40 AM Local: 4:40 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 16, 6, 35, 0, true);           // UTC: 6:35 AM Local: 7:35 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 12, 23, 12, 0, true);          // UTC: 11:12 PM Local: 12:12 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 2, 15, 40, 0, true);           // UTC: 3:40 PM Local: 4:40 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 10, 19, 21, 0, true);          // UTC: 7:21 PM Local: 8:21 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 14, 5, 49, 0, true);           // UTC: 5:49 AM Local: 6:49 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 1, 13, 32, 0, true);           // UTC: 1:32 PM Local: 2:32 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 7, 5, 2, 0, true);             // UTC: 5:02 AM Local: 6:02 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 2, 7, 6, 10, 0, true);            // UTC: 6:10 AM Local: 7:10 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 28, 10, 0, 0, true);           // UTC: 10:00 AM Local: 11:00 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 22, 7, 54, 0, true);           // UTC: 7:54 AM Local: 8:54 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 21, 14, 15, 0, true);          // UTC: 2:15 PM Local: 3:15 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 24, 11, 33, 0, true);          // UTC: 11:33 AM Local: 12:33 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 28, 12, 12, 0, true);          // UTC: 12:12 PM Local: 1:12 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 9, 22, 38, 0, true);           // UTC: 10:38 PM Local: 11:38 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 29, 5, 44, 0, true);           // UTC: 5:44 AM Local: 6:44 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 12, 15, 9, 0, true);           // UTC: 3:09 PM Local: 4:09 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 11, 11, 57, 0, true);          // UTC: 11:57 AM Local: 12:57 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 29, 20, 9, 0, true);           // UTC: 8:09 PM Local: 9:09 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 10, 21, 48, 0, true);          // UTC: 9:48 PM Local: 10:48 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 25, 22, 43, 0, true);          // UTC: 10:43 PM Local: 11:43 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 24, 2, 56, 0, true);           // UTC: 2:56 AM Local: 3:56 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 2, 7, 46, 0, true);            // UTC: 7:46 AM Local: 8:46 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 10, 10, 35, 0, true);          // UTC: 10:35 AM Local: 11:35 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 13, 5, 46, 0, true);           // UTC: 5:46 AM Local: 6:46 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 13, 0, 40, 0, true);           // UTC: 12:40 AM Local: 1:40 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 19, 8, 58, 0, true);           // UTC: 8:58 AM Local: 9:58 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 9, 6, 50, 0, true);            // UTC: 6:50 AM Local: 7:50 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 20, 23, 14, 0, true);          // UTC: 11:14 PM Local: 12:14 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 26, 3, 55, 0, true);           // UTC: 3:55 AM Local: 4:55 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 1, 6, 52, 0, true);            // UTC: 6:52 AM Local: 7:52 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 13, 6, 31, 0, true);           // UTC: 6:31 AM Local: 7:31 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 21, 22, 42, 0, true);          // UTC: 10:42 PM Local: 11:42 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 3, 17, 6, 10, 0, true);           // UTC: 6:10 AM Local: 7:10 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 21, 13, 24, 0, false);         // UTC: 1:24 PM Local: 1:24 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 22, 9, 49, 0, false);          // UTC: 9:49 AM Local: 9:49 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 5, 16, 24, 0, true);           // UTC: 4:24 PM Local: 5:24 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 2, 4, 45, 0, true);            // UTC: 4:45 AM Local: 5:45 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 1, 2, 10, 0, true);            // UTC: 2:10 AM Local: 3:10 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 15, 3, 48, 0, false);          // UTC: 3:48 AM Local: 3:48 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 16, 1, 4, 0, false);           // UTC: 1:04 AM Local: 1:04 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 21, 10, 7, 0, false);          // UTC: 10:07 AM Local: 10:07 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 6, 16, 37, 0, false);          // UTC: 4:37 PM Local: 4:37 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 10, 20, 28, 0, false);         // UTC: 8:28 PM Local: 8:28 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 28, 22, 18, 0, false);         // UTC: 10:18 PM Local: 10:18 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 14, 12, 46, 0, false);         // UTC: 12:46 PM Local: 12:46 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 18, 3, 17, 0, false);          // UTC: 3:17 AM Local: 3:17 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 12, 0, 44, 0, false);          // UTC: 12:44 AM Local: 12:44 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 14, 8, 29, 0, false);          // UTC: 8:29 AM Local: 8:29 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 21, 10, 56, 0, false);         // UTC: 10:56 AM Local: 10:56 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 23, 8, 54, 0, false);          // UTC: 8:54 AM Local: 8:54 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 12, 4, 33, 0, false);          // UTC: 4:33 AM Local: 4:33 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 12, 20, 59, 0, false);         // UTC: 8:59 PM Local: 8:59 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 21, 11, 13, 0, false);         // UTC: 11:13 AM Local: 11:13 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 21, 5, 52, 0, false);          // UTC: 5:52 AM Local: 5:52 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 3, 8, 50, 0, true);            // UTC: 8:50 AM Local: 9:50 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 26, 5, 0, 0, false);           // UTC: 5:00 AM Local: 5:00 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 11, 1, 10, 0, false);          // UTC: 1:10 AM Local: 1:10 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 4, 26, 11, 44, 0, false);         // UTC: 11:44 AM Local: 11:44 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 7, 16, 1, 0, false);           // UTC: 4:01 PM Local: 4:01 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 2, 0, 11, 0, false);           // UTC: 12:11 AM Local: 12:11 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 11, 18, 43, 0, false);         // UTC: 6:43 PM Local: 6:43 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 18, 7, 54, 0, false);          // UTC: 7:54 AM Local: 7:54 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 5, 10, 39, 0, false);          // UTC: 10:39 AM Local: 10:39 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 23, 5, 38, 0, false);          // UTC: 5:38 AM Local: 5:38 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 25, 6, 6, 0, false);           // UTC: 6:06 AM Local: 6:06 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 6, 23, 19, 0, false);          // UTC: 11:19 PM Local: 11:19 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 14, 8, 20, 0, false);          // UTC: 8:20 AM Local: 8:20 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 7, 23, 25, 0, false);          // UTC: 11:25 PM Local: 11:25 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 13, 9, 47, 0, false);          // UTC: 9:47 AM Local: 9:47 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 30, 23, 2, 0, false);          // UTC: 11:02 PM Local: 11:02 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 8, 9, 20, 0, false);           // UTC: 9:20 AM Local: 9:20 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 8, 9, 52, 0, false);           // UTC: 9:52 AM Local: 9:52 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 14, 6, 5, 0, false);           // UTC: 6:05 AM Local: 6:05 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 20, 14, 29, 0, false);         // UTC: 2:29 PM Local: 2:29 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 23, 22, 59, 0, false);         // UTC: 10:59 PM Local: 10:59 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 26, 5, 11, 0, false);          // UTC: 5:11 AM Local: 5:11 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 24, 19, 28, 0, false);         // UTC: 7:28 PM Local: 7:28 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 2, 12, 58, 0, false);          // UTC: 12:58 PM Local: 12:58 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 16, 2, 57, 0, false);          // UTC: 2:57 AM Local: 2:57 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 23, 17, 31, 0, false);         // UTC: 5:31 PM Local: 5:31 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 29, 5, 52, 0, false);          // UTC: 5:52 AM Local: 5:52 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 18, 3, 39, 0, false);          // UTC: 3:39 AM Local: 3:39 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 5, 26, 0, 46, 0, false);          // UTC: 12:46 AM Local: 12:46 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 25, 0, 19, 0, false);          // UTC: 12:19 AM Local: 12:19 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 17, 4, 46, 0, false);          // UTC: 4:46 AM Local: 4:46 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 21, 0, 40, 0, false);          // UTC: 12:40 AM Local: 12:40 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 29, 2, 55, 0, false);          // UTC: 2:55 AM Local: 2:55 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 15, 2, 36, 0, false);          // UTC: 2:36 AM Local: 2:36 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 14, 11, 38, 0, false);         // UTC: 11:38 AM Local: 11:38 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 28, 12, 50, 0, false);         // UTC: 12:50 PM Local: 12:50 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 15, 15, 47, 0, false);         // UTC: 3:47 PM Local: 3:47 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 9, 5, 36, 0, false);           // UTC: 5:36 AM Local: 5:36 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 10, 20, 48, 0, false);         // UTC: 8:48 PM Local: 8:48 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 8, 9, 4, 0, false);            // UTC: 9:04 AM Local: 9:04 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 30, 4, 10, 0, false);          // UTC: 4:10 AM Local: 4:10 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 30, 13, 41, 0, false);         // UTC: 1:41 PM Local: 1:41 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 11, 17, 16, 0, false);         // UTC: 5:16 PM Local: 5:16 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 25, 11, 25, 0, false);         // UTC: 11:25 AM Local: 11:25 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 18, 23, 7, 0, false);          // UTC: 11:07 PM Local: 11:07 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 12, 17, 32, 0, false);         // UTC: 5:32 PM Local: 5:32 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 2, 2, 41, 0, false);           // UTC: 2:41 AM Local: 2:41 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 7, 7, 29, 0, false);           // UTC: 7:29 AM Local: 7:29 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 11, 15, 18, 0, false);         // UTC: 3:18 PM Local: 3:18 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 17, 7, 42, 0, false);          // UTC: 7:42 AM Local: 7:42 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 18, 15, 17, 0, false);         // UTC: 3:17 PM Local: 3:17 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 25, 6, 43, 0, false);          // UTC: 6:43 AM Local: 6:43 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 19, 10, 20, 0, false);         // UTC: 10:20 AM Local: 10:20 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 6, 20, 18, 47, 0, false);         // UTC: 6:47 PM Local: 6:47 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 16, 17, 26, 0, false);         // UTC: 5:26 PM Local: 5:26 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 25, 7, 40, 0, false);          // UTC: 7:40 AM Local: 7:40 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 29, 8, 13, 0, false);          // UTC: 8:13 AM Local: 8:13 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 22, 5, 34, 0, false);          // UTC: 5:34 AM Local: 5:34 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 17, 5, 6, 0, false);           // UTC: 5:06 AM Local: 5:06 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 31, 23, 11, 0, false);         // UTC: 11:11 PM Local: 11:11 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 9, 15, 27, 0, false);          // UTC: 3:27 PM Local: 3:27 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 20, 17, 17, 0, false);         // UTC: 5:17 PM Local: 5:17 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 8, 16, 16, 0, false);          // UTC: 4:16 PM Local: 4:16 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 3, 19, 41, 0, false);          // UTC: 7:41 PM Local: 7:41 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 26, 20, 58, 0, false);         // UTC: 8:58 PM Local: 8:58 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 4, 9, 36, 0, false);           // UTC: 9:36 AM Local: 9:36 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 31, 2, 13, 0, false);          // UTC: 2:13 AM Local: 2:13 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 18, 5, 44, 0, false);          // UTC: 5:44 AM Local: 5:44 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 1, 16, 49, 0, false);          // UTC: 4:49 PM Local: 4:49 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 18, 16, 51, 0, false);         // UTC: 4:51 PM Local: 4:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 26, 20, 15, 0, false);         // UTC: 8:15 PM Local: 8:15 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 21, 13, 44, 0, false);         // UTC: 1:44 PM Local: 1:44 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 14, 21, 54, 0, false);         // UTC: 9:54 PM Local: 9:54 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 22, 12, 16, 0, false);         // UTC: 12:16 PM Local: 12:16 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 20, 22, 11, 0, false);         // UTC: 10:11 PM Local: 10:11 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 14, 6, 0, 0, false);           // UTC: 6:00 AM Local: 6:00 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 23, 9, 24, 0, false);          // UTC: 9:24 AM Local: 9:24 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 14, 6, 57, 0, false);          // UTC: 6:57 AM Local: 6:57 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 7, 22, 21, 16, 0, false);         // UTC: 9:16 PM Local: 9:16 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 30, 23, 40, 0, false);         // UTC: 11:40 PM Local: 11:40 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 22, 12, 31, 0, false);         // UTC: 12:31 PM Local: 12:31 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 10, 18, 46, 0, false);         // UTC: 6:46 PM Local: 6:46 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 29, 7, 3, 0, false);           // UTC: 7:03 AM Local: 7:03 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 22, 11, 16, 0, false);         // UTC: 11:16 AM Local: 11:16 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 12, 10, 33, 0, false);         // UTC: 10:33 AM Local: 10:33 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 14, 16, 3, 0, false);          // UTC: 4:03 PM Local: 4:03 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 9, 21, 10, 0, false);          // UTC: 9:10 PM Local: 9:10 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 31, 7, 55, 0, false);          // UTC: 7:55 AM Local: 7:55 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 6, 3, 21, 0, false);           // UTC: 3:21 AM Local: 3:21 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 21, 7, 10, 0, false);          // UTC: 7:10 AM Local: 7:10 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 25, 18, 11, 0, false);         // UTC: 6:11 PM Local: 6:11 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 11, 19, 33, 0, false);         // UTC: 7:33 PM Local: 7:33 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 24, 21, 38, 0, false);         // UTC: 9:38 PM Local: 9:38 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 3, 1, 3, 0, false);            // UTC: 1:03 AM Local: 1:03 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 28, 21, 30, 0, false);         // UTC: 9:30 PM Local: 9:30 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 27, 18, 38, 0, false);         // UTC: 6:38 PM Local: 6:38 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 6, 5, 25, 0, false);           // UTC: 5:25 AM Local: 5:25 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 13, 9, 29, 0, false);          // UTC: 9:29 AM Local: 9:29 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 26, 1, 10, 0, false);          // UTC: 1:10 AM Local: 1:10 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 5, 5, 59, 0, false);           // UTC: 5:59 AM Local: 5:59 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 19, 12, 41, 0, false);         // UTC: 12:41 PM Local: 12:41 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 21, 14, 10, 0, false);         // UTC: 2:10 PM Local: 2:10 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 13, 12, 21, 0, false);         // UTC: 12:21 PM Local: 12:21 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 8, 4, 21, 42, 0, false);          // UTC: 9:42 PM Local: 9:42 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 7, 20, 32, 0, false);          // UTC: 8:32 PM Local: 8:32 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 27, 5, 6, 0, false);           // UTC: 5:06 AM Local: 5:06 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 4, 10, 2, 0, false);           // UTC: 10:02 AM Local: 10:02 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 4, 12, 51, 0, false);          // UTC: 12:51 PM Local: 12:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 21, 10, 35, 0, false);         // UTC: 10:35 AM Local: 10:35 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 13, 23, 30, 0, false);         // UTC: 11:30 PM Local: 11:30 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 9, 2, 51, 0, false);           // UTC: 2:51 AM Local: 2:51 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 24, 12, 3, 0, false);          // UTC: 12:03 PM Local: 12:03 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 25, 16, 36, 0, false);         // UTC: 4:36 PM Local: 4:36 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 9, 4, 22, 0, false);           // UTC: 4:22 AM Local: 4:22 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 17, 15, 5, 0, false);          // UTC: 3:05 PM Local: 3:05 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 11, 3, 29, 0, false);          // UTC: 3:29 AM Local: 3:29 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 13, 13, 41, 0, false);         // UTC: 1:41 PM Local: 1:41 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 15, 15, 48, 0, false);         // UTC: 3:48 PM Local: 3:48 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 10, 19, 51, 0, false);         // UTC: 7:51 PM Local: 7:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 2, 13, 15, 0, false);          // UTC: 1:15 PM Local: 1:15 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 21, 1, 49, 0, false);          // UTC: 1:49 AM Local: 1:49 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 26, 23, 45, 0, false);         // UTC: 11:45 PM Local: 11:45 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 19, 8, 15, 0, false);          // UTC: 8:15 AM Local: 8:15 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 16, 8, 17, 0, false);          // UTC: 8:17 AM Local: 8:17 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 19, 17, 27, 0, false);         // UTC: 5:27 PM Local: 5:27 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 8, 23, 49, 0, false);          // UTC: 11:49 PM Local: 11:49 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 14, 12, 57, 0, false);         // UTC: 12:57 PM Local: 12:57 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 11, 6, 20, 0, false);          // UTC: 6:20 AM Local: 6:20 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 9, 12, 9, 48, 0, false);          // UTC: 9:48 AM Local: 9:48 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 27, 9, 43, 0, true);          // UTC: 9:43 AM Local: 10:43 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 15, 0, 40, 0, true);          // UTC: 12:40 AM Local: 1:40 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 3, 8, 4, 0, true);            // UTC: 8:04 AM Local: 9:04 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 22, 3, 58, 0, true);          // UTC: 3:58 AM Local: 4:58 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 16, 20, 30, 0, true);         // UTC: 8:30 PM Local: 9:30 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 11, 13, 21, 0, true);         // UTC: 1:21 PM Local: 2:21 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 13, 7, 33, 0, true);          // UTC: 7:33 AM Local: 8:33 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 9, 2, 50, 0, true);           // UTC: 2:50 AM Local: 3:50 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 28, 4, 11, 0, true);          // UTC: 4:11 AM Local: 5:11 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 18, 23, 59, 0, true);         // UTC: 11:59 PM Local: 12:59 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 3, 6, 23, 0, true);           // UTC: 6:23 AM Local: 7:23 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 21, 12, 33, 0, true);         // UTC: 12:33 PM Local: 1:33 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 18, 16, 25, 0, true);         // UTC: 4:25 PM Local: 5:25 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 16, 3, 57, 0, true);          // UTC: 3:57 AM Local: 4:57 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 17, 4, 5, 0, true);           // UTC: 4:05 AM Local: 5:05 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 26, 19, 25, 0, true);         // UTC: 7:25 PM Local: 8:25 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 31, 22, 59, 0, true);         // UTC: 10:59 PM Local: 11:59 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 16, 6, 26, 0, true);          // UTC: 6:26 AM Local: 7:26 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 26, 7, 14, 0, true);          // UTC: 7:14 AM Local: 8:14 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 9, 6, 1, 0, true);            // UTC: 6:01 AM Local: 7:01 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 6, 20, 46, 0, true);          // UTC: 8:46 PM Local: 9:46 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 7, 1, 21, 0, true);           // UTC: 1:21 AM Local: 2:21 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 20, 12, 38, 0, true);         // UTC: 12:38 PM Local: 1:38 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 23, 23, 12, 0, true);         // UTC: 11:12 PM Local: 12:12 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 10, 19, 3, 59, 0, true);          // UTC: 3:59 AM Local: 4:59 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 13, 9, 53, 0, true);          // UTC: 9:53 AM Local: 10:53 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 3, 18, 58, 0, true);          // UTC: 6:58 PM Local: 7:58 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 9, 1, 44, 0, true);           // UTC: 1:44 AM Local: 2:44 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 25, 7, 58, 0, true);          // UTC: 7:58 AM Local: 8:58 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 16, 12, 27, 0, true);         // UTC: 12:27 PM Local: 1:27 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 12, 1, 23, 0, true);          // UTC: 1:23 AM Local: 2:23 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 16, 23, 41, 0, true);         // UTC: 11:41 PM Local: 12:41 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 9, 0, 1, 0, true);            // UTC: 12:01 AM Local: 1:01 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 18, 4, 2, 0, true);           // UTC: 4:02 AM Local: 5:02 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 16, 17, 37, 0, true);         // UTC: 5:37 PM Local: 6:37 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 13, 10, 45, 0, true);         // UTC: 10:45 AM Local: 11:45 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 15, 22, 48, 0, true);         // UTC: 10:48 PM Local: 11:48 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 30, 2, 37, 0, true);          // UTC: 2:37 AM Local: 3:37 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 28, 8, 52, 0, true);          // UTC: 8:52 AM Local: 9:52 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 21, 21, 3, 0, true);          // UTC: 9:03 PM Local: 10:03 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 9, 23, 20, 0, true);          // UTC: 11:20 PM Local: 12:20 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 10, 5, 46, 0, true);          // UTC: 5:46 AM Local: 6:46 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 2, 4, 38, 0, true);           // UTC: 4:38 AM Local: 5:38 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 29, 5, 36, 0, true);          // UTC: 5:36 AM Local: 6:36 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 2, 8, 32, 0, true);           // UTC: 8:32 AM Local: 9:32 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 28, 5, 24, 0, true);          // UTC: 5:24 AM Local: 6:24 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 20, 16, 14, 0, true);         // UTC: 4:14 PM Local: 5:14 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 26, 0, 5, 0, true);           // UTC: 12:05 AM Local: 1:05 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 9, 13, 44, 0, true);          // UTC: 1:44 PM Local: 2:44 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 11, 21, 2, 50, 0, true);          // UTC: 2:50 AM Local: 3:50 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 17, 11, 24, 0, true);         // UTC: 11:24 AM Local: 12:24 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 16, 15, 50, 0, true);         // UTC: 3:50 PM Local: 4:50 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 30, 8, 4, 0, true);           // UTC: 8:04 AM Local: 9:04 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 16, 20, 47, 0, true);         // UTC: 8:47 PM Local: 9:47 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 28, 10, 15, 0, true);         // UTC: 10:15 AM Local: 11:15 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 18, 21, 21, 0, true);         // UTC: 9:21 PM Local: 10:21 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 7, 0, 10, 0, true);           // UTC: 12:10 AM Local: 1:10 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 26, 15, 45, 0, true);         // UTC: 3:45 PM Local: 4:45 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 21, 20, 40, 0, true);         // UTC: 8:40 PM Local: 9:40 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 13, 18, 10, 0, true);         // UTC: 6:10 PM Local: 7:10 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 1, 16, 0, 0, true);           // UTC: 4:00 PM Local: 5:00 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 16, 8, 58, 0, true);          // UTC: 8:58 AM Local: 9:58 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 3, 4, 11, 0, true);           // UTC: 4:11 AM Local: 5:11 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 9, 1, 8, 0, true);            // UTC: 1:08 AM Local: 2:08 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 21, 21, 36, 0, true);         // UTC: 9:36 PM Local: 10:36 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 8, 15, 58, 0, true);          // UTC: 3:58 PM Local: 4:58 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 21, 20, 53, 0, true);         // UTC: 8:53 PM Local: 9:53 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 7, 6, 23, 0, true);           // UTC: 6:23 AM Local: 7:23 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 28, 15, 20, 0, true);         // UTC: 3:20 PM Local: 4:20 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 2, 4, 8, 0, true);            // UTC: 4:08 AM Local: 5:08 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 21, 11, 18, 0, true);         // UTC: 11:18 AM Local: 12:18 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 14, 21, 17, 0, true);         // UTC: 9:17 PM Local: 10:17 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 10, 11, 24, 0, true);         // UTC: 11:24 AM Local: 12:24 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 12, 6, 55, 0, true);          // UTC: 6:55 AM Local: 7:55 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2019, 12, 27, 19, 11, 0, true);         // UTC: 7:11 PM Local: 8:11 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 28, 10, 55, 0, true);          // UTC: 10:55 AM Local: 11:55 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 18, 1, 56, 0, true);           // UTC: 1:56 AM Local: 2:56 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 26, 8, 15, 0, true);           // UTC: 8:15 AM Local: 9:15 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 17, 8, 40, 0, true);           // UTC: 8:40 AM Local: 9:40 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 18, 18, 53, 0, true);          // UTC: 6:53 PM Local: 7:53 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 14, 7, 41, 0, true);           // UTC: 7:41 AM Local: 8:41 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 20, 10, 21, 0, true);          // UTC: 10:21 AM Local: 11:21 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 5, 17, 0, 0, true);            // UTC: 5:00 PM Local: 6:00 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 24, 19, 3, 0, true);           // UTC: 7:03 PM Local: 8:03 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 19, 1, 51, 0, true);           // UTC: 1:51 AM Local: 2:51 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 15, 5, 31, 0, true);           // UTC: 5:31 AM Local: 6:31 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 22, 13, 29, 0, true);          // UTC: 1:29 PM Local: 2:29 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 28, 16, 9, 0, true);           // UTC: 4:09 PM Local: 5:09 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 27, 16, 27, 0, true);          // UTC: 4:27 PM Local: 5:27 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 14, 21, 41, 0, true);          // UTC: 9:41 PM Local: 10:41 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 8, 4, 33, 0, true);            // UTC: 4:33 AM Local: 5:33 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 28, 16, 34, 0, true);          // UTC: 4:34 PM Local: 5:34 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 2, 10, 30, 0, true);           // UTC: 10:30 AM Local: 11:30 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 4, 17, 32, 0, true);           // UTC: 5:32 PM Local: 6:32 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 14, 10, 16, 0, true);          // UTC: 10:16 AM Local: 11:16 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 14, 3, 18, 0, true);           // UTC: 3:18 AM Local: 4:18 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 29, 0, 16, 0, true);           // UTC: 12:16 AM Local: 1:16 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 8, 9, 30, 0, true);            // UTC: 9:30 AM Local: 10:30 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 27, 21, 11, 0, true);          // UTC: 9:11 PM Local: 10:11 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 1, 3, 10, 21, 0, true);           // UTC: 10:21 AM Local: 11:21 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 15, 23, 40, 0, true);          // UTC: 11:40 PM Local: 12:40 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 12, 14, 11, 0, true);          // UTC: 2:11 PM Local: 3:11 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 23, 13, 22, 0, true);          // UTC: 1:22 PM Local: 2:22 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 23, 15, 14, 0, true);          // UTC: 3:14 PM Local: 4:14 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 26, 20, 32, 0, true);          // UTC: 8:32 PM Local: 9:32 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 6, 19, 52, 0, true);           // UTC: 7:52 PM Local: 8:52 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 8, 23, 39, 0, true);           // UTC: 11:39 PM Local: 12:39 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 16, 19, 5, 0, true);           // UTC: 7:05 PM Local: 8:05 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 13, 5, 4, 0, true);            // UTC: 5:04 AM Local: 6:04 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 12, 4, 51, 0, true);           // UTC: 4:51 AM Local: 5:51 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 15, 18, 54, 0, true);          // UTC: 6:54 PM Local: 7:54 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 10, 17, 57, 0, true);          // UTC: 5:57 PM Local: 6:57 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 28, 15, 24, 0, true);          // UTC: 3:24 PM Local: 4:24 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 11, 2, 12, 0, true);           // UTC: 2:12 AM Local: 3:12 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 13, 9, 36, 0, true);           // UTC: 9:36 AM Local: 10:36 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 20, 7, 33, 0, true);           // UTC: 7:33 AM Local: 8:33 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 2, 10, 23, 0, true);           // UTC: 10:23 AM Local: 11:23 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 10, 21, 34, 0, true);          // UTC: 9:34 PM Local: 10:34 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 26, 10, 38, 0, true);          // UTC: 10:38 AM Local: 11:38 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 21, 0, 11, 0, true);           // UTC: 12:11 AM Local: 1:11 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 22, 0, 24, 0, true);           // UTC: 12:24 AM Local: 1:24 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 10, 14, 7, 0, true);           // UTC: 2:07 PM Local: 3:07 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 26, 5, 43, 0, true);           // UTC: 5:43 AM Local: 6:43 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 24, 23, 4, 0, true);           // UTC: 11:04 PM Local: 12:04 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 2, 1, 6, 15, 0, true);            // UTC: 6:15 AM Local: 7:15 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 23, 21, 59, 0, true);          // UTC: 9:59 PM Local: 10:59 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 14, 2, 39, 0, true);           // UTC: 2:39 AM Local: 3:39 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 22, 12, 10, 0, true);          // UTC: 12:10 PM Local: 1:10 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 20, 6, 4, 0, true);            // UTC: 6:04 AM Local: 7:04 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 15, 0, 36, 0, true);           // UTC: 12:36 AM Local: 1:36 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 3, 21, 31, 0, true);           // UTC: 9:31 PM Local: 10:31 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 14, 19, 2, 0, true);           // UTC: 7:02 PM Local: 8:02 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 5, 15, 43, 0, true);           // UTC: 3:43 PM Local: 4:43 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 14, 18, 12, 0, true);          // UTC: 6:12 PM Local: 7:12 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 5, 20, 54, 0, true);           // UTC: 8:54 PM Local: 9:54 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 1, 1, 36, 0, true);            // UTC: 1:36 AM Local: 2:36 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 24, 20, 46, 0, true);          // UTC: 8:46 PM Local: 9:46 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 12, 4, 49, 0, true);           // UTC: 4:49 AM Local: 5:49 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 7, 9, 49, 0, true);            // UTC: 9:49 AM Local: 10:49 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 20, 20, 48, 0, true);          // UTC: 8:48 PM Local: 9:48 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 28, 16, 6, 0, true);           // UTC: 4:06 PM Local: 5:06 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 10, 5, 26, 0, true);           // UTC: 5:26 AM Local: 6:26 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 12, 23, 25, 0, true);          // UTC: 11:25 PM Local: 12:25 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 3, 22, 37, 0, true);           // UTC: 10:37 PM Local: 11:37 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 9, 17, 34, 0, true);           // UTC: 5:34 PM Local: 6:34 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 15, 13, 19, 0, true);          // UTC: 1:19 PM Local: 2:19 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 31, 20, 2, 0, true);           // UTC: 8:02 PM Local: 9:02 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 14, 7, 3, 0, true);            // UTC: 7:03 AM Local: 8:03 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 5, 9, 57, 0, true);            // UTC: 9:57 AM Local: 10:57 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 3, 16, 20, 44, 0, true);          // UTC: 8:44 PM Local: 9:44 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 15, 2, 18, 0, false);          // UTC: 2:18 AM Local: 2:18 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 21, 22, 51, 0, false);         // UTC: 10:51 PM Local: 10:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 18, 11, 24, 0, false);         // UTC: 11:24 AM Local: 11:24 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 23, 20, 34, 0, false);         // UTC: 8:34 PM Local: 8:34 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 30, 2, 38, 0, false);          // UTC: 2:38 AM Local: 2:38 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 28, 1, 19, 0, false);          // UTC: 1:19 AM Local: 1:19 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 8, 15, 16, 0, false);          // UTC: 3:16 PM Local: 3:16 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 25, 13, 56, 0, false);         // UTC: 1:56 PM Local: 1:56 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 4, 11, 0, 0, true);            // UTC: 11:00 AM Local: 12:00 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 28, 4, 21, 0, false);          // UTC: 4:21 AM Local: 4:21 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 18, 13, 1, 0, false);          // UTC: 1:01 PM Local: 1:01 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 28, 23, 44, 0, false);         // UTC: 11:44 PM Local: 11:44 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 22, 4, 51, 0, false);          // UTC: 4:51 AM Local: 4:51 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 10, 11, 7, 0, false);          // UTC: 11:07 AM Local: 11:07 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 15, 12, 6, 0, false);          // UTC: 12:06 PM Local: 12:06 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 5, 11, 3, 0, false);           // UTC: 11:03 AM Local: 11:03 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 7, 4, 46, 0, false);           // UTC: 4:46 AM Local: 4:46 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 6, 4, 29, 0, false);           // UTC: 4:29 AM Local: 4:29 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 30, 20, 38, 0, false);         // UTC: 8:38 PM Local: 8:38 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 26, 14, 32, 0, false);         // UTC: 2:32 PM Local: 2:32 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 4, 8, 28, 0, true);            // UTC: 8:28 AM Local: 9:28 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 19, 18, 10, 0, false);         // UTC: 6:10 PM Local: 6:10 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 5, 1, 50, 0, false);           // UTC: 1:50 AM Local: 1:50 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 12, 2, 27, 0, false);          // UTC: 2:27 AM Local: 2:27 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 4, 3, 9, 50, 0, true);            // UTC: 9:50 AM Local: 10:50 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 12, 20, 17, 0, false);         // UTC: 8:17 PM Local: 8:17 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 29, 2, 13, 0, false);          // UTC: 2:13 AM Local: 2:13 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 12, 7, 38, 0, false);          // UTC: 7:38 AM Local: 7:38 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 17, 15, 59, 0, false);         // UTC: 3:59 PM Local: 3:59 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 11, 5, 30, 0, false);          // UTC: 5:30 AM Local: 5:30 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 10, 2, 54, 0, false);          // UTC: 2:54 AM Local: 2:54 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 10, 5, 27, 0, false);          // UTC: 5:27 AM Local: 5:27 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 29, 4, 27, 0, false);          // UTC: 4:27 AM Local: 4:27 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 20, 13, 1, 0, false);          // UTC: 1:01 PM Local: 1:01 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 21, 8, 50, 0, false);          // UTC: 8:50 AM Local: 8:50 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 18, 8, 12, 0, false);          // UTC: 8:12 AM Local: 8:12 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 13, 19, 24, 0, false);         // UTC: 7:24 PM Local: 7:24 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 18, 14, 41, 0, false);         // UTC: 2:41 PM Local: 2:41 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 6, 20, 50, 0, false);          // UTC: 8:50 PM Local: 8:50 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 28, 7, 5, 0, false);           // UTC: 7:05 AM Local: 7:05 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 31, 14, 28, 0, false);         // UTC: 2:28 PM Local: 2:28 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 12, 23, 29, 0, false);         // UTC: 11:29 PM Local: 11:29 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 4, 18, 54, 0, false);          // UTC: 6:54 PM Local: 6:54 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 26, 9, 39, 0, false);          // UTC: 9:39 AM Local: 9:39 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 4, 8, 13, 0, false);           // UTC: 8:13 AM Local: 8:13 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 7, 21, 41, 0, false);          // UTC: 9:41 PM Local: 9:41 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 23, 3, 4, 0, false);           // UTC: 3:04 AM Local: 3:04 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 8, 0, 41, 0, false);           // UTC: 12:41 AM Local: 12:41 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 20, 10, 2, 0, false);          // UTC: 10:02 AM Local: 10:02 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 5, 30, 14, 48, 0, false);         // UTC: 2:48 PM Local: 2:48 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 4, 17, 52, 0, false);          // UTC: 5:52 PM Local: 5:52 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 11, 16, 32, 0, false);         // UTC: 4:32 PM Local: 4:32 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 20, 16, 59, 0, false);         // UTC: 4:59 PM Local: 4:59 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 4, 6, 19, 0, false);           // UTC: 6:19 AM Local: 6:19 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 26, 19, 51, 0, false);         // UTC: 7:51 PM Local: 7:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 15, 0, 22, 0, false);          // UTC: 12:22 AM Local: 12:22 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 24, 19, 40, 0, false);         // UTC: 7:40 PM Local: 7:40 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 28, 14, 58, 0, false);         // UTC: 2:58 PM Local: 2:58 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 30, 4, 27, 0, false);          // UTC: 4:27 AM Local: 4:27 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 1, 7, 32, 0, false);           // UTC: 7:32 AM Local: 7:32 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 17, 14, 51, 0, false);         // UTC: 2:51 PM Local: 2:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 7, 14, 51, 0, false);          // UTC: 2:51 PM Local: 2:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 5, 8, 13, 0, false);           // UTC: 8:13 AM Local: 8:13 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 30, 4, 52, 0, false);          // UTC: 4:52 AM Local: 4:52 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 8, 4, 9, 0, false);            // UTC: 4:09 AM Local: 4:09 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 10, 11, 51, 0, false);         // UTC: 11:51 AM Local: 11:51 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 24, 5, 36, 0, false);          // UTC: 5:36 AM Local: 5:36 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 13, 16, 31, 0, false);         // UTC: 4:31 PM Local: 4:31 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 30, 0, 48, 0, false);          // UTC: 12:48 AM Local: 12:48 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 18, 3, 54, 0, false);          // UTC: 3:54 AM Local: 3:54 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 8, 13, 36, 0, false);          // UTC: 1:36 PM Local: 1:36 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 27, 2, 28, 0, false);          // UTC: 2:28 AM Local: 2:28 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 4, 11, 10, 0, false);          // UTC: 11:10 AM Local: 11:10 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 12, 14, 14, 0, false);         // UTC: 2:14 PM Local: 2:14 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 6, 30, 16, 37, 0, false);         // UTC: 4:37 PM Local: 4:37 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 31, 18, 42, 0, false);         // UTC: 6:42 PM Local: 6:42 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 25, 15, 11, 0, false);         // UTC: 3:11 PM Local: 3:11 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 4, 11, 2, 0, false);           // UTC: 11:02 AM Local: 11:02 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 19, 1, 24, 0, false);          // UTC: 1:24 AM Local: 1:24 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 21, 0, 33, 0, false);          // UTC: 12:33 AM Local: 12:33 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 28, 4, 0, 0, false);           // UTC: 4:00 AM Local: 4:00 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 22, 5, 18, 0, false);          // UTC: 5:18 AM Local: 5:18 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 23, 8, 18, 0, false);          // UTC: 8:18 AM Local: 8:18 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 11, 19, 34, 0, false);         // UTC: 7:34 PM Local: 7:34 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 24, 4, 44, 0, false);          // UTC: 4:44 AM Local: 4:44 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 8, 17, 17, 0, false);          // UTC: 5:17 PM Local: 5:17 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 11, 21, 24, 0, false);         // UTC: 9:24 PM Local: 9:24 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 24, 16, 0, 0, false);          // UTC: 4:00 PM Local: 4:00 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 12, 0, 38, 0, false);          // UTC: 12:38 AM Local: 12:38 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 25, 22, 58, 0, false);         // UTC: 10:58 PM Local: 10:58 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 29, 22, 26, 0, false);         // UTC: 10:26 PM Local: 10:26 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 15, 11, 6, 0, false);          // UTC: 11:06 AM Local: 11:06 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 20, 16, 18, 0, false);         // UTC: 4:18 PM Local: 4:18 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 4, 10, 20, 0, false);          // UTC: 10:20 AM Local: 10:20 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 2, 16, 29, 0, false);          // UTC: 4:29 PM Local: 4:29 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 15, 22, 18, 0, false);         // UTC: 10:18 PM Local: 10:18 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 13, 7, 5, 0, false);           // UTC: 7:05 AM Local: 7:05 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 3, 7, 1, 0, false);            // UTC: 7:01 AM Local: 7:01 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 1, 4, 51, 0, false);           // UTC: 4:51 AM Local: 4:51 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 7, 3, 1, 31, 0, false);           // UTC: 1:31 AM Local: 1:31 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 23, 22, 29, 0, false);         // UTC: 10:29 PM Local: 10:29 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 21, 18, 19, 0, false);         // UTC: 6:19 PM Local: 6:19 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 30, 12, 51, 0, false);         // UTC: 12:51 PM Local: 12:51 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 14, 12, 52, 0, false);         // UTC: 12:52 PM Local: 12:52 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 14, 21, 58, 0, false);         // UTC: 9:58 PM Local: 9:58 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 27, 5, 9, 0, false);           // UTC: 5:09 AM Local: 5:09 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 28, 19, 6, 0, false);          // UTC: 7:06 PM Local: 7:06 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 19, 6, 34, 0, false);          // UTC: 6:34 AM Local: 6:34 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 30, 18, 53, 0, false);         // UTC: 6:53 PM Local: 6:53 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 3, 19, 15, 0, false);          // UTC: 7:15 PM Local: 7:15 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 16, 11, 15, 0, false);         // UTC: 11:15 AM Local: 11:15 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 8, 22, 5, 0, false);           // UTC: 10:05 PM Local: 10:05 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 2, 22, 4, 0, false);           // UTC: 10:04 PM Local: 10:04 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 14, 7, 47, 0, false);          // UTC: 7:47 AM Local: 7:47 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 13, 12, 1, 0, false);          // UTC: 12:01 PM Local: 12:01 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 31, 7, 20, 0, false);          // UTC: 7:20 AM Local: 7:20 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 17, 21, 27, 0, false);         // UTC: 9:27 PM Local: 9:27 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 26, 4, 9, 0, false);           // UTC: 4:09 AM Local: 4:09 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 18, 2, 29, 0, false);          // UTC: 2:29 AM Local: 2:29 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 14, 19, 14, 0, false);         // UTC: 7:14 PM Local: 7:14 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 1, 17, 9, 0, false);           // UTC: 5:09 PM Local: 5:09 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 30, 3, 7, 0, false);           // UTC: 3:07 AM Local: 3:07 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 16, 14, 5, 0, false);          // UTC: 2:05 PM Local: 2:05 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 3, 19, 31, 0, false);          // UTC: 7:31 PM Local: 7:31 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 8, 2, 14, 0, 0, false);           // UTC: 2:00 PM Local: 2:00 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 9, 5, 49, 0, false);           // UTC: 5:49 AM Local: 5:49 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 4, 7, 38, 0, false);           // UTC: 7:38 AM Local: 7:38 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 24, 4, 58, 0, false);          // UTC: 4:58 AM Local: 4:58 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 4, 23, 33, 0, false);          // UTC: 11:33 PM Local: 11:33 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 28, 9, 19, 0, true);           // UTC: 9:19 AM Local: 10:19 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 22, 23, 33, 0, false);         // UTC: 11:33 PM Local: 11:33 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 16, 7, 15, 0, false);          // UTC: 7:15 AM Local: 7:15 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 30, 2, 0, 0, true);            // UTC: 2:00 AM Local: 3:00 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 19, 13, 18, 0, false);         // UTC: 1:18 PM Local: 1:18 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 16, 22, 38, 0, false);         // UTC: 10:38 PM Local: 10:38 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 16, 14, 35, 0, false);         // UTC: 2:35 PM Local: 2:35 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 7, 21, 54, 0, false);          // UTC: 9:54 PM Local: 9:54 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 21, 19, 36, 0, false);         // UTC: 7:36 PM Local: 7:36 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 19, 11, 59, 0, false);         // UTC: 11:59 AM Local: 11:59 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 26, 21, 53, 0, true);          // UTC: 9:53 PM Local: 10:53 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 11, 8, 38, 0, false);          // UTC: 8:38 AM Local: 8:38 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 16, 10, 40, 0, false);         // UTC: 10:40 AM Local: 10:40 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 27, 18, 35, 0, true);          // UTC: 6:35 PM Local: 7:35 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 16, 1, 57, 0, false);          // UTC: 1:57 AM Local: 1:57 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 30, 4, 12, 0, true);           // UTC: 4:12 AM Local: 5:12 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 19, 10, 34, 0, false);         // UTC: 10:34 AM Local: 10:34 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 3, 10, 19, 0, false);          // UTC: 10:19 AM Local: 10:19 PM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 6, 12, 19, 0, false);          // UTC: 12:19 PM Local: 12:19 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 17, 17, 7, 0, false);          // UTC: 5:07 PM Local: 5:07 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 9, 3, 17, 58, 0, false);          // UTC: 5:58 PM Local: 5:58 AM Offset: 12:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 13, 7, 40, 0, true);          // UTC: 7:40 AM Local: 8:40 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 10, 15, 29, 0, true);         // UTC: 3:29 PM Local: 4:29 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 12, 19, 51, 0, true);         // UTC: 7:51 PM Local: 8:51 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 30, 18, 1, 0, true);          // UTC: 6:01 PM Local: 7:01 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 6, 2, 11, 0, true);           // UTC: 2:11 AM Local: 3:11 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 27, 12, 1, 0, true);          // UTC: 12:01 PM Local: 1:01 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 24, 12, 11, 0, true);         // UTC: 12:11 PM Local: 1:11 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 3, 20, 30, 0, true);          // UTC: 8:30 PM Local: 9:30 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 12, 19, 27, 0, true);         // UTC: 7:27 PM Local: 8:27 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 27, 18, 52, 0, true);         // UTC: 6:52 PM Local: 7:52 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 28, 13, 11, 0, true);         // UTC: 1:11 PM Local: 2:11 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 15, 1, 50, 0, true);          // UTC: 1:50 AM Local: 2:50 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 4, 8, 33, 0, true);           // UTC: 8:33 AM Local: 9:33 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 10, 2, 55, 0, true);          // UTC: 2:55 AM Local: 3:55 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 29, 12, 52, 0, true);         // UTC: 12:52 PM Local: 1:52 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 8, 11, 21, 0, true);          // UTC: 11:21 AM Local: 12:21 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 25, 3, 15, 0, true);          // UTC: 3:15 AM Local: 4:15 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 27, 1, 52, 0, true);          // UTC: 1:52 AM Local: 2:52 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 6, 1, 1, 0, true);            // UTC: 1:01 AM Local: 2:01 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 7, 14, 39, 0, true);          // UTC: 2:39 PM Local: 3:39 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 12, 2, 7, 0, true);           // UTC: 2:07 AM Local: 3:07 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 9, 8, 44, 0, true);           // UTC: 8:44 AM Local: 9:44 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 23, 11, 4, 0, true);          // UTC: 11:04 AM Local: 12:04 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 6, 14, 44, 0, true);          // UTC: 2:44 PM Local: 3:44 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 10, 29, 5, 35, 0, true);          // UTC: 5:35 AM Local: 6:35 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 3, 9, 26, 0, true);           // UTC: 9:26 AM Local: 10:26 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 6, 11, 3, 0, true);           // UTC: 11:03 AM Local: 12:03 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 24, 4, 30, 0, true);          // UTC: 4:30 AM Local: 5:30 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 21, 1, 48, 0, true);          // UTC: 1:48 AM Local: 2:48 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 21, 14, 58, 0, true);         // UTC: 2:58 PM Local: 3:58 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 2, 4, 35, 0, true);           // UTC: 4:35 AM Local: 5:35 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 4, 9, 4, 0, true);            // UTC: 9:04 AM Local: 10:04 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 24, 1, 31, 0, true);          // UTC: 1:31 AM Local: 2:31 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 30, 7, 6, 0, true);           // UTC: 7:06 AM Local: 8:06 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 23, 15, 52, 0, true);         // UTC: 3:52 PM Local: 4:52 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 6, 6, 53, 0, true);           // UTC: 6:53 AM Local: 7:53 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 13, 19, 50, 0, true);         // UTC: 7:50 PM Local: 8:50 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 22, 18, 48, 0, true);         // UTC: 6:48 PM Local: 7:48 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 7, 10, 34, 0, true);          // UTC: 10:34 AM Local: 11:34 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 26, 12, 52, 0, true);         // UTC: 12:52 PM Local: 1:52 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 29, 8, 1, 0, true);           // UTC: 8:01 AM Local: 9:01 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 28, 1, 4, 0, true);           // UTC: 1:04 AM Local: 2:04 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 17, 0, 3, 0, true);           // UTC: 12:03 AM Local: 1:03 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 14, 9, 29, 0, true);          // UTC: 9:29 AM Local: 10:29 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 18, 5, 27, 0, true);          // UTC: 5:27 AM Local: 6:27 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 25, 19, 9, 0, true);          // UTC: 7:09 PM Local: 8:09 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 1, 14, 11, 0, true);          // UTC: 2:11 PM Local: 3:11 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 24, 16, 29, 0, true);         // UTC: 4:29 PM Local: 5:29 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 25, 5, 48, 0, true);          // UTC: 5:48 AM Local: 6:48 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 11, 28, 11, 32, 0, true);         // UTC: 11:32 AM Local: 12:32 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 30, 14, 20, 0, true);         // UTC: 2:20 PM Local: 3:20 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 29, 20, 7, 0, true);          // UTC: 8:07 PM Local: 9:07 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 5, 21, 39, 0, true);          // UTC: 9:39 PM Local: 10:39 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 31, 14, 40, 0, true);         // UTC: 2:40 PM Local: 3:40 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 19, 13, 43, 0, true);         // UTC: 1:43 PM Local: 2:43 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 4, 1, 52, 0, true);           // UTC: 1:52 AM Local: 2:52 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 4, 7, 17, 0, true);           // UTC: 7:17 AM Local: 8:17 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 3, 23, 39, 0, true);          // UTC: 11:39 PM Local: 12:39 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 12, 4, 47, 0, true);          // UTC: 4:47 AM Local: 5:47 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 2, 20, 35, 0, true);          // UTC: 8:35 PM Local: 9:35 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 28, 22, 17, 0, true);         // UTC: 10:17 PM Local: 11:17 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 25, 12, 5, 0, true);          // UTC: 12:05 PM Local: 1:05 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 31, 2, 8, 0, true);           // UTC: 2:08 AM Local: 3:08 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 5, 11, 50, 0, true);          // UTC: 11:50 AM Local: 12:50 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 6, 5, 45, 0, true);           // UTC: 5:45 AM Local: 6:45 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 11, 3, 37, 0, true);          // UTC: 3:37 AM Local: 4:37 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 4, 5, 40, 0, true);           // UTC: 5:40 AM Local: 6:40 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 19, 11, 3, 0, true);          // UTC: 11:03 AM Local: 12:03 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 27, 19, 9, 0, true);          // UTC: 7:09 PM Local: 8:09 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 1, 21, 50, 0, true);          // UTC: 9:50 PM Local: 10:50 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 4, 11, 38, 0, true);          // UTC: 11:38 AM Local: 12:38 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 20, 10, 43, 0, true);         // UTC: 10:43 AM Local: 11:43 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 21, 3, 59, 0, true);          // UTC: 3:59 AM Local: 4:59 PM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 14, 14, 55, 0, true);         // UTC: 2:55 PM Local: 3:55 AM Offset: 13:00:00
+	testCount++; failedCount += test(timeManager, 21, 2020, 12, 17, 23, 54, 0, true);         // UTC: 11:54 PM Local: 12:54 PM Offset: 13:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
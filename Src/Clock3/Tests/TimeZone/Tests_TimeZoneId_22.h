@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_22_H
+#define TEST_TIMEZONEID_22_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_22_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 31, 4, 15, 0, false);          // UTC: 4:15 AM Local: 12:45 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 1, 19, 28, 0, false);          // UTC: 7:28 PM Local: 3:58 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 6, 22, 7, 0, false);           // UTC: 10:07 PM Local: 6:37 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 24, 20, 56, 0, false);         // UTC: 8:56 PM Local: 5:26 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 12, 2, 14, 0, false);          // UTC: 2:14 AM Local: 10:44 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 9, 1, 20, 0, false);           // UTC: 1:20 AM Local: 9:50 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 20, 5, 59, 0, false);          // UTC: 5:59 AM Local: 2:29 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 18, 21, 46, 0, false);         // UTC: 9:46 PM Local: 6:16 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 30, 13, 45, 0, false);         // UTC: 1:45 PM Local: 10:15 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 29, 1, 36, 0, false);          // UTC: 1:36 AM Local: 10:06 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 29, 0, 37, 0, false);          // UTC: 12:37 AM Local: 9:07 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 9, 9, 26, 0, false);           // UTC: 9:26 AM Local: 5:56 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 7, 5, 54, 0, false);           // UTC: 5:54 AM Local: 2:24 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 4, 18, 33, 0, false);          // UTC: 6:33 PM Local: 3:03 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 31, 23, 49, 0, false);         // UTC: 11:49 PM Local: 8:19 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 31, 18, 3, 0, false);          // UTC: 6:03 PM Local: 2:33 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 23, 10, 39, 0, false);         // UTC: 10:39 AM Local: 7:09 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 11, 8, 11, 0, false);          // UTC: 8:11 AM Local: 4:41 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 31, 12, 19, 0, false);         // UTC: 12:19 PM Local: 8:49 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 29, 20, 32, 0, false);         // UTC: 8:32 PM Local: 5:02 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 5, 8, 52, 0, false);           // UTC: 8:52 AM Local: 5:22 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 9, 21, 44, 0, false);          // UTC: 9:44 PM Local: 6:14 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 6, 13, 3, 0, false);           // UTC: 1:03 PM Local: 9:33 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 11, 17, 57, 0, false);         // UTC: 5:57 PM Local: 2:27 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 1, 2, 13, 59, 0, false);          // UTC: 1:59 PM Local: 10:29 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 9, 16, 18, 0, false);          // UTC: 4:18 PM Local: 12:48 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 17, 13, 25, 0, false);         // UTC: 1:25 PM Local: 9:55 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 22, 5, 19, 0, false);          // UTC: 5:19 AM Local: 1:49 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 19, 11, 25, 0, false);         // UTC: 11:25 AM Local: 7:55 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 19, 0, 19, 0, false);          // UTC: 12:19 AM Local: 8:49 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 19, 19, 35, 0, false);         // UTC: 7:35 PM Local: 4:05 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 18, 16, 27, 0, false);         // UTC: 4:27 PM Local: 12:57 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 25, 21, 57, 0, false);         // UTC: 9:57 PM Local: 6:27 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 17, 13, 5, 0, false);          // UTC: 1:05 PM Local: 9:35 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 3, 14, 22, 0, false);          // UTC: 2:22 PM Local: 10:52 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 4, 13, 49, 0, false);          // UTC: 1:49 PM Local: 10:19 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 13, 1, 59, 0, false);          // UTC: 1:59 AM Local: 10:29 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 27, 6, 32, 0, false);          // UTC: 6:32 AM Local: 3:02 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 8, 12, 0, 0, false);           // UTC: 12:00 PM Local: 8:30 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 4, 14, 57, 0, false);          // UTC: 2:57 PM Local: 11:27 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 7, 5, 1, 0, false);            // UTC: 5:01 AM Local: 1:31 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 18, 12, 22, 0, false);         // UTC: 12:22 PM Local: 8:52 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 6, 10, 58, 0, false);          // UTC: 10:58 AM Local: 7:28 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 12, 20, 12, 0, false);         // UTC: 8:12 PM Local: 4:42 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 15, 1, 4, 0, false);           // UTC: 1:04 AM Local: 9:34 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 18, 4, 50, 0, false);          // UTC: 4:50 AM Local: 1:20 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 25, 20, 47, 0, false);         // UTC: 8:47 PM Local: 5:17 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 7, 20, 44, 0, false);          // UTC: 8:44 PM Local: 5:14 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 4, 1, 12, 0, false);           // UTC: 1:12 AM Local: 9:42 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 2, 14, 3, 52, 0, false);          // UTC: 3:52 AM Local: 12:22 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 5, 18, 29, 0, false);          // UTC: 6:29 PM Local: 2:59 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 2, 3, 31, 0, false);           // UTC: 3:31 AM Local: 12:01 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 23, 16, 8, 0, true);           // UTC: 4:08 PM Local: 1:38 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 19, 9, 43, 0, true);           // UTC: 9:43 AM Local: 7:13 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 24, 15, 30, 0, true);          // UTC: 3:30 PM Local: 1:00 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 24, 2, 41, 0, true);           // UTC: 2:41 AM Local: 12:11 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 23, 11, 50, 0, true);          // UTC: 11:50 AM Local: 9:20 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 4, 19, 16, 0, false);          // UTC: 7:16 PM Local: 3:46 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 31, 3, 1, 0, true);            // UTC: 3:01 AM Local: 12:31 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 6, 16, 22, 0, false);          // UTC: 4:22 PM Local: 12:52 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 21, 2, 21, 0, true);           // UTC: 2:21 AM Local: 11:51 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 4, 5, 40, 0, false);           // UTC: 5:40 AM Local: 2:10 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 23, 19, 27, 0, true);          // UTC: 7:27 PM Local: 4:57 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 23, 8, 11, 0, true);           // UTC: 8:11 AM Local: 5:41 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 2, 2, 12, 0, false);           // UTC: 2:12 AM Local: 10:42 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 12, 21, 7, 0, true);           // UTC: 9:07 PM Local: 6:37 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 7, 17, 16, 0, false);          // UTC: 5:16 PM Local: 1:46 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 16, 2, 11, 0, true);           // UTC: 2:11 AM Local: 11:41 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 1, 8, 48, 0, false);           // UTC: 8:48 AM Local: 5:18 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 4, 18, 30, 0, false);          // UTC: 6:30 PM Local: 3:00 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 20, 6, 25, 0, true);           // UTC: 6:25 AM Local: 3:55 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 12, 3, 47, 0, true);           // UTC: 3:47 AM Local: 1:17 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 30, 16, 53, 0, true);          // UTC: 4:53 PM Local: 2:23 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 6, 1, 15, 0, false);           // UTC: 1:15 AM Local: 9:45 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 3, 13, 19, 2, 0, true);           // UTC: 7:02 PM Local: 4:32 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 7, 6, 48, 0, true);            // UTC: 6:48 AM Local: 4:18 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 16, 20, 24, 0, true);          // UTC: 8:24 PM Local: 5:54 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 2, 22, 45, 0, true);           // UTC: 10:45 PM Local: 8:15 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 14, 14, 16, 0, true);          // UTC: 2:16 PM Local: 11:46 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 8, 7, 7, 0, true);             // UTC: 7:07 AM Local: 4:37 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 9, 2, 59, 0, true);            // UTC: 2:59 AM Local: 12:29 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 22, 18, 10, 0, true);          // UTC: 6:10 PM Local: 3:40 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 6, 20, 20, 0, true);           // UTC: 8:20 PM Local: 5:50 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 2, 0, 31, 0, true);            // UTC: 12:31 AM Local: 10:01 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 6, 19, 17, 0, true);           // UTC: 7:17 PM Local: 4:47 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 2, 15, 44, 0, true);           // UTC: 3:44 PM Local: 1:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 1, 8, 49, 0, true);            // UTC: 8:49 AM Local: 6:19 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 25, 0, 13, 0, true);           // UTC: 12:13 AM Local: 9:43 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 21, 14, 54, 0, true);          // UTC: 2:54 PM Local: 12:24 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 22, 7, 28, 0, true);           // UTC: 7:28 AM Local: 4:58 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 18, 13, 8, 0, true);           // UTC: 1:08 PM Local: 10:38 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 12, 10, 16, 0, true);          // UTC: 10:16 AM Local: 7:46 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 28, 22, 0, 0, true);           // UTC: 10:00 PM Local: 7:30 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 23, 12, 38, 0, true);          // UTC: 12:38 PM Local: 10:08 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 21, 3, 11, 0, true);           // UTC: 3:11 AM Local: 12:41 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 28, 19, 35, 0, true);          // UTC: 7:35 PM Local: 5:05 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 21, 11, 17, 0, true);          // UTC: 11:17 AM Local: 8:47 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 28, 16, 16, 0, true);          // UTC: 4:16 PM Local: 1:46 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 7, 8, 17, 0, true);            // UTC: 8:17 AM Local: 5:47 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 4, 17, 5, 22, 0, true);           // UTC: 5:22 AM Local: 2:52 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 27, 16, 31, 0, true);          // UTC: 4:31 PM Local: 2:01 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 23, 15, 52, 0, true);          // UTC: 3:52 PM Local: 1:22 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 5, 17, 12, 0, true);           // UTC: 5:12 PM Local: 2:42 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 16, 12, 21, 0, true);          // UTC: 12:21 PM Local: 9:51 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 28, 2, 24, 0, true);           // UTC: 2:24 AM Local: 11:54 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 22, 20, 33, 0, true);          // UTC: 8:33 PM Local: 6:03 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 7, 22, 10, 0, true);           // UTC: 10:10 PM Local: 7:40 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 3, 1, 58, 0, true);            // UTC: 1:58 AM Local: 11:28 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 13, 10, 15, 0, true);          // UTC: 10:15 AM Local: 7:45 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 2, 16, 33, 0, true);           // UTC: 4:33 PM Local: 2:03 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 28, 4, 12, 0, true);           // UTC: 4:12 AM Local: 1:42 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 18, 11, 55, 0, true);          // UTC: 11:55 AM Local: 9:25 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 31, 19, 0, 0, true);           // UTC: 7:00 PM Local: 4:30 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 17, 10, 49, 0, true);          // UTC: 10:49 AM Local: 8:19 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 25, 0, 7, 0, true);            // UTC: 12:07 AM Local: 9:37 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 31, 16, 43, 0, true);          // UTC: 4:43 PM Local: 2:13 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 2, 20, 52, 0, true);           // UTC: 8:52 PM Local: 6:22 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 3, 3, 36, 0, true);            // UTC: 3:36 AM Local: 1:06 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 3, 5, 16, 0, true);            // UTC: 5:16 AM Local: 2:46 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 17, 9, 20, 0, true);           // UTC: 9:20 AM Local: 6:50 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 30, 13, 36, 0, true);          // UTC: 1:36 PM Local: 11:06 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 20, 16, 47, 0, true);          // UTC: 4:47 PM Local: 2:17 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 18, 10, 20, 0, true);          // UTC: 10:20 AM Local: 7:50 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 22, 23, 3, 0, true);           // UTC: 11:03 PM Local: 8:33 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 5, 29, 7, 51, 0, true);           // UTC: 7:51 AM Local: 5:21 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 17, 20, 20, 0, true);          // UTC: 8:20 PM Local: 5:50 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 22, 9, 0, 0, true);            // UTC: 9:00 AM Local: 6:30 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 8, 7, 3, 0, true);             // UTC: 7:03 AM Local: 4:33 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 4, 10, 19, 0, true);           // UTC: 10:19 AM Local: 7:49 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 29, 0, 59, 0, true);           // UTC: 12:59 AM Local: 10:29 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 11, 3, 6, 0, true);            // UTC: 3:06 AM Local: 12:36 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 30, 14, 52, 0, true);          // UTC: 2:52 PM Local: 12:22 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 11, 5, 10, 0, true);           // UTC: 5:10 AM Local: 2:40 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 16, 9, 26, 0, true);           // UTC: 9:26 AM Local: 6:56 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 13, 11, 8, 0, true);           // UTC: 11:08 AM Local: 8:38 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 27, 12, 19, 0, true);          // UTC: 12:19 PM Local: 9:49 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 8, 17, 14, 0, true);           // UTC: 5:14 PM Local: 2:44 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 29, 19, 58, 0, true);          // UTC: 7:58 PM Local: 5:28 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 12, 1, 29, 0, true);           // UTC: 1:29 AM Local: 10:59 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 9, 16, 34, 0, true);           // UTC: 4:34 PM Local: 2:04 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 7, 2, 8, 0, true);             // UTC: 2:08 AM Local: 11:38 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 27, 7, 48, 0, true);           // UTC: 7:48 AM Local: 5:18 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 10, 17, 8, 0, true);           // UTC: 5:08 PM Local: 2:38 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 15, 1, 16, 0, true);           // UTC: 1:16 AM Local: 10:46 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 8, 4, 7, 0, true);             // UTC: 4:07 AM Local: 1:37 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 18, 15, 20, 0, true);          // UTC: 3:20 PM Local: 12:50 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 26, 5, 32, 0, true);           // UTC: 5:32 AM Local: 3:02 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 13, 2, 43, 0, true);           // UTC: 2:43 AM Local: 12:13 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 11, 6, 24, 0, true);           // UTC: 6:24 AM Local: 3:54 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 6, 5, 21, 37, 0, true);           // UTC: 9:37 PM Local: 7:07 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 29, 14, 27, 0, true);          // UTC: 2:27 PM Local: 11:57 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 21, 17, 3, 0, true);           // UTC: 5:03 PM Local: 2:33 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 13, 21, 29, 0, true);          // UTC: 9:29 PM Local: 6:59 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 26, 21, 28, 0, true);          // UTC: 9:28 PM Local: 6:58 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 12, 6, 18, 0, true);           // UTC: 6:18 AM Local: 3:48 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 23, 0, 59, 0, true);           // UTC: 12:59 AM Local: 10:29 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 3, 3, 9, 0, true);             // UTC: 3:09 AM Local: 12:39 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 27, 14, 48, 0, true);          // UTC: 2:48 PM Local: 12:18 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 25, 2, 13, 0, true);           // UTC: 2:13 AM Local: 11:43 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 19, 15, 50, 0, true);          // UTC: 3:50 PM Local: 1:20 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 21, 8, 40, 0, true);           // UTC: 8:40 AM Local: 6:10 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 5, 0, 48, 0, true);            // UTC: 12:48 AM Local: 10:18 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 30, 5, 37, 0, true);           // UTC: 5:37 AM Local: 3:07 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 26, 9, 34, 0, true);           // UTC: 9:34 AM Local: 7:04 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 8, 18, 44, 0, true);           // UTC: 6:44 PM Local: 4:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 7, 10, 47, 0, true);           // UTC: 10:47 AM Local: 8:17 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 13, 14, 35, 0, true);          // UTC: 2:35 PM Local: 12:05 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 23, 5, 49, 0, true);           // UTC: 5:49 AM Local: 3:19 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 13, 21, 58, 0, true);          // UTC: 9:58 PM Local: 7:28 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 15, 17, 51, 0, true);          // UTC: 5:51 PM Local: 3:21 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 27, 13, 16, 0, true);          // UTC: 1:16 PM Local: 10:46 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 25, 6, 50, 0, true);           // UTC: 6:50 AM Local: 4:20 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 8, 7, 41, 0, true);            // UTC: 7:41 AM Local: 5:11 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 17, 8, 43, 0, true);           // UTC: 8:43 AM Local: 6:13 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 7, 10, 18, 2, 0, true);           // UTC: 6:02 PM Local: 3:32 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 20, 7, 39, 0, true);           // UTC: 7:39 AM Local: 5:09 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 18, 7, 22, 0, true);           // UTC: 7:22 AM Local: 4:52 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 15, 11, 7, 0, true);           // UTC: 11:07 AM Local: 8:37 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 19, 23, 14, 0, true);          // UTC: 11:14 PM Local: 8:44 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 12, 13, 23, 0, true);          // UTC: 1:23 PM Local: 10:53 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 5, 23, 8, 0, true);            // UTC: 11:08 PM Local: 8:38 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 2, 17, 38, 0, true);           // UTC: 5:38 PM Local: 3:08 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 17, 9, 41, 0, true);           // UTC: 9:41 AM Local: 7:11 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 25, 3, 8, 0, true);            // UTC: 3:08 AM Local: 12:38 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 26, 21, 32, 0, true);          // UTC: 9:32 PM Local: 7:02 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 23, 7, 25, 0, true);           // UTC: 7:25 AM Local: 4:55 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 5, 3, 23, 0, true);            // UTC: 3:23 AM Local: 12:53 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 17, 20, 47, 0, true);          // UTC: 8:47 PM Local: 6:17 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 9, 0, 0, 0, true);             // UTC: 12:00 AM Local: 9:30 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 6, 14, 51, 0, true);           // UTC: 2:51 PM Local: 12:21 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 11, 5, 30, 0, true);           // UTC: 5:30 AM Local: 3:00 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 31, 5, 32, 0, true);           // UTC: 5:32 AM Local: 3:02 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 20, 5, 45, 0, true);           // UTC: 5:45 AM Local: 3:15 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 4, 8, 23, 0, true);            // UTC: 8:23 AM Local: 5:53 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 4, 15, 10, 0, true);           // UTC: 3:10 PM Local: 12:40 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 6, 22, 5, 0, true);            // UTC: 10:05 PM Local: 7:35 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 23, 16, 42, 0, true);          // UTC: 4:42 PM Local: 2:12 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 9, 21, 28, 0, true);           // UTC: 9:28 PM Local: 6:58 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 18, 14, 20, 0, true);          // UTC: 2:20 PM Local: 11:50 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 8, 23, 18, 20, 0, true);          // UTC: 6:20 PM Local: 3:50 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 8, 5, 47, 0, true);            // UTC: 5:47 AM Local: 3:17 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 28, 20, 3, 0, true);           // UTC: 8:03 PM Local: 5:33 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 20, 3, 23, 0, true);           // UTC: 3:23 AM Local: 12:53 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 3, 0, 52, 0, true);            // UTC: 12:52 AM Local: 10:22 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 17, 17, 59, 0, true);          // UTC: 5:59 PM Local: 3:29 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 14, 20, 21, 0, true);          // UTC: 8:21 PM Local: 5:51 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 14, 23, 6, 0, true);           // UTC: 11:06 PM Local: 8:36 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 8, 13, 16, 0, true);           // UTC: 1:16 PM Local: 10:46 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 2, 18, 21, 0, true);           // UTC: 6:21 PM Local: 3:51 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 20, 17, 17, 0, true);          // UTC: 5:17 PM Local: 2:47 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 5, 23, 57, 0, true);           // UTC: 11:57 PM Local: 9:27 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 11, 12, 32, 0, true);          // UTC: 12:32 PM Local: 10:02 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 4, 0, 44, 0, true);            // UTC: 12:44 AM Local: 10:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 12, 17, 4, 0, true);           // UTC: 5:04 PM Local: 2:34 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 6, 14, 52, 0, true);           // UTC: 2:52 PM Local: 12:22 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 30, 0, 28, 0, true);           // UTC: 12:28 AM Local: 9:58 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 22, 12, 27, 0, true);          // UTC: 12:27 PM Local: 9:57 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 3, 11, 39, 0, true);           // UTC: 11:39 AM Local: 9:09 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 1, 15, 24, 0, true);           // UTC: 3:24 PM Local: 12:54 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 7, 9, 7, 0, true);             // UTC: 9:07 AM Local: 6:37 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 20, 17, 50, 0, true);          // UTC: 5:50 PM Local: 3:20 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 29, 5, 59, 0, true);           // UTC: 5:59 AM Local: 3:29 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 10, 20, 7, 0, true);           // UTC: 8:07 PM Local: 5:37 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 2, 14, 52, 0, true);           // UTC: 2:52 PM Local: 12:22 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 9, 7, 10, 25, 0, true);           // UTC: 10:25 AM Local: 7:55 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 27, 5, 29, 0, true);          // UTC: 5:29 AM Local: 2:59 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 8, 5, 4, 0, true);            // UTC: 5:04 AM Local: 2:34 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 1, 3, 12, 0, true);           // UTC: 3:12 AM Local: 12:42 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 9, 13, 48, 0, true);          // UTC: 1:48 PM Local: 11:18 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 21, 15, 40, 0, true);         // UTC: 3:40 PM Local: 1:10 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 9, 9, 38, 0, true);           // UTC: 9:38 AM Local: 7:08 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 22, 11, 46, 0, true);         // UTC: 11:46 AM Local: 9:16 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 9, 11, 19, 0, true);          // UTC: 11:19 AM Local: 8:49 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 3, 17, 30, 0, true);          // UTC: 5:30 PM Local: 3:00 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 8, 4, 12, 0, true);           // UTC: 4:12 AM Local: 1:42 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 14, 12, 9, 0, true);          // UTC: 12:09 PM Local: 9:39 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 3, 8, 48, 0, true);           // UTC: 8:48 AM Local: 6:18 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 29, 11, 47, 0, true);         // UTC: 11:47 AM Local: 9:17 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 30, 0, 51, 0, true);          // UTC: 12:51 AM Local: 10:21 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 29, 14, 33, 0, true);         // UTC: 2:33 PM Local: 12:03 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 20, 16, 30, 0, true);         // UTC: 4:30 PM Local: 2:00 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 7, 0, 13, 0, true);           // UTC: 12:13 AM Local: 9:43 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 5, 23, 19, 0, true);          // UTC: 11:19 PM Local: 8:49 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 2, 0, 53, 0, true);           // UTC: 12:53 AM Local: 10:23 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 16, 3, 35, 0, true);          // UTC: 3:35 AM Local: 1:05 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 12, 7, 7, 0, true);           // UTC: 7:07 AM Local: 4:37 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 21, 7, 22, 0, true);          // UTC: 7:22 AM Local: 4:52 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 31, 13, 10, 0, true);         // UTC: 1:10 PM Local: 10:40 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 5, 8, 42, 0, true);           // UTC: 8:42 AM Local: 6:12 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 10, 30, 7, 50, 0, true);          // UTC: 7:50 AM Local: 5:20 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 29, 19, 30, 0, false);        // UTC: 7:30 PM Local: 4:00 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 22, 13, 7, 0, false);         // UTC: 1:07 PM Local: 9:37 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 25, 11, 8, 0, false);         // UTC: 11:08 AM Local: 7:38 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 9, 4, 7, 0, false);           // UTC: 4:07 AM Local: 12:37 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 25, 9, 15, 0, false);         // UTC: 9:15 AM Local: 5:45 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 30, 23, 43, 0, false);        // UTC: 11:43 PM Local: 8:13 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 12, 11, 45, 0, false);        // UTC: 11:45 AM Local: 8:15 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 9, 19, 4, 0, false);          // UTC: 7:04 PM Local: 3:34 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 22, 9, 43, 0, false);         // UTC: 9:43 AM Local: 6:13 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 13, 17, 58, 0, false);        // UTC: 5:58 PM Local: 2:28 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 8, 6, 40, 0, false);          // UTC: 6:40 AM Local: 3:10 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 7, 4, 9, 0, false);           // UTC: 4:09 AM Local: 12:39 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 11, 8, 8, 0, false);          // UTC: 8:08 AM Local: 4:38 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 3, 21, 14, 0, true);          // UTC: 9:14 PM Local: 6:44 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 30, 1, 37, 0, false);         // UTC: 1:37 AM Local: 10:07 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 16, 18, 18, 0, false);        // UTC: 6:18 PM Local: 2:48 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 4, 3, 26, 0, true);           // UTC: 3:26 AM Local: 12:56 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 3, 0, 47, 0, true);           // UTC: 12:47 AM Local: 10:17 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 23, 0, 43, 0, false);         // UTC: 12:43 AM Local: 9:13 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 21, 19, 31, 0, false);        // UTC: 7:31 PM Local: 4:01 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 25, 14, 26, 0, false);        // UTC: 2:26 PM Local: 10:56 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 17, 21, 8, 0, false);         // UTC: 9:08 PM Local: 5:38 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 25, 16, 48, 0, false);        // UTC: 4:48 PM Local: 1:18 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 8, 5, 20, 0, false);          // UTC: 5:20 AM Local: 1:50 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 11, 9, 1, 20, 0, false);          // UTC: 1:20 AM Local: 9:50 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 6, 2, 3, 0, false);           // UTC: 2:03 AM Local: 10:33 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 25, 17, 28, 0, false);        // UTC: 5:28 PM Local: 1:58 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 8, 17, 32, 0, false);         // UTC: 5:32 PM Local: 2:02 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 17, 11, 14, 0, false);        // UTC: 11:14 AM Local: 7:44 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 5, 8, 38, 0, false);          // UTC: 8:38 AM Local: 5:08 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 11, 21, 44, 0, false);        // UTC: 9:44 PM Local: 6:14 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 2, 16, 4, 0, false);          // UTC: 4:04 PM Local: 12:34 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 19, 21, 1, 0, false);         // UTC: 9:01 PM Local: 5:31 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 1, 9, 51, 0, false);          // UTC: 9:51 AM Local: 6:21 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 17, 12, 24, 0, false);        // UTC: 12:24 PM Local: 8:54 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 4, 11, 26, 0, false);         // UTC: 11:26 AM Local: 7:56 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 17, 16, 6, 0, false);         // UTC: 4:06 PM Local: 12:36 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 12, 3, 31, 0, false);         // UTC: 3:31 AM Local: 12:01 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 20, 11, 24, 0, false);        // UTC: 11:24 AM Local: 7:54 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 7, 7, 38, 0, false);          // UTC: 7:38 AM Local: 4:08 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 25, 4, 6, 0, false);          // UTC: 4:06 AM Local: 12:36 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 10, 1, 38, 0, false);         // UTC: 1:38 AM Local: 10:08 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 24, 12, 20, 0, false);        // UTC: 12:20 PM Local: 8:50 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 27, 8, 53, 0, false);         // UTC: 8:53 AM Local: 5:23 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 12, 23, 7, 0, false);         // UTC: 11:07 PM Local: 7:37 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 31, 8, 21, 0, false);         // UTC: 8:21 AM Local: 4:51 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 25, 11, 17, 0, false);        // UTC: 11:17 AM Local: 7:47 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 27, 2, 17, 0, false);         // UTC: 2:17 AM Local: 10:47 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 24, 11, 20, 0, false);        // UTC: 11:20 AM Local: 7:50 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2018, 12, 26, 9, 26, 0, false);         // UTC: 9:26 AM Local: 5:56 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 18, 23, 11, 0, false);         // UTC: 11:11 PM Local: 7:41 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 25, 23, 6, 0, false);          // UTC: 11:06 PM Local: 7:36 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 16, 5, 15, 0, false);          // UTC: 5:15 AM Local: 1:45 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 25, 5, 15, 0, false);          // UTC: 5:15 AM Local: 1:45 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 23, 13, 41, 0, false);         // UTC: 1:41 PM Local: 10:11 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 3, 11, 29, 0, false);          // UTC: 11:29 AM Local: 7:59 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 27, 20, 31, 0, false);         // UTC: 8:31 PM Local: 5:01 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 15, 16, 49, 0, false);         // UTC: 4:49 PM Local: 1:19 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 15, 2, 51, 0, false);          // UTC: 2:51 AM Local: 11:21 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 12, 15, 7, 0, false);          // UTC: 3:07 PM Local: 11:37 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 16, 9, 43, 0, false);          // UTC: 9:43 AM Local: 6:13 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 9, 4, 51, 0, false);           // UTC: 4:51 AM Local: 1:21 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 29, 17, 38, 0, false);         // UTC: 5:38 PM Local: 2:08 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 22, 14, 34, 0, false);         // UTC: 2:34 PM Local: 11:04 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 10, 14, 38, 0, false);         // UTC: 2:38 PM Local: 11:08 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 28, 19, 25, 0, false);         // UTC: 7:25 PM Local: 3:55 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 13, 13, 15, 0, false);         // UTC: 1:15 PM Local: 9:45 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 25, 15, 23, 0, false);         // UTC: 3:23 PM Local: 11:53 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 16, 3, 46, 0, false);          // UTC: 3:46 AM Local: 12:16 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 16, 9, 45, 0, false);          // UTC: 9:45 AM Local: 6:15 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 29, 18, 6, 0, false);          // UTC: 6:06 PM Local: 2:36 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 12, 0, 46, 0, false);          // UTC: 12:46 AM Local: 9:16 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 22, 11, 48, 0, false);         // UTC: 11:48 AM Local: 8:18 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 25, 23, 54, 0, false);         // UTC: 11:54 PM Local: 8:24 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 1, 25, 1, 30, 0, false);          // UTC: 1:30 AM Local: 10:00 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 22, 8, 50, 0, false);          // UTC: 8:50 AM Local: 5:20 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 13, 0, 55, 0, false);          // UTC: 12:55 AM Local: 9:25 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 8, 12, 22, 0, false);          // UTC: 12:22 PM Local: 8:52 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 15, 6, 3, 0, false);           // UTC: 6:03 AM Local: 2:33 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 13, 5, 13, 0, false);          // UTC: 5:13 AM Local: 1:43 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 12, 6, 3, 0, false);           // UTC: 6:03 AM Local: 2:33 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 17, 8, 3, 0, false);           // UTC: 8:03 AM Local: 4:33 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 12, 2, 1, 0, false);           // UTC: 2:01 AM Local: 10:31 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 3, 23, 26, 0, false);          // UTC: 11:26 PM Local: 7:56 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 20, 23, 32, 0, false);         // UTC: 11:32 PM Local: 8:02 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 22, 4, 36, 0, false);          // UTC: 4:36 AM Local: 1:06 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 26, 4, 32, 0, false);          // UTC: 4:32 AM Local: 1:02 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 3, 18, 32, 0, false);          // UTC: 6:32 PM Local: 3:02 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 4, 17, 19, 0, false);          // UTC: 5:19 PM Local: 1:49 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 2, 12, 21, 0, false);          // UTC: 12:21 PM Local: 8:51 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 7, 2, 47, 0, false);           // UTC: 2:47 AM Local: 11:17 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 2, 2, 45, 0, false);           // UTC: 2:45 AM Local: 11:15 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 27, 6, 34, 0, false);          // UTC: 6:34 AM Local: 3:04 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 17, 5, 34, 0, false);          // UTC: 5:34 AM Local: 2:04 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 17, 23, 44, 0, false);         // UTC: 11:44 PM Local: 8:14 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 8, 3, 36, 0, false);           // UTC: 3:36 AM Local: 12:06 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 6, 9, 18, 0, false);           // UTC: 9:18 AM Local: 5:48 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 6, 8, 28, 0, false);           // UTC: 8:28 AM Local: 4:58 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 11, 1, 35, 0, false);          // UTC: 1:35 AM Local: 10:05 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 2, 14, 11, 24, 0, false);         // UTC: 11:24 AM Local: 7:54 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 8, 9, 22, 0, false);           // UTC: 9:22 AM Local: 5:52 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 20, 12, 43, 0, true);          // UTC: 12:43 PM Local: 10:13 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 9, 7, 19, 0, false);           // UTC: 7:19 AM Local: 3:49 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 30, 7, 3, 0, true);            // UTC: 7:03 AM Local: 4:33 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 10, 9, 43, 0, true);           // UTC: 9:43 AM Local: 7:13 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 3, 20, 9, 0, false);           // UTC: 8:09 PM Local: 4:39 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 21, 18, 42, 0, true);          // UTC: 6:42 PM Local: 4:12 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 29, 4, 25, 0, true);           // UTC: 4:25 AM Local: 1:55 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 12, 16, 40, 0, true);          // UTC: 4:40 PM Local: 2:10 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 24, 9, 33, 0, true);           // UTC: 9:33 AM Local: 7:03 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 17, 2, 38, 0, true);           // UTC: 2:38 AM Local: 12:08 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 16, 4, 41, 0, true);           // UTC: 4:41 AM Local: 2:11 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 31, 17, 28, 0, true);          // UTC: 5:28 PM Local: 2:58 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 30, 6, 18, 0, true);           // UTC: 6:18 AM Local: 3:48 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 2, 5, 32, 0, false);           // UTC: 5:32 AM Local: 2:02 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 29, 23, 1, 0, true);           // UTC: 11:01 PM Local: 8:31 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 4, 18, 33, 0, false);          // UTC: 6:33 PM Local: 3:03 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 30, 19, 47, 0, true);          // UTC: 7:47 PM Local: 5:17 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 18, 18, 14, 0, true);          // UTC: 6:14 PM Local: 3:44 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 9, 2, 48, 0, false);           // UTC: 2:48 AM Local: 11:18 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 1, 12, 19, 0, false);          // UTC: 12:19 PM Local: 8:49 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 31, 8, 26, 0, true);           // UTC: 8:26 AM Local: 5:56 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 4, 5, 52, 0, false);           // UTC: 5:52 AM Local: 2:22 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 25, 18, 17, 0, true);          // UTC: 6:17 PM Local: 3:47 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 3, 15, 9, 35, 0, true);           // UTC: 9:35 AM Local: 7:05 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 19, 2, 21, 0, true);           // UTC: 2:21 AM Local: 11:51 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 24, 4, 50, 0, true);           // UTC: 4:50 AM Local: 2:20 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 29, 8, 40, 0, true);           // UTC: 8:40 AM Local: 6:10 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 2, 12, 19, 0, true);           // UTC: 12:19 PM Local: 9:49 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 13, 1, 6, 0, true);            // UTC: 1:06 AM Local: 10:36 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 29, 18, 33, 0, true);          // UTC: 6:33 PM Local: 4:03 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 26, 15, 46, 0, true);          // UTC: 3:46 PM Local: 1:16 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 23, 2, 47, 0, true);           // UTC: 2:47 AM Local: 12:17 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 26, 10, 48, 0, true);          // UTC: 10:48 AM Local: 8:18 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 21, 20, 19, 0, true);          // UTC: 8:19 PM Local: 5:49 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 23, 16, 11, 0, true);          // UTC: 4:11 PM Local: 1:41 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 21, 21, 8, 0, true);           // UTC: 9:08 PM Local: 6:38 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 21, 6, 49, 0, true);           // UTC: 6:49 AM Local: 4:19 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 20, 22, 41, 0, true);          // UTC: 10:41 PM Local: 8:11 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 30, 19, 13, 0, true);          // UTC: 7:13 PM Local: 4:43 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 30, 15, 57, 0, true);          // UTC: 3:57 PM Local: 1:27 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 2, 15, 26, 0, true);           // UTC: 3:26 PM Local: 12:56 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 4, 18, 27, 0, true);           // UTC: 6:27 PM Local: 3:57 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 28, 19, 44, 0, true);          // UTC: 7:44 PM Local: 5:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 14, 5, 20, 0, true);           // UTC: 5:20 AM Local: 2:50 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 17, 3, 14, 0, true);           // UTC: 3:14 AM Local: 12:44 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 29, 15, 59, 0, true);          // UTC: 3:59 PM Local: 1:29 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 23, 12, 19, 0, true);          // UTC: 12:19 PM Local: 9:49 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 18, 14, 15, 0, true);          // UTC: 2:15 PM Local: 11:45 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 4, 21, 9, 34, 0, true);           // UTC: 9:34 AM Local: 7:04 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 17, 23, 57, 0, true);          // UTC: 11:57 PM Local: 9:27 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 8, 13, 10, 0, true);           // UTC: 1:10 PM Local: 10:40 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 24, 15, 49, 0, true);          // UTC: 3:49 PM Local: 1:19 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 4, 22, 44, 0, true);           // UTC: 10:44 PM Local: 8:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 14, 12, 14, 0, true);          // UTC: 12:14 PM Local: 9:44 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 28, 15, 30, 0, true);          // UTC: 3:30 PM Local: 1:00 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 26, 19, 1, 0, true);           // UTC: 7:01 PM Local: 4:31 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 30, 19, 16, 0, true);          // UTC: 7:16 PM Local: 4:46 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 14, 18, 53, 0, true);          // UTC: 6:53 PM Local: 4:23 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 18, 3, 15, 0, true);           // UTC: 3:15 AM Local: 12:45 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 3, 20, 44, 0, true);           // UTC: 8:44 PM Local: 6:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 8, 10, 33, 0, true);           // UTC: 10:33 AM Local: 8:03 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 14, 12, 9, 0, true);           // UTC: 12:09 PM Local: 9:39 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 28, 19, 27, 0, true);          // UTC: 7:27 PM Local: 4:57 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 27, 17, 53, 0, true);          // UTC: 5:53 PM Local: 3:23 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 7, 10, 28, 0, true);           // UTC: 10:28 AM Local: 7:58 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 2, 9, 44, 0, true);            // UTC: 9:44 AM Local: 7:14 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 17, 21, 57, 0, true);          // UTC: 9:57 PM Local: 7:27 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 8, 15, 12, 0, true);           // UTC: 3:12 PM Local: 12:42 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 30, 10, 2, 0, true);           // UTC: 10:02 AM Local: 7:32 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 6, 20, 46, 0, true);           // UTC: 8:46 PM Local: 6:16 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 26, 5, 2, 0, true);            // UTC: 5:02 AM Local: 2:32 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 8, 12, 32, 0, true);           // UTC: 12:32 PM Local: 10:02 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 21, 17, 32, 0, true);          // UTC: 5:32 PM Local: 3:02 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 5, 3, 16, 59, 0, true);           // UTC: 4:59 PM Local: 2:29 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 3, 12, 16, 0, true);           // UTC: 12:16 PM Local: 9:46 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 1, 13, 22, 0, true);           // UTC: 1:22 PM Local: 10:52 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 24, 15, 23, 0, true);          // UTC: 3:23 PM Local: 12:53 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 19, 12, 18, 0, true);          // UTC: 12:18 PM Local: 9:48 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 2, 13, 55, 0, true);           // UTC: 1:55 PM Local: 11:25 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 17, 22, 55, 0, true);          // UTC: 10:55 PM Local: 8:25 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 6, 20, 11, 0, true);           // UTC: 8:11 PM Local: 5:41 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 17, 8, 48, 0, true);           // UTC: 8:48 AM Local: 6:18 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 25, 16, 33, 0, true);          // UTC: 4:33 PM Local: 2:03 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 11, 20, 23, 0, true);          // UTC: 8:23 PM Local: 5:53 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 21, 4, 42, 0, true);           // UTC: 4:42 AM Local: 2:12 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 21, 14, 0, 0, true);           // UTC: 2:00 PM Local: 11:30 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 4, 14, 45, 0, true);           // UTC: 2:45 PM Local: 12:15 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 21, 12, 17, 0, true);          // UTC: 12:17 PM Local: 9:47 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 16, 3, 12, 0, true);           // UTC: 3:12 AM Local: 12:42 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 30, 16, 31, 0, true);          // UTC: 4:31 PM Local: 2:01 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 17, 6, 3, 0, true);            // UTC: 6:03 AM Local: 3:33 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 30, 4, 10, 0, true);           // UTC: 4:10 AM Local: 1:40 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 19, 18, 10, 0, true);          // UTC: 6:10 PM Local: 3:40 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 1, 8, 59, 0, true);            // UTC: 8:59 AM Local: 6:29 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 12, 0, 23, 0, true);           // UTC: 12:23 AM Local: 9:53 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 1, 11, 43, 0, true);           // UTC: 11:43 AM Local: 9:13 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 4, 22, 40, 0, true);           // UTC: 10:40 PM Local: 8:10 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 2, 7, 46, 0, true);            // UTC: 7:46 AM Local: 5:16 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 6, 22, 14, 13, 0, true);          // UTC: 2:13 PM Local: 11:43 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 27, 19, 47, 0, true);          // UTC: 7:47 PM Local: 5:17 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 13, 2, 9, 0, true);            // UTC: 2:09 AM Local: 11:39 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 27, 8, 49, 0, true);           // UTC: 8:49 AM Local: 6:19 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 4, 9, 33, 0, true);            // UTC: 9:33 AM Local: 7:03 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 1, 21, 6, 0, true);            // UTC: 9:06 PM Local: 6:36 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 30, 16, 4, 0, true);           // UTC: 4:04 PM Local: 1:34 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 8, 7, 58, 0, true);            // UTC: 7:58 AM Local: 5:28 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 13, 17, 4, 0, true);           // UTC: 5:04 PM Local: 2:34 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 22, 20, 41, 0, true);          // UTC: 8:41 PM Local: 6:11 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 28, 5, 39, 0, true);           // UTC: 5:39 AM Local: 3:09 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 30, 4, 47, 0, true);           // UTC: 4:47 AM Local: 2:17 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 28, 10, 59, 0, true);          // UTC: 10:59 AM Local: 8:29 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 16, 3, 48, 0, true);           // UTC: 3:48 AM Local: 1:18 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 18, 2, 34, 0, true);           // UTC: 2:34 AM Local: 12:04 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 19, 0, 1, 0, true);            // UTC: 12:01 AM Local: 9:31 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 22, 0, 31, 0, true);           // UTC: 12:31 AM Local: 10:01 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 10, 4, 0, 0, true);            // UTC: 4:00 AM Local: 1:30 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 5, 8, 56, 0, true);            // UTC: 8:56 AM Local: 6:26 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 26, 21, 3, 0, true);           // UTC: 9:03 PM Local: 6:33 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 12, 0, 39, 0, true);           // UTC: 12:39 AM Local: 10:09 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 23, 8, 18, 0, true);           // UTC: 8:18 AM Local: 5:48 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 15, 20, 29, 0, true);          // UTC: 8:29 PM Local: 5:59 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 23, 18, 2, 0, true);           // UTC: 6:02 PM Local: 3:32 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 25, 1, 12, 0, true);           // UTC: 1:12 AM Local: 10:42 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 7, 1, 13, 45, 0, true);           // UTC: 1:45 PM Local: 11:15 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 16, 19, 20, 0, true);          // UTC: 7:20 PM Local: 4:50 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 12, 7, 57, 0, true);           // UTC: 7:57 AM Local: 5:27 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 15, 20, 3, 0, true);           // UTC: 8:03 PM Local: 5:33 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 22, 5, 50, 0, true);           // UTC: 5:50 AM Local: 3:20 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 5, 9, 4, 0, true);             // UTC: 9:04 AM Local: 6:34 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 27, 11, 10, 0, true);          // UTC: 11:10 AM Local: 8:40 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 31, 14, 56, 0, true);          // UTC: 2:56 PM Local: 12:26 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 16, 20, 43, 0, true);          // UTC: 8:43 PM Local: 6:13 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 17, 15, 32, 0, true);          // UTC: 3:32 PM Local: 1:02 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 9, 10, 46, 0, true);           // UTC: 10:46 AM Local: 8:16 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 7, 7, 10, 0, true);            // UTC: 7:10 AM Local: 4:40 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 13, 0, 2, 0, true);            // UTC: 12:02 AM Local: 9:32 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 11, 8, 51, 0, true);           // UTC: 8:51 AM Local: 6:21 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 8, 4, 3, 0, true);             // UTC: 4:03 AM Local: 1:33 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 7, 0, 25, 0, true);            // UTC: 12:25 AM Local: 9:55 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 17, 9, 38, 0, true);           // UTC: 9:38 AM Local: 7:08 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 1, 1, 31, 0, true);            // UTC: 1:31 AM Local: 11:01 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 7, 12, 50, 0, true);           // UTC: 12:50 PM Local: 10:20 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 4, 4, 51, 0, true);            // UTC: 4:51 AM Local: 2:21 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 22, 22, 55, 0, true);          // UTC: 10:55 PM Local: 8:25 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 30, 8, 0, 0, true);            // UTC: 8:00 AM Local: 5:30 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 23, 8, 28, 0, true);           // UTC: 8:28 AM Local: 5:58 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 12, 14, 13, 0, true);          // UTC: 2:13 PM Local: 11:43 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 24, 3, 49, 0, true);           // UTC: 3:49 AM Local: 1:19 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 8, 1, 21, 48, 0, true);           // UTC: 9:48 PM Local: 7:18 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 2, 10, 27, 0, true);           // UTC: 10:27 AM Local: 7:57 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 21, 8, 9, 0, true);            // UTC: 8:09 AM Local: 5:39 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 8, 4, 46, 0, true);            // UTC: 4:46 AM Local: 2:16 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 3, 23, 44, 0, true);           // UTC: 11:44 PM Local: 9:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 6, 16, 7, 0, true);            // UTC: 4:07 PM Local: 1:37 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 29, 17, 22, 0, true);          // UTC: 5:22 PM Local: 2:52 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 20, 9, 21, 0, true);           // UTC: 9:21 AM Local: 6:51 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 22, 19, 17, 0, true);          // UTC: 7:17 PM Local: 4:47 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 5, 22, 36, 0, true);           // UTC: 10:36 PM Local: 8:06 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 17, 17, 48, 0, true);          // UTC: 5:48 PM Local: 3:18 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 27, 16, 46, 0, true);          // UTC: 4:46 PM Local: 2:16 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 29, 2, 2, 0, true);            // UTC: 2:02 AM Local: 11:32 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 18, 0, 8, 0, true);            // UTC: 12:08 AM Local: 9:38 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 11, 16, 57, 0, true);          // UTC: 4:57 PM Local: 2:27 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 22, 5, 45, 0, true);           // UTC: 5:45 AM Local: 3:15 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 23, 0, 5, 0, true);            // UTC: 12:05 AM Local: 9:35 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 18, 2, 11, 0, true);           // UTC: 2:11 AM Local: 11:41 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 3, 16, 50, 0, true);           // UTC: 4:50 PM Local: 2:20 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 16, 18, 31, 0, true);          // UTC: 6:31 PM Local: 4:01 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 5, 17, 19, 0, true);           // UTC: 5:19 PM Local: 2:49 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 9, 15, 57, 0, true);           // UTC: 3:57 PM Local: 1:27 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 8, 19, 12, 0, true);           // UTC: 7:12 PM Local: 4:42 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 27, 20, 31, 0, true);          // UTC: 8:31 PM Local: 6:01 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 6, 15, 51, 0, true);           // UTC: 3:51 PM Local: 1:21 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 9, 26, 11, 44, 0, true);          // UTC: 11:44 AM Local: 9:14 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 4, 4, 1, 0, true);            // UTC: 4:01 AM Local: 1:31 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 3, 9, 7, 0, true);            // UTC: 9:07 AM Local: 6:37 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 21, 9, 1, 0, true);           // UTC: 9:01 AM Local: 6:31 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 7, 22, 35, 0, true);          // UTC: 10:35 PM Local: 8:05 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 5, 14, 20, 0, true);          // UTC: 2:20 PM Local: 11:50 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 6, 14, 9, 0, true);           // UTC: 2:09 PM Local: 11:39 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 16, 2, 27, 0, true);          // UTC: 2:27 AM Local: 11:57 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 11, 1, 52, 0, true);          // UTC: 1:52 AM Local: 11:22 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 16, 0, 35, 0, true);          // UTC: 12:35 AM Local: 10:05 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 21, 7, 33, 0, true);          // UTC: 7:33 AM Local: 5:03 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 14, 23, 28, 0, true);         // UTC: 11:28 PM Local: 8:58 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 12, 1, 59, 0, true);          // UTC: 1:59 AM Local: 11:29 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 21, 3, 36, 0, true);          // UTC: 3:36 AM Local: 1:06 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 14, 9, 25, 0, true);          // UTC: 9:25 AM Local: 6:55 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 18, 4, 13, 0, true);          // UTC: 4:13 AM Local: 1:43 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 13, 20, 28, 0, true);         // UTC: 8:28 PM Local: 5:58 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 2, 0, 1, 0, true);            // UTC: 12:01 AM Local: 9:31 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 25, 9, 24, 0, true);          // UTC: 9:24 AM Local: 6:54 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 5, 17, 45, 0, true);          // UTC: 5:45 PM Local: 3:15 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 3, 21, 1, 0, true);           // UTC: 9:01 PM Local: 6:31 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 7, 13, 56, 0, true);          // UTC: 1:56 PM Local: 11:26 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 17, 14, 35, 0, true);         // UTC: 2:35 PM Local: 12:05 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 20, 19, 50, 0, true);         // UTC: 7:50 PM Local: 5:20 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 15, 21, 14, 0, true);         // UTC: 9:14 PM Local: 6:44 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 10, 12, 22, 11, 0, true);         // UTC: 10:11 PM Local: 7:41 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 3, 10, 23, 0, false);         // UTC: 10:23 AM Local: 6:53 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 27, 13, 40, 0, false);        // UTC: 1:40 PM Local: 10:10 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 2, 17, 4, 0, true);           // UTC: 5:04 PM Local: 2:34 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 15, 6, 29, 0, false);         // UTC: 6:29 AM Local: 2:59 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 21, 0, 35, 0, false);         // UTC: 12:35 AM Local: 9:05 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 13, 3, 7, 0, false);          // UTC: 3:07 AM Local: 11:37 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 21, 1, 8, 0, false);          // UTC: 1:08 AM Local: 9:38 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 20, 18, 52, 0, false);        // UTC: 6:52 PM Local: 3:22 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 24, 13, 12, 0, false);        // UTC: 1:12 PM Local: 9:42 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 3, 20, 59, 0, false);         // UTC: 8:59 PM Local: 5:29 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 22, 7, 41, 0, false);         // UTC: 7:41 AM Local: 4:11 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 27, 21, 34, 0, false);        // UTC: 9:34 PM Local: 6:04 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 3, 10, 15, 0, false);         // UTC: 10:15 AM Local: 6:45 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 26, 11, 27, 0, false);        // UTC: 11:27 AM Local: 7:57 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 22, 17, 42, 0, false);        // UTC: 5:42 PM Local: 2:12 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 21, 10, 18, 0, false);        // UTC: 10:18 AM Local: 6:48 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 24, 21, 0, 0, false);         // UTC: 9:00 PM Local: 5:30 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 17, 14, 25, 0, false);        // UTC: 2:25 PM Local: 10:55 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 22, 14, 20, 0, false);        // UTC: 2:20 PM Local: 10:50 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 26, 1, 26, 0, false);         // UTC: 1:26 AM Local: 9:56 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 19, 6, 28, 0, false);         // UTC: 6:28 AM Local: 2:58 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 17, 7, 27, 0, false);         // UTC: 7:27 AM Local: 3:57 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 29, 0, 35, 0, false);         // UTC: 12:35 AM Local: 9:05 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 9, 13, 41, 0, false);         // UTC: 1:41 PM Local: 10:11 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 11, 14, 4, 45, 0, false);         // UTC: 4:45 AM Local: 1:15 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 18, 6, 40, 0, false);         // UTC: 6:40 AM Local: 3:10 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 4, 8, 52, 0, false);          // UTC: 8:52 AM Local: 5:22 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 12, 12, 43, 0, false);        // UTC: 12:43 PM Local: 9:13 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 4, 6, 44, 0, false);          // UTC: 6:44 AM Local: 3:14 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 9, 15, 57, 0, false);         // UTC: 3:57 PM Local: 12:27 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 27, 7, 28, 0, false);         // UTC: 7:28 AM Local: 3:58 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 30, 23, 11, 0, false);        // UTC: 11:11 PM Local: 7:41 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 5, 7, 48, 0, false);          // UTC: 7:48 AM Local: 4:18 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 4, 11, 51, 0, false);         // UTC: 11:51 AM Local: 8:21 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 16, 5, 42, 0, false);         // UTC: 5:42 AM Local: 2:12 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 9, 5, 21, 0, false);          // UTC: 5:21 AM Local: 1:51 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 9, 5, 18, 0, false);          // UTC: 5:18 AM Local: 1:48 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 3, 18, 7, 0, false);          // UTC: 6:07 PM Local: 2:37 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 12, 3, 42, 0, false);         // UTC: 3:42 AM Local: 12:12 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 1, 9, 0, 0, false);           // UTC: 9:00 AM Local: 5:30 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 25, 19, 15, 0, false);        // UTC: 7:15 PM Local: 3:45 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 19, 18, 27, 0, false);        // UTC: 6:27 PM Local: 2:57 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 25, 23, 18, 0, false);        // UTC: 11:18 PM Local: 7:48 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 29, 20, 15, 0, false);        // UTC: 8:15 PM Local: 4:45 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 1, 20, 10, 0, false);         // UTC: 8:10 PM Local: 4:40 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 6, 14, 0, 0, false);          // UTC: 2:00 PM Local: 10:30 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 12, 12, 52, 0, false);        // UTC: 12:52 PM Local: 9:22 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 22, 1, 55, 0, false);         // UTC: 1:55 AM Local: 10:25 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 26, 16, 27, 0, false);        // UTC: 4:27 PM Local: 12:57 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2019, 12, 23, 15, 41, 0, false);        // UTC: 3:41 PM Local: 12:11 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 2, 17, 8, 0, false);           // UTC: 5:08 PM Local: 1:38 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 22, 8, 16, 0, false);          // UTC: 8:16 AM Local: 4:46 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 31, 15, 38, 0, false);         // UTC: 3:38 PM Local: 12:08 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 21, 3, 28, 0, false);          // UTC: 3:28 AM Local: 11:58 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 12, 4, 8, 0, false);           // UTC: 4:08 AM Local: 12:38 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 4, 4, 41, 0, false);           // UTC: 4:41 AM Local: 1:11 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 13, 9, 7, 0, false);           // UTC: 9:07 AM Local: 5:37 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 1, 12, 31, 0, false);          // UTC: 12:31 PM Local: 9:01 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 8, 18, 29, 0, false);          // UTC: 6:29 PM Local: 2:59 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 20, 12, 27, 0, false);         // UTC: 12:27 PM Local: 8:57 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 13, 8, 17, 0, false);          // UTC: 8:17 AM Local: 4:47 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 22, 10, 12, 0, false);         // UTC: 10:12 AM Local: 6:42 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 3, 13, 10, 0, false);          // UTC: 1:10 PM Local: 9:40 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 30, 20, 23, 0, false);         // UTC: 8:23 PM Local: 4:53 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 17, 14, 31, 0, false);         // UTC: 2:31 PM Local: 11:01 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 6, 20, 34, 0, false);          // UTC: 8:34 PM Local: 5:04 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 16, 12, 21, 0, false);         // UTC: 12:21 PM Local: 8:51 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 29, 1, 37, 0, false);          // UTC: 1:37 AM Local: 10:07 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 23, 6, 26, 0, false);          // UTC: 6:26 AM Local: 2:56 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 10, 3, 25, 0, false);          // UTC: 3:25 AM Local: 11:55 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 24, 18, 37, 0, false);         // UTC: 6:37 PM Local: 3:07 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 13, 8, 16, 0, false);          // UTC: 8:16 AM Local: 4:46 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 10, 23, 28, 0, false);         // UTC: 11:28 PM Local: 7:58 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 24, 8, 55, 0, false);          // UTC: 8:55 AM Local: 5:25 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 1, 23, 8, 9, 0, false);           // UTC: 8:09 AM Local: 4:39 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 21, 17, 35, 0, false);         // UTC: 5:35 PM Local: 2:05 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 24, 15, 31, 0, false);         // UTC: 3:31 PM Local: 12:01 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 3, 16, 22, 0, false);          // UTC: 4:22 PM Local: 12:52 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 21, 20, 45, 0, false);         // UTC: 8:45 PM Local: 5:15 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 6, 23, 3, 0, false);           // UTC: 11:03 PM Local: 7:33 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 21, 8, 32, 0, false);          // UTC: 8:32 AM Local: 5:02 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 2, 0, 19, 0, false);           // UTC: 12:19 AM Local: 8:49 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 2, 10, 6, 0, false);           // UTC: 10:06 AM Local: 6:36 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 28, 21, 54, 0, false);         // UTC: 9:54 PM Local: 6:24 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 7, 15, 45, 0, false);          // UTC: 3:45 PM Local: 12:15 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 23, 13, 46, 0, false);         // UTC: 1:46 PM Local: 10:16 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 27, 3, 35, 0, false);          // UTC: 3:35 AM Local: 12:05 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 20, 3, 27, 0, false);          // UTC: 3:27 AM Local: 11:57 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 14, 8, 59, 0, false);          // UTC: 8:59 AM Local: 5:29 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 22, 21, 7, 0, false);          // UTC: 9:07 PM Local: 5:37 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 14, 13, 55, 0, false);         // UTC: 1:55 PM Local: 10:25 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 23, 23, 18, 0, false);         // UTC: 11:18 PM Local: 7:48 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 21, 21, 1, 0, false);          // UTC: 9:01 PM Local: 5:31 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 1, 11, 6, 0, false);           // UTC: 11:06 AM Local: 7:36 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 14, 0, 33, 0, false);          // UTC: 12:33 AM Local: 9:03 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 11, 23, 12, 0, false);         // UTC: 11:12 PM Local: 7:42 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 28, 7, 42, 0, false);          // UTC: 7:42 AM Local: 4:12 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 16, 16, 26, 0, false);         // UTC: 4:26 PM Local: 12:56 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 22, 18, 55, 0, false);         // UTC: 6:55 PM Local: 3:25 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 2, 10, 22, 54, 0, false);         // UTC: 10:54 PM Local: 7:24 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 28, 3, 27, 0, true);           // UTC: 3:27 AM Local: 12:57 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 29, 4, 37, 0, true);           // UTC: 4:37 AM Local: 2:07 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 23, 10, 56, 0, true);          // UTC: 10:56 AM Local: 8:26 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 6, 5, 39, 0, false);           // UTC: 5:39 AM Local: 2:09 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 29, 12, 18, 0, true);          // UTC: 12:18 PM Local: 9:48 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 13, 1, 39, 0, true);           // UTC: 1:39 AM Local: 11:09 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 16, 8, 22, 0, true);           // UTC: 8:22 AM Local: 5:52 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 29, 11, 55, 0, true);          // UTC: 11:55 AM Local: 9:25 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 24, 12, 0, 0, true);           // UTC: 12:00 PM Local: 9:30 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 18, 8, 36, 0, true);           // UTC: 8:36 AM Local: 6:06 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 31, 11, 29, 0, true);          // UTC: 11:29 AM Local: 8:59 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 30, 0, 10, 0, true);           // UTC: 12:10 AM Local: 9:40 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 20, 4, 42, 0, true);           // UTC: 4:42 AM Local: 2:12 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 20, 7, 56, 0, true);           // UTC: 7:56 AM Local: 5:26 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 24, 20, 16, 0, true);          // UTC: 8:16 PM Local: 5:46 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 4, 10, 15, 0, false);          // UTC: 10:15 AM Local: 6:45 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 23, 16, 22, 0, true);          // UTC: 4:22 PM Local: 1:52 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 1, 12, 17, 0, false);          // UTC: 12:17 PM Local: 8:47 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 2, 14, 12, 0, false);          // UTC: 2:12 PM Local: 10:42 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 22, 4, 24, 0, true);           // UTC: 4:24 AM Local: 1:54 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 12, 0, 44, 0, true);           // UTC: 12:44 AM Local: 10:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 31, 6, 14, 0, true);           // UTC: 6:14 AM Local: 3:44 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 10, 11, 5, 0, true);           // UTC: 11:05 AM Local: 8:35 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 19, 13, 46, 0, true);          // UTC: 1:46 PM Local: 11:16 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 3, 19, 19, 41, 0, true);          // UTC: 7:41 PM Local: 5:11 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 21, 17, 39, 0, true);          // UTC: 5:39 PM Local: 3:09 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 23, 0, 0, 0, true);            // UTC: 12:00 AM Local: 9:30 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 2, 17, 30, 0, true);           // UTC: 5:30 PM Local: 3:00 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 25, 16, 48, 0, true);          // UTC: 4:48 PM Local: 2:18 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 26, 14, 7, 0, true);           // UTC: 2:07 PM Local: 11:37 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 2, 20, 6, 0, true);            // UTC: 8:06 PM Local: 5:36 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 16, 0, 14, 0, true);           // UTC: 12:14 AM Local: 9:44 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 2, 14, 44, 0, true);           // UTC: 2:44 PM Local: 12:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 12, 19, 44, 0, true);          // UTC: 7:44 PM Local: 5:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 22, 6, 4, 0, true);            // UTC: 6:04 AM Local: 3:34 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 28, 23, 45, 0, true);          // UTC: 11:45 PM Local: 9:15 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 1, 18, 10, 0, true);           // UTC: 6:10 PM Local: 3:40 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 11, 7, 14, 0, true);           // UTC: 7:14 AM Local: 4:44 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 20, 13, 52, 0, true);          // UTC: 1:52 PM Local: 11:22 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 2, 14, 51, 0, true);           // UTC: 2:51 PM Local: 12:21 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 2, 14, 5, 0, true);            // UTC: 2:05 PM Local: 11:35 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 6, 2, 0, 0, true);             // UTC: 2:00 AM Local: 11:30 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 2, 10, 38, 0, true);           // UTC: 10:38 AM Local: 8:08 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 1, 16, 11, 0, true);           // UTC: 4:11 PM Local: 1:41 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 11, 5, 24, 0, true);           // UTC: 5:24 AM Local: 2:54 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 18, 10, 27, 0, true);          // UTC: 10:27 AM Local: 7:57 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 30, 3, 48, 0, true);           // UTC: 3:48 AM Local: 1:18 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 29, 2, 59, 0, true);           // UTC: 2:59 AM Local: 12:29 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 3, 16, 17, 0, true);           // UTC: 4:17 PM Local: 1:47 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 4, 21, 5, 53, 0, true);           // UTC: 5:53 AM Local: 3:23 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 1, 10, 46, 0, true);           // UTC: 10:46 AM Local: 8:16 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 18, 4, 53, 0, true);           // UTC: 4:53 AM Local: 2:23 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 11, 17, 56, 0, true);          // UTC: 5:56 PM Local: 3:26 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 29, 17, 29, 0, true);          // UTC: 5:29 PM Local: 2:59 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 3, 20, 39, 0, true);           // UTC: 8:39 PM Local: 6:09 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 10, 22, 10, 0, true);          // UTC: 10:10 PM Local: 7:40 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 24, 13, 20, 0, true);          // UTC: 1:20 PM Local: 10:50 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 22, 14, 36, 0, true);          // UTC: 2:36 PM Local: 12:06 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 24, 13, 5, 0, true);           // UTC: 1:05 PM Local: 10:35 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 15, 15, 30, 0, true);          // UTC: 3:30 PM Local: 1:00 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 14, 23, 34, 0, true);          // UTC: 11:34 PM Local: 9:04 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 9, 8, 27, 0, true);            // UTC: 8:27 AM Local: 5:57 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 5, 20, 34, 0, true);           // UTC: 8:34 PM Local: 6:04 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 14, 23, 40, 0, true);          // UTC: 11:40 PM Local: 9:10 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 18, 10, 23, 0, true);          // UTC: 10:23 AM Local: 7:53 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 17, 21, 4, 0, true);           // UTC: 9:04 PM Local: 6:34 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 30, 21, 1, 0, true);           // UTC: 9:01 PM Local: 6:31 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 16, 12, 17, 0, true);          // UTC: 12:17 PM Local: 9:47 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 10, 3, 49, 0, true);           // UTC: 3:49 AM Local: 1:19 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 16, 21, 5, 0, true);           // UTC: 9:05 PM Local: 6:35 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 1, 15, 26, 0, true);           // UTC: 3:26 PM Local: 12:56 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 23, 4, 21, 0, true);           // UTC: 4:21 AM Local: 1:51 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 4, 3, 4, 0, true);             // UTC: 3:04 AM Local: 12:34 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 14, 7, 13, 0, true);           // UTC: 7:13 AM Local: 4:43 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 5, 3, 22, 2, 0, true);            // UTC: 10:02 PM Local: 7:32 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 5, 3, 27, 0, true);            // UTC: 3:27 AM Local: 12:57 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 29, 21, 2, 0, true);           // UTC: 9:02 PM Local: 6:32 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 15, 21, 18, 0, true);          // UTC: 9:18 PM Local: 6:48 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 20, 14, 23, 0, true);          // UTC: 2:23 PM Local: 11:53 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 15, 18, 17, 0, true);          // UTC: 6:17 PM Local: 3:47 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 19, 9, 20, 0, true);           // UTC: 9:20 AM Local: 6:50 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 27, 21, 17, 0, true);          // UTC: 9:17 PM Local: 6:47 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 28, 2, 35, 0, true);           // UTC: 2:35 AM Local: 12:05 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 20, 9, 22, 0, true);           // UTC: 9:22 AM Local: 6:52 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 1, 12, 27, 0, true);           // UTC: 12:27 PM Local: 9:57 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 11, 20, 31, 0, true);          // UTC: 8:31 PM Local: 6:01 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 23, 21, 12, 0, true);          // UTC: 9:12 PM Local: 6:42 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 13, 6, 47, 0, true);           // UTC: 6:47 AM Local: 4:17 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 5, 17, 27, 0, true);           // UTC: 5:27 PM Local: 2:57 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 6, 13, 13, 0, true);           // UTC: 1:13 PM Local: 10:43 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 21, 17, 26, 0, true);          // UTC: 5:26 PM Local: 2:56 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 9, 10, 29, 0, true);           // UTC: 10:29 AM Local: 7:59 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 29, 1, 38, 0, true);           // UTC: 1:38 AM Local: 11:08 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 21, 10, 28, 0, true);          // UTC: 10:28 AM Local: 7:58 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 13, 9, 44, 0, true);           // UTC: 9:44 AM Local: 7:14 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 12, 23, 44, 0, true);          // UTC: 11:44 PM Local: 9:14 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 10, 6, 18, 0, true);           // UTC: 6:18 AM Local: 3:48 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 2, 9, 31, 0, true);            // UTC: 9:31 AM Local: 7:01 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 8, 15, 26, 0, true);           // UTC: 3:26 PM Local: 12:56 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 6, 6, 15, 11, 0, true);           // UTC: 3:11 PM Local: 12:41 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 25, 3, 4, 0, true);            // UTC: 3:04 AM Local: 12:34 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 7, 13, 9, 0, true);            // UTC: 1:09 PM Local: 10:39 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 10, 20, 18, 0, true);          // UTC: 8:18 PM Local: 5:48 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 29, 9, 38, 0, true);           // UTC: 9:38 AM Local: 7:08 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 25, 7, 3, 0, true);            // UTC: 7:03 AM Local: 4:33 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 18, 23, 53, 0, true);          // UTC: 11:53 PM Local: 9:23 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 12, 15, 46, 0, true);          // UTC: 3:46 PM Local: 1:16 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 28, 0, 59, 0, true);           // UTC: 12:59 AM Local: 10:29 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 25, 8, 54, 0, true);           // UTC: 8:54 AM Local: 6:24 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 10, 17, 47, 0, true);          // UTC: 5:47 PM Local: 3:17 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 29, 9, 38, 0, true);           // UTC: 9:38 AM Local: 7:08 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 16, 12, 31, 0, true);          // UTC: 12:31 PM Local: 10:01 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 22, 12, 46, 0, true);          // UTC: 12:46 PM Local: 10:16 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 9, 17, 56, 0, true);           // UTC: 5:56 PM Local: 3:26 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 25, 1, 47, 0, true);           // UTC: 1:47 AM Local: 11:17 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 22, 1, 2, 0, true);            // UTC: 1:02 AM Local: 10:32 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 21, 22, 2, 0, true);           // UTC: 10:02 PM Local: 7:32 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 30, 20, 3, 0, true);           // UTC: 8:03 PM Local: 5:33 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 21, 5, 43, 0, true);           // UTC: 5:43 AM Local: 3:13 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 9, 21, 3, 0, true);            // UTC: 9:03 PM Local: 6:33 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 23, 5, 43, 0, true);           // UTC: 5:43 AM Local: 3:13 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 7, 23, 22, 0, true);           // UTC: 11:22 PM Local: 8:52 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 27, 21, 12, 0, true);          // UTC: 9:12 PM Local: 6:42 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 13, 1, 22, 0, true);           // UTC: 1:22 AM Local: 10:52 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 7, 2, 16, 35, 0, true);           // UTC: 4:35 PM Local: 2:05 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 2, 20, 7, 0, true);            // UTC: 8:07 PM Local: 5:37 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 4, 14, 31, 0, true);           // UTC: 2:31 PM Local: 12:01 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 11, 21, 10, 0, true);          // UTC: 9:10 PM Local: 6:40 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 5, 18, 29, 0, true);           // UTC: 6:29 PM Local: 3:59 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 1, 7, 37, 0, true);            // UTC: 7:37 AM Local: 5:07 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 20, 5, 2, 0, true);            // UTC: 5:02 AM Local: 2:32 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 12, 20, 54, 0, true);          // UTC: 8:54 PM Local: 6:24 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 27, 10, 7, 0, true);           // UTC: 10:07 AM Local: 7:37 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 25, 8, 49, 0, true);           // UTC: 8:49 AM Local: 6:19 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 9, 7, 12, 0, true);            // UTC: 7:12 AM Local: 4:42 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 23, 19, 41, 0, true);          // UTC: 7:41 PM Local: 5:11 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 27, 14, 7, 0, true);           // UTC: 2:07 PM Local: 11:37 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 23, 13, 58, 0, true);          // UTC: 1:58 PM Local: 11:28 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 30, 13, 24, 0, true);          // UTC: 1:24 PM Local: 10:54 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 29, 5, 21, 0, true);           // UTC: 5:21 AM Local: 2:51 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 27, 18, 5, 0, true);           // UTC: 6:05 PM Local: 3:35 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 18, 10, 29, 0, true);          // UTC: 10:29 AM Local: 7:59 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 4, 20, 36, 0, true);           // UTC: 8:36 PM Local: 6:06 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 31, 3, 26, 0, true);           // UTC: 3:26 AM Local: 12:56 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 20, 4, 10, 0, true);           // UTC: 4:10 AM Local: 1:40 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 8, 21, 52, 0, true);           // UTC: 9:52 PM Local: 7:22 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 16, 21, 19, 0, true);          // UTC: 9:19 PM Local: 6:49 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 15, 4, 39, 0, true);           // UTC: 4:39 AM Local: 2:09 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 25, 2, 12, 0, true);           // UTC: 2:12 AM Local: 11:42 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 8, 14, 10, 27, 0, true);          // UTC: 10:27 AM Local: 7:57 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 30, 21, 56, 0, true);          // UTC: 9:56 PM Local: 7:26 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 17, 23, 8, 0, true);           // UTC: 11:08 PM Local: 8:38 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 21, 4, 53, 0, true);           // UTC: 4:53 AM Local: 2:23 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 1, 21, 26, 0, true);           // UTC: 9:26 PM Local: 6:56 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 24, 19, 25, 0, true);          // UTC: 7:25 PM Local: 4:55 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 17, 18, 37, 0, true);          // UTC: 6:37 PM Local: 4:07 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 1, 5, 52, 0, true);            // UTC: 5:52 AM Local: 3:22 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 22, 2, 32, 0, true);           // UTC: 2:32 AM Local: 12:02 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 4, 16, 55, 0, true);           // UTC: 4:55 PM Local: 2:25 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 2, 1, 46, 0, true);            // UTC: 1:46 AM Local: 11:16 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 26, 9, 54, 0, true);           // UTC: 9:54 AM Local: 7:24 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 20, 12, 33, 0, true);          // UTC: 12:33 PM Local: 10:03 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 19, 2, 3, 0, true);            // UTC: 2:03 AM Local: 11:33 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 6, 17, 39, 0, true);           // UTC: 5:39 PM Local: 3:09 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 19, 13, 37, 0, true);          // UTC: 1:37 PM Local: 11:07 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 19, 0, 4, 0, true);            // UTC: 12:04 AM Local: 9:34 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 15, 5, 8, 0, true);            // UTC: 5:08 AM Local: 2:38 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 18, 3, 37, 0, true);           // UTC: 3:37 AM Local: 1:07 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 12, 19, 35, 0, true);          // UTC: 7:35 PM Local: 5:05 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 19, 8, 9, 0, true);            // UTC: 8:09 AM Local: 5:39 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 13, 5, 11, 0, true);           // UTC: 5:11 AM Local: 2:41 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 26, 5, 14, 0, true);           // UTC: 5:14 AM Local: 2:44 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 27, 23, 17, 0, true);          // UTC: 11:17 PM Local: 8:47 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 15, 18, 32, 0, true);          // UTC: 6:32 PM Local: 4:02 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 9, 3, 8, 56, 0, true);            // UTC: 8:56 AM Local: 6:26 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 21, 0, 12, 0, true);          // UTC: 12:12 AM Local: 9:42 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 28, 19, 1, 0, true);          // UTC: 7:01 PM Local: 4:31 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 21, 12, 15, 0, true);         // UTC: 12:15 PM Local: 9:45 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 15, 19, 16, 0, true);         // UTC: 7:16 PM Local: 4:46 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 9, 8, 37, 0, true);           // UTC: 8:37 AM Local: 6:07 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 12, 12, 14, 0, true);         // UTC: 12:14 PM Local: 9:44 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 15, 23, 0, 0, true);          // UTC: 11:00 PM Local: 8:30 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 22, 19, 9, 0, true);          // UTC: 7:09 PM Local: 4:39 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 31, 23, 56, 0, true);         // UTC: 11:56 PM Local: 9:26 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 19, 9, 6, 0, true);           // UTC: 9:06 AM Local: 6:36 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 29, 23, 57, 0, true);         // UTC: 11:57 PM Local: 9:27 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 30, 1, 35, 0, true);          // UTC: 1:35 AM Local: 11:05 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 17, 21, 55, 0, true);         // UTC: 9:55 PM Local: 7:25 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 12, 12, 18, 0, true);         // UTC: 12:18 PM Local: 9:48 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 11, 15, 43, 0, true);         // UTC: 3:43 PM Local: 1:13 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 28, 2, 0, 0, true);           // UTC: 2:00 AM Local: 11:30 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 3, 21, 0, 0, true);           // UTC: 9:00 PM Local: 6:30 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 23, 20, 46, 0, true);         // UTC: 8:46 PM Local: 6:16 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 9, 10, 41, 0, true);          // UTC: 10:41 AM Local: 8:11 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 19, 23, 34, 0, true);         // UTC: 11:34 PM Local: 9:04 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 5, 14, 49, 0, true);          // UTC: 2:49 PM Local: 12:19 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 24, 19, 5, 0, true);          // UTC: 7:05 PM Local: 4:35 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 19, 5, 41, 0, true);          // UTC: 5:41 AM Local: 3:11 AM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 7, 19, 46, 0, true);          // UTC: 7:46 PM Local: 5:16 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 10, 5, 1, 9, 0, true);            // UTC: 1:09 AM Local: 10:39 PM Offset: -02:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 6, 0, 31, 0, false);          // UTC: 12:31 AM Local: 9:01 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 11, 22, 13, 0, false);        // UTC: 10:13 PM Local: 6:43 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 6, 19, 33, 0, false);         // UTC: 7:33 PM Local: 4:03 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 4, 4, 51, 0, false);          // UTC: 4:51 AM Local: 1:21 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 17, 6, 50, 0, false);         // UTC: 6:50 AM Local: 3:20 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 25, 15, 18, 0, false);        // UTC: 3:18 PM Local: 11:48 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 2, 14, 59, 0, false);         // UTC: 2:59 PM Local: 11:29 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 25, 17, 7, 0, false);         // UTC: 5:07 PM Local: 1:37 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 30, 2, 48, 0, false);         // UTC: 2:48 AM Local: 11:18 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 1, 8, 52, 0, false);          // UTC: 8:52 AM Local: 5:22 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 20, 23, 42, 0, false);        // UTC: 11:42 PM Local: 8:12 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 28, 16, 43, 0, false);        // UTC: 4:43 PM Local: 1:13 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 19, 23, 58, 0, false);        // UTC: 11:58 PM Local: 8:28 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 4, 5, 44, 0, false);          // UTC: 5:44 AM Local: 2:14 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 16, 3, 14, 0, false);         // UTC: 3:14 AM Local: 11:44 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 22, 19, 39, 0, false);        // UTC: 7:39 PM Local: 4:09 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 14, 16, 5, 0, false);         // UTC: 4:05 PM Local: 12:35 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 8, 13, 51, 0, false);         // UTC: 1:51 PM Local: 10:21 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 1, 17, 10, 0, false);         // UTC: 5:10 PM Local: 1:40 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 27, 14, 29, 0, false);        // UTC: 2:29 PM Local: 10:59 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 15, 6, 40, 0, false);         // UTC: 6:40 AM Local: 3:10 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 10, 18, 1, 0, false);         // UTC: 6:01 PM Local: 2:31 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 25, 16, 36, 0, false);        // UTC: 4:36 PM Local: 1:06 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 15, 1, 33, 0, false);         // UTC: 1:33 AM Local: 10:03 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 11, 15, 19, 24, 0, false);        // UTC: 7:24 PM Local: 3:54 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 24, 3, 53, 0, false);         // UTC: 3:53 AM Local: 12:23 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 30, 3, 10, 0, false);         // UTC: 3:10 AM Local: 11:40 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 24, 15, 1, 0, false);         // UTC: 3:01 PM Local: 11:31 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 29, 15, 20, 0, false);        // UTC: 3:20 PM Local: 11:50 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 10, 16, 10, 0, false);        // UTC: 4:10 PM Local: 12:40 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 7, 2, 29, 0, false);          // UTC: 2:29 AM Local: 10:59 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 30, 6, 47, 0, false);         // UTC: 6:47 AM Local: 3:17 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 24, 7, 57, 0, false);         // UTC: 7:57 AM Local: 4:27 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 31, 17, 23, 0, false);        // UTC: 5:23 PM Local: 1:53 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 27, 3, 49, 0, false);         // UTC: 3:49 AM Local: 12:19 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 22, 14, 49, 0, false);        // UTC: 2:49 PM Local: 11:19 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 15, 6, 50, 0, false);         // UTC: 6:50 AM Local: 3:20 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 15, 9, 53, 0, false);         // UTC: 9:53 AM Local: 6:23 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 19, 1, 44, 0, false);         // UTC: 1:44 AM Local: 10:14 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 31, 18, 12, 0, false);        // UTC: 6:12 PM Local: 2:42 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 7, 16, 46, 0, false);         // UTC: 4:46 PM Local: 1:16 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 10, 4, 2, 0, false);          // UTC: 4:02 AM Local: 12:32 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 10, 19, 18, 0, false);        // UTC: 7:18 PM Local: 3:48 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 6, 13, 49, 0, false);         // UTC: 1:49 PM Local: 10:19 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 27, 16, 28, 0, false);        // UTC: 4:28 PM Local: 12:58 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 27, 11, 9, 0, false);         // UTC: 11:09 AM Local: 7:39 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 5, 10, 1, 0, false);          // UTC: 10:01 AM Local: 6:31 AM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 27, 15, 43, 0, false);        // UTC: 3:43 PM Local: 12:13 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 10, 20, 33, 0, false);        // UTC: 8:33 PM Local: 5:03 PM Offset: -03:30:00
+	testCount++; failedCount += test(timeManager, 22, 2020, 12, 22, 7, 19, 0, false);         // UTC: 7:19 AM Local: 3:49 AM Offset: -03:30:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
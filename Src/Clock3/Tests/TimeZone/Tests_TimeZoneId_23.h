@@ -0,0 +1,915 @@
+#ifndef TEST_TIMEZONEID_23_H
+#define TEST_TIMEZONEID_23_H
+
+#include "TimeManager.h"
+#include "TestHelper.h"
+
+void run_TimeZoneId_23_Tests(const TimeManager& timeManager)
+{
+	uint16_t testCount = 0;
+	uint16_t failedCount = 0;
+
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 30, 9, 57, 0, false);          // UTC: 9:57 AM Local: 6:57 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 27, 2, 1, 0, false);           // UTC: 2:01 AM Local: 11:01 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 19, 9, 27, 0, false);          // UTC: 9:27 AM Local: 6:27 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 13, 16, 22, 0, false);         // UTC: 4:22 PM Local: 1:22 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 5, 23, 12, 0, false);          // UTC: 11:12 PM Local: 8:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 9, 14, 0, 0, false);           // UTC: 2:00 PM Local: 11:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 8, 19, 29, 0, false);          // UTC: 7:29 PM Local: 4:29 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 29, 0, 6, 0, false);           // UTC: 12:06 AM Local: 9:06 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 3, 22, 31, 0, false);          // UTC: 10:31 PM Local: 7:31 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 14, 0, 32, 0, false);          // UTC: 12:32 AM Local: 9:32 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 21, 23, 27, 0, false);         // UTC: 11:27 PM Local: 8:27 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 12, 1, 13, 0, false);          // UTC: 1:13 AM Local: 10:13 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 26, 1, 37, 0, false);          // UTC: 1:37 AM Local: 10:37 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 12, 21, 11, 0, false);         // UTC: 9:11 PM Local: 6:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 20, 6, 47, 0, false);          // UTC: 6:47 AM Local: 3:47 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 12, 18, 48, 0, false);         // UTC: 6:48 PM Local: 3:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 28, 11, 36, 0, false);         // UTC: 11:36 AM Local: 8:36 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 10, 21, 20, 0, false);         // UTC: 9:20 PM Local: 6:20 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 19, 2, 52, 0, false);          // UTC: 2:52 AM Local: 11:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 16, 5, 45, 0, false);          // UTC: 5:45 AM Local: 2:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 16, 18, 50, 0, false);         // UTC: 6:50 PM Local: 3:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 15, 21, 41, 0, false);         // UTC: 9:41 PM Local: 6:41 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 6, 5, 51, 0, false);           // UTC: 5:51 AM Local: 2:51 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 6, 17, 20, 0, false);          // UTC: 5:20 PM Local: 2:20 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 1, 22, 16, 12, 0, false);         // UTC: 4:12 PM Local: 1:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 19, 3, 5, 0, false);           // UTC: 3:05 AM Local: 12:05 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 4, 13, 2, 0, false);           // UTC: 1:02 PM Local: 10:02 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 19, 8, 36, 0, false);          // UTC: 8:36 AM Local: 5:36 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 9, 18, 21, 0, false);          // UTC: 6:21 PM Local: 3:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 4, 11, 57, 0, false);          // UTC: 11:57 AM Local: 8:57 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 10, 17, 19, 0, false);         // UTC: 5:19 PM Local: 2:19 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 25, 14, 35, 0, false);         // UTC: 2:35 PM Local: 11:35 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 7, 8, 9, 0, false);            // UTC: 8:09 AM Local: 5:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 4, 19, 50, 0, false);          // UTC: 7:50 PM Local: 4:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 4, 22, 50, 0, false);          // UTC: 10:50 PM Local: 7:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 27, 15, 15, 0, false);         // UTC: 3:15 PM Local: 12:15 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 11, 17, 9, 0, false);          // UTC: 5:09 PM Local: 2:09 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 24, 18, 6, 0, false);          // UTC: 6:06 PM Local: 3:06 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 13, 5, 28, 0, false);          // UTC: 5:28 AM Local: 2:28 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 2, 1, 40, 0, false);           // UTC: 1:40 AM Local: 10:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 14, 12, 1, 0, false);          // UTC: 12:01 PM Local: 9:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 6, 7, 43, 0, false);           // UTC: 7:43 AM Local: 4:43 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 1, 7, 51, 0, false);           // UTC: 7:51 AM Local: 4:51 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 24, 1, 34, 0, false);          // UTC: 1:34 AM Local: 10:34 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 15, 23, 5, 0, false);          // UTC: 11:05 PM Local: 8:05 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 12, 0, 50, 0, false);          // UTC: 12:50 AM Local: 9:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 13, 15, 12, 0, false);         // UTC: 3:12 PM Local: 12:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 2, 2, 16, 0, false);           // UTC: 2:16 AM Local: 11:16 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 15, 17, 12, 0, false);         // UTC: 5:12 PM Local: 2:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 2, 25, 14, 18, 0, false);         // UTC: 2:18 PM Local: 11:18 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 7, 2, 6, 0, false);            // UTC: 2:06 AM Local: 11:06 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 18, 16, 41, 0, false);         // UTC: 4:41 PM Local: 1:41 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 6, 22, 34, 0, false);          // UTC: 10:34 PM Local: 7:34 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 18, 7, 16, 0, false);          // UTC: 7:16 AM Local: 4:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 4, 13, 10, 0, false);          // UTC: 1:10 PM Local: 10:10 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 29, 0, 28, 0, false);          // UTC: 12:28 AM Local: 9:28 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 25, 10, 42, 0, false);         // UTC: 10:42 AM Local: 7:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 29, 13, 52, 0, false);         // UTC: 1:52 PM Local: 10:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 6, 19, 44, 0, false);          // UTC: 7:44 PM Local: 4:44 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 26, 13, 4, 0, false);          // UTC: 1:04 PM Local: 10:04 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 23, 20, 47, 0, false);         // UTC: 8:47 PM Local: 5:47 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 8, 17, 18, 0, false);          // UTC: 5:18 PM Local: 2:18 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 14, 13, 19, 0, false);         // UTC: 1:19 PM Local: 10:19 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 25, 17, 39, 0, false);         // UTC: 5:39 PM Local: 2:39 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 18, 1, 52, 0, false);          // UTC: 1:52 AM Local: 10:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 10, 3, 1, 0, false);           // UTC: 3:01 AM Local: 12:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 21, 4, 21, 0, false);          // UTC: 4:21 AM Local: 1:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 31, 17, 46, 0, false);         // UTC: 5:46 PM Local: 2:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 27, 13, 15, 0, false);         // UTC: 1:15 PM Local: 10:15 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 6, 21, 5, 0, false);           // UTC: 9:05 PM Local: 6:05 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 11, 17, 44, 0, false);         // UTC: 5:44 PM Local: 2:44 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 18, 3, 15, 0, false);          // UTC: 3:15 AM Local: 12:15 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 29, 17, 30, 0, false);         // UTC: 5:30 PM Local: 2:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 26, 14, 45, 0, false);         // UTC: 2:45 PM Local: 11:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 3, 9, 0, 21, 0, false);           // UTC: 12:21 AM Local: 9:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 13, 0, 50, 0, false);          // UTC: 12:50 AM Local: 9:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 5, 23, 55, 0, false);          // UTC: 11:55 PM Local: 8:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 13, 6, 50, 0, false);          // UTC: 6:50 AM Local: 3:50 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 22, 0, 11, 0, false);          // UTC: 12:11 AM Local: 9:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 21, 14, 47, 0, false);         // UTC: 2:47 PM Local: 11:47 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 14, 2, 26, 0, false);          // UTC: 2:26 AM Local: 11:26 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 23, 8, 30, 0, false);          // UTC: 8:30 AM Local: 5:30 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 20, 22, 34, 0, false);         // UTC: 10:34 PM Local: 7:34 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 24, 17, 11, 0, false);         // UTC: 5:11 PM Local: 2:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 17, 17, 19, 0, false);         // UTC: 5:19 PM Local: 2:19 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 9, 2, 14, 0, false);           // UTC: 2:14 AM Local: 11:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 29, 1, 55, 0, false);          // UTC: 1:55 AM Local: 10:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 29, 15, 24, 0, false);         // UTC: 3:24 PM Local: 12:24 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 25, 0, 43, 0, false);          // UTC: 12:43 AM Local: 9:43 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 15, 19, 26, 0, false);         // UTC: 7:26 PM Local: 4:26 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 10, 21, 20, 0, false);         // UTC: 9:20 PM Local: 6:20 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 14, 11, 51, 0, false);         // UTC: 11:51 AM Local: 8:51 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 10, 8, 59, 0, false);          // UTC: 8:59 AM Local: 5:59 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 11, 5, 24, 0, false);          // UTC: 5:24 AM Local: 2:24 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 2, 13, 56, 0, false);          // UTC: 1:56 PM Local: 10:56 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 27, 21, 30, 0, false);         // UTC: 9:30 PM Local: 6:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 25, 17, 56, 0, false);         // UTC: 5:56 PM Local: 2:56 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 9, 17, 17, 0, false);          // UTC: 5:17 PM Local: 2:17 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 23, 2, 24, 0, false);          // UTC: 2:24 AM Local: 11:24 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 4, 7, 8, 54, 0, false);           // UTC: 8:54 AM Local: 5:54 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 5, 16, 23, 0, false);          // UTC: 4:23 PM Local: 1:23 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 4, 19, 29, 0, false);          // UTC: 7:29 PM Local: 4:29 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 4, 8, 36, 0, false);           // UTC: 8:36 AM Local: 5:36 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 25, 14, 0, 0, false);          // UTC: 2:00 PM Local: 11:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 28, 1, 16, 0, false);          // UTC: 1:16 AM Local: 10:16 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 26, 3, 15, 0, false);          // UTC: 3:15 AM Local: 12:15 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 25, 18, 40, 0, false);         // UTC: 6:40 PM Local: 3:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 16, 1, 26, 0, false);          // UTC: 1:26 AM Local: 10:26 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 26, 2, 17, 0, false);          // UTC: 2:17 AM Local: 11:17 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 7, 11, 36, 0, false);          // UTC: 11:36 AM Local: 8:36 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 5, 19, 53, 0, false);          // UTC: 7:53 PM Local: 4:53 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 25, 2, 11, 0, false);          // UTC: 2:11 AM Local: 11:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 24, 16, 25, 0, false);         // UTC: 4:25 PM Local: 1:25 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 20, 21, 23, 0, false);         // UTC: 9:23 PM Local: 6:23 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 10, 2, 39, 0, false);          // UTC: 2:39 AM Local: 11:39 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 30, 22, 41, 0, false);         // UTC: 10:41 PM Local: 7:41 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 20, 5, 2, 0, false);           // UTC: 5:02 AM Local: 2:02 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 4, 23, 11, 0, false);          // UTC: 11:11 PM Local: 8:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 1, 4, 39, 0, false);           // UTC: 4:39 AM Local: 1:39 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 22, 4, 59, 0, false);          // UTC: 4:59 AM Local: 1:59 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 24, 9, 30, 0, false);          // UTC: 9:30 AM Local: 6:30 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 29, 22, 18, 0, false);         // UTC: 10:18 PM Local: 7:18 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 19, 1, 52, 0, false);          // UTC: 1:52 AM Local: 10:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 2, 19, 48, 0, false);          // UTC: 7:48 PM Local: 4:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 5, 19, 3, 20, 0, false);          // UTC: 3:20 AM Local: 12:20 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 1, 4, 22, 0, false);           // UTC: 4:22 AM Local: 1:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 3, 5, 54, 0, false);           // UTC: 5:54 AM Local: 2:54 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 7, 6, 27, 0, false);           // UTC: 6:27 AM Local: 3:27 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 11, 19, 14, 0, false);         // UTC: 7:14 PM Local: 4:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 18, 18, 54, 0, false);         // UTC: 6:54 PM Local: 3:54 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 14, 21, 23, 0, false);         // UTC: 9:23 PM Local: 6:23 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 18, 20, 14, 0, false);         // UTC: 8:14 PM Local: 5:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 24, 17, 59, 0, false);         // UTC: 5:59 PM Local: 2:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 24, 9, 29, 0, false);          // UTC: 9:29 AM Local: 6:29 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 29, 21, 40, 0, false);         // UTC: 9:40 PM Local: 6:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 5, 11, 24, 0, false);          // UTC: 11:24 AM Local: 8:24 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 25, 9, 53, 0, false);          // UTC: 9:53 AM Local: 6:53 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 30, 1, 31, 0, false);          // UTC: 1:31 AM Local: 10:31 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 13, 11, 46, 0, false);         // UTC: 11:46 AM Local: 8:46 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 7, 20, 34, 0, false);          // UTC: 8:34 PM Local: 5:34 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 6, 6, 20, 0, false);           // UTC: 6:20 AM Local: 3:20 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 14, 13, 3, 0, false);          // UTC: 1:03 PM Local: 10:03 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 2, 10, 47, 0, false);          // UTC: 10:47 AM Local: 7:47 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 14, 15, 52, 0, false);         // UTC: 3:52 PM Local: 12:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 6, 18, 59, 0, false);          // UTC: 6:59 PM Local: 3:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 14, 11, 15, 0, false);         // UTC: 11:15 AM Local: 8:15 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 11, 1, 42, 0, false);          // UTC: 1:42 AM Local: 10:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 10, 14, 52, 0, false);         // UTC: 2:52 PM Local: 11:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 6, 12, 52, 0, false);          // UTC: 12:52 PM Local: 9:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 6, 12, 18, 31, 0, false);         // UTC: 6:31 PM Local: 3:31 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 31, 0, 34, 0, false);          // UTC: 12:34 AM Local: 9:34 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 29, 19, 40, 0, false);         // UTC: 7:40 PM Local: 4:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 14, 19, 11, 0, false);         // UTC: 7:11 PM Local: 4:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 30, 14, 12, 0, false);         // UTC: 2:12 PM Local: 11:12 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 22, 13, 4, 0, false);          // UTC: 1:04 PM Local: 10:04 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 15, 0, 25, 0, false);          // UTC: 12:25 AM Local: 9:25 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 21, 12, 16, 0, false);         // UTC: 12:16 PM Local: 9:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 2, 23, 2, 0, false);           // UTC: 11:02 PM Local: 8:02 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 14, 12, 22, 0, false);         // UTC: 12:22 PM Local: 9:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 31, 23, 42, 0, false);         // UTC: 11:42 PM Local: 8:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 23, 21, 55, 0, false);         // UTC: 9:55 PM Local: 6:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 9, 23, 10, 0, false);          // UTC: 11:10 PM Local: 8:10 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 5, 19, 4, 0, false);           // UTC: 7:04 PM Local: 4:04 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 25, 18, 51, 0, false);         // UTC: 6:51 PM Local: 3:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 17, 14, 34, 0, false);         // UTC: 2:34 PM Local: 11:34 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 25, 3, 59, 0, false);          // UTC: 3:59 AM Local: 12:59 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 3, 13, 30, 0, false);          // UTC: 1:30 PM Local: 10:30 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 22, 4, 41, 0, false);          // UTC: 4:41 AM Local: 1:41 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 26, 9, 7, 0, false);           // UTC: 9:07 AM Local: 6:07 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 20, 0, 48, 0, false);          // UTC: 12:48 AM Local: 9:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 17, 19, 13, 0, false);         // UTC: 7:13 PM Local: 4:13 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 18, 20, 12, 0, false);         // UTC: 8:12 PM Local: 5:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 28, 11, 50, 0, false);         // UTC: 11:50 AM Local: 8:50 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 10, 8, 45, 0, false);          // UTC: 8:45 AM Local: 5:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 7, 10, 13, 31, 0, false);         // UTC: 1:31 PM Local: 10:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 30, 17, 50, 0, false);         // UTC: 5:50 PM Local: 2:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 18, 9, 21, 0, false);          // UTC: 9:21 AM Local: 6:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 31, 23, 1, 0, false);          // UTC: 11:01 PM Local: 8:01 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 8, 21, 36, 0, false);          // UTC: 9:36 PM Local: 6:36 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 26, 17, 9, 0, false);          // UTC: 5:09 PM Local: 2:09 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 3, 22, 49, 0, false);          // UTC: 10:49 PM Local: 7:49 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 31, 4, 42, 0, false);          // UTC: 4:42 AM Local: 1:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 30, 3, 44, 0, false);          // UTC: 3:44 AM Local: 12:44 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 30, 9, 16, 0, false);          // UTC: 9:16 AM Local: 6:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 4, 18, 5, 0, false);           // UTC: 6:05 PM Local: 3:05 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 27, 2, 50, 0, false);          // UTC: 2:50 AM Local: 11:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 2, 23, 30, 0, false);          // UTC: 11:30 PM Local: 8:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 31, 20, 2, 0, false);          // UTC: 8:02 PM Local: 5:02 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 17, 8, 17, 0, false);          // UTC: 8:17 AM Local: 5:17 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 18, 18, 26, 0, false);         // UTC: 6:26 PM Local: 3:26 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 21, 20, 0, 0, false);          // UTC: 8:00 PM Local: 5:00 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 29, 6, 58, 0, false);          // UTC: 6:58 AM Local: 3:58 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 24, 21, 46, 0, false);         // UTC: 9:46 PM Local: 6:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 22, 2, 42, 0, false);          // UTC: 2:42 AM Local: 11:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 27, 4, 11, 0, false);          // UTC: 4:11 AM Local: 1:11 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 27, 6, 31, 0, false);          // UTC: 6:31 AM Local: 3:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 2, 23, 42, 0, false);          // UTC: 11:42 PM Local: 8:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 29, 4, 16, 0, false);          // UTC: 4:16 AM Local: 1:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 30, 0, 38, 0, false);          // UTC: 12:38 AM Local: 9:38 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 8, 26, 12, 48, 0, false);         // UTC: 12:48 PM Local: 9:48 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 2, 18, 48, 0, false);          // UTC: 6:48 PM Local: 3:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 19, 13, 51, 0, false);         // UTC: 1:51 PM Local: 10:51 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 2, 20, 1, 0, false);           // UTC: 8:01 PM Local: 5:01 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 5, 4, 50, 0, false);           // UTC: 4:50 AM Local: 1:50 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 1, 11, 41, 0, false);          // UTC: 11:41 AM Local: 8:41 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 19, 16, 35, 0, false);         // UTC: 4:35 PM Local: 1:35 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 29, 13, 0, 0, false);          // UTC: 1:00 PM Local: 10:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 28, 15, 5, 0, false);          // UTC: 3:05 PM Local: 12:05 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 15, 10, 18, 0, false);         // UTC: 10:18 AM Local: 7:18 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 22, 22, 39, 0, false);         // UTC: 10:39 PM Local: 7:39 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 2, 5, 13, 0, false);           // UTC: 5:13 AM Local: 2:13 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 10, 3, 9, 0, false);           // UTC: 3:09 AM Local: 12:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 6, 4, 52, 0, false);           // UTC: 4:52 AM Local: 1:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 19, 21, 7, 0, false);          // UTC: 9:07 PM Local: 6:07 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 20, 13, 48, 0, false);         // UTC: 1:48 PM Local: 10:48 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 17, 6, 51, 0, false);          // UTC: 6:51 AM Local: 3:51 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 6, 16, 43, 0, false);          // UTC: 4:43 PM Local: 1:43 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 18, 20, 37, 0, false);         // UTC: 8:37 PM Local: 5:37 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 20, 6, 53, 0, false);          // UTC: 6:53 AM Local: 3:53 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 3, 8, 42, 0, false);           // UTC: 8:42 AM Local: 5:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 20, 3, 52, 0, false);          // UTC: 3:52 AM Local: 12:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 19, 22, 51, 0, false);         // UTC: 10:51 PM Local: 7:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 27, 4, 7, 0, false);           // UTC: 4:07 AM Local: 1:07 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 17, 13, 22, 0, false);         // UTC: 1:22 PM Local: 10:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 9, 3, 6, 43, 0, false);           // UTC: 6:43 AM Local: 3:43 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 17, 12, 21, 0, false);        // UTC: 12:21 PM Local: 9:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 25, 3, 45, 0, false);         // UTC: 3:45 AM Local: 12:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 8, 4, 23, 0, false);          // UTC: 4:23 AM Local: 1:23 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 21, 13, 29, 0, false);        // UTC: 1:29 PM Local: 10:29 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 7, 5, 35, 0, false);          // UTC: 5:35 AM Local: 2:35 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 18, 7, 21, 0, false);         // UTC: 7:21 AM Local: 4:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 2, 18, 37, 0, false);         // UTC: 6:37 PM Local: 3:37 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 4, 4, 47, 0, false);          // UTC: 4:47 AM Local: 1:47 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 28, 4, 4, 0, false);          // UTC: 4:04 AM Local: 1:04 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 18, 11, 40, 0, false);        // UTC: 11:40 AM Local: 8:40 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 2, 1, 28, 0, false);          // UTC: 1:28 AM Local: 10:28 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 27, 1, 10, 0, false);         // UTC: 1:10 AM Local: 10:10 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 30, 8, 22, 0, false);         // UTC: 8:22 AM Local: 5:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 24, 6, 29, 0, false);         // UTC: 6:29 AM Local: 3:29 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 23, 21, 21, 0, false);        // UTC: 9:21 PM Local: 6:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 10, 2, 51, 0, false);         // UTC: 2:51 AM Local: 11:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 14, 15, 50, 0, false);        // UTC: 3:50 PM Local: 12:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 26, 3, 25, 0, false);         // UTC: 3:25 AM Local: 12:25 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 18, 21, 24, 0, false);        // UTC: 9:24 PM Local: 6:24 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 13, 20, 46, 0, false);        // UTC: 8:46 PM Local: 5:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 1, 5, 36, 0, false);          // UTC: 5:36 AM Local: 2:36 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 29, 20, 4, 0, false);         // UTC: 8:04 PM Local: 5:04 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 1, 1, 54, 0, false);          // UTC: 1:54 AM Local: 10:54 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 30, 10, 44, 0, false);        // UTC: 10:44 AM Local: 7:44 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 10, 5, 3, 54, 0, false);          // UTC: 3:54 AM Local: 12:54 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 24, 21, 49, 0, false);        // UTC: 9:49 PM Local: 6:49 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 21, 20, 54, 0, false);        // UTC: 8:54 PM Local: 5:54 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 11, 12, 40, 0, false);        // UTC: 12:40 PM Local: 9:40 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 30, 22, 9, 0, false);         // UTC: 10:09 PM Local: 7:09 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 14, 9, 8, 0, false);          // UTC: 9:08 AM Local: 6:08 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 17, 8, 33, 0, false);         // UTC: 8:33 AM Local: 5:33 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 18, 19, 40, 0, false);        // UTC: 7:40 PM Local: 4:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 26, 19, 36, 0, false);        // UTC: 7:36 PM Local: 4:36 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 20, 20, 32, 0, false);        // UTC: 8:32 PM Local: 5:32 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 13, 21, 47, 0, false);        // UTC: 9:47 PM Local: 6:47 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 6, 19, 17, 0, false);         // UTC: 7:17 PM Local: 4:17 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 13, 23, 21, 0, false);        // UTC: 11:21 PM Local: 8:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 24, 4, 52, 0, false);         // UTC: 4:52 AM Local: 1:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 1, 10, 50, 0, false);         // UTC: 10:50 AM Local: 7:50 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 10, 17, 5, 0, false);         // UTC: 5:05 PM Local: 2:05 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 29, 15, 30, 0, false);        // UTC: 3:30 PM Local: 12:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 12, 22, 59, 0, false);        // UTC: 10:59 PM Local: 7:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 2, 13, 42, 0, false);         // UTC: 1:42 PM Local: 10:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 25, 2, 17, 0, false);         // UTC: 2:17 AM Local: 11:17 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 6, 3, 1, 0, false);           // UTC: 3:01 AM Local: 12:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 20, 19, 14, 0, false);        // UTC: 7:14 PM Local: 4:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 29, 11, 27, 0, false);        // UTC: 11:27 AM Local: 8:27 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 29, 7, 38, 0, false);         // UTC: 7:38 AM Local: 4:38 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 3, 20, 33, 0, false);         // UTC: 8:33 PM Local: 5:33 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 11, 23, 8, 16, 0, false);         // UTC: 8:16 AM Local: 5:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 31, 6, 13, 0, false);         // UTC: 6:13 AM Local: 3:13 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 22, 5, 34, 0, false);         // UTC: 5:34 AM Local: 2:34 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 5, 15, 46, 0, false);         // UTC: 3:46 PM Local: 12:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 11, 23, 49, 0, false);        // UTC: 11:49 PM Local: 8:49 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 24, 13, 21, 0, false);        // UTC: 1:21 PM Local: 10:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 12, 17, 14, 0, false);        // UTC: 5:14 PM Local: 2:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 19, 13, 54, 0, false);        // UTC: 1:54 PM Local: 10:54 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 24, 1, 47, 0, false);         // UTC: 1:47 AM Local: 10:47 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 13, 10, 37, 0, false);        // UTC: 10:37 AM Local: 7:37 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 26, 23, 7, 0, false);         // UTC: 11:07 PM Local: 8:07 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 3, 1, 8, 0, false);           // UTC: 1:08 AM Local: 10:08 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 4, 5, 7, 0, false);           // UTC: 5:07 AM Local: 2:07 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 28, 13, 18, 0, false);        // UTC: 1:18 PM Local: 10:18 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 28, 4, 22, 0, false);         // UTC: 4:22 AM Local: 1:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 6, 3, 57, 0, false);          // UTC: 3:57 AM Local: 12:57 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 22, 11, 21, 0, false);        // UTC: 11:21 AM Local: 8:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 10, 18, 55, 0, false);        // UTC: 6:55 PM Local: 3:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 24, 14, 58, 0, false);        // UTC: 2:58 PM Local: 11:58 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 24, 19, 13, 0, false);        // UTC: 7:13 PM Local: 4:13 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 28, 18, 48, 0, false);        // UTC: 6:48 PM Local: 3:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 13, 19, 47, 0, false);        // UTC: 7:47 PM Local: 4:47 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 20, 9, 32, 0, false);         // UTC: 9:32 AM Local: 6:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 2, 20, 50, 0, false);         // UTC: 8:50 PM Local: 5:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 6, 23, 40, 0, false);         // UTC: 11:40 PM Local: 8:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2018, 12, 27, 1, 52, 0, false);         // UTC: 1:52 AM Local: 10:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 15, 17, 25, 0, false);         // UTC: 5:25 PM Local: 2:25 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 21, 20, 2, 0, false);          // UTC: 8:02 PM Local: 5:02 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 5, 15, 0, 0, false);           // UTC: 3:00 PM Local: 12:00 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 24, 11, 58, 0, false);         // UTC: 11:58 AM Local: 8:58 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 26, 20, 28, 0, false);         // UTC: 8:28 PM Local: 5:28 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 25, 7, 34, 0, false);          // UTC: 7:34 AM Local: 4:34 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 29, 4, 42, 0, false);          // UTC: 4:42 AM Local: 1:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 23, 6, 45, 0, false);          // UTC: 6:45 AM Local: 3:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 2, 8, 56, 0, false);           // UTC: 8:56 AM Local: 5:56 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 26, 18, 12, 0, false);         // UTC: 6:12 PM Local: 3:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 4, 9, 31, 0, false);           // UTC: 9:31 AM Local: 6:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 19, 0, 51, 0, false);          // UTC: 12:51 AM Local: 9:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 9, 8, 31, 0, false);           // UTC: 8:31 AM Local: 5:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 17, 15, 11, 0, false);         // UTC: 3:11 PM Local: 12:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 28, 19, 27, 0, false);         // UTC: 7:27 PM Local: 4:27 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 14, 6, 7, 0, false);           // UTC: 6:07 AM Local: 3:07 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 23, 6, 59, 0, false);          // UTC: 6:59 AM Local: 3:59 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 13, 0, 55, 0, false);          // UTC: 12:55 AM Local: 9:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 14, 3, 47, 0, false);          // UTC: 3:47 AM Local: 12:47 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 28, 8, 11, 0, false);          // UTC: 8:11 AM Local: 5:11 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 9, 7, 13, 0, false);           // UTC: 7:13 AM Local: 4:13 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 8, 0, 40, 0, false);           // UTC: 12:40 AM Local: 9:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 22, 9, 32, 0, false);          // UTC: 9:32 AM Local: 6:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 7, 13, 5, 0, false);           // UTC: 1:05 PM Local: 10:05 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 1, 31, 5, 26, 0, false);          // UTC: 5:26 AM Local: 2:26 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 7, 6, 58, 0, false);           // UTC: 6:58 AM Local: 3:58 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 2, 17, 57, 0, false);          // UTC: 5:57 PM Local: 2:57 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 7, 2, 46, 0, false);           // UTC: 2:46 AM Local: 11:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 1, 0, 11, 0, false);           // UTC: 12:11 AM Local: 9:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 12, 1, 47, 0, false);          // UTC: 1:47 AM Local: 10:47 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 19, 0, 32, 0, false);          // UTC: 12:32 AM Local: 9:32 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 14, 22, 20, 0, false);         // UTC: 10:20 PM Local: 7:20 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 19, 15, 56, 0, false);         // UTC: 3:56 PM Local: 12:56 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 21, 2, 56, 0, false);          // UTC: 2:56 AM Local: 11:56 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 28, 7, 17, 0, false);          // UTC: 7:17 AM Local: 4:17 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 2, 4, 0, 0, false);            // UTC: 4:00 AM Local: 1:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 4, 1, 12, 0, false);           // UTC: 1:12 AM Local: 10:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 4, 2, 15, 0, false);           // UTC: 2:15 AM Local: 11:15 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 5, 2, 44, 0, false);           // UTC: 2:44 AM Local: 11:44 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 28, 14, 33, 0, false);         // UTC: 2:33 PM Local: 11:33 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 9, 15, 31, 0, false);          // UTC: 3:31 PM Local: 12:31 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 17, 22, 51, 0, false);         // UTC: 10:51 PM Local: 7:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 26, 1, 55, 0, false);          // UTC: 1:55 AM Local: 10:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 2, 17, 42, 0, false);          // UTC: 5:42 PM Local: 2:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 6, 0, 20, 0, false);           // UTC: 12:20 AM Local: 9:20 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 17, 19, 30, 0, false);         // UTC: 7:30 PM Local: 4:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 28, 0, 36, 0, false);          // UTC: 12:36 AM Local: 9:36 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 13, 7, 20, 0, false);          // UTC: 7:20 AM Local: 4:20 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 20, 18, 42, 0, false);         // UTC: 6:42 PM Local: 3:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 2, 2, 10, 48, 0, false);          // UTC: 10:48 AM Local: 7:48 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 30, 16, 35, 0, false);         // UTC: 4:35 PM Local: 1:35 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 28, 21, 59, 0, false);         // UTC: 9:59 PM Local: 6:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 27, 16, 54, 0, false);         // UTC: 4:54 PM Local: 1:54 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 30, 5, 31, 0, false);          // UTC: 5:31 AM Local: 2:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 12, 2, 13, 0, false);          // UTC: 2:13 AM Local: 11:13 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 26, 9, 53, 0, false);          // UTC: 9:53 AM Local: 6:53 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 30, 22, 52, 0, false);         // UTC: 10:52 PM Local: 7:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 11, 20, 42, 0, false);         // UTC: 8:42 PM Local: 5:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 20, 23, 19, 0, false);         // UTC: 11:19 PM Local: 8:19 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 10, 7, 26, 0, false);          // UTC: 7:26 AM Local: 4:26 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 8, 20, 57, 0, false);          // UTC: 8:57 PM Local: 5:57 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 2, 1, 4, 0, false);            // UTC: 1:04 AM Local: 10:04 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 28, 10, 25, 0, false);         // UTC: 10:25 AM Local: 7:25 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 21, 18, 24, 0, false);         // UTC: 6:24 PM Local: 3:24 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 23, 13, 57, 0, false);         // UTC: 1:57 PM Local: 10:57 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 30, 7, 37, 0, false);          // UTC: 7:37 AM Local: 4:37 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 3, 16, 10, 0, false);          // UTC: 4:10 PM Local: 1:10 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 8, 6, 27, 0, false);           // UTC: 6:27 AM Local: 3:27 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 23, 3, 34, 0, false);          // UTC: 3:34 AM Local: 12:34 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 3, 14, 36, 0, false);          // UTC: 2:36 PM Local: 11:36 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 22, 1, 30, 0, false);          // UTC: 1:30 AM Local: 10:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 9, 2, 24, 0, false);           // UTC: 2:24 AM Local: 11:24 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 27, 3, 33, 0, false);          // UTC: 3:33 AM Local: 12:33 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 26, 7, 2, 0, false);           // UTC: 7:02 AM Local: 4:02 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 3, 11, 5, 34, 0, false);          // UTC: 5:34 AM Local: 2:34 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 24, 12, 3, 0, false);          // UTC: 12:03 PM Local: 9:03 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 23, 23, 59, 0, false);         // UTC: 11:59 PM Local: 8:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 17, 8, 10, 0, false);          // UTC: 8:10 AM Local: 5:10 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 7, 10, 9, 0, false);           // UTC: 10:09 AM Local: 7:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 28, 4, 49, 0, false);          // UTC: 4:49 AM Local: 1:49 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 18, 5, 52, 0, false);          // UTC: 5:52 AM Local: 2:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 29, 11, 47, 0, false);         // UTC: 11:47 AM Local: 8:47 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 23, 15, 10, 0, false);         // UTC: 3:10 PM Local: 12:10 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 25, 23, 25, 0, false);         // UTC: 11:25 PM Local: 8:25 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 1, 1, 12, 0, false);           // UTC: 1:12 AM Local: 10:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 29, 17, 27, 0, false);         // UTC: 5:27 PM Local: 2:27 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 8, 18, 13, 0, false);          // UTC: 6:13 PM Local: 3:13 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 30, 11, 9, 0, false);          // UTC: 11:09 AM Local: 8:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 15, 0, 37, 0, false);          // UTC: 12:37 AM Local: 9:37 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 28, 17, 38, 0, false);         // UTC: 5:38 PM Local: 2:38 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 24, 15, 12, 0, false);         // UTC: 3:12 PM Local: 12:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 8, 17, 52, 0, false);          // UTC: 5:52 PM Local: 2:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 30, 14, 48, 0, false);         // UTC: 2:48 PM Local: 11:48 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 18, 14, 4, 0, false);          // UTC: 2:04 PM Local: 11:04 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 4, 14, 22, 0, false);          // UTC: 2:22 PM Local: 11:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 21, 17, 57, 0, false);         // UTC: 5:57 PM Local: 2:57 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 14, 10, 5, 0, false);          // UTC: 10:05 AM Local: 7:05 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 25, 7, 54, 0, false);          // UTC: 7:54 AM Local: 4:54 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 11, 5, 43, 0, false);          // UTC: 5:43 AM Local: 2:43 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 4, 10, 10, 55, 0, false);         // UTC: 10:55 AM Local: 7:55 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 28, 6, 1, 0, false);           // UTC: 6:01 AM Local: 3:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 12, 18, 42, 0, false);         // UTC: 6:42 PM Local: 3:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 15, 9, 56, 0, false);          // UTC: 9:56 AM Local: 6:56 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 28, 19, 15, 0, false);         // UTC: 7:15 PM Local: 4:15 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 7, 2, 10, 0, false);           // UTC: 2:10 AM Local: 11:10 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 20, 1, 48, 0, false);          // UTC: 1:48 AM Local: 10:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 2, 11, 5, 0, false);           // UTC: 11:05 AM Local: 8:05 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 8, 2, 35, 0, false);           // UTC: 2:35 AM Local: 11:35 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 3, 6, 24, 0, false);           // UTC: 6:24 AM Local: 3:24 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 17, 3, 21, 0, false);          // UTC: 3:21 AM Local: 12:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 8, 10, 38, 0, false);          // UTC: 10:38 AM Local: 7:38 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 23, 3, 15, 0, false);          // UTC: 3:15 AM Local: 12:15 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 12, 10, 8, 0, false);          // UTC: 10:08 AM Local: 7:08 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 19, 7, 29, 0, false);          // UTC: 7:29 AM Local: 4:29 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 5, 22, 19, 0, false);          // UTC: 10:19 PM Local: 7:19 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 25, 8, 6, 0, false);           // UTC: 8:06 AM Local: 5:06 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 11, 22, 31, 0, false);         // UTC: 10:31 PM Local: 7:31 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 30, 7, 11, 0, false);          // UTC: 7:11 AM Local: 4:11 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 19, 23, 46, 0, false);         // UTC: 11:46 PM Local: 8:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 14, 17, 36, 0, false);         // UTC: 5:36 PM Local: 2:36 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 9, 16, 12, 0, false);          // UTC: 4:12 PM Local: 1:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 20, 5, 43, 0, false);          // UTC: 5:43 AM Local: 2:43 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 20, 22, 25, 0, false);         // UTC: 10:25 PM Local: 7:25 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 20, 12, 38, 0, false);         // UTC: 12:38 PM Local: 9:38 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 5, 25, 13, 19, 0, false);         // UTC: 1:19 PM Local: 10:19 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 28, 5, 25, 0, false);          // UTC: 5:25 AM Local: 2:25 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 1, 15, 7, 0, false);           // UTC: 3:07 PM Local: 12:07 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 19, 22, 51, 0, false);         // UTC: 10:51 PM Local: 7:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 3, 19, 47, 0, false);          // UTC: 7:47 PM Local: 4:47 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 26, 2, 0, 0, false);           // UTC: 2:00 AM Local: 11:00 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 10, 19, 11, 0, false);         // UTC: 7:11 PM Local: 4:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 1, 13, 8, 0, false);           // UTC: 1:08 PM Local: 10:08 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 16, 23, 21, 0, false);         // UTC: 11:21 PM Local: 8:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 13, 9, 58, 0, false);          // UTC: 9:58 AM Local: 6:58 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 22, 18, 48, 0, false);         // UTC: 6:48 PM Local: 3:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 26, 20, 22, 0, false);         // UTC: 8:22 PM Local: 5:22 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 25, 12, 16, 0, false);         // UTC: 12:16 PM Local: 9:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 23, 11, 48, 0, false);         // UTC: 11:48 AM Local: 8:48 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 7, 22, 25, 0, false);          // UTC: 10:25 PM Local: 7:25 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 5, 20, 26, 0, false);          // UTC: 8:26 PM Local: 5:26 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 11, 12, 14, 0, false);         // UTC: 12:14 PM Local: 9:14 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 5, 3, 45, 0, false);           // UTC: 3:45 AM Local: 12:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 24, 13, 9, 0, false);          // UTC: 1:09 PM Local: 10:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 23, 11, 58, 0, false);         // UTC: 11:58 AM Local: 8:58 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 1, 12, 45, 0, false);          // UTC: 12:45 PM Local: 9:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 14, 20, 33, 0, false);         // UTC: 8:33 PM Local: 5:33 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 3, 22, 51, 0, false);          // UTC: 10:51 PM Local: 7:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 25, 5, 45, 0, false);          // UTC: 5:45 AM Local: 2:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 1, 14, 17, 0, false);          // UTC: 2:17 PM Local: 11:17 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 6, 3, 7, 36, 0, false);           // UTC: 7:36 AM Local: 4:36 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 1, 4, 40, 0, false);           // UTC: 4:40 AM Local: 1:40 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 19, 18, 19, 0, false);         // UTC: 6:19 PM Local: 3:19 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 12, 3, 47, 0, false);          // UTC: 3:47 AM Local: 12:47 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 19, 7, 30, 0, false);          // UTC: 7:30 AM Local: 4:30 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 9, 3, 31, 0, false);           // UTC: 3:31 AM Local: 12:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 8, 13, 31, 0, false);          // UTC: 1:31 PM Local: 10:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 15, 23, 0, 0, false);          // UTC: 11:00 PM Local: 8:00 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 28, 6, 42, 0, false);          // UTC: 6:42 AM Local: 3:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 15, 11, 31, 0, false);         // UTC: 11:31 AM Local: 8:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 31, 2, 5, 0, false);           // UTC: 2:05 AM Local: 11:05 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 8, 13, 44, 0, false);          // UTC: 1:44 PM Local: 10:44 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 29, 4, 43, 0, false);          // UTC: 4:43 AM Local: 1:43 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 3, 11, 35, 0, false);          // UTC: 11:35 AM Local: 8:35 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 27, 1, 48, 0, false);          // UTC: 1:48 AM Local: 10:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 23, 23, 7, 0, false);          // UTC: 11:07 PM Local: 8:07 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 9, 21, 45, 0, false);          // UTC: 9:45 PM Local: 6:45 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 21, 0, 53, 0, false);          // UTC: 12:53 AM Local: 9:53 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 25, 16, 7, 0, false);          // UTC: 4:07 PM Local: 1:07 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 30, 19, 46, 0, false);         // UTC: 7:46 PM Local: 4:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 30, 6, 59, 0, false);          // UTC: 6:59 AM Local: 3:59 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 19, 11, 12, 0, false);         // UTC: 11:12 AM Local: 8:12 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 16, 19, 34, 0, false);         // UTC: 7:34 PM Local: 4:34 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 11, 10, 8, 0, false);          // UTC: 10:08 AM Local: 7:08 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 26, 7, 53, 0, false);          // UTC: 7:53 AM Local: 4:53 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 7, 23, 11, 53, 0, false);         // UTC: 11:53 AM Local: 8:53 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 19, 0, 14, 0, false);          // UTC: 12:14 AM Local: 9:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 10, 12, 0, 0, false);          // UTC: 12:00 PM Local: 9:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 15, 22, 51, 0, false);         // UTC: 10:51 PM Local: 7:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 17, 7, 10, 0, false);          // UTC: 7:10 AM Local: 4:10 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 1, 20, 7, 0, false);           // UTC: 8:07 PM Local: 5:07 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 17, 16, 50, 0, false);         // UTC: 4:50 PM Local: 1:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 15, 21, 55, 0, false);         // UTC: 9:55 PM Local: 6:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 18, 20, 53, 0, false);         // UTC: 8:53 PM Local: 5:53 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 22, 4, 32, 0, false);          // UTC: 4:32 AM Local: 1:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 27, 12, 53, 0, false);         // UTC: 12:53 PM Local: 9:53 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 14, 9, 43, 0, false);          // UTC: 9:43 AM Local: 6:43 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 22, 14, 53, 0, false);         // UTC: 2:53 PM Local: 11:53 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 3, 10, 14, 0, false);          // UTC: 10:14 AM Local: 7:14 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 19, 1, 41, 0, false);          // UTC: 1:41 AM Local: 10:41 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 2, 17, 22, 0, false);          // UTC: 5:22 PM Local: 2:22 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 4, 12, 32, 0, false);          // UTC: 12:32 PM Local: 9:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 15, 6, 12, 0, false);          // UTC: 6:12 AM Local: 3:12 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 5, 7, 11, 0, false);           // UTC: 7:11 AM Local: 4:11 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 15, 3, 18, 0, false);          // UTC: 3:18 AM Local: 12:18 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 17, 8, 16, 0, false);          // UTC: 8:16 AM Local: 5:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 16, 1, 6, 0, false);           // UTC: 1:06 AM Local: 10:06 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 1, 14, 16, 0, false);          // UTC: 2:16 PM Local: 11:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 29, 15, 40, 0, false);         // UTC: 3:40 PM Local: 12:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 19, 11, 23, 0, false);         // UTC: 11:23 AM Local: 8:23 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 8, 20, 21, 14, 0, false);         // UTC: 9:14 PM Local: 6:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 27, 11, 53, 0, false);         // UTC: 11:53 AM Local: 8:53 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 2, 21, 12, 0, false);          // UTC: 9:12 PM Local: 6:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 25, 17, 25, 0, false);         // UTC: 5:25 PM Local: 2:25 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 15, 22, 4, 0, false);          // UTC: 10:04 PM Local: 7:04 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 1, 19, 27, 0, false);          // UTC: 7:27 PM Local: 4:27 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 14, 1, 53, 0, false);          // UTC: 1:53 AM Local: 10:53 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 3, 17, 32, 0, false);          // UTC: 5:32 PM Local: 2:32 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 15, 10, 11, 0, false);         // UTC: 10:11 AM Local: 7:11 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 19, 20, 9, 0, false);          // UTC: 8:09 PM Local: 5:09 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 23, 9, 30, 0, false);          // UTC: 9:30 AM Local: 6:30 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 3, 0, 1, 0, false);            // UTC: 12:01 AM Local: 9:01 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 11, 9, 55, 0, false);          // UTC: 9:55 AM Local: 6:55 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 2, 15, 30, 0, false);          // UTC: 3:30 PM Local: 12:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 12, 11, 1, 0, false);          // UTC: 11:01 AM Local: 8:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 24, 14, 0, 0, false);          // UTC: 2:00 PM Local: 11:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 10, 18, 14, 0, false);         // UTC: 6:14 PM Local: 3:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 29, 17, 50, 0, false);         // UTC: 5:50 PM Local: 2:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 11, 2, 3, 0, false);           // UTC: 2:03 AM Local: 11:03 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 24, 2, 14, 0, false);          // UTC: 2:14 AM Local: 11:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 8, 21, 42, 0, false);          // UTC: 9:42 PM Local: 6:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 19, 7, 42, 0, false);          // UTC: 7:42 AM Local: 4:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 18, 8, 25, 0, false);          // UTC: 8:25 AM Local: 5:25 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 9, 22, 29, 0, false);          // UTC: 10:29 PM Local: 7:29 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 15, 1, 3, 0, false);           // UTC: 1:03 AM Local: 10:03 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 9, 8, 3, 49, 0, false);           // UTC: 3:49 AM Local: 12:49 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 5, 10, 38, 0, false);         // UTC: 10:38 AM Local: 7:38 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 10, 10, 15, 0, false);        // UTC: 10:15 AM Local: 7:15 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 28, 2, 20, 0, false);         // UTC: 2:20 AM Local: 11:20 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 11, 14, 1, 0, false);         // UTC: 2:01 PM Local: 11:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 28, 4, 56, 0, false);         // UTC: 4:56 AM Local: 1:56 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 13, 19, 22, 0, false);        // UTC: 7:22 PM Local: 4:22 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 24, 18, 55, 0, false);        // UTC: 6:55 PM Local: 3:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 8, 4, 48, 0, false);          // UTC: 4:48 AM Local: 1:48 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 14, 8, 11, 0, false);         // UTC: 8:11 AM Local: 5:11 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 26, 2, 50, 0, false);         // UTC: 2:50 AM Local: 11:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 5, 13, 4, 0, false);          // UTC: 1:04 PM Local: 10:04 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 28, 9, 15, 0, false);         // UTC: 9:15 AM Local: 6:15 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 14, 16, 57, 0, false);        // UTC: 4:57 PM Local: 1:57 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 9, 20, 39, 0, false);         // UTC: 8:39 PM Local: 5:39 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 25, 1, 21, 0, false);         // UTC: 1:21 AM Local: 10:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 31, 10, 33, 0, false);        // UTC: 10:33 AM Local: 7:33 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 14, 10, 14, 0, false);        // UTC: 10:14 AM Local: 7:14 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 10, 0, 13, 0, false);         // UTC: 12:13 AM Local: 9:13 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 9, 1, 56, 0, false);          // UTC: 1:56 AM Local: 10:56 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 17, 7, 31, 0, false);         // UTC: 7:31 AM Local: 4:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 25, 5, 2, 0, false);          // UTC: 5:02 AM Local: 2:02 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 28, 16, 38, 0, false);        // UTC: 4:38 PM Local: 1:38 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 24, 14, 7, 0, false);         // UTC: 2:07 PM Local: 11:07 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 5, 22, 56, 0, false);         // UTC: 10:56 PM Local: 7:56 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 10, 6, 0, 12, 0, false);          // UTC: 12:12 AM Local: 9:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 30, 9, 52, 0, false);         // UTC: 9:52 AM Local: 6:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 23, 13, 55, 0, false);        // UTC: 1:55 PM Local: 10:55 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 15, 11, 32, 0, false);        // UTC: 11:32 AM Local: 8:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 21, 18, 30, 0, false);        // UTC: 6:30 PM Local: 3:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 14, 18, 48, 0, false);        // UTC: 6:48 PM Local: 3:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 13, 15, 54, 0, false);        // UTC: 3:54 PM Local: 12:54 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 11, 9, 22, 0, false);         // UTC: 9:22 AM Local: 6:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 18, 12, 4, 0, false);         // UTC: 12:04 PM Local: 9:04 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 2, 8, 56, 0, false);          // UTC: 8:56 AM Local: 5:56 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 4, 11, 17, 0, false);         // UTC: 11:17 AM Local: 8:17 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 12, 20, 0, 0, false);         // UTC: 8:00 PM Local: 5:00 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 24, 10, 9, 0, false);         // UTC: 10:09 AM Local: 7:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 30, 17, 48, 0, false);        // UTC: 5:48 PM Local: 2:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 16, 14, 38, 0, false);        // UTC: 2:38 PM Local: 11:38 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 24, 8, 20, 0, false);         // UTC: 8:20 AM Local: 5:20 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 9, 16, 19, 0, false);         // UTC: 4:19 PM Local: 1:19 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 20, 20, 35, 0, false);        // UTC: 8:35 PM Local: 5:35 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 6, 22, 5, 0, false);          // UTC: 10:05 PM Local: 7:05 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 25, 13, 11, 0, false);        // UTC: 1:11 PM Local: 10:11 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 6, 9, 30, 0, false);          // UTC: 9:30 AM Local: 6:30 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 28, 4, 10, 0, false);         // UTC: 4:10 AM Local: 1:10 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 11, 19, 22, 0, false);        // UTC: 7:22 PM Local: 4:22 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 28, 19, 57, 0, false);        // UTC: 7:57 PM Local: 4:57 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 17, 16, 40, 0, false);        // UTC: 4:40 PM Local: 1:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 11, 14, 12, 46, 0, false);        // UTC: 12:46 PM Local: 9:46 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 24, 6, 34, 0, false);         // UTC: 6:34 AM Local: 3:34 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 27, 11, 54, 0, false);        // UTC: 11:54 AM Local: 8:54 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 18, 16, 11, 0, false);        // UTC: 4:11 PM Local: 1:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 2, 4, 52, 0, false);          // UTC: 4:52 AM Local: 1:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 24, 3, 2, 0, false);          // UTC: 3:02 AM Local: 12:02 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 9, 14, 59, 0, false);         // UTC: 2:59 PM Local: 11:59 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 7, 5, 28, 0, false);          // UTC: 5:28 AM Local: 2:28 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 15, 14, 0, 0, false);         // UTC: 2:00 PM Local: 11:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 17, 12, 41, 0, false);        // UTC: 12:41 PM Local: 9:41 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 6, 21, 34, 0, false);         // UTC: 9:34 PM Local: 6:34 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 2, 5, 15, 0, false);          // UTC: 5:15 AM Local: 2:15 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 28, 3, 57, 0, false);         // UTC: 3:57 AM Local: 12:57 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 11, 3, 29, 0, false);         // UTC: 3:29 AM Local: 12:29 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 1, 23, 0, 0, false);          // UTC: 11:00 PM Local: 8:00 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 19, 16, 9, 0, false);         // UTC: 4:09 PM Local: 1:09 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 20, 23, 49, 0, false);        // UTC: 11:49 PM Local: 8:49 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 28, 8, 52, 0, false);         // UTC: 8:52 AM Local: 5:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 19, 8, 3, 0, false);          // UTC: 8:03 AM Local: 5:03 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 31, 9, 31, 0, false);         // UTC: 9:31 AM Local: 6:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 14, 20, 43, 0, false);        // UTC: 8:43 PM Local: 5:43 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 3, 23, 56, 0, false);         // UTC: 11:56 PM Local: 8:56 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 19, 2, 55, 0, false);         // UTC: 2:55 AM Local: 11:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 5, 3, 41, 0, false);          // UTC: 3:41 AM Local: 12:41 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 9, 6, 49, 0, false);          // UTC: 6:49 AM Local: 3:49 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2019, 12, 19, 5, 32, 0, false);         // UTC: 5:32 AM Local: 2:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 11, 17, 59, 0, false);         // UTC: 5:59 PM Local: 2:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 12, 18, 58, 0, false);         // UTC: 6:58 PM Local: 3:58 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 22, 9, 5, 0, false);           // UTC: 9:05 AM Local: 6:05 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 12, 0, 10, 0, false);          // UTC: 12:10 AM Local: 9:10 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 24, 9, 39, 0, false);          // UTC: 9:39 AM Local: 6:39 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 5, 8, 40, 0, false);           // UTC: 8:40 AM Local: 5:40 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 16, 0, 30, 0, false);          // UTC: 12:30 AM Local: 9:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 8, 3, 51, 0, false);           // UTC: 3:51 AM Local: 12:51 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 11, 3, 21, 0, false);          // UTC: 3:21 AM Local: 12:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 16, 23, 57, 0, false);         // UTC: 11:57 PM Local: 8:57 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 26, 12, 41, 0, false);         // UTC: 12:41 PM Local: 9:41 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 12, 19, 42, 0, false);         // UTC: 7:42 PM Local: 4:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 25, 9, 20, 0, false);          // UTC: 9:20 AM Local: 6:20 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 28, 10, 23, 0, false);         // UTC: 10:23 AM Local: 7:23 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 9, 22, 14, 0, false);          // UTC: 10:14 PM Local: 7:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 5, 16, 13, 0, false);          // UTC: 4:13 PM Local: 1:13 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 18, 6, 22, 0, false);          // UTC: 6:22 AM Local: 3:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 3, 13, 1, 0, false);           // UTC: 1:01 PM Local: 10:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 7, 6, 6, 0, false);            // UTC: 6:06 AM Local: 3:06 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 5, 14, 39, 0, false);          // UTC: 2:39 PM Local: 11:39 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 19, 7, 34, 0, false);          // UTC: 7:34 AM Local: 4:34 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 28, 20, 37, 0, false);         // UTC: 8:37 PM Local: 5:37 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 14, 11, 4, 0, false);          // UTC: 11:04 AM Local: 8:04 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 4, 23, 46, 0, false);          // UTC: 11:46 PM Local: 8:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 1, 25, 22, 9, 0, false);          // UTC: 10:09 PM Local: 7:09 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 11, 9, 55, 0, false);          // UTC: 9:55 AM Local: 6:55 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 22, 2, 45, 0, false);          // UTC: 2:45 AM Local: 11:45 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 11, 5, 0, 0, false);           // UTC: 5:00 AM Local: 2:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 13, 11, 24, 0, false);         // UTC: 11:24 AM Local: 8:24 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 21, 17, 0, 0, false);          // UTC: 5:00 PM Local: 2:00 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 27, 22, 9, 0, false);          // UTC: 10:09 PM Local: 7:09 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 21, 12, 0, 0, false);          // UTC: 12:00 PM Local: 9:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 18, 5, 42, 0, false);          // UTC: 5:42 AM Local: 2:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 6, 13, 50, 0, false);          // UTC: 1:50 PM Local: 10:50 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 22, 19, 10, 0, false);         // UTC: 7:10 PM Local: 4:10 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 16, 7, 29, 0, false);          // UTC: 7:29 AM Local: 4:29 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 25, 1, 4, 0, false);           // UTC: 1:04 AM Local: 10:04 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 21, 13, 16, 0, false);         // UTC: 1:16 PM Local: 10:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 6, 14, 46, 0, false);          // UTC: 2:46 PM Local: 11:46 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 14, 15, 15, 0, false);         // UTC: 3:15 PM Local: 12:15 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 13, 11, 19, 0, false);         // UTC: 11:19 AM Local: 8:19 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 10, 2, 39, 0, false);          // UTC: 2:39 AM Local: 11:39 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 26, 22, 52, 0, false);         // UTC: 10:52 PM Local: 7:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 4, 3, 0, 0, false);            // UTC: 3:00 AM Local: 12:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 23, 12, 49, 0, false);         // UTC: 12:49 PM Local: 9:49 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 6, 18, 38, 0, false);          // UTC: 6:38 PM Local: 3:38 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 28, 5, 45, 0, false);          // UTC: 5:45 AM Local: 2:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 17, 19, 30, 0, false);         // UTC: 7:30 PM Local: 4:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 22, 10, 56, 0, false);         // UTC: 10:56 AM Local: 7:56 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 2, 9, 10, 39, 0, false);          // UTC: 10:39 AM Local: 7:39 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 22, 10, 15, 0, false);         // UTC: 10:15 AM Local: 7:15 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 2, 7, 45, 0, false);           // UTC: 7:45 AM Local: 4:45 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 23, 23, 33, 0, false);         // UTC: 11:33 PM Local: 8:33 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 3, 2, 33, 0, false);           // UTC: 2:33 AM Local: 11:33 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 28, 0, 8, 0, false);           // UTC: 12:08 AM Local: 9:08 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 19, 9, 43, 0, false);          // UTC: 9:43 AM Local: 6:43 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 18, 19, 29, 0, false);         // UTC: 7:29 PM Local: 4:29 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 20, 4, 9, 0, false);           // UTC: 4:09 AM Local: 1:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 21, 5, 14, 0, false);          // UTC: 5:14 AM Local: 2:14 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 4, 14, 44, 0, false);          // UTC: 2:44 PM Local: 11:44 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 3, 3, 0, 0, false);            // UTC: 3:00 AM Local: 12:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 2, 6, 12, 0, false);           // UTC: 6:12 AM Local: 3:12 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 22, 18, 32, 0, false);         // UTC: 6:32 PM Local: 3:32 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 2, 1, 8, 0, false);            // UTC: 1:08 AM Local: 10:08 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 1, 10, 47, 0, false);          // UTC: 10:47 AM Local: 7:47 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 5, 22, 24, 0, false);          // UTC: 10:24 PM Local: 7:24 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 29, 5, 50, 0, false);          // UTC: 5:50 AM Local: 2:50 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 25, 18, 41, 0, false);         // UTC: 6:41 PM Local: 3:41 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 28, 20, 50, 0, false);         // UTC: 8:50 PM Local: 5:50 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 24, 9, 16, 0, false);          // UTC: 9:16 AM Local: 6:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 7, 1, 9, 0, false);            // UTC: 1:09 AM Local: 10:09 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 6, 23, 21, 0, false);          // UTC: 11:21 PM Local: 8:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 17, 8, 31, 0, false);          // UTC: 8:31 AM Local: 5:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 18, 15, 27, 0, false);         // UTC: 3:27 PM Local: 12:27 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 3, 1, 10, 59, 0, false);          // UTC: 10:59 AM Local: 7:59 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 7, 18, 54, 0, false);          // UTC: 6:54 PM Local: 3:54 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 19, 23, 31, 0, false);         // UTC: 11:31 PM Local: 8:31 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 29, 15, 32, 0, false);         // UTC: 3:32 PM Local: 12:32 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 18, 15, 51, 0, false);         // UTC: 3:51 PM Local: 12:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 10, 4, 30, 0, false);          // UTC: 4:30 AM Local: 1:30 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 27, 12, 39, 0, false);         // UTC: 12:39 PM Local: 9:39 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 21, 10, 34, 0, false);         // UTC: 10:34 AM Local: 7:34 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 5, 10, 32, 0, false);          // UTC: 10:32 AM Local: 7:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 19, 9, 54, 0, false);          // UTC: 9:54 AM Local: 6:54 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 1, 22, 47, 0, false);          // UTC: 10:47 PM Local: 7:47 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 13, 9, 48, 0, false);          // UTC: 9:48 AM Local: 6:48 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 13, 13, 58, 0, false);         // UTC: 1:58 PM Local: 10:58 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 14, 7, 16, 0, false);          // UTC: 7:16 AM Local: 4:16 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 1, 14, 0, 0, false);           // UTC: 2:00 PM Local: 11:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 22, 3, 55, 0, false);          // UTC: 3:55 AM Local: 12:55 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 2, 22, 59, 0, false);          // UTC: 10:59 PM Local: 7:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 1, 0, 38, 0, false);           // UTC: 12:38 AM Local: 9:38 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 24, 2, 30, 0, false);          // UTC: 2:30 AM Local: 11:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 19, 11, 54, 0, false);         // UTC: 11:54 AM Local: 8:54 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 6, 14, 22, 0, false);          // UTC: 2:22 PM Local: 11:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 18, 3, 44, 0, false);          // UTC: 3:44 AM Local: 12:44 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 9, 15, 1, 0, false);           // UTC: 3:01 PM Local: 12:01 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 1, 16, 34, 0, false);          // UTC: 4:34 PM Local: 1:34 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 29, 17, 12, 0, false);         // UTC: 5:12 PM Local: 2:12 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 4, 3, 7, 6, 0, false);            // UTC: 7:06 AM Local: 4:06 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 1, 7, 4, 0, false);            // UTC: 7:04 AM Local: 4:04 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 31, 0, 52, 0, false);          // UTC: 12:52 AM Local: 9:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 22, 9, 28, 0, false);          // UTC: 9:28 AM Local: 6:28 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 1, 18, 32, 0, false);          // UTC: 6:32 PM Local: 3:32 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 16, 10, 3, 0, false);          // UTC: 10:03 AM Local: 7:03 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 17, 8, 10, 0, false);          // UTC: 8:10 AM Local: 5:10 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 13, 18, 16, 0, false);         // UTC: 6:16 PM Local: 3:16 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 3, 17, 33, 0, false);          // UTC: 5:33 PM Local: 2:33 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 3, 3, 49, 0, false);           // UTC: 3:49 AM Local: 12:49 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 2, 3, 48, 0, false);           // UTC: 3:48 AM Local: 12:48 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 19, 16, 32, 0, false);         // UTC: 4:32 PM Local: 1:32 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 6, 12, 56, 0, false);          // UTC: 12:56 PM Local: 9:56 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 20, 11, 49, 0, false);         // UTC: 11:49 AM Local: 8:49 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 9, 15, 36, 0, false);          // UTC: 3:36 PM Local: 12:36 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 29, 17, 39, 0, false);         // UTC: 5:39 PM Local: 2:39 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 14, 15, 52, 0, false);         // UTC: 3:52 PM Local: 12:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 21, 11, 55, 0, false);         // UTC: 11:55 AM Local: 8:55 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 30, 3, 17, 0, false);          // UTC: 3:17 AM Local: 12:17 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 6, 6, 37, 0, false);           // UTC: 6:37 AM Local: 3:37 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 16, 23, 51, 0, false);         // UTC: 11:51 PM Local: 8:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 16, 16, 42, 0, false);         // UTC: 4:42 PM Local: 1:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 28, 0, 57, 0, false);          // UTC: 12:57 AM Local: 9:57 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 26, 5, 8, 0, false);           // UTC: 5:08 AM Local: 2:08 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 24, 6, 5, 0, false);           // UTC: 6:05 AM Local: 3:05 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 5, 7, 21, 8, 0, false);           // UTC: 9:08 PM Local: 6:08 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 13, 4, 20, 0, false);          // UTC: 4:20 AM Local: 1:20 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 17, 15, 44, 0, false);         // UTC: 3:44 PM Local: 12:44 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 10, 14, 47, 0, false);         // UTC: 2:47 PM Local: 11:47 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 18, 13, 43, 0, false);         // UTC: 1:43 PM Local: 10:43 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 8, 9, 51, 0, false);           // UTC: 9:51 AM Local: 6:51 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 23, 17, 31, 0, false);         // UTC: 5:31 PM Local: 2:31 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 23, 1, 22, 0, false);          // UTC: 1:22 AM Local: 10:22 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 10, 12, 12, 0, false);         // UTC: 12:12 PM Local: 9:12 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 28, 23, 15, 0, false);         // UTC: 11:15 PM Local: 8:15 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 5, 10, 21, 0, false);          // UTC: 10:21 AM Local: 7:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 29, 13, 1, 0, false);          // UTC: 1:01 PM Local: 10:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 21, 14, 28, 0, false);         // UTC: 2:28 PM Local: 11:28 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 11, 13, 44, 0, false);         // UTC: 1:44 PM Local: 10:44 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 21, 13, 59, 0, false);         // UTC: 1:59 PM Local: 10:59 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 29, 16, 32, 0, false);         // UTC: 4:32 PM Local: 1:32 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 25, 0, 37, 0, false);          // UTC: 12:37 AM Local: 9:37 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 16, 23, 22, 0, false);         // UTC: 11:22 PM Local: 8:22 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 25, 18, 24, 0, false);         // UTC: 6:24 PM Local: 3:24 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 14, 14, 33, 0, false);         // UTC: 2:33 PM Local: 11:33 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 20, 22, 26, 0, false);         // UTC: 10:26 PM Local: 7:26 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 19, 14, 23, 0, false);         // UTC: 2:23 PM Local: 11:23 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 20, 15, 29, 0, false);         // UTC: 3:29 PM Local: 12:29 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 17, 14, 24, 0, false);         // UTC: 2:24 PM Local: 11:24 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 15, 10, 18, 0, false);         // UTC: 10:18 AM Local: 7:18 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 6, 3, 15, 4, 0, false);           // UTC: 3:04 PM Local: 12:04 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 15, 4, 40, 0, false);          // UTC: 4:40 AM Local: 1:40 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 3, 4, 23, 0, false);           // UTC: 4:23 AM Local: 1:23 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 23, 4, 25, 0, false);          // UTC: 4:25 AM Local: 1:25 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 29, 2, 44, 0, false);          // UTC: 2:44 AM Local: 11:44 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 31, 15, 41, 0, false);         // UTC: 3:41 PM Local: 12:41 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 20, 4, 5, 0, false);           // UTC: 4:05 AM Local: 1:05 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 19, 0, 41, 0, false);          // UTC: 12:41 AM Local: 9:41 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 31, 20, 21, 0, false);         // UTC: 8:21 PM Local: 5:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 9, 20, 33, 0, false);          // UTC: 8:33 PM Local: 5:33 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 31, 4, 9, 0, false);           // UTC: 4:09 AM Local: 1:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 17, 19, 21, 0, false);         // UTC: 7:21 PM Local: 4:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 16, 18, 1, 0, false);          // UTC: 6:01 PM Local: 3:01 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 23, 2, 27, 0, false);          // UTC: 2:27 AM Local: 11:27 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 26, 3, 0, 0, false);           // UTC: 3:00 AM Local: 12:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 1, 12, 14, 0, false);          // UTC: 12:14 PM Local: 9:14 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 27, 9, 56, 0, false);          // UTC: 9:56 AM Local: 6:56 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 18, 22, 55, 0, false);         // UTC: 10:55 PM Local: 7:55 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 9, 14, 5, 0, false);           // UTC: 2:05 PM Local: 11:05 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 14, 16, 30, 0, false);         // UTC: 4:30 PM Local: 1:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 17, 6, 13, 0, false);          // UTC: 6:13 AM Local: 3:13 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 7, 11, 24, 0, false);          // UTC: 11:24 AM Local: 8:24 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 16, 17, 1, 0, false);          // UTC: 5:01 PM Local: 2:01 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 5, 18, 6, 0, false);           // UTC: 6:06 PM Local: 3:06 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 3, 1, 35, 0, false);           // UTC: 1:35 AM Local: 10:35 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 7, 9, 1, 21, 0, false);           // UTC: 1:21 AM Local: 10:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 6, 8, 29, 0, false);           // UTC: 8:29 AM Local: 5:29 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 9, 23, 14, 0, false);          // UTC: 11:14 PM Local: 8:14 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 25, 3, 27, 0, false);          // UTC: 3:27 AM Local: 12:27 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 12, 16, 49, 0, false);         // UTC: 4:49 PM Local: 1:49 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 18, 23, 18, 0, false);         // UTC: 11:18 PM Local: 8:18 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 28, 0, 49, 0, false);          // UTC: 12:49 AM Local: 9:49 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 23, 15, 46, 0, false);         // UTC: 3:46 PM Local: 12:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 27, 12, 55, 0, false);         // UTC: 12:55 PM Local: 9:55 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 14, 7, 3, 0, false);           // UTC: 7:03 AM Local: 4:03 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 7, 23, 20, 0, false);          // UTC: 11:20 PM Local: 8:20 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 27, 10, 3, 0, false);          // UTC: 10:03 AM Local: 7:03 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 25, 8, 1, 0, false);           // UTC: 8:01 AM Local: 5:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 14, 15, 38, 0, false);         // UTC: 3:38 PM Local: 12:38 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 10, 7, 19, 0, false);          // UTC: 7:19 AM Local: 4:19 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 31, 0, 0, 0, false);           // UTC: 12:00 AM Local: 9:00 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 30, 18, 42, 0, false);         // UTC: 6:42 PM Local: 3:42 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 6, 17, 25, 0, false);          // UTC: 5:25 PM Local: 2:25 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 3, 17, 6, 0, false);           // UTC: 5:06 PM Local: 2:06 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 19, 16, 40, 0, false);         // UTC: 4:40 PM Local: 1:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 28, 8, 19, 0, false);          // UTC: 8:19 AM Local: 5:19 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 20, 21, 11, 0, false);         // UTC: 9:11 PM Local: 6:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 18, 1, 47, 0, false);          // UTC: 1:47 AM Local: 10:47 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 24, 0, 36, 0, false);          // UTC: 12:36 AM Local: 9:36 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 30, 9, 14, 0, false);          // UTC: 9:14 AM Local: 6:14 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 8, 10, 9, 0, 0, false);           // UTC: 9:00 AM Local: 6:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 23, 4, 21, 0, false);          // UTC: 4:21 AM Local: 1:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 26, 22, 11, 0, false);         // UTC: 10:11 PM Local: 7:11 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 12, 7, 31, 0, false);          // UTC: 7:31 AM Local: 4:31 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 9, 12, 21, 0, false);          // UTC: 12:21 PM Local: 9:21 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 29, 10, 24, 0, false);         // UTC: 10:24 AM Local: 7:24 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 17, 0, 59, 0, false);          // UTC: 12:59 AM Local: 9:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 14, 4, 42, 0, false);          // UTC: 4:42 AM Local: 1:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 20, 19, 13, 0, false);         // UTC: 7:13 PM Local: 4:13 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 12, 11, 27, 0, false);         // UTC: 11:27 AM Local: 8:27 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 10, 14, 14, 0, false);         // UTC: 2:14 PM Local: 11:14 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 6, 18, 47, 0, false);          // UTC: 6:47 PM Local: 3:47 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 7, 16, 21, 0, false);          // UTC: 4:21 PM Local: 1:21 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 4, 4, 28, 0, false);           // UTC: 4:28 AM Local: 1:28 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 9, 14, 49, 0, false);          // UTC: 2:49 PM Local: 11:49 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 22, 9, 59, 0, false);          // UTC: 9:59 AM Local: 6:59 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 4, 21, 1, 0, false);           // UTC: 9:01 PM Local: 6:01 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 17, 7, 32, 0, false);          // UTC: 7:32 AM Local: 4:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 17, 9, 29, 0, false);          // UTC: 9:29 AM Local: 6:29 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 13, 23, 7, 0, false);          // UTC: 11:07 PM Local: 8:07 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 22, 20, 15, 0, false);         // UTC: 8:15 PM Local: 5:15 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 6, 11, 18, 0, false);          // UTC: 11:18 AM Local: 8:18 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 19, 11, 9, 0, false);          // UTC: 11:09 AM Local: 8:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 25, 18, 45, 0, false);         // UTC: 6:45 PM Local: 3:45 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 16, 13, 11, 0, false);         // UTC: 1:11 PM Local: 10:11 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 9, 29, 2, 3, 0, false);           // UTC: 2:03 AM Local: 11:03 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 9, 4, 54, 0, false);          // UTC: 4:54 AM Local: 1:54 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 29, 3, 25, 0, false);         // UTC: 3:25 AM Local: 12:25 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 27, 2, 39, 0, false);         // UTC: 2:39 AM Local: 11:39 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 7, 0, 59, 0, false);          // UTC: 12:59 AM Local: 9:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 14, 4, 2, 0, false);          // UTC: 4:02 AM Local: 1:02 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 14, 2, 7, 0, false);          // UTC: 2:07 AM Local: 11:07 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 16, 11, 57, 0, false);        // UTC: 11:57 AM Local: 8:57 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 22, 7, 32, 0, false);         // UTC: 7:32 AM Local: 4:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 23, 21, 6, 0, false);         // UTC: 9:06 PM Local: 6:06 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 15, 13, 49, 0, false);        // UTC: 1:49 PM Local: 10:49 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 22, 1, 13, 0, false);         // UTC: 1:13 AM Local: 10:13 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 6, 18, 52, 0, false);         // UTC: 6:52 PM Local: 3:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 14, 16, 51, 0, false);        // UTC: 4:51 PM Local: 1:51 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 22, 10, 38, 0, false);        // UTC: 10:38 AM Local: 7:38 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 3, 19, 16, 0, false);         // UTC: 7:16 PM Local: 4:16 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 7, 5, 25, 0, false);          // UTC: 5:25 AM Local: 2:25 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 10, 7, 55, 0, false);         // UTC: 7:55 AM Local: 4:55 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 13, 16, 24, 0, false);        // UTC: 4:24 PM Local: 1:24 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 25, 10, 49, 0, false);        // UTC: 10:49 AM Local: 7:49 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 20, 10, 37, 0, false);        // UTC: 10:37 AM Local: 7:37 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 24, 10, 50, 0, false);        // UTC: 10:50 AM Local: 7:50 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 16, 16, 48, 0, false);        // UTC: 4:48 PM Local: 1:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 17, 1, 30, 0, false);         // UTC: 1:30 AM Local: 10:30 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 23, 14, 48, 0, false);        // UTC: 2:48 PM Local: 11:48 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 10, 7, 18, 59, 0, false);         // UTC: 6:59 PM Local: 3:59 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 28, 8, 58, 0, false);         // UTC: 8:58 AM Local: 5:58 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 14, 5, 23, 0, false);         // UTC: 5:23 AM Local: 2:23 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 3, 9, 42, 0, false);          // UTC: 9:42 AM Local: 6:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 30, 21, 46, 0, false);        // UTC: 9:46 PM Local: 6:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 26, 2, 3, 0, false);          // UTC: 2:03 AM Local: 11:03 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 17, 11, 22, 0, false);        // UTC: 11:22 AM Local: 8:22 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 24, 11, 50, 0, false);        // UTC: 11:50 AM Local: 8:50 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 4, 12, 38, 0, false);         // UTC: 12:38 PM Local: 9:38 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 12, 21, 43, 0, false);        // UTC: 9:43 PM Local: 6:43 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 13, 3, 42, 0, false);         // UTC: 3:42 AM Local: 12:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 17, 14, 28, 0, false);        // UTC: 2:28 PM Local: 11:28 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 5, 20, 46, 0, false);         // UTC: 8:46 PM Local: 5:46 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 3, 6, 50, 0, false);          // UTC: 6:50 AM Local: 3:50 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 24, 16, 37, 0, false);        // UTC: 4:37 PM Local: 1:37 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 9, 2, 10, 0, false);          // UTC: 2:10 AM Local: 11:10 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 22, 0, 17, 0, false);         // UTC: 12:17 AM Local: 9:17 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 19, 11, 19, 0, false);        // UTC: 11:19 AM Local: 8:19 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 9, 10, 33, 0, false);         // UTC: 10:33 AM Local: 7:33 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 2, 4, 4, 0, false);           // UTC: 4:04 AM Local: 1:04 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 6, 20, 0, 0, false);          // UTC: 8:00 PM Local: 5:00 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 15, 11, 53, 0, false);        // UTC: 11:53 AM Local: 8:53 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 3, 11, 2, 0, false);          // UTC: 11:02 AM Local: 8:02 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 10, 21, 52, 0, false);        // UTC: 9:52 PM Local: 6:52 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 20, 5, 19, 0, false);         // UTC: 5:19 AM Local: 2:19 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 11, 20, 14, 1, 0, false);         // UTC: 2:01 PM Local: 11:01 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 6, 6, 9, 0, false);           // UTC: 6:09 AM Local: 3:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 30, 16, 34, 0, false);        // UTC: 4:34 PM Local: 1:34 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 2, 17, 37, 0, false);         // UTC: 5:37 PM Local: 2:37 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 12, 11, 7, 0, false);         // UTC: 11:07 AM Local: 8:07 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 20, 17, 22, 0, false);        // UTC: 5:22 PM Local: 2:22 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 17, 4, 28, 0, false);         // UTC: 4:28 AM Local: 1:28 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 9, 5, 10, 0, false);          // UTC: 5:10 AM Local: 2:10 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 20, 4, 9, 0, false);          // UTC: 4:09 AM Local: 1:09 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 24, 21, 19, 0, false);        // UTC: 9:19 PM Local: 6:19 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 3, 7, 0, 0, false);           // UTC: 7:00 AM Local: 4:00 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 16, 10, 19, 0, false);        // UTC: 10:19 AM Local: 7:19 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 14, 14, 32, 0, false);        // UTC: 2:32 PM Local: 11:32 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 30, 15, 22, 0, false);        // UTC: 3:22 PM Local: 12:22 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 1, 10, 52, 0, false);         // UTC: 10:52 AM Local: 7:52 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 10, 4, 19, 0, false);         // UTC: 4:19 AM Local: 1:19 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 13, 9, 27, 0, false);         // UTC: 9:27 AM Local: 6:27 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 9, 13, 42, 0, false);         // UTC: 1:42 PM Local: 10:42 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 12, 16, 8, 0, false);         // UTC: 4:08 PM Local: 1:08 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 18, 17, 39, 0, false);        // UTC: 5:39 PM Local: 2:39 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 1, 8, 28, 0, false);          // UTC: 8:28 AM Local: 5:28 AM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 17, 17, 56, 0, false);        // UTC: 5:56 PM Local: 2:56 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 21, 0, 40, 0, false);         // UTC: 12:40 AM Local: 9:40 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 8, 15, 8, 0, false);          // UTC: 3:08 PM Local: 12:08 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 14, 16, 48, 0, false);        // UTC: 4:48 PM Local: 1:48 PM Offset: -03:00:00
+	testCount++; failedCount += test(timeManager, 23, 2020, 12, 19, 12, 10, 0, false);        // UTC: 12:10 PM Local: 9:10 AM Offset: -03:00:00
+
+	Serial.println(); Serial.print(failedCount); Serial.print(" of "); Serial.print(testCount); Serial.println(" test(s) failed.");
+}
+#endif
@@ -10,6 +10,19 @@
 #include "Tests_TimeZoneId_08.h"
 #include "Tests_TimeZoneId_09.h"
 #include "Tests_TimeZoneId_10.h"
+#include "Tests_TimeZoneId_11.h"
+#include "Tests_TimeZoneId_12.h"
+#include "Tests_TimeZoneId_13.h"
+#include "Tests_TimeZoneId_14.h"
+#include "Tests_TimeZoneId_15.h"
+#include "Tests_TimeZoneId_16.h"
+#include "Tests_TimeZoneId_17.h"
+#include "Tests_TimeZoneId_18.h"
+#include "Tests_TimeZoneId_19.h"
+#include "Tests_TimeZoneId_20.h"
+#include "Tests_TimeZoneId_21.h"
+#include "Tests_TimeZoneId_22.h"
+#include "Tests_TimeZoneId_23.h"
 
 TimeManager _timeManager;
 
@@ -41,6 +54,19 @@ void setup()
   //run_TimeZoneId_8_Tests(_timeManager);
   //run_TimeZoneId_9_Tests(_timeManager);
   //run_TimeZoneId_10_Tests(_timeManager);
+  //run_TimeZoneId_11_Tests(_timeManager);
+  //run_TimeZoneId_12_Tests(_timeManager);
+  //run_TimeZoneId_13_Tests(_timeManager);
+  //run_TimeZoneId_14_Tests(_timeManager);
+  //run_TimeZoneId_15_Tests(_timeManager);
+  //run_TimeZoneId_16_Tests(_timeManager);
+  //run_TimeZoneId_17_Tests(_timeManager);
+  //run_TimeZoneId_18_Tests(_timeManager);
+  //run_TimeZoneId_19_Tests(_timeManager);
+  //run_TimeZoneId_20_Tests(_timeManager);
+  //run_TimeZoneId_21_Tests(_timeManager);
+  //run_TimeZoneId_22_Tests(_timeManager);
+  //run_TimeZoneId_23_Tests(_timeManager);
 }
 
 void loop()
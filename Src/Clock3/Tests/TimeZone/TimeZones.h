@@ -0,0 +1,62 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// ***
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// ***
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// ***
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+
+/*
+
+This file was generated by TimeZoneGenerator.py. Do not edit it; change
+TimeZones.json and run the generator again.
+
+Offsets are in minutes east of UTC. DST starts at the local standard time
+and ends at the local daylight time given by each transition:
+{ month, week (5 is the last), day of the week (0 is Sunday), minutes }.
+
+This file is included by TimeManager.h after TimeZone_t is defined.
+
+*/
+
+#ifndef TIME_ZONES_H
+#define TIME_ZONES_H
+
+const static TimeZone_t _timeZones[] PROGMEM =
+{
+  {  0, "UTC", "UTC", 0, 0, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },               // Coordinated Universal Time (UTC0)
+  {  1, "AKST", "AKDT", -540, -480, true, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },   // ALASKA STANDARD/DAYLIGHT TIME (AKST9AKDT,M3.2.0,M11.1.0)
+  {  2, "HAST", "HADT", -600, -540, true, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },   // ALEUTIAN STANDARD/DAYLIGHT TIME (HAST10HADT,M3.2.0,M11.1.0)
+  {  3, "HST", "HST", -600, -600, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },         // HAWAII STANDARD TIME (HST10)
+  {  4, "SST", "SST", -660, -660, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },         // SAMOA STANDARD TIME (SST11)
+  {  5, "CHST", "CHST", 600, 600, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },         // CHAMORRO STANDARD TIME (CHST-10)
+  {  6, "PST", "PDT", -480, -420, true, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },     // PACIFIC STANDARD/DAYLIGHT TIME (PST8PDT,M3.2.0,M11.1.0)
+  {  7, "MST", "MDT", -420, -360, true, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },     // MOUNTAIN STANDARD/DAYLIGHT TIME (MST7MDT,M3.2.0,M11.1.0)
+  {  8, "CST", "CDT", -360, -300, true, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },     // CENTRAL STANDARD/DAYLIGHT TIME (CST6CDT,M3.2.0,M11.1.0)
+  {  9, "EST", "EDT", -300, -240, true, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },     // EASTERN STANDARD/DAYLIGHT TIME (EST5EDT,M3.2.0,M11.1.0)
+  { 10, "AST", "AST", -240, -240, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },         // PUERTO RICO ATLANTIC STANDARD TIME (AST4)
+  { 11, "GMT", "BST", 0, 60, true, { 3, 5, 0, 60 }, { 10, 5, 0, 120 } },           // GREENWICH MEAN/BRITISH SUMMER TIME (GMT0BST,M3.5.0/1,M10.5.0)
+  { 12, "CET", "CEST", 60, 120, true, { 3, 5, 0, 120 }, { 10, 5, 0, 180 } },       // CENTRAL EUROPEAN STANDARD/SUMMER TIME (CET-1CEST,M3.5.0,M10.5.0/3)
+  { 13, "EET", "EEST", 120, 180, true, { 3, 5, 0, 180 }, { 10, 5, 0, 240 } },      // EASTERN EUROPEAN STANDARD/SUMMER TIME (EET-2EEST,M3.5.0/3,M10.5.0/4)
+  { 14, "MSK", "MSK", 180, 180, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },           // MOSCOW STANDARD TIME (MSK-3)
+  { 15, "IST", "IST", 330, 330, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },           // INDIA STANDARD TIME (IST-5:30)
+  { 16, "CST", "CST", 480, 480, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },           // CHINA STANDARD TIME (CST-8)
+  { 17, "JST", "JST", 540, 540, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },           // JAPAN STANDARD TIME (JST-9)
+  { 18, "AWST", "AWST", 480, 480, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },         // AUSTRALIAN WESTERN STANDARD TIME (AWST-8)
+  { 19, "ACST", "ACDT", 570, 630, true, { 10, 1, 0, 120 }, { 4, 1, 0, 180 } },     // AUSTRALIAN CENTRAL STANDARD/DAYLIGHT TIME (ACST-9:30ACDT,M10.1.0,M4.1.0/3)
+  { 20, "AEST", "AEDT", 600, 660, true, { 10, 1, 0, 120 }, { 4, 1, 0, 180 } },     // AUSTRALIAN EASTERN STANDARD/DAYLIGHT TIME (AEST-10AEDT,M10.1.0,M4.1.0/3)
+  { 21, "NZST", "NZDT", 720, 780, true, { 9, 5, 0, 120 }, { 4, 1, 0, 180 } },      // NEW ZEALAND STANDARD/DAYLIGHT TIME (NZST-12NZDT,M9.5.0,M4.1.0/3)
+  { 22, "NST", "NDT", -210, -150, true, { 3, 2, 0, 120 }, { 11, 1, 0, 120 } },     // NEWFOUNDLAND STANDARD/DAYLIGHT TIME (NST3:30NDT,M3.2.0,M11.1.0)
+  { 23, "ART", "ART", -180, -180, false, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } }          // ARGENTINA TIME (ART3)
+};
+
+#endif
@@ -16,6 +16,14 @@
 // ***
 #include "TimeManager.h"
 
+// ***
+// *** The DST mode labels are kept in flash and copied
+// *** by dstLabel() when they are needed.
+// ***
+const char DST_LABEL_YES[] PROGMEM = "Yes";
+const char DST_LABEL_NO[] PROGMEM = "No";
+const char DST_LABEL_AUTO[] PROGMEM = "Auto";
+
 void TimeManager::begin(uint8_t currentTimeZoneId, DstMode_t dstMode, bool displayTwelveHourFormat, TimeEventHandler callback)
 {
   // ***
@@ -27,6 +35,7 @@ void TimeManager::begin(uint8_t currentTimeZoneId, DstMode_t dstMode, bool displ
   // *** Initialize the time zone ID.
   // ***
   this->_currentTimeZoneId = currentTimeZoneId;
+  this->loadTimeZone();
 
   // ***
   // *** Initialize the DST mode.
@@ -39,10 +48,14 @@ void TimeManager::begin(uint8_t currentTimeZoneId, DstMode_t dstMode, bool displ
   this->displayTwelveHourFormat = displayTwelveHourFormat;
 
   // ***
-  // *** Start the RTC and fire the
-  // *** appropriate event.
+  // *** Start the RTC and take the first snapshot
+  // *** before firing the appropriate event.
   // ***
-  if (this->_rtc.begin())
+  bool found = this->_rtc.begin();
+  this->_lastRtcPoll = millis();
+  this->updateSnapshot(this->readRtc());
+
+  if (found)
   {
     this->_callback(TIME_INITIALIZED);
   }
@@ -55,27 +68,86 @@ void TimeManager::begin(uint8_t currentTimeZoneId, DstMode_t dstMode, bool displ
 void TimeManager::process()
 {
   // ***
-  // *** Get the current date and time from the RTC.
+  // *** Get the current date and time.
   // ***
-  DateTime now = this->_rtc.now();
+  DateTime now = this->nextDateTime();
 
   // ***
-  // *** Check if the minute has changed.
+  // *** The snapshot only needs to be worked out
+  // *** again when the second has changed.
   // ***
-  if (this->_lastMinuteDisplayed != now.minute())
+  if (now.unixtime() != this->_snapshot.utc.unixtime())
   {
-    // ***
-    // *** Fire the event.
-    // ***
-    this->_callback(TIME_MINUTE_CHANGED);
+    this->updateSnapshot(now);
 
     // ***
-    // *** Track the time of the last update.
+    // *** Check if the minute has changed.
     // ***
-    _lastMinuteDisplayed = now.minute();
+    if (this->_lastMinuteDisplayed != now.minute())
+    {
+      // ***
+      // *** Fire the event.
+      // ***
+      this->_callback(TIME_MINUTE_CHANGED);
+
+      // ***
+      // *** Track the time of the last update.
+      // ***
+      _lastMinuteDisplayed = now.minute();
+    }
   }
 }
 
+void TimeManager::beginSquareWave(uint8_t pin)
+{
+  this->_squareWavePin = pin;
+
+  // ***
+  // *** The SQW/INTB output is open drain.
+  // ***
+  pinMode(pin, INPUT_PULLUP);
+
+  // ***
+  // *** Select the 1 Hz square wave in the DS1337 control
+  // *** register. RTClib only knows the DS1307 register
+  // *** layout so the register is written directly.
+  // ***
+  Wire.beginTransmission(DS1337_ADDRESS);
+  Wire.write(DS1337_CONTROL);
+  Wire.write(DS1337_SQW_1HZ);
+  Wire.endTransmission();
+  this->_rtcTransactions++;
+
+  // ***
+  // *** Enable the pin change interrupt for the pin.
+  // ***
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    this->_pendingSeconds = 0;
+    *digitalPinToPCMSK(pin) |= _BV(digitalPinToPCMSKbit(pin));
+    *digitalPinToPCICR(pin) |= _BV(digitalPinToPCICRbit(pin));
+  }
+
+  this->_lastTick = millis();
+}
+
+void TimeManager::tick()
+{
+  // ***
+  // *** The interrupt fires on both edges. Count
+  // *** one second on each falling edge.
+  // ***
+  if (digitalRead(this->_squareWavePin) == LOW)
+  {
+    this->_pendingSeconds++;
+  }
+}
+
+const bool TimeManager::isSquareWaveActive()
+{
+  return this->_squareWavePin != NO_SQW_PIN && (millis() - this->_lastTick) < RTC_SQW_TIMEOUT;
+}
+
 const uint8_t TimeManager::timeZoneId()
 {
   // ***
@@ -90,6 +162,12 @@ void TimeManager::timeZoneId(uint8_t timeZoneId)
   // *** Set the time zone ID.
   // ***
   this->_currentTimeZoneId = timeZoneId;
+  this->loadTimeZone();
+
+  // ***
+  // *** The offset and DST flag depend on the time zone.
+  // ***
+  this->updateSnapshot(this->_snapshot.utc);
 
   // ***
   // *** Fire the event.
@@ -101,11 +179,6 @@ const char* TimeManager::timeZoneName()
 {
   char* returnValue;
 
-  // ***
-  // *** Get the current timezone information.
-  // ***
-  TimeZone_t* timeZone = this->getTimeZone(this->_currentTimeZoneId);
-
   // ***
   // *** Check the current DST setting
   // ***
@@ -114,19 +187,29 @@ const char* TimeManager::timeZoneName()
     // ***
     // *** Use the DST name.
     // ***
-    returnValue = timeZone->dName;
+    returnValue = this->_timeZone.dName;
   }
   else
   {
     // ***
     // *** Use the standard name.
     // ***
-    returnValue = timeZone->sName;
+    returnValue = this->_timeZone.sName;
   }
 
   return returnValue;
 }
 
+void TimeManager::loadTimeZone()
+{
+  // ***
+  // *** Copy the time zone from flash. The DST start and
+  // *** end instants belong to the previous time zone.
+  // ***
+  memcpy_P(&this->_timeZone, TimeManager::getTimeZoneAddress(this->_currentTimeZoneId), sizeof(TimeZone_t));
+  this->_dstYear = 0;
+}
+
 const DstMode_t TimeManager::dstMode()
 {
   return this->_dstMode;
@@ -139,6 +222,11 @@ void TimeManager::dstMode(DstMode_t dstMode)
   // ***
   this->_dstMode = dstMode;
 
+  // ***
+  // *** The offset and DST flag depend on the DST mode.
+  // ***
+  this->updateSnapshot(this->_snapshot.utc);
+
   // ***
   // *** Fire the event.
   // ***
@@ -147,7 +235,7 @@ void TimeManager::dstMode(DstMode_t dstMode)
 
 const char* TimeManager::dstLabel()
 {
-  const char* returnValue;
+  const char* label;
 
   // ***
   // *** Return a text version of the
@@ -155,18 +243,24 @@ const char* TimeManager::dstLabel()
   // ***
   if (this->dstMode() == DstMode_t::YES)
   {
-    returnValue = "Yes";
+    label = DST_LABEL_YES;
   }
   else if (this->dstMode() == DstMode_t::NO)
   {
-    returnValue = "No";
+    label = DST_LABEL_NO;
   }
   else
   {
-    returnValue = "Auto";
+    label = DST_LABEL_AUTO;
   }
 
-  return returnValue;
+  // ***
+  // *** Copy the label from flash.
+  // ***
+  strncpy_P(this->_dstLabel, label, DST_LABEL_SIZE - 1);
+  this->_dstLabel[DST_LABEL_SIZE - 1] = 0;
+
+  return this->_dstLabel;
 }
 
 const DstMode_t TimeManager::toggleDstMode()
@@ -195,10 +289,10 @@ const DstMode_t TimeManager::toggleDstMode()
 DateTime TimeManager::utcDateTime()
 {
   // ***
-  // *** Get the current date an time from the RTC
-  // *** in TC time.
+  // *** Return the UTC date and time from the
+  // *** last read of the RTC.
   // ***
-  return this->_rtc.now();
+  return this->_snapshot.utc;
 }
 
 void TimeManager::utcDateTime(const DateTime& dateTime)
@@ -207,78 +301,49 @@ void TimeManager::utcDateTime(const DateTime& dateTime)
   // *** Set the RTC date and time.
   // ***
   _rtc.adjust(dateTime);
+  this->_rtcTransactions++;
+
+  // ***
+  // *** Setting the time restarts the RTC seconds so any
+  // *** edges counted so far no longer apply.
+  // ***
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+  {
+    this->_pendingSeconds = 0;
+  }
+
+  this->_secondsSinceRead = 0;
+
+  // ***
+  // *** The new date and time is the current time.
+  // ***
+  this->_lastRtcPoll = millis();
+  this->updateSnapshot(dateTime);
 }
 
 DateTime TimeManager::localDateTime()
 {
   // ***
-  // *** Calculate the local date and time based on
-  // *** the current time zone.
+  // *** Return the local date and time from the
+  // *** last read of the RTC.
   // ***
-  return this->calculateLocalDateTime(this->timeOffset());
+  return this->_snapshot.local;
 }
 
 const int16_t TimeManager::timeOffset()
 {
-  int16_t returnValue = 0;
-
   // ***
-  // *** Get the current timezone information.
+  // *** Return the offset from the last read of the RTC.
   // ***
-  TimeZone_t* tz = TimeManager::getTimeZone(this->timeZoneId());
-
-  // ***
-  // *** Check current DST.
-  // ***
-  if (this->isDst())
-  {
-    // ***
-    // *** Use daylight savings offset.
-    // ***
-    returnValue = tz->dOffset;
-  }
-  else
-  {
-    // ***
-    // *** Use standard offset.
-    // ***
-    returnValue = tz->sOffset;
-  }
-
-  return returnValue;
+  return this->_snapshot.offset;
 }
 
 const bool TimeManager::isDst()
 {
-  bool returnValue = false;
-
   // ***
-  // *** Check the DST mode.
+  // *** Return the DST flag from the last read of the RTC.
   // ***
-  if (this->dstMode() == DstMode_t::YES)
-  {
-    // ***
-    // *** DST has been turned on manually.
-    // ***
-    returnValue = true;
-  }
-  else if (this->dstMode() == DstMode_t::NO)
-  {
-    // ***
-    // *** DST has been turned off manually.
-    // ***
-    returnValue = false;
-  }
-  else
-  {
-    // ***
-    // *** DST must be calculated based on the time
-    // *** zone and current date and time.
-    // ***
-    returnValue = this->calculateDst();
-  }
-
-  return returnValue;
+  return this->_snapshot.dst;
 }
 
 const uint8_t TimeManager::localHour()
@@ -363,7 +428,7 @@ const bool TimeManager::isPm()
   return this->localDateTime().hour() >= 12;
 }
 
-const static uint8_t TimeManager::timeZoneCount()
+const uint8_t TimeManager::timeZoneCount()
 {
   // ***
   // *** The number of time zones defined is the total size
@@ -373,9 +438,24 @@ const static uint8_t TimeManager::timeZoneCount()
   return sizeof(_timeZones) / sizeof(TimeZone_t);
 }
 
-const static TimeZone_t* TimeManager::getTimeZone(uint8_t timeZoneId)
+const uint32_t TimeManager::rtcTransactions()
+{
+  return this->_rtcTransactions;
+}
+
+const TimeZone_t* TimeManager::getTimeZone(uint8_t timeZoneId, TimeZone_t* timeZone)
+{
+  // ***
+  // *** Copy the time zone from flash.
+  // ***
+  memcpy_P(timeZone, TimeManager::getTimeZoneAddress(timeZoneId), sizeof(TimeZone_t));
+
+  return timeZone;
+}
+
+const TimeZone_t* TimeManager::getTimeZoneAddress(uint8_t timeZoneId)
 {
-  TimeZone_t* returnValue = &_timeZones[0];
+  const TimeZone_t* returnValue = &_timeZones[0];
 
   // ***
   // *** Check that the Id is less than the total
@@ -393,148 +473,216 @@ const static TimeZone_t* TimeManager::getTimeZone(uint8_t timeZoneId)
   return returnValue;
 }
 
-DateTime TimeManager::calculateLocalDateTime(int16_t offset)
+DateTime TimeManager::readRtc()
 {
   // ***
-  // *** Get the current UTC date and time.
+  // *** Count each read so the number of I2C
+  // *** transactions can be checked.
   // ***
-  DateTime now = this->utcDateTime();
+  this->_rtcTransactions++;
 
   // ***
-  // *** Add the appropriate number of hours based
-  // *** on the specified offset (could be a negative
-  // *** number that results in subtracting hours).
+  // *** The square wave count starts again from
+  // *** each read.
   // ***
-  return DateTime(now.unixtime() + (offset * 3600));
+  this->_secondsSinceRead = 0;
+
+  return this->_rtc.now();
 }
 
-bool TimeManager::calculateDst()
+DateTime TimeManager::nextDateTime()
 {
-  bool returnValue = false;
+  DateTime returnValue = this->_snapshot.utc;
 
-  // ***
-  // *** Get the current timezone information.
-  // ***
-  TimeZone_t* tz = TimeManager::getTimeZone(this->timeZoneId());
-
-  if (tz->observesDst)
+  if (this->_squareWavePin != NO_SQW_PIN)
   {
+    uint8_t seconds = 0;
+
     // ***
-    // *** Get the local date and time as if it is
-    // *** currently standard time since DST
-    // *** changes over based on standard time.
+    // *** Take the seconds counted by the interrupt.
     // ***
-    DateTime standardLocal = this->calculateLocalDateTime(tz->sOffset);
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+      seconds = this->_pendingSeconds;
+      this->_pendingSeconds = 0;
+    }
 
-    if (this->isAfterDstStart(standardLocal))
+    if (seconds > 0)
     {
-      // ***
-      // *** Get the local date and time as if it is
-      // *** currently daylight savings time since DST
-      // *** changes back based on daylight savings time.
-      // ***
-      DateTime daylightSavingsLocal = this->calculateLocalDateTime(tz->dOffset);
+      this->_lastTick = millis();
+      this->_secondsSinceRead += seconds;
 
-      if (this->isBeforeDstEnd(daylightSavingsLocal))
+      if (this->_secondsSinceRead >= RTC_RESYNC_INTERVAL)
       {
-        returnValue = true;
+        // ***
+        // *** Read the RTC to correct any drift.
+        // ***
+        returnValue = this->readRtc();
+      }
+      else
+      {
+        // ***
+        // *** Advance the time by the seconds counted.
+        // ***
+        returnValue = DateTime(returnValue.unixtime() + seconds);
       }
     }
   }
 
+  // ***
+  // *** Without the square wave (or when it has stopped)
+  // *** poll the RTC, limiting how often it is read.
+  // ***
+  if (!this->isSquareWaveActive() && (millis() - this->_lastRtcPoll) >= RTC_POLL_INTERVAL)
+  {
+    this->_lastRtcPoll = millis();
+    returnValue = this->readRtc();
+  }
+
   return returnValue;
 }
 
-bool TimeManager::isAfterDstStart(const DateTime& dt)
+void TimeManager::updateSnapshot(const DateTime& utc)
 {
-  bool returnValue = false;
+  this->_snapshot.utc = utc;
 
   // ***
-  // *** Check if we are within the daylight savings months.
+  // *** Check the DST mode.
   // ***
-  if (dt.month() >= MARCH)
+  if (this->dstMode() == DstMode_t::YES)
   {
-    if (dt.month() == MARCH)
+    // ***
+    // *** DST has been turned on manually.
+    // ***
+    this->_snapshot.dst = true;
+  }
+  else if (this->dstMode() == DstMode_t::NO)
+  {
+    // ***
+    // *** DST has been turned off manually.
+    // ***
+    this->_snapshot.dst = false;
+  }
+  else
+  {
+    // ***
+    // *** DST must be calculated based on the time
+    // *** zone and the date and time.
+    // ***
+    this->_snapshot.dst = this->calculateDst(utc);
+  }
+
+  // ***
+  // *** Use the daylight savings or the standard offset
+  // *** to work out the local date and time.
+  // ***
+  this->_snapshot.offset = this->_snapshot.dst ? this->_timeZone.dOffset : this->_timeZone.sOffset;
+  this->_snapshot.local = this->calculateLocalDateTime(utc, this->_snapshot.offset);
+}
+
+DateTime TimeManager::calculateLocalDateTime(const DateTime& utc, int16_t offset)
+{
+  // ***
+  // *** Add the appropriate number of hours based
+  // *** on the specified offset (could be a negative
+  // *** number that results in subtracting minutes).
+  // ***
+  return DateTime(utc.unixtime() + (offset * 60L));
+}
+
+bool TimeManager::calculateDst(const DateTime& utc)
+{
+  bool returnValue = false;
+
+  if (this->_timeZone.observesDst)
+  {
+    // ***
+    // *** The start and end of DST are only worked out
+    // *** again when the year or time zone changes.
+    // ***
+    if (utc.year() != this->_dstYear)
     {
-      // ***
-      // *** Create the first day of March.
-      // ***
-      DateTime s = DateTime(dt.year(), MARCH, 1, 0, 0, 0);
+      this->calculateDstTransitions(utc.year());
+    }
 
-      // ***
-      // *** Calculate the second Sunday in March.
-      // ***
-      uint8_t secondSundayInMarch = s.dayOfTheWeek() == 0 ? s.day() + 7 : 7 + s.day() + (7 - s.dayOfTheWeek());
+    uint32_t now = utc.unixtime();
 
+    if (this->_dstStart < this->_dstEnd)
+    {
       // ***
-      // *** Determine if we are after the second
-      // *** Sunday of March.
+      // *** It is DST from the start instant up to
+      // *** (but not including) the end instant.
       // ***
-      if (dt.day() > secondSundayInMarch)
-      {
-        returnValue = true;
-      }
-      else if (dt.day() == secondSundayInMarch)
-      {
-        // ***
-        // *** If it is after 2:00 am it is DST.
-        // ***
-        if (dt.hour() >= DST_TIME)
-        {
-          returnValue = true;
-        }
-      }
+      returnValue = now >= this->_dstStart && now < this->_dstEnd;
     }
     else
     {
-      returnValue = true;
+      // ***
+      // *** In the southern hemisphere DST runs over
+      // *** New Year so it is DST before the end instant
+      // *** and again from the start instant.
+      // ***
+      returnValue = now >= this->_dstStart || now < this->_dstEnd;
     }
   }
 
   return returnValue;
 }
 
-bool TimeManager::isBeforeDstEnd(const DateTime& dt)
+void TimeManager::calculateDstTransitions(uint16_t year)
 {
-  bool returnValue = false;
+  this->_dstYear = year;
+
+  // ***
+  // *** DST starts at a local standard time and ends
+  // *** at a local daylight savings time.
+  // ***
+  this->_dstStart = this->transitionInstant(year, this->_timeZone.dstStart, this->_timeZone.sOffset);
+  this->_dstEnd = this->transitionInstant(year, this->_timeZone.dstEnd, this->_timeZone.dOffset);
+}
+
+const uint32_t TimeManager::transitionInstant(uint16_t year, const DstTransition_t& transition, int16_t offset)
+{
+  // ***
+  // *** Find the first day of the month with the day of the
+  // *** week of the transition (0 is Sunday).
+  // ***
+  DateTime first = DateTime(year, transition.month, 1, 0, 0, 0);
+  uint8_t day = 1 + ((7 + transition.dayOfWeek - first.dayOfTheWeek()) % 7);
 
   // ***
-  // *** Check if we are within the daylight savings months.
+  // *** Move on to the nth week. Week 5 means the last
+  // *** one in the month, which may be the fourth.
   // ***
-  if (dt.month() <= NOVEMBER)
+  day += (transition.week - 1) * 7;
+
+  if (day > this->daysInMonth(year, transition.month))
+  {
+    day -= 7;
+  }
+
+  // ***
+  // *** Add the local time of the transition and take off
+  // *** the offset to get UTC.
+  // ***
+  return first.unixtime() + ((day - 1) * 86400UL) + ((transition.minutes - offset) * 60L);
+}
+
+const uint8_t TimeManager::daysInMonth(uint16_t year, uint8_t month)
+{
+  uint8_t returnValue = 31;
+
+  if (month == 2)
   {
     // ***
-    // *** Determine if we are before the first
-    // *** Sunday of November.
+    // *** The years supported by RTClib (2000 to 2099)
+    // *** are leap years when they divide by 4.
     // ***
-    if (dt.month() == NOVEMBER)
-    {
-      // ***
-      // *** Create the first day of November.
-      // ***
-      DateTime s = DateTime(dt.year(), NOVEMBER, 1, 0, 0, 0);
-
-      // ***
-      // *** Calculate the first Sunday in November.
-      // ***
-      uint8_t firstSundayInNovember = s.dayOfTheWeek() == 0 ? s.day() : s.day() + (7 - s.dayOfTheWeek());
-      
-      if (dt.day() < firstSundayInNovember)
-      {
-        returnValue = true;
-      }
-      else if (dt.day() == firstSundayInNovember)
-      {
-        // ***
-        // *** If it is before 2:00 am it is DST.
-        // ***
-        returnValue = dt.hour() < DST_TIME;
-      }
-    }
-    else
-    {
-      returnValue = true;
-    }
+    returnValue = (year % 4) == 0 ? 29 : 28;
+  }
+  else if (month == 4 || month == 6 || month == 9 || month == 11)
+  {
+    returnValue = 30;
   }
 
   return returnValue;
@@ -18,12 +18,40 @@
 #define TIME_MANAGER_H
 
 #include <Arduino.h>
+#include <util/atomic.h>
 #include <Wire.h>
 #include <RTClib.h>
 
-#define MARCH 3
-#define NOVEMBER 11
-#define DST_TIME 2
+// ***
+// *** The minimum number of milliseconds between
+// *** reads of the RTC.
+// ***
+#define RTC_POLL_INTERVAL 100
+
+// ***
+// *** The I2C address of the DS1337 and the value written
+// *** to its control register to get a 1 Hz square wave
+// *** on the SQW/INTB output.
+// ***
+#define DS1337_ADDRESS 0x68
+#define DS1337_CONTROL 0x0E
+#define DS1337_SQW_1HZ 0x00
+
+// ***
+// *** When the square wave is used the RTC is read again every
+// *** RTC_RESYNC_INTERVAL seconds to correct any missed edges.
+// *** If no edge is seen for RTC_SQW_TIMEOUT milliseconds the
+// *** RTC is polled instead.
+// ***
+#define RTC_RESYNC_INTERVAL 900
+#define RTC_SQW_TIMEOUT 2500
+#define NO_SQW_PIN 0xff
+
+// ***
+// *** The size of the buffer used for the DST mode label
+// *** (the longest label plus the terminator).
+// ***
+#define DST_LABEL_SIZE 5
 
 // ***
 // *** A list of event IDs.
@@ -44,6 +72,24 @@ typedef enum DST_MODE : uint8_t
   AUTO = 2
 } DstMode_t;
 
+// ***
+// *** A DST transition on the nth day of the week of a month
+// *** at a local time (Mm.w.d/time in a POSIX TZ string). A
+// *** week of 5 is the last one in the month.
+// ***
+typedef struct DST_TRANSITION
+{
+  uint8_t month;
+  uint8_t week;
+  uint8_t dayOfWeek;
+  int16_t minutes;
+} DstTransition_t;
+
+// ***
+// *** A time zone. The offsets are in minutes east of UTC. DST
+// *** starts at the local standard time and ends at the local
+// *** daylight savings time of the transitions.
+// ***
 typedef struct TIME_ZONE
 {
   uint8_t id;
@@ -52,24 +98,28 @@ typedef struct TIME_ZONE
   int16_t sOffset;
   int16_t dOffset;
   bool observesDst;
+  DstTransition_t dstStart;
+  DstTransition_t dstEnd;
 } TimeZone_t;
 
 // ***
-// *** US time zones (https://time.gov/).
-// ***
-const static TimeZone_t _timeZones[] = {
-  {  0, "UTC\0", "UTC\0", 0, 0, false },      // Coordinated Universal Time
-  {  1, "AKST\0", "AKDT\0", -9, -8, true },   // ALASKA STANDARD/DAYLIGHT TIME
-  {  2, "HAST\0", "HADT\0", -10, -9, true },  // ALEUTIAN STANDARD/DAYLIGHT TIME
-  {  3, "HST\0", "HST\0", -10, -10, false },  // HAWAII STANDARD TIME
-  {  4, "SST\0", "SST\0", -11, -11, false },  // SAMOA STANDARD TIME
-  {  5, "CHST\0", "CHST\0",  10, 10, false }, // CHAMORRO STANDARD TIME
-  {  6, "PST\0", "PDT\0", -8, -7, true },     // PACIFIC STANDARD/DAYLIGHT TIME
-  {  7, "MST\0", "MDT\0", -7, -6, true },     // MOUNTAIN STANDARD/DAYLIGHT TIME
-  {  8, "CST\0", "CDT\0", -6, -5, true },     // CENTRAL STANDARD/DAYLIGHT TIME
-  {  9, "EST\0", "EDT\0", -5, -4, true },     // EASTERN STANDARD/DAYLIGHT TIME
-  { 10, "AST\0", "AST\0", -4, -4, false }     // PUERTO RICO ATLANTIC STANDARD TIME
-};
+// *** The time values worked out from a single read
+// *** of the RTC. The accessors are served from this
+// *** copy so one redraw does not read the RTC again.
+// ***
+typedef struct TIME_SNAPSHOT
+{
+  DateTime utc;
+  DateTime local;
+  int16_t offset;
+  bool dst;
+} TimeSnapshot_t;
+
+// ***
+// *** The time zone table is generated from POSIX TZ strings
+// *** by TimeZoneGenerator.py and stored in PROGMEM.
+// ***
+#include "Other\TimeZones.h"
 
 class TimeManager
 {
@@ -94,6 +144,26 @@ class TimeManager
     // ***
     void process();
 
+    // ***
+    // *** Sets the DS1337 SQW/INTB output to a 1 Hz square
+    // *** wave that is wired to the given pin. The seconds
+    // *** are then counted by tick() and the RTC is only
+    // *** read to correct drift.
+    // ***
+    void beginSquareWave(uint8_t);
+
+    // ***
+    // *** Called from the pin change interrupt of the
+    // *** square wave pin.
+    // ***
+    void tick();
+
+    // ***
+    // *** Returns true when the time is being kept
+    // *** by the square wave.
+    // ***
+    const bool isSquareWaveActive();
+
     // ***
     // *** Gets/sets the current time zone ID.
     // ***
@@ -128,12 +198,11 @@ class TimeManager
     // ** time zone offset and DST flag.
     // ***
     DateTime localDateTime();
-    DateTime localDateTime(int16_t, bool);
 
     // ***
-    // *** Returns the current time offset
-    // *** based on the current time zone
-    // *** and DST.
+    // *** Returns the current time offset, in
+    // *** minutes, based on the current time
+    // *** zone and DST.
     // ***
     const int16_t timeOffset();
 
@@ -143,12 +212,8 @@ class TimeManager
     const char* timeZoneName();
 
     // ***
-    // *** Based on the current time zone and date and time, using
-    // *** US rules, determine if it is currently DST or not.
-    // ***
-    // *** - DST begins at 2:00 a.m. on the second Sunday of March
-    // *** - DST ends at 2:00 a.m. on the first Sunday of November
-    // *** https://www.nist.gov/pml/time-and-frequency-division/popular-links/daylight-saving-time-dst
+    // *** Based on the rules of the current time zone and the
+    // *** date and time, determine if it is currently DST or not.
     // ***
     const bool isDst();
 
@@ -184,14 +249,21 @@ class TimeManager
     const bool isPm();
 
     // ***
-    // *** Gets the time zone by ID.
+    // *** Gets the time zone by ID. The zone is copied from
+    // *** flash into the buffer given by the caller.
     // ***
-    const static TimeZone_t* getTimeZone(uint8_t timeZoneId);
+    const static TimeZone_t* getTimeZone(uint8_t timeZoneId, TimeZone_t* timeZone);
 
     // ***
     // *** Returns the number of time zones defined.
     // ***
-    const static uint8_t TimeManager::timeZoneCount();
+    const static uint8_t timeZoneCount();
+
+    // ***
+    // *** Returns the number of I2C transactions made
+    // *** with the RTC since startup.
+    // ***
+    const uint32_t rtcTransactions();
 
   protected:
     // ***
@@ -218,30 +290,126 @@ class TimeManager
     DstMode_t _dstMode = DstMode_t::AUTO;
 
     // ***
-    // *** Calculates local date and time based on
-    // *** DST and offset.
+    // *** A copy of the current time zone from flash.
+    // ***
+    TimeZone_t _timeZone;
+
+    // ***
+    // *** Copies the current time zone from flash.
     // ***
-    DateTime calculateLocalDateTime(int16_t);
+    void loadTimeZone();
 
     // ***
-    // *** Calculates DST based on the current date
+    // *** The label returned by dstLabel(), copied from flash.
+    // ***
+    char _dstLabel[DST_LABEL_SIZE];
+
+    // ***
+    // *** Returns the address in flash of the time zone
+    // *** with the given ID.
+    // ***
+    const static TimeZone_t* getTimeZoneAddress(uint8_t);
+
+    // ***
+    // *** The time values from the last read of the RTC.
+    // ***
+    TimeSnapshot_t _snapshot;
+
+    // ***
+    // *** The time, in milliseconds, of the last read of the RTC.
+    // ***
+    uint32_t _lastRtcPoll = 0;
+
+    // ***
+    // *** Counts the reads and writes made to the RTC.
+    // ***
+    uint32_t _rtcTransactions = 0;
+
+    // ***
+    // *** The pin the square wave is wired to.
+    // ***
+    uint8_t _squareWavePin = NO_SQW_PIN;
+
+    // ***
+    // *** The number of seconds counted by tick() that
+    // *** have not been added to the snapshot yet.
+    // ***
+    volatile uint8_t _pendingSeconds = 0;
+
+    // ***
+    // *** The number of seconds counted since the
+    // *** RTC was last read.
+    // ***
+    uint16_t _secondsSinceRead = 0;
+
+    // ***
+    // *** The time, in milliseconds, of the last
+    // *** square wave edge.
+    // ***
+    uint32_t _lastTick = 0;
+
+    // ***
+    // *** Works out the next UTC date and time from the
+    // *** square wave count or from a read of the RTC.
+    // ***
+    DateTime nextDateTime();
+
+    // ***
+    // *** Reads the current UTC date and time from the RTC.
+    // ***
+    DateTime readRtc();
+
+    // ***
+    // *** Works out the local time, offset and DST flag
+    // *** for the given UTC date and time and stores them
+    // *** in the snapshot.
+    // ***
+    void updateSnapshot(const DateTime&);
+
+    // ***
+    // *** Calculates local date and time from the given
+    // *** UTC date and time and offset.
+    // ***
+    DateTime calculateLocalDateTime(const DateTime&, int16_t);
+
+    // ***
+    // *** Calculates DST based on the given UTC date
     // *** and time.
     // ***
-    bool calculateDst();
+    bool calculateDst(const DateTime&);
+
+    // ***
+    // *** The year the DST start and end instants were
+    // *** worked out for. Zero when they need to be
+    // *** worked out again.
+    // ***
+    uint16_t _dstYear = 0;
+
+    // ***
+    // *** The UTC instants (in unix time) DST starts
+    // *** and ends. In the southern hemisphere DST
+    // *** ends before it starts.
+    // ***
+    uint32_t _dstStart = 0;
+    uint32_t _dstEnd = 0;
+
+    // ***
+    // *** Works out the UTC instants DST starts and
+    // *** ends in the current time zone for the given
+    // *** year.
+    // ***
+    void calculateDstTransitions(uint16_t);
 
     // ***
-    // *** Checks if the current date and time
-    // *** is after the starting date and time
-    // *** for DST.
+    // *** Returns the UTC instant of a transition in the
+    // *** given year at the given offset.
     // ***
-    bool isAfterDstStart(const DateTime& dt);
+    const uint32_t transitionInstant(uint16_t, const DstTransition_t&, int16_t);
 
     // ***
-    // *** Checks if the current date and time
-    // *** is before the starting date and time
-    // *** for DST.
+    // *** Returns the number of days in the given month.
     // ***
-    bool isBeforeDstEnd(const DateTime& dt);
+    const uint8_t daysInMonth(uint16_t, uint8_t);
 
     // ***
     // *** The event callback handler.
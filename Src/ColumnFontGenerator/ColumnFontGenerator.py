@@ -0,0 +1,241 @@
+#!/usr/bin/env python3
+# ***
+# *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+# ***
+# *** This program is free software: you can redistribute it and/or modify
+# *** it under the terms of the GNU Lesser General Public License as published
+# *** by the Free Software Foundation, either version 3 of the License, or
+# *** (at your option) any later version.
+# ***
+# *** This program is distributed in the hope that it will be useful,
+# *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+# *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# *** GNU Lesser General Public License for more details.
+# ***
+# *** You should have received a copy of the GNU Lesser General Public License
+# *** along with this program. If not, see http://www.gnu.org/licenses/.
+# ***
+
+# ***
+# *** Converts a font saved by GFX Font Editor (the .json file) into a
+# *** column-major font header for the Clock3 firmware. The firmware ORs
+# *** each glyph column straight into its framebuffer so the glyphs are
+# *** transposed, clipped to the display and aligned to the bottom row
+# *** here instead of on the device.
+# ***
+# *** Usage:
+# ***
+# ***   python3 ColumnFontGenerator.py ../../Font/ClockFont.json \
+# ***     ../Clock3/Other/ClockFontColumns.h
+# ***
+# *** A flash size comparison with the Adafruit GFX layout of the same
+# *** font is printed when the header has been written.
+# ***
+import argparse
+import json
+import os
+import sys
+from datetime import datetime
+
+# ***
+# *** The Clock3 display has 7 rows. Text is drawn with the
+# *** baseline on the bottom row.
+# ***
+ROWS = 7
+
+# ***
+# *** Sizes of the structures on the AVR (two byte pointers).
+# ***
+GFX_GLYPH_SIZE = 7    # uint16_t bitmapOffset, uint8_t width, height, xAdvance, int8_t xOffset, yOffset
+GFX_FONT_SIZE = 9     # uint8_t* bitmap, GFXglyph* glyph, uint16_t first, last, uint8_t yAdvance
+COLUMN_GLYPH_SIZE = 4 # uint16_t bitmapOffset, uint8_t width, xAdvance
+COLUMN_FONT_SIZE = 6  # uint8_t* bitmap, ColumnGlyph_t* glyph, uint8_t first, last
+
+
+def transpose(item, rows):
+    # ***
+    # *** Find the right most column with a pixel set. Each row of
+    # *** the GFX bitmap is one byte with the left column in the MSB.
+    # ***
+    width = 0
+
+    for value in item['fontBitmap']:
+        for column in range(8):
+            if value & (0x80 >> column):
+                width = max(width, column + 1)
+
+    # ***
+    # *** Build one byte per column with the top row of the
+    # *** display in bit 0. Rows below the display are dropped.
+    # ***
+    columns = []
+
+    for column in range(width):
+        value = 0
+
+        for index, row in enumerate(item['fontBitmap']):
+            if row & (0x80 >> column):
+                y = rows - 1 + item['yOffset'] + index
+
+                if 0 <= y < rows:
+                    value |= 1 << y
+
+        columns.append(value)
+
+    return columns
+
+
+def label(code):
+    return 'Space' if code == 0x20 else chr(code)
+
+
+def format_date(value):
+    # ***
+    # *** The editor writes .NET time stamps with seven digits of
+    # *** fractional seconds which datetime cannot parse.
+    # ***
+    try:
+        return datetime.strptime(value[:19], '%Y-%m-%dT%H:%M:%S').strftime('%A, %B %d, %Y %I:%M %p')
+    except (TypeError, ValueError):
+        return value
+
+
+def generate(font, name, rows):
+    items = sorted(font['items'], key=lambda item: item['asciiCode'])
+    first = items[0]['asciiCode']
+    last = items[-1]['asciiCode']
+
+    bitmapLines = []
+    glyphLines = []
+    offset = 0
+
+    for item in items:
+        code = item['asciiCode']
+        columns = transpose(item, rows)
+
+        if columns:
+            values = ', '.join('0x%02x' % value for value in columns) + ','
+            bitmapLines.append('\t%-30s /* 0x%02x %s */' % (values, code, label(code)))
+
+        glyphLines.append(('\t{ %d, %d, %d }' % (offset, len(columns), item['xAdvance']), code))
+        offset += len(columns)
+
+    lines = []
+    lines.append('// ***')
+    lines.append('// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.')
+    lines.append('// ***')
+    lines.append('// *** This program is free software: you can redistribute it and/or modify')
+    lines.append('// *** it under the terms of the GNU Lesser General Public License as published')
+    lines.append('// *** by the Free Software Foundation, either version 3 of the License, or')
+    lines.append('// *** (at your option) any later version.')
+    lines.append('// ***')
+    lines.append('// *** This program is distributed in the hope that it will be useful,')
+    lines.append('// *** but WITHOUT ANY WARRANTY; without even the implied warranty of')
+    lines.append('// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the')
+    lines.append('// *** GNU Lesser General Public License for more details.')
+    lines.append('// ***')
+    lines.append('// *** You should have received a copy of the GNU Lesser General Public License')
+    lines.append('// *** along with this program. If not, see http://www.gnu.org/licenses/.')
+    lines.append('// ***')
+    lines.append('')
+    lines.append('/*')
+    lines.append('')
+    lines.append('This file was generated by ColumnFontGenerator.py. Do not edit it; change')
+    lines.append('the font in GFX Font Editor and run the generator again.')
+    lines.append('')
+    lines.append('Font Name:      %s' % name)
+    lines.append('Date Created:   %s' % format_date(font.get('dateTimeCreated')))
+    lines.append('Last Modified:  %s' % format_date(font.get('lastModifiedDateTime')))
+    lines.append('Version:        %s.%s' % (font.get('majorVersion', 1), font.get('minorVersion', 0)))
+    lines.append('License:        LGPL-3.0')
+    lines.append('')
+    lines.append('Each byte holds the rows of one glyph column with the top row in bit 0,')
+    lines.append('already positioned for text drawn on the bottom row of a %d row display.' % rows)
+    lines.append('Blank columns on the right of each glyph are not stored; xAdvance gives')
+    lines.append('the full character spacing.')
+    lines.append('')
+    lines.append('*/')
+    lines.append('')
+    guard = ''.join('_' + c if c.isupper() and i > 0 else c for i, c in enumerate(name)).upper() + '_COLUMNS_H'
+    lines.append('#ifndef %s' % guard)
+    lines.append('#define %s' % guard)
+    lines.append('')
+    lines.append('#include "Other\\ColumnFont.h"')
+    lines.append('')
+    lines.append('const uint8_t %sColumnBitmaps[] PROGMEM =' % name)
+    lines.append('{')
+    lines.extend(bitmapLines)
+    lines.append('};')
+    lines.append('')
+    lines.append('const ColumnGlyph_t %sColumnGlyphs[] PROGMEM =' % name)
+    lines.append('{')
+
+    for index, (glyph, code) in enumerate(glyphLines):
+        separator = ',' if index < len(glyphLines) - 1 else ' '
+        lines.append('%-20s /* 0x%02x %s */' % (glyph + separator, code, label(code)))
+
+    lines.append('};')
+    lines.append('')
+    lines.append('const ColumnFont_t %sColumns PROGMEM =' % name)
+    lines.append('{')
+    lines.append('\t(uint8_t*)%sColumnBitmaps,' % name)
+    lines.append('\t(ColumnGlyph_t*)%sColumnGlyphs,' % name)
+    lines.append('\t0x%02x, /* First ASCII Character */' % first)
+    lines.append('\t0x%02x  /* Last ASCII Character */' % last)
+    lines.append('};')
+    lines.append('')
+    lines.append('#endif')
+
+    # ***
+    # *** Work out the flash used by both layouts.
+    # ***
+    gfxBitmap = sum(len(item['fontBitmap']) for item in items)
+    gfxGlyphs = len(items) * GFX_GLYPH_SIZE
+    columnGlyphs = len(items) * COLUMN_GLYPH_SIZE
+
+    sizes = {
+        'gfx': (gfxBitmap, gfxGlyphs, GFX_FONT_SIZE),
+        'column': (offset, columnGlyphs, COLUMN_FONT_SIZE)
+    }
+
+    return '\r\n'.join(lines) + '\r\n', sizes
+
+
+def report(name, sizes):
+    print('%-24s %8s %8s %8s %8s' % ('Layout', 'Bitmap', 'Glyphs', 'Font', 'Total'))
+
+    for title, key in (('%s (GFX)' % name, 'gfx'), ('%sColumns' % name, 'column')):
+        bitmap, glyphs, font = sizes[key]
+        print('%-24s %8d %8d %8d %8d' % (title, bitmap, glyphs, font, bitmap + glyphs + font))
+
+    saved = sum(sizes['gfx']) - sum(sizes['column'])
+    print('Flash saved: %d bytes' % saved)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generates a column-major font header for Clock3.')
+    parser.add_argument('input', help='the font file saved by GFX Font Editor (.json)')
+    parser.add_argument('output', help='the header file to write')
+    parser.add_argument('--name', help='the name of the font (defaults to the input file name)')
+    parser.add_argument('--rows', type=int, default=ROWS, help='the number of rows on the display (1 to 8)')
+    args = parser.parse_args()
+
+    if not 1 <= args.rows <= 8:
+        parser.error('rows must be between 1 and 8')
+
+    name = args.name or os.path.splitext(os.path.basename(args.input))[0]
+
+    with open(args.input, encoding='utf-8-sig') as file:
+        font = json.load(file)
+
+    header, sizes = generate(font, name, args.rows)
+
+    with open(args.output, 'w', newline='') as file:
+        file.write(header)
+
+    report(name, sizes)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
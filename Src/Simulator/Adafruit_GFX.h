@@ -0,0 +1,53 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#ifndef ADAFRUIT_GFX_H
+#define ADAFRUIT_GFX_H
+
+#include "Arduino.h"
+#include "gfxfont.h"
+
+// ***
+// *** The parts of Adafruit_GFX that LedMatrix uses. The simulator
+// *** draws text with the column font so print() only moves the
+// *** cursor; GFX fonts are not rendered.
+// ***
+class Adafruit_GFX
+{
+  public:
+    Adafruit_GFX(int16_t w, int16_t h) : _width(w), _height(h) {}
+    virtual ~Adafruit_GFX() {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    void setTextSize(uint8_t) {}
+    void setTextWrap(bool) {}
+    void setFont(const GFXfont* f) { this->gfxFont = (GFXfont*)f; }
+    void setCursor(int16_t x, int16_t y) { this->cursor_x = x; this->cursor_y = y; }
+    size_t print(const char*) { return 0; }
+
+    int16_t width() const { return this->_width; }
+    int16_t height() const { return this->_height; }
+
+  protected:
+    int16_t _width;
+    int16_t _height;
+    int16_t cursor_x = 0;
+    int16_t cursor_y = 0;
+    GFXfont* gfxFont = NULL;
+};
+
+#endif
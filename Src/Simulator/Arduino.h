@@ -0,0 +1,121 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// ***
+// *** Just enough of the Arduino core to build LedMatrix on a PC for
+// *** the simulator. The AVR registers used by the display driver are
+// *** plain variables; the simulator reads and writes them to model
+// *** Timer1. Time only moves when the simulator advances it.
+// ***
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+// ***
+// *** Program memory is ordinary memory on a PC.
+// ***
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long*)(addr))
+#define memcpy_P(dest, src, size) memcpy((dest), (src), (size))
+#define strncpy_P(dest, src, size) strncpy((dest), (src), (size))
+
+#define _BV(bit) (1 << (bit))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
+// ***
+// *** The binary constants used by the display driver.
+// ***
+#define B00000000 0x00
+#define B00000100 0x04
+#define B00000111 0x07
+#define B00001000 0x08
+#define B00001100 0x0c
+#define B01110000 0x70
+#define B01111111 0x7f
+#define B10000000 0x80
+#define B10001111 0x8f
+#define B11110011 0xf3
+#define B11111111 0xff
+
+// ***
+// *** I/O ports.
+// ***
+extern uint8_t DDRB, DDRC, DDRD;
+extern uint8_t PORTB, PORTC, PORTD;
+
+#define PORTB0 0
+#define PORTB1 1
+#define PORTB2 2
+#define PORTB3 3
+#define PORTB4 4
+#define PORTB5 5
+#define PORTB6 6
+#define PORTC2 2
+#define PORTC3 3
+#define PORTD4 4
+#define PORTD5 5
+#define PORTD6 6
+
+// ***
+// *** Timer1.
+// ***
+extern uint16_t ICR1, OCR1B, TCNT1;
+extern uint8_t TCCR1B, TIMSK1, TIFR1;
+
+#define CS10 0
+#define CS11 1
+#define CS12 2
+#define WGM13 4
+#define OCIE1B 2
+#define OCF1B 2
+
+// ***
+// *** Digital pins and the pin change interrupt, used by the
+// *** square wave input of TimeManager.
+// ***
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+extern uint8_t PCICR, PCMSK1;
+
+#define digitalPinToPCICR(pin) (&PCICR)
+#define digitalPinToPCICRbit(pin) 1
+#define digitalPinToPCMSK(pin) (&PCMSK1)
+#define digitalPinToPCMSKbit(pin) ((pin) - 14)
+
+void pinMode(uint8_t, uint8_t);
+int digitalRead(uint8_t);
+
+// ***
+// *** The simulated clock.
+// ***
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long);
+
+#endif
@@ -0,0 +1,782 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#include <getopt.h>
+#include <math.h>
+#include "DisplaySimulator.h"
+#include "Other\ClockFontColumns.h"
+
+// ***
+// *** Simulates the Clock3 display on a PC. Draws a string with the
+// *** real LedMatrix driver, runs the refresh interrupts against a
+// *** model of Timer1 and reports what the LEDs would show and how
+// *** long each one is on.
+// ***
+// *** Usage: clock3sim [-t text] [-b brightness] [-c cycles] [-p file.pbm] [-k]
+// ***
+// ***   -t  the text to draw (default "12:34")
+// ***   -b  the brightness from MIN_BRIGHTNESS to MAX_BRIGHTNESS
+// ***   -c  the number of refresh cycles to run (default 50)
+// ***   -p  write the frame to a PBM file
+// ***   -k  run the checks and exit with 1 if any fail
+// ***
+
+// ***
+// *** Gives the checks access to the framebuffer.
+// ***
+class SimulatedMatrix : public LedMatrix
+{
+  public:
+    const uint8_t rows(uint8_t plane, uint8_t column)
+    {
+      uint8_t returnValue = 0;
+
+      for (uint8_t layer = 0; layer < LAYER_COUNT; layer++)
+      {
+        returnValue |= this->_matrixBuffer[layer][plane][column];
+      }
+
+      return returnValue;
+    }
+
+    const uint16_t measure(const char* text)
+    {
+      return this->measureText(text);
+    }
+
+    const uint16_t compareValue(uint8_t plane, uint8_t bitCount)
+    {
+      return this->_compareTable[plane][bitCount];
+    }
+
+    const uint8_t intensity(uint8_t column, uint8_t row)
+    {
+      uint8_t returnValue = 0;
+
+      for (uint8_t plane = 0; plane < GRAYSCALE_BITS; plane++)
+      {
+        if (this->rows(plane, column) & _BV(row))
+        {
+          returnValue |= _BV(plane);
+        }
+      }
+
+      return returnValue;
+    }
+};
+
+// ***
+// *** The duty cycle the driver should give an LED of the specified
+// *** intensity in a column with the specified number of LEDs lit,
+// *** worked out from the design rather than from the driver code.
+// ***
+double expectedDuty(uint8_t intensity, uint8_t bitCount, uint8_t brightness, Microseconds_t refreshDelay)
+{
+  double columnTime = (double)refreshDelay * GRAYSCALE_BITS;
+  double compensation = (8.0 * COMP_DELAY_PER_BIT) - (COMP_DELAY_PER_BIT * bitCount);
+  double onFraction = (columnTime - compensation) / columnTime;
+
+  // ***
+  // *** The most significant plane is on for the whole window and
+  // *** each plane below it for half as long as the one above.
+  // ***
+  double planes = (double)intensity / (double)(1 << (GRAYSCALE_BITS - 1));
+
+  return onFraction * planes / (COLUMNS * GRAYSCALE_BITS) / (double)(1 << (MAX_BRIGHTNESS - brightness));
+}
+
+// ***
+// *** Draws the text, lets the refresh pipeline settle and then
+// *** runs the specified number of cycles.
+// ***
+void render(SimulatedMatrix& display, DisplaySimulator& simulator, const char* text, uint8_t brightness, uint16_t cycles)
+{
+  display.setBrightness(brightness);
+  display.drawTextCentered(text);
+  display.present();
+
+  simulator.run(1);
+  simulator.resetCounters();
+  simulator.run(cycles);
+}
+
+// ***
+// *** Gets the rows lit in each column when the text is drawn
+// *** centered in the framebuffer. The framebuffer is cleared.
+// ***
+void textRows(SimulatedMatrix& display, const char* text, uint8_t rows[COLUMNS])
+{
+  display.drawTextCentered(text);
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    rows[column] = display.rows(GRAYSCALE_BITS - 1, column);
+  }
+
+  display.clear();
+}
+
+// ***
+// *** Returns the number of LEDs that were on since the counters
+// *** were reset but should not have been, or the other way round.
+// ***
+uint16_t countMismatches(DisplaySimulator& simulator, const uint8_t rows[COLUMNS])
+{
+  uint16_t returnValue = 0;
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      if ((simulator.onTime(column, row) > 0) != ((rows[column] & _BV(row)) != 0))
+      {
+        returnValue++;
+      }
+    }
+  }
+
+  return returnValue;
+}
+
+// ***
+// *** Compares the measured duty of every LED with the design.
+// ***
+uint16_t checkFrame(SimulatedMatrix& display, DisplaySimulator& simulator, uint8_t brightness)
+{
+  uint16_t failures = 0;
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    uint8_t bitCount = 0;
+
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      if (display.intensity(column, row))
+      {
+        bitCount++;
+      }
+    }
+
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      uint8_t intensity = display.intensity(column, row);
+      double measured = simulator.duty(column, row);
+      double expected = expectedDuty(intensity, bitCount, brightness, display.getRefreshDelay());
+
+      // ***
+      // *** Allow for the compare values being whole timer ticks.
+      // ***
+      bool pass = intensity ? fabs(measured - expected) <= expected * 0.02 : measured == 0;
+
+      if (!pass)
+      {
+        printf("FAIL brightness %d column %d row %d: duty %.5f, expected %.5f\n", brightness, column, row, measured, expected);
+        failures++;
+      }
+    }
+  }
+
+  if (simulator.glitches())
+  {
+    printf("FAIL brightness %d: %u port writes while a column was on\n", brightness, simulator.glitches());
+    failures++;
+  }
+
+  return failures;
+}
+
+// ***
+// *** Runs every check and returns the number of failures.
+// ***
+uint16_t runChecks(SimulatedMatrix& display, DisplaySimulator& simulator, uint16_t cycles)
+{
+  uint16_t failures = 0;
+
+  // ***
+  // *** Text at every brightness. The compensation depends on
+  // *** the number of LEDs lit so use text with a mix.
+  // ***
+  for (uint8_t brightness = MIN_BRIGHTNESS; brightness <= MAX_BRIGHTNESS; brightness++)
+  {
+    render(display, simulator, "12:48", brightness, cycles);
+    failures += checkFrame(display, simulator, brightness);
+  }
+
+  // ***
+  // *** When the compare interrupts are held off long enough for
+  // *** both matches of a slot to be handled by one interrupt the
+  // *** column must stay dark for that slot rather than being left
+  // *** on until the next BOTTOM. The latency merges every match of
+  // *** the dimmest plane; with few LEDs lit the brighter plane's
+  // *** window is also short enough to merge.
+  // ***
+  display.setBrightness(MIN_BRIGHTNESS);
+  uint16_t widestWindow = 0;
+
+  for (uint8_t bitCount = 1; bitCount <= ROWS; bitCount++)
+  {
+    widestWindow = max(widestWindow, (uint16_t)(ICR1 - display.compareValue(0, bitCount)));
+  }
+
+  simulator.setCompareLatency((2 * widestWindow) + 1);
+  render(display, simulator, "12:48", MIN_BRIGHTNESS, cycles);
+  simulator.setCompareLatency(0);
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    uint8_t bitCount = 0;
+
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      bitCount += display.intensity(column, row) ? 1 : 0;
+    }
+
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      uint8_t intensity = display.intensity(column, row);
+
+      // ***
+      // *** A plane stays dark when its match while counting down
+      // *** happens before the interrupt for the match while counting
+      // *** up reads Timer1.
+      // ***
+      for (uint8_t plane = 0; plane < GRAYSCALE_BITS; plane++)
+      {
+        if (2 * (ICR1 - display.compareValue(plane, bitCount)) <= (2 * widestWindow) + 1 + SIMULATED_COMPARE_CYCLES)
+        {
+          intensity &= ~_BV(plane);
+        }
+      }
+
+      double measured = simulator.duty(column, row);
+      double expected = expectedDuty(intensity, bitCount, MIN_BRIGHTNESS, display.getRefreshDelay());
+      bool pass = intensity ? fabs(measured - expected) <= expected * 0.02 : measured == 0;
+
+      if (!pass)
+      {
+        printf("FAIL late compare column %d row %d: duty %.5f, expected %.5f\n", column, row, measured, expected);
+        failures++;
+      }
+    }
+  }
+
+  if (simulator.glitches())
+  {
+    printf("FAIL late compare: %u port writes while a column was on\n", simulator.glitches());
+    failures++;
+  }
+
+  // ***
+  // *** Every intensity and every number of LEDs lit in a column.
+  // ***
+  display.setBrightness(MAX_BRIGHTNESS);
+  display.clear();
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    for (uint8_t row = 0; row < (column % (ROWS + 1)); row++)
+    {
+      display.drawPixel(column, row, 1 + (column % INTENSITY_MAX));
+    }
+  }
+
+  display.present();
+  simulator.run(1);
+  simulator.resetCounters();
+  simulator.run(cycles);
+  failures += checkFrame(display, simulator, MAX_BRIGHTNESS);
+
+  // ***
+  // *** Changing the last digit must only mark the columns that
+  // *** differ and the partly rebuilt tables must still match the
+  // *** framebuffer. Three changes in a row use both tables.
+  // ***
+  const char* times[] = { "12:48", "12:49", "12:50", "12:51" };
+  render(display, simulator, times[0], MAX_BRIGHTNESS, cycles);
+
+  for (uint8_t i = 1; i < sizeof(times) / sizeof(times[0]); i++)
+  {
+    uint8_t before[COLUMNS];
+    ColumnMask_t expected = 0;
+
+    for (uint8_t column = 0; column < COLUMNS; column++)
+    {
+      before[column] = display.rows(GRAYSCALE_BITS - 1, column);
+    }
+
+    display.drawTextCentered(times[i]);
+
+    for (uint8_t column = 0; column < COLUMNS; column++)
+    {
+      if (display.rows(GRAYSCALE_BITS - 1, column) != before[column])
+      {
+        expected |= COLUMN_BIT(column);
+      }
+    }
+
+    if (display.getDirtyColumns() != expected)
+    {
+      printf("FAIL \"%s\": dirty columns 0x%05lx, expected 0x%05lx\n", times[i], (unsigned long)display.getDirtyColumns(), (unsigned long)expected);
+      failures++;
+    }
+
+    render(display, simulator, times[i], MAX_BRIGHTNESS, cycles);
+    failures += checkFrame(display, simulator, MAX_BRIGHTNESS);
+  }
+
+  // ***
+  // *** An indicator drawn on its own layer must survive the text
+  // *** being redrawn and turning it off must only dirty its column.
+  // ***
+  display.setLayer(LAYER_INDICATOR);
+  display.drawPixel(18, 5, LED_DIM);
+  display.setLayer(LAYER_TEXT);
+  render(display, simulator, "12:52", MAX_BRIGHTNESS, cycles);
+  failures += checkFrame(display, simulator, MAX_BRIGHTNESS);
+
+  if (display.intensity(18, 5) != LED_DIM)
+  {
+    printf("FAIL indicator was lost when the text was redrawn\n");
+    failures++;
+  }
+
+  display.setLayer(LAYER_INDICATOR);
+  display.drawPixel(18, 5, LED_OFF);
+  display.setLayer(LAYER_TEXT);
+
+  if (display.getDirtyColumns() != COLUMN_BIT(18))
+  {
+    printf("FAIL indicator change dirtied columns 0x%05lx\n", (unsigned long)display.getDirtyColumns());
+    failures++;
+  }
+
+  display.present();
+  simulator.run(1);
+  simulator.resetCounters();
+  simulator.run(cycles);
+  failures += checkFrame(display, simulator, MAX_BRIGHTNESS);
+
+  // ***
+  // *** Every transition must be running straight after it starts,
+  // *** show a frame between the two times part way through and end
+  // *** on the new frame once all of its steps have passed.
+  // ***
+  const Transition_t transitions[] = { TRANSITION_ROLL, TRANSITION_WIPE, TRANSITION_DISSOLVE };
+
+  for (uint8_t i = 0; i < sizeof(transitions) / sizeof(transitions[0]); i++)
+  {
+    render(display, simulator, "12:58", MAX_BRIGHTNESS, cycles);
+
+    display.drawTextCentered("1:03");
+    display.present(transitions[i], 1);
+
+    if (!display.isTransitioning())
+    {
+      printf("FAIL transition %d did not start\n", transitions[i]);
+      failures++;
+    }
+
+    simulator.resetCounters();
+    simulator.run(1 + (transitions[i] == TRANSITION_WIPE ? COLUMNS / 2 : 3));
+    uint16_t mixed = 0;
+
+    for (uint8_t column = 0; column < COLUMNS; column++)
+    {
+      for (uint8_t row = 0; row < ROWS; row++)
+      {
+        if ((simulator.onTime(column, row) > 0) != (display.intensity(column, row) > 0))
+        {
+          mixed++;
+        }
+      }
+    }
+
+    if (mixed == 0)
+    {
+      printf("FAIL transition %d showed the new frame straight away\n", transitions[i]);
+      failures++;
+    }
+
+    simulator.run(COLUMNS + 1);
+
+    if (display.isTransitioning())
+    {
+      printf("FAIL transition %d did not end\n", transitions[i]);
+      failures++;
+    }
+
+    simulator.resetCounters();
+    simulator.run(cycles);
+    failures += checkFrame(display, simulator, MAX_BRIGHTNESS);
+  }
+
+  // ***
+  // *** Queued momentary messages must each be shown in turn and
+  // *** the framebuffer must come back when the last one expires.
+  // ***
+  // ***
+  // *** The framebuffer is presented again while each one is
+  // *** shown, the way the sketch presents the time.
+  // ***
+  const char* messages[] = { "GPS", "No Fx" };
+  const Milliseconds_t messageTime = 100;
+  uint16_t messageCycles = ((uint32_t)messageTime * display.getRefreshRate()) / 1000 + 1;
+  uint8_t expectedRows[2][COLUMNS];
+
+  for (uint8_t i = 0; i < sizeof(messages) / sizeof(messages[0]); i++)
+  {
+    textRows(display, messages[i], expectedRows[i]);
+  }
+
+  render(display, simulator, "12:48", MAX_BRIGHTNESS, cycles);
+
+  for (uint8_t i = 0; i < sizeof(messages) / sizeof(messages[0]); i++)
+  {
+    display.drawMomentaryTextCentered(messages[i], messageTime, true);
+  }
+
+  for (uint8_t i = 0; i < sizeof(messages) / sizeof(messages[0]); i++)
+  {
+    display.present();
+    simulator.run(1);
+    simulator.resetCounters();
+    simulator.run(cycles);
+
+    if (!display.isShowingMomentaryText() || countMismatches(simulator, expectedRows[i]))
+    {
+      printf("FAIL momentary message \"%s\" was not shown\n", messages[i]);
+      failures++;
+    }
+
+    simulator.run(messageCycles);
+    display.process();
+  }
+
+  if (display.isShowingMomentaryText())
+  {
+    printf("FAIL momentary messages did not end\n");
+    failures++;
+  }
+
+  simulator.run(1);
+  simulator.resetCounters();
+  simulator.run(cycles);
+  failures += checkFrame(display, simulator, MAX_BRIGHTNESS);
+
+  // ***
+  // *** Scrolling text must enter from the right and move one
+  // *** column every step. Each position is measured in the
+  // *** middle of a step so the whole cycle shows it.
+  // ***
+  const char* scrollText = "12:48";
+  const uint8_t scrollFrames = 4;
+  uint8_t textColumns[COLUMNS];
+
+  display.clear();
+  display.drawText(0, scrollText);
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    textColumns[column] = display.rows(GRAYSCALE_BITS - 1, column);
+  }
+
+  uint16_t scrollLength = COLUMNS + display.getTextWidth(scrollText);
+  const uint8_t positions[] = { COLUMNS / 2, COLUMNS, COLUMNS + 3 };
+  uint8_t elapsed = 0;
+
+  render(display, simulator, "12:48", MAX_BRIGHTNESS, cycles);
+  display.startScroll(scrollText, scrollFrames);
+
+  for (uint8_t i = 0; i < sizeof(positions) / sizeof(positions[0]); i++)
+  {
+    simulator.run((positions[i] - elapsed) * scrollFrames + 1);
+    simulator.resetCounters();
+    simulator.run(1);
+    elapsed = positions[i] + 1;
+
+    for (uint8_t column = 0; column < COLUMNS; column++)
+    {
+      int16_t index = positions[i] + column - COLUMNS;
+      expectedRows[0][column] = index >= 0 && index < COLUMNS ? textColumns[index] : 0;
+    }
+
+    if (countMismatches(simulator, expectedRows[0]))
+    {
+      printf("FAIL scroll position %d was not shown\n", positions[i]);
+      failures++;
+    }
+
+    simulator.run(scrollFrames - 2);
+  }
+
+  simulator.run((scrollLength - elapsed) * scrollFrames + 1);
+
+  if (!display.isScrolling() || display.getScrollCount() != 1)
+  {
+    printf("FAIL scroll count %d after one pass, expected 1\n", display.getScrollCount());
+    failures++;
+  }
+
+  display.stopScroll();
+  display.present();
+  simulator.run(1);
+  simulator.resetCounters();
+  simulator.run(cycles);
+  failures += checkFrame(display, simulator, MAX_BRIGHTNESS);
+
+  // ***
+  // *** The column addresses worked out by the compiler must match
+  // *** the wiring of the clock: three decoders on PD4 to PD6
+  // *** enabled by PC2 and PC3.
+  // ***
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    uint8_t expected = ((column % 8) << 4) | (column <= 7 ? 0x04 : column <= 15 ? 0x08 : 0x00);
+
+    if (pgm_read_byte(&_columnAddress[column]) != expected)
+    {
+      printf("FAIL column %d address 0x%02x, expected 0x%02x\n", column, pgm_read_byte(&_columnAddress[column]), expected);
+      failures++;
+    }
+  }
+
+  // ***
+  // *** The self test must return at once, light every LED, find
+  // *** the LEDs that draw no current and then show the frame
+  // *** that was there before it started.
+  // ***
+  render(display, simulator, "12:48", MAX_BRIGHTNESS, cycles);
+  simulator.setDeadLeds(5, _BV(3));
+  simulator.setDeadLeds(17, _BV(0) | _BV(6));
+  display.startSelfTest(1);
+
+  if (!display.isSelfTesting())
+  {
+    printf("FAIL self test did not start\n");
+    failures++;
+  }
+
+  simulator.run(ROWS + 1 + (COLUMNS * SELF_TEST_SWEEP_FRAMES) + 1);
+  simulator.resetCounters();
+  simulator.run(SELF_TEST_HOLD_FRAMES / 2);
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      if (simulator.onTime(column, row) == 0)
+      {
+        printf("FAIL self test did not light column %d, row %d\n", column, row);
+        failures++;
+      }
+    }
+  }
+
+  simulator.run(SELF_TEST_HOLD_FRAMES);
+
+  if (display.isSelfTesting())
+  {
+    printf("FAIL self test did not end\n");
+    failures++;
+  }
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    uint8_t expected = column == 5 ? _BV(3) : column == 17 ? (_BV(0) | _BV(6)) : 0;
+
+    if (display.getLedFaults(column) != expected)
+    {
+      printf("FAIL self test faults in column %d: 0x%02x, expected 0x%02x\n", column, display.getLedFaults(column), expected);
+      failures++;
+    }
+  }
+
+  if (display.getLedFaultCount() != 3)
+  {
+    printf("FAIL self test found %d faults, expected 3\n", display.getLedFaultCount());
+    failures++;
+  }
+
+  simulator.setDeadLeds(5, 0);
+  simulator.setDeadLeds(17, 0);
+  simulator.resetCounters();
+  simulator.run(cycles);
+  failures += checkFrame(display, simulator, MAX_BRIGHTNESS);
+
+  // ***
+  // *** The calibration must add up the interrupt times the
+  // *** simulator reports and pick the flicker free rate when it
+  // *** fits under the ceiling and a slower one when it does not.
+  // ***
+  RefreshBudget_t budget;
+  uint16_t expectedLoad = ((SIMULATED_REFRESH_CYCLES + 2UL * SIMULATED_COMPARE_CYCLES) * 1000UL) / (2UL * ICR1);
+  const uint8_t ceilings[] = { DEFAULT_LOAD_CEILING, 5 };
+
+  for (uint8_t i = 0; i < sizeof(ceilings) / sizeof(ceilings[0]); i++)
+  {
+    display.startCalibration(ceilings[i]);
+
+    if (!display.isCalibrating() || display.getRefreshBudget(&budget))
+    {
+      printf("FAIL calibration did not start\n");
+      failures++;
+    }
+
+    simulator.run(CALIBRATION_CYCLES);
+
+    if (display.isCalibrating() || !display.getRefreshBudget(&budget))
+    {
+      printf("FAIL calibration did not end\n");
+      failures++;
+    }
+    else
+    {
+      uint8_t expectedRate = expectedLoad * FLICKER_FREE_REFRESH_RATE / display.getRefreshRate() <= ceilings[i] * 10U ? FLICKER_FREE_REFRESH_RATE : constrain((display.getRefreshRate() * ceilings[i] * 10U) / expectedLoad, MIN_REFRESH_RATE, MAX_REFRESH_RATE);
+
+      if (budget.refreshMinimum != SIMULATED_REFRESH_CYCLES || budget.refreshMaximum != SIMULATED_REFRESH_CYCLES ||
+          budget.refreshAverage != SIMULATED_REFRESH_CYCLES || budget.compareAverage != SIMULATED_COMPARE_CYCLES ||
+          budget.slotCycles != 2UL * ICR1 || budget.load != expectedLoad || budget.tunedRate != expectedRate)
+      {
+        printf("FAIL calibration: refresh %u/%u/%u, compare %u, slot %lu, load %u (expected %u), rate %u (expected %u)\n",
+               budget.refreshMinimum, budget.refreshAverage, budget.refreshMaximum, budget.compareAverage,
+               (unsigned long)budget.slotCycles, budget.load, expectedLoad, budget.tunedRate, expectedRate);
+        failures++;
+      }
+    }
+  }
+
+  // ***
+  // *** Cached widths must match a fresh measurement and the
+  // *** integer centering must match the floating point
+  // *** calculation it replaced. More labels than cache
+  // *** entries are used so entries are replaced. The times
+  // *** are pairs of the same length with different widths.
+  // ***
+  const char* labels[] = { "TZ", "DST", "12:48", "Yes", "No", "Auto", "TZ", "clk 3", "", "12:48", "Bat V", "DST",
+                           "11:30", "21:33", "11:34", "21:37", "21:32", "11:31" };
+
+  for (uint8_t pass = 0; pass < 2; pass++)
+  {
+    for (uint8_t i = 0; i < sizeof(labels) / sizeof(labels[0]); i++)
+    {
+      uint16_t width = display.getTextWidth(labels[i]);
+      int16_t left = (int16_t)((display.width() - ((float)display.measure(labels[i]) - 1)) / 2.0);
+
+      if (width != display.measure(labels[i]) || display.getCenteredColumn(labels[i]) != left)
+      {
+        printf("FAIL \"%s\": width %u, measured %u, left %d, expected %d\n", labels[i], width, display.measure(labels[i]), display.getCenteredColumn(labels[i]), left);
+        failures++;
+      }
+    }
+  }
+
+  printf("%s: %u failure(s)\n", failures ? "FAILED" : "PASSED", failures);
+  return failures;
+}
+
+// ***
+// *** Prints the frame and the duty cycle of each column.
+// ***
+void report(SimulatedMatrix& display, DisplaySimulator& simulator)
+{
+  simulator.writeAscii(stdout);
+
+  printf("Refresh rate: %d Hz, slot: %u us, TOP: %u, brightness: %d\n",
+         display.getRefreshRate(), display.getRefreshDelay(), ICR1, display.getBrightness());
+  printf("Simulated: %.1f ms\n\n", simulator.elapsed() / (double)(CYCLES_PER_MICROSECOND * 1000UL));
+  printf("Column  Lit  On time per lit LED (us/cycle)  Duty\n");
+
+  uint16_t cycles = simulator.elapsed() / ((uint64_t)REFRESH_SLOTS * 2 * ICR1);
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    uint8_t lit = 0;
+    uint64_t total = 0;
+
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      if (simulator.onTime(column, row))
+      {
+        lit++;
+        total += simulator.onTime(column, row);
+      }
+    }
+
+    double perLed = lit ? (double)total / lit / CYCLES_PER_MICROSECOND / cycles : 0;
+    double duty = lit ? (double)total / lit / simulator.elapsed() : 0;
+    printf("%6d  %3d  %30.1f  %.4f\n", column, lit, perLed, duty);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  const char* text = "12:34";
+  const char* pbm = NULL;
+  uint8_t brightness = MAX_BRIGHTNESS;
+  uint16_t cycles = 50;
+  bool check = false;
+  int option;
+
+  while ((option = getopt(argc, argv, "t:b:c:p:k")) != -1)
+  {
+    switch (option)
+    {
+      case 't':
+        text = optarg;
+        break;
+      case 'b':
+        brightness = atoi(optarg);
+        break;
+      case 'c':
+        cycles = max(1, atoi(optarg));
+        break;
+      case 'p':
+        pbm = optarg;
+        break;
+      case 'k':
+        check = true;
+        break;
+      default:
+        fprintf(stderr, "Usage: %s [-t text] [-b brightness] [-c cycles] [-p file.pbm] [-k]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  // ***
+  // *** Set the display up the same way Clock3.ino does.
+  // ***
+  SimulatedMatrix display;
+  DisplaySimulator simulator(&display);
+  display.begin(&ClockFontColumns);
+  simulator.begin();
+  display.enableCompareInterrupt();
+
+  if (check)
+  {
+    return runChecks(display, simulator, cycles) ? 1 : 0;
+  }
+
+  render(display, simulator, text, brightness, cycles);
+  report(display, simulator);
+
+  if (pbm && !simulator.writePbm(pbm))
+  {
+    fprintf(stderr, "Could not write %s\n", pbm);
+    return 1;
+  }
+
+  return 0;
+}
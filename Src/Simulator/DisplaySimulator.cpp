@@ -0,0 +1,409 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#include "DisplaySimulator.h"
+
+// ***
+// *** The simulated AVR registers.
+// ***
+uint8_t DDRB = 0, DDRC = 0, DDRD = 0;
+uint8_t PORTB = 0, PORTC = 0, PORTD = 0;
+uint16_t ICR1 = 0, OCR1B = 0, TCNT1 = 0;
+uint8_t TCCR1B = 0, TIMSK1 = 0, TIFR1 = 0;
+
+// ***
+// *** Simulated time.
+// ***
+uint64_t simulatorCycles = 0;
+
+unsigned long millis()
+{
+  return (unsigned long)(simulatorCycles / (CYCLES_PER_MICROSECOND * 1000UL));
+}
+
+unsigned long micros()
+{
+  return (unsigned long)(simulatorCycles / CYCLES_PER_MICROSECOND);
+}
+
+void delay(unsigned long ms)
+{
+  simulatorCycles += (uint64_t)ms * CYCLES_PER_MICROSECOND * 1000UL;
+}
+
+// ***
+// *** The simulator that receives the port writes.
+// ***
+static DisplaySimulator* _simulator = NULL;
+
+void simulatorWriteRows(uint8_t rows)
+{
+  if (_simulator)
+  {
+    _simulator->writeRows(rows);
+  }
+}
+
+void simulatorWriteDecoder(uint8_t address)
+{
+  if (_simulator)
+  {
+    _simulator->writeDecoder(address);
+  }
+}
+
+void simulatorWriteChipSelect(uint8_t select)
+{
+  if (_simulator)
+  {
+    _simulator->writeChipSelect(select);
+  }
+}
+
+uint8_t simulatorReadChipSelect()
+{
+  return _simulator ? _simulator->readChipSelect() : CS_OFF;
+}
+
+void simulatorSelectConversion(uint8_t channel)
+{
+  if (_simulator)
+  {
+    _simulator->selectConversion(channel);
+  }
+}
+
+void simulatorStartConversion()
+{
+  if (_simulator)
+  {
+    _simulator->startConversion();
+  }
+}
+
+uint16_t simulatorReadConversion()
+{
+  return _simulator ? _simulator->readConversion() : 0;
+}
+
+DisplaySimulator::DisplaySimulator(LedMatrix* display)
+{
+  this->_display = display;
+  memset(this->_deadLeds, 0, sizeof(this->_deadLeds));
+  this->resetCounters();
+}
+
+void DisplaySimulator::begin()
+{
+  _simulator = this;
+
+  // ***
+  // *** TimerOne::initialize() uses no prescaler when the period
+  // *** fits and sets TOP to half the period since the timer counts
+  // *** up and back down.
+  // ***
+  uint32_t cycles = (F_CPU / 2000000UL) * this->_display->getRefreshDelay();
+  ICR1 = cycles < 65536UL ? cycles : 65535;
+  TCCR1B = _BV(WGM13) | _BV(CS10);
+  TIMSK1 = 1;
+}
+
+void DisplaySimulator::run(uint16_t cycles)
+{
+  uint32_t slots = (uint32_t)cycles * REFRESH_SLOTS;
+  uint16_t top = ICR1;
+
+  for (uint32_t i = 0; i < slots; i++)
+  {
+    // ***
+    // *** OCR1B is latched at BOTTOM before the overflow interrupt
+    // *** runs so the value written by refresh() is used in the
+    // *** next slot.
+    // ***
+    uint64_t bottom = simulatorCycles;
+    uint16_t compare = OCR1B;
+    TCNT1 = SIMULATED_REFRESH_CYCLES;
+    this->_display->refresh();
+
+    if (TIMSK1 & _BV(OCIE1B))
+    {
+      // ***
+      // *** Each interrupt starts _compareLatency cycles after its
+      // *** match. OCF1B is a single flag so when the match while
+      // *** counting down happens before the interrupt for the match
+      // *** while counting up has started there is only one interrupt.
+      // ***
+      uint64_t up = bottom + compare + this->_compareLatency;
+      uint64_t down = bottom + (2UL * top) - compare;
+
+      simulatorCycles = up;
+      TCNT1 = this->count(up - bottom + SIMULATED_COMPARE_CYCLES, top);
+      this->_display->compareMatch();
+
+      if (down > up)
+      {
+        down = max(down + this->_compareLatency, up + SIMULATED_COMPARE_CYCLES);
+        simulatorCycles = down;
+        TCNT1 = this->count(down - bottom + SIMULATED_COMPARE_CYCLES, top);
+        this->_display->compareMatch();
+      }
+    }
+
+    simulatorCycles = bottom + (2UL * top);
+  }
+
+  this->accumulate();
+}
+
+const uint16_t DisplaySimulator::count(uint64_t cycles, uint16_t top)
+{
+  // ***
+  // *** Timer1 counts up to TOP and back down once per slot.
+  // ***
+  return cycles <= top ? cycles : (2UL * top) - cycles;
+}
+
+void DisplaySimulator::setCompareLatency(uint16_t cycles)
+{
+  this->_compareLatency = cycles;
+}
+
+void DisplaySimulator::resetCounters()
+{
+  this->accumulate();
+  memset(this->_onTime, 0, sizeof(this->_onTime));
+  this->_glitches = 0;
+  this->_start = simulatorCycles;
+}
+
+const uint64_t DisplaySimulator::elapsed()
+{
+  return simulatorCycles - this->_start;
+}
+
+const uint64_t DisplaySimulator::onTime(uint8_t column, uint8_t row)
+{
+  return this->_onTime[column][row];
+}
+
+const double DisplaySimulator::duty(uint8_t column, uint8_t row)
+{
+  uint64_t elapsed = this->elapsed();
+  return elapsed > 0 ? (double)this->_onTime[column][row] / (double)elapsed : 0;
+}
+
+const uint32_t DisplaySimulator::glitches()
+{
+  return this->_glitches;
+}
+
+void DisplaySimulator::setDeadLeds(uint8_t column, uint8_t rows)
+{
+  this->_deadLeds[column] = rows;
+}
+
+void DisplaySimulator::selectConversion(uint8_t channel)
+{
+  // ***
+  // *** There is only one analog input in the simulator.
+  // ***
+}
+
+void DisplaySimulator::startConversion()
+{
+  // ***
+  // *** The ADC samples as the conversion starts so the result
+  // *** is the current of the LEDs lit at this moment.
+  // ***
+  int8_t column = this->selectedColumn();
+  uint8_t lit = 0;
+
+  if (column >= 0)
+  {
+    uint8_t rows = ROW_PORT & ROW_MASK & ~this->_deadLeds[column];
+
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      if (rows & _BV(row))
+      {
+        lit++;
+      }
+    }
+  }
+
+  this->_conversion = SIMULATED_SENSE_OFFSET + (lit * SIMULATED_SENSE_PER_LED);
+}
+
+uint16_t DisplaySimulator::readConversion()
+{
+  return this->_conversion;
+}
+
+void DisplaySimulator::writeAscii(FILE* file)
+{
+  static const char shades[] = " .:-=+*#%@";
+  uint64_t brightest = 0;
+
+  for (uint8_t column = 0; column < COLUMNS; column++)
+  {
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      brightest = max(brightest, this->_onTime[column][row]);
+    }
+  }
+
+  fprintf(file, "+");
+  for (uint8_t column = 0; column < COLUMNS; column++) fprintf(file, "-");
+  fprintf(file, "+\n");
+
+  for (uint8_t row = 0; row < ROWS; row++)
+  {
+    fprintf(file, "|");
+
+    for (uint8_t column = 0; column < COLUMNS; column++)
+    {
+      uint64_t value = this->_onTime[column][row];
+      uint8_t shade = 0;
+
+      // ***
+      // *** Any LED that was on gets at least the lightest mark.
+      // ***
+      if (value > 0)
+      {
+        shade = 1 + (uint8_t)((value * (sizeof(shades) - 3)) / brightest);
+      }
+
+      fprintf(file, "%c", shades[shade]);
+    }
+
+    fprintf(file, "|\n");
+  }
+
+  fprintf(file, "+");
+  for (uint8_t column = 0; column < COLUMNS; column++) fprintf(file, "-");
+  fprintf(file, "+\n");
+}
+
+bool DisplaySimulator::writePbm(const char* path)
+{
+  bool returnValue = false;
+  FILE* file = fopen(path, "w");
+
+  if (file)
+  {
+    fprintf(file, "P1\n%d %d\n", COLUMNS, ROWS);
+
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      for (uint8_t column = 0; column < COLUMNS; column++)
+      {
+        fprintf(file, column ? " %d" : "%d", this->_onTime[column][row] > 0 ? 1 : 0);
+      }
+
+      fprintf(file, "\n");
+    }
+
+    returnValue = fclose(file) == 0;
+  }
+
+  return returnValue;
+}
+
+void DisplaySimulator::writeRows(uint8_t rows)
+{
+  this->accumulate();
+
+  if (this->selectedColumn() >= 0)
+  {
+    this->_glitches++;
+  }
+
+  ROW_PORT = (ROW_PORT & ~ROW_MASK) | (rows & ROW_MASK);
+}
+
+void DisplaySimulator::writeDecoder(uint8_t address)
+{
+  this->accumulate();
+
+  if (this->selectedColumn() >= 0)
+  {
+    this->_glitches++;
+  }
+
+  DECODER_PORT = (DECODER_PORT & ~DECODER_MASK) | (address & DECODER_MASK);
+}
+
+void DisplaySimulator::writeChipSelect(uint8_t select)
+{
+  this->accumulate();
+  CHIP_SELECT_PORT = (CHIP_SELECT_PORT & ~CS_MASK) | (select & CS_MASK);
+}
+
+uint8_t DisplaySimulator::readChipSelect()
+{
+  return PORTC & CS_MASK;
+}
+
+void DisplaySimulator::accumulate()
+{
+  int8_t column = this->selectedColumn();
+
+  if (column >= 0)
+  {
+    uint64_t time = simulatorCycles - this->_last;
+
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      if (PORTB & _BV(row))
+      {
+        this->_onTime[column][row] += time;
+      }
+    }
+  }
+
+  this->_last = simulatorCycles;
+}
+
+int8_t DisplaySimulator::selectedColumn()
+{
+  int8_t returnValue = -1;
+  uint8_t select = CHIP_SELECT_PORT & CS_MASK;
+
+  // ***
+  // *** Work out which decoder is enabled and which of its
+  // *** outputs is selected. The last decoder may not have all
+  // *** of its outputs connected.
+  // ***
+  if (select != CS_OFF)
+  {
+    for (uint8_t bank = 0; bank < DECODER_BANKS; bank++)
+    {
+      if (select == CS_BANK(bank))
+      {
+        uint8_t column = (bank * DECODER_OUTPUTS) + ((DECODER_PORT & DECODER_MASK) >> DECODER_SHIFT);
+
+        if (column < COLUMNS)
+        {
+          returnValue = column;
+        }
+
+        break;
+      }
+    }
+  }
+
+  return returnValue;
+}
@@ -0,0 +1,202 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#ifndef DISPLAY_SIMULATOR_H
+#define DISPLAY_SIMULATOR_H
+
+#include <stdio.h>
+#include "LedMatrix.h"
+
+// ***
+// *** The CPU clock of the Solder:Time Desk Clock (an 8 MHz
+// *** ATmega328P). Simulated time is kept in CPU cycles. Build
+// *** with -DF_CPU=... to simulate another clock.
+// ***
+#ifndef F_CPU
+#define F_CPU 8000000UL
+#endif
+#define CYCLES_PER_MICROSECOND (F_CPU / 1000000UL)
+
+// ***
+// *** The length of each interrupt in CPU cycles as seen by the
+// *** calibration. The simulator does not count instructions so
+// *** these are fixed values used to check the budget arithmetic.
+// ***
+#define SIMULATED_REFRESH_CYCLES 180
+#define SIMULATED_COMPARE_CYCLES 60
+
+// ***
+// *** The ADC reading of the row current with no LEDs lit and the
+// *** increase for each LED that is lit.
+// ***
+#define SIMULATED_SENSE_OFFSET 20
+#define SIMULATED_SENSE_PER_LED 40
+
+// ***
+// *** Runs LedMatrix against a model of Timer1 and the display
+// *** hardware. Timer1 is modeled the way TimerOne sets it up: phase
+// *** and frequency correct PWM with ICR1 as TOP and no prescaler. The
+// *** overflow interrupt (refresh) runs at BOTTOM and the compare B
+// *** interrupt runs at both OCR1B matches. Every port write made by
+// *** the driver is recorded so the time each LED is on can be added
+// *** up.
+// ***
+class DisplaySimulator
+{
+  public:
+    // ***
+    // *** Create an instance for the specified display.
+    // ***
+    DisplaySimulator(LedMatrix*);
+
+    // ***
+    // *** Sets up Timer1 as TimerOne::initialize() would for the
+    // *** display refresh delay and makes this the active simulator.
+    // ***
+    void begin();
+
+    // ***
+    // *** Runs the specified number of complete refresh cycles.
+    // ***
+    void run(uint16_t);
+
+    // ***
+    // *** Clears the on time of every LED and the write counters.
+    // ***
+    void resetCounters();
+
+    // ***
+    // *** Delays every compare interrupt by the specified number of
+    // *** CPU cycles, as another interrupt holding it off would.
+    // ***
+    void setCompareLatency(uint16_t);
+
+    // ***
+    // *** The number of CPU cycles since the counters were reset.
+    // ***
+    const uint64_t elapsed();
+
+    // ***
+    // *** The number of CPU cycles the LED at the specified column
+    // *** and row was on since the counters were reset.
+    // ***
+    const uint64_t onTime(uint8_t, uint8_t);
+
+    // ***
+    // *** The fraction of the time the LED was on (0 to 1).
+    // ***
+    const double duty(uint8_t, uint8_t);
+
+    // ***
+    // *** The number of times the rows or the column address were
+    // *** changed while a column was switched on. Anything other
+    // *** than 0 means LEDs in the wrong column were lit.
+    // ***
+    const uint32_t glitches();
+
+    // ***
+    // *** Sets the rows in the specified column that draw no
+    // *** current when they are lit (bit 0 is row 1).
+    // ***
+    void setDeadLeds(uint8_t, uint8_t);
+
+    // ***
+    // *** Writes the frame as text. Each LED is shown with a
+    // *** character that gets heavier as its on time increases.
+    // ***
+    void writeAscii(FILE*);
+
+    // ***
+    // *** Writes the frame as a plain PBM image with one pixel per
+    // *** LED. Any LED that was on at all is black.
+    // ***
+    bool writePbm(const char*);
+
+    // ***
+    // *** Called by the HAL functions for each port write.
+    // ***
+    void writeRows(uint8_t);
+    void writeDecoder(uint8_t);
+    void writeChipSelect(uint8_t);
+    uint8_t readChipSelect();
+
+    // ***
+    // *** Called by the HAL functions for the ADC.
+    // ***
+    void selectConversion(uint8_t);
+    void startConversion();
+    uint16_t readConversion();
+
+  protected:
+    // ***
+    // *** The display being simulated.
+    // ***
+    LedMatrix* _display;
+
+    // ***
+    // *** The time of the last port write and the time the
+    // *** counters were reset in CPU cycles.
+    // ***
+    uint64_t _last = 0;
+    uint64_t _start = 0;
+
+    // ***
+    // *** The accumulated on time of each LED.
+    // ***
+    uint64_t _onTime[COLUMNS][ROWS];
+
+    // ***
+    // *** Port writes made while a column was on.
+    // ***
+    uint32_t _glitches = 0;
+
+    // ***
+    // *** The LEDs that draw no current and the result of the
+    // *** last conversion.
+    // ***
+    uint8_t _deadLeds[COLUMNS];
+    uint16_t _conversion = 0;
+
+    // ***
+    // *** The delay from a compare match to its interrupt.
+    // ***
+    uint16_t _compareLatency = 0;
+
+    // ***
+    // *** Adds the time since the last port write to every
+    // *** LED that was lit during that time.
+    // ***
+    void accumulate();
+
+    // ***
+    // *** Gets the column selected by the decoder and chip select
+    // *** ports or -1 when no column is on.
+    // ***
+    int8_t selectedColumn();
+
+    // ***
+    // *** Gets the Timer1 count the specified number of CPU cycles
+    // *** after BOTTOM.
+    // ***
+    const uint16_t count(uint64_t, uint16_t);
+};
+
+// ***
+// *** The simulated time in CPU cycles used by millis() and micros().
+// ***
+extern uint64_t simulatorCycles;
+
+#endif
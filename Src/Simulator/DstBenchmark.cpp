@@ -0,0 +1,268 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#include <chrono>
+#include "TimeManager.h"
+
+// ***
+// *** Measures the cost of one DST calculation on a PC. The legacy
+// *** path is the calendar method TimeManager used before the
+// *** transition instants were cached: it builds the first day of
+// *** March or November and works out the day of the week on every
+// *** call. The cached path compares the time against the start and
+// *** end instants worked out once per year.
+// ***
+// *** Both paths are first checked against each other for every
+// *** hour (and the second before it) from 2000 to 2099 in every
+// *** time zone that uses the US rules, the only ones the legacy
+// *** path knows. The benchmark exits with 1 if they disagree. The
+// *** legacy path reports DST in the hour around New Year in zones
+// *** where the standard and daylight local times fall in different
+// *** years (December is after the start and January is before the
+// *** end); those hours are counted separately.
+// ***
+// *** Usage: dstbench
+// ***
+#define BENCHMARK_CALLS 2000000UL
+#define BENCHMARK_YEAR 2021
+
+// ***
+// *** The zones measured: eastern time (US) and
+// *** Australian eastern time (southern hemisphere).
+// ***
+#define BENCHMARK_ZONE_US 9
+#define BENCHMARK_ZONE_SOUTH 20
+
+// ***
+// *** The US rules used by the legacy path.
+// ***
+#define MARCH 3
+#define NOVEMBER 11
+#define DST_TIME 2
+
+TwoWire Wire;
+uint8_t PCICR = 0, PCMSK1 = 0;
+
+void pinMode(uint8_t, uint8_t) { }
+int digitalRead(uint8_t) { return HIGH; }
+unsigned long millis() { return 0; }
+
+// ***
+// *** Gives the benchmark access to the DST calculation and
+// *** keeps a copy of the legacy calendar method.
+// ***
+class BenchmarkTimeManager : public TimeManager
+{
+  public:
+    bool cachedDst(const DateTime& utc)
+    {
+      return this->calculateDst(utc);
+    }
+
+    bool emptyDst(const DateTime& utc)
+    {
+      return utc.second() == 0;
+    }
+
+    bool usesUsRules()
+    {
+      const DstTransition_t& start = this->_timeZone.dstStart;
+      const DstTransition_t& end = this->_timeZone.dstEnd;
+
+      return !this->_timeZone.observesDst ||
+        (start.month == MARCH && start.week == 2 && start.dayOfWeek == 0 && start.minutes == DST_TIME * 60 &&
+         end.month == NOVEMBER && end.week == 1 && end.dayOfWeek == 0 && end.minutes == DST_TIME * 60);
+    }
+
+    bool isYearEnd(const DateTime& utc)
+    {
+      return this->calculateLocalDateTime(utc, this->_timeZone.sOffset).year() != this->calculateLocalDateTime(utc, this->_timeZone.dOffset).year();
+    }
+
+    bool legacyDst(const DateTime& utc)
+    {
+      bool returnValue = false;
+
+      if (this->_timeZone.observesDst)
+      {
+        if (this->isAfterDstStart(this->calculateLocalDateTime(utc, this->_timeZone.sOffset)))
+        {
+          returnValue = this->isBeforeDstEnd(this->calculateLocalDateTime(utc, this->_timeZone.dOffset));
+        }
+      }
+
+      return returnValue;
+    }
+
+  protected:
+    bool isAfterDstStart(const DateTime& dt)
+    {
+      bool returnValue = false;
+
+      if (dt.month() > MARCH)
+      {
+        returnValue = true;
+      }
+      else if (dt.month() == MARCH)
+      {
+        DateTime s = DateTime(dt.year(), MARCH, 1, 0, 0, 0);
+        uint8_t secondSundayInMarch = s.dayOfTheWeek() == 0 ? s.day() + 7 : 7 + s.day() + (7 - s.dayOfTheWeek());
+        returnValue = dt.day() > secondSundayInMarch || (dt.day() == secondSundayInMarch && dt.hour() >= DST_TIME);
+      }
+
+      return returnValue;
+    }
+
+    bool isBeforeDstEnd(const DateTime& dt)
+    {
+      bool returnValue = false;
+
+      if (dt.month() < NOVEMBER)
+      {
+        returnValue = true;
+      }
+      else if (dt.month() == NOVEMBER)
+      {
+        DateTime s = DateTime(dt.year(), NOVEMBER, 1, 0, 0, 0);
+        uint8_t firstSundayInNovember = s.dayOfTheWeek() == 0 ? s.day() : s.day() + (7 - s.dayOfTheWeek());
+        returnValue = dt.day() < firstSundayInNovember || (dt.day() == firstSundayInNovember && dt.hour() < DST_TIME);
+      }
+
+      return returnValue;
+    }
+};
+
+BenchmarkTimeManager _timeManager;
+
+void onTimeEvent(TimeEventId_t eventId)
+{
+}
+
+// ***
+// *** Checks the cached path against the legacy path.
+// ***
+uint32_t compare(uint32_t* yearEnd)
+{
+  uint32_t returnValue = 0;
+  uint32_t first = DateTime(2000, 1, 1, 1, 0, 0).unixtime();
+  uint32_t last = DateTime(2099, 12, 31, 23, 0, 0).unixtime();
+
+  for (uint8_t timeZoneId = 0; timeZoneId < TimeManager::timeZoneCount(); timeZoneId++)
+  {
+    _timeManager.timeZoneId(timeZoneId);
+
+    if (!_timeManager.usesUsRules())
+    {
+      continue;
+    }
+
+    for (uint32_t t = first; t <= last; t += 3600)
+    {
+      for (uint32_t s = t - 1; s <= t; s++)
+      {
+        DateTime utc = DateTime(s);
+
+        if (_timeManager.cachedDst(utc) == _timeManager.legacyDst(utc))
+        {
+        }
+        else if (_timeManager.isYearEnd(utc))
+        {
+          (*yearEnd)++;
+        }
+        else
+        {
+          if (returnValue < 10)
+          {
+            printf("Mismatch: zone %u, %04u-%02u-%02u %02u:%02u:%02u UTC\n", timeZoneId, utc.year(), utc.month(), utc.day(), utc.hour(), utc.minute(), utc.second());
+          }
+
+          returnValue++;
+        }
+      }
+    }
+  }
+
+  return returnValue;
+}
+
+// ***
+// *** Returns a timestamp in CPU cycles where the processor
+// *** has a cycle counter and in nanoseconds otherwise.
+// ***
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TIMESTAMP_UNITS "cycles"
+uint64_t timestamp() { return __rdtsc(); }
+#else
+#define TIMESTAMP_UNITS "ns"
+uint64_t timestamp() { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+#endif
+
+// ***
+// *** Runs the DST calculation BENCHMARK_CALLS times over a year
+// *** and returns the average cost of one call. The cost of the
+// *** loop and of building each DateTime is measured with an
+// *** empty call and taken off.
+// ***
+double measure(bool (BenchmarkTimeManager::*dst)(const DateTime&))
+{
+  static const uint32_t step = (365UL * 86400UL) / BENCHMARK_CALLS;
+  uint32_t start = DateTime(BENCHMARK_YEAR, 1, 1, 0, 0, 0).unixtime();
+  volatile uint32_t count = 0;
+
+  uint64_t begin = timestamp();
+
+  for (uint32_t i = 0; i < BENCHMARK_CALLS; i++)
+  {
+    count += (_timeManager.*dst)(DateTime(start + i * step));
+  }
+
+  uint64_t end = timestamp();
+
+  return (double)(end - begin) / BENCHMARK_CALLS;
+}
+
+int main(int argc, char* argv[])
+{
+  _timeManager.begin(0, DstMode_t::AUTO, true, onTimeEvent);
+
+  uint32_t yearEnd = 0;
+  uint32_t mismatches = compare(&yearEnd);
+  printf("Cached and legacy DST agree: %s (%u mismatches, %u legacy New Year hours)\n", mismatches == 0 ? "yes" : "no", mismatches, yearEnd);
+
+  // ***
+  // *** Eastern time observes DST so both paths do all
+  // *** of their work.
+  // ***
+  _timeManager.timeZoneId(BENCHMARK_ZONE_US);
+
+  double overhead = measure(&BenchmarkTimeManager::emptyDst);
+  double legacy = measure(&BenchmarkTimeManager::legacyDst) - overhead;
+  double cached = measure(&BenchmarkTimeManager::cachedDst) - overhead;
+
+  // ***
+  // *** The legacy path does not know the southern
+  // *** hemisphere rules; only the cached path is measured.
+  // ***
+  _timeManager.timeZoneId(BENCHMARK_ZONE_SOUTH);
+  double south = measure(&BenchmarkTimeManager::cachedDst) - overhead;
+
+  printf("Legacy: %.1f %s per call\n", legacy, TIMESTAMP_UNITS);
+  printf("Cached: %.1f %s per call\n", cached, TIMESTAMP_UNITS);
+  printf("Cached (southern hemisphere): %.1f %s per call\n", south, TIMESTAMP_UNITS);
+
+  return mismatches == 0 ? 0 : 1;
+}
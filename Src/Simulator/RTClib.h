@@ -0,0 +1,142 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#ifndef RTCLIB_H
+#define RTCLIB_H
+
+// ***
+// *** Just enough of RTClib to build TimeManager on a PC. DateTime
+// *** uses the same calendar arithmetic as the library (2000 to
+// *** 2099). The RTC is a plain variable that is set by adjust().
+// ***
+#include <Arduino.h>
+
+class DateTime
+{
+  public:
+    DateTime(uint32_t t = SECONDS_FROM_1970_TO_2000)
+    {
+      t -= SECONDS_FROM_1970_TO_2000;
+      this->_second = t % 60;
+      t /= 60;
+      this->_minute = t % 60;
+      t /= 60;
+      this->_hour = t % 24;
+
+      uint16_t days = t / 24;
+      uint8_t leap = 0;
+
+      for (this->_yearOffset = 0; ; this->_yearOffset++)
+      {
+        leap = this->_yearOffset % 4 == 0;
+
+        if (days < 365U + leap)
+        {
+          break;
+        }
+
+        days -= 365 + leap;
+      }
+
+      for (this->_month = 1; this->_month < 12; this->_month++)
+      {
+        uint8_t daysPerMonth = DateTime::daysInMonth(this->_month, leap);
+
+        if (days < daysPerMonth)
+        {
+          break;
+        }
+
+        days -= daysPerMonth;
+      }
+
+      this->_day = days + 1;
+    }
+
+    DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t minute = 0, uint8_t second = 0)
+    {
+      this->_yearOffset = year >= 2000 ? year - 2000 : year;
+      this->_month = month;
+      this->_day = day;
+      this->_hour = hour;
+      this->_minute = minute;
+      this->_second = second;
+    }
+
+    uint16_t year() const { return 2000 + this->_yearOffset; }
+    uint8_t month() const { return this->_month; }
+    uint8_t day() const { return this->_day; }
+    uint8_t hour() const { return this->_hour; }
+    uint8_t minute() const { return this->_minute; }
+    uint8_t second() const { return this->_second; }
+
+    // ***
+    // *** 0 is Sunday. 1 January 2000 was a Saturday.
+    // ***
+    uint8_t dayOfTheWeek() const
+    {
+      return (this->days() + 6) % 7;
+    }
+
+    uint32_t unixtime() const
+    {
+      return ((this->days() * 24UL + this->_hour) * 60 + this->_minute) * 60 + this->_second + SECONDS_FROM_1970_TO_2000;
+    }
+
+  protected:
+    static const uint32_t SECONDS_FROM_1970_TO_2000 = 946684800UL;
+
+    static uint8_t daysInMonth(uint8_t month, bool leap)
+    {
+      static const uint8_t days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+      return days[month - 1] + (leap && month == 2 ? 1 : 0);
+    }
+
+    // ***
+    // *** The number of days since 1 January 2000.
+    // ***
+    uint16_t days() const
+    {
+      uint16_t returnValue = this->_day - 1;
+
+      for (uint8_t month = 1; month < this->_month; month++)
+      {
+        returnValue += DateTime::daysInMonth(month, this->_yearOffset % 4 == 0);
+      }
+
+      return returnValue + 365 * this->_yearOffset + (this->_yearOffset + 3) / 4;
+    }
+
+    uint8_t _yearOffset;
+    uint8_t _month;
+    uint8_t _day;
+    uint8_t _hour;
+    uint8_t _minute;
+    uint8_t _second;
+};
+
+class RTC_DS1307
+{
+  public:
+    bool begin() { return true; }
+    DateTime now() { return this->_now; }
+    void adjust(const DateTime& dateTime) { this->_now = dateTime; }
+
+  protected:
+    DateTime _now;
+};
+
+#endif
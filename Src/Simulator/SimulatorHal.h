@@ -0,0 +1,43 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#ifndef SIMULATOR_HAL_H
+#define SIMULATOR_HAL_H
+
+#include <stdint.h>
+
+// ***
+// *** The simulator versions of the display port writes and the ADC.
+// *** Each write updates the simulated port and is recorded by the
+// *** simulator at the current simulated time.
+// ***
+void simulatorWriteRows(uint8_t rows);
+void simulatorWriteDecoder(uint8_t address);
+void simulatorWriteChipSelect(uint8_t select);
+uint8_t simulatorReadChipSelect();
+void simulatorSelectConversion(uint8_t channel);
+void simulatorStartConversion();
+uint16_t simulatorReadConversion();
+
+#define WRITE_ROWS(rows) simulatorWriteRows(rows)
+#define WRITE_DECODER(address) simulatorWriteDecoder(address)
+#define WRITE_CHIP_SELECT(select) simulatorWriteChipSelect(select)
+#define READ_CHIP_SELECT() simulatorReadChipSelect()
+#define SELECT_CONVERSION(channel) simulatorSelectConversion(channel)
+#define START_CONVERSION() simulatorStartConversion()
+#define READ_CONVERSION() simulatorReadConversion()
+
+#endif
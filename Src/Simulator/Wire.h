@@ -0,0 +1,36 @@
+// ***
+// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+// *** 
+// *** This program is free software: you can redistribute it and/or modify
+// *** it under the terms of the GNU Lesser General Public License as published
+// *** by the Free Software Foundation, either version 3 of the License, or
+// *** (at your option) any later version.
+// *** 
+// *** This program is distributed in the hope that it will be useful,
+// *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// *** GNU Lesser General Public License for more details.
+// *** 
+// *** You should have received a copy of the GNU Lesser General Public License
+// *** along with this program. If not, see http://www.gnu.org/licenses/.
+// ***
+#ifndef WIRE_H
+#define WIRE_H
+
+// ***
+// *** There is no I2C bus in the simulator. Writes go nowhere.
+// ***
+#include <Arduino.h>
+
+class TwoWire
+{
+  public:
+    void begin() { }
+    void beginTransmission(uint8_t) { }
+    size_t write(uint8_t) { return 1; }
+    uint8_t endTransmission() { return 0; }
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+# ***
+# *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.
+# ***
+# *** This program is free software: you can redistribute it and/or modify
+# *** it under the terms of the GNU Lesser General Public License as published
+# *** by the Free Software Foundation, either version 3 of the License, or
+# *** (at your option) any later version.
+# ***
+# *** This program is distributed in the hope that it will be useful,
+# *** but WITHOUT ANY WARRANTY; without even the implied warranty of
+# *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# *** GNU Lesser General Public License for more details.
+# ***
+# *** You should have received a copy of the GNU Lesser General Public License
+# *** along with this program. If not, see http://www.gnu.org/licenses/.
+# ***
+
+# ***
+# *** Converts a list of POSIX TZ strings (the .json file) into the
+# *** time zone table used by TimeManager. Each zone is stored in
+# *** PROGMEM with its offsets in minutes and the DST start and end
+# *** rules as "nth weekday of the month" transitions, so the rules
+# *** are parsed here instead of on the device.
+# ***
+# *** Usage:
+# ***
+# ***   python3 TimeZoneGenerator.py TimeZones.json \
+# ***     ../Clock3/Other/TimeZones.h ../Clock3/Tests/TimeZone/TimeZones.h
+# ***
+# *** The zone ID is the position in the list. The IDs are stored in
+# *** EEPROM so new zones are added to the end of the list.
+# *** The location is the IANA zone the TZ string was taken from; it
+# *** is only there for reference.
+# ***
+# *** Only the Mm.w.d[/time] form of the DST rules is supported. TZ
+# *** strings that observe DST must give both rules.
+# ***
+import argparse
+import json
+import re
+import sys
+
+# ***
+# *** TimeManager stores names in char[5].
+# ***
+NAME_SIZE = 5
+
+# ***
+# *** The size of one TimeZone_t on the AVR.
+# ***
+TRANSITION_SIZE = 5   # uint8_t month, week, dayOfWeek, int16_t minutes
+TIME_ZONE_SIZE = 1 + NAME_SIZE * 2 + 2 * 2 + 1 + TRANSITION_SIZE * 2
+
+# ***
+# *** The transition time used when a rule does not give one.
+# ***
+DEFAULT_TRANSITION_MINUTES = 120
+
+NAME = r'(?:<(?P<{0}q>[A-Za-z0-9+-]+)>|(?P<{0}>[A-Za-z]{{3,}}))'
+OFFSET = r'[+-]?\d{1,2}(?::\d{2}){0,2}'
+RULE = r'M\d{1,2}\.\d\.\d(?:/' + OFFSET + ')?'
+POSIX_TZ = re.compile('^' + NAME.format('std') + '(?P<stdOffset>' + OFFSET + ')'
+                      + '(?:' + NAME.format('dst') + '(?P<dstOffset>' + OFFSET + ')?'
+                      + '(?:,(?P<start>' + RULE + '),(?P<end>' + RULE + '))?)?$')
+
+
+def parse_offset(value):
+    # ***
+    # *** Returns [+-]hh[:mm[:ss]] in minutes. Seconds are dropped.
+    # ***
+    sign = -1 if value.startswith('-') else 1
+    parts = [int(part) for part in value.lstrip('+-').split(':')]
+    parts += [0] * (3 - len(parts))
+    return sign * (parts[0] * 60 + parts[1])
+
+
+def parse_rule(value):
+    # ***
+    # *** Mm.w.d[/time]: month 1 to 12, week 1 to 5 (5 is the last
+    # *** one in the month) and day 0 (Sunday) to 6. The time is the
+    # *** local time of the transition and may be negative or past
+    # *** midnight.
+    # ***
+    date, _, time = value[1:].partition('/')
+    month, week, day = (int(part) for part in date.split('.'))
+    minutes = parse_offset(time) if time else DEFAULT_TRANSITION_MINUTES
+
+    if not 1 <= month <= 12 or not 1 <= week <= 5 or not 0 <= day <= 6:
+        raise ValueError('invalid rule "%s"' % value)
+
+    # ***
+    # *** TimeManager works out the transitions once per UTC year so
+    # *** they cannot fall near New Year.
+    # ***
+    if month in (1, 12):
+        raise ValueError('rule "%s" is too close to New Year' % value)
+
+    return (month, week, day, minutes)
+
+
+def parse(tz):
+    match = POSIX_TZ.match(tz)
+
+    if not match:
+        raise ValueError('"%s" is not a supported POSIX TZ string' % tz)
+
+    standardName = match.group('stdq') or match.group('std')
+    daylightName = match.group('dstq') or match.group('dst')
+
+    # ***
+    # *** POSIX offsets are hours west of UTC; TimeManager uses
+    # *** minutes east of UTC.
+    # ***
+    standardOffset = -parse_offset(match.group('stdOffset'))
+
+    if daylightName:
+        if not match.group('start'):
+            raise ValueError('"%s" observes DST but has no rules' % tz)
+
+        daylightOffset = -parse_offset(match.group('dstOffset')) if match.group('dstOffset') else standardOffset + 60
+        start = parse_rule(match.group('start'))
+        end = parse_rule(match.group('end'))
+    else:
+        daylightName = standardName
+        daylightOffset = standardOffset
+        start = end = (0, 0, 0, 0)
+
+    for name in (standardName, daylightName):
+        if len(name) >= NAME_SIZE:
+            raise ValueError('the name "%s" in "%s" is longer than %d characters' % (name, tz, NAME_SIZE - 1))
+
+    return {
+        'standardName': standardName,
+        'daylightName': daylightName,
+        'standardOffset': standardOffset,
+        'daylightOffset': daylightOffset,
+        'observesDst': daylightName != standardName or daylightOffset != standardOffset,
+        'start': start,
+        'end': end
+    }
+
+
+def transition(rule):
+    return '{ %d, %d, %d, %d }' % rule
+
+
+def generate(zones):
+    lines = []
+    lines.append('// ***')
+    lines.append('// *** Copyright(C) 2020, Daniel M. Porrey. All rights reserved.')
+    lines.append('// ***')
+    lines.append('// *** This program is free software: you can redistribute it and/or modify')
+    lines.append('// *** it under the terms of the GNU Lesser General Public License as published')
+    lines.append('// *** by the Free Software Foundation, either version 3 of the License, or')
+    lines.append('// *** (at your option) any later version.')
+    lines.append('// ***')
+    lines.append('// *** This program is distributed in the hope that it will be useful,')
+    lines.append('// *** but WITHOUT ANY WARRANTY; without even the implied warranty of')
+    lines.append('// *** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the')
+    lines.append('// *** GNU Lesser General Public License for more details.')
+    lines.append('// ***')
+    lines.append('// *** You should have received a copy of the GNU Lesser General Public License')
+    lines.append('// *** along with this program. If not, see http://www.gnu.org/licenses/.')
+    lines.append('// ***')
+    lines.append('')
+    lines.append('/*')
+    lines.append('')
+    lines.append('This file was generated by TimeZoneGenerator.py. Do not edit it; change')
+    lines.append('TimeZones.json and run the generator again.')
+    lines.append('')
+    lines.append('Offsets are in minutes east of UTC. DST starts at the local standard time')
+    lines.append('and ends at the local daylight time given by each transition:')
+    lines.append('{ month, week (5 is the last), day of the week (0 is Sunday), minutes }.')
+    lines.append('')
+    lines.append('This file is included by TimeManager.h after TimeZone_t is defined.')
+    lines.append('')
+    lines.append('*/')
+    lines.append('')
+    lines.append('#ifndef TIME_ZONES_H')
+    lines.append('#define TIME_ZONES_H')
+    lines.append('')
+    lines.append('const static TimeZone_t _timeZones[] PROGMEM =')
+    lines.append('{')
+
+    for id, zone in enumerate(zones):
+        rule = parse(zone['tz'])
+        separator = ',' if id < len(zones) - 1 else ' '
+        entry = '{ %2d, "%s", "%s", %d, %d, %s, %s, %s }%s' % (
+            id,
+            rule['standardName'],
+            rule['daylightName'],
+            rule['standardOffset'],
+            rule['daylightOffset'],
+            'true' if rule['observesDst'] else 'false',
+            transition(rule['start']),
+            transition(rule['end']),
+            separator)
+        lines.append('  %-80s // %s (%s)' % (entry, zone['description'], zone['tz']))
+
+    lines.append('};')
+    lines.append('')
+    lines.append('#endif')
+
+    return '\r\n'.join(lines) + '\r\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generates the time zone table for Clock3.')
+    parser.add_argument('input', help='the list of time zones (.json)')
+    parser.add_argument('output', nargs='+', help='the header file(s) to write')
+    args = parser.parse_args()
+
+    with open(args.input, encoding='utf-8-sig') as file:
+        zones = json.load(file)
+
+    try:
+        header = generate(zones)
+    except ValueError as error:
+        print('Error: %s' % error, file=sys.stderr)
+        return 1
+
+    for output in args.output:
+        with open(output, 'w', newline='') as file:
+            file.write(header)
+
+    print('Time zones: %d' % len(zones))
+    print('Flash used: %d bytes' % (len(zones) * TIME_ZONE_SIZE))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())